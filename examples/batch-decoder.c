@@ -0,0 +1,88 @@
+/* SPDX-License-Identifier: 0BSD */
+#include "../miniflac_batch.h"
+/* miniflac_batch.h has the declarations already, this adds the implementation */
+#define MINIFLAC_IMPLEMENTATION
+#include "../miniflac.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <pthread.h>
+
+/* example program that decodes a list of native FLAC files on several
+ * threads with miniflac_batch_decode, and prints how each one went. Nothing
+ * gets written out, it's a check that every frame decodes. */
+
+struct report_s {
+    const char* const* paths;
+    pthread_mutex_t lock;
+    uint32_t failed;
+};
+
+typedef struct report_s report_t;
+
+static void
+report(uint32_t file, const miniflac_batch_result_t* result, void* userdata) {
+    report_t* r = (report_t*)userdata;
+
+    pthread_mutex_lock(&r->lock);
+    if(result->result == MINIFLAC_OK) {
+        fprintf(stdout,"%s: ok, %u frames, %lu samples\n",
+          r->paths[file],result->frames,(unsigned long)result->samples);
+    } else {
+        fprintf(stdout,"%s: error %d\n",r->paths[file],result->result);
+        r->failed++;
+    }
+    pthread_mutex_unlock(&r->lock);
+}
+
+int main(int argc, const char* argv[]) {
+    int r = 1;
+    uint32_t threads;
+    uint32_t count;
+    uint32_t i;
+    miniflac_batch_input_t* inputs = NULL;
+    report_t rep;
+
+    rep.paths = &argv[2];
+    rep.failed = 0;
+    pthread_mutex_init(&rep.lock,NULL);
+
+    if(argc < 3) {
+        fprintf(stderr,"Usage: %s threads /path/to/flac [/path/to/flac ...]\n",argv[0]);
+        goto cleanup;
+    }
+
+    threads = (uint32_t)strtoul(argv[1],NULL,10);
+    if(threads == 0) {
+        fprintf(stderr,"threads must be at least 1\n");
+        goto cleanup;
+    }
+
+    count = (uint32_t)(argc - 2);
+    inputs = (miniflac_batch_input_t*)malloc(sizeof(miniflac_batch_input_t) * count);
+    if(inputs == NULL) {
+        fprintf(stderr,"out of memory\n");
+        goto cleanup;
+    }
+
+    /* files are read by the threads as they get to them */
+    for(i = 0; i < count; i++) {
+        inputs[i].path = argv[i + 2];
+        inputs[i].data = NULL;
+        inputs[i].length = 0;
+    }
+
+    if(miniflac_batch_decode(inputs,count,threads,report,&rep) != 0) {
+        fprintf(stderr,"failed to start the batch\n");
+        goto cleanup;
+    }
+
+    fprintf(stderr,"%u of %u files failed\n",rep.failed,count);
+    r = rep.failed != 0;
+
+    cleanup:
+    if(inputs != NULL) free(inputs);
+    pthread_mutex_destroy(&rep.lock);
+    return r;
+}
@@ -0,0 +1,325 @@
+/* SPDX-License-Identifier: 0BSD */
+#define MINIFLAC_IMPLEMENTATION
+#include "../miniflac.h"
+#include "wav.h"
+#include "slurp.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <stdint.h>
+#include <pthread.h>
+
+/* example program that decodes every FLAC stream in a multiplexed (or
+ * chained) Ogg file, each into a .wav file of its own.
+ *
+ * The file is only read once. miniflac_ogg_pageinfo reads each page
+ * header, and the page goes to the decoder for its serial number -
+ * every decoder only ever sees the pages of its own stream, and picks
+ * the stream up from its first page. Pages of streams that aren't FLAC
+ * are dropped.
+ *
+ * With threads each stream gets one of its own. The demuxer just queues
+ * up where the stream's pages are (they stay in the file's buffer), and
+ * the stream's thread decodes them as they come in. */
+
+#define MAX_STREAMS 64
+
+struct page_s {
+    uint32_t offset;
+    uint32_t size;
+};
+
+typedef struct page_s page_t;
+
+struct stream_s {
+    int32_t serialno;
+    char path[4096];
+    miniflac_t* decoder;
+    FILE* output;
+    MINIFLAC_SAMPLE_FORMAT format;
+    uint8_t bps; /* of the .wav file, 0 until the first frame */
+    uint8_t* pcm;
+    int32_t* scratch;
+    MINIFLAC_RESULT result; /* stays MINIFLAC_OK until something fails */
+    uint32_t frames;
+    uint64_t samples;
+
+    /* pages waiting for the stream's thread */
+    const uint8_t* data;
+    pthread_t thread;
+    uint8_t started;
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+    page_t* pages;
+    uint32_t head;
+    uint32_t tail;
+    uint32_t capacity;
+    uint8_t done; /* no more pages are coming */
+};
+
+typedef struct stream_s stream_t;
+
+static void
+stream_free(stream_t* stream) {
+    if(stream->output != NULL) fclose(stream->output);
+    if(stream->pages != NULL) free(stream->pages);
+    if(stream->scratch != NULL) free(stream->scratch);
+    if(stream->pcm != NULL) free(stream->pcm);
+    if(stream->decoder != NULL) free(stream->decoder);
+    pthread_cond_destroy(&stream->wake);
+    pthread_mutex_destroy(&stream->lock);
+    free(stream);
+}
+
+static stream_t*
+stream_new(const uint8_t* data, int32_t serialno, uint32_t link, const char* prefix) {
+    stream_t* stream;
+
+    stream = (stream_t*)malloc(sizeof(stream_t));
+    if(stream == NULL) return NULL;
+    memset(stream,0,sizeof(stream_t));
+    pthread_mutex_init(&stream->lock,NULL);
+    pthread_cond_init(&stream->wake,NULL);
+
+    stream->data = data;
+    stream->serialno = serialno;
+    stream->result = MINIFLAC_OK;
+    /* chained links can reuse a serial number, the link number keeps
+     * their files apart */
+    snprintf(stream->path,sizeof(stream->path),"%s-%08x-%u.wav",prefix,(uint32_t)serialno,link);
+
+    stream->decoder = (miniflac_t*)malloc(miniflac_size());
+    stream->pcm = (uint8_t*)malloc(sizeof(int32_t) * 8 * 65536);
+    stream->scratch = (int32_t*)malloc(sizeof(int32_t) * 2 * 65536);
+    if(stream->decoder == NULL || stream->pcm == NULL || stream->scratch == NULL) {
+        stream_free(stream);
+        return NULL;
+    }
+    miniflac_init(stream->decoder,MINIFLAC_CONTAINER_OGG);
+    return stream;
+}
+
+/* called once the decoder has reached the first frame, by then the
+ * stream info has been read */
+static int
+stream_open(stream_t* stream) {
+    uint8_t bps = stream->decoder->metadata.streaminfo.bps;
+
+    if(bps <= 16) {
+        stream->format = MINIFLAC_SAMPLE_INT16;
+        stream->bps = 16;
+    } else if(bps <= 24) {
+        stream->format = MINIFLAC_SAMPLE_INT24;
+        stream->bps = 24;
+    } else {
+        stream->format = MINIFLAC_SAMPLE_INT32;
+        stream->bps = 32;
+    }
+
+    stream->output = fopen(stream->path,"wb");
+    if(stream->output == NULL) {
+        fprintf(stderr,"Failed to open %s: %s\n",stream->path,strerror(errno));
+        return -1;
+    }
+    return wav_header_create(stream->output,stream->decoder->metadata.streaminfo.sample_rate,
+      stream->decoder->frame.header.channels,stream->bps) == 0 ? 0 : -1;
+}
+
+static MINIFLAC_RESULT
+stream_decode_page(stream_t* stream, const uint8_t* page, uint32_t size) {
+    uint32_t pos = 0;
+    uint32_t used = 0;
+    uint32_t bytes;
+    MINIFLAC_RESULT res;
+
+    while(pos < size) {
+        /* sync up to the first frame to find out the sample format */
+        if(stream->bps == 0) {
+            res = miniflac_sync(stream->decoder,&page[pos],size - pos,&used);
+            pos += used;
+            if(res == MINIFLAC_CONTINUE) continue;
+            if(res != MINIFLAC_OK) return res;
+            if(stream->decoder->state == MINIFLAC_FRAME && stream_open(stream) != 0) return MINIFLAC_ERROR;
+            continue;
+        }
+
+        res = miniflac_decode_interleaved(stream->decoder,&page[pos],size - pos,&used,stream->format,stream->pcm,stream->scratch);
+        pos += used;
+        if(res == MINIFLAC_CONTINUE) continue;
+        if(res != MINIFLAC_OK) return res;
+
+        bytes = stream->decoder->frame.header.block_size * stream->decoder->frame.header.channels * (stream->bps / 8);
+        if(fwrite(stream->pcm,1,bytes,stream->output) != bytes) {
+            fprintf(stderr,"Failed to write %s: %s\n",stream->path,strerror(errno));
+            return MINIFLAC_ERROR;
+        }
+        stream->frames++;
+        stream->samples += stream->decoder->frame.header.block_size;
+    }
+    return MINIFLAC_OK;
+}
+
+static void*
+stream_thread(void* userdata) {
+    stream_t* stream = (stream_t*)userdata;
+    page_t page;
+
+    for(;;) {
+        pthread_mutex_lock(&stream->lock);
+        while(stream->head == stream->tail && !stream->done) {
+            pthread_cond_wait(&stream->wake,&stream->lock);
+        }
+        if(stream->head == stream->tail) {
+            pthread_mutex_unlock(&stream->lock);
+            break;
+        }
+        page = stream->pages[stream->head++];
+        pthread_mutex_unlock(&stream->lock);
+
+        /* after an error the rest of the stream's pages are ignored */
+        if(stream->result == MINIFLAC_OK) {
+            stream->result = stream_decode_page(stream,&stream->data[page.offset],page.size);
+        }
+    }
+    return NULL;
+}
+
+static int
+stream_queue(stream_t* stream, uint32_t offset, uint32_t size) {
+    page_t* pages;
+    int r = 0;
+
+    pthread_mutex_lock(&stream->lock);
+    if(stream->tail == stream->capacity) {
+        pages = (page_t*)realloc(stream->pages,sizeof(page_t) * (stream->capacity == 0 ? 256 : stream->capacity * 2));
+        if(pages == NULL) {
+            r = -1;
+            goto stream_queue_exit;
+        }
+        stream->pages = pages;
+        stream->capacity = stream->capacity == 0 ? 256 : stream->capacity * 2;
+    }
+    stream->pages[stream->tail].offset = offset;
+    stream->pages[stream->tail].size = size;
+    stream->tail++;
+    pthread_cond_signal(&stream->wake);
+
+    stream_queue_exit:
+    pthread_mutex_unlock(&stream->lock);
+    return r;
+}
+
+static void
+stream_finish(stream_t* stream) {
+    pthread_mutex_lock(&stream->lock);
+    stream->done = 1;
+    pthread_cond_signal(&stream->wake);
+    pthread_mutex_unlock(&stream->lock);
+}
+
+int main(int argc, const char* argv[]) {
+    int r = 1;
+    int threaded = 1;
+    uint8_t* data = NULL;
+    uint32_t length = 0;
+    uint32_t pos = 0;
+    uint32_t count = 0;
+    uint32_t failed = 0;
+    uint32_t i;
+    stream_t* streams[MAX_STREAMS];
+    stream_t* stream;
+    miniflac_ogg_pageinfo_t info;
+    MINIFLAC_RESULT res;
+
+    if(argc < 3) {
+        fprintf(stderr,"Usage: %s /path/to/ogg output-prefix [threaded]\n",argv[0]);
+        goto cleanup;
+    }
+
+    if(argc > 3) threaded = atoi(argv[3]) != 0;
+
+    data = slurp(argv[1],&length);
+    if(data == NULL) goto cleanup;
+
+    while(pos < length) {
+        res = miniflac_ogg_pageinfo(&data[pos],length - pos,&info);
+        if(res != MINIFLAC_OK) {
+            fprintf(stderr,"Bad or truncated page at %u\n",pos);
+            break;
+        }
+
+        if(info.flac) {
+            if(count == MAX_STREAMS) {
+                fprintf(stderr,"Too many streams\n");
+                break;
+            }
+            stream = stream_new(data,info.serialno,count,argv[2]);
+            if(stream == NULL) {
+                fprintf(stderr,"Failed to allocate stream\n");
+                break;
+            }
+            streams[count++] = stream;
+            if(threaded) {
+                if(pthread_create(&stream->thread,NULL,stream_thread,stream) != 0) {
+                    fprintf(stderr,"Failed to start thread\n");
+                    break;
+                }
+                stream->started = 1;
+            }
+        }
+
+        /* a chained file can reuse a serial number, the latest stream
+         * with it gets the page */
+        stream = NULL;
+        for(i = count; i > 0; i--) {
+            if(streams[i - 1]->serialno == info.serialno) {
+                stream = streams[i - 1];
+                break;
+            }
+        }
+
+        if(stream != NULL) {
+            if(threaded) {
+                if(stream_queue(stream,pos,info.size) != 0) {
+                    fprintf(stderr,"Failed to queue page\n");
+                    break;
+                }
+            } else if(stream->result == MINIFLAC_OK) {
+                stream->result = stream_decode_page(stream,&data[pos],info.size);
+            }
+        }
+
+        pos += info.size;
+    }
+
+    for(i = 0; i < count; i++) {
+        stream_finish(streams[i]);
+    }
+    for(i = 0; i < count; i++) {
+        if(streams[i]->started) pthread_join(streams[i]->thread,NULL);
+    }
+
+    for(i = 0; i < count; i++) {
+        stream = streams[i];
+        if(stream->output != NULL) wav_header_finish(stream->output,stream->bps);
+        if(stream->result == MINIFLAC_OK && stream->output != NULL) {
+            fprintf(stdout,"%08x: %u frames, %lu samples, %s\n",
+              (uint32_t)stream->serialno,stream->frames,(unsigned long)stream->samples,stream->path);
+        } else {
+            fprintf(stdout,"%08x: error %d\n",(uint32_t)stream->serialno,stream->result);
+            failed++;
+        }
+    }
+
+    fprintf(stderr,"decoded %u of %u FLAC streams%s\n",count - failed,count,threaded ? " with a thread each" : "");
+    r = pos != length || failed != 0;
+
+    cleanup:
+    for(i = 0; i < count; i++) {
+        stream_free(streams[i]);
+    }
+    if(data != NULL) free(data);
+    return r;
+}
@@ -0,0 +1,287 @@
+/* SPDX-License-Identifier: 0BSD */
+#define MINIFLAC_IMPLEMENTATION
+#include "../miniflac.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <stdint.h>
+#include <limits.h>
+
+/* example program that scans a native FLAC file once and saves a frame
+ * index, using only the frame headers. Given a sample number as well,
+ * it loads a saved index instead, looks the sample up with
+ * miniflac_frameinfo_find, seeks straight to its frame and decodes from
+ * exactly that sample.
+ *
+ * The index file is the 8 bytes "MFLACIDX", a 4-byte little-endian
+ * count of frames, then one 19-byte record per frame:
+ *   8 bytes byte offset of the frame header
+ *   8 bytes first sample of the frame
+ *   2 bytes block size
+ *   1 byte  header size
+ * all little-endian. The records are a fixed size, so a single entry
+ * can be read straight from the file with one seek. */
+
+static size_t
+readcb(uint8_t* buffer, size_t size, void* userdata) {
+    return fread(buffer,1,size,(FILE *)userdata);
+}
+
+static int
+seekcb(uint64_t offset, void* userdata) {
+    if(offset > (uint64_t)LONG_MAX) return -1;
+    return fseek((FILE *)userdata,(long)offset,SEEK_SET);
+}
+
+static void
+pack_le(uint8_t* out, uint64_t val, unsigned int bytes) {
+    unsigned int i;
+    for(i = 0; i < bytes; i++) {
+        out[i] = (uint8_t)(val >> (i * 8));
+    }
+}
+
+static int
+write_entry(FILE* output, const miniflac_frameinfo_t* info) {
+    uint8_t record[19];
+    pack_le(&record[0],info->offset,8);
+    pack_le(&record[8],info->sample_number,8);
+    pack_le(&record[16],info->block_size,2);
+    record[18] = info->header_size;
+    return fwrite(record,1,sizeof(record),output) == sizeof(record);
+}
+
+static uint64_t
+unpack_le(const uint8_t* in, unsigned int bytes) {
+    uint64_t val = 0;
+    unsigned int i;
+    for(i = 0; i < bytes; i++) {
+        val |= ((uint64_t)in[i]) << (i * 8);
+    }
+    return val;
+}
+
+/* reads a whole index file, returns NULL if it can't be read or
+ * isn't an index. The file isn't trusted: every frame needs a block
+ * size, and frames have to come in order of sample number and offset.
+ * Offsets are checked against the stream once it's open. */
+static miniflac_frameinfo_t*
+read_index(const char* path, uint32_t* frames) {
+    FILE* input;
+    miniflac_frameinfo_t* index = NULL;
+    uint8_t header[12];
+    uint8_t record[19];
+    uint32_t i;
+
+    input = fopen(path,"rb");
+    if(input == NULL) {
+        fprintf(stderr,"error opening %s: %s\n",path,strerror(errno));
+        return NULL;
+    }
+
+    if(fread(header,1,sizeof(header),input) != sizeof(header) || memcmp(header,"MFLACIDX",8) != 0) {
+        fprintf(stderr,"%s is not a frame index\n",path);
+        goto read_index_error;
+    }
+    *frames = (uint32_t)unpack_le(&header[8],4);
+    if(*frames == 0) {
+        fprintf(stderr,"%s has no frames\n",path);
+        goto read_index_error;
+    }
+
+    index = (miniflac_frameinfo_t*)malloc(sizeof(miniflac_frameinfo_t) * *frames);
+    if(index == NULL) {
+        fprintf(stderr,"out of memory\n");
+        goto read_index_error;
+    }
+
+    for(i = 0; i < *frames; i++) {
+        if(fread(record,1,sizeof(record),input) != sizeof(record)) {
+            fprintf(stderr,"%s is truncated\n",path);
+            goto read_index_error;
+        }
+        index[i].offset = unpack_le(&record[0],8);
+        index[i].sample_number = unpack_le(&record[8],8);
+        index[i].block_size = (uint16_t)unpack_le(&record[16],2);
+        index[i].header_size = record[18];
+
+        if(index[i].block_size == 0) {
+            fprintf(stderr,"%s: frame %u has no samples\n",path,i);
+            goto read_index_error;
+        }
+        if(i > 0 && (index[i].sample_number <= index[i - 1].sample_number || index[i].offset <= index[i - 1].offset)) {
+            fprintf(stderr,"%s: frame %u is out of order\n",path,i);
+            goto read_index_error;
+        }
+    }
+
+    fclose(input);
+    return index;
+
+    read_index_error:
+    if(index != NULL) free(index);
+    fclose(input);
+    return NULL;
+}
+
+/* seeks to sample_number with the help of the index and decodes the
+ * frame it's in, from that sample on */
+static int
+seek_with_index(mflac_t* m, const miniflac_frameinfo_t* index, uint32_t frames, uint64_t sample_number) {
+    MFLAC_RESULT res;
+    miniflac_seekpoint_t point;
+    int32_t* samples[8];
+    uint32_t i;
+    uint32_t j;
+    int r = 1;
+
+    for(i = 0; i < 8; i++) {
+        samples[i] = NULL;
+    }
+
+    if(sample_number >= index[frames - 1].sample_number + index[frames - 1].block_size) {
+        fprintf(stderr,"sample %lu is past the end of the stream\n",(unsigned long)sample_number);
+        goto seek_with_index_cleanup;
+    }
+
+    for(i = 0; i < 8; i++) {
+        samples[i] = (int32_t*)malloc(sizeof(int32_t) * 65536);
+        if(samples[i] == NULL) {
+            fprintf(stderr,"out of memory\n");
+            goto seek_with_index_cleanup;
+        }
+    }
+
+    /* index offsets count from the start of the file, seekpoints from
+     * the first frame, so read up to it to find out where it is */
+    while(!m->flac.frame_offset_set) {
+        res = mflac_sync(m);
+        if(res != MFLAC_OK) {
+            fprintf(stderr,"error reading metadata: %d\n",res);
+            goto seek_with_index_cleanup;
+        }
+    }
+
+    /* offsets are in order, so checking the first covers them all */
+    if(index[0].offset < m->flac.frame_offset) {
+        fprintf(stderr,"index doesn't match the stream, frame 0 is before the first frame\n");
+        goto seek_with_index_cleanup;
+    }
+
+    i = miniflac_frameinfo_find(index,frames,sample_number);
+    point.sample_number = index[i].sample_number;
+    point.sample_offset = index[i].offset - m->flac.frame_offset;
+    point.samples = index[i].block_size;
+
+    fprintf(stdout,"frame: %u\n",i);
+    fprintf(stdout,"offset: %lu\n",(unsigned long)index[i].offset);
+    fprintf(stdout,"first sample: %lu\n",(unsigned long)index[i].sample_number);
+
+    res = mflac_seek(m,&point,1,sample_number);
+    if(res == MFLAC_OK) res = mflac_decode(m,samples);
+    if(res != MFLAC_OK) {
+        fprintf(stderr,"error seeking to sample %lu: %d\n",(unsigned long)sample_number,res);
+        goto seek_with_index_cleanup;
+    }
+
+    /* the decoded frame starts at the sample asked for */
+    fprintf(stdout,"decoded: %u samples from sample %lu\n",m->flac.frame.header.block_size,(unsigned long)sample_number);
+    for(j = 0; j < m->flac.frame.header.channels; j++) {
+        fprintf(stdout,"channel %u: %d\n",j,samples[j][0]);
+    }
+    r = 0;
+
+    seek_with_index_cleanup:
+    for(i = 0; i < 8; i++) {
+        if(samples[i] != NULL) free(samples[i]);
+    }
+    return r;
+}
+
+int main(int argc, const char* argv[]) {
+    int r = 1;
+    FILE* input = NULL;
+    FILE* output = NULL;
+    mflac_t* m = NULL;
+    MFLAC_RESULT res;
+    miniflac_frameinfo_t info;
+    miniflac_frameinfo_t* index = NULL;
+    uint32_t frames = 0;
+    uint64_t samples = 0;
+    uint8_t count[4];
+
+    if(argc < 3) {
+        fprintf(stderr,"Usage: %s /path/to/flac /path/to/index [sample]\n",argv[0]);
+        goto cleanup;
+    }
+
+    input = fopen(argv[1],"rb");
+    if(input == NULL) {
+        fprintf(stderr,"error opening %s: %s\n",argv[1],strerror(errno));
+        goto cleanup;
+    }
+
+    if(argc > 3) {
+        index = read_index(argv[2],&frames);
+        if(index == NULL) goto cleanup;
+
+        m = malloc(mflac_size());
+        if(m == NULL) {
+            fprintf(stderr,"out of memory\n");
+            goto cleanup;
+        }
+        mflac_init(m,MINIFLAC_CONTAINER_NATIVE,readcb,input);
+        mflac_set_seek(m,seekcb);
+
+        r = seek_with_index(m,index,frames,strtoull(argv[3],NULL,10));
+        goto cleanup;
+    }
+
+    output = fopen(argv[2],"wb");
+    if(output == NULL) {
+        fprintf(stderr,"error opening %s: %s\n",argv[2],strerror(errno));
+        goto cleanup;
+    }
+
+    m = malloc(mflac_size());
+    if(m == NULL) {
+        fprintf(stderr,"out of memory\n");
+        goto cleanup;
+    }
+    mflac_init(m,MINIFLAC_CONTAINER_NATIVE,readcb,input);
+
+    /* the frame count is filled in at the end */
+    if(fwrite("MFLACIDX\0\0\0\0",1,12,output) != 12) goto write_error;
+
+    while( (res = mflac_frameinfo(m,&info)) == MFLAC_OK) {
+        if(!write_entry(output,&info)) goto write_error;
+        samples = info.sample_number + info.block_size;
+        frames++;
+    }
+
+    if(res != MFLAC_EOF) {
+        fprintf(stderr,"error scanning frames: %d\n",res);
+        goto cleanup;
+    }
+
+    pack_le(count,frames,4);
+    if(fseek(output,8,SEEK_SET) != 0) goto write_error;
+    if(fwrite(count,1,4,output) != 4) goto write_error;
+
+    fprintf(stdout,"frames: %u\n",frames);
+    fprintf(stdout,"samples: %lu\n",(unsigned long)samples);
+    r = 0;
+    goto cleanup;
+
+    write_error:
+    fprintf(stderr,"error writing %s: %s\n",argv[2],strerror(errno));
+
+    cleanup:
+    if(index != NULL) free(index);
+    if(m != NULL) free(m);
+    if(input != NULL) fclose(input);
+    if(output != NULL) fclose(output);
+    return r;
+}
@@ -0,0 +1,252 @@
+/* SPDX-License-Identifier: 0BSD */
+#define MINIFLAC_IMPLEMENTATION
+#include "../miniflac.h"
+#include "wav.h"
+#include "slurp.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <stdint.h>
+#include <pthread.h>
+
+/* example program that decodes a native FLAC file into a .wav file
+ * using several threads.
+ *
+ * The whole file is read into memory and scanned once with
+ * miniflac_frameinfo, which only parses frame headers. The frames are
+ * then handed out to worker threads in batches. Each worker has its own
+ * copy of the decoder, reset to MINIFLAC_FRAME, and decodes straight
+ * into one shared output buffer at the offset given by each frame's
+ * first sample. */
+
+#define FRAMES_PER_BATCH 32
+#define MAX_THREADS 256
+
+struct decode_job_s {
+    const uint8_t* data;
+    uint32_t length;
+    const miniflac_frameinfo_t* index;
+    uint32_t frames;
+    const miniflac_t* decoder; /* parsed up to the first frame */
+    MINIFLAC_SAMPLE_FORMAT format;
+    uint8_t sample_size;
+    uint8_t channels;
+    uint8_t* samples;
+
+    pthread_mutex_t lock;
+    uint32_t next; /* first frame of the next batch to hand out */
+    int error;
+};
+
+typedef struct decode_job_s decode_job_t;
+
+/* claims the next batch of frames, returns 0 when there are none left */
+static int
+next_batch(decode_job_t* job, uint32_t* first, uint32_t* last) {
+    int r = 0;
+    pthread_mutex_lock(&job->lock);
+    if(job->next < job->frames && !job->error) {
+        *first = job->next;
+        job->next += FRAMES_PER_BATCH;
+        if(job->next > job->frames) job->next = job->frames;
+        *last = job->next;
+        r = 1;
+    }
+    pthread_mutex_unlock(&job->lock);
+    return r;
+}
+
+static void
+fail(decode_job_t* job) {
+    pthread_mutex_lock(&job->lock);
+    job->error = 1;
+    pthread_mutex_unlock(&job->lock);
+}
+
+static void*
+worker(void* userdata) {
+    decode_job_t* job = (decode_job_t*)userdata;
+    miniflac_t* decoder = NULL;
+    int32_t* scratch = NULL;
+    uint32_t first, last, i;
+    uint32_t pos, end, used;
+    MINIFLAC_RESULT res;
+
+    decoder = (miniflac_t*)malloc(miniflac_size());
+    scratch = (int32_t*)malloc(sizeof(int32_t) * 2 * 65536);
+    if(decoder == NULL || scratch == NULL) {
+        fprintf(stderr,"Failed to allocate worker\n");
+        fail(job);
+        goto cleanup;
+    }
+
+    /* copying the decoder that read the metadata keeps the stream info */
+    memcpy(decoder,job->decoder,miniflac_size());
+
+    while(next_batch(job,&first,&last)) {
+        miniflac_reset(decoder,MINIFLAC_FRAME);
+
+        pos = (uint32_t)job->index[first].offset;
+        end = last < job->frames ? (uint32_t)job->index[last].offset : job->length;
+
+        for(i = first; i < last; i++) {
+            res = miniflac_decode_interleaved(decoder,&job->data[pos],end - pos,&used,job->format,
+              &job->samples[job->index[i].sample_number * job->channels * job->sample_size],scratch);
+            pos += used;
+            if(res != MINIFLAC_OK || decoder->frame.header.channels != job->channels ||
+               decoder->frame.header.block_size != job->index[i].block_size) {
+                fprintf(stderr,"Failed to decode frame %u: %d\n",i,res);
+                fail(job);
+                goto cleanup;
+            }
+        }
+    }
+
+    cleanup:
+    if(scratch != NULL) free(scratch);
+    if(decoder != NULL) free(decoder);
+    return NULL;
+}
+
+int main(int argc, const char* argv[]) {
+    int r = 1;
+    uint8_t* data = NULL;
+    uint32_t length = 0;
+    uint32_t pos = 0;
+    uint32_t used = 0;
+    uint32_t i = 0;
+    uint32_t capacity = 0;
+    uint32_t threads = 4;
+    uint32_t started = 0;
+    uint64_t total = 0;
+    uint8_t bps = 0;
+    FILE* output = NULL;
+    miniflac_t* decoder = NULL;
+    miniflac_frameinfo_t* index = NULL;
+    miniflac_frameinfo_t* tmp = NULL;
+    miniflac_frameinfo_t info;
+    pthread_t tids[MAX_THREADS];
+    decode_job_t job;
+    MINIFLAC_RESULT res;
+
+    memset(&job,0,sizeof(job));
+    pthread_mutex_init(&job.lock,NULL);
+
+    if(argc < 3) {
+        fprintf(stderr,"Usage: %s /path/to/flac /path/to/wav [threads]\n",argv[0]);
+        goto cleanup;
+    }
+
+    if(argc > 3) {
+        threads = (uint32_t)strtoul(argv[3],NULL,10);
+        if(threads == 0 || threads > MAX_THREADS) {
+            fprintf(stderr,"threads must be between 1 and %u\n",MAX_THREADS);
+            goto cleanup;
+        }
+    }
+
+    data = slurp(argv[1],&length);
+    if(data == NULL) goto cleanup;
+
+    decoder = (miniflac_t*)malloc(miniflac_size());
+    if(decoder == NULL) {
+        fprintf(stderr,"Failed to allocate decoder\n");
+        goto cleanup;
+    }
+    miniflac_init(decoder,MINIFLAC_CONTAINER_NATIVE);
+
+    /* the frame scan, only the headers are parsed. Every frame gets a
+     * slot in the output sized by the STREAMINFO channel count, so a
+     * frame with any other count is refused here, before anything gets
+     * decoded into the wrong size of slot */
+    while( (res = miniflac_frameinfo(decoder,&data[pos],length - pos,&used,&info)) == MINIFLAC_OK) {
+        pos += used;
+        if(decoder->frame.header.channels != decoder->metadata.streaminfo.channels) {
+            fprintf(stderr,"Frame %u has %u channels, the stream has %u\n",job.frames,
+              decoder->frame.header.channels,decoder->metadata.streaminfo.channels);
+            goto cleanup;
+        }
+        if(job.frames == capacity) {
+            capacity = capacity == 0 ? 1024 : capacity * 2;
+            tmp = (miniflac_frameinfo_t*)realloc(index,sizeof(miniflac_frameinfo_t) * capacity);
+            if(tmp == NULL) {
+                fprintf(stderr,"Failed to allocate frame index\n");
+                goto cleanup;
+            }
+            index = tmp;
+        }
+        index[job.frames++] = info;
+        if(info.sample_number + info.block_size > total) total = info.sample_number + info.block_size;
+    }
+
+    if(res != MINIFLAC_CONTINUE || job.frames == 0) {
+        fprintf(stderr,"Failed to scan frames: %d\n",res);
+        goto cleanup;
+    }
+
+    job.channels = decoder->metadata.streaminfo.channels;
+    bps = decoder->metadata.streaminfo.bps;
+    if(bps <= 16) {
+        job.format = MINIFLAC_SAMPLE_INT16;
+        bps = 16;
+    } else if(bps <= 24) {
+        job.format = MINIFLAC_SAMPLE_INT24;
+        bps = 24;
+    } else {
+        job.format = MINIFLAC_SAMPLE_INT32;
+        bps = 32;
+    }
+    job.sample_size = bps / 8;
+
+    job.samples = (uint8_t*)malloc(total * job.channels * job.sample_size);
+    if(job.samples == NULL) {
+        fprintf(stderr,"Failed to allocate pcm buffer\n");
+        goto cleanup;
+    }
+
+    job.data = data;
+    job.length = length;
+    job.index = index;
+    job.decoder = decoder;
+
+    for(started = 0; started < threads; started++) {
+        if(pthread_create(&tids[started],NULL,worker,&job) != 0) {
+            fprintf(stderr,"Failed to start thread\n");
+            fail(&job);
+            break;
+        }
+    }
+
+    for(i = 0; i < started; i++) {
+        pthread_join(tids[i],NULL);
+    }
+
+    if(job.error) goto cleanup;
+
+    output = fopen(argv[2],"wb");
+    if(output == NULL) {
+        fprintf(stderr,"Failed to open %s: %s\n",argv[2],strerror(errno));
+        goto cleanup;
+    }
+
+    wav_header_create(output,decoder->metadata.streaminfo.sample_rate,job.channels,bps);
+    if(fwrite(job.samples,job.channels * job.sample_size,total,output) != total) {
+        fprintf(stderr,"Failed to write %s: %s\n",argv[2],strerror(errno));
+        goto cleanup;
+    }
+    wav_header_finish(output,bps);
+
+    fprintf(stderr,"decoded %u frames with %u threads\n",job.frames,started);
+    r = 0;
+
+    cleanup:
+    if(output != NULL) fclose(output);
+    if(job.samples != NULL) free(job.samples);
+    if(index != NULL) free(index);
+    if(decoder != NULL) free(decoder);
+    if(data != NULL) free(data);
+    pthread_mutex_destroy(&job.lock);
+    return r;
+}
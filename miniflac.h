@@ -106,14 +106,17 @@ frame, or call miniflac_decode to continue on.
 
 #define MINIFLAC_APPLICATION_H
 #define MINIFLAC_COMMON_H
+#define MINIFLAC_CPU_H
 #define MINIFLAC_BITREADER_H
 #define MINIFLAC_CUESHEET_H
 #define MINIFLAC_FRAME_H
 #define MINIFLAC_FRAMEHEADER_H
+#define MINIFLAC_MD5_H
 #define MINIFLAC_METADATA_H
 #define MINIFLAC_METADATA_HEADER_H
 #define MINIFLAC_OGG_H
 #define MINIFLAC_OGGHEADER_H
+#define MINIFLAC_OUTPUT_H
 #define MINIFLAC_PADDING_H
 #define MINIFLAC_PICTURE_H
 #define MINIFLAC_RESIDUAL_H
@@ -135,6 +138,9 @@ frame, or call miniflac_decode to continue on.
 #endif
 
 enum MINIFLAC_RESULT {
+    MINIFLAC_OGG_CRC32_INVALID                 = -21, /* an Ogg page didn't match its crc32 */
+    MINIFLAC_MD5_UNAVAILABLE                   = -20, /* the STREAMINFO block had no MD5 to verify against */
+    MINIFLAC_MD5_MISMATCH                      = -19, /* the decoded audio doesn't match the STREAMINFO MD5 */
     MINIFLAC_OGG_HEADER_NOTFLAC                = -18, /* attempted to read an Ogg header packet that isn't a FLAC-in-Ogg packet */
     MINIFLAC_SUBFRAME_RESERVED_TYPE            = -17, /* subframe header specified a reserved type */
     MINIFLAC_SUBFRAME_RESERVED_BIT             = -16, /* subframe header found a non-zero value in the reserved bit */
@@ -158,6 +164,14 @@ enum MINIFLAC_RESULT {
     MINIFLAC_METADATA_END                      =   2, /* used to signify end-of-data in a metadata block */
 };
 
+enum MINIFLAC_CPU_FEATURE {
+    MINIFLAC_CPU_SSE41 = 0x01,
+    MINIFLAC_CPU_AVX2  = 0x02,
+    MINIFLAC_CPU_NEON  = 0x04,
+    MINIFLAC_CPU_SSE2  = 0x08,
+    MINIFLAC_CPU_PCLMUL = 0x10, /* PCLMULQDQ and SSSE3 */
+};
+
 enum MINIFLAC_OGGHEADER_STATE {
     MINIFLAC_OGGHEADER_PACKETTYPE,
     MINIFLAC_OGGHEADER_F,
@@ -358,10 +372,18 @@ enum MINIFLAC_FRAME_HEADER_STATE {
     MINIFLAC_FRAME_HEADER_CRC8,
 };
 
+enum MINIFLAC_SAMPLE_FORMAT {
+    MINIFLAC_SAMPLE_INT16,   /* int16_t */
+    MINIFLAC_SAMPLE_INT24,   /* 3 bytes per sample, little-endian */
+    MINIFLAC_SAMPLE_INT32,   /* int32_t */
+    MINIFLAC_SAMPLE_FLOAT32, /* float */
+};
+
 enum MINIFLAC_FRAME_STATE {
     MINIFLAC_FRAME_HEADER,
     MINIFLAC_FRAME_SUBFRAME,
     MINIFLAC_FRAME_FOOTER,
+    MINIFLAC_FRAME_SKIP,
 };
 
 enum MINIFLAC_STATE {
@@ -387,7 +409,19 @@ enum MFLAC_RESULT {
 };
 
 
+typedef void (*miniflac_residual_restore)(void* userdata, int32_t* output, uint32_t start, uint32_t end);
+typedef void (*miniflac_subframe_lpc_predictor)(const int32_t* coefficients, uint8_t shift, uint8_t predictor_order, int32_t* output, uint32_t start, uint32_t end);
 typedef size_t (*mflac_readcb)(uint8_t* buffer, size_t bytes, void* userdata);
+typedef int (*mflac_seekcb)(uint64_t offset, void* userdata);
+
+struct miniflac_md5_s {
+    uint32_t state[4];
+    uint32_t block[16];
+    uint64_t length; /* bytes hashed so far */
+    uint64_t acc;
+    uint8_t acc_bits;
+    uint8_t words; /* whole words in block */
+};
 
 struct miniflac_bitreader_s {
     uint64_t val;
@@ -397,7 +431,10 @@ struct miniflac_bitreader_s {
     uint32_t pos;
     uint32_t len;
     const uint8_t* buffer;
-    uint32_t tot; /* total bytes read since last reset */
+    uint32_t tot; /* total bytes consumed since last reset */
+    uint32_t crcpos; /* position in buffer of the next byte to add to the crc */
+    uint64_t crcval; /* bytes from a previous buffer that still need to be added to the crc */
+    uint8_t  crclen; /* number of bytes in crcval */
 };
 
 struct miniflac_oggheader_s {
@@ -416,6 +453,19 @@ struct miniflac_ogg_s {
     uint8_t curseg; /* current position within the segment table */
     uint16_t length; /* length of data within page */
     uint16_t pos; /* where we are within page */
+    uint8_t lacing[255]; /* the page's segment table */
+    uint32_t checksum; /* crc32 stored in the page header */
+    uint32_t crc32; /* crc32 of the page so far */
+    uint8_t verified; /* the page was checked in one go, or is being skipped */
+};
+
+struct miniflac_ogg_pageinfo_s {
+    uint32_t size; /* the whole page, header and data */
+    int32_t serialno;
+    int64_t granulepos;
+    uint32_t pageno;
+    uint8_t headertype;
+    uint8_t flac; /* the page starts a FLAC stream */
 };
 
 struct miniflac_streammarker_s {
@@ -433,8 +483,12 @@ struct miniflac_metadata_header_s {
 struct miniflac_streaminfo_s {
     enum MINIFLAC_STREAMINFO_STATE state;
     uint8_t                     pos;
+    uint16_t         max_block_size;
+    uint32_t         max_frame_size;
     uint32_t            sample_rate;
+    uint8_t                channels;
     uint8_t                     bps;
+    uint8_t                  md5[16]; /* kept for miniflac_verify_check */
 };
 
 struct miniflac_vorbis_comment_s {
@@ -460,6 +514,12 @@ struct miniflac_cuesheet_s {
     uint8_t points;
 };
 
+struct miniflac_seekpoint_s {
+    uint64_t sample_number;
+    uint64_t sample_offset;
+    uint16_t samples;
+};
+
 struct miniflac_seektable_s {
     enum MINIFLAC_SEEKTABLE_STATE    state;
     uint32_t len; /* number of seekpoints */
@@ -519,6 +579,7 @@ struct miniflac_subframe_lpc_s {
     uint8_t shift;
     uint8_t coeff;
     int32_t coefficients[32];
+    miniflac_subframe_lpc_predictor predictor; /* restoration loop picked by miniflac_subframe_lpc_select */
 };
 
 struct miniflac_subframe_constant_s {
@@ -568,6 +629,13 @@ struct miniflac_frame_header_s {
     size_t size; /* size of the frame header, in bytes, only valid after sync */
 };
 
+struct miniflac_output_s {
+    enum MINIFLAC_SAMPLE_FORMAT format;
+    void* samples;
+    void** planes;
+    int32_t* scratch;
+};
+
 struct miniflac_frame_s {
     enum MINIFLAC_FRAME_STATE state;
     uint8_t cur_subframe;
@@ -575,6 +643,17 @@ struct miniflac_frame_s {
     size_t size; /* size of the frame, in bytes, only valid after decode */
     struct miniflac_frame_header_s header;
     struct miniflac_subframe_s subframe;
+    uint8_t skip[16]; /* possible frame header found while skipping */
+    uint8_t skip_len;
+    uint16_t skip_crc16; /* crc16 of the skipped frame up to skip[0] */
+    uint64_t skip_after; /* number due two headers on, 0 until the next one turns up */
+};
+
+struct miniflac_frameinfo_s {
+    uint64_t offset; /* byte offset of the frame header in the stream */
+    uint64_t sample_number; /* first sample of the frame */
+    uint16_t block_size;
+    uint8_t header_size;
 };
 
 struct miniflac_s {
@@ -588,6 +667,13 @@ struct miniflac_s {
     struct miniflac_frame_s frame;
     int32_t oggserial;
     uint8_t oggserial_set;
+    uint64_t frame_offset; /* byte offset of the first audio frame, or in Ogg of the page it starts on */
+    uint8_t frame_offset_set;
+    uint64_t oggpage_offset; /* byte offset of the Ogg page being read */
+    uint64_t oggpage_last; /* and of the page of the stream before it */
+    uint8_t oggresync; /* after a seek, 1 while looking for a packet with a frame, 2 while skipping one */
+    uint64_t seek_target; /* sample the next decoded frame should start at */
+    uint8_t seek_pending;
     uint64_t bytes_read_flac; /* total bytes of flac data read */
     uint64_t bytes_read_ogg; /* total bytes of ogg data read */
 };
@@ -595,6 +681,7 @@ struct miniflac_s {
 struct mflac_s {
     struct miniflac_s flac;
     mflac_readcb read;
+    mflac_seekcb seek;
     void* userdata;
     size_t bufpos;
     size_t buflen;
@@ -605,15 +692,18 @@ struct mflac_s {
 };
 
 
+typedef struct miniflac_md5_s miniflac_md5_t;
 typedef struct miniflac_bitreader_s miniflac_bitreader_t;
 typedef struct miniflac_oggheader_s miniflac_oggheader_t;
 typedef struct miniflac_ogg_s miniflac_ogg_t;
+typedef struct miniflac_ogg_pageinfo_s miniflac_ogg_pageinfo_t;
 typedef struct miniflac_streammarker_s miniflac_streammarker_t;
 typedef struct miniflac_metadata_header_s miniflac_metadata_header_t;
 typedef struct miniflac_streaminfo_s miniflac_streaminfo_t;
 typedef struct miniflac_vorbis_comment_s miniflac_vorbis_comment_t;
 typedef struct miniflac_picture_s miniflac_picture_t;
 typedef struct miniflac_cuesheet_s miniflac_cuesheet_t;
+typedef struct miniflac_seekpoint_s miniflac_seekpoint_t;
 typedef struct miniflac_seektable_s miniflac_seektable_t;
 typedef struct miniflac_application_s miniflac_application_t;
 typedef struct miniflac_padding_s miniflac_padding_t;
@@ -626,11 +716,14 @@ typedef struct miniflac_subframe_verbatim_s miniflac_subframe_verbatim_t;
 typedef struct miniflac_subframe_header_s miniflac_subframe_header_t;
 typedef struct miniflac_subframe_s miniflac_subframe_t;
 typedef struct miniflac_frame_header_s miniflac_frame_header_t;
+typedef struct miniflac_output_s miniflac_output_t;
 typedef struct miniflac_frame_s miniflac_frame_t;
+typedef struct miniflac_frameinfo_s miniflac_frameinfo_t;
 typedef struct miniflac_s miniflac_t;
 typedef struct mflac_s mflac_t;
 
 typedef enum MINIFLAC_RESULT MINIFLAC_RESULT;
+typedef enum MINIFLAC_CPU_FEATURE MINIFLAC_CPU_FEATURE;
 typedef enum MINIFLAC_OGGHEADER_STATE MINIFLAC_OGGHEADER_STATE;
 typedef enum MINIFLAC_OGG_STATE MINIFLAC_OGG_STATE;
 typedef enum MINIFLAC_STREAMMARKER_STATE MINIFLAC_STREAMMARKER_STATE;
@@ -653,6 +746,7 @@ typedef enum MINIFLAC_SUBFRAME_HEADER_STATE MINIFLAC_SUBFRAME_HEADER_STATE;
 typedef enum MINIFLAC_SUBFRAME_STATE MINIFLAC_SUBFRAME_STATE;
 typedef enum MINIFLAC_CHASSGN MINIFLAC_CHASSGN;
 typedef enum MINIFLAC_FRAME_HEADER_STATE MINIFLAC_FRAME_HEADER_STATE;
+typedef enum MINIFLAC_SAMPLE_FORMAT MINIFLAC_SAMPLE_FORMAT;
 typedef enum MINIFLAC_FRAME_STATE MINIFLAC_FRAME_STATE;
 typedef enum MINIFLAC_STATE MINIFLAC_STATE;
 typedef enum MINIFLAC_CONTAINER MINIFLAC_CONTAINER;
@@ -693,6 +787,23 @@ MINIFLAC_API
 MINIFLAC_RESULT
 miniflac_decode(miniflac_t* pFlac, const uint8_t* data, uint32_t length, uint32_t* out_length, int32_t** samples);
 
+/* decode a frame of audio straight into a single interleaved buffer of
+ * the given format, with room for block size * channels samples.
+ * scratch needs room for 2 * block size int32_t samples, 2 * the STREAMINFO
+ * max block size (or 2 * 65535 when that's unknown) is always enough. */
+MINIFLAC_API
+MINIFLAC_RESULT
+miniflac_decode_interleaved(miniflac_t* pFlac, const uint8_t* data, uint32_t length, uint32_t* out_length, MINIFLAC_SAMPLE_FORMAT format, void* samples, int32_t* scratch);
+
+/* same as miniflac_decode_interleaved, but with one buffer per channel.
+ * With MINIFLAC_SAMPLE_FLOAT32 the scaling is done in the same pass as
+ * the stereo decorrelation. With MINIFLAC_SAMPLE_INT16 and a stream of
+ * at most 16 bits per sample, scratch only needs room for block size
+ * int32_t samples. */
+MINIFLAC_API
+MINIFLAC_RESULT
+miniflac_decode_planar(miniflac_t* pFlac, const uint8_t* data, uint32_t length, uint32_t* out_length, MINIFLAC_SAMPLE_FORMAT format, void** samples, int32_t* scratch);
+
 /* functions to query the state without inspecting structs,
  * only valid to call after miniflac_sync returns MINIFLAC_OK */
 MINIFLAC_API
@@ -1019,6 +1130,101 @@ MINIFLAC_API
 MINIFLAC_RESULT
 miniflac_seektable_samples(miniflac_t* pFlac, const uint8_t* data, uint32_t length, uint32_t* out_length, uint16_t* samples);
 
+/* read the seekpoints into a table, up to points_length of them.
+ * outlen is set to the number of seekpoints stored, including any
+ * placeholder points at the end of the table */
+MINIFLAC_API
+MINIFLAC_RESULT
+miniflac_seektable_points(miniflac_t* pFlac, const uint8_t* data, uint32_t length, uint32_t* out_length, miniflac_seekpoint_t* points, uint32_t points_length, uint32_t* outlen);
+
+/* prepare to seek a FLAC stream to a sample. Picks the nearest
+ * seekpoint at or before sample_number from points (which may be NULL),
+ * resets the decoder and sets offset to the byte position in the stream
+ * to continue reading from. The following decode skips frames until it
+ * reaches the target, and the frame it returns is cut down to start at
+ * exactly sample_number (frame.header.block_size is reduced to match).
+ * Decoding has to have reached the first audio frame before calling
+ * this.
+ *
+ * In an Ogg stream a seekpoint's sample_offset has to be the position of
+ * a page (found with miniflac_ogg_probe) minus frame_offset, and its
+ * sample_number the page's granule position - the offsets in a
+ * SEEKTABLE block can't be used. */
+MINIFLAC_API
+MINIFLAC_RESULT
+miniflac_seek(miniflac_t* pFlac, const miniflac_seekpoint_t* points, uint32_t points_length, uint64_t sample_number, uint64_t* offset);
+
+/* sync to the next audio frame (skipping the current one and any
+ * metadata) and describe it, for building a frame index with one
+ * entry per frame. Only the frame headers are parsed. Native FLAC
+ * streams only, offsets count from the start of the stream. */
+MINIFLAC_API
+MINIFLAC_RESULT
+miniflac_frameinfo(miniflac_t* pFlac, const uint8_t* data, uint32_t length, uint32_t* out_length, miniflac_frameinfo_t* info);
+
+/* find the entry of a frame index (built with miniflac_frameinfo) for
+ * the frame holding sample_number. Pass it to miniflac_seek as a
+ * seekpoint with sample_offset set to its offset minus frame_offset. */
+MINIFLAC_API
+uint32_t
+miniflac_frameinfo_find(const miniflac_frameinfo_t* index, uint32_t length, uint64_t sample_number);
+
+/* look for a frame header in data read from anywhere in a native FLAC
+ * stream, for seeking by bisection when there's no seektable. Headers
+ * need a valid crc8 and have to agree with the STREAMINFO block. On
+ * MINIFLAC_OK out_length is the position of the header in data, and
+ * sample_number and block_size describe its frame. Returns
+ * MINIFLAC_CONTINUE if there's no header, out_length is then the number
+ * of bytes that can be skipped - the rest may be the start of a header.
+ * The decoder's state isn't changed, pass what's found to miniflac_seek
+ * as a seekpoint. */
+MINIFLAC_API
+MINIFLAC_RESULT
+miniflac_seek_probe(miniflac_t* pFlac, const uint8_t* data, uint32_t length, uint32_t* out_length, uint64_t* sample_number, uint16_t* block_size);
+
+/* look for a page of the Ogg FLAC stream being decoded in data read from
+ * anywhere in the file, for seeking by bisection. Pages of other streams,
+ * and pages no frame ends on, are skipped. On MINIFLAC_OK out_length is
+ * the position of the page and granulepos is its granule position (the
+ * number of samples up to the end of the last frame that ends on it), or
+ * -1 if the page starts another stream - the next link of a chained
+ * file, so the stream being decoded has ended before it. Returns
+ * MINIFLAC_CONTINUE if there's no page, out_length is then the number of
+ * bytes that can be skipped. The decoder's state isn't changed. */
+MINIFLAC_API
+MINIFLAC_RESULT
+miniflac_ogg_probe(miniflac_t* pFlac, const uint8_t* data, uint32_t length, uint32_t* out_length, int64_t* granulepos);
+
+/* read the header of the Ogg page at the start of data, to split a
+ * multiplexed file into its logical streams. Each stream's pages can be
+ * fed to a decoder of its own, which picks the stream up from its first
+ * page (info->flac is set on the first page of a FLAC stream). Returns
+ * MINIFLAC_CONTINUE until the whole page is in data, and MINIFLAC_ERROR
+ * if data doesn't start with a page. The page's crc isn't checked here,
+ * the decoder it goes to checks it only when built with
+ * MINIFLAC_OGG_CRC32. */
+MINIFLAC_API
+MINIFLAC_RESULT
+miniflac_ogg_pageinfo(const uint8_t* data, uint32_t length, miniflac_ogg_pageinfo_t* info);
+
+/* start verifying decoded audio against the STREAMINFO MD5, before
+ * decoding the first frame */
+MINIFLAC_API
+void
+miniflac_verify_init(miniflac_md5_t* md5);
+
+/* hash the frame just decoded into samples with miniflac_decode */
+MINIFLAC_API
+void
+miniflac_verify_frame(miniflac_md5_t* md5, miniflac_t* pFlac, int32_t** samples);
+
+/* at the end of the stream, returns MINIFLAC_OK if everything hashed
+ * matches the STREAMINFO MD5, MINIFLAC_MD5_MISMATCH if it doesn't, or
+ * MINIFLAC_MD5_UNAVAILABLE if the encoder left the MD5 blank */
+MINIFLAC_API
+MINIFLAC_RESULT
+miniflac_verify_check(miniflac_md5_t* md5, miniflac_t* pFlac);
+
 /* read an application block's ID */
 MINIFLAC_API
 MINIFLAC_RESULT
@@ -1073,14 +1279,56 @@ MINIFLAC_API
 void
 mflac_reset(mflac_t* m, MINIFLAC_STATE state);
 
+/* sets the callback used by mflac_seek */
+MINIFLAC_API
+void
+mflac_set_seek(mflac_t* m, mflac_seekcb seek);
+
 MINIFLAC_API
 MFLAC_RESULT
 mflac_sync(mflac_t* m);
 
+/* seeks to a sample using miniflac_seek and the seek callback, the next
+ * mflac_decode starts at exactly sample_number. points may be NULL. */
+MINIFLAC_API
+MFLAC_RESULT
+mflac_seek(mflac_t* m, const miniflac_seekpoint_t* points, uint32_t points_length, uint64_t sample_number);
+
+/* seeks to a sample without a seektable, bisecting the stream with
+ * miniflac_seek_probe, or miniflac_ogg_probe and the granule positions
+ * of the pages in an Ogg file. length is the size of the stream in
+ * bytes. In a chained Ogg file the seek is within the current link. */
+MINIFLAC_API
+MFLAC_RESULT
+mflac_seek_bisect(mflac_t* m, uint64_t length, uint64_t sample_number);
+
 MINIFLAC_API
 MFLAC_RESULT
 mflac_decode(mflac_t* m, int32_t** samples);
 
+MINIFLAC_API
+MFLAC_RESULT
+mflac_frameinfo(mflac_t* m, miniflac_frameinfo_t* info);
+
+/* see miniflac_verify_frame and miniflac_verify_check */
+MINIFLAC_API
+void
+mflac_verify_frame(miniflac_md5_t* md5, mflac_t* m, int32_t** samples);
+
+MINIFLAC_API
+MFLAC_RESULT
+mflac_verify_check(miniflac_md5_t* md5, mflac_t* m);
+
+/* see miniflac_decode_interleaved */
+MINIFLAC_API
+MFLAC_RESULT
+mflac_decode_interleaved(mflac_t* m, MINIFLAC_SAMPLE_FORMAT format, void* samples, int32_t* scratch);
+
+/* see miniflac_decode_planar */
+MINIFLAC_API
+MFLAC_RESULT
+mflac_decode_planar(mflac_t* m, MINIFLAC_SAMPLE_FORMAT format, void** samples, int32_t* scratch);
+
 /* functions to query the state without inspecting structs,
  * only valid to call after mflac_sync returns MFLAC_OK */
 MINIFLAC_API
@@ -1274,6 +1522,10 @@ MINIFLAC_API
 MFLAC_RESULT
 mflac_seektable_samples(mflac_t* m, uint16_t* samples);
 
+MINIFLAC_API
+MFLAC_RESULT
+mflac_seektable_points(mflac_t* m, miniflac_seekpoint_t* points, uint32_t points_length, uint32_t* outlen);
+
 /*
  * MINIFLAC_METADATA_VORBIS_COMMENT (4)
  * ===================================
@@ -1458,21 +1710,64 @@ mflac_version_string(void);
 #define miniflac_abort()
 #endif
 
+#if !defined(MINIFLAC_NO_SIMD) && (defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 5))
+#if defined(__x86_64__) || defined(__i386__)
+#define MINIFLAC_SIMD_X86
+#define MINIFLAC_TARGET(x) __attribute__((__target__(x)))
+#include <cpuid.h>
+#include <immintrin.h>
+#elif defined(__aarch64__) || defined(__ARM_NEON)
+#define MINIFLAC_SIMD_NEON
+#include <arm_neon.h>
+#endif
+#endif
+
+/* probes the CPU, if that hasn't happened yet, and records which SIMD
+ * kernels can be used. Called from miniflac_init, it's safe to set up
+ * decoders on several threads at once. */
+MINIFLAC_PRIVATE
+void
+miniflac_cpu_init(void);
+
+/* returns a bitmask of MINIFLAC_CPU_FEATURE values, probing the CPU
+ * first if need be */
+MINIFLAC_PRIVATE
+uint32_t
+miniflac_cpu_features(void);
+
+MINIFLAC_PRIVATE
+void
+miniflac_md5_init(miniflac_md5_t* md5);
+
+/* hashes a block of samples as interleaved, little-endian integers of
+ * (bps + 7) / 8 bytes - the layout the STREAMINFO MD5 is taken over */
+MINIFLAC_PRIVATE
+void
+miniflac_md5_samples(miniflac_md5_t* md5, int32_t** samples, uint8_t channels, uint32_t block_size, uint8_t bps);
+
+MINIFLAC_PRIVATE
+void
+miniflac_md5_final(miniflac_md5_t* md5, uint8_t* digest);
+
 MINIFLAC_PRIVATE
 uint32_t
-miniflac_unpack_uint32le(uint8_t buffer[4]);
+miniflac_unpack_uint32le(const uint8_t buffer[4]);
 
 MINIFLAC_PRIVATE
 int32_t
-miniflac_unpack_int32le(uint8_t buffer[4]);
+miniflac_unpack_int32le(const uint8_t buffer[4]);
 
 MINIFLAC_PRIVATE
 uint64_t
-miniflac_unpack_uint64le(uint8_t buffer[8]);
+miniflac_unpack_uint64le(const uint8_t buffer[8]);
 
 MINIFLAC_PRIVATE
 int64_t
-miniflac_unpack_int64le(uint8_t buffer[8]);
+miniflac_unpack_int64le(const uint8_t buffer[8]);
+
+MINIFLAC_PRIVATE
+uint64_t
+miniflac_unpack_uint64be(const uint8_t buffer[8]);
 
 MINIFLAC_PRIVATE
 void
@@ -1502,6 +1797,10 @@ MINIFLAC_PRIVATE
 void
 miniflac_bitreader_discard(miniflac_bitreader_t* br, uint8_t bits);
 
+MINIFLAC_PRIVATE
+int
+miniflac_bitreader_read_unary(miniflac_bitreader_t* br, uint32_t* zeros);
+
 MINIFLAC_PRIVATE
 void
 miniflac_bitreader_align(miniflac_bitreader_t* br);
@@ -1510,6 +1809,28 @@ MINIFLAC_PRIVATE
 void
 miniflac_bitreader_reset_crc(miniflac_bitreader_t* br);
 
+MINIFLAC_PRIVATE
+void
+miniflac_bitreader_update_crc(miniflac_bitreader_t* br);
+
+MINIFLAC_PRIVATE
+void
+miniflac_bitreader_unfill(miniflac_bitreader_t* br);
+
+MINIFLAC_PRIVATE
+void
+miniflac_bitreader_detach(miniflac_bitreader_t* br);
+
+/* crc8 of a buffer, for checking frame headers without a bitreader */
+MINIFLAC_PRIVATE
+uint8_t
+miniflac_bitreader_crc8(const uint8_t* data, uint32_t length);
+
+/* continues a crc16 over a buffer */
+MINIFLAC_PRIVATE
+uint16_t
+miniflac_bitreader_crc16(uint16_t crc16, const uint8_t* data, uint32_t length);
+
 MINIFLAC_PRIVATE
 void
 miniflac_oggheader_init(miniflac_oggheader_t* oggheader);
@@ -1526,6 +1847,49 @@ MINIFLAC_PRIVATE
 MINIFLAC_RESULT
 miniflac_ogg_sync(miniflac_ogg_t* ogg, miniflac_bitreader_t* br);
 
+/* moves past used bytes of page data, once the end of the page is
+ * reached the page checksum is compared and the state goes back to
+ * looking for a capture pattern */
+MINIFLAC_PRIVATE
+MINIFLAC_RESULT
+miniflac_ogg_advance(miniflac_ogg_t* ogg, uint32_t used);
+
+/* the size of the page with its header at b, including the segment
+ * table - which has to be there */
+MINIFLAC_PRIVATE
+uint32_t
+miniflac_ogg_page_size(const uint8_t* b);
+
+/* checks the crc of a page that's about to be used, when built with
+ * MINIFLAC_OGG_CRC32 */
+MINIFLAC_PRIVATE
+MINIFLAC_RESULT
+miniflac_ogg_verify(miniflac_ogg_t* ogg);
+
+/* jumps straight over whole pages in the buffer that aren't from
+ * serialno, going by the capture pattern, serial number and lacing
+ * values alone - they're not parsed or checked. Stops at anything
+ * else, and leaves it to miniflac_ogg_sync */
+MINIFLAC_PRIVATE
+void
+miniflac_ogg_skip_foreign(miniflac_ogg_t* ogg, int32_t serialno);
+
+/* looks for a page header in data from anywhere in an Ogg stream. On
+ * MINIFLAC_OK pos is where it starts and the header fields are filled
+ * in. With MINIFLAC_OGG_CRC32, if the whole page is in data its crc has
+ * been checked too. On
+ * MINIFLAC_CONTINUE pos is how much of data can be skipped */
+MINIFLAC_PRIVATE
+MINIFLAC_RESULT
+miniflac_ogg_find(miniflac_ogg_t* ogg, const uint8_t* data, uint32_t length, uint32_t* pos);
+
+/* skips to the end of the packet at the current position, which may
+ * be the end of one carried over from the page before. Returns
+ * MINIFLAC_CONTINUE if more data is needed */
+MINIFLAC_PRIVATE
+MINIFLAC_RESULT
+miniflac_ogg_skip_packet(miniflac_ogg_t* ogg);
+
 MINIFLAC_PRIVATE
 void
 miniflac_streammarker_init(miniflac_streammarker_t* streammarker);
@@ -1739,6 +2103,12 @@ MINIFLAC_PRIVATE
 MINIFLAC_RESULT
 miniflac_seektable_read_samples(miniflac_seektable_t* seektable, miniflac_bitreader_t* br, uint16_t* samples);
 
+/* reads the seekpoints into points, up to length of them.
+ * outlen is set to the number of points stored */
+MINIFLAC_PRIVATE
+MINIFLAC_RESULT
+miniflac_seektable_read_points(miniflac_seektable_t* seektable, miniflac_bitreader_t* br, miniflac_seekpoint_t* points, uint32_t length, uint32_t* outlen);
+
 MINIFLAC_PRIVATE
 void
 miniflac_application_init(miniflac_application_t* application);
@@ -1787,6 +2157,17 @@ MINIFLAC_PRIVATE
 MINIFLAC_RESULT
 miniflac_residual_decode(miniflac_residual_t* residual, miniflac_bitreader_t* br, uint32_t* pos, uint32_t block_size, uint8_t predictor_order, int32_t *out);
 
+/* decodes all partitions in one go without saving any state, returns
+ * MINIFLAC_CONTINUE if it runs out of data and the caller will need to
+ * start over with miniflac_residual_decode.
+ *
+ * If restore is non-NULL it's called every few partitions with the range
+ * of samples that were just decoded, so the predictor can run over them
+ * while they're still in cache, rather than in a second pass at the end. */
+MINIFLAC_PRIVATE
+MINIFLAC_RESULT
+miniflac_residual_decode_fast(miniflac_bitreader_t* br, uint32_t block_size, uint8_t predictor_order, int32_t *out, miniflac_residual_restore restore, void* userdata);
+
 MINIFLAC_PRIVATE
 void
 miniflac_subframe_fixed_init(miniflac_subframe_fixed_t* c);
@@ -1795,6 +2176,15 @@ MINIFLAC_PRIVATE
 MINIFLAC_RESULT
 miniflac_subframe_fixed_decode(miniflac_subframe_fixed_t* c, miniflac_bitreader_t* br, int32_t* output, uint32_t block_size, uint8_t bps, miniflac_residual_t* residual, uint8_t predictor_order);
 
+MINIFLAC_PRIVATE
+MINIFLAC_RESULT
+miniflac_subframe_fixed_decode_fast(miniflac_bitreader_t* br, int32_t* output, uint32_t block_size, uint8_t bps, uint8_t predictor_order);
+
+/* restores samples start..end-1, which hold residuals, in-place */
+MINIFLAC_PRIVATE
+void
+miniflac_subframe_fixed_predict(int32_t* output, uint32_t start, uint32_t end, uint8_t predictor_order);
+
 MINIFLAC_PRIVATE
 void
 miniflac_subframe_lpc_init(miniflac_subframe_lpc_t* l);
@@ -1803,6 +2193,21 @@ MINIFLAC_PRIVATE
 MINIFLAC_RESULT
 miniflac_subframe_lpc_decode(miniflac_subframe_lpc_t* l, miniflac_bitreader_t* br, int32_t* output, uint32_t block_size, uint8_t bps, miniflac_residual_t* residual, uint8_t predictor_order);
 
+MINIFLAC_PRIVATE
+MINIFLAC_RESULT
+miniflac_subframe_lpc_decode_fast(miniflac_subframe_lpc_t* l, miniflac_bitreader_t* br, int32_t* output, uint32_t block_size, uint8_t bps, uint8_t predictor_order);
+
+/* picks the restoration loop for this subframe, needs the precision
+ * and coefficients to be read already */
+MINIFLAC_PRIVATE
+void
+miniflac_subframe_lpc_select(miniflac_subframe_lpc_t* l, uint8_t bps, uint8_t predictor_order);
+
+/* restores samples start..end-1, which hold residuals, in-place */
+MINIFLAC_PRIVATE
+void
+miniflac_subframe_lpc_predict(miniflac_subframe_lpc_t* l, int32_t* output, uint32_t start, uint32_t end);
+
 MINIFLAC_PRIVATE
 void miniflac_subframe_constant_init(miniflac_subframe_constant_t* c);
 
@@ -1818,6 +2223,10 @@ MINIFLAC_PRIVATE
 MINIFLAC_RESULT
 miniflac_subframe_verbatim_decode(miniflac_subframe_verbatim_t* c, miniflac_bitreader_t* br, int32_t* output, uint32_t block_size, uint8_t bps);
 
+MINIFLAC_PRIVATE
+MINIFLAC_RESULT
+miniflac_subframe_verbatim_decode_fast(miniflac_bitreader_t* br, int32_t* output, uint32_t block_size, uint8_t bps);
+
 MINIFLAC_PRIVATE
 void
 miniflac_subframe_header_init(miniflac_subframe_header_t* subframeheader);
@@ -1834,6 +2243,13 @@ MINIFLAC_PRIVATE
 MINIFLAC_RESULT
 miniflac_subframe_decode(miniflac_subframe_t* subframe, miniflac_bitreader_t* br, int32_t* output, uint32_t block_size, uint8_t bps);
 
+/* decodes a whole subframe without stopping, for when the buffer is
+ * known to hold the rest of the frame. On MINIFLAC_CONTINUE the
+ * bitreader and subframe are left in an undefined state. */
+MINIFLAC_PRIVATE
+MINIFLAC_RESULT
+miniflac_subframe_decode_fast(miniflac_subframe_t* subframe, miniflac_bitreader_t* br, int32_t* output, uint32_t block_size, uint8_t bps);
+
 MINIFLAC_PRIVATE
 void
 miniflac_frame_header_init(miniflac_frame_header_t* frame_header);
@@ -1841,6 +2257,34 @@ miniflac_frame_header_init(miniflac_frame_header_t* frame_header);
 MINIFLAC_PRIVATE
 MINIFLAC_RESULT miniflac_frame_header_decode(miniflac_frame_header_t* frame_header, miniflac_bitreader_t* br);
 
+/* checks if data starts with a frame header, for resyncing in the
+ * middle of a stream. Returns the header size if the reserved values
+ * and crc8 check out, 0 if it's not a header, -1 if length is too
+ * short to tell */
+MINIFLAC_PRIVATE
+int miniflac_frame_header_check(const uint8_t* data, uint32_t length);
+
+/* bytes per sample of a format */
+MINIFLAC_PRIVATE
+uint8_t miniflac_output_sample_size(MINIFLAC_SAMPLE_FORMAT format);
+
+/* packs one channel */
+MINIFLAC_PRIVATE
+void miniflac_output_channel(const miniflac_output_t* out, const int32_t* input, uint32_t block_size, uint8_t bps, uint8_t channel, uint8_t channels);
+
+/* true when a stereo pair can be packed with scratch for one channel */
+MINIFLAC_PRIVATE
+uint8_t miniflac_output_narrow(const miniflac_output_t* out, uint8_t bps);
+
+/* finishes a stereo pair in narrow mode, the first channel has already
+ * been stored by miniflac_output_channel and right is the second */
+MINIFLAC_PRIVATE
+void miniflac_output_stereo_narrow(const miniflac_output_t* out, MINIFLAC_CHASSGN assignment, const int32_t* right, uint32_t block_size, uint8_t bps);
+
+/* undoes the stereo decorrelation (if any) and packs both channels */
+MINIFLAC_PRIVATE
+void miniflac_output_stereo(const miniflac_output_t* out, MINIFLAC_CHASSGN assignment, const int32_t* left, const int32_t* right, uint32_t block_size, uint8_t bps);
+
 MINIFLAC_PRIVATE
 void miniflac_frame_init(miniflac_frame_t* frame);
 
@@ -1848,13 +2292,29 @@ void miniflac_frame_init(miniflac_frame_t* frame);
 MINIFLAC_PRIVATE
 MINIFLAC_RESULT miniflac_frame_sync(miniflac_frame_t* frame, miniflac_bitreader_t* br, miniflac_streaminfo_t* info);
 
+/* true if a frame header agrees with STREAMINFO, for weeding out
+ * false syncs */
+MINIFLAC_PRIVATE
+uint8_t miniflac_frame_header_fits(const miniflac_frame_header_t* header, const miniflac_streaminfo_t* info);
+
+/* skips the rest of the current frame without decoding it, by looking
+ * for the next frame header. Stops with that header read, like
+ * miniflac_frame_sync. */
 MINIFLAC_PRIVATE
-MINIFLAC_RESULT miniflac_frame_decode(miniflac_frame_t* frame, miniflac_bitreader_t* br, miniflac_streaminfo_t* info, int32_t** output);
+MINIFLAC_RESULT miniflac_frame_skip(miniflac_frame_t* frame, miniflac_bitreader_t* br, miniflac_streaminfo_t* info);
+
+/* decodes into either output (one int32_t buffer per channel) or packed,
+ * at most one should be non-NULL. With both NULL the frame is skipped. */
+MINIFLAC_PRIVATE
+MINIFLAC_RESULT miniflac_frame_decode(miniflac_frame_t* frame, miniflac_bitreader_t* br, miniflac_streaminfo_t* info, int32_t** output, const miniflac_output_t* packed);
 
 
 
 #define MFLAC_PASTE(a,b) a ## b
 
+/* a few of the largest possible Ogg pages */
+#define MFLAC_OGG_SCAN_LIMIT (4 * 65307)
+
 #define MFLAC_FUNC_BODY(a) \
     while( (res = a) == MINIFLAC_CONTINUE ) { \
         received = m->read(m->buffer, MFLAC_BUFFER_SIZE, m->userdata); \
@@ -1900,6 +2360,7 @@ void
 mflac_init(mflac_t* m, MINIFLAC_CONTAINER container, mflac_readcb read, void *userdata) {
     miniflac_init(&m->flac, container);
     m->read = read;
+    m->seek = NULL;
     m->userdata = userdata;
     m->bufpos = 0;
     m->buflen = 0;
@@ -1913,10 +2374,222 @@ mflac_reset(mflac_t* m, MINIFLAC_STATE state) {
     m->buflen = 0;
 }
 
+MINIFLAC_API
+void
+mflac_set_seek(mflac_t* m, mflac_seekcb seek) {
+    m->seek = seek;
+}
+
 MFLAC_GET0_FUNC(sync)
 
+/* seekpoints are relative to the first frame, so it has to have been found */
+static
+MFLAC_RESULT
+mflac_seek_prepare(mflac_t* m) {
+    MFLAC_RESULT res;
+
+    if(m->seek == NULL) return (MFLAC_RESULT)MINIFLAC_ERROR;
+
+    while(!m->flac.frame_offset_set) {
+        res = mflac_sync(m);
+        if(res != MFLAC_OK) return res;
+    }
+    return MFLAC_OK;
+}
+
+/* reads from offset until miniflac_seek_probe finds a frame header,
+ * returns MFLAC_EOF if there isn't one before limit */
+static
+MFLAC_RESULT
+mflac_seek_scan(mflac_t* m, uint64_t offset, uint64_t limit, uint64_t* header_offset, uint64_t* sample_number, uint16_t* block_size) {
+    MINIFLAC_RESULT r;
+    uint32_t used;
+    size_t received;
+    size_t i;
+
+    if(m->seek(offset,m->userdata) != 0) return (MFLAC_RESULT)MINIFLAC_ERROR;
+    m->bufpos = 0;
+    m->buflen = 0;
+
+    while(offset < limit) {
+        /* keep the bytes that may be the start of a header */
+        for(i = 0; i < m->buflen; i++) {
+            m->buffer[i] = m->buffer[m->bufpos + i];
+        }
+        m->bufpos = 0;
+
+        received = m->read(&m->buffer[m->buflen], MFLAC_BUFFER_SIZE - m->buflen, m->userdata);
+        if(received == 0) break;
+        m->buflen += received;
+
+        r = miniflac_seek_probe(&m->flac,m->buffer,(uint32_t)m->buflen,&used,sample_number,block_size);
+        if(r == MINIFLAC_OK) {
+            *header_offset = offset + used;
+            return *header_offset < limit ? MFLAC_OK : MFLAC_EOF;
+        }
+        if(r != MINIFLAC_CONTINUE) return (MFLAC_RESULT)r;
+
+        offset += used;
+        m->bufpos = used;
+        m->buflen -= used;
+    }
+    return MFLAC_EOF;
+}
+
+/* the Ogg version of mflac_seek_scan, reads from offset until
+ * miniflac_ogg_probe finds a page of the stream */
+static
+MFLAC_RESULT
+mflac_ogg_scan(mflac_t* m, uint64_t offset, uint64_t limit, uint64_t* page_offset, int64_t* granulepos) {
+    MINIFLAC_RESULT r;
+    uint32_t used;
+    size_t received;
+    size_t i;
+
+    if(m->seek(offset,m->userdata) != 0) return (MFLAC_RESULT)MINIFLAC_ERROR;
+    m->bufpos = 0;
+    m->buflen = 0;
+
+    while(offset < limit) {
+        for(i = 0; i < m->buflen; i++) {
+            m->buffer[i] = m->buffer[m->bufpos + i];
+        }
+        m->bufpos = 0;
+
+        received = m->read(&m->buffer[m->buflen], MFLAC_BUFFER_SIZE - m->buflen, m->userdata);
+        if(received == 0) break;
+        m->buflen += received;
+
+        r = miniflac_ogg_probe(&m->flac,m->buffer,(uint32_t)m->buflen,&used,granulepos);
+        if(r == MINIFLAC_OK) {
+            *page_offset = offset + used;
+            return *page_offset < limit ? MFLAC_OK : MFLAC_EOF;
+        }
+        if(r != MINIFLAC_CONTINUE) return (MFLAC_RESULT)r;
+
+        offset += used;
+        m->bufpos = used;
+        m->buflen -= used;
+    }
+    return MFLAC_EOF;
+}
+
+/* bisects an Ogg stream on the granule positions of its pages, lo is
+ * always a page that's safe to start decoding from: one whose last
+ * frame ends before the target, or the page with the first frame */
+static
+MFLAC_RESULT
+mflac_seek_bisect_ogg(mflac_t* m, uint64_t length, uint64_t sample_number) {
+    MFLAC_RESULT res;
+    miniflac_seekpoint_t point;
+    uint64_t lo = m->flac.frame_offset;
+    uint64_t hi = length;
+    uint64_t mid;
+    uint64_t limit;
+    uint64_t pos;
+    int64_t granulepos;
+
+    point.sample_number = 0;
+    point.samples = 0;
+
+    while(hi > lo && hi - lo > MFLAC_BUFFER_SIZE) {
+        mid = lo + (hi - lo) / 2;
+        /* pages from a later link of a chained file, or a busy stream
+         * multiplexed with this one, can go on for a long way - give
+         * up after a few of the largest possible pages and look in the
+         * first half instead */
+        limit = hi - mid > MFLAC_OGG_SCAN_LIMIT ? mid + MFLAC_OGG_SCAN_LIMIT : hi;
+        res = mflac_ogg_scan(m,mid,limit,&pos,&granulepos);
+        if(res == MFLAC_EOF) {
+            hi = mid;
+            continue;
+        }
+        if(res != MFLAC_OK) return res;
+        if(granulepos == -1) {
+            hi = pos;
+            continue;
+        }
+        if((uint64_t)granulepos >= sample_number) {
+            hi = mid;
+            continue;
+        }
+
+        lo = pos;
+        point.sample_number = (uint64_t)granulepos;
+    }
+
+    point.sample_offset = lo - m->flac.frame_offset;
+    return mflac_seek(m,&point,1,sample_number);
+}
+
+MINIFLAC_API
+MFLAC_RESULT
+mflac_seek(mflac_t* m, const miniflac_seekpoint_t* points, uint32_t points_length, uint64_t sample_number) {
+    MFLAC_RESULT res;
+    MINIFLAC_RESULT r;
+    uint64_t offset;
+
+    res = mflac_seek_prepare(m);
+    if(res != MFLAC_OK) return res;
+
+    r = miniflac_seek(&m->flac,points,points_length,sample_number,&offset);
+    if(r != MINIFLAC_OK) return (MFLAC_RESULT)r;
+
+    if(m->seek(offset,m->userdata) != 0) return (MFLAC_RESULT)MINIFLAC_ERROR;
+    m->bufpos = 0;
+    m->buflen = 0;
+    return MFLAC_OK;
+}
+
+MINIFLAC_API
+MFLAC_RESULT
+mflac_seek_bisect(mflac_t* m, uint64_t length, uint64_t sample_number) {
+    MFLAC_RESULT res;
+    miniflac_seekpoint_t point;
+    uint64_t lo;
+    uint64_t hi = length;
+    uint64_t mid;
+    uint64_t pos;
+    uint64_t first;
+    uint16_t block_size;
+
+    res = mflac_seek_prepare(m);
+    if(res != MFLAC_OK) return res;
+    if(m->flac.container == MINIFLAC_CONTAINER_OGG) return mflac_seek_bisect_ogg(m,length,sample_number);
+
+    /* lo is always a frame header at or before the target, anything
+     * at or past hi starts after it. Once the gap is down to one
+     * buffer it's quicker to decode forward than to keep seeking. */
+    lo = m->flac.frame_offset;
+    point.sample_number = 0;
+    point.samples = 0;
+
+    while(hi > lo && hi - lo > MFLAC_BUFFER_SIZE) {
+        mid = lo + (hi - lo) / 2;
+        res = mflac_seek_scan(m,mid,hi,&pos,&first,&block_size);
+        if(res == MFLAC_EOF || (res == MFLAC_OK && first > sample_number)) {
+            hi = mid;
+            continue;
+        }
+        if(res != MFLAC_OK) return res;
+
+        lo = pos;
+        point.sample_number = first;
+        if(first + block_size > sample_number) break;
+    }
+
+    point.sample_offset = lo - m->flac.frame_offset;
+    return mflac_seek(m,&point,1,sample_number);
+}
+
 MFLAC_GET1_FUNC(decode,int32_t**)
 
+MFLAC_GET1_FUNC(frameinfo,miniflac_frameinfo_t*)
+
+MFLAC_FUNC(mflac_decode_interleaved(mflac_t* m, MINIFLAC_SAMPLE_FORMAT format, void* samples, int32_t* scratch),MFLAC_FUNC_BODY(miniflac_decode_interleaved(&m->flac, &m->buffer[m->bufpos], m->buflen, &used, format, samples, scratch)))
+
+MFLAC_FUNC(mflac_decode_planar(mflac_t* m, MINIFLAC_SAMPLE_FORMAT format, void** samples, int32_t* scratch),MFLAC_FUNC_BODY(miniflac_decode_planar(&m->flac, &m->buffer[m->bufpos], m->buflen, &used, format, samples, scratch)))
+
 MFLAC_GET1_FUNC(streaminfo_min_block_size, uint16_t*)
 MFLAC_GET1_FUNC(streaminfo_max_block_size, uint16_t*)
 MFLAC_GET1_FUNC(streaminfo_min_frame_size, uint32_t*)
@@ -1945,6 +2618,7 @@ MFLAC_GET1_FUNC(seektable_seekpoints, uint32_t*)
 MFLAC_GET1_FUNC(seektable_sample_number, uint64_t*)
 MFLAC_GET1_FUNC(seektable_sample_offset, uint64_t*)
 MFLAC_GET1_FUNC(seektable_samples, uint16_t*)
+MFLAC_GET3_FUNC(seektable_points, miniflac_seekpoint_t*)
 
 MFLAC_GET1_FUNC(cuesheet_catalog_length, uint32_t*)
 MFLAC_GET3_FUNC(cuesheet_catalog_string, char*)
@@ -1974,13 +2648,25 @@ MFLAC_GET1_FUNC(picture_length, uint32_t*)
 MFLAC_GET3_FUNC(picture_data, uint8_t*)
 
 MINIFLAC_API
-uint8_t
-mflac_is_native(mflac_t* m) {
-    return m->flac.container == MINIFLAC_CONTAINER_NATIVE;
+void
+mflac_verify_frame(miniflac_md5_t* md5, mflac_t* m, int32_t** samples) {
+    miniflac_verify_frame(md5,&m->flac,samples);
 }
 
 MINIFLAC_API
-uint8_t
+MFLAC_RESULT
+mflac_verify_check(miniflac_md5_t* md5, mflac_t* m) {
+    return (MFLAC_RESULT)miniflac_verify_check(md5,&m->flac);
+}
+
+MINIFLAC_API
+uint8_t
+mflac_is_native(mflac_t* m) {
+    return m->flac.container == MINIFLAC_CONTAINER_NATIVE;
+}
+
+MINIFLAC_API
+uint8_t
 mflac_is_ogg(mflac_t* m) {
     return m->flac.container == MINIFLAC_CONTAINER_OGG;
 }
@@ -2199,6 +2885,8 @@ miniflac_oggreset(miniflac_t* pFlac) {
     miniflac_streammarker_init(&pFlac->streammarker);
     miniflac_metadata_init(&pFlac->metadata);
     miniflac_frame_init(&pFlac->frame);
+    pFlac->frame_offset = 0;
+    pFlac->frame_offset_set = 0;
     pFlac->state = MINIFLAC_OGGHEADER;
 }
 
@@ -2207,17 +2895,57 @@ MINIFLAC_RESULT
 miniflac_oggfunction_start(miniflac_t* pFlac, const uint8_t* data, const uint8_t** packet, uint32_t* packet_length) {
     MINIFLAC_RESULT r;
 
-    while(pFlac->ogg.state != MINIFLAC_OGG_DATA) {
-        r = miniflac_ogg_sync(&pFlac->ogg,&pFlac->ogg.br);
-        if(r != MINIFLAC_OK) return r;
+    for(;;) {
+        while(pFlac->ogg.state != MINIFLAC_OGG_DATA) {
+            if(pFlac->oggserial_set) {
+                miniflac_ogg_skip_foreign(&pFlac->ogg,pFlac->oggserial);
+            }
+
+            r = miniflac_ogg_sync(&pFlac->ogg,&pFlac->ogg.br);
+            if(r != MINIFLAC_OK) return r;
+
+            if(pFlac->oggserial_set == 0) {
+                /* only a new stream can be picked up, pages of other
+                 * streams can carry on past the end of ours */
+                if(pFlac->ogg.headertype & 0x02) {
+                    miniflac_oggreset(pFlac);
+                } else if(pFlac->state != MINIFLAC_OGGHEADER) {
+                    pFlac->ogg.state = MINIFLAC_OGG_SKIP;
+                }
+            } else {
+                if(pFlac->oggserial != pFlac->ogg.serialno) pFlac->ogg.state = MINIFLAC_OGG_SKIP;
+            }
+
+            if(pFlac->ogg.state == MINIFLAC_OGG_DATA) {
+                r = miniflac_ogg_verify(&pFlac->ogg);
+                if(r != MINIFLAC_OK) return r;
+                pFlac->oggpage_last = pFlac->oggpage_offset;
+                pFlac->oggpage_offset = pFlac->bytes_read_ogg + pFlac->ogg.br.pos - 27 - pFlac->ogg.segments;
+            }
+        }
 
-        if(pFlac->oggserial_set == 0) {
-            if(pFlac->ogg.headertype & 0x02) {
-                miniflac_oggreset(pFlac);
+        /* after a seek, drop packets until one starts with a frame
+         * sync code. The page may start with the end of a packet from
+         * the page before, and the page with the first frame can have
+         * metadata on it too */
+        while(pFlac->oggresync && pFlac->ogg.state == MINIFLAC_OGG_DATA) {
+            if(pFlac->ogg.pos == 0 && (pFlac->ogg.headertype & 0x01)) {
+                pFlac->oggresync = 2;
             }
-        } else {
-            if(pFlac->oggserial != pFlac->ogg.serialno) pFlac->ogg.state = MINIFLAC_OGG_SKIP;
+            if(pFlac->oggresync == 1) {
+                if(pFlac->ogg.br.pos == pFlac->ogg.br.len) return MINIFLAC_CONTINUE;
+                if(pFlac->ogg.br.buffer[pFlac->ogg.br.pos] == 0xFF) {
+                    pFlac->oggresync = 0;
+                    break;
+                }
+                pFlac->oggresync = 2;
+            }
+            r = miniflac_ogg_skip_packet(&pFlac->ogg);
+            if(r != MINIFLAC_OK) return r;
+            pFlac->oggresync = 1;
         }
+
+        if(pFlac->ogg.state == MINIFLAC_OGG_DATA) break;
     }
 
     *packet = &data[pFlac->ogg.br.pos];
@@ -2229,21 +2957,22 @@ miniflac_oggfunction_start(miniflac_t* pFlac, const uint8_t* data, const uint8_t
     return MINIFLAC_OK;
 }
 
+/* a bad page checksum takes priority over whatever the packet
+ * function returned */
 static
-void
-miniflac_oggfunction_end(miniflac_t* pFlac, uint32_t packet_used) {
-    pFlac->ogg.br.pos += packet_used;
-    pFlac->ogg.pos    += packet_used;
+MINIFLAC_RESULT
+miniflac_oggfunction_end(miniflac_t* pFlac, uint32_t packet_used, MINIFLAC_RESULT r) {
+    MINIFLAC_RESULT res = miniflac_ogg_advance(&pFlac->ogg,packet_used);
+    if(res != MINIFLAC_OK) r = res;
 
     if(pFlac->ogg.pos == pFlac->ogg.length) {
-        pFlac->ogg.state = MINIFLAC_OGG_CAPTUREPATTERN_O;
         if(pFlac->ogg.headertype & 0x04) {
             if(pFlac->oggserial_set == 1 && pFlac->oggserial == pFlac->ogg.serialno) {
                 pFlac->oggserial_set = 0;
-                pFlac->oggserial = 0;
             }
         }
     }
+    return r;
 }
 
 MINIFLAC_API
@@ -2256,11 +2985,17 @@ miniflac_size(void) {
 MINIFLAC_API
 void
 miniflac_reset(miniflac_t* pFlac, MINIFLAC_STATE state) {
+    uint16_t max_block_size = 0;
+    uint32_t max_frame_size = 0;
     uint32_t sample_rate = 0;
+    uint8_t channels = 0;
     uint8_t bps = 0;
 
     if(state == MINIFLAC_FRAME) {
+        max_block_size = pFlac->metadata.streaminfo.max_block_size;
+        max_frame_size = pFlac->metadata.streaminfo.max_frame_size;
         sample_rate = pFlac->metadata.streaminfo.sample_rate;
+        channels = pFlac->metadata.streaminfo.channels;
         bps = pFlac->metadata.streaminfo.bps;
     }
 
@@ -2272,16 +3007,26 @@ miniflac_reset(miniflac_t* pFlac, MINIFLAC_STATE state) {
     miniflac_frame_init(&pFlac->frame);
     pFlac->bytes_read_flac = 0;
     pFlac->bytes_read_ogg = 0;
+    pFlac->seek_pending = 0;
+    pFlac->oggpage_offset = 0;
+    pFlac->oggpage_last = 0;
+    pFlac->oggresync = state == MINIFLAC_FRAME;
     pFlac->state = state;
 
     if(state == MINIFLAC_FRAME) {
+        pFlac->metadata.streaminfo.max_block_size = max_block_size;
+        pFlac->metadata.streaminfo.max_frame_size = max_frame_size;
         pFlac->metadata.streaminfo.sample_rate = sample_rate;
+        pFlac->metadata.streaminfo.channels = channels;
         pFlac->metadata.streaminfo.bps = bps;
+    } else {
+        pFlac->frame_offset = 0;
+        pFlac->frame_offset_set = 0;
     }
 
-    /* if we're using an ogg container we need to look for an ogg header
-     * no matter what */
-    if(pFlac->container == MINIFLAC_CONTAINER_OGG) {
+    /* if we're using an ogg container we need to look for an ogg header,
+     * unless we're picking up frames after a seek */
+    if(pFlac->container == MINIFLAC_CONTAINER_OGG && state != MINIFLAC_FRAME) {
         pFlac->state = MINIFLAC_OGGHEADER;
     }
 
@@ -2290,6 +3035,8 @@ miniflac_reset(miniflac_t* pFlac, MINIFLAC_STATE state) {
 MINIFLAC_API
 void
 miniflac_init(miniflac_t* pFlac, MINIFLAC_CONTAINER container) {
+    miniflac_cpu_init();
+
     pFlac->container = container;
     pFlac->oggserial = -1;
     pFlac->oggserial_set = 0;
@@ -2310,6 +3057,26 @@ miniflac_init(miniflac_t* pFlac, MINIFLAC_CONTAINER container) {
     }
 }
 
+/* remembers where the first audio frame starts, seekpoint offsets
+ * are relative to it. Called with the sync code peeked but not read.
+ * In Ogg it's the page the frame starts on, which is the page before
+ * the current one if the sync code was split across them. */
+static
+void
+miniflac_mark_frame_offset(miniflac_t* pFlac, miniflac_bitreader_t* br) {
+    if(pFlac->frame_offset_set) return;
+    if(pFlac->container == MINIFLAC_CONTAINER_OGG) {
+        if((uint32_t)pFlac->ogg.pos + br->pos < (uint32_t)(br->bits >> 3)) {
+            pFlac->frame_offset = pFlac->oggpage_last;
+        } else {
+            pFlac->frame_offset = pFlac->oggpage_offset;
+        }
+    } else {
+        pFlac->frame_offset = pFlac->bytes_read_flac + br->pos - (br->bits >> 3);
+    }
+    pFlac->frame_offset_set = 1;
+}
+
 static
 MINIFLAC_RESULT
 miniflac_sync_internal(miniflac_t* pFlac, miniflac_bitreader_t* br) {
@@ -2333,6 +3100,7 @@ miniflac_sync_internal(miniflac_t* pFlac, miniflac_bitreader_t* br) {
                 pFlac->state = MINIFLAC_STREAMMARKER;
                 goto miniflac_sync_streammarker;
             } else if(c == 0xFF) {
+                miniflac_mark_frame_offset(pFlac,br);
                 pFlac->state = MINIFLAC_FRAME;
                 goto miniflac_sync_frame;
             }
@@ -2353,6 +3121,7 @@ miniflac_sync_internal(miniflac_t* pFlac, miniflac_bitreader_t* br) {
             if(miniflac_bitreader_fill(br,16)) return MINIFLAC_CONTINUE;
             peek = (uint16_t)miniflac_bitreader_peek(br,14);
             if(peek == 0x3FFE) {
+                miniflac_mark_frame_offset(pFlac,br);
                 pFlac->state = MINIFLAC_FRAME;
                 goto miniflac_sync_frame;
             }
@@ -2377,9 +3146,10 @@ miniflac_sync_internal(miniflac_t* pFlac, miniflac_bitreader_t* br) {
 
         case MINIFLAC_FRAME: {
             miniflac_sync_frame:
-            while(pFlac->frame.state != MINIFLAC_FRAME_HEADER) {
-                r = miniflac_frame_decode(&pFlac->frame,br,&pFlac->metadata.streaminfo,NULL);
-                if(r != MINIFLAC_OK) return r;
+            /* in the middle of a frame, jump straight to the next
+             * header instead of decoding the rest of it */
+            if(pFlac->frame.state != MINIFLAC_FRAME_HEADER) {
+                return miniflac_frame_skip(&pFlac->frame,br,&pFlac->metadata.streaminfo);
             }
 
             return miniflac_frame_sync(&pFlac->frame,br,&pFlac->metadata.streaminfo);
@@ -2390,6 +3160,18 @@ miniflac_sync_internal(miniflac_t* pFlac, miniflac_bitreader_t* br) {
     return MINIFLAC_ERROR;
 }
 
+static
+void
+miniflac_native_exit(miniflac_t* pFlac, MINIFLAC_RESULT r, uint32_t* out_length) {
+    /* the bitreader reads ahead, return any whole bytes past the
+     * point we stopped at so out_length is exact. On MINIFLAC_CONTINUE
+     * everything has been used. */
+    if(r != MINIFLAC_CONTINUE) miniflac_bitreader_unfill(&pFlac->br);
+    *out_length = pFlac->br.pos;
+    pFlac->bytes_read_flac += pFlac->br.pos;
+    miniflac_bitreader_detach(&pFlac->br);
+}
+
 static
 MINIFLAC_RESULT
 miniflac_sync_native(miniflac_t* pFlac, const uint8_t* data, uint32_t length, uint32_t* out_length) {
@@ -2400,14 +3182,90 @@ miniflac_sync_native(miniflac_t* pFlac, const uint8_t* data, uint32_t length, ui
 
     r = miniflac_sync_internal(pFlac,&pFlac->br);
 
-    *out_length = pFlac->br.pos;
-    pFlac->bytes_read_flac += pFlac->br.pos;
+    miniflac_native_exit(pFlac,r,out_length);
     return r;
 }
 
+/* the first sample of a frame, from its decoded header */
+static
+uint64_t
+miniflac_frame_first_sample(miniflac_t* pFlac, const miniflac_frame_header_t* header) {
+    uint64_t block_size;
+    if(header->blocking_strategy) return header->sample_number;
+
+    block_size = pFlac->metadata.streaminfo.max_block_size;
+    if(block_size == 0) block_size = header->block_size;
+    return header->sample_number * block_size;
+}
+
+/* after a seek, skips over frames that end before the target, stops
+ * with the header of the frame holding the target decoded */
+static
+MINIFLAC_RESULT
+miniflac_seek_skip(miniflac_t* pFlac) {
+    MINIFLAC_RESULT r;
+
+    for(;;) {
+        if(pFlac->frame.state == MINIFLAC_FRAME_HEADER) {
+            r = miniflac_frame_sync(&pFlac->frame,&pFlac->br,&pFlac->metadata.streaminfo);
+            if(r != MINIFLAC_OK) return r;
+        }
+        if(miniflac_frame_first_sample(pFlac,&pFlac->frame.header) + pFlac->frame.header.block_size > pFlac->seek_target) {
+            return MINIFLAC_OK;
+        }
+        r = miniflac_frame_skip(&pFlac->frame,&pFlac->br,&pFlac->metadata.streaminfo);
+        if(r != MINIFLAC_OK) return r;
+    }
+}
+
+static
+void
+miniflac_seek_move(uint8_t* buffer, uint32_t skip, uint32_t length) {
+    uint32_t i;
+    for(i = 0; i < length; i++) {
+        buffer[i] = buffer[i + skip];
+    }
+}
+
+/* drops the samples before the seek target from the frame that
+ * was just decoded */
+static
+void
+miniflac_seek_trim(miniflac_t* pFlac, int32_t** samples, const miniflac_output_t* packed) {
+    uint64_t first = miniflac_frame_first_sample(pFlac,&pFlac->frame.header);
+    uint32_t skip;
+    uint32_t keep;
+    uint32_t size;
+    uint8_t c;
+    uint8_t channels = pFlac->frame.header.channels;
+
+    pFlac->seek_pending = 0;
+    if(pFlac->seek_target <= first) return;
+
+    skip = (uint32_t)(pFlac->seek_target - first);
+    keep = pFlac->frame.header.block_size - skip;
+
+    if(samples != NULL) {
+        for(c = 0; c < channels; c++) {
+            miniflac_seek_move((uint8_t*)samples[c],skip * sizeof(int32_t),keep * sizeof(int32_t));
+        }
+    } else if(packed != NULL) {
+        size = miniflac_output_sample_size(packed->format);
+        if(packed->samples != NULL) {
+            miniflac_seek_move((uint8_t*)packed->samples,skip * size * channels,keep * size * channels);
+        } else {
+            for(c = 0; c < channels; c++) {
+                miniflac_seek_move((uint8_t*)packed->planes[c],skip * size,keep * size);
+            }
+        }
+    }
+
+    pFlac->frame.header.block_size = (uint16_t)keep;
+}
+
 static
 MINIFLAC_RESULT
-miniflac_decode_native(miniflac_t* pFlac, const uint8_t* data, uint32_t length, uint32_t* out_length, int32_t** samples) {
+miniflac_decode_native(miniflac_t* pFlac, const uint8_t* data, uint32_t length, uint32_t* out_length, int32_t** samples, const miniflac_output_t* packed) {
     MINIFLAC_RESULT r;
     pFlac->br.buffer = data;
     pFlac->br.len    = length;
@@ -2418,11 +3276,18 @@ miniflac_decode_native(miniflac_t* pFlac, const uint8_t* data, uint32_t length,
         if(r != MINIFLAC_OK) goto miniflac_decode_exit;
     }
 
-    r = miniflac_frame_decode(&pFlac->frame,&pFlac->br,&pFlac->metadata.streaminfo,samples);
+    if(pFlac->seek_pending) {
+        r = miniflac_seek_skip(pFlac);
+        if(r != MINIFLAC_OK) goto miniflac_decode_exit;
+    }
+
+    r = miniflac_frame_decode(&pFlac->frame,&pFlac->br,&pFlac->metadata.streaminfo,samples,packed);
+    if(r == MINIFLAC_OK && pFlac->seek_pending) {
+        miniflac_seek_trim(pFlac,samples,packed);
+    }
 
     miniflac_decode_exit:
-    *out_length = pFlac->br.pos;
-    pFlac->bytes_read_flac += pFlac->br.pos;
+    miniflac_native_exit(pFlac,r,out_length);
     return r;
 }
 
@@ -2444,7 +3309,7 @@ miniflac_sync_ogg(miniflac_t* pFlac, const uint8_t* data, uint32_t length, uint3
         if(r != MINIFLAC_OK) break;
 
         r = miniflac_sync_native(pFlac,packet,packet_length,&packet_used);
-        miniflac_oggfunction_end(pFlac,packet_used);
+        r = miniflac_oggfunction_end(pFlac,packet_used,r);
 
         if(r == MINIFLAC_OGG_HEADER_NOTFLAC) {
             /* try reading more data */
@@ -2460,7 +3325,7 @@ miniflac_sync_ogg(miniflac_t* pFlac, const uint8_t* data, uint32_t length, uint3
 
 static
 MINIFLAC_RESULT
-miniflac_decode_ogg(miniflac_t* pFlac, const uint8_t* data, uint32_t length, uint32_t* out_length, int32_t** samples) {
+miniflac_decode_ogg(miniflac_t* pFlac, const uint8_t* data, uint32_t length, uint32_t* out_length, int32_t** samples, const miniflac_output_t* packed) {
     MINIFLAC_RESULT r = MINIFLAC_CONTINUE;
 
     const uint8_t* packet = NULL;
@@ -2475,8 +3340,8 @@ miniflac_decode_ogg(miniflac_t* pFlac, const uint8_t* data, uint32_t length, uin
         r = miniflac_oggfunction_start(pFlac,data,&packet,&packet_length);
         if(r  != MINIFLAC_OK) break;
 
-        r = miniflac_decode_native(pFlac,packet,packet_length,&packet_used,samples);
-        miniflac_oggfunction_end(pFlac,packet_used);
+        r = miniflac_decode_native(pFlac,packet,packet_length,&packet_used,samples,packed);
+        r = miniflac_oggfunction_end(pFlac,packet_used,r);
     } while(r == MINIFLAC_CONTINUE && pFlac->ogg.br.pos < length);
 
     *out_length = pFlac->ogg.br.pos;
@@ -2516,14 +3381,298 @@ miniflac_decode(miniflac_t* pFlac, const uint8_t* data, uint32_t length, uint32_
     }
 
     if(pFlac->container == MINIFLAC_CONTAINER_NATIVE) {
-        r = miniflac_decode_native(pFlac,data,length,out_length,samples);
+        r = miniflac_decode_native(pFlac,data,length,out_length,samples,NULL);
+    } else {
+        r = miniflac_decode_ogg(pFlac,data,length,out_length,samples,NULL);
+    }
+
+    return r;
+}
+
+static
+MINIFLAC_RESULT
+miniflac_decode_packed(miniflac_t* pFlac, const uint8_t* data, uint32_t length, uint32_t* out_length, const miniflac_output_t* packed) {
+    MINIFLAC_RESULT r;
+
+    if(pFlac->container == MINIFLAC_CONTAINER_UNKNOWN) {
+        r = miniflac_probe(pFlac,data,length);
+        if(r != MINIFLAC_OK) return r;
+    }
+
+    if(pFlac->container == MINIFLAC_CONTAINER_NATIVE) {
+        r = miniflac_decode_native(pFlac,data,length,out_length,NULL,packed);
+    } else {
+        r = miniflac_decode_ogg(pFlac,data,length,out_length,NULL,packed);
+    }
+
+    return r;
+}
+
+MINIFLAC_API
+MINIFLAC_RESULT
+miniflac_decode_interleaved(miniflac_t* pFlac, const uint8_t* data, uint32_t length, uint32_t* out_length, MINIFLAC_SAMPLE_FORMAT format, void* samples, int32_t* scratch) {
+    miniflac_output_t packed;
+
+    packed.format  = format;
+    packed.samples = samples;
+    packed.planes  = NULL;
+    packed.scratch = scratch;
+
+    return miniflac_decode_packed(pFlac,data,length,out_length,&packed);
+}
+
+MINIFLAC_API
+MINIFLAC_RESULT
+miniflac_decode_planar(miniflac_t* pFlac, const uint8_t* data, uint32_t length, uint32_t* out_length, MINIFLAC_SAMPLE_FORMAT format, void** samples, int32_t* scratch) {
+    miniflac_output_t packed;
+
+    packed.format  = format;
+    packed.samples = NULL;
+    packed.planes  = samples;
+    packed.scratch = scratch;
+
+    return miniflac_decode_packed(pFlac,data,length,out_length,&packed);
+}
+
+MINIFLAC_API
+MINIFLAC_RESULT
+miniflac_seek(miniflac_t* pFlac, const miniflac_seekpoint_t* points, uint32_t points_length, uint64_t sample_number, uint64_t* offset) {
+    uint32_t i;
+    uint64_t point_offset = 0;
+
+    if(pFlac->container == MINIFLAC_CONTAINER_UNKNOWN || !pFlac->frame_offset_set) {
+        miniflac_abort();
+        return MINIFLAC_ERROR;
+    }
+
+    /* seekpoints are sorted by sample number, with placeholders last */
+    if(points != NULL) {
+        for(i = 0; i < points_length; i++) {
+            if(points[i].sample_number == ~(uint64_t)0 || points[i].sample_number > sample_number) break;
+            point_offset = points[i].sample_offset;
+        }
+    }
+
+    miniflac_reset(pFlac,MINIFLAC_FRAME);
+    pFlac->seek_target = sample_number;
+    pFlac->seek_pending = 1;
+    *offset = pFlac->frame_offset + point_offset;
+    if(pFlac->container == MINIFLAC_CONTAINER_OGG) {
+        /* the end-of-stream page clears oggserial_set but keeps
+         * oggserial, so re-arm it to follow the same stream again
+         * after seeking back */
+        pFlac->oggserial_set = 1;
+        pFlac->bytes_read_ogg = *offset;
     } else {
-        r = miniflac_decode_ogg(pFlac,data,length,out_length,samples);
+        pFlac->bytes_read_flac = *offset;
+    }
+    return MINIFLAC_OK;
+}
+
+MINIFLAC_API
+MINIFLAC_RESULT
+miniflac_frameinfo(miniflac_t* pFlac, const uint8_t* data, uint32_t length, uint32_t* out_length, miniflac_frameinfo_t* info) {
+    MINIFLAC_RESULT r;
+    uint32_t pos = 0;
+    uint32_t used = 0;
+
+    do {
+        r = miniflac_sync(pFlac,&data[pos],length - pos,&used);
+        pos += used;
+        if(r != MINIFLAC_OK) goto miniflac_frameinfo_exit;
+    } while(pFlac->state != MINIFLAC_FRAME);
+
+    if(pFlac->container != MINIFLAC_CONTAINER_NATIVE) {
+        miniflac_abort();
+        r = MINIFLAC_ERROR;
+        goto miniflac_frameinfo_exit;
     }
 
+    /* miniflac_sync stops right after the header */
+    info->offset = pFlac->bytes_read_flac - pFlac->frame.header.size;
+    info->sample_number = miniflac_frame_first_sample(pFlac,&pFlac->frame.header);
+    info->block_size = pFlac->frame.header.block_size;
+    info->header_size = (uint8_t)pFlac->frame.header.size;
+
+    miniflac_frameinfo_exit:
+    *out_length = pos;
     return r;
 }
 
+MINIFLAC_API
+uint32_t
+miniflac_frameinfo_find(const miniflac_frameinfo_t* index, uint32_t length, uint64_t sample_number) {
+    uint32_t lo = 0;
+    uint32_t hi = length;
+    uint32_t mid;
+    uint64_t guess;
+
+    if(length == 0) return 0;
+
+    /* with a fixed block size the frame can be worked out directly */
+    if(index[0].block_size != 0) {
+        guess = sample_number / index[0].block_size;
+        if(guess < length && index[guess].sample_number <= sample_number && sample_number < index[guess].sample_number + index[guess].block_size) {
+            return (uint32_t)guess;
+        }
+    }
+
+    while(hi - lo > 1) {
+        mid = lo + (hi - lo) / 2;
+        if(index[mid].sample_number <= sample_number) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+MINIFLAC_API
+MINIFLAC_RESULT
+miniflac_seek_probe(miniflac_t* pFlac, const uint8_t* data, uint32_t length, uint32_t* out_length, uint64_t* sample_number, uint16_t* block_size) {
+    miniflac_frame_header_t header;
+    miniflac_bitreader_t br;
+    miniflac_streaminfo_t* info = &pFlac->metadata.streaminfo;
+    uint32_t pos;
+    int size;
+
+    if(pFlac->container != MINIFLAC_CONTAINER_NATIVE) {
+        miniflac_abort();
+        return MINIFLAC_ERROR;
+    }
+
+    for(pos = 0; pos < length; pos++) {
+        size = miniflac_frame_header_check(&data[pos],length - pos);
+        if(size < 0) break;
+        if(size == 0) continue;
+
+        /* the crc8 matched, so this can't fail */
+        miniflac_bitreader_init(&br);
+        br.buffer = &data[pos];
+        br.len = (uint32_t)size;
+        miniflac_frame_header_init(&header);
+        if(miniflac_frame_header_decode(&header,&br) != MINIFLAC_OK) continue;
+
+        /* a crc8 matches by chance 1 time in 256, weed out headers
+         * that don't fit the stream */
+        if(!miniflac_frame_header_fits(&header,info)) continue;
+
+        *out_length = pos;
+        *sample_number = miniflac_frame_first_sample(pFlac,&header);
+        *block_size = header.block_size;
+        return MINIFLAC_OK;
+    }
+
+    *out_length = pos;
+    return MINIFLAC_CONTINUE;
+}
+
+MINIFLAC_API
+MINIFLAC_RESULT
+miniflac_ogg_probe(miniflac_t* pFlac, const uint8_t* data, uint32_t length, uint32_t* out_length, int64_t* granulepos) {
+    miniflac_ogg_t page;
+    uint32_t pos = 0;
+    uint32_t used;
+    uint32_t size;
+
+    if(pFlac->container != MINIFLAC_CONTAINER_OGG || !pFlac->frame_offset_set) {
+        miniflac_abort();
+        return MINIFLAC_ERROR;
+    }
+
+    while(miniflac_ogg_find(&page,&data[pos],length - pos,&used) == MINIFLAC_OK) {
+        pos += used;
+        if(page.serialno == pFlac->oggserial) {
+            if(page.granulepos != -1) {
+                *out_length = pos;
+                *granulepos = page.granulepos;
+                return MINIFLAC_OK;
+            }
+        } else if(page.headertype & 0x02) {
+            /* beginning-of-stream pages of a multiplexed file all come
+             * first, so this is the next link of a chained file */
+            *out_length = pos;
+            *granulepos = -1;
+            return MINIFLAC_OK;
+        }
+
+        /* jump over pages that don't tell us anything */
+        size = 27 + (uint32_t)page.segments + page.length;
+        if(size > length - pos) {
+            *out_length = length;
+            return MINIFLAC_CONTINUE;
+        }
+        pos += size;
+    }
+
+    *out_length = pos + used;
+    return MINIFLAC_CONTINUE;
+}
+
+MINIFLAC_API
+MINIFLAC_RESULT
+miniflac_ogg_pageinfo(const uint8_t* data, uint32_t length, miniflac_ogg_pageinfo_t* info) {
+    const uint8_t* packet;
+
+    if(length < 27) return MINIFLAC_CONTINUE;
+    if(data[0] != 'O' || data[1] != 'g' || data[2] != 'g' || data[3] != 'S' || data[4] != 0) {
+        miniflac_abort();
+        return MINIFLAC_ERROR;
+    }
+    if(length < 27 + (uint32_t)data[26]) return MINIFLAC_CONTINUE;
+
+    info->size = miniflac_ogg_page_size(data);
+    if(length < info->size) return MINIFLAC_CONTINUE;
+
+    info->headertype = data[5];
+    info->granulepos = miniflac_unpack_int64le(&data[6]);
+    info->serialno   = miniflac_unpack_int32le(&data[14]);
+    info->pageno     = miniflac_unpack_uint32le(&data[18]);
+
+    /* the first packet of a FLAC stream starts with 0x7F "FLAC" */
+    packet = &data[27 + (uint32_t)data[26]];
+    info->flac = (info->headertype & 0x02) && info->size - (uint32_t)(packet - data) >= 5 &&
+      packet[0] == 0x7F && packet[1] == 'F' && packet[2] == 'L' && packet[3] == 'A' && packet[4] == 'C';
+
+    return MINIFLAC_OK;
+}
+
+MINIFLAC_API
+void
+miniflac_verify_init(miniflac_md5_t* md5) {
+    miniflac_md5_init(md5);
+}
+
+MINIFLAC_API
+void
+miniflac_verify_frame(miniflac_md5_t* md5, miniflac_t* pFlac, int32_t** samples) {
+    miniflac_md5_samples(md5,samples,pFlac->frame.header.channels,pFlac->frame.header.block_size,pFlac->frame.header.bps);
+}
+
+MINIFLAC_API
+MINIFLAC_RESULT
+miniflac_verify_check(miniflac_md5_t* md5, miniflac_t* pFlac) {
+    uint8_t digest[16];
+    uint8_t set = 0;
+    uint8_t i;
+
+    miniflac_md5_final(md5,digest);
+
+    for(i = 0; i < 16; i++) {
+        set |= pFlac->metadata.streaminfo.md5[i];
+    }
+    if(!set) return MINIFLAC_MD5_UNAVAILABLE;
+
+    for(i = 0; i < 16; i++) {
+        if(digest[i] != pFlac->metadata.streaminfo.md5[i]) {
+            miniflac_abort();
+            return MINIFLAC_MD5_MISMATCH;
+        }
+    }
+    return MINIFLAC_OK;
+}
+
 MINIFLAC_API
 MINIFLAC_RESULT
 miniflac_sync(miniflac_t* pFlac, const uint8_t* data, uint32_t length, uint32_t* out_length) {
@@ -2721,8 +3870,7 @@ miniflac_ ## subsys ## _ ## val ## _native(miniflac_t *pFlac, const uint8_t* dat
     } \
     r = miniflac_ ## subsys ## _read_ ## val(MINIFLAC_SUBSYS(subsys),&pFlac->br, outvar); \
     miniflac_ ## subsys ## _ ## val ## _exit: \
-    *out_length = pFlac->br.pos; \
-    pFlac->bytes_read_flac += pFlac->br.pos; \
+    miniflac_native_exit(pFlac,r,out_length); \
     return r; \
 }
 
@@ -2741,7 +3889,7 @@ miniflac_ ## subsys ## _ ## val ## _ogg(miniflac_t *pFlac, const uint8_t* data,
         r = miniflac_oggfunction_start(pFlac,data,&packet,&packet_length); \
         if(r  != MINIFLAC_OK) break; \
         r = miniflac_ ## subsys ## _ ## val ## _native(pFlac,packet,packet_length,&packet_used,outvar); \
-        miniflac_oggfunction_end(pFlac,packet_used); \
+        r = miniflac_oggfunction_end(pFlac,packet_used,r); \
     } while(r == MINIFLAC_CONTINUE && pFlac->ogg.br.pos < length); \
     *out_length = pFlac->ogg.br.pos; \
     pFlac->bytes_read_ogg += pFlac->ogg.br.pos; \
@@ -2789,8 +3937,7 @@ miniflac_ ## subsys ## _ ## val ## _native(miniflac_t *pFlac, const uint8_t* dat
     } \
     r = miniflac_ ## subsys ## _read_ ## val(MINIFLAC_SUBSYS(subsys),&pFlac->br, buffer, bufferlen, outlen); \
     miniflac_ ## subsys ## _ ## val ## _exit: \
-    *out_length = pFlac->br.pos; \
-    pFlac->bytes_read_flac += pFlac->br.pos; \
+    miniflac_native_exit(pFlac,r,out_length); \
     return r; \
 }
 
@@ -2809,7 +3956,7 @@ miniflac_ ## subsys ## _ ## val ## _ogg(miniflac_t *pFlac, const uint8_t* data,
         r = miniflac_oggfunction_start(pFlac,data,&packet,&packet_length); \
         if(r  != MINIFLAC_OK) break; \
         r = miniflac_ ## subsys ## _ ## val ##_native(pFlac,packet,packet_length,&packet_used,buffer,bufferlen,outlen); \
-        miniflac_oggfunction_end(pFlac,packet_used); \
+        r = miniflac_oggfunction_end(pFlac,packet_used,r); \
     } while(r == MINIFLAC_CONTINUE && pFlac->ogg.br.pos < length); \
     *out_length = pFlac->ogg.br.pos; \
     pFlac->bytes_read_ogg += pFlac->ogg.br.pos; \
@@ -2883,6 +4030,7 @@ MINIFLAC_GEN_FUNC1(SEEKTABLE,seektable,seekpoints,uint32_t)
 MINIFLAC_GEN_FUNC1(SEEKTABLE,seektable,sample_number,uint64_t)
 MINIFLAC_GEN_FUNC1(SEEKTABLE,seektable,sample_offset,uint64_t)
 MINIFLAC_GEN_FUNC1(SEEKTABLE,seektable,samples,uint16_t)
+MINIFLAC_GEN_FUNCSTR(SEEKTABLE,seektable,points,miniflac_seekpoint_t)
 
 MINIFLAC_GEN_FUNC1(APPLICATION,application,id,uint32_t)
 MINIFLAC_GEN_FUNC1(APPLICATION,application,length,uint32_t)
@@ -2892,7 +4040,7 @@ MINIFLAC_GEN_FUNC1(PADDING,padding,length,uint32_t)
 MINIFLAC_GEN_FUNCSTR(PADDING,padding,data,uint8_t)
 MINIFLAC_PRIVATE
 uint32_t
-miniflac_unpack_uint32le(uint8_t buffer[4]) {
+miniflac_unpack_uint32le(const uint8_t buffer[4]) {
     return (
       (((uint32_t)buffer[0]) << 0 ) |
       (((uint32_t)buffer[1]) << 8 ) |
@@ -2902,13 +4050,13 @@ miniflac_unpack_uint32le(uint8_t buffer[4]) {
 
 MINIFLAC_PRIVATE
 int32_t
-miniflac_unpack_int32le(uint8_t buffer[4]) {
+miniflac_unpack_int32le(const uint8_t buffer[4]) {
     return (int32_t)miniflac_unpack_uint32le(buffer);
 }
 
 MINIFLAC_PRIVATE
 uint64_t
-miniflac_unpack_uint64le(uint8_t buffer[8]) {
+miniflac_unpack_uint64le(const uint8_t buffer[8]) {
     return (
       (((uint64_t)buffer[0]) << 0 ) |
       (((uint64_t)buffer[1]) << 8 ) |
@@ -2922,78 +4070,620 @@ miniflac_unpack_uint64le(uint8_t buffer[8]) {
 
 MINIFLAC_PRIVATE
 int64_t
-miniflac_unpack_int64le(uint8_t buffer[8]) {
+miniflac_unpack_int64le(const uint8_t buffer[8]) {
     return (int64_t)miniflac_unpack_uint64le(buffer);
 }
 
-static const uint8_t miniflac_crc8_table[256] = {
-  0x00, 0x07, 0x0e, 0x09, 0x1c, 0x1b, 0x12, 0x15,
-  0x38, 0x3f, 0x36, 0x31, 0x24, 0x23, 0x2a, 0x2d,
-  0x70, 0x77, 0x7e, 0x79, 0x6c, 0x6b, 0x62, 0x65,
-  0x48, 0x4f, 0x46, 0x41, 0x54, 0x53, 0x5a, 0x5d,
-  0xe0, 0xe7, 0xee, 0xe9, 0xfc, 0xfb, 0xf2, 0xf5,
-  0xd8, 0xdf, 0xd6, 0xd1, 0xc4, 0xc3, 0xca, 0xcd,
-  0x90, 0x97, 0x9e, 0x99, 0x8c, 0x8b, 0x82, 0x85,
-  0xa8, 0xaf, 0xa6, 0xa1, 0xb4, 0xb3, 0xba, 0xbd,
-  0xc7, 0xc0, 0xc9, 0xce, 0xdb, 0xdc, 0xd5, 0xd2,
-  0xff, 0xf8, 0xf1, 0xf6, 0xe3, 0xe4, 0xed, 0xea,
-  0xb7, 0xb0, 0xb9, 0xbe, 0xab, 0xac, 0xa5, 0xa2,
-  0x8f, 0x88, 0x81, 0x86, 0x93, 0x94, 0x9d, 0x9a,
-  0x27, 0x20, 0x29, 0x2e, 0x3b, 0x3c, 0x35, 0x32,
-  0x1f, 0x18, 0x11, 0x16, 0x03, 0x04, 0x0d, 0x0a,
-  0x57, 0x50, 0x59, 0x5e, 0x4b, 0x4c, 0x45, 0x42,
-  0x6f, 0x68, 0x61, 0x66, 0x73, 0x74, 0x7d, 0x7a,
-  0x89, 0x8e, 0x87, 0x80, 0x95, 0x92, 0x9b, 0x9c,
-  0xb1, 0xb6, 0xbf, 0xb8, 0xad, 0xaa, 0xa3, 0xa4,
-  0xf9, 0xfe, 0xf7, 0xf0, 0xe5, 0xe2, 0xeb, 0xec,
-  0xc1, 0xc6, 0xcf, 0xc8, 0xdd, 0xda, 0xd3, 0xd4,
-  0x69, 0x6e, 0x67, 0x60, 0x75, 0x72, 0x7b, 0x7c,
-  0x51, 0x56, 0x5f, 0x58, 0x4d, 0x4a, 0x43, 0x44,
-  0x19, 0x1e, 0x17, 0x10, 0x05, 0x02, 0x0b, 0x0c,
-  0x21, 0x26, 0x2f, 0x28, 0x3d, 0x3a, 0x33, 0x34,
-  0x4e, 0x49, 0x40, 0x47, 0x52, 0x55, 0x5c, 0x5b,
-  0x76, 0x71, 0x78, 0x7f, 0x6a, 0x6d, 0x64, 0x63,
-  0x3e, 0x39, 0x30, 0x37, 0x22, 0x25, 0x2c, 0x2b,
-  0x06, 0x01, 0x08, 0x0f, 0x1a, 0x1d, 0x14, 0x13,
-  0xae, 0xa9, 0xa0, 0xa7, 0xb2, 0xb5, 0xbc, 0xbb,
-  0x96, 0x91, 0x98, 0x9f, 0x8a, 0x8d, 0x84, 0x83,
-  0xde, 0xd9, 0xd0, 0xd7, 0xc2, 0xc5, 0xcc, 0xcb,
-  0xe6, 0xe1, 0xe8, 0xef, 0xfa, 0xfd, 0xf4, 0xf3,
-};
-
-static const uint16_t miniflac_crc16_table[256] = {
-  0x0000, 0x8005, 0x800f, 0x000a, 0x801b, 0x001e, 0x0014, 0x8011,
-  0x8033, 0x0036, 0x003c, 0x8039, 0x0028, 0x802d, 0x8027, 0x0022,
-  0x8063, 0x0066, 0x006c, 0x8069, 0x0078, 0x807d, 0x8077, 0x0072,
-  0x0050, 0x8055, 0x805f, 0x005a, 0x804b, 0x004e, 0x0044, 0x8041,
-  0x80c3, 0x00c6, 0x00cc, 0x80c9, 0x00d8, 0x80dd, 0x80d7, 0x00d2,
-  0x00f0, 0x80f5, 0x80ff, 0x00fa, 0x80eb, 0x00ee, 0x00e4, 0x80e1,
-  0x00a0, 0x80a5, 0x80af, 0x00aa, 0x80bb, 0x00be, 0x00b4, 0x80b1,
-  0x8093, 0x0096, 0x009c, 0x8099, 0x0088, 0x808d, 0x8087, 0x0082,
-  0x8183, 0x0186, 0x018c, 0x8189, 0x0198, 0x819d, 0x8197, 0x0192,
-  0x01b0, 0x81b5, 0x81bf, 0x01ba, 0x81ab, 0x01ae, 0x01a4, 0x81a1,
-  0x01e0, 0x81e5, 0x81ef, 0x01ea, 0x81fb, 0x01fe, 0x01f4, 0x81f1,
-  0x81d3, 0x01d6, 0x01dc, 0x81d9, 0x01c8, 0x81cd, 0x81c7, 0x01c2,
-  0x0140, 0x8145, 0x814f, 0x014a, 0x815b, 0x015e, 0x0154, 0x8151,
-  0x8173, 0x0176, 0x017c, 0x8179, 0x0168, 0x816d, 0x8167, 0x0162,
-  0x8123, 0x0126, 0x012c, 0x8129, 0x0138, 0x813d, 0x8137, 0x0132,
-  0x0110, 0x8115, 0x811f, 0x011a, 0x810b, 0x010e, 0x0104, 0x8101,
-  0x8303, 0x0306, 0x030c, 0x8309, 0x0318, 0x831d, 0x8317, 0x0312,
-  0x0330, 0x8335, 0x833f, 0x033a, 0x832b, 0x032e, 0x0324, 0x8321,
-  0x0360, 0x8365, 0x836f, 0x036a, 0x837b, 0x037e, 0x0374, 0x8371,
-  0x8353, 0x0356, 0x035c, 0x8359, 0x0348, 0x834d, 0x8347, 0x0342,
-  0x03c0, 0x83c5, 0x83cf, 0x03ca, 0x83db, 0x03de, 0x03d4, 0x83d1,
-  0x83f3, 0x03f6, 0x03fc, 0x83f9, 0x03e8, 0x83ed, 0x83e7, 0x03e2,
-  0x83a3, 0x03a6, 0x03ac, 0x83a9, 0x03b8, 0x83bd, 0x83b7, 0x03b2,
-  0x0390, 0x8395, 0x839f, 0x039a, 0x838b, 0x038e, 0x0384, 0x8381,
-  0x0280, 0x8285, 0x828f, 0x028a, 0x829b, 0x029e, 0x0294, 0x8291,
-  0x82b3, 0x02b6, 0x02bc, 0x82b9, 0x02a8, 0x82ad, 0x82a7, 0x02a2,
-  0x82e3, 0x02e6, 0x02ec, 0x82e9, 0x02f8, 0x82fd, 0x82f7, 0x02f2,
-  0x02d0, 0x82d5, 0x82df, 0x02da, 0x82cb, 0x02ce, 0x02c4, 0x82c1,
-  0x8243, 0x0246, 0x024c, 0x8249, 0x0258, 0x825d, 0x8257, 0x0252,
-  0x0270, 0x8275, 0x827f, 0x027a, 0x826b, 0x026e, 0x0264, 0x8261,
-  0x0220, 0x8225, 0x822f, 0x022a, 0x823b, 0x023e, 0x0234, 0x8231,
-  0x8213, 0x0216, 0x021c, 0x8219, 0x0208, 0x820d, 0x8207, 0x0202,
+MINIFLAC_PRIVATE
+uint64_t
+miniflac_unpack_uint64be(const uint8_t buffer[8]) {
+    return (
+      (((uint64_t)buffer[0]) << 56) |
+      (((uint64_t)buffer[1]) << 48) |
+      (((uint64_t)buffer[2]) << 40) |
+      (((uint64_t)buffer[3]) << 32) |
+      (((uint64_t)buffer[4]) << 24) |
+      (((uint64_t)buffer[5]) << 16) |
+      (((uint64_t)buffer[6]) << 8 ) |
+      (((uint64_t)buffer[7]) << 0 ));
+}
+
+#if defined(MINIFLAC_SIMD_X86) || defined(MINIFLAC_SIMD_NEON)
+/* set in the detected features once the CPU has been probed */
+#define MINIFLAC_CPU_DETECTED 0x80000000U
+
+/* the features, 0 until the first probe. Every probe comes up with the
+ * same value, so decoders set up on several threads at once just store
+ * it more than once - the atomics keep that from being a data race. */
+static uint32_t miniflac_cpu = 0;
+#endif
+
+#if defined(MINIFLAC_SIMD_X86)
+static
+uint32_t
+miniflac_cpu_detect_x86(void) {
+    unsigned int eax, ebx, ecx, edx;
+    unsigned int xcr0_lo, xcr0_hi;
+    uint32_t features = 0;
+
+    if(!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) return 0;
+
+    if(edx & bit_SSE2) features |= MINIFLAC_CPU_SSE2;
+    if(ecx & bit_SSE4_1) features |= MINIFLAC_CPU_SSE41;
+    if((ecx & bit_PCLMUL) && (ecx & bit_SSSE3)) features |= MINIFLAC_CPU_PCLMUL;
+
+    /* AVX2 also needs the OS to save the upper halves of the ymm registers */
+    if(!(ecx & bit_OSXSAVE) || !(ecx & bit_AVX)) return features;
+    __asm__ __volatile__("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+    (void)xcr0_hi;
+    if((xcr0_lo & 0x06) != 0x06) return features;
+
+    if(__get_cpuid_max(0, NULL) < 7) return features;
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+    if(ebx & bit_AVX2) features |= MINIFLAC_CPU_AVX2;
+
+    return features;
+}
+#endif
+
+#if defined(MINIFLAC_SIMD_X86) || defined(MINIFLAC_SIMD_NEON)
+static
+uint32_t
+miniflac_cpu_detect(void) {
+#if defined(MINIFLAC_SIMD_X86)
+    return miniflac_cpu_detect_x86();
+#else
+    /* NEON is mandatory on aarch64, and __ARM_NEON means the
+     * compiler was told it's present */
+    return MINIFLAC_CPU_NEON;
+#endif
+}
+#endif
+
+MINIFLAC_PRIVATE
+uint32_t
+miniflac_cpu_features(void) {
+#if defined(MINIFLAC_SIMD_X86) || defined(MINIFLAC_SIMD_NEON)
+    uint32_t features = __atomic_load_n(&miniflac_cpu,__ATOMIC_RELAXED);
+    if(features == 0) {
+        features = miniflac_cpu_detect() | MINIFLAC_CPU_DETECTED;
+        __atomic_store_n(&miniflac_cpu,features,__ATOMIC_RELAXED);
+    }
+    return features;
+#else
+    return 0;
+#endif
+}
+
+MINIFLAC_PRIVATE
+void
+miniflac_cpu_init(void) {
+#if defined(MINIFLAC_SIMD_X86) || defined(MINIFLAC_SIMD_NEON)
+    /* probe now rather than in the middle of the first frame */
+    (void)miniflac_cpu_features();
+#else
+    /* no kernels to pick from, nothing reads the result */
+    (void)miniflac_cpu_features;
+#endif
+}
+
+#define MINIFLAC_MD5_R1(x,y,z) ((z) ^ ((x) & ((y) ^ (z))))
+#define MINIFLAC_MD5_R2(x,y,z) ((y) ^ ((z) & ((x) ^ (y))))
+#define MINIFLAC_MD5_R3(x,y,z) ((x) ^ (y) ^ (z))
+#define MINIFLAC_MD5_R4(x,y,z) ((y) ^ ((x) | ~(z)))
+
+#define MINIFLAC_MD5_STEP(f,a,b,c,d,x,t,s) \
+    (a) += f((b),(c),(d)) + (x) + (uint32_t)(t); \
+    (a) = ((a) << (s)) | ((a) >> (32 - (s))); \
+    (a) += (b);
+
+static
+void
+miniflac_md5_compress(uint32_t* state, const uint32_t* x) {
+    uint32_t a = state[0];
+    uint32_t b = state[1];
+    uint32_t c = state[2];
+    uint32_t d = state[3];
+
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R1, a, b, c, d, x[ 0], 0xd76aa478,  7)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R1, d, a, b, c, x[ 1], 0xe8c7b756, 12)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R1, c, d, a, b, x[ 2], 0x242070db, 17)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R1, b, c, d, a, x[ 3], 0xc1bdceee, 22)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R1, a, b, c, d, x[ 4], 0xf57c0faf,  7)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R1, d, a, b, c, x[ 5], 0x4787c62a, 12)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R1, c, d, a, b, x[ 6], 0xa8304613, 17)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R1, b, c, d, a, x[ 7], 0xfd469501, 22)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R1, a, b, c, d, x[ 8], 0x698098d8,  7)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R1, d, a, b, c, x[ 9], 0x8b44f7af, 12)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R1, c, d, a, b, x[10], 0xffff5bb1, 17)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R1, b, c, d, a, x[11], 0x895cd7be, 22)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R1, a, b, c, d, x[12], 0x6b901122,  7)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R1, d, a, b, c, x[13], 0xfd987193, 12)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R1, c, d, a, b, x[14], 0xa679438e, 17)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R1, b, c, d, a, x[15], 0x49b40821, 22)
+
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R2, a, b, c, d, x[ 1], 0xf61e2562,  5)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R2, d, a, b, c, x[ 6], 0xc040b340,  9)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R2, c, d, a, b, x[11], 0x265e5a51, 14)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R2, b, c, d, a, x[ 0], 0xe9b6c7aa, 20)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R2, a, b, c, d, x[ 5], 0xd62f105d,  5)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R2, d, a, b, c, x[10], 0x02441453,  9)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R2, c, d, a, b, x[15], 0xd8a1e681, 14)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R2, b, c, d, a, x[ 4], 0xe7d3fbc8, 20)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R2, a, b, c, d, x[ 9], 0x21e1cde6,  5)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R2, d, a, b, c, x[14], 0xc33707d6,  9)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R2, c, d, a, b, x[ 3], 0xf4d50d87, 14)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R2, b, c, d, a, x[ 8], 0x455a14ed, 20)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R2, a, b, c, d, x[13], 0xa9e3e905,  5)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R2, d, a, b, c, x[ 2], 0xfcefa3f8,  9)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R2, c, d, a, b, x[ 7], 0x676f02d9, 14)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R2, b, c, d, a, x[12], 0x8d2a4c8a, 20)
+
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R3, a, b, c, d, x[ 5], 0xfffa3942,  4)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R3, d, a, b, c, x[ 8], 0x8771f681, 11)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R3, c, d, a, b, x[11], 0x6d9d6122, 16)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R3, b, c, d, a, x[14], 0xfde5380c, 23)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R3, a, b, c, d, x[ 1], 0xa4beea44,  4)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R3, d, a, b, c, x[ 4], 0x4bdecfa9, 11)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R3, c, d, a, b, x[ 7], 0xf6bb4b60, 16)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R3, b, c, d, a, x[10], 0xbebfbc70, 23)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R3, a, b, c, d, x[13], 0x289b7ec6,  4)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R3, d, a, b, c, x[ 0], 0xeaa127fa, 11)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R3, c, d, a, b, x[ 3], 0xd4ef3085, 16)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R3, b, c, d, a, x[ 6], 0x04881d05, 23)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R3, a, b, c, d, x[ 9], 0xd9d4d039,  4)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R3, d, a, b, c, x[12], 0xe6db99e5, 11)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R3, c, d, a, b, x[15], 0x1fa27cf8, 16)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R3, b, c, d, a, x[ 2], 0xc4ac5665, 23)
+
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R4, a, b, c, d, x[ 0], 0xf4292244,  6)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R4, d, a, b, c, x[ 7], 0x432aff97, 10)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R4, c, d, a, b, x[14], 0xab9423a7, 15)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R4, b, c, d, a, x[ 5], 0xfc93a039, 21)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R4, a, b, c, d, x[12], 0x655b59c3,  6)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R4, d, a, b, c, x[ 3], 0x8f0ccc92, 10)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R4, c, d, a, b, x[10], 0xffeff47d, 15)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R4, b, c, d, a, x[ 1], 0x85845dd1, 21)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R4, a, b, c, d, x[ 8], 0x6fa87e4f,  6)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R4, d, a, b, c, x[15], 0xfe2ce6e0, 10)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R4, c, d, a, b, x[ 6], 0xa3014314, 15)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R4, b, c, d, a, x[13], 0x4e0811a1, 21)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R4, a, b, c, d, x[ 4], 0xf7537e82,  6)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R4, d, a, b, c, x[11], 0xbd3af235, 10)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R4, c, d, a, b, x[ 2], 0x2ad7d2bb, 15)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R4, b, c, d, a, x[ 9], 0xeb86d391, 21)
+
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+}
+
+MINIFLAC_PRIVATE
+void
+miniflac_md5_init(miniflac_md5_t* md5) {
+    md5->state[0] = 0x67452301;
+    md5->state[1] = 0xefcdab89;
+    md5->state[2] = 0x98badcfe;
+    md5->state[3] = 0x10325476;
+    md5->length = 0;
+    md5->acc = 0;
+    md5->acc_bits = 0;
+    md5->words = 0;
+}
+
+static
+void
+miniflac_md5_word(miniflac_md5_t* md5, uint32_t word) {
+    md5->block[md5->words++] = word;
+    if(md5->words == 16) {
+        miniflac_md5_compress(md5->state,md5->block);
+        md5->words = 0;
+    }
+}
+
+/* MD5 reads its input as little-endian words, so packing each sample
+ * into the low end of acc and taking 32 bits at a time builds the
+ * words in the right order on any host, without an interleaved byte
+ * buffer in between */
+MINIFLAC_PRIVATE
+void
+miniflac_md5_samples(miniflac_md5_t* md5, int32_t** samples, uint8_t channels, uint32_t block_size, uint8_t bps) {
+    uint8_t bits = (uint8_t)(((bps + 7) / 8) * 8);
+    uint32_t mask = bits == 32 ? 0xFFFFFFFF : ((uint32_t)1 << bits) - 1;
+    uint64_t acc = md5->acc;
+    uint8_t acc_bits = md5->acc_bits;
+    uint32_t i = 0;
+    uint8_t c;
+
+    md5->length += (uint64_t)block_size * channels * (bits / 8);
+
+    /* 16-bit stereo is one word per sample, whole blocks are packed
+     * and compressed without going through miniflac_md5_word */
+    if(bits == 16 && channels == 2 && acc_bits == 0) {
+        while(md5->words != 0 && i < block_size) {
+            miniflac_md5_word(md5,((uint32_t)samples[0][i] & 0xFFFF) | ((uint32_t)samples[1][i] << 16));
+            i++;
+        }
+        for(; i + 16 <= block_size; i += 16) {
+            for(c = 0; c < 16; c++) {
+                md5->block[c] = ((uint32_t)samples[0][i + c] & 0xFFFF) | ((uint32_t)samples[1][i + c] << 16);
+            }
+            miniflac_md5_compress(md5->state,md5->block);
+        }
+    }
+
+    for(; i < block_size; i++) {
+        for(c = 0; c < channels; c++) {
+            acc |= ((uint64_t)((uint32_t)samples[c][i] & mask)) << acc_bits;
+            acc_bits += bits;
+            if(acc_bits >= 32) {
+                miniflac_md5_word(md5,(uint32_t)acc);
+                acc >>= 32;
+                acc_bits -= 32;
+            }
+        }
+    }
+
+    md5->acc = acc;
+    md5->acc_bits = acc_bits;
+}
+
+MINIFLAC_PRIVATE
+void
+miniflac_md5_final(miniflac_md5_t* md5, uint8_t* digest) {
+    uint64_t length = md5->length * 8;
+    uint8_t i;
+
+    /* a single 1 bit, then zeros up to the length */
+    md5->acc |= ((uint64_t)0x80) << md5->acc_bits;
+    miniflac_md5_word(md5,(uint32_t)md5->acc);
+    md5->acc = 0;
+    md5->acc_bits = 0;
+
+    while(md5->words != 14) {
+        miniflac_md5_word(md5,0);
+    }
+    miniflac_md5_word(md5,(uint32_t)length);
+    miniflac_md5_word(md5,(uint32_t)(length >> 32));
+
+    for(i = 0; i < 16; i++) {
+        digest[i] = (uint8_t)(md5->state[i / 4] >> ((i % 4) * 8));
+    }
+}
+
+/* frame headers are at most 16 bytes, so crc8 only needs to cover
+ * the first 16 bytes after a reset */
+#define MINIFLAC_CRC8_LEN 16
+
+#if defined(__GNUC__) || defined(__clang__)
+#define MINIFLAC_CLZ64(x) __builtin_clzll(x)
+#else
+#define MINIFLAC_CLZ64(x) miniflac_clz64(x)
+static
+uint8_t
+miniflac_clz64(uint64_t x) {
+    uint8_t n = 0;
+    if(x <= 0x00000000FFFFFFFF) { n += 32; x <<= 32; }
+    if(x <= 0x0000FFFFFFFFFFFF) { n += 16; x <<= 16; }
+    if(x <= 0x00FFFFFFFFFFFFFF) { n +=  8; x <<=  8; }
+    if(x <= 0x0FFFFFFFFFFFFFFF) { n +=  4; x <<=  4; }
+    if(x <= 0x3FFFFFFFFFFFFFFF) { n +=  2; x <<=  2; }
+    if(x <= 0x7FFFFFFFFFFFFFFF) { n +=  1; }
+    return n;
+}
+#endif
+
+static const uint8_t miniflac_crc8_table[256] = {
+  0x00, 0x07, 0x0e, 0x09, 0x1c, 0x1b, 0x12, 0x15,
+  0x38, 0x3f, 0x36, 0x31, 0x24, 0x23, 0x2a, 0x2d,
+  0x70, 0x77, 0x7e, 0x79, 0x6c, 0x6b, 0x62, 0x65,
+  0x48, 0x4f, 0x46, 0x41, 0x54, 0x53, 0x5a, 0x5d,
+  0xe0, 0xe7, 0xee, 0xe9, 0xfc, 0xfb, 0xf2, 0xf5,
+  0xd8, 0xdf, 0xd6, 0xd1, 0xc4, 0xc3, 0xca, 0xcd,
+  0x90, 0x97, 0x9e, 0x99, 0x8c, 0x8b, 0x82, 0x85,
+  0xa8, 0xaf, 0xa6, 0xa1, 0xb4, 0xb3, 0xba, 0xbd,
+  0xc7, 0xc0, 0xc9, 0xce, 0xdb, 0xdc, 0xd5, 0xd2,
+  0xff, 0xf8, 0xf1, 0xf6, 0xe3, 0xe4, 0xed, 0xea,
+  0xb7, 0xb0, 0xb9, 0xbe, 0xab, 0xac, 0xa5, 0xa2,
+  0x8f, 0x88, 0x81, 0x86, 0x93, 0x94, 0x9d, 0x9a,
+  0x27, 0x20, 0x29, 0x2e, 0x3b, 0x3c, 0x35, 0x32,
+  0x1f, 0x18, 0x11, 0x16, 0x03, 0x04, 0x0d, 0x0a,
+  0x57, 0x50, 0x59, 0x5e, 0x4b, 0x4c, 0x45, 0x42,
+  0x6f, 0x68, 0x61, 0x66, 0x73, 0x74, 0x7d, 0x7a,
+  0x89, 0x8e, 0x87, 0x80, 0x95, 0x92, 0x9b, 0x9c,
+  0xb1, 0xb6, 0xbf, 0xb8, 0xad, 0xaa, 0xa3, 0xa4,
+  0xf9, 0xfe, 0xf7, 0xf0, 0xe5, 0xe2, 0xeb, 0xec,
+  0xc1, 0xc6, 0xcf, 0xc8, 0xdd, 0xda, 0xd3, 0xd4,
+  0x69, 0x6e, 0x67, 0x60, 0x75, 0x72, 0x7b, 0x7c,
+  0x51, 0x56, 0x5f, 0x58, 0x4d, 0x4a, 0x43, 0x44,
+  0x19, 0x1e, 0x17, 0x10, 0x05, 0x02, 0x0b, 0x0c,
+  0x21, 0x26, 0x2f, 0x28, 0x3d, 0x3a, 0x33, 0x34,
+  0x4e, 0x49, 0x40, 0x47, 0x52, 0x55, 0x5c, 0x5b,
+  0x76, 0x71, 0x78, 0x7f, 0x6a, 0x6d, 0x64, 0x63,
+  0x3e, 0x39, 0x30, 0x37, 0x22, 0x25, 0x2c, 0x2b,
+  0x06, 0x01, 0x08, 0x0f, 0x1a, 0x1d, 0x14, 0x13,
+  0xae, 0xa9, 0xa0, 0xa7, 0xb2, 0xb5, 0xbc, 0xbb,
+  0x96, 0x91, 0x98, 0x9f, 0x8a, 0x8d, 0x84, 0x83,
+  0xde, 0xd9, 0xd0, 0xd7, 0xc2, 0xc5, 0xcc, 0xcb,
+  0xe6, 0xe1, 0xe8, 0xef, 0xfa, 0xfd, 0xf4, 0xf3,
+};
+
+/* slice-by-8 tables, miniflac_crc16_table[n][b] is the crc of byte b
+ * followed by n zero bytes */
+static const uint16_t miniflac_crc16_table[8][256] = {
+  {
+    0x0000, 0x8005, 0x800f, 0x000a, 0x801b, 0x001e, 0x0014, 0x8011,
+    0x8033, 0x0036, 0x003c, 0x8039, 0x0028, 0x802d, 0x8027, 0x0022,
+    0x8063, 0x0066, 0x006c, 0x8069, 0x0078, 0x807d, 0x8077, 0x0072,
+    0x0050, 0x8055, 0x805f, 0x005a, 0x804b, 0x004e, 0x0044, 0x8041,
+    0x80c3, 0x00c6, 0x00cc, 0x80c9, 0x00d8, 0x80dd, 0x80d7, 0x00d2,
+    0x00f0, 0x80f5, 0x80ff, 0x00fa, 0x80eb, 0x00ee, 0x00e4, 0x80e1,
+    0x00a0, 0x80a5, 0x80af, 0x00aa, 0x80bb, 0x00be, 0x00b4, 0x80b1,
+    0x8093, 0x0096, 0x009c, 0x8099, 0x0088, 0x808d, 0x8087, 0x0082,
+    0x8183, 0x0186, 0x018c, 0x8189, 0x0198, 0x819d, 0x8197, 0x0192,
+    0x01b0, 0x81b5, 0x81bf, 0x01ba, 0x81ab, 0x01ae, 0x01a4, 0x81a1,
+    0x01e0, 0x81e5, 0x81ef, 0x01ea, 0x81fb, 0x01fe, 0x01f4, 0x81f1,
+    0x81d3, 0x01d6, 0x01dc, 0x81d9, 0x01c8, 0x81cd, 0x81c7, 0x01c2,
+    0x0140, 0x8145, 0x814f, 0x014a, 0x815b, 0x015e, 0x0154, 0x8151,
+    0x8173, 0x0176, 0x017c, 0x8179, 0x0168, 0x816d, 0x8167, 0x0162,
+    0x8123, 0x0126, 0x012c, 0x8129, 0x0138, 0x813d, 0x8137, 0x0132,
+    0x0110, 0x8115, 0x811f, 0x011a, 0x810b, 0x010e, 0x0104, 0x8101,
+    0x8303, 0x0306, 0x030c, 0x8309, 0x0318, 0x831d, 0x8317, 0x0312,
+    0x0330, 0x8335, 0x833f, 0x033a, 0x832b, 0x032e, 0x0324, 0x8321,
+    0x0360, 0x8365, 0x836f, 0x036a, 0x837b, 0x037e, 0x0374, 0x8371,
+    0x8353, 0x0356, 0x035c, 0x8359, 0x0348, 0x834d, 0x8347, 0x0342,
+    0x03c0, 0x83c5, 0x83cf, 0x03ca, 0x83db, 0x03de, 0x03d4, 0x83d1,
+    0x83f3, 0x03f6, 0x03fc, 0x83f9, 0x03e8, 0x83ed, 0x83e7, 0x03e2,
+    0x83a3, 0x03a6, 0x03ac, 0x83a9, 0x03b8, 0x83bd, 0x83b7, 0x03b2,
+    0x0390, 0x8395, 0x839f, 0x039a, 0x838b, 0x038e, 0x0384, 0x8381,
+    0x0280, 0x8285, 0x828f, 0x028a, 0x829b, 0x029e, 0x0294, 0x8291,
+    0x82b3, 0x02b6, 0x02bc, 0x82b9, 0x02a8, 0x82ad, 0x82a7, 0x02a2,
+    0x82e3, 0x02e6, 0x02ec, 0x82e9, 0x02f8, 0x82fd, 0x82f7, 0x02f2,
+    0x02d0, 0x82d5, 0x82df, 0x02da, 0x82cb, 0x02ce, 0x02c4, 0x82c1,
+    0x8243, 0x0246, 0x024c, 0x8249, 0x0258, 0x825d, 0x8257, 0x0252,
+    0x0270, 0x8275, 0x827f, 0x027a, 0x826b, 0x026e, 0x0264, 0x8261,
+    0x0220, 0x8225, 0x822f, 0x022a, 0x823b, 0x023e, 0x0234, 0x8231,
+    0x8213, 0x0216, 0x021c, 0x8219, 0x0208, 0x820d, 0x8207, 0x0202,
+  },
+  {
+    0x0000, 0x8603, 0x8c03, 0x0a00, 0x9803, 0x1e00, 0x1400, 0x9203,
+    0xb003, 0x3600, 0x3c00, 0xba03, 0x2800, 0xae03, 0xa403, 0x2200,
+    0xe003, 0x6600, 0x6c00, 0xea03, 0x7800, 0xfe03, 0xf403, 0x7200,
+    0x5000, 0xd603, 0xdc03, 0x5a00, 0xc803, 0x4e00, 0x4400, 0xc203,
+    0x4003, 0xc600, 0xcc00, 0x4a03, 0xd800, 0x5e03, 0x5403, 0xd200,
+    0xf000, 0x7603, 0x7c03, 0xfa00, 0x6803, 0xee00, 0xe400, 0x6203,
+    0xa000, 0x2603, 0x2c03, 0xaa00, 0x3803, 0xbe00, 0xb400, 0x3203,
+    0x1003, 0x9600, 0x9c00, 0x1a03, 0x8800, 0x0e03, 0x0403, 0x8200,
+    0x8006, 0x0605, 0x0c05, 0x8a06, 0x1805, 0x9e06, 0x9406, 0x1205,
+    0x3005, 0xb606, 0xbc06, 0x3a05, 0xa806, 0x2e05, 0x2405, 0xa206,
+    0x6005, 0xe606, 0xec06, 0x6a05, 0xf806, 0x7e05, 0x7405, 0xf206,
+    0xd006, 0x5605, 0x5c05, 0xda06, 0x4805, 0xce06, 0xc406, 0x4205,
+    0xc005, 0x4606, 0x4c06, 0xca05, 0x5806, 0xde05, 0xd405, 0x5206,
+    0x7006, 0xf605, 0xfc05, 0x7a06, 0xe805, 0x6e06, 0x6406, 0xe205,
+    0x2006, 0xa605, 0xac05, 0x2a06, 0xb805, 0x3e06, 0x3406, 0xb205,
+    0x9005, 0x1606, 0x1c06, 0x9a05, 0x0806, 0x8e05, 0x8405, 0x0206,
+    0x8009, 0x060a, 0x0c0a, 0x8a09, 0x180a, 0x9e09, 0x9409, 0x120a,
+    0x300a, 0xb609, 0xbc09, 0x3a0a, 0xa809, 0x2e0a, 0x240a, 0xa209,
+    0x600a, 0xe609, 0xec09, 0x6a0a, 0xf809, 0x7e0a, 0x740a, 0xf209,
+    0xd009, 0x560a, 0x5c0a, 0xda09, 0x480a, 0xce09, 0xc409, 0x420a,
+    0xc00a, 0x4609, 0x4c09, 0xca0a, 0x5809, 0xde0a, 0xd40a, 0x5209,
+    0x7009, 0xf60a, 0xfc0a, 0x7a09, 0xe80a, 0x6e09, 0x6409, 0xe20a,
+    0x2009, 0xa60a, 0xac0a, 0x2a09, 0xb80a, 0x3e09, 0x3409, 0xb20a,
+    0x900a, 0x1609, 0x1c09, 0x9a0a, 0x0809, 0x8e0a, 0x840a, 0x0209,
+    0x000f, 0x860c, 0x8c0c, 0x0a0f, 0x980c, 0x1e0f, 0x140f, 0x920c,
+    0xb00c, 0x360f, 0x3c0f, 0xba0c, 0x280f, 0xae0c, 0xa40c, 0x220f,
+    0xe00c, 0x660f, 0x6c0f, 0xea0c, 0x780f, 0xfe0c, 0xf40c, 0x720f,
+    0x500f, 0xd60c, 0xdc0c, 0x5a0f, 0xc80c, 0x4e0f, 0x440f, 0xc20c,
+    0x400c, 0xc60f, 0xcc0f, 0x4a0c, 0xd80f, 0x5e0c, 0x540c, 0xd20f,
+    0xf00f, 0x760c, 0x7c0c, 0xfa0f, 0x680c, 0xee0f, 0xe40f, 0x620c,
+    0xa00f, 0x260c, 0x2c0c, 0xaa0f, 0x380c, 0xbe0f, 0xb40f, 0x320c,
+    0x100c, 0x960f, 0x9c0f, 0x1a0c, 0x880f, 0x0e0c, 0x040c, 0x820f,
+  },
+  {
+    0x0000, 0x8017, 0x802b, 0x003c, 0x8053, 0x0044, 0x0078, 0x806f,
+    0x80a3, 0x00b4, 0x0088, 0x809f, 0x00f0, 0x80e7, 0x80db, 0x00cc,
+    0x8143, 0x0154, 0x0168, 0x817f, 0x0110, 0x8107, 0x813b, 0x012c,
+    0x01e0, 0x81f7, 0x81cb, 0x01dc, 0x81b3, 0x01a4, 0x0198, 0x818f,
+    0x8283, 0x0294, 0x02a8, 0x82bf, 0x02d0, 0x82c7, 0x82fb, 0x02ec,
+    0x0220, 0x8237, 0x820b, 0x021c, 0x8273, 0x0264, 0x0258, 0x824f,
+    0x03c0, 0x83d7, 0x83eb, 0x03fc, 0x8393, 0x0384, 0x03b8, 0x83af,
+    0x8363, 0x0374, 0x0348, 0x835f, 0x0330, 0x8327, 0x831b, 0x030c,
+    0x8503, 0x0514, 0x0528, 0x853f, 0x0550, 0x8547, 0x857b, 0x056c,
+    0x05a0, 0x85b7, 0x858b, 0x059c, 0x85f3, 0x05e4, 0x05d8, 0x85cf,
+    0x0440, 0x8457, 0x846b, 0x047c, 0x8413, 0x0404, 0x0438, 0x842f,
+    0x84e3, 0x04f4, 0x04c8, 0x84df, 0x04b0, 0x84a7, 0x849b, 0x048c,
+    0x0780, 0x8797, 0x87ab, 0x07bc, 0x87d3, 0x07c4, 0x07f8, 0x87ef,
+    0x8723, 0x0734, 0x0708, 0x871f, 0x0770, 0x8767, 0x875b, 0x074c,
+    0x86c3, 0x06d4, 0x06e8, 0x86ff, 0x0690, 0x8687, 0x86bb, 0x06ac,
+    0x0660, 0x8677, 0x864b, 0x065c, 0x8633, 0x0624, 0x0618, 0x860f,
+    0x8a03, 0x0a14, 0x0a28, 0x8a3f, 0x0a50, 0x8a47, 0x8a7b, 0x0a6c,
+    0x0aa0, 0x8ab7, 0x8a8b, 0x0a9c, 0x8af3, 0x0ae4, 0x0ad8, 0x8acf,
+    0x0b40, 0x8b57, 0x8b6b, 0x0b7c, 0x8b13, 0x0b04, 0x0b38, 0x8b2f,
+    0x8be3, 0x0bf4, 0x0bc8, 0x8bdf, 0x0bb0, 0x8ba7, 0x8b9b, 0x0b8c,
+    0x0880, 0x8897, 0x88ab, 0x08bc, 0x88d3, 0x08c4, 0x08f8, 0x88ef,
+    0x8823, 0x0834, 0x0808, 0x881f, 0x0870, 0x8867, 0x885b, 0x084c,
+    0x89c3, 0x09d4, 0x09e8, 0x89ff, 0x0990, 0x8987, 0x89bb, 0x09ac,
+    0x0960, 0x8977, 0x894b, 0x095c, 0x8933, 0x0924, 0x0918, 0x890f,
+    0x0f00, 0x8f17, 0x8f2b, 0x0f3c, 0x8f53, 0x0f44, 0x0f78, 0x8f6f,
+    0x8fa3, 0x0fb4, 0x0f88, 0x8f9f, 0x0ff0, 0x8fe7, 0x8fdb, 0x0fcc,
+    0x8e43, 0x0e54, 0x0e68, 0x8e7f, 0x0e10, 0x8e07, 0x8e3b, 0x0e2c,
+    0x0ee0, 0x8ef7, 0x8ecb, 0x0edc, 0x8eb3, 0x0ea4, 0x0e98, 0x8e8f,
+    0x8d83, 0x0d94, 0x0da8, 0x8dbf, 0x0dd0, 0x8dc7, 0x8dfb, 0x0dec,
+    0x0d20, 0x8d37, 0x8d0b, 0x0d1c, 0x8d73, 0x0d64, 0x0d58, 0x8d4f,
+    0x0cc0, 0x8cd7, 0x8ceb, 0x0cfc, 0x8c93, 0x0c84, 0x0cb8, 0x8caf,
+    0x8c63, 0x0c74, 0x0c48, 0x8c5f, 0x0c30, 0x8c27, 0x8c1b, 0x0c0c,
+  },
+  {
+    0x0000, 0x9403, 0xa803, 0x3c00, 0xd003, 0x4400, 0x7800, 0xec03,
+    0x2003, 0xb400, 0x8800, 0x1c03, 0xf000, 0x6403, 0x5803, 0xcc00,
+    0x4006, 0xd405, 0xe805, 0x7c06, 0x9005, 0x0406, 0x3806, 0xac05,
+    0x6005, 0xf406, 0xc806, 0x5c05, 0xb006, 0x2405, 0x1805, 0x8c06,
+    0x800c, 0x140f, 0x280f, 0xbc0c, 0x500f, 0xc40c, 0xf80c, 0x6c0f,
+    0xa00f, 0x340c, 0x080c, 0x9c0f, 0x700c, 0xe40f, 0xd80f, 0x4c0c,
+    0xc00a, 0x5409, 0x6809, 0xfc0a, 0x1009, 0x840a, 0xb80a, 0x2c09,
+    0xe009, 0x740a, 0x480a, 0xdc09, 0x300a, 0xa409, 0x9809, 0x0c0a,
+    0x801d, 0x141e, 0x281e, 0xbc1d, 0x501e, 0xc41d, 0xf81d, 0x6c1e,
+    0xa01e, 0x341d, 0x081d, 0x9c1e, 0x701d, 0xe41e, 0xd81e, 0x4c1d,
+    0xc01b, 0x5418, 0x6818, 0xfc1b, 0x1018, 0x841b, 0xb81b, 0x2c18,
+    0xe018, 0x741b, 0x481b, 0xdc18, 0x301b, 0xa418, 0x9818, 0x0c1b,
+    0x0011, 0x9412, 0xa812, 0x3c11, 0xd012, 0x4411, 0x7811, 0xec12,
+    0x2012, 0xb411, 0x8811, 0x1c12, 0xf011, 0x6412, 0x5812, 0xcc11,
+    0x4017, 0xd414, 0xe814, 0x7c17, 0x9014, 0x0417, 0x3817, 0xac14,
+    0x6014, 0xf417, 0xc817, 0x5c14, 0xb017, 0x2414, 0x1814, 0x8c17,
+    0x803f, 0x143c, 0x283c, 0xbc3f, 0x503c, 0xc43f, 0xf83f, 0x6c3c,
+    0xa03c, 0x343f, 0x083f, 0x9c3c, 0x703f, 0xe43c, 0xd83c, 0x4c3f,
+    0xc039, 0x543a, 0x683a, 0xfc39, 0x103a, 0x8439, 0xb839, 0x2c3a,
+    0xe03a, 0x7439, 0x4839, 0xdc3a, 0x3039, 0xa43a, 0x983a, 0x0c39,
+    0x0033, 0x9430, 0xa830, 0x3c33, 0xd030, 0x4433, 0x7833, 0xec30,
+    0x2030, 0xb433, 0x8833, 0x1c30, 0xf033, 0x6430, 0x5830, 0xcc33,
+    0x4035, 0xd436, 0xe836, 0x7c35, 0x9036, 0x0435, 0x3835, 0xac36,
+    0x6036, 0xf435, 0xc835, 0x5c36, 0xb035, 0x2436, 0x1836, 0x8c35,
+    0x0022, 0x9421, 0xa821, 0x3c22, 0xd021, 0x4422, 0x7822, 0xec21,
+    0x2021, 0xb422, 0x8822, 0x1c21, 0xf022, 0x6421, 0x5821, 0xcc22,
+    0x4024, 0xd427, 0xe827, 0x7c24, 0x9027, 0x0424, 0x3824, 0xac27,
+    0x6027, 0xf424, 0xc824, 0x5c27, 0xb024, 0x2427, 0x1827, 0x8c24,
+    0x802e, 0x142d, 0x282d, 0xbc2e, 0x502d, 0xc42e, 0xf82e, 0x6c2d,
+    0xa02d, 0x342e, 0x082e, 0x9c2d, 0x702e, 0xe42d, 0xd82d, 0x4c2e,
+    0xc028, 0x542b, 0x682b, 0xfc28, 0x102b, 0x8428, 0xb828, 0x2c2b,
+    0xe02b, 0x7428, 0x4828, 0xdc2b, 0x3028, 0xa42b, 0x982b, 0x0c28,
+  },
+  {
+    0x0000, 0x807b, 0x80f3, 0x0088, 0x81e3, 0x0198, 0x0110, 0x816b,
+    0x83c3, 0x03b8, 0x0330, 0x834b, 0x0220, 0x825b, 0x82d3, 0x02a8,
+    0x8783, 0x07f8, 0x0770, 0x870b, 0x0660, 0x861b, 0x8693, 0x06e8,
+    0x0440, 0x843b, 0x84b3, 0x04c8, 0x85a3, 0x05d8, 0x0550, 0x852b,
+    0x8f03, 0x0f78, 0x0ff0, 0x8f8b, 0x0ee0, 0x8e9b, 0x8e13, 0x0e68,
+    0x0cc0, 0x8cbb, 0x8c33, 0x0c48, 0x8d23, 0x0d58, 0x0dd0, 0x8dab,
+    0x0880, 0x88fb, 0x8873, 0x0808, 0x8963, 0x0918, 0x0990, 0x89eb,
+    0x8b43, 0x0b38, 0x0bb0, 0x8bcb, 0x0aa0, 0x8adb, 0x8a53, 0x0a28,
+    0x9e03, 0x1e78, 0x1ef0, 0x9e8b, 0x1fe0, 0x9f9b, 0x9f13, 0x1f68,
+    0x1dc0, 0x9dbb, 0x9d33, 0x1d48, 0x9c23, 0x1c58, 0x1cd0, 0x9cab,
+    0x1980, 0x99fb, 0x9973, 0x1908, 0x9863, 0x1818, 0x1890, 0x98eb,
+    0x9a43, 0x1a38, 0x1ab0, 0x9acb, 0x1ba0, 0x9bdb, 0x9b53, 0x1b28,
+    0x1100, 0x917b, 0x91f3, 0x1188, 0x90e3, 0x1098, 0x1010, 0x906b,
+    0x92c3, 0x12b8, 0x1230, 0x924b, 0x1320, 0x935b, 0x93d3, 0x13a8,
+    0x9683, 0x16f8, 0x1670, 0x960b, 0x1760, 0x971b, 0x9793, 0x17e8,
+    0x1540, 0x953b, 0x95b3, 0x15c8, 0x94a3, 0x14d8, 0x1450, 0x942b,
+    0xbc03, 0x3c78, 0x3cf0, 0xbc8b, 0x3de0, 0xbd9b, 0xbd13, 0x3d68,
+    0x3fc0, 0xbfbb, 0xbf33, 0x3f48, 0xbe23, 0x3e58, 0x3ed0, 0xbeab,
+    0x3b80, 0xbbfb, 0xbb73, 0x3b08, 0xba63, 0x3a18, 0x3a90, 0xbaeb,
+    0xb843, 0x3838, 0x38b0, 0xb8cb, 0x39a0, 0xb9db, 0xb953, 0x3928,
+    0x3300, 0xb37b, 0xb3f3, 0x3388, 0xb2e3, 0x3298, 0x3210, 0xb26b,
+    0xb0c3, 0x30b8, 0x3030, 0xb04b, 0x3120, 0xb15b, 0xb1d3, 0x31a8,
+    0xb483, 0x34f8, 0x3470, 0xb40b, 0x3560, 0xb51b, 0xb593, 0x35e8,
+    0x3740, 0xb73b, 0xb7b3, 0x37c8, 0xb6a3, 0x36d8, 0x3650, 0xb62b,
+    0x2200, 0xa27b, 0xa2f3, 0x2288, 0xa3e3, 0x2398, 0x2310, 0xa36b,
+    0xa1c3, 0x21b8, 0x2130, 0xa14b, 0x2020, 0xa05b, 0xa0d3, 0x20a8,
+    0xa583, 0x25f8, 0x2570, 0xa50b, 0x2460, 0xa41b, 0xa493, 0x24e8,
+    0x2640, 0xa63b, 0xa6b3, 0x26c8, 0xa7a3, 0x27d8, 0x2750, 0xa72b,
+    0xad03, 0x2d78, 0x2df0, 0xad8b, 0x2ce0, 0xac9b, 0xac13, 0x2c68,
+    0x2ec0, 0xaebb, 0xae33, 0x2e48, 0xaf23, 0x2f58, 0x2fd0, 0xafab,
+    0x2a80, 0xaafb, 0xaa73, 0x2a08, 0xab63, 0x2b18, 0x2b90, 0xabeb,
+    0xa943, 0x2938, 0x29b0, 0xa9cb, 0x28a0, 0xa8db, 0xa853, 0x2828,
+  },
+  {
+    0x0000, 0xf803, 0x7003, 0x8800, 0xe006, 0x1805, 0x9005, 0x6806,
+    0x4009, 0xb80a, 0x300a, 0xc809, 0xa00f, 0x580c, 0xd00c, 0x280f,
+    0x8012, 0x7811, 0xf011, 0x0812, 0x6014, 0x9817, 0x1017, 0xe814,
+    0xc01b, 0x3818, 0xb018, 0x481b, 0x201d, 0xd81e, 0x501e, 0xa81d,
+    0x8021, 0x7822, 0xf022, 0x0821, 0x6027, 0x9824, 0x1024, 0xe827,
+    0xc028, 0x382b, 0xb02b, 0x4828, 0x202e, 0xd82d, 0x502d, 0xa82e,
+    0x0033, 0xf830, 0x7030, 0x8833, 0xe035, 0x1836, 0x9036, 0x6835,
+    0x403a, 0xb839, 0x3039, 0xc83a, 0xa03c, 0x583f, 0xd03f, 0x283c,
+    0x8047, 0x7844, 0xf044, 0x0847, 0x6041, 0x9842, 0x1042, 0xe841,
+    0xc04e, 0x384d, 0xb04d, 0x484e, 0x2048, 0xd84b, 0x504b, 0xa848,
+    0x0055, 0xf856, 0x7056, 0x8855, 0xe053, 0x1850, 0x9050, 0x6853,
+    0x405c, 0xb85f, 0x305f, 0xc85c, 0xa05a, 0x5859, 0xd059, 0x285a,
+    0x0066, 0xf865, 0x7065, 0x8866, 0xe060, 0x1863, 0x9063, 0x6860,
+    0x406f, 0xb86c, 0x306c, 0xc86f, 0xa069, 0x586a, 0xd06a, 0x2869,
+    0x8074, 0x7877, 0xf077, 0x0874, 0x6072, 0x9871, 0x1071, 0xe872,
+    0xc07d, 0x387e, 0xb07e, 0x487d, 0x207b, 0xd878, 0x5078, 0xa87b,
+    0x808b, 0x7888, 0xf088, 0x088b, 0x608d, 0x988e, 0x108e, 0xe88d,
+    0xc082, 0x3881, 0xb081, 0x4882, 0x2084, 0xd887, 0x5087, 0xa884,
+    0x0099, 0xf89a, 0x709a, 0x8899, 0xe09f, 0x189c, 0x909c, 0x689f,
+    0x4090, 0xb893, 0x3093, 0xc890, 0xa096, 0x5895, 0xd095, 0x2896,
+    0x00aa, 0xf8a9, 0x70a9, 0x88aa, 0xe0ac, 0x18af, 0x90af, 0x68ac,
+    0x40a3, 0xb8a0, 0x30a0, 0xc8a3, 0xa0a5, 0x58a6, 0xd0a6, 0x28a5,
+    0x80b8, 0x78bb, 0xf0bb, 0x08b8, 0x60be, 0x98bd, 0x10bd, 0xe8be,
+    0xc0b1, 0x38b2, 0xb0b2, 0x48b1, 0x20b7, 0xd8b4, 0x50b4, 0xa8b7,
+    0x00cc, 0xf8cf, 0x70cf, 0x88cc, 0xe0ca, 0x18c9, 0x90c9, 0x68ca,
+    0x40c5, 0xb8c6, 0x30c6, 0xc8c5, 0xa0c3, 0x58c0, 0xd0c0, 0x28c3,
+    0x80de, 0x78dd, 0xf0dd, 0x08de, 0x60d8, 0x98db, 0x10db, 0xe8d8,
+    0xc0d7, 0x38d4, 0xb0d4, 0x48d7, 0x20d1, 0xd8d2, 0x50d2, 0xa8d1,
+    0x80ed, 0x78ee, 0xf0ee, 0x08ed, 0x60eb, 0x98e8, 0x10e8, 0xe8eb,
+    0xc0e4, 0x38e7, 0xb0e7, 0x48e4, 0x20e2, 0xd8e1, 0x50e1, 0xa8e2,
+    0x00ff, 0xf8fc, 0x70fc, 0x88ff, 0xe0f9, 0x18fa, 0x90fa, 0x68f9,
+    0x40f6, 0xb8f5, 0x30f5, 0xc8f6, 0xa0f0, 0x58f3, 0xd0f3, 0x28f0,
+  },
+  {
+    0x0000, 0x8113, 0x8223, 0x0330, 0x8443, 0x0550, 0x0660, 0x8773,
+    0x8883, 0x0990, 0x0aa0, 0x8bb3, 0x0cc0, 0x8dd3, 0x8ee3, 0x0ff0,
+    0x9103, 0x1010, 0x1320, 0x9233, 0x1540, 0x9453, 0x9763, 0x1670,
+    0x1980, 0x9893, 0x9ba3, 0x1ab0, 0x9dc3, 0x1cd0, 0x1fe0, 0x9ef3,
+    0xa203, 0x2310, 0x2020, 0xa133, 0x2640, 0xa753, 0xa463, 0x2570,
+    0x2a80, 0xab93, 0xa8a3, 0x29b0, 0xaec3, 0x2fd0, 0x2ce0, 0xadf3,
+    0x3300, 0xb213, 0xb123, 0x3030, 0xb743, 0x3650, 0x3560, 0xb473,
+    0xbb83, 0x3a90, 0x39a0, 0xb8b3, 0x3fc0, 0xbed3, 0xbde3, 0x3cf0,
+    0xc403, 0x4510, 0x4620, 0xc733, 0x4040, 0xc153, 0xc263, 0x4370,
+    0x4c80, 0xcd93, 0xcea3, 0x4fb0, 0xc8c3, 0x49d0, 0x4ae0, 0xcbf3,
+    0x5500, 0xd413, 0xd723, 0x5630, 0xd143, 0x5050, 0x5360, 0xd273,
+    0xdd83, 0x5c90, 0x5fa0, 0xdeb3, 0x59c0, 0xd8d3, 0xdbe3, 0x5af0,
+    0x6600, 0xe713, 0xe423, 0x6530, 0xe243, 0x6350, 0x6060, 0xe173,
+    0xee83, 0x6f90, 0x6ca0, 0xedb3, 0x6ac0, 0xebd3, 0xe8e3, 0x69f0,
+    0xf703, 0x7610, 0x7520, 0xf433, 0x7340, 0xf253, 0xf163, 0x7070,
+    0x7f80, 0xfe93, 0xfda3, 0x7cb0, 0xfbc3, 0x7ad0, 0x79e0, 0xf8f3,
+    0x0803, 0x8910, 0x8a20, 0x0b33, 0x8c40, 0x0d53, 0x0e63, 0x8f70,
+    0x8080, 0x0193, 0x02a3, 0x83b0, 0x04c3, 0x85d0, 0x86e0, 0x07f3,
+    0x9900, 0x1813, 0x1b23, 0x9a30, 0x1d43, 0x9c50, 0x9f60, 0x1e73,
+    0x1183, 0x9090, 0x93a0, 0x12b3, 0x95c0, 0x14d3, 0x17e3, 0x96f0,
+    0xaa00, 0x2b13, 0x2823, 0xa930, 0x2e43, 0xaf50, 0xac60, 0x2d73,
+    0x2283, 0xa390, 0xa0a0, 0x21b3, 0xa6c0, 0x27d3, 0x24e3, 0xa5f0,
+    0x3b03, 0xba10, 0xb920, 0x3833, 0xbf40, 0x3e53, 0x3d63, 0xbc70,
+    0xb380, 0x3293, 0x31a3, 0xb0b0, 0x37c3, 0xb6d0, 0xb5e0, 0x34f3,
+    0xcc00, 0x4d13, 0x4e23, 0xcf30, 0x4843, 0xc950, 0xca60, 0x4b73,
+    0x4483, 0xc590, 0xc6a0, 0x47b3, 0xc0c0, 0x41d3, 0x42e3, 0xc3f0,
+    0x5d03, 0xdc10, 0xdf20, 0x5e33, 0xd940, 0x5853, 0x5b63, 0xda70,
+    0xd580, 0x5493, 0x57a3, 0xd6b0, 0x51c3, 0xd0d0, 0xd3e0, 0x52f3,
+    0x6e03, 0xef10, 0xec20, 0x6d33, 0xea40, 0x6b53, 0x6863, 0xe970,
+    0xe680, 0x6793, 0x64a3, 0xe5b0, 0x62c3, 0xe3d0, 0xe0e0, 0x61f3,
+    0xff00, 0x7e13, 0x7d23, 0xfc30, 0x7b43, 0xfa50, 0xf960, 0x7873,
+    0x7783, 0xf690, 0xf5a0, 0x74b3, 0xf3c0, 0x72d3, 0x71e3, 0xf0f0,
+  },
+  {
+    0x0000, 0x1006, 0x200c, 0x300a, 0x4018, 0x501e, 0x6014, 0x7012,
+    0x8030, 0x9036, 0xa03c, 0xb03a, 0xc028, 0xd02e, 0xe024, 0xf022,
+    0x8065, 0x9063, 0xa069, 0xb06f, 0xc07d, 0xd07b, 0xe071, 0xf077,
+    0x0055, 0x1053, 0x2059, 0x305f, 0x404d, 0x504b, 0x6041, 0x7047,
+    0x80cf, 0x90c9, 0xa0c3, 0xb0c5, 0xc0d7, 0xd0d1, 0xe0db, 0xf0dd,
+    0x00ff, 0x10f9, 0x20f3, 0x30f5, 0x40e7, 0x50e1, 0x60eb, 0x70ed,
+    0x00aa, 0x10ac, 0x20a6, 0x30a0, 0x40b2, 0x50b4, 0x60be, 0x70b8,
+    0x809a, 0x909c, 0xa096, 0xb090, 0xc082, 0xd084, 0xe08e, 0xf088,
+    0x819b, 0x919d, 0xa197, 0xb191, 0xc183, 0xd185, 0xe18f, 0xf189,
+    0x01ab, 0x11ad, 0x21a7, 0x31a1, 0x41b3, 0x51b5, 0x61bf, 0x71b9,
+    0x01fe, 0x11f8, 0x21f2, 0x31f4, 0x41e6, 0x51e0, 0x61ea, 0x71ec,
+    0x81ce, 0x91c8, 0xa1c2, 0xb1c4, 0xc1d6, 0xd1d0, 0xe1da, 0xf1dc,
+    0x0154, 0x1152, 0x2158, 0x315e, 0x414c, 0x514a, 0x6140, 0x7146,
+    0x8164, 0x9162, 0xa168, 0xb16e, 0xc17c, 0xd17a, 0xe170, 0xf176,
+    0x8131, 0x9137, 0xa13d, 0xb13b, 0xc129, 0xd12f, 0xe125, 0xf123,
+    0x0101, 0x1107, 0x210d, 0x310b, 0x4119, 0x511f, 0x6115, 0x7113,
+    0x8333, 0x9335, 0xa33f, 0xb339, 0xc32b, 0xd32d, 0xe327, 0xf321,
+    0x0303, 0x1305, 0x230f, 0x3309, 0x431b, 0x531d, 0x6317, 0x7311,
+    0x0356, 0x1350, 0x235a, 0x335c, 0x434e, 0x5348, 0x6342, 0x7344,
+    0x8366, 0x9360, 0xa36a, 0xb36c, 0xc37e, 0xd378, 0xe372, 0xf374,
+    0x03fc, 0x13fa, 0x23f0, 0x33f6, 0x43e4, 0x53e2, 0x63e8, 0x73ee,
+    0x83cc, 0x93ca, 0xa3c0, 0xb3c6, 0xc3d4, 0xd3d2, 0xe3d8, 0xf3de,
+    0x8399, 0x939f, 0xa395, 0xb393, 0xc381, 0xd387, 0xe38d, 0xf38b,
+    0x03a9, 0x13af, 0x23a5, 0x33a3, 0x43b1, 0x53b7, 0x63bd, 0x73bb,
+    0x02a8, 0x12ae, 0x22a4, 0x32a2, 0x42b0, 0x52b6, 0x62bc, 0x72ba,
+    0x8298, 0x929e, 0xa294, 0xb292, 0xc280, 0xd286, 0xe28c, 0xf28a,
+    0x82cd, 0x92cb, 0xa2c1, 0xb2c7, 0xc2d5, 0xd2d3, 0xe2d9, 0xf2df,
+    0x02fd, 0x12fb, 0x22f1, 0x32f7, 0x42e5, 0x52e3, 0x62e9, 0x72ef,
+    0x8267, 0x9261, 0xa26b, 0xb26d, 0xc27f, 0xd279, 0xe273, 0xf275,
+    0x0257, 0x1251, 0x225b, 0x325d, 0x424f, 0x5249, 0x6243, 0x7245,
+    0x0202, 0x1204, 0x220e, 0x3208, 0x421a, 0x521c, 0x6216, 0x7210,
+    0x8232, 0x9234, 0xa23e, 0xb238, 0xc22a, 0xd22c, 0xe226, 0xf220,
+  },
 };
 
 MINIFLAC_PRIVATE
@@ -3007,25 +4697,45 @@ miniflac_bitreader_init(miniflac_bitreader_t* br) {
     br->len = 0;
     br->buffer = NULL;
     br->tot = 0;
+    br->crcpos = 0;
+    br->crcval = 0;
+    br->crclen = 0;
 }
 
 MINIFLAC_PRIVATE
 int
 miniflac_bitreader_fill(miniflac_bitreader_t* br, uint8_t bits) {
-    uint8_t byte = 0;
+    uint8_t n;
+    uint64_t word;
     assert(bits <= 64);
     if(bits == 0) return 0;
-    while(br->bits < bits && br->pos < br->len) {
-        byte = br->buffer[br->pos++];
-        br->val = (br->val << 8) | byte;
-        br->bits += 8;
-        br->crc8 = miniflac_crc8_table[br->crc8 ^ byte];
-        br->crc16 = miniflac_crc16_table[ (br->crc16 >> 8) ^ byte ] ^ (( br->crc16 & 0x00FF ) << 8);
-        br->tot++;
+    while(br->bits < bits) {
+        if(br->len - br->pos >= 8 && br->bits <= 56) {
+            /* top off val with as many whole bytes as will fit,
+             * using a single 8-byte read */
+            n = (64 - br->bits) >> 3;
+            word = miniflac_unpack_uint64be(&br->buffer[br->pos]);
+            if(n == 8) {
+                br->val = word;
+            } else {
+                br->val = (br->val << (n * 8)) | (word >> (64 - (n * 8)));
+            }
+            br->pos  += n;
+            br->bits += n * 8;
+        } else if(br->pos < br->len) {
+            br->val = (br->val << 8) | br->buffer[br->pos++];
+            br->bits += 8;
+        } else {
+            break;
+        }
     }
+    /* the crc isn't updated here, val may now hold bytes past the
+     * end of the current block. see miniflac_bitreader_update_crc */
     return br->bits < bits;
 }
 
+/* fill_nocrc only reads what it needs, the ogg reader relies on
+ * pos being exact */
 MINIFLAC_PRIVATE
 int
 miniflac_bitreader_fill_nocrc(miniflac_bitreader_t* br, uint8_t bits) {
@@ -3036,7 +4746,6 @@ miniflac_bitreader_fill_nocrc(miniflac_bitreader_t* br, uint8_t bits) {
         byte = br->buffer[br->pos++];
         br->val = (br->val << 8) | byte;
         br->bits += 8;
-        br->tot++;
     }
     return br->bits < bits;
 }
@@ -3113,45 +4822,181 @@ miniflac_bitreader_discard(miniflac_bitreader_t* br, uint8_t bits) {
     br->val &= imask;
 }
 
+/* reads a unary-coded value: counts zero bits up to and including
+ * the next 1 bit, adding the count of zeros to *zeros. Returns
+ * nonzero if the data runs out first - the zeros read so far are
+ * already counted, so calling again with more data picks up where
+ * it left off. */
+MINIFLAC_PRIVATE
+int
+miniflac_bitreader_read_unary(miniflac_bitreader_t* br, uint32_t* zeros) {
+    uint8_t n;
+
+    for(;;) {
+        if(miniflac_bitreader_fill(br,1)) return 1;
+        if(br->val == 0) {
+            /* all remaining bits are zero */
+            *zeros += br->bits;
+            br->bits = 0;
+            continue;
+        }
+        n = (uint8_t)(MINIFLAC_CLZ64(br->val) - (64 - br->bits));
+        *zeros += n;
+        miniflac_bitreader_discard(br,n + 1);
+        return 0;
+    }
+}
+
 MINIFLAC_PRIVATE
 void
 miniflac_bitreader_align(miniflac_bitreader_t* br) {
-    assert(br->bits < 8);
-    br->bits = 0;
-    br->val = 0;
+    /* drop the partial byte, any whole bytes read ahead are kept */
+    miniflac_bitreader_discard(br, br->bits & 0x07);
 }
 
 MINIFLAC_PRIVATE
 void
 miniflac_bitreader_reset_crc(miniflac_bitreader_t* br) {
-    uint64_t val = br->val;
-    uint8_t bits = br->bits;
-
-    uint8_t byte;
-    uint64_t mask;
-    uint64_t imask;
+    assert((br->bits & 0x07) == 0);
 
     br->crc8 = 0;
     br->crc16 = 0;
     br->tot = 0;
 
-    while(bits > 0) {
-        mask = -1LL;
-        imask = -1LL;
+    /* whole bytes still in val are the start of the new crc,
+     * they may have come from a previous buffer so keep a copy */
+    br->crcval = br->val;
+    br->crclen = br->bits >> 3;
+    br->crcpos = br->pos;
+}
 
-        mask >>= (64 - 8);
-        bits -= 8;
-        byte = val >> bits & mask;
-        if(bits == 0) {
-            imask = 0;
-        } else {
-            imask >>= (64 - bits);
-        }
-        val &=  imask;
+static
+void
+miniflac_bitreader_crc_byte(miniflac_bitreader_t* br, uint8_t byte) {
+    if(br->tot < MINIFLAC_CRC8_LEN) {
         br->crc8 = miniflac_crc8_table[br->crc8 ^ byte];
-        br->crc16 = miniflac_crc16_table[ (br->crc16 >> 8) ^ byte ] ^ (( br->crc16 & 0x00FF ) << 8);
-        br->tot++;
     }
+    br->crc16 = miniflac_crc16_table[0][ (br->crc16 >> 8) ^ byte ] ^ (( br->crc16 & 0x00FF ) << 8);
+    br->tot++;
+}
+
+/* brings crc8, crc16 and tot up to date with every byte that has been
+ * at least partially consumed. Bytes that are still whole in val
+ * are left out - they belong to whatever gets read next.
+ *
+ * This is normally called once for the header and once at the footer,
+ * so the bulk of a frame is checksummed 8 bytes at a time. If a frame
+ * is split across multiple buffers it gets called at the end of each
+ * one instead. */
+MINIFLAC_PRIVATE
+void
+miniflac_bitreader_update_crc(miniflac_bitreader_t* br) {
+    uint32_t len = br->crclen + (br->pos - br->crcpos) - (br->bits >> 3);
+    const uint8_t* b;
+    uint16_t crc16;
+
+    while(len > 0 && br->crclen > 0) {
+        br->crclen--;
+        miniflac_bitreader_crc_byte(br, (uint8_t)(br->crcval >> (br->crclen * 8)));
+        len--;
+    }
+
+    while(len > 0 && br->tot < MINIFLAC_CRC8_LEN) {
+        miniflac_bitreader_crc_byte(br, br->buffer[br->crcpos++]);
+        len--;
+    }
+
+    b = &br->buffer[br->crcpos];
+    br->crcpos += len;
+    br->tot += len;
+    crc16 = br->crc16;
+
+    while(len >= 8) {
+        crc16 =
+          miniflac_crc16_table[7][ (crc16 >> 8) ^ b[0] ] ^
+          miniflac_crc16_table[6][ (crc16 & 0xFF) ^ b[1] ] ^
+          miniflac_crc16_table[5][ b[2] ] ^
+          miniflac_crc16_table[4][ b[3] ] ^
+          miniflac_crc16_table[3][ b[4] ] ^
+          miniflac_crc16_table[2][ b[5] ] ^
+          miniflac_crc16_table[1][ b[6] ] ^
+          miniflac_crc16_table[0][ b[7] ];
+        b += 8;
+        len -= 8;
+    }
+
+    while(len > 0) {
+        crc16 = miniflac_crc16_table[0][ (crc16 >> 8) ^ *b ] ^ (( crc16 & 0x00FF ) << 8);
+        b++;
+        len--;
+    }
+
+    br->crc16 = crc16;
+}
+
+/* hands whole unread bytes back to the current buffer, so the
+ * caller gets an accurate count of consumed bytes */
+MINIFLAC_PRIVATE
+void
+miniflac_bitreader_unfill(miniflac_bitreader_t* br) {
+    uint32_t len = br->bits >> 3;
+    uint32_t pending = br->pos - br->crcpos;
+
+    if(len > br->pos) len = br->pos;
+    if(len == 0) return;
+
+    /* the newest bytes queued up by reset_crc may be among the ones
+     * being handed back */
+    while(pending < len) {
+        br->crcval >>= 8;
+        br->crclen--;
+        pending++;
+        br->crcpos--;
+    }
+
+    br->pos  -= len;
+    br->bits -= len * 8;
+    if(br->bits == 0) {
+        br->val = 0;
+    } else {
+        br->val >>= len * 8;
+    }
+}
+
+/* called when the current buffer is about to go away */
+MINIFLAC_PRIVATE
+void
+miniflac_bitreader_detach(miniflac_bitreader_t* br) {
+    miniflac_bitreader_update_crc(br);
+
+    /* whatever is left un-checksummed is sitting whole in val */
+    br->crcval = br->val;
+    br->crclen = br->bits >> 3;
+    br->crcpos = 0;
+    br->pos = 0;
+    br->len = 0;
+    br->buffer = NULL;
+}
+
+MINIFLAC_PRIVATE
+uint8_t
+miniflac_bitreader_crc8(const uint8_t* data, uint32_t length) {
+    uint8_t crc8 = 0;
+    uint32_t i;
+    for(i = 0; i < length; i++) {
+        crc8 = miniflac_crc8_table[crc8 ^ data[i]];
+    }
+    return crc8;
+}
+
+MINIFLAC_PRIVATE
+uint16_t
+miniflac_bitreader_crc16(uint16_t crc16, const uint8_t* data, uint32_t length) {
+    uint32_t i;
+    for(i = 0; i < length; i++) {
+        crc16 = miniflac_crc16_table[0][ (crc16 >> 8) ^ data[i] ] ^ (( crc16 & 0x00FF ) << 8);
+    }
+    return crc16;
 }
 
 MINIFLAC_PRIVATE
@@ -3237,6 +5082,675 @@ miniflac_oggheader_decode(miniflac_oggheader_t* oggheader, miniflac_bitreader_t*
     return MINIFLAC_OK;
 }
 
+#ifdef MINIFLAC_OGG_CRC32
+/* slice-by-16 tables for the Ogg crc32 (polynomial 0x04C11DB7, MSB-first,
+ * no reflection), miniflac_ogg_crc32_table[n][b] is the crc of byte b
+ * followed by n zero bytes */
+static const uint32_t miniflac_ogg_crc32_table[16][256] = {
+  {
+    0x00000000, 0x04c11db7, 0x09823b6e, 0x0d4326d9, 0x130476dc, 0x17c56b6b, 0x1a864db2, 0x1e475005,
+    0x2608edb8, 0x22c9f00f, 0x2f8ad6d6, 0x2b4bcb61, 0x350c9b64, 0x31cd86d3, 0x3c8ea00a, 0x384fbdbd,
+    0x4c11db70, 0x48d0c6c7, 0x4593e01e, 0x4152fda9, 0x5f15adac, 0x5bd4b01b, 0x569796c2, 0x52568b75,
+    0x6a1936c8, 0x6ed82b7f, 0x639b0da6, 0x675a1011, 0x791d4014, 0x7ddc5da3, 0x709f7b7a, 0x745e66cd,
+    0x9823b6e0, 0x9ce2ab57, 0x91a18d8e, 0x95609039, 0x8b27c03c, 0x8fe6dd8b, 0x82a5fb52, 0x8664e6e5,
+    0xbe2b5b58, 0xbaea46ef, 0xb7a96036, 0xb3687d81, 0xad2f2d84, 0xa9ee3033, 0xa4ad16ea, 0xa06c0b5d,
+    0xd4326d90, 0xd0f37027, 0xddb056fe, 0xd9714b49, 0xc7361b4c, 0xc3f706fb, 0xceb42022, 0xca753d95,
+    0xf23a8028, 0xf6fb9d9f, 0xfbb8bb46, 0xff79a6f1, 0xe13ef6f4, 0xe5ffeb43, 0xe8bccd9a, 0xec7dd02d,
+    0x34867077, 0x30476dc0, 0x3d044b19, 0x39c556ae, 0x278206ab, 0x23431b1c, 0x2e003dc5, 0x2ac12072,
+    0x128e9dcf, 0x164f8078, 0x1b0ca6a1, 0x1fcdbb16, 0x018aeb13, 0x054bf6a4, 0x0808d07d, 0x0cc9cdca,
+    0x7897ab07, 0x7c56b6b0, 0x71159069, 0x75d48dde, 0x6b93dddb, 0x6f52c06c, 0x6211e6b5, 0x66d0fb02,
+    0x5e9f46bf, 0x5a5e5b08, 0x571d7dd1, 0x53dc6066, 0x4d9b3063, 0x495a2dd4, 0x44190b0d, 0x40d816ba,
+    0xaca5c697, 0xa864db20, 0xa527fdf9, 0xa1e6e04e, 0xbfa1b04b, 0xbb60adfc, 0xb6238b25, 0xb2e29692,
+    0x8aad2b2f, 0x8e6c3698, 0x832f1041, 0x87ee0df6, 0x99a95df3, 0x9d684044, 0x902b669d, 0x94ea7b2a,
+    0xe0b41de7, 0xe4750050, 0xe9362689, 0xedf73b3e, 0xf3b06b3b, 0xf771768c, 0xfa325055, 0xfef34de2,
+    0xc6bcf05f, 0xc27dede8, 0xcf3ecb31, 0xcbffd686, 0xd5b88683, 0xd1799b34, 0xdc3abded, 0xd8fba05a,
+    0x690ce0ee, 0x6dcdfd59, 0x608edb80, 0x644fc637, 0x7a089632, 0x7ec98b85, 0x738aad5c, 0x774bb0eb,
+    0x4f040d56, 0x4bc510e1, 0x46863638, 0x42472b8f, 0x5c007b8a, 0x58c1663d, 0x558240e4, 0x51435d53,
+    0x251d3b9e, 0x21dc2629, 0x2c9f00f0, 0x285e1d47, 0x36194d42, 0x32d850f5, 0x3f9b762c, 0x3b5a6b9b,
+    0x0315d626, 0x07d4cb91, 0x0a97ed48, 0x0e56f0ff, 0x1011a0fa, 0x14d0bd4d, 0x19939b94, 0x1d528623,
+    0xf12f560e, 0xf5ee4bb9, 0xf8ad6d60, 0xfc6c70d7, 0xe22b20d2, 0xe6ea3d65, 0xeba91bbc, 0xef68060b,
+    0xd727bbb6, 0xd3e6a601, 0xdea580d8, 0xda649d6f, 0xc423cd6a, 0xc0e2d0dd, 0xcda1f604, 0xc960ebb3,
+    0xbd3e8d7e, 0xb9ff90c9, 0xb4bcb610, 0xb07daba7, 0xae3afba2, 0xaafbe615, 0xa7b8c0cc, 0xa379dd7b,
+    0x9b3660c6, 0x9ff77d71, 0x92b45ba8, 0x9675461f, 0x8832161a, 0x8cf30bad, 0x81b02d74, 0x857130c3,
+    0x5d8a9099, 0x594b8d2e, 0x5408abf7, 0x50c9b640, 0x4e8ee645, 0x4a4ffbf2, 0x470cdd2b, 0x43cdc09c,
+    0x7b827d21, 0x7f436096, 0x7200464f, 0x76c15bf8, 0x68860bfd, 0x6c47164a, 0x61043093, 0x65c52d24,
+    0x119b4be9, 0x155a565e, 0x18197087, 0x1cd86d30, 0x029f3d35, 0x065e2082, 0x0b1d065b, 0x0fdc1bec,
+    0x3793a651, 0x3352bbe6, 0x3e119d3f, 0x3ad08088, 0x2497d08d, 0x2056cd3a, 0x2d15ebe3, 0x29d4f654,
+    0xc5a92679, 0xc1683bce, 0xcc2b1d17, 0xc8ea00a0, 0xd6ad50a5, 0xd26c4d12, 0xdf2f6bcb, 0xdbee767c,
+    0xe3a1cbc1, 0xe760d676, 0xea23f0af, 0xeee2ed18, 0xf0a5bd1d, 0xf464a0aa, 0xf9278673, 0xfde69bc4,
+    0x89b8fd09, 0x8d79e0be, 0x803ac667, 0x84fbdbd0, 0x9abc8bd5, 0x9e7d9662, 0x933eb0bb, 0x97ffad0c,
+    0xafb010b1, 0xab710d06, 0xa6322bdf, 0xa2f33668, 0xbcb4666d, 0xb8757bda, 0xb5365d03, 0xb1f740b4,
+  },
+  {
+    0x00000000, 0xd219c1dc, 0xa0f29e0f, 0x72eb5fd3, 0x452421a9, 0x973de075, 0xe5d6bfa6, 0x37cf7e7a,
+    0x8a484352, 0x5851828e, 0x2abadd5d, 0xf8a31c81, 0xcf6c62fb, 0x1d75a327, 0x6f9efcf4, 0xbd873d28,
+    0x10519b13, 0xc2485acf, 0xb0a3051c, 0x62bac4c0, 0x5575baba, 0x876c7b66, 0xf58724b5, 0x279ee569,
+    0x9a19d841, 0x4800199d, 0x3aeb464e, 0xe8f28792, 0xdf3df9e8, 0x0d243834, 0x7fcf67e7, 0xadd6a63b,
+    0x20a33626, 0xf2baf7fa, 0x8051a829, 0x524869f5, 0x6587178f, 0xb79ed653, 0xc5758980, 0x176c485c,
+    0xaaeb7574, 0x78f2b4a8, 0x0a19eb7b, 0xd8002aa7, 0xefcf54dd, 0x3dd69501, 0x4f3dcad2, 0x9d240b0e,
+    0x30f2ad35, 0xe2eb6ce9, 0x9000333a, 0x4219f2e6, 0x75d68c9c, 0xa7cf4d40, 0xd5241293, 0x073dd34f,
+    0xbabaee67, 0x68a32fbb, 0x1a487068, 0xc851b1b4, 0xff9ecfce, 0x2d870e12, 0x5f6c51c1, 0x8d75901d,
+    0x41466c4c, 0x935fad90, 0xe1b4f243, 0x33ad339f, 0x04624de5, 0xd67b8c39, 0xa490d3ea, 0x76891236,
+    0xcb0e2f1e, 0x1917eec2, 0x6bfcb111, 0xb9e570cd, 0x8e2a0eb7, 0x5c33cf6b, 0x2ed890b8, 0xfcc15164,
+    0x5117f75f, 0x830e3683, 0xf1e56950, 0x23fca88c, 0x1433d6f6, 0xc62a172a, 0xb4c148f9, 0x66d88925,
+    0xdb5fb40d, 0x094675d1, 0x7bad2a02, 0xa9b4ebde, 0x9e7b95a4, 0x4c625478, 0x3e890bab, 0xec90ca77,
+    0x61e55a6a, 0xb3fc9bb6, 0xc117c465, 0x130e05b9, 0x24c17bc3, 0xf6d8ba1f, 0x8433e5cc, 0x562a2410,
+    0xebad1938, 0x39b4d8e4, 0x4b5f8737, 0x994646eb, 0xae893891, 0x7c90f94d, 0x0e7ba69e, 0xdc626742,
+    0x71b4c179, 0xa3ad00a5, 0xd1465f76, 0x035f9eaa, 0x3490e0d0, 0xe689210c, 0x94627edf, 0x467bbf03,
+    0xfbfc822b, 0x29e543f7, 0x5b0e1c24, 0x8917ddf8, 0xbed8a382, 0x6cc1625e, 0x1e2a3d8d, 0xcc33fc51,
+    0x828cd898, 0x50951944, 0x227e4697, 0xf067874b, 0xc7a8f931, 0x15b138ed, 0x675a673e, 0xb543a6e2,
+    0x08c49bca, 0xdadd5a16, 0xa83605c5, 0x7a2fc419, 0x4de0ba63, 0x9ff97bbf, 0xed12246c, 0x3f0be5b0,
+    0x92dd438b, 0x40c48257, 0x322fdd84, 0xe0361c58, 0xd7f96222, 0x05e0a3fe, 0x770bfc2d, 0xa5123df1,
+    0x189500d9, 0xca8cc105, 0xb8679ed6, 0x6a7e5f0a, 0x5db12170, 0x8fa8e0ac, 0xfd43bf7f, 0x2f5a7ea3,
+    0xa22feebe, 0x70362f62, 0x02dd70b1, 0xd0c4b16d, 0xe70bcf17, 0x35120ecb, 0x47f95118, 0x95e090c4,
+    0x2867adec, 0xfa7e6c30, 0x889533e3, 0x5a8cf23f, 0x6d438c45, 0xbf5a4d99, 0xcdb1124a, 0x1fa8d396,
+    0xb27e75ad, 0x6067b471, 0x128ceba2, 0xc0952a7e, 0xf75a5404, 0x254395d8, 0x57a8ca0b, 0x85b10bd7,
+    0x383636ff, 0xea2ff723, 0x98c4a8f0, 0x4add692c, 0x7d121756, 0xaf0bd68a, 0xdde08959, 0x0ff94885,
+    0xc3cab4d4, 0x11d37508, 0x63382adb, 0xb121eb07, 0x86ee957d, 0x54f754a1, 0x261c0b72, 0xf405caae,
+    0x4982f786, 0x9b9b365a, 0xe9706989, 0x3b69a855, 0x0ca6d62f, 0xdebf17f3, 0xac544820, 0x7e4d89fc,
+    0xd39b2fc7, 0x0182ee1b, 0x7369b1c8, 0xa1707014, 0x96bf0e6e, 0x44a6cfb2, 0x364d9061, 0xe45451bd,
+    0x59d36c95, 0x8bcaad49, 0xf921f29a, 0x2b383346, 0x1cf74d3c, 0xceee8ce0, 0xbc05d333, 0x6e1c12ef,
+    0xe36982f2, 0x3170432e, 0x439b1cfd, 0x9182dd21, 0xa64da35b, 0x74546287, 0x06bf3d54, 0xd4a6fc88,
+    0x6921c1a0, 0xbb38007c, 0xc9d35faf, 0x1bca9e73, 0x2c05e009, 0xfe1c21d5, 0x8cf77e06, 0x5eeebfda,
+    0xf33819e1, 0x2121d83d, 0x53ca87ee, 0x81d34632, 0xb61c3848, 0x6405f994, 0x16eea647, 0xc4f7679b,
+    0x79705ab3, 0xab699b6f, 0xd982c4bc, 0x0b9b0560, 0x3c547b1a, 0xee4dbac6, 0x9ca6e515, 0x4ebf24c9,
+  },
+  {
+    0x00000000, 0x01d8ac87, 0x03b1590e, 0x0269f589, 0x0762b21c, 0x06ba1e9b, 0x04d3eb12, 0x050b4795,
+    0x0ec56438, 0x0f1dc8bf, 0x0d743d36, 0x0cac91b1, 0x09a7d624, 0x087f7aa3, 0x0a168f2a, 0x0bce23ad,
+    0x1d8ac870, 0x1c5264f7, 0x1e3b917e, 0x1fe33df9, 0x1ae87a6c, 0x1b30d6eb, 0x19592362, 0x18818fe5,
+    0x134fac48, 0x129700cf, 0x10fef546, 0x112659c1, 0x142d1e54, 0x15f5b2d3, 0x179c475a, 0x1644ebdd,
+    0x3b1590e0, 0x3acd3c67, 0x38a4c9ee, 0x397c6569, 0x3c7722fc, 0x3daf8e7b, 0x3fc67bf2, 0x3e1ed775,
+    0x35d0f4d8, 0x3408585f, 0x3661add6, 0x37b90151, 0x32b246c4, 0x336aea43, 0x31031fca, 0x30dbb34d,
+    0x269f5890, 0x2747f417, 0x252e019e, 0x24f6ad19, 0x21fdea8c, 0x2025460b, 0x224cb382, 0x23941f05,
+    0x285a3ca8, 0x2982902f, 0x2beb65a6, 0x2a33c921, 0x2f388eb4, 0x2ee02233, 0x2c89d7ba, 0x2d517b3d,
+    0x762b21c0, 0x77f38d47, 0x759a78ce, 0x7442d449, 0x714993dc, 0x70913f5b, 0x72f8cad2, 0x73206655,
+    0x78ee45f8, 0x7936e97f, 0x7b5f1cf6, 0x7a87b071, 0x7f8cf7e4, 0x7e545b63, 0x7c3daeea, 0x7de5026d,
+    0x6ba1e9b0, 0x6a794537, 0x6810b0be, 0x69c81c39, 0x6cc35bac, 0x6d1bf72b, 0x6f7202a2, 0x6eaaae25,
+    0x65648d88, 0x64bc210f, 0x66d5d486, 0x670d7801, 0x62063f94, 0x63de9313, 0x61b7669a, 0x606fca1d,
+    0x4d3eb120, 0x4ce61da7, 0x4e8fe82e, 0x4f5744a9, 0x4a5c033c, 0x4b84afbb, 0x49ed5a32, 0x4835f6b5,
+    0x43fbd518, 0x4223799f, 0x404a8c16, 0x41922091, 0x44996704, 0x4541cb83, 0x47283e0a, 0x46f0928d,
+    0x50b47950, 0x516cd5d7, 0x5305205e, 0x52dd8cd9, 0x57d6cb4c, 0x560e67cb, 0x54679242, 0x55bf3ec5,
+    0x5e711d68, 0x5fa9b1ef, 0x5dc04466, 0x5c18e8e1, 0x5913af74, 0x58cb03f3, 0x5aa2f67a, 0x5b7a5afd,
+    0xec564380, 0xed8eef07, 0xefe71a8e, 0xee3fb609, 0xeb34f19c, 0xeaec5d1b, 0xe885a892, 0xe95d0415,
+    0xe29327b8, 0xe34b8b3f, 0xe1227eb6, 0xe0fad231, 0xe5f195a4, 0xe4293923, 0xe640ccaa, 0xe798602d,
+    0xf1dc8bf0, 0xf0042777, 0xf26dd2fe, 0xf3b57e79, 0xf6be39ec, 0xf766956b, 0xf50f60e2, 0xf4d7cc65,
+    0xff19efc8, 0xfec1434f, 0xfca8b6c6, 0xfd701a41, 0xf87b5dd4, 0xf9a3f153, 0xfbca04da, 0xfa12a85d,
+    0xd743d360, 0xd69b7fe7, 0xd4f28a6e, 0xd52a26e9, 0xd021617c, 0xd1f9cdfb, 0xd3903872, 0xd24894f5,
+    0xd986b758, 0xd85e1bdf, 0xda37ee56, 0xdbef42d1, 0xdee40544, 0xdf3ca9c3, 0xdd555c4a, 0xdc8df0cd,
+    0xcac91b10, 0xcb11b797, 0xc978421e, 0xc8a0ee99, 0xcdaba90c, 0xcc73058b, 0xce1af002, 0xcfc25c85,
+    0xc40c7f28, 0xc5d4d3af, 0xc7bd2626, 0xc6658aa1, 0xc36ecd34, 0xc2b661b3, 0xc0df943a, 0xc10738bd,
+    0x9a7d6240, 0x9ba5cec7, 0x99cc3b4e, 0x981497c9, 0x9d1fd05c, 0x9cc77cdb, 0x9eae8952, 0x9f7625d5,
+    0x94b80678, 0x9560aaff, 0x97095f76, 0x96d1f3f1, 0x93dab464, 0x920218e3, 0x906bed6a, 0x91b341ed,
+    0x87f7aa30, 0x862f06b7, 0x8446f33e, 0x859e5fb9, 0x8095182c, 0x814db4ab, 0x83244122, 0x82fceda5,
+    0x8932ce08, 0x88ea628f, 0x8a839706, 0x8b5b3b81, 0x8e507c14, 0x8f88d093, 0x8de1251a, 0x8c39899d,
+    0xa168f2a0, 0xa0b05e27, 0xa2d9abae, 0xa3010729, 0xa60a40bc, 0xa7d2ec3b, 0xa5bb19b2, 0xa463b535,
+    0xafad9698, 0xae753a1f, 0xac1ccf96, 0xadc46311, 0xa8cf2484, 0xa9178803, 0xab7e7d8a, 0xaaa6d10d,
+    0xbce23ad0, 0xbd3a9657, 0xbf5363de, 0xbe8bcf59, 0xbb8088cc, 0xba58244b, 0xb831d1c2, 0xb9e97d45,
+    0xb2275ee8, 0xb3fff26f, 0xb19607e6, 0xb04eab61, 0xb545ecf4, 0xb49d4073, 0xb6f4b5fa, 0xb72c197d,
+  },
+  {
+    0x00000000, 0xdc6d9ab7, 0xbc1a28d9, 0x6077b26e, 0x7cf54c05, 0xa098d6b2, 0xc0ef64dc, 0x1c82fe6b,
+    0xf9ea980a, 0x258702bd, 0x45f0b0d3, 0x999d2a64, 0x851fd40f, 0x59724eb8, 0x3905fcd6, 0xe5686661,
+    0xf7142da3, 0x2b79b714, 0x4b0e057a, 0x97639fcd, 0x8be161a6, 0x578cfb11, 0x37fb497f, 0xeb96d3c8,
+    0x0efeb5a9, 0xd2932f1e, 0xb2e49d70, 0x6e8907c7, 0x720bf9ac, 0xae66631b, 0xce11d175, 0x127c4bc2,
+    0xeae946f1, 0x3684dc46, 0x56f36e28, 0x8a9ef49f, 0x961c0af4, 0x4a719043, 0x2a06222d, 0xf66bb89a,
+    0x1303defb, 0xcf6e444c, 0xaf19f622, 0x73746c95, 0x6ff692fe, 0xb39b0849, 0xd3ecba27, 0x0f812090,
+    0x1dfd6b52, 0xc190f1e5, 0xa1e7438b, 0x7d8ad93c, 0x61082757, 0xbd65bde0, 0xdd120f8e, 0x017f9539,
+    0xe417f358, 0x387a69ef, 0x580ddb81, 0x84604136, 0x98e2bf5d, 0x448f25ea, 0x24f89784, 0xf8950d33,
+    0xd1139055, 0x0d7e0ae2, 0x6d09b88c, 0xb164223b, 0xade6dc50, 0x718b46e7, 0x11fcf489, 0xcd916e3e,
+    0x28f9085f, 0xf49492e8, 0x94e32086, 0x488eba31, 0x540c445a, 0x8861deed, 0xe8166c83, 0x347bf634,
+    0x2607bdf6, 0xfa6a2741, 0x9a1d952f, 0x46700f98, 0x5af2f1f3, 0x869f6b44, 0xe6e8d92a, 0x3a85439d,
+    0xdfed25fc, 0x0380bf4b, 0x63f70d25, 0xbf9a9792, 0xa31869f9, 0x7f75f34e, 0x1f024120, 0xc36fdb97,
+    0x3bfad6a4, 0xe7974c13, 0x87e0fe7d, 0x5b8d64ca, 0x470f9aa1, 0x9b620016, 0xfb15b278, 0x277828cf,
+    0xc2104eae, 0x1e7dd419, 0x7e0a6677, 0xa267fcc0, 0xbee502ab, 0x6288981c, 0x02ff2a72, 0xde92b0c5,
+    0xcceefb07, 0x108361b0, 0x70f4d3de, 0xac994969, 0xb01bb702, 0x6c762db5, 0x0c019fdb, 0xd06c056c,
+    0x3504630d, 0xe969f9ba, 0x891e4bd4, 0x5573d163, 0x49f12f08, 0x959cb5bf, 0xf5eb07d1, 0x29869d66,
+    0xa6e63d1d, 0x7a8ba7aa, 0x1afc15c4, 0xc6918f73, 0xda137118, 0x067eebaf, 0x660959c1, 0xba64c376,
+    0x5f0ca517, 0x83613fa0, 0xe3168dce, 0x3f7b1779, 0x23f9e912, 0xff9473a5, 0x9fe3c1cb, 0x438e5b7c,
+    0x51f210be, 0x8d9f8a09, 0xede83867, 0x3185a2d0, 0x2d075cbb, 0xf16ac60c, 0x911d7462, 0x4d70eed5,
+    0xa81888b4, 0x74751203, 0x1402a06d, 0xc86f3ada, 0xd4edc4b1, 0x08805e06, 0x68f7ec68, 0xb49a76df,
+    0x4c0f7bec, 0x9062e15b, 0xf0155335, 0x2c78c982, 0x30fa37e9, 0xec97ad5e, 0x8ce01f30, 0x508d8587,
+    0xb5e5e3e6, 0x69887951, 0x09ffcb3f, 0xd5925188, 0xc910afe3, 0x157d3554, 0x750a873a, 0xa9671d8d,
+    0xbb1b564f, 0x6776ccf8, 0x07017e96, 0xdb6ce421, 0xc7ee1a4a, 0x1b8380fd, 0x7bf43293, 0xa799a824,
+    0x42f1ce45, 0x9e9c54f2, 0xfeebe69c, 0x22867c2b, 0x3e048240, 0xe26918f7, 0x821eaa99, 0x5e73302e,
+    0x77f5ad48, 0xab9837ff, 0xcbef8591, 0x17821f26, 0x0b00e14d, 0xd76d7bfa, 0xb71ac994, 0x6b775323,
+    0x8e1f3542, 0x5272aff5, 0x32051d9b, 0xee68872c, 0xf2ea7947, 0x2e87e3f0, 0x4ef0519e, 0x929dcb29,
+    0x80e180eb, 0x5c8c1a5c, 0x3cfba832, 0xe0963285, 0xfc14ccee, 0x20795659, 0x400ee437, 0x9c637e80,
+    0x790b18e1, 0xa5668256, 0xc5113038, 0x197caa8f, 0x05fe54e4, 0xd993ce53, 0xb9e47c3d, 0x6589e68a,
+    0x9d1cebb9, 0x4171710e, 0x2106c360, 0xfd6b59d7, 0xe1e9a7bc, 0x3d843d0b, 0x5df38f65, 0x819e15d2,
+    0x64f673b3, 0xb89be904, 0xd8ec5b6a, 0x0481c1dd, 0x18033fb6, 0xc46ea501, 0xa419176f, 0x78748dd8,
+    0x6a08c61a, 0xb6655cad, 0xd612eec3, 0x0a7f7474, 0x16fd8a1f, 0xca9010a8, 0xaae7a2c6, 0x768a3871,
+    0x93e25e10, 0x4f8fc4a7, 0x2ff876c9, 0xf395ec7e, 0xef171215, 0x337a88a2, 0x530d3acc, 0x8f60a07b,
+  },
+  {
+    0x00000000, 0x490d678d, 0x921acf1a, 0xdb17a897, 0x20f48383, 0x69f9e40e, 0xb2ee4c99, 0xfbe32b14,
+    0x41e90706, 0x08e4608b, 0xd3f3c81c, 0x9afeaf91, 0x611d8485, 0x2810e308, 0xf3074b9f, 0xba0a2c12,
+    0x83d20e0c, 0xcadf6981, 0x11c8c116, 0x58c5a69b, 0xa3268d8f, 0xea2bea02, 0x313c4295, 0x78312518,
+    0xc23b090a, 0x8b366e87, 0x5021c610, 0x192ca19d, 0xe2cf8a89, 0xabc2ed04, 0x70d54593, 0x39d8221e,
+    0x036501af, 0x4a686622, 0x917fceb5, 0xd872a938, 0x2391822c, 0x6a9ce5a1, 0xb18b4d36, 0xf8862abb,
+    0x428c06a9, 0x0b816124, 0xd096c9b3, 0x999bae3e, 0x6278852a, 0x2b75e2a7, 0xf0624a30, 0xb96f2dbd,
+    0x80b70fa3, 0xc9ba682e, 0x12adc0b9, 0x5ba0a734, 0xa0438c20, 0xe94eebad, 0x3259433a, 0x7b5424b7,
+    0xc15e08a5, 0x88536f28, 0x5344c7bf, 0x1a49a032, 0xe1aa8b26, 0xa8a7ecab, 0x73b0443c, 0x3abd23b1,
+    0x06ca035e, 0x4fc764d3, 0x94d0cc44, 0xddddabc9, 0x263e80dd, 0x6f33e750, 0xb4244fc7, 0xfd29284a,
+    0x47230458, 0x0e2e63d5, 0xd539cb42, 0x9c34accf, 0x67d787db, 0x2edae056, 0xf5cd48c1, 0xbcc02f4c,
+    0x85180d52, 0xcc156adf, 0x1702c248, 0x5e0fa5c5, 0xa5ec8ed1, 0xece1e95c, 0x37f641cb, 0x7efb2646,
+    0xc4f10a54, 0x8dfc6dd9, 0x56ebc54e, 0x1fe6a2c3, 0xe40589d7, 0xad08ee5a, 0x761f46cd, 0x3f122140,
+    0x05af02f1, 0x4ca2657c, 0x97b5cdeb, 0xdeb8aa66, 0x255b8172, 0x6c56e6ff, 0xb7414e68, 0xfe4c29e5,
+    0x444605f7, 0x0d4b627a, 0xd65ccaed, 0x9f51ad60, 0x64b28674, 0x2dbfe1f9, 0xf6a8496e, 0xbfa52ee3,
+    0x867d0cfd, 0xcf706b70, 0x1467c3e7, 0x5d6aa46a, 0xa6898f7e, 0xef84e8f3, 0x34934064, 0x7d9e27e9,
+    0xc7940bfb, 0x8e996c76, 0x558ec4e1, 0x1c83a36c, 0xe7608878, 0xae6deff5, 0x757a4762, 0x3c7720ef,
+    0x0d9406bc, 0x44996131, 0x9f8ec9a6, 0xd683ae2b, 0x2d60853f, 0x646de2b2, 0xbf7a4a25, 0xf6772da8,
+    0x4c7d01ba, 0x05706637, 0xde67cea0, 0x976aa92d, 0x6c898239, 0x2584e5b4, 0xfe934d23, 0xb79e2aae,
+    0x8e4608b0, 0xc74b6f3d, 0x1c5cc7aa, 0x5551a027, 0xaeb28b33, 0xe7bfecbe, 0x3ca84429, 0x75a523a4,
+    0xcfaf0fb6, 0x86a2683b, 0x5db5c0ac, 0x14b8a721, 0xef5b8c35, 0xa656ebb8, 0x7d41432f, 0x344c24a2,
+    0x0ef10713, 0x47fc609e, 0x9cebc809, 0xd5e6af84, 0x2e058490, 0x6708e31d, 0xbc1f4b8a, 0xf5122c07,
+    0x4f180015, 0x06156798, 0xdd02cf0f, 0x940fa882, 0x6fec8396, 0x26e1e41b, 0xfdf64c8c, 0xb4fb2b01,
+    0x8d23091f, 0xc42e6e92, 0x1f39c605, 0x5634a188, 0xadd78a9c, 0xe4daed11, 0x3fcd4586, 0x76c0220b,
+    0xccca0e19, 0x85c76994, 0x5ed0c103, 0x17dda68e, 0xec3e8d9a, 0xa533ea17, 0x7e244280, 0x3729250d,
+    0x0b5e05e2, 0x4253626f, 0x9944caf8, 0xd049ad75, 0x2baa8661, 0x62a7e1ec, 0xb9b0497b, 0xf0bd2ef6,
+    0x4ab702e4, 0x03ba6569, 0xd8adcdfe, 0x91a0aa73, 0x6a438167, 0x234ee6ea, 0xf8594e7d, 0xb15429f0,
+    0x888c0bee, 0xc1816c63, 0x1a96c4f4, 0x539ba379, 0xa878886d, 0xe175efe0, 0x3a624777, 0x736f20fa,
+    0xc9650ce8, 0x80686b65, 0x5b7fc3f2, 0x1272a47f, 0xe9918f6b, 0xa09ce8e6, 0x7b8b4071, 0x328627fc,
+    0x083b044d, 0x413663c0, 0x9a21cb57, 0xd32cacda, 0x28cf87ce, 0x61c2e043, 0xbad548d4, 0xf3d82f59,
+    0x49d2034b, 0x00df64c6, 0xdbc8cc51, 0x92c5abdc, 0x692680c8, 0x202be745, 0xfb3c4fd2, 0xb231285f,
+    0x8be90a41, 0xc2e46dcc, 0x19f3c55b, 0x50fea2d6, 0xab1d89c2, 0xe210ee4f, 0x390746d8, 0x700a2155,
+    0xca000d47, 0x830d6aca, 0x581ac25d, 0x1117a5d0, 0xeaf48ec4, 0xa3f9e949, 0x78ee41de, 0x31e32653,
+  },
+  {
+    0x00000000, 0x1b280d78, 0x36501af0, 0x2d781788, 0x6ca035e0, 0x77883898, 0x5af02f10, 0x41d82268,
+    0xd9406bc0, 0xc26866b8, 0xef107130, 0xf4387c48, 0xb5e05e20, 0xaec85358, 0x83b044d0, 0x989849a8,
+    0xb641ca37, 0xad69c74f, 0x8011d0c7, 0x9b39ddbf, 0xdae1ffd7, 0xc1c9f2af, 0xecb1e527, 0xf799e85f,
+    0x6f01a1f7, 0x7429ac8f, 0x5951bb07, 0x4279b67f, 0x03a19417, 0x1889996f, 0x35f18ee7, 0x2ed9839f,
+    0x684289d9, 0x736a84a1, 0x5e129329, 0x453a9e51, 0x04e2bc39, 0x1fcab141, 0x32b2a6c9, 0x299aabb1,
+    0xb102e219, 0xaa2aef61, 0x8752f8e9, 0x9c7af591, 0xdda2d7f9, 0xc68ada81, 0xebf2cd09, 0xf0dac071,
+    0xde0343ee, 0xc52b4e96, 0xe853591e, 0xf37b5466, 0xb2a3760e, 0xa98b7b76, 0x84f36cfe, 0x9fdb6186,
+    0x0743282e, 0x1c6b2556, 0x311332de, 0x2a3b3fa6, 0x6be31dce, 0x70cb10b6, 0x5db3073e, 0x469b0a46,
+    0xd08513b2, 0xcbad1eca, 0xe6d50942, 0xfdfd043a, 0xbc252652, 0xa70d2b2a, 0x8a753ca2, 0x915d31da,
+    0x09c57872, 0x12ed750a, 0x3f956282, 0x24bd6ffa, 0x65654d92, 0x7e4d40ea, 0x53355762, 0x481d5a1a,
+    0x66c4d985, 0x7decd4fd, 0x5094c375, 0x4bbcce0d, 0x0a64ec65, 0x114ce11d, 0x3c34f695, 0x271cfbed,
+    0xbf84b245, 0xa4acbf3d, 0x89d4a8b5, 0x92fca5cd, 0xd32487a5, 0xc80c8add, 0xe5749d55, 0xfe5c902d,
+    0xb8c79a6b, 0xa3ef9713, 0x8e97809b, 0x95bf8de3, 0xd467af8b, 0xcf4fa2f3, 0xe237b57b, 0xf91fb803,
+    0x6187f1ab, 0x7aaffcd3, 0x57d7eb5b, 0x4cffe623, 0x0d27c44b, 0x160fc933, 0x3b77debb, 0x205fd3c3,
+    0x0e86505c, 0x15ae5d24, 0x38d64aac, 0x23fe47d4, 0x622665bc, 0x790e68c4, 0x54767f4c, 0x4f5e7234,
+    0xd7c63b9c, 0xccee36e4, 0xe196216c, 0xfabe2c14, 0xbb660e7c, 0xa04e0304, 0x8d36148c, 0x961e19f4,
+    0xa5cb3ad3, 0xbee337ab, 0x939b2023, 0x88b32d5b, 0xc96b0f33, 0xd243024b, 0xff3b15c3, 0xe41318bb,
+    0x7c8b5113, 0x67a35c6b, 0x4adb4be3, 0x51f3469b, 0x102b64f3, 0x0b03698b, 0x267b7e03, 0x3d53737b,
+    0x138af0e4, 0x08a2fd9c, 0x25daea14, 0x3ef2e76c, 0x7f2ac504, 0x6402c87c, 0x497adff4, 0x5252d28c,
+    0xcaca9b24, 0xd1e2965c, 0xfc9a81d4, 0xe7b28cac, 0xa66aaec4, 0xbd42a3bc, 0x903ab434, 0x8b12b94c,
+    0xcd89b30a, 0xd6a1be72, 0xfbd9a9fa, 0xe0f1a482, 0xa12986ea, 0xba018b92, 0x97799c1a, 0x8c519162,
+    0x14c9d8ca, 0x0fe1d5b2, 0x2299c23a, 0x39b1cf42, 0x7869ed2a, 0x6341e052, 0x4e39f7da, 0x5511faa2,
+    0x7bc8793d, 0x60e07445, 0x4d9863cd, 0x56b06eb5, 0x17684cdd, 0x0c4041a5, 0x2138562d, 0x3a105b55,
+    0xa28812fd, 0xb9a01f85, 0x94d8080d, 0x8ff00575, 0xce28271d, 0xd5002a65, 0xf8783ded, 0xe3503095,
+    0x754e2961, 0x6e662419, 0x431e3391, 0x58363ee9, 0x19ee1c81, 0x02c611f9, 0x2fbe0671, 0x34960b09,
+    0xac0e42a1, 0xb7264fd9, 0x9a5e5851, 0x81765529, 0xc0ae7741, 0xdb867a39, 0xf6fe6db1, 0xedd660c9,
+    0xc30fe356, 0xd827ee2e, 0xf55ff9a6, 0xee77f4de, 0xafafd6b6, 0xb487dbce, 0x99ffcc46, 0x82d7c13e,
+    0x1a4f8896, 0x016785ee, 0x2c1f9266, 0x37379f1e, 0x76efbd76, 0x6dc7b00e, 0x40bfa786, 0x5b97aafe,
+    0x1d0ca0b8, 0x0624adc0, 0x2b5cba48, 0x3074b730, 0x71ac9558, 0x6a849820, 0x47fc8fa8, 0x5cd482d0,
+    0xc44ccb78, 0xdf64c600, 0xf21cd188, 0xe934dcf0, 0xa8ecfe98, 0xb3c4f3e0, 0x9ebce468, 0x8594e910,
+    0xab4d6a8f, 0xb06567f7, 0x9d1d707f, 0x86357d07, 0xc7ed5f6f, 0xdcc55217, 0xf1bd459f, 0xea9548e7,
+    0x720d014f, 0x69250c37, 0x445d1bbf, 0x5f7516c7, 0x1ead34af, 0x058539d7, 0x28fd2e5f, 0x33d52327,
+  },
+  {
+    0x00000000, 0x4f576811, 0x9eaed022, 0xd1f9b833, 0x399cbdf3, 0x76cbd5e2, 0xa7326dd1, 0xe86505c0,
+    0x73397be6, 0x3c6e13f7, 0xed97abc4, 0xa2c0c3d5, 0x4aa5c615, 0x05f2ae04, 0xd40b1637, 0x9b5c7e26,
+    0xe672f7cc, 0xa9259fdd, 0x78dc27ee, 0x378b4fff, 0xdfee4a3f, 0x90b9222e, 0x41409a1d, 0x0e17f20c,
+    0x954b8c2a, 0xda1ce43b, 0x0be55c08, 0x44b23419, 0xacd731d9, 0xe38059c8, 0x3279e1fb, 0x7d2e89ea,
+    0xc824f22f, 0x87739a3e, 0x568a220d, 0x19dd4a1c, 0xf1b84fdc, 0xbeef27cd, 0x6f169ffe, 0x2041f7ef,
+    0xbb1d89c9, 0xf44ae1d8, 0x25b359eb, 0x6ae431fa, 0x8281343a, 0xcdd65c2b, 0x1c2fe418, 0x53788c09,
+    0x2e5605e3, 0x61016df2, 0xb0f8d5c1, 0xffafbdd0, 0x17cab810, 0x589dd001, 0x89646832, 0xc6330023,
+    0x5d6f7e05, 0x12381614, 0xc3c1ae27, 0x8c96c636, 0x64f3c3f6, 0x2ba4abe7, 0xfa5d13d4, 0xb50a7bc5,
+    0x9488f9e9, 0xdbdf91f8, 0x0a2629cb, 0x457141da, 0xad14441a, 0xe2432c0b, 0x33ba9438, 0x7cedfc29,
+    0xe7b1820f, 0xa8e6ea1e, 0x791f522d, 0x36483a3c, 0xde2d3ffc, 0x917a57ed, 0x4083efde, 0x0fd487cf,
+    0x72fa0e25, 0x3dad6634, 0xec54de07, 0xa303b616, 0x4b66b3d6, 0x0431dbc7, 0xd5c863f4, 0x9a9f0be5,
+    0x01c375c3, 0x4e941dd2, 0x9f6da5e1, 0xd03acdf0, 0x385fc830, 0x7708a021, 0xa6f11812, 0xe9a67003,
+    0x5cac0bc6, 0x13fb63d7, 0xc202dbe4, 0x8d55b3f5, 0x6530b635, 0x2a67de24, 0xfb9e6617, 0xb4c90e06,
+    0x2f957020, 0x60c21831, 0xb13ba002, 0xfe6cc813, 0x1609cdd3, 0x595ea5c2, 0x88a71df1, 0xc7f075e0,
+    0xbadefc0a, 0xf589941b, 0x24702c28, 0x6b274439, 0x834241f9, 0xcc1529e8, 0x1dec91db, 0x52bbf9ca,
+    0xc9e787ec, 0x86b0effd, 0x574957ce, 0x181e3fdf, 0xf07b3a1f, 0xbf2c520e, 0x6ed5ea3d, 0x2182822c,
+    0x2dd0ee65, 0x62878674, 0xb37e3e47, 0xfc295656, 0x144c5396, 0x5b1b3b87, 0x8ae283b4, 0xc5b5eba5,
+    0x5ee99583, 0x11befd92, 0xc04745a1, 0x8f102db0, 0x67752870, 0x28224061, 0xf9dbf852, 0xb68c9043,
+    0xcba219a9, 0x84f571b8, 0x550cc98b, 0x1a5ba19a, 0xf23ea45a, 0xbd69cc4b, 0x6c907478, 0x23c71c69,
+    0xb89b624f, 0xf7cc0a5e, 0x2635b26d, 0x6962da7c, 0x8107dfbc, 0xce50b7ad, 0x1fa90f9e, 0x50fe678f,
+    0xe5f41c4a, 0xaaa3745b, 0x7b5acc68, 0x340da479, 0xdc68a1b9, 0x933fc9a8, 0x42c6719b, 0x0d91198a,
+    0x96cd67ac, 0xd99a0fbd, 0x0863b78e, 0x4734df9f, 0xaf51da5f, 0xe006b24e, 0x31ff0a7d, 0x7ea8626c,
+    0x0386eb86, 0x4cd18397, 0x9d283ba4, 0xd27f53b5, 0x3a1a5675, 0x754d3e64, 0xa4b48657, 0xebe3ee46,
+    0x70bf9060, 0x3fe8f871, 0xee114042, 0xa1462853, 0x49232d93, 0x06744582, 0xd78dfdb1, 0x98da95a0,
+    0xb958178c, 0xf60f7f9d, 0x27f6c7ae, 0x68a1afbf, 0x80c4aa7f, 0xcf93c26e, 0x1e6a7a5d, 0x513d124c,
+    0xca616c6a, 0x8536047b, 0x54cfbc48, 0x1b98d459, 0xf3fdd199, 0xbcaab988, 0x6d5301bb, 0x220469aa,
+    0x5f2ae040, 0x107d8851, 0xc1843062, 0x8ed35873, 0x66b65db3, 0x29e135a2, 0xf8188d91, 0xb74fe580,
+    0x2c139ba6, 0x6344f3b7, 0xb2bd4b84, 0xfdea2395, 0x158f2655, 0x5ad84e44, 0x8b21f677, 0xc4769e66,
+    0x717ce5a3, 0x3e2b8db2, 0xefd23581, 0xa0855d90, 0x48e05850, 0x07b73041, 0xd64e8872, 0x9919e063,
+    0x02459e45, 0x4d12f654, 0x9ceb4e67, 0xd3bc2676, 0x3bd923b6, 0x748e4ba7, 0xa577f394, 0xea209b85,
+    0x970e126f, 0xd8597a7e, 0x09a0c24d, 0x46f7aa5c, 0xae92af9c, 0xe1c5c78d, 0x303c7fbe, 0x7f6b17af,
+    0xe4376989, 0xab600198, 0x7a99b9ab, 0x35ced1ba, 0xddabd47a, 0x92fcbc6b, 0x43050458, 0x0c526c49,
+  },
+  {
+    0x00000000, 0x5ba1dcca, 0xb743b994, 0xece2655e, 0x6a466e9f, 0x31e7b255, 0xdd05d70b, 0x86a40bc1,
+    0xd48cdd3e, 0x8f2d01f4, 0x63cf64aa, 0x386eb860, 0xbecab3a1, 0xe56b6f6b, 0x09890a35, 0x5228d6ff,
+    0xadd8a7cb, 0xf6797b01, 0x1a9b1e5f, 0x413ac295, 0xc79ec954, 0x9c3f159e, 0x70dd70c0, 0x2b7cac0a,
+    0x79547af5, 0x22f5a63f, 0xce17c361, 0x95b61fab, 0x1312146a, 0x48b3c8a0, 0xa451adfe, 0xfff07134,
+    0x5f705221, 0x04d18eeb, 0xe833ebb5, 0xb392377f, 0x35363cbe, 0x6e97e074, 0x8275852a, 0xd9d459e0,
+    0x8bfc8f1f, 0xd05d53d5, 0x3cbf368b, 0x671eea41, 0xe1bae180, 0xba1b3d4a, 0x56f95814, 0x0d5884de,
+    0xf2a8f5ea, 0xa9092920, 0x45eb4c7e, 0x1e4a90b4, 0x98ee9b75, 0xc34f47bf, 0x2fad22e1, 0x740cfe2b,
+    0x262428d4, 0x7d85f41e, 0x91679140, 0xcac64d8a, 0x4c62464b, 0x17c39a81, 0xfb21ffdf, 0xa0802315,
+    0xbee0a442, 0xe5417888, 0x09a31dd6, 0x5202c11c, 0xd4a6cadd, 0x8f071617, 0x63e57349, 0x3844af83,
+    0x6a6c797c, 0x31cda5b6, 0xdd2fc0e8, 0x868e1c22, 0x002a17e3, 0x5b8bcb29, 0xb769ae77, 0xecc872bd,
+    0x13380389, 0x4899df43, 0xa47bba1d, 0xffda66d7, 0x797e6d16, 0x22dfb1dc, 0xce3dd482, 0x959c0848,
+    0xc7b4deb7, 0x9c15027d, 0x70f76723, 0x2b56bbe9, 0xadf2b028, 0xf6536ce2, 0x1ab109bc, 0x4110d576,
+    0xe190f663, 0xba312aa9, 0x56d34ff7, 0x0d72933d, 0x8bd698fc, 0xd0774436, 0x3c952168, 0x6734fda2,
+    0x351c2b5d, 0x6ebdf797, 0x825f92c9, 0xd9fe4e03, 0x5f5a45c2, 0x04fb9908, 0xe819fc56, 0xb3b8209c,
+    0x4c4851a8, 0x17e98d62, 0xfb0be83c, 0xa0aa34f6, 0x260e3f37, 0x7dafe3fd, 0x914d86a3, 0xcaec5a69,
+    0x98c48c96, 0xc365505c, 0x2f873502, 0x7426e9c8, 0xf282e209, 0xa9233ec3, 0x45c15b9d, 0x1e608757,
+    0x79005533, 0x22a189f9, 0xce43eca7, 0x95e2306d, 0x13463bac, 0x48e7e766, 0xa4058238, 0xffa45ef2,
+    0xad8c880d, 0xf62d54c7, 0x1acf3199, 0x416eed53, 0xc7cae692, 0x9c6b3a58, 0x70895f06, 0x2b2883cc,
+    0xd4d8f2f8, 0x8f792e32, 0x639b4b6c, 0x383a97a6, 0xbe9e9c67, 0xe53f40ad, 0x09dd25f3, 0x527cf939,
+    0x00542fc6, 0x5bf5f30c, 0xb7179652, 0xecb64a98, 0x6a124159, 0x31b39d93, 0xdd51f8cd, 0x86f02407,
+    0x26700712, 0x7dd1dbd8, 0x9133be86, 0xca92624c, 0x4c36698d, 0x1797b547, 0xfb75d019, 0xa0d40cd3,
+    0xf2fcda2c, 0xa95d06e6, 0x45bf63b8, 0x1e1ebf72, 0x98bab4b3, 0xc31b6879, 0x2ff90d27, 0x7458d1ed,
+    0x8ba8a0d9, 0xd0097c13, 0x3ceb194d, 0x674ac587, 0xe1eece46, 0xba4f128c, 0x56ad77d2, 0x0d0cab18,
+    0x5f247de7, 0x0485a12d, 0xe867c473, 0xb3c618b9, 0x35621378, 0x6ec3cfb2, 0x8221aaec, 0xd9807626,
+    0xc7e0f171, 0x9c412dbb, 0x70a348e5, 0x2b02942f, 0xada69fee, 0xf6074324, 0x1ae5267a, 0x4144fab0,
+    0x136c2c4f, 0x48cdf085, 0xa42f95db, 0xff8e4911, 0x792a42d0, 0x228b9e1a, 0xce69fb44, 0x95c8278e,
+    0x6a3856ba, 0x31998a70, 0xdd7bef2e, 0x86da33e4, 0x007e3825, 0x5bdfe4ef, 0xb73d81b1, 0xec9c5d7b,
+    0xbeb48b84, 0xe515574e, 0x09f73210, 0x5256eeda, 0xd4f2e51b, 0x8f5339d1, 0x63b15c8f, 0x38108045,
+    0x9890a350, 0xc3317f9a, 0x2fd31ac4, 0x7472c60e, 0xf2d6cdcf, 0xa9771105, 0x4595745b, 0x1e34a891,
+    0x4c1c7e6e, 0x17bda2a4, 0xfb5fc7fa, 0xa0fe1b30, 0x265a10f1, 0x7dfbcc3b, 0x9119a965, 0xcab875af,
+    0x3548049b, 0x6ee9d851, 0x820bbd0f, 0xd9aa61c5, 0x5f0e6a04, 0x04afb6ce, 0xe84dd390, 0xb3ec0f5a,
+    0xe1c4d9a5, 0xba65056f, 0x56876031, 0x0d26bcfb, 0x8b82b73a, 0xd0236bf0, 0x3cc10eae, 0x6760d264,
+  },
+  {
+    0x00000000, 0xf200aa66, 0xe0c0497b, 0x12c0e31d, 0xc5418f41, 0x37412527, 0x2581c63a, 0xd7816c5c,
+    0x8e420335, 0x7c42a953, 0x6e824a4e, 0x9c82e028, 0x4b038c74, 0xb9032612, 0xabc3c50f, 0x59c36f69,
+    0x18451bdd, 0xea45b1bb, 0xf88552a6, 0x0a85f8c0, 0xdd04949c, 0x2f043efa, 0x3dc4dde7, 0xcfc47781,
+    0x960718e8, 0x6407b28e, 0x76c75193, 0x84c7fbf5, 0x534697a9, 0xa1463dcf, 0xb386ded2, 0x418674b4,
+    0x308a37ba, 0xc28a9ddc, 0xd04a7ec1, 0x224ad4a7, 0xf5cbb8fb, 0x07cb129d, 0x150bf180, 0xe70b5be6,
+    0xbec8348f, 0x4cc89ee9, 0x5e087df4, 0xac08d792, 0x7b89bbce, 0x898911a8, 0x9b49f2b5, 0x694958d3,
+    0x28cf2c67, 0xdacf8601, 0xc80f651c, 0x3a0fcf7a, 0xed8ea326, 0x1f8e0940, 0x0d4eea5d, 0xff4e403b,
+    0xa68d2f52, 0x548d8534, 0x464d6629, 0xb44dcc4f, 0x63cca013, 0x91cc0a75, 0x830ce968, 0x710c430e,
+    0x61146f74, 0x9314c512, 0x81d4260f, 0x73d48c69, 0xa455e035, 0x56554a53, 0x4495a94e, 0xb6950328,
+    0xef566c41, 0x1d56c627, 0x0f96253a, 0xfd968f5c, 0x2a17e300, 0xd8174966, 0xcad7aa7b, 0x38d7001d,
+    0x795174a9, 0x8b51decf, 0x99913dd2, 0x6b9197b4, 0xbc10fbe8, 0x4e10518e, 0x5cd0b293, 0xaed018f5,
+    0xf713779c, 0x0513ddfa, 0x17d33ee7, 0xe5d39481, 0x3252f8dd, 0xc05252bb, 0xd292b1a6, 0x20921bc0,
+    0x519e58ce, 0xa39ef2a8, 0xb15e11b5, 0x435ebbd3, 0x94dfd78f, 0x66df7de9, 0x741f9ef4, 0x861f3492,
+    0xdfdc5bfb, 0x2ddcf19d, 0x3f1c1280, 0xcd1cb8e6, 0x1a9dd4ba, 0xe89d7edc, 0xfa5d9dc1, 0x085d37a7,
+    0x49db4313, 0xbbdbe975, 0xa91b0a68, 0x5b1ba00e, 0x8c9acc52, 0x7e9a6634, 0x6c5a8529, 0x9e5a2f4f,
+    0xc7994026, 0x3599ea40, 0x2759095d, 0xd559a33b, 0x02d8cf67, 0xf0d86501, 0xe218861c, 0x10182c7a,
+    0xc228dee8, 0x3028748e, 0x22e89793, 0xd0e83df5, 0x076951a9, 0xf569fbcf, 0xe7a918d2, 0x15a9b2b4,
+    0x4c6adddd, 0xbe6a77bb, 0xacaa94a6, 0x5eaa3ec0, 0x892b529c, 0x7b2bf8fa, 0x69eb1be7, 0x9bebb181,
+    0xda6dc535, 0x286d6f53, 0x3aad8c4e, 0xc8ad2628, 0x1f2c4a74, 0xed2ce012, 0xffec030f, 0x0deca969,
+    0x542fc600, 0xa62f6c66, 0xb4ef8f7b, 0x46ef251d, 0x916e4941, 0x636ee327, 0x71ae003a, 0x83aeaa5c,
+    0xf2a2e952, 0x00a24334, 0x1262a029, 0xe0620a4f, 0x37e36613, 0xc5e3cc75, 0xd7232f68, 0x2523850e,
+    0x7ce0ea67, 0x8ee04001, 0x9c20a31c, 0x6e20097a, 0xb9a16526, 0x4ba1cf40, 0x59612c5d, 0xab61863b,
+    0xeae7f28f, 0x18e758e9, 0x0a27bbf4, 0xf8271192, 0x2fa67dce, 0xdda6d7a8, 0xcf6634b5, 0x3d669ed3,
+    0x64a5f1ba, 0x96a55bdc, 0x8465b8c1, 0x766512a7, 0xa1e47efb, 0x53e4d49d, 0x41243780, 0xb3249de6,
+    0xa33cb19c, 0x513c1bfa, 0x43fcf8e7, 0xb1fc5281, 0x667d3edd, 0x947d94bb, 0x86bd77a6, 0x74bdddc0,
+    0x2d7eb2a9, 0xdf7e18cf, 0xcdbefbd2, 0x3fbe51b4, 0xe83f3de8, 0x1a3f978e, 0x08ff7493, 0xfaffdef5,
+    0xbb79aa41, 0x49790027, 0x5bb9e33a, 0xa9b9495c, 0x7e382500, 0x8c388f66, 0x9ef86c7b, 0x6cf8c61d,
+    0x353ba974, 0xc73b0312, 0xd5fbe00f, 0x27fb4a69, 0xf07a2635, 0x027a8c53, 0x10ba6f4e, 0xe2bac528,
+    0x93b68626, 0x61b62c40, 0x7376cf5d, 0x8176653b, 0x56f70967, 0xa4f7a301, 0xb637401c, 0x4437ea7a,
+    0x1df48513, 0xeff42f75, 0xfd34cc68, 0x0f34660e, 0xd8b50a52, 0x2ab5a034, 0x38754329, 0xca75e94f,
+    0x8bf39dfb, 0x79f3379d, 0x6b33d480, 0x99337ee6, 0x4eb212ba, 0xbcb2b8dc, 0xae725bc1, 0x5c72f1a7,
+    0x05b19ece, 0xf7b134a8, 0xe571d7b5, 0x17717dd3, 0xc0f0118f, 0x32f0bbe9, 0x203058f4, 0xd230f292,
+  },
+  {
+    0x00000000, 0x8090a067, 0x05e05d79, 0x8570fd1e, 0x0bc0baf2, 0x8b501a95, 0x0e20e78b, 0x8eb047ec,
+    0x178175e4, 0x9711d583, 0x1261289d, 0x92f188fa, 0x1c41cf16, 0x9cd16f71, 0x19a1926f, 0x99313208,
+    0x2f02ebc8, 0xaf924baf, 0x2ae2b6b1, 0xaa7216d6, 0x24c2513a, 0xa452f15d, 0x21220c43, 0xa1b2ac24,
+    0x38839e2c, 0xb8133e4b, 0x3d63c355, 0xbdf36332, 0x334324de, 0xb3d384b9, 0x36a379a7, 0xb633d9c0,
+    0x5e05d790, 0xde9577f7, 0x5be58ae9, 0xdb752a8e, 0x55c56d62, 0xd555cd05, 0x5025301b, 0xd0b5907c,
+    0x4984a274, 0xc9140213, 0x4c64ff0d, 0xccf45f6a, 0x42441886, 0xc2d4b8e1, 0x47a445ff, 0xc734e598,
+    0x71073c58, 0xf1979c3f, 0x74e76121, 0xf477c146, 0x7ac786aa, 0xfa5726cd, 0x7f27dbd3, 0xffb77bb4,
+    0x668649bc, 0xe616e9db, 0x636614c5, 0xe3f6b4a2, 0x6d46f34e, 0xedd65329, 0x68a6ae37, 0xe8360e50,
+    0xbc0baf20, 0x3c9b0f47, 0xb9ebf259, 0x397b523e, 0xb7cb15d2, 0x375bb5b5, 0xb22b48ab, 0x32bbe8cc,
+    0xab8adac4, 0x2b1a7aa3, 0xae6a87bd, 0x2efa27da, 0xa04a6036, 0x20dac051, 0xa5aa3d4f, 0x253a9d28,
+    0x930944e8, 0x1399e48f, 0x96e91991, 0x1679b9f6, 0x98c9fe1a, 0x18595e7d, 0x9d29a363, 0x1db90304,
+    0x8488310c, 0x0418916b, 0x81686c75, 0x01f8cc12, 0x8f488bfe, 0x0fd82b99, 0x8aa8d687, 0x0a3876e0,
+    0xe20e78b0, 0x629ed8d7, 0xe7ee25c9, 0x677e85ae, 0xe9cec242, 0x695e6225, 0xec2e9f3b, 0x6cbe3f5c,
+    0xf58f0d54, 0x751fad33, 0xf06f502d, 0x70fff04a, 0xfe4fb7a6, 0x7edf17c1, 0xfbafeadf, 0x7b3f4ab8,
+    0xcd0c9378, 0x4d9c331f, 0xc8ecce01, 0x487c6e66, 0xc6cc298a, 0x465c89ed, 0xc32c74f3, 0x43bcd494,
+    0xda8de69c, 0x5a1d46fb, 0xdf6dbbe5, 0x5ffd1b82, 0xd14d5c6e, 0x51ddfc09, 0xd4ad0117, 0x543da170,
+    0x7cd643f7, 0xfc46e390, 0x79361e8e, 0xf9a6bee9, 0x7716f905, 0xf7865962, 0x72f6a47c, 0xf266041b,
+    0x6b573613, 0xebc79674, 0x6eb76b6a, 0xee27cb0d, 0x60978ce1, 0xe0072c86, 0x6577d198, 0xe5e771ff,
+    0x53d4a83f, 0xd3440858, 0x5634f546, 0xd6a45521, 0x581412cd, 0xd884b2aa, 0x5df44fb4, 0xdd64efd3,
+    0x4455dddb, 0xc4c57dbc, 0x41b580a2, 0xc12520c5, 0x4f956729, 0xcf05c74e, 0x4a753a50, 0xcae59a37,
+    0x22d39467, 0xa2433400, 0x2733c91e, 0xa7a36979, 0x29132e95, 0xa9838ef2, 0x2cf373ec, 0xac63d38b,
+    0x3552e183, 0xb5c241e4, 0x30b2bcfa, 0xb0221c9d, 0x3e925b71, 0xbe02fb16, 0x3b720608, 0xbbe2a66f,
+    0x0dd17faf, 0x8d41dfc8, 0x083122d6, 0x88a182b1, 0x0611c55d, 0x8681653a, 0x03f19824, 0x83613843,
+    0x1a500a4b, 0x9ac0aa2c, 0x1fb05732, 0x9f20f755, 0x1190b0b9, 0x910010de, 0x1470edc0, 0x94e04da7,
+    0xc0ddecd7, 0x404d4cb0, 0xc53db1ae, 0x45ad11c9, 0xcb1d5625, 0x4b8df642, 0xcefd0b5c, 0x4e6dab3b,
+    0xd75c9933, 0x57cc3954, 0xd2bcc44a, 0x522c642d, 0xdc9c23c1, 0x5c0c83a6, 0xd97c7eb8, 0x59ecdedf,
+    0xefdf071f, 0x6f4fa778, 0xea3f5a66, 0x6aaffa01, 0xe41fbded, 0x648f1d8a, 0xe1ffe094, 0x616f40f3,
+    0xf85e72fb, 0x78ced29c, 0xfdbe2f82, 0x7d2e8fe5, 0xf39ec809, 0x730e686e, 0xf67e9570, 0x76ee3517,
+    0x9ed83b47, 0x1e489b20, 0x9b38663e, 0x1ba8c659, 0x951881b5, 0x158821d2, 0x90f8dccc, 0x10687cab,
+    0x89594ea3, 0x09c9eec4, 0x8cb913da, 0x0c29b3bd, 0x8299f451, 0x02095436, 0x8779a928, 0x07e9094f,
+    0xb1dad08f, 0x314a70e8, 0xb43a8df6, 0x34aa2d91, 0xba1a6a7d, 0x3a8aca1a, 0xbffa3704, 0x3f6a9763,
+    0xa65ba56b, 0x26cb050c, 0xa3bbf812, 0x232b5875, 0xad9b1f99, 0x2d0bbffe, 0xa87b42e0, 0x28ebe287,
+  },
+  {
+    0x00000000, 0xf9ac87ee, 0xf798126b, 0x0e349585, 0xebf13961, 0x125dbe8f, 0x1c692b0a, 0xe5c5ace4,
+    0xd3236f75, 0x2a8fe89b, 0x24bb7d1e, 0xdd17faf0, 0x38d25614, 0xc17ed1fa, 0xcf4a447f, 0x36e6c391,
+    0xa287c35d, 0x5b2b44b3, 0x551fd136, 0xacb356d8, 0x4976fa3c, 0xb0da7dd2, 0xbeeee857, 0x47426fb9,
+    0x71a4ac28, 0x88082bc6, 0x863cbe43, 0x7f9039ad, 0x9a559549, 0x63f912a7, 0x6dcd8722, 0x946100cc,
+    0x41ce9b0d, 0xb8621ce3, 0xb6568966, 0x4ffa0e88, 0xaa3fa26c, 0x53932582, 0x5da7b007, 0xa40b37e9,
+    0x92edf478, 0x6b417396, 0x6575e613, 0x9cd961fd, 0x791ccd19, 0x80b04af7, 0x8e84df72, 0x7728589c,
+    0xe3495850, 0x1ae5dfbe, 0x14d14a3b, 0xed7dcdd5, 0x08b86131, 0xf114e6df, 0xff20735a, 0x068cf4b4,
+    0x306a3725, 0xc9c6b0cb, 0xc7f2254e, 0x3e5ea2a0, 0xdb9b0e44, 0x223789aa, 0x2c031c2f, 0xd5af9bc1,
+    0x839d361a, 0x7a31b1f4, 0x74052471, 0x8da9a39f, 0x686c0f7b, 0x91c08895, 0x9ff41d10, 0x66589afe,
+    0x50be596f, 0xa912de81, 0xa7264b04, 0x5e8accea, 0xbb4f600e, 0x42e3e7e0, 0x4cd77265, 0xb57bf58b,
+    0x211af547, 0xd8b672a9, 0xd682e72c, 0x2f2e60c2, 0xcaebcc26, 0x33474bc8, 0x3d73de4d, 0xc4df59a3,
+    0xf2399a32, 0x0b951ddc, 0x05a18859, 0xfc0d0fb7, 0x19c8a353, 0xe06424bd, 0xee50b138, 0x17fc36d6,
+    0xc253ad17, 0x3bff2af9, 0x35cbbf7c, 0xcc673892, 0x29a29476, 0xd00e1398, 0xde3a861d, 0x279601f3,
+    0x1170c262, 0xe8dc458c, 0xe6e8d009, 0x1f4457e7, 0xfa81fb03, 0x032d7ced, 0x0d19e968, 0xf4b56e86,
+    0x60d46e4a, 0x9978e9a4, 0x974c7c21, 0x6ee0fbcf, 0x8b25572b, 0x7289d0c5, 0x7cbd4540, 0x8511c2ae,
+    0xb3f7013f, 0x4a5b86d1, 0x446f1354, 0xbdc394ba, 0x5806385e, 0xa1aabfb0, 0xaf9e2a35, 0x5632addb,
+    0x03fb7183, 0xfa57f66d, 0xf46363e8, 0x0dcfe406, 0xe80a48e2, 0x11a6cf0c, 0x1f925a89, 0xe63edd67,
+    0xd0d81ef6, 0x29749918, 0x27400c9d, 0xdeec8b73, 0x3b292797, 0xc285a079, 0xccb135fc, 0x351db212,
+    0xa17cb2de, 0x58d03530, 0x56e4a0b5, 0xaf48275b, 0x4a8d8bbf, 0xb3210c51, 0xbd1599d4, 0x44b91e3a,
+    0x725fddab, 0x8bf35a45, 0x85c7cfc0, 0x7c6b482e, 0x99aee4ca, 0x60026324, 0x6e36f6a1, 0x979a714f,
+    0x4235ea8e, 0xbb996d60, 0xb5adf8e5, 0x4c017f0b, 0xa9c4d3ef, 0x50685401, 0x5e5cc184, 0xa7f0466a,
+    0x911685fb, 0x68ba0215, 0x668e9790, 0x9f22107e, 0x7ae7bc9a, 0x834b3b74, 0x8d7faef1, 0x74d3291f,
+    0xe0b229d3, 0x191eae3d, 0x172a3bb8, 0xee86bc56, 0x0b4310b2, 0xf2ef975c, 0xfcdb02d9, 0x05778537,
+    0x339146a6, 0xca3dc148, 0xc40954cd, 0x3da5d323, 0xd8607fc7, 0x21ccf829, 0x2ff86dac, 0xd654ea42,
+    0x80664799, 0x79cac077, 0x77fe55f2, 0x8e52d21c, 0x6b977ef8, 0x923bf916, 0x9c0f6c93, 0x65a3eb7d,
+    0x534528ec, 0xaae9af02, 0xa4dd3a87, 0x5d71bd69, 0xb8b4118d, 0x41189663, 0x4f2c03e6, 0xb6808408,
+    0x22e184c4, 0xdb4d032a, 0xd57996af, 0x2cd51141, 0xc910bda5, 0x30bc3a4b, 0x3e88afce, 0xc7242820,
+    0xf1c2ebb1, 0x086e6c5f, 0x065af9da, 0xfff67e34, 0x1a33d2d0, 0xe39f553e, 0xedabc0bb, 0x14074755,
+    0xc1a8dc94, 0x38045b7a, 0x3630ceff, 0xcf9c4911, 0x2a59e5f5, 0xd3f5621b, 0xddc1f79e, 0x246d7070,
+    0x128bb3e1, 0xeb27340f, 0xe513a18a, 0x1cbf2664, 0xf97a8a80, 0x00d60d6e, 0x0ee298eb, 0xf74e1f05,
+    0x632f1fc9, 0x9a839827, 0x94b70da2, 0x6d1b8a4c, 0x88de26a8, 0x7172a146, 0x7f4634c3, 0x86eab32d,
+    0xb00c70bc, 0x49a0f752, 0x479462d7, 0xbe38e539, 0x5bfd49dd, 0xa251ce33, 0xac655bb6, 0x55c9dc58,
+  },
+  {
+    0x00000000, 0x07f6e306, 0x0fedc60c, 0x081b250a, 0x1fdb8c18, 0x182d6f1e, 0x10364a14, 0x17c0a912,
+    0x3fb71830, 0x3841fb36, 0x305ade3c, 0x37ac3d3a, 0x206c9428, 0x279a772e, 0x2f815224, 0x2877b122,
+    0x7f6e3060, 0x7898d366, 0x7083f66c, 0x7775156a, 0x60b5bc78, 0x67435f7e, 0x6f587a74, 0x68ae9972,
+    0x40d92850, 0x472fcb56, 0x4f34ee5c, 0x48c20d5a, 0x5f02a448, 0x58f4474e, 0x50ef6244, 0x57198142,
+    0xfedc60c0, 0xf92a83c6, 0xf131a6cc, 0xf6c745ca, 0xe107ecd8, 0xe6f10fde, 0xeeea2ad4, 0xe91cc9d2,
+    0xc16b78f0, 0xc69d9bf6, 0xce86befc, 0xc9705dfa, 0xdeb0f4e8, 0xd94617ee, 0xd15d32e4, 0xd6abd1e2,
+    0x81b250a0, 0x8644b3a6, 0x8e5f96ac, 0x89a975aa, 0x9e69dcb8, 0x999f3fbe, 0x91841ab4, 0x9672f9b2,
+    0xbe054890, 0xb9f3ab96, 0xb1e88e9c, 0xb61e6d9a, 0xa1dec488, 0xa628278e, 0xae330284, 0xa9c5e182,
+    0xf979dc37, 0xfe8f3f31, 0xf6941a3b, 0xf162f93d, 0xe6a2502f, 0xe154b329, 0xe94f9623, 0xeeb97525,
+    0xc6cec407, 0xc1382701, 0xc923020b, 0xced5e10d, 0xd915481f, 0xdee3ab19, 0xd6f88e13, 0xd10e6d15,
+    0x8617ec57, 0x81e10f51, 0x89fa2a5b, 0x8e0cc95d, 0x99cc604f, 0x9e3a8349, 0x9621a643, 0x91d74545,
+    0xb9a0f467, 0xbe561761, 0xb64d326b, 0xb1bbd16d, 0xa67b787f, 0xa18d9b79, 0xa996be73, 0xae605d75,
+    0x07a5bcf7, 0x00535ff1, 0x08487afb, 0x0fbe99fd, 0x187e30ef, 0x1f88d3e9, 0x1793f6e3, 0x106515e5,
+    0x3812a4c7, 0x3fe447c1, 0x37ff62cb, 0x300981cd, 0x27c928df, 0x203fcbd9, 0x2824eed3, 0x2fd20dd5,
+    0x78cb8c97, 0x7f3d6f91, 0x77264a9b, 0x70d0a99d, 0x6710008f, 0x60e6e389, 0x68fdc683, 0x6f0b2585,
+    0x477c94a7, 0x408a77a1, 0x489152ab, 0x4f67b1ad, 0x58a718bf, 0x5f51fbb9, 0x574adeb3, 0x50bc3db5,
+    0xf632a5d9, 0xf1c446df, 0xf9df63d5, 0xfe2980d3, 0xe9e929c1, 0xee1fcac7, 0xe604efcd, 0xe1f20ccb,
+    0xc985bde9, 0xce735eef, 0xc6687be5, 0xc19e98e3, 0xd65e31f1, 0xd1a8d2f7, 0xd9b3f7fd, 0xde4514fb,
+    0x895c95b9, 0x8eaa76bf, 0x86b153b5, 0x8147b0b3, 0x968719a1, 0x9171faa7, 0x996adfad, 0x9e9c3cab,
+    0xb6eb8d89, 0xb11d6e8f, 0xb9064b85, 0xbef0a883, 0xa9300191, 0xaec6e297, 0xa6ddc79d, 0xa12b249b,
+    0x08eec519, 0x0f18261f, 0x07030315, 0x00f5e013, 0x17354901, 0x10c3aa07, 0x18d88f0d, 0x1f2e6c0b,
+    0x3759dd29, 0x30af3e2f, 0x38b41b25, 0x3f42f823, 0x28825131, 0x2f74b237, 0x276f973d, 0x2099743b,
+    0x7780f579, 0x7076167f, 0x786d3375, 0x7f9bd073, 0x685b7961, 0x6fad9a67, 0x67b6bf6d, 0x60405c6b,
+    0x4837ed49, 0x4fc10e4f, 0x47da2b45, 0x402cc843, 0x57ec6151, 0x501a8257, 0x5801a75d, 0x5ff7445b,
+    0x0f4b79ee, 0x08bd9ae8, 0x00a6bfe2, 0x07505ce4, 0x1090f5f6, 0x176616f0, 0x1f7d33fa, 0x188bd0fc,
+    0x30fc61de, 0x370a82d8, 0x3f11a7d2, 0x38e744d4, 0x2f27edc6, 0x28d10ec0, 0x20ca2bca, 0x273cc8cc,
+    0x7025498e, 0x77d3aa88, 0x7fc88f82, 0x783e6c84, 0x6ffec596, 0x68082690, 0x6013039a, 0x67e5e09c,
+    0x4f9251be, 0x4864b2b8, 0x407f97b2, 0x478974b4, 0x5049dda6, 0x57bf3ea0, 0x5fa41baa, 0x5852f8ac,
+    0xf197192e, 0xf661fa28, 0xfe7adf22, 0xf98c3c24, 0xee4c9536, 0xe9ba7630, 0xe1a1533a, 0xe657b03c,
+    0xce20011e, 0xc9d6e218, 0xc1cdc712, 0xc63b2414, 0xd1fb8d06, 0xd60d6e00, 0xde164b0a, 0xd9e0a80c,
+    0x8ef9294e, 0x890fca48, 0x8114ef42, 0x86e20c44, 0x9122a556, 0x96d44650, 0x9ecf635a, 0x9939805c,
+    0xb14e317e, 0xb6b8d278, 0xbea3f772, 0xb9551474, 0xae95bd66, 0xa9635e60, 0xa1787b6a, 0xa68e986c,
+  },
+  {
+    0x00000000, 0xe8a45605, 0xd589b1bd, 0x3d2de7b8, 0xafd27ecd, 0x477628c8, 0x7a5bcf70, 0x92ff9975,
+    0x5b65e02d, 0xb3c1b628, 0x8eec5190, 0x66480795, 0xf4b79ee0, 0x1c13c8e5, 0x213e2f5d, 0xc99a7958,
+    0xb6cbc05a, 0x5e6f965f, 0x634271e7, 0x8be627e2, 0x1919be97, 0xf1bde892, 0xcc900f2a, 0x2434592f,
+    0xedae2077, 0x050a7672, 0x382791ca, 0xd083c7cf, 0x427c5eba, 0xaad808bf, 0x97f5ef07, 0x7f51b902,
+    0x69569d03, 0x81f2cb06, 0xbcdf2cbe, 0x547b7abb, 0xc684e3ce, 0x2e20b5cb, 0x130d5273, 0xfba90476,
+    0x32337d2e, 0xda972b2b, 0xe7bacc93, 0x0f1e9a96, 0x9de103e3, 0x754555e6, 0x4868b25e, 0xa0cce45b,
+    0xdf9d5d59, 0x37390b5c, 0x0a14ece4, 0xe2b0bae1, 0x704f2394, 0x98eb7591, 0xa5c69229, 0x4d62c42c,
+    0x84f8bd74, 0x6c5ceb71, 0x51710cc9, 0xb9d55acc, 0x2b2ac3b9, 0xc38e95bc, 0xfea37204, 0x16072401,
+    0xd2ad3a06, 0x3a096c03, 0x07248bbb, 0xef80ddbe, 0x7d7f44cb, 0x95db12ce, 0xa8f6f576, 0x4052a373,
+    0x89c8da2b, 0x616c8c2e, 0x5c416b96, 0xb4e53d93, 0x261aa4e6, 0xcebef2e3, 0xf393155b, 0x1b37435e,
+    0x6466fa5c, 0x8cc2ac59, 0xb1ef4be1, 0x594b1de4, 0xcbb48491, 0x2310d294, 0x1e3d352c, 0xf6996329,
+    0x3f031a71, 0xd7a74c74, 0xea8aabcc, 0x022efdc9, 0x90d164bc, 0x787532b9, 0x4558d501, 0xadfc8304,
+    0xbbfba705, 0x535ff100, 0x6e7216b8, 0x86d640bd, 0x1429d9c8, 0xfc8d8fcd, 0xc1a06875, 0x29043e70,
+    0xe09e4728, 0x083a112d, 0x3517f695, 0xddb3a090, 0x4f4c39e5, 0xa7e86fe0, 0x9ac58858, 0x7261de5d,
+    0x0d30675f, 0xe594315a, 0xd8b9d6e2, 0x301d80e7, 0xa2e21992, 0x4a464f97, 0x776ba82f, 0x9fcffe2a,
+    0x56558772, 0xbef1d177, 0x83dc36cf, 0x6b7860ca, 0xf987f9bf, 0x1123afba, 0x2c0e4802, 0xc4aa1e07,
+    0xa19b69bb, 0x493f3fbe, 0x7412d806, 0x9cb68e03, 0x0e491776, 0xe6ed4173, 0xdbc0a6cb, 0x3364f0ce,
+    0xfafe8996, 0x125adf93, 0x2f77382b, 0xc7d36e2e, 0x552cf75b, 0xbd88a15e, 0x80a546e6, 0x680110e3,
+    0x1750a9e1, 0xfff4ffe4, 0xc2d9185c, 0x2a7d4e59, 0xb882d72c, 0x50268129, 0x6d0b6691, 0x85af3094,
+    0x4c3549cc, 0xa4911fc9, 0x99bcf871, 0x7118ae74, 0xe3e73701, 0x0b436104, 0x366e86bc, 0xdecad0b9,
+    0xc8cdf4b8, 0x2069a2bd, 0x1d444505, 0xf5e01300, 0x671f8a75, 0x8fbbdc70, 0xb2963bc8, 0x5a326dcd,
+    0x93a81495, 0x7b0c4290, 0x4621a528, 0xae85f32d, 0x3c7a6a58, 0xd4de3c5d, 0xe9f3dbe5, 0x01578de0,
+    0x7e0634e2, 0x96a262e7, 0xab8f855f, 0x432bd35a, 0xd1d44a2f, 0x39701c2a, 0x045dfb92, 0xecf9ad97,
+    0x2563d4cf, 0xcdc782ca, 0xf0ea6572, 0x184e3377, 0x8ab1aa02, 0x6215fc07, 0x5f381bbf, 0xb79c4dba,
+    0x733653bd, 0x9b9205b8, 0xa6bfe200, 0x4e1bb405, 0xdce42d70, 0x34407b75, 0x096d9ccd, 0xe1c9cac8,
+    0x2853b390, 0xc0f7e595, 0xfdda022d, 0x157e5428, 0x8781cd5d, 0x6f259b58, 0x52087ce0, 0xbaac2ae5,
+    0xc5fd93e7, 0x2d59c5e2, 0x1074225a, 0xf8d0745f, 0x6a2fed2a, 0x828bbb2f, 0xbfa65c97, 0x57020a92,
+    0x9e9873ca, 0x763c25cf, 0x4b11c277, 0xa3b59472, 0x314a0d07, 0xd9ee5b02, 0xe4c3bcba, 0x0c67eabf,
+    0x1a60cebe, 0xf2c498bb, 0xcfe97f03, 0x274d2906, 0xb5b2b073, 0x5d16e676, 0x603b01ce, 0x889f57cb,
+    0x41052e93, 0xa9a17896, 0x948c9f2e, 0x7c28c92b, 0xeed7505e, 0x0673065b, 0x3b5ee1e3, 0xd3fab7e6,
+    0xacab0ee4, 0x440f58e1, 0x7922bf59, 0x9186e95c, 0x03797029, 0xebdd262c, 0xd6f0c194, 0x3e549791,
+    0xf7ceeec9, 0x1f6ab8cc, 0x22475f74, 0xcae30971, 0x581c9004, 0xb0b8c601, 0x8d9521b9, 0x653177bc,
+  },
+  {
+    0x00000000, 0x47f7cec1, 0x8fef9d82, 0xc8185343, 0x1b1e26b3, 0x5ce9e872, 0x94f1bb31, 0xd30675f0,
+    0x363c4d66, 0x71cb83a7, 0xb9d3d0e4, 0xfe241e25, 0x2d226bd5, 0x6ad5a514, 0xa2cdf657, 0xe53a3896,
+    0x6c789acc, 0x2b8f540d, 0xe397074e, 0xa460c98f, 0x7766bc7f, 0x309172be, 0xf88921fd, 0xbf7eef3c,
+    0x5a44d7aa, 0x1db3196b, 0xd5ab4a28, 0x925c84e9, 0x415af119, 0x06ad3fd8, 0xceb56c9b, 0x8942a25a,
+    0xd8f13598, 0x9f06fb59, 0x571ea81a, 0x10e966db, 0xc3ef132b, 0x8418ddea, 0x4c008ea9, 0x0bf74068,
+    0xeecd78fe, 0xa93ab63f, 0x6122e57c, 0x26d52bbd, 0xf5d35e4d, 0xb224908c, 0x7a3cc3cf, 0x3dcb0d0e,
+    0xb489af54, 0xf37e6195, 0x3b6632d6, 0x7c91fc17, 0xaf9789e7, 0xe8604726, 0x20781465, 0x678fdaa4,
+    0x82b5e232, 0xc5422cf3, 0x0d5a7fb0, 0x4aadb171, 0x99abc481, 0xde5c0a40, 0x16445903, 0x51b397c2,
+    0xb5237687, 0xf2d4b846, 0x3acceb05, 0x7d3b25c4, 0xae3d5034, 0xe9ca9ef5, 0x21d2cdb6, 0x66250377,
+    0x831f3be1, 0xc4e8f520, 0x0cf0a663, 0x4b0768a2, 0x98011d52, 0xdff6d393, 0x17ee80d0, 0x50194e11,
+    0xd95bec4b, 0x9eac228a, 0x56b471c9, 0x1143bf08, 0xc245caf8, 0x85b20439, 0x4daa577a, 0x0a5d99bb,
+    0xef67a12d, 0xa8906fec, 0x60883caf, 0x277ff26e, 0xf479879e, 0xb38e495f, 0x7b961a1c, 0x3c61d4dd,
+    0x6dd2431f, 0x2a258dde, 0xe23dde9d, 0xa5ca105c, 0x76cc65ac, 0x313bab6d, 0xf923f82e, 0xbed436ef,
+    0x5bee0e79, 0x1c19c0b8, 0xd40193fb, 0x93f65d3a, 0x40f028ca, 0x0707e60b, 0xcf1fb548, 0x88e87b89,
+    0x01aad9d3, 0x465d1712, 0x8e454451, 0xc9b28a90, 0x1ab4ff60, 0x5d4331a1, 0x955b62e2, 0xd2acac23,
+    0x379694b5, 0x70615a74, 0xb8790937, 0xff8ec7f6, 0x2c88b206, 0x6b7f7cc7, 0xa3672f84, 0xe490e145,
+    0x6e87f0b9, 0x29703e78, 0xe1686d3b, 0xa69fa3fa, 0x7599d60a, 0x326e18cb, 0xfa764b88, 0xbd818549,
+    0x58bbbddf, 0x1f4c731e, 0xd754205d, 0x90a3ee9c, 0x43a59b6c, 0x045255ad, 0xcc4a06ee, 0x8bbdc82f,
+    0x02ff6a75, 0x4508a4b4, 0x8d10f7f7, 0xcae73936, 0x19e14cc6, 0x5e168207, 0x960ed144, 0xd1f91f85,
+    0x34c32713, 0x7334e9d2, 0xbb2cba91, 0xfcdb7450, 0x2fdd01a0, 0x682acf61, 0xa0329c22, 0xe7c552e3,
+    0xb676c521, 0xf1810be0, 0x399958a3, 0x7e6e9662, 0xad68e392, 0xea9f2d53, 0x22877e10, 0x6570b0d1,
+    0x804a8847, 0xc7bd4686, 0x0fa515c5, 0x4852db04, 0x9b54aef4, 0xdca36035, 0x14bb3376, 0x534cfdb7,
+    0xda0e5fed, 0x9df9912c, 0x55e1c26f, 0x12160cae, 0xc110795e, 0x86e7b79f, 0x4effe4dc, 0x09082a1d,
+    0xec32128b, 0xabc5dc4a, 0x63dd8f09, 0x242a41c8, 0xf72c3438, 0xb0dbfaf9, 0x78c3a9ba, 0x3f34677b,
+    0xdba4863e, 0x9c5348ff, 0x544b1bbc, 0x13bcd57d, 0xc0baa08d, 0x874d6e4c, 0x4f553d0f, 0x08a2f3ce,
+    0xed98cb58, 0xaa6f0599, 0x627756da, 0x2580981b, 0xf686edeb, 0xb171232a, 0x79697069, 0x3e9ebea8,
+    0xb7dc1cf2, 0xf02bd233, 0x38338170, 0x7fc44fb1, 0xacc23a41, 0xeb35f480, 0x232da7c3, 0x64da6902,
+    0x81e05194, 0xc6179f55, 0x0e0fcc16, 0x49f802d7, 0x9afe7727, 0xdd09b9e6, 0x1511eaa5, 0x52e62464,
+    0x0355b3a6, 0x44a27d67, 0x8cba2e24, 0xcb4de0e5, 0x184b9515, 0x5fbc5bd4, 0x97a40897, 0xd053c656,
+    0x3569fec0, 0x729e3001, 0xba866342, 0xfd71ad83, 0x2e77d873, 0x698016b2, 0xa19845f1, 0xe66f8b30,
+    0x6f2d296a, 0x28dae7ab, 0xe0c2b4e8, 0xa7357a29, 0x74330fd9, 0x33c4c118, 0xfbdc925b, 0xbc2b5c9a,
+    0x5911640c, 0x1ee6aacd, 0xd6fef98e, 0x9109374f, 0x420f42bf, 0x05f88c7e, 0xcde0df3d, 0x8a1711fc,
+  },
+  {
+    0x00000000, 0xdd0fe172, 0xbededf53, 0x63d13e21, 0x797ca311, 0xa4734263, 0xc7a27c42, 0x1aad9d30,
+    0xf2f94622, 0x2ff6a750, 0x4c279971, 0x91287803, 0x8b85e533, 0x568a0441, 0x355b3a60, 0xe854db12,
+    0xe13391f3, 0x3c3c7081, 0x5fed4ea0, 0x82e2afd2, 0x984f32e2, 0x4540d390, 0x2691edb1, 0xfb9e0cc3,
+    0x13cad7d1, 0xcec536a3, 0xad140882, 0x701be9f0, 0x6ab674c0, 0xb7b995b2, 0xd468ab93, 0x09674ae1,
+    0xc6a63e51, 0x1ba9df23, 0x7878e102, 0xa5770070, 0xbfda9d40, 0x62d57c32, 0x01044213, 0xdc0ba361,
+    0x345f7873, 0xe9509901, 0x8a81a720, 0x578e4652, 0x4d23db62, 0x902c3a10, 0xf3fd0431, 0x2ef2e543,
+    0x2795afa2, 0xfa9a4ed0, 0x994b70f1, 0x44449183, 0x5ee90cb3, 0x83e6edc1, 0xe037d3e0, 0x3d383292,
+    0xd56ce980, 0x086308f2, 0x6bb236d3, 0xb6bdd7a1, 0xac104a91, 0x711fabe3, 0x12ce95c2, 0xcfc174b0,
+    0x898d6115, 0x54828067, 0x3753be46, 0xea5c5f34, 0xf0f1c204, 0x2dfe2376, 0x4e2f1d57, 0x9320fc25,
+    0x7b742737, 0xa67bc645, 0xc5aaf864, 0x18a51916, 0x02088426, 0xdf076554, 0xbcd65b75, 0x61d9ba07,
+    0x68bef0e6, 0xb5b11194, 0xd6602fb5, 0x0b6fcec7, 0x11c253f7, 0xcccdb285, 0xaf1c8ca4, 0x72136dd6,
+    0x9a47b6c4, 0x474857b6, 0x24996997, 0xf99688e5, 0xe33b15d5, 0x3e34f4a7, 0x5de5ca86, 0x80ea2bf4,
+    0x4f2b5f44, 0x9224be36, 0xf1f58017, 0x2cfa6165, 0x3657fc55, 0xeb581d27, 0x88892306, 0x5586c274,
+    0xbdd21966, 0x60ddf814, 0x030cc635, 0xde032747, 0xc4aeba77, 0x19a15b05, 0x7a706524, 0xa77f8456,
+    0xae18ceb7, 0x73172fc5, 0x10c611e4, 0xcdc9f096, 0xd7646da6, 0x0a6b8cd4, 0x69bab2f5, 0xb4b55387,
+    0x5ce18895, 0x81ee69e7, 0xe23f57c6, 0x3f30b6b4, 0x259d2b84, 0xf892caf6, 0x9b43f4d7, 0x464c15a5,
+    0x17dbdf9d, 0xcad43eef, 0xa90500ce, 0x740ae1bc, 0x6ea77c8c, 0xb3a89dfe, 0xd079a3df, 0x0d7642ad,
+    0xe52299bf, 0x382d78cd, 0x5bfc46ec, 0x86f3a79e, 0x9c5e3aae, 0x4151dbdc, 0x2280e5fd, 0xff8f048f,
+    0xf6e84e6e, 0x2be7af1c, 0x4836913d, 0x9539704f, 0x8f94ed7f, 0x529b0c0d, 0x314a322c, 0xec45d35e,
+    0x0411084c, 0xd91ee93e, 0xbacfd71f, 0x67c0366d, 0x7d6dab5d, 0xa0624a2f, 0xc3b3740e, 0x1ebc957c,
+    0xd17de1cc, 0x0c7200be, 0x6fa33e9f, 0xb2acdfed, 0xa80142dd, 0x750ea3af, 0x16df9d8e, 0xcbd07cfc,
+    0x2384a7ee, 0xfe8b469c, 0x9d5a78bd, 0x405599cf, 0x5af804ff, 0x87f7e58d, 0xe426dbac, 0x39293ade,
+    0x304e703f, 0xed41914d, 0x8e90af6c, 0x539f4e1e, 0x4932d32e, 0x943d325c, 0xf7ec0c7d, 0x2ae3ed0f,
+    0xc2b7361d, 0x1fb8d76f, 0x7c69e94e, 0xa166083c, 0xbbcb950c, 0x66c4747e, 0x05154a5f, 0xd81aab2d,
+    0x9e56be88, 0x43595ffa, 0x208861db, 0xfd8780a9, 0xe72a1d99, 0x3a25fceb, 0x59f4c2ca, 0x84fb23b8,
+    0x6caff8aa, 0xb1a019d8, 0xd27127f9, 0x0f7ec68b, 0x15d35bbb, 0xc8dcbac9, 0xab0d84e8, 0x7602659a,
+    0x7f652f7b, 0xa26ace09, 0xc1bbf028, 0x1cb4115a, 0x06198c6a, 0xdb166d18, 0xb8c75339, 0x65c8b24b,
+    0x8d9c6959, 0x5093882b, 0x3342b60a, 0xee4d5778, 0xf4e0ca48, 0x29ef2b3a, 0x4a3e151b, 0x9731f469,
+    0x58f080d9, 0x85ff61ab, 0xe62e5f8a, 0x3b21bef8, 0x218c23c8, 0xfc83c2ba, 0x9f52fc9b, 0x425d1de9,
+    0xaa09c6fb, 0x77062789, 0x14d719a8, 0xc9d8f8da, 0xd37565ea, 0x0e7a8498, 0x6dabbab9, 0xb0a45bcb,
+    0xb9c3112a, 0x64ccf058, 0x071dce79, 0xda122f0b, 0xc0bfb23b, 0x1db05349, 0x7e616d68, 0xa36e8c1a,
+    0x4b3a5708, 0x9635b67a, 0xf5e4885b, 0x28eb6929, 0x3246f419, 0xef49156b, 0x8c982b4a, 0x5197ca38,
+  },
+  {
+    0x00000000, 0x2fb7bf3a, 0x5f6f7e74, 0x70d8c14e, 0xbedefce8, 0x916943d2, 0xe1b1829c, 0xce063da6,
+    0x797ce467, 0x56cb5b5d, 0x26139a13, 0x09a42529, 0xc7a2188f, 0xe815a7b5, 0x98cd66fb, 0xb77ad9c1,
+    0xf2f9c8ce, 0xdd4e77f4, 0xad96b6ba, 0x82210980, 0x4c273426, 0x63908b1c, 0x13484a52, 0x3cfff568,
+    0x8b852ca9, 0xa4329393, 0xd4ea52dd, 0xfb5dede7, 0x355bd041, 0x1aec6f7b, 0x6a34ae35, 0x4583110f,
+    0xe1328c2b, 0xce853311, 0xbe5df25f, 0x91ea4d65, 0x5fec70c3, 0x705bcff9, 0x00830eb7, 0x2f34b18d,
+    0x984e684c, 0xb7f9d776, 0xc7211638, 0xe896a902, 0x269094a4, 0x09272b9e, 0x79ffead0, 0x564855ea,
+    0x13cb44e5, 0x3c7cfbdf, 0x4ca43a91, 0x631385ab, 0xad15b80d, 0x82a20737, 0xf27ac679, 0xddcd7943,
+    0x6ab7a082, 0x45001fb8, 0x35d8def6, 0x1a6f61cc, 0xd4695c6a, 0xfbdee350, 0x8b06221e, 0xa4b19d24,
+    0xc6a405e1, 0xe913badb, 0x99cb7b95, 0xb67cc4af, 0x787af909, 0x57cd4633, 0x2715877d, 0x08a23847,
+    0xbfd8e186, 0x906f5ebc, 0xe0b79ff2, 0xcf0020c8, 0x01061d6e, 0x2eb1a254, 0x5e69631a, 0x71dedc20,
+    0x345dcd2f, 0x1bea7215, 0x6b32b35b, 0x44850c61, 0x8a8331c7, 0xa5348efd, 0xd5ec4fb3, 0xfa5bf089,
+    0x4d212948, 0x62969672, 0x124e573c, 0x3df9e806, 0xf3ffd5a0, 0xdc486a9a, 0xac90abd4, 0x832714ee,
+    0x279689ca, 0x082136f0, 0x78f9f7be, 0x574e4884, 0x99487522, 0xb6ffca18, 0xc6270b56, 0xe990b46c,
+    0x5eea6dad, 0x715dd297, 0x018513d9, 0x2e32ace3, 0xe0349145, 0xcf832e7f, 0xbf5bef31, 0x90ec500b,
+    0xd56f4104, 0xfad8fe3e, 0x8a003f70, 0xa5b7804a, 0x6bb1bdec, 0x440602d6, 0x34dec398, 0x1b697ca2,
+    0xac13a563, 0x83a41a59, 0xf37cdb17, 0xdccb642d, 0x12cd598b, 0x3d7ae6b1, 0x4da227ff, 0x621598c5,
+    0x89891675, 0xa63ea94f, 0xd6e66801, 0xf951d73b, 0x3757ea9d, 0x18e055a7, 0x683894e9, 0x478f2bd3,
+    0xf0f5f212, 0xdf424d28, 0xaf9a8c66, 0x802d335c, 0x4e2b0efa, 0x619cb1c0, 0x1144708e, 0x3ef3cfb4,
+    0x7b70debb, 0x54c76181, 0x241fa0cf, 0x0ba81ff5, 0xc5ae2253, 0xea199d69, 0x9ac15c27, 0xb576e31d,
+    0x020c3adc, 0x2dbb85e6, 0x5d6344a8, 0x72d4fb92, 0xbcd2c634, 0x9365790e, 0xe3bdb840, 0xcc0a077a,
+    0x68bb9a5e, 0x470c2564, 0x37d4e42a, 0x18635b10, 0xd66566b6, 0xf9d2d98c, 0x890a18c2, 0xa6bda7f8,
+    0x11c77e39, 0x3e70c103, 0x4ea8004d, 0x611fbf77, 0xaf1982d1, 0x80ae3deb, 0xf076fca5, 0xdfc1439f,
+    0x9a425290, 0xb5f5edaa, 0xc52d2ce4, 0xea9a93de, 0x249cae78, 0x0b2b1142, 0x7bf3d00c, 0x54446f36,
+    0xe33eb6f7, 0xcc8909cd, 0xbc51c883, 0x93e677b9, 0x5de04a1f, 0x7257f525, 0x028f346b, 0x2d388b51,
+    0x4f2d1394, 0x609aacae, 0x10426de0, 0x3ff5d2da, 0xf1f3ef7c, 0xde445046, 0xae9c9108, 0x812b2e32,
+    0x3651f7f3, 0x19e648c9, 0x693e8987, 0x468936bd, 0x888f0b1b, 0xa738b421, 0xd7e0756f, 0xf857ca55,
+    0xbdd4db5a, 0x92636460, 0xe2bba52e, 0xcd0c1a14, 0x030a27b2, 0x2cbd9888, 0x5c6559c6, 0x73d2e6fc,
+    0xc4a83f3d, 0xeb1f8007, 0x9bc74149, 0xb470fe73, 0x7a76c3d5, 0x55c17cef, 0x2519bda1, 0x0aae029b,
+    0xae1f9fbf, 0x81a82085, 0xf170e1cb, 0xdec75ef1, 0x10c16357, 0x3f76dc6d, 0x4fae1d23, 0x6019a219,
+    0xd7637bd8, 0xf8d4c4e2, 0x880c05ac, 0xa7bbba96, 0x69bd8730, 0x460a380a, 0x36d2f944, 0x1965467e,
+    0x5ce65771, 0x7351e84b, 0x03892905, 0x2c3e963f, 0xe238ab99, 0xcd8f14a3, 0xbd57d5ed, 0x92e06ad7,
+    0x259ab316, 0x0a2d0c2c, 0x7af5cd62, 0x55427258, 0x9b444ffe, 0xb4f3f0c4, 0xc42b318a, 0xeb9c8eb0,
+  },
+};
+
+static
+uint32_t
+miniflac_ogg_crc32_scalar(uint32_t crc32, const uint8_t* b, uint32_t length) {
+    while(length >= 16) {
+        crc32 ^= ((uint32_t)b[0] << 24) | ((uint32_t)b[1] << 16) | ((uint32_t)b[2] << 8) | (uint32_t)b[3];
+        crc32 =
+          miniflac_ogg_crc32_table[15][ crc32 >> 24 ] ^
+          miniflac_ogg_crc32_table[14][ (crc32 >> 16) & 0xFF ] ^
+          miniflac_ogg_crc32_table[13][ (crc32 >> 8) & 0xFF ] ^
+          miniflac_ogg_crc32_table[12][ crc32 & 0xFF ] ^
+          miniflac_ogg_crc32_table[11][ b[4] ] ^
+          miniflac_ogg_crc32_table[10][ b[5] ] ^
+          miniflac_ogg_crc32_table[9][ b[6] ] ^
+          miniflac_ogg_crc32_table[8][ b[7] ] ^
+          miniflac_ogg_crc32_table[7][ b[8] ] ^
+          miniflac_ogg_crc32_table[6][ b[9] ] ^
+          miniflac_ogg_crc32_table[5][ b[10] ] ^
+          miniflac_ogg_crc32_table[4][ b[11] ] ^
+          miniflac_ogg_crc32_table[3][ b[12] ] ^
+          miniflac_ogg_crc32_table[2][ b[13] ] ^
+          miniflac_ogg_crc32_table[1][ b[14] ] ^
+          miniflac_ogg_crc32_table[0][ b[15] ];
+        b += 16;
+        length -= 16;
+    }
+
+    while(length > 0) {
+        crc32 = miniflac_ogg_crc32_table[0][ (crc32 >> 24) ^ *b ] ^ (crc32 << 8);
+        b++;
+        length--;
+    }
+
+    return crc32;
+}
+
+#if defined(MINIFLAC_SIMD_X86)
+/* folds 128 bits of message forward over 128 (k = x^192, x^128) or
+ * 512 bits (k = x^576, x^512), the products are congruent mod the
+ * polynomial and small enough to not need reducing along the way */
+static MINIFLAC_TARGET("ssse3,pclmul")
+__m128i
+miniflac_ogg_crc32_fold(__m128i a, __m128i k) {
+    return _mm_xor_si128(_mm_clmulepi64_si128(a, k, 0x11), _mm_clmulepi64_si128(a, k, 0x00));
+}
+
+/* byte-swaps each 16-byte block so bit 127 is the first bit of the
+ * message, then folds with carry-less multiplies. The 128 bits left
+ * over are finished off with the tables. Returns the number of bytes
+ * it consumed, which is a multiple of 16 */
+static MINIFLAC_TARGET("ssse3,pclmul")
+uint32_t
+miniflac_ogg_crc32_pclmul(uint32_t* crc32, const uint8_t* data, uint32_t length) {
+    const __m128i swap = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    const __m128i k128 = _mm_set_epi32(0, (int)0xc5b9cd4c, 0, (int)0xe8a45605);
+    const __m128i k512 = _mm_set_epi32(0, (int)0x8833794c, 0, (int)0xe6228b11);
+    __m128i a0, a1, a2, a3;
+    uint8_t rem[16];
+    uint32_t i;
+
+    if(length < 64) return 0;
+
+    a0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)&data[0]), swap);
+    a1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)&data[16]), swap);
+    a2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)&data[32]), swap);
+    a3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)&data[48]), swap);
+    /* a running crc is the same as xor'ing it into the first 4 bytes */
+    a0 = _mm_xor_si128(a0, _mm_slli_si128(_mm_cvtsi32_si128((int)*crc32), 12));
+
+    for(i = 64; i + 64 <= length; i += 64) {
+        a0 = _mm_xor_si128(miniflac_ogg_crc32_fold(a0, k512), _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)&data[i]), swap));
+        a1 = _mm_xor_si128(miniflac_ogg_crc32_fold(a1, k512), _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)&data[i + 16]), swap));
+        a2 = _mm_xor_si128(miniflac_ogg_crc32_fold(a2, k512), _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)&data[i + 32]), swap));
+        a3 = _mm_xor_si128(miniflac_ogg_crc32_fold(a3, k512), _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)&data[i + 48]), swap));
+    }
+
+    a1 = _mm_xor_si128(miniflac_ogg_crc32_fold(a0, k128), a1);
+    a2 = _mm_xor_si128(miniflac_ogg_crc32_fold(a1, k128), a2);
+    a3 = _mm_xor_si128(miniflac_ogg_crc32_fold(a2, k128), a3);
+
+    for(; i + 16 <= length; i += 16) {
+        a3 = _mm_xor_si128(miniflac_ogg_crc32_fold(a3, k128), _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)&data[i]), swap));
+    }
+
+    _mm_storeu_si128((__m128i*)rem, _mm_shuffle_epi8(a3, swap));
+    *crc32 = miniflac_ogg_crc32_scalar(0, rem, 16);
+    return i;
+}
+#endif
+
+/* continues an Ogg crc32 over a buffer */
+static
+uint32_t
+miniflac_ogg_crc32(uint32_t crc32, const uint8_t* data, uint32_t length) {
+    uint32_t i = 0;
+
+#if defined(MINIFLAC_SIMD_X86)
+    if(miniflac_cpu_features() & MINIFLAC_CPU_PCLMUL) {
+        i = miniflac_ogg_crc32_pclmul(&crc32,data,length);
+    }
+#endif
+
+    return miniflac_ogg_crc32_scalar(crc32,&data[i],length - i);
+}
+#endif
+
+/* adds header bytes read through the state machine to the page crc */
+static
+void
+miniflac_ogg_crc32_header(miniflac_ogg_t* ogg, const uint8_t* data, uint32_t length) {
+#ifdef MINIFLAC_OGG_CRC32
+    ogg->crc32 = miniflac_ogg_crc32(ogg->crc32,data,length);
+#else
+    (void)ogg;
+    (void)data;
+    (void)length;
+#endif
+}
+
 MINIFLAC_PRIVATE
 void
 miniflac_ogg_init(miniflac_ogg_t* ogg) {
@@ -3250,63 +5764,428 @@ miniflac_ogg_init(miniflac_ogg_t* ogg) {
     ogg->curseg = 0;
     ogg->length = 0;
     ogg->pos = 0;
+    ogg->checksum = 0;
+    ogg->crc32 = 0;
+    ogg->verified = 0;
     miniflac_bitreader_init(&ogg->br);
 }
 
 MINIFLAC_PRIVATE
 MINIFLAC_RESULT
-miniflac_ogg_sync(miniflac_ogg_t* ogg,miniflac_bitreader_t* br) {
-    unsigned char c;
-    uint8_t buffer[8];
+miniflac_ogg_advance(miniflac_ogg_t* ogg, uint32_t used) {
+#ifdef MINIFLAC_OGG_CRC32
+    if(!ogg->verified) {
+        ogg->crc32 = miniflac_ogg_crc32(ogg->crc32,&ogg->br.buffer[ogg->br.pos],used);
+    }
+#endif
+    ogg->br.pos += used;
+    ogg->pos    += used;
 
-    switch(ogg->state) {
-        case MINIFLAC_OGG_SKIP: /* fall-through */
-        case MINIFLAC_OGG_DATA: {
-            while(ogg->pos < ogg->length) {
-                if(miniflac_bitreader_fill_nocrc(br,8)) return MINIFLAC_CONTINUE;
-                miniflac_bitreader_discard(br,8);
-                ogg->pos++;
-            }
-            ogg->state = MINIFLAC_OGG_CAPTUREPATTERN_O;
-        }
-        /* fall-through */
-        case MINIFLAC_OGG_CAPTUREPATTERN_O: {
-            if(miniflac_bitreader_fill_nocrc(br,8)) return MINIFLAC_CONTINUE;
-            c = (unsigned char)miniflac_bitreader_read(br,8);
-            if(c != 'O') {
-                miniflac_abort();
-                return MINIFLAC_ERROR;
-            }
-            ogg->state = MINIFLAC_OGG_CAPTUREPATTERN_G1;
-        }
-        /* fall-through */
-        case MINIFLAC_OGG_CAPTUREPATTERN_G1: {
-            if(miniflac_bitreader_fill_nocrc(br,8)) return MINIFLAC_CONTINUE;
-            c = (unsigned char)miniflac_bitreader_read(br,8);
-            if(c != 'g') {
-                miniflac_abort();
-                return MINIFLAC_ERROR;
-            }
-            ogg->state = MINIFLAC_OGG_CAPTUREPATTERN_G2;
+    if(ogg->pos < ogg->length) return MINIFLAC_OK;
+
+    ogg->state = MINIFLAC_OGG_CAPTUREPATTERN_O;
+#ifdef MINIFLAC_OGG_CRC32
+    if(!ogg->verified) {
+        ogg->verified = 1;
+        if(ogg->crc32 != ogg->checksum) {
+            miniflac_abort();
+            return MINIFLAC_OGG_CRC32_INVALID;
         }
-        /* fall-through */
-        case MINIFLAC_OGG_CAPTUREPATTERN_G2: {
+    }
+#endif
+    return MINIFLAC_OK;
+}
+
+#if defined(MINIFLAC_SIMD_X86)
+static MINIFLAC_TARGET("sse2")
+uint32_t
+miniflac_ogg_lacing_sse2(const uint8_t* lacing, uint8_t segments, uint32_t* length) {
+    const __m128i zero = _mm_setzero_si128();
+    __m128i sum = _mm_setzero_si128();
+    uint32_t i = 0;
+
+    for(; i + 16 <= segments; i += 16) {
+        sum = _mm_add_epi64(sum, _mm_sad_epu8(_mm_loadu_si128((const __m128i*)&lacing[i]), zero));
+    }
+    *length = (uint32_t)_mm_cvtsi128_si32(sum) + (uint32_t)_mm_cvtsi128_si32(_mm_unpackhi_epi64(sum, sum));
+    return i;
+}
+#endif
+
+#if defined(MINIFLAC_SIMD_NEON)
+static
+uint32_t
+miniflac_ogg_lacing_neon(const uint8_t* lacing, uint8_t segments, uint32_t* length) {
+    uint32x4_t sum = vdupq_n_u32(0);
+    uint32_t i = 0;
+
+    for(; i + 16 <= segments; i += 16) {
+        sum = vaddq_u32(sum, vpaddlq_u16(vpaddlq_u8(vld1q_u8(&lacing[i]))));
+    }
+    *length = vgetq_lane_u32(sum, 0) + vgetq_lane_u32(sum, 1) + vgetq_lane_u32(sum, 2) + vgetq_lane_u32(sum, 3);
+    return i;
+}
+#endif
+
+/* adds up the lacing values in the segment table, which is the
+ * length of the page data */
+static
+uint16_t
+miniflac_ogg_lacing(const uint8_t* lacing, uint8_t segments) {
+    uint32_t length = 0;
+    uint32_t i = 0;
+#if defined(MINIFLAC_SIMD_X86) || defined(MINIFLAC_SIMD_NEON)
+    uint32_t features = miniflac_cpu_features();
+#endif
+
+#if defined(MINIFLAC_SIMD_X86)
+    if(features & MINIFLAC_CPU_SSE2) {
+        i = miniflac_ogg_lacing_sse2(lacing,segments,&length);
+    }
+#elif defined(MINIFLAC_SIMD_NEON)
+    if(features & MINIFLAC_CPU_NEON) {
+        i = miniflac_ogg_lacing_neon(lacing,segments,&length);
+    }
+#endif
+
+    for(; i < segments; i++) {
+        length += lacing[i];
+    }
+    return (uint16_t)length;
+}
+
+/* called once the segment table has been read, sets up for the
+ * page data */
+static
+void
+miniflac_ogg_page_ready(miniflac_ogg_t* ogg) {
+    ogg->pos = 0;
+    ogg->verified = 0;
+    ogg->state = MINIFLAC_OGG_DATA;
+}
+
+MINIFLAC_PRIVATE
+uint32_t
+miniflac_ogg_page_size(const uint8_t* b) {
+    return 27 + (uint32_t)b[26] + miniflac_ogg_lacing(&b[27],b[26]);
+}
+
+MINIFLAC_PRIVATE
+MINIFLAC_RESULT
+miniflac_ogg_verify(miniflac_ogg_t* ogg) {
+#ifdef MINIFLAC_OGG_CRC32
+    miniflac_bitreader_t* br = &ogg->br;
+
+    /* with the whole page in the buffer the data can be checked
+     * before any of it gets decoded. A bad page is left in the
+     * skip state, calling again steps over it */
+    if(br->len - br->pos >= ogg->length) {
+        ogg->verified = 1;
+        if(miniflac_ogg_crc32(ogg->crc32,&br->buffer[br->pos],ogg->length) != ogg->checksum) {
+            ogg->state = MINIFLAC_OGG_SKIP;
+            miniflac_abort();
+            return MINIFLAC_OGG_CRC32_INVALID;
+        }
+    }
+#else
+    (void)ogg;
+#endif
+    return MINIFLAC_OK;
+}
+
+/* fills in the header fields from a whole page header in memory,
+ * including the segment table, and starts the page crc */
+static
+void
+miniflac_ogg_parse(miniflac_ogg_t* ogg, const uint8_t* b) {
+    uint32_t i;
+#ifdef MINIFLAC_OGG_CRC32
+    static const uint8_t zero[4] = { 0, 0, 0, 0 };
+#endif
+
+    ogg->version    = b[4];
+    ogg->headertype = b[5];
+    ogg->granulepos = miniflac_unpack_int64le(&b[6]);
+    ogg->serialno   = miniflac_unpack_int32le(&b[14]);
+    ogg->pageno     = miniflac_unpack_uint32le(&b[18]);
+    ogg->checksum   = miniflac_unpack_uint32le(&b[22]);
+    ogg->segments   = b[26];
+    ogg->curseg     = ogg->segments;
+    ogg->length     = miniflac_ogg_lacing(&b[27],ogg->segments);
+
+    for(i = 0; i < ogg->segments; i++) {
+        ogg->lacing[i] = b[27 + i];
+    }
+
+#ifdef MINIFLAC_OGG_CRC32
+    /* the crc is taken with the checksum field zeroed */
+    ogg->crc32 = miniflac_ogg_crc32(0,b,22);
+    ogg->crc32 = miniflac_ogg_crc32(ogg->crc32,zero,4);
+    ogg->crc32 = miniflac_ogg_crc32(ogg->crc32,&b[26],1 + (uint32_t)ogg->segments);
+#endif
+}
+
+/* reads a page header straight out of the buffer, when all of it
+ * (including the segment table) is there. Returns MINIFLAC_CONTINUE
+ * to have the state machine read it instead, which also takes care of
+ * reporting a bad capture pattern or version */
+static
+MINIFLAC_RESULT
+miniflac_ogg_header(miniflac_ogg_t* ogg, miniflac_bitreader_t* br) {
+    const uint8_t* b = &br->buffer[br->pos];
+    uint32_t avail = br->len - br->pos;
+
+    if(br->bits != 0 || avail < 27) return MINIFLAC_CONTINUE;
+    if(b[0] != 'O' || b[1] != 'g' || b[2] != 'g' || b[3] != 'S' || b[4] != 0) return MINIFLAC_CONTINUE;
+    if(avail < 27 + (uint32_t)b[26]) return MINIFLAC_CONTINUE;
+
+    miniflac_ogg_parse(ogg,b);
+    br->pos += 27 + (uint32_t)ogg->segments;
+    miniflac_ogg_page_ready(ogg);
+    return MINIFLAC_OK;
+}
+
+static
+uint32_t
+miniflac_ogg_find_capture_scalar(const uint8_t* data, uint32_t start, uint32_t length) {
+    uint32_t i;
+    for(i = start; i < length; i++) {
+        if(data[i] == 'O' && (i + 1 == length || data[i + 1] == 'g')) return i;
+    }
+    return length;
+}
+
+#if defined(MINIFLAC_SIMD_X86)
+static MINIFLAC_TARGET("sse2")
+uint32_t
+miniflac_ogg_find_capture_sse2(const uint8_t* data, uint32_t start, uint32_t length) {
+    const __m128i o = _mm_set1_epi8('O');
+    const __m128i g = _mm_set1_epi8('g');
+    __m128i a, b;
+    uint32_t i = start;
+    int mask;
+
+    for(; i + 17 <= length; i += 16) {
+        a = _mm_loadu_si128((const __m128i*)&data[i]);
+        b = _mm_loadu_si128((const __m128i*)&data[i + 1]);
+        mask = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, o), _mm_cmpeq_epi8(b, g)));
+        if(mask != 0) return i + (uint32_t)__builtin_ctz((unsigned int)mask);
+    }
+    return i;
+}
+
+static MINIFLAC_TARGET("avx2")
+uint32_t
+miniflac_ogg_find_capture_avx2(const uint8_t* data, uint32_t start, uint32_t length) {
+    const __m256i o = _mm256_set1_epi8('O');
+    const __m256i g = _mm256_set1_epi8('g');
+    __m256i a, b;
+    uint32_t i = start;
+    unsigned int mask;
+
+    for(; i + 33 <= length; i += 32) {
+        a = _mm256_loadu_si256((const __m256i*)&data[i]);
+        b = _mm256_loadu_si256((const __m256i*)&data[i + 1]);
+        mask = (unsigned int)_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(a, o), _mm256_cmpeq_epi8(b, g)));
+        if(mask != 0) return i + (uint32_t)__builtin_ctz(mask);
+    }
+    return i;
+}
+#endif
+
+#if defined(MINIFLAC_SIMD_NEON)
+static
+uint32_t
+miniflac_ogg_find_capture_neon(const uint8_t* data, uint32_t start, uint32_t length) {
+    const uint8x16_t o = vdupq_n_u8('O');
+    const uint8x16_t g = vdupq_n_u8('g');
+    uint64x2_t m;
+    uint32_t i = start;
+
+    /* no movemask, stop at the block with a match and let the
+     * scalar loop find it */
+    for(; i + 17 <= length; i += 16) {
+        m = vreinterpretq_u64_u8(vandq_u8(vceqq_u8(vld1q_u8(&data[i]), o), vceqq_u8(vld1q_u8(&data[i + 1]), g)));
+        if((vgetq_lane_u64(m, 0) | vgetq_lane_u64(m, 1)) != 0) return i;
+    }
+    return i;
+}
+#endif
+
+/* finds the next "Og" that could start a capture pattern, or a
+ * trailing 'O' */
+static
+uint32_t
+miniflac_ogg_find_capture(const uint8_t* data, uint32_t start, uint32_t length) {
+    uint32_t i = start;
+#if defined(MINIFLAC_SIMD_X86) || defined(MINIFLAC_SIMD_NEON)
+    uint32_t features = miniflac_cpu_features();
+#endif
+
+#if defined(MINIFLAC_SIMD_X86)
+    if(features & MINIFLAC_CPU_AVX2) {
+        i = miniflac_ogg_find_capture_avx2(data,start,length);
+    } else if(features & MINIFLAC_CPU_SSE2) {
+        i = miniflac_ogg_find_capture_sse2(data,start,length);
+    }
+#elif defined(MINIFLAC_SIMD_NEON)
+    if(features & MINIFLAC_CPU_NEON) {
+        i = miniflac_ogg_find_capture_neon(data,start,length);
+    }
+#endif
+
+    return miniflac_ogg_find_capture_scalar(data,i,length);
+}
+
+MINIFLAC_PRIVATE
+MINIFLAC_RESULT
+miniflac_ogg_find(miniflac_ogg_t* ogg, const uint8_t* data, uint32_t length, uint32_t* pos) {
+    uint32_t i = 0;
+#ifdef MINIFLAC_OGG_CRC32
+    uint32_t size;
+#endif
+
+    for(;;) {
+        i = miniflac_ogg_find_capture(data,i,length);
+        if(length - i < 27 || length - i < 27 + (uint32_t)data[i + 26]) break;
+        if(data[i + 2] == 'g' && data[i + 3] == 'S' && data[i + 4] == 0) {
+            miniflac_ogg_parse(ogg,&data[i]);
+#ifdef MINIFLAC_OGG_CRC32
+            size = 27 + (uint32_t)ogg->segments;
+            /* the capture pattern can turn up inside page data, if the
+             * whole page is here make sure it's real */
+            if(length - i - size >= ogg->length &&
+              miniflac_ogg_crc32(ogg->crc32,&data[i + size],ogg->length) != ogg->checksum) {
+                i++;
+                continue;
+            }
+#endif
+            *pos = i;
+            return MINIFLAC_OK;
+        }
+        i++;
+    }
+
+    *pos = i;
+    return MINIFLAC_CONTINUE;
+}
+
+MINIFLAC_PRIVATE
+MINIFLAC_RESULT
+miniflac_ogg_skip_packet(miniflac_ogg_t* ogg) {
+    uint32_t avail = ogg->br.len - ogg->br.pos;
+    uint32_t end = 0;
+    uint32_t i;
+    MINIFLAC_RESULT r;
+
+    /* a packet ends on the first lacing value under 255, if there
+     * isn't one it goes on to the next page */
+    for(i = 0; i < ogg->segments; i++) {
+        end += ogg->lacing[i];
+        if(ogg->lacing[i] < 255 && end > ogg->pos) break;
+    }
+
+    if(avail > end - ogg->pos) avail = end - ogg->pos;
+    r = miniflac_ogg_advance(ogg,avail);
+    if(r != MINIFLAC_OK) return r;
+    return ogg->pos < end ? MINIFLAC_CONTINUE : MINIFLAC_OK;
+}
+
+MINIFLAC_PRIVATE
+void
+miniflac_ogg_skip_foreign(miniflac_ogg_t* ogg, int32_t serialno) {
+    miniflac_bitreader_t* br = &ogg->br;
+    const uint8_t* b;
+    uint32_t avail;
+    uint32_t size;
+
+    if(ogg->state == MINIFLAC_OGG_SKIP) {
+        if(br->len - br->pos < (uint32_t)(ogg->length - ogg->pos)) return;
+        ogg->verified = 1;
+        miniflac_ogg_advance(ogg,ogg->length - ogg->pos);
+    }
+    if(ogg->state != MINIFLAC_OGG_CAPTUREPATTERN_O || br->bits != 0) return;
+
+    for(;;) {
+        b = &br->buffer[br->pos];
+        avail = br->len - br->pos;
+        if(avail < 27) return;
+        if(b[0] != 'O' || b[1] != 'g' || b[2] != 'g' || b[3] != 'S' || b[4] != 0) return;
+        if(miniflac_unpack_int32le(&b[14]) == serialno) return;
+        if(avail < 27 + (uint32_t)b[26]) return;
+        size = miniflac_ogg_page_size(b);
+        if(avail < size) return;
+        br->pos += size;
+    }
+}
+
+MINIFLAC_PRIVATE
+MINIFLAC_RESULT
+miniflac_ogg_sync(miniflac_ogg_t* ogg,miniflac_bitreader_t* br) {
+    uint8_t c;
+    uint8_t buffer[8];
+    uint32_t avail;
+    MINIFLAC_RESULT r;
+
+    switch(ogg->state) {
+        case MINIFLAC_OGG_SKIP: {
+            /* nothing on a skipped page gets used, there's no need
+             * to check it */
+            ogg->verified = 1;
+        }
+        /* fall-through */
+        case MINIFLAC_OGG_DATA: {
+            avail = br->len - br->pos;
+            if(avail > (uint32_t)(ogg->length - ogg->pos)) avail = ogg->length - ogg->pos;
+            r = miniflac_ogg_advance(ogg,avail);
+            if(r != MINIFLAC_OK) return r;
+            if(ogg->pos < ogg->length) return MINIFLAC_CONTINUE;
+        }
+        /* fall-through */
+        case MINIFLAC_OGG_CAPTUREPATTERN_O: {
+            r = miniflac_ogg_header(ogg,br);
+            if(r != MINIFLAC_CONTINUE) return r;
+            if(miniflac_bitreader_fill_nocrc(br,8)) return MINIFLAC_CONTINUE;
+            c = (uint8_t)miniflac_bitreader_read(br,8);
+            if(c != 'O') {
+                miniflac_abort();
+                return MINIFLAC_ERROR;
+            }
+            ogg->crc32 = 0;
+            miniflac_ogg_crc32_header(ogg,&c,1);
+            ogg->state = MINIFLAC_OGG_CAPTUREPATTERN_G1;
+        }
+        /* fall-through */
+        case MINIFLAC_OGG_CAPTUREPATTERN_G1: {
             if(miniflac_bitreader_fill_nocrc(br,8)) return MINIFLAC_CONTINUE;
-            c = (unsigned char)miniflac_bitreader_read(br,8);
+            c = (uint8_t)miniflac_bitreader_read(br,8);
             if(c != 'g') {
                 miniflac_abort();
                 return MINIFLAC_ERROR;
             }
+            miniflac_ogg_crc32_header(ogg,&c,1);
+            ogg->state = MINIFLAC_OGG_CAPTUREPATTERN_G2;
+        }
+        /* fall-through */
+        case MINIFLAC_OGG_CAPTUREPATTERN_G2: {
+            if(miniflac_bitreader_fill_nocrc(br,8)) return MINIFLAC_CONTINUE;
+            c = (uint8_t)miniflac_bitreader_read(br,8);
+            if(c != 'g') {
+                miniflac_abort();
+                return MINIFLAC_ERROR;
+            }
+            miniflac_ogg_crc32_header(ogg,&c,1);
             ogg->state = MINIFLAC_OGG_CAPTUREPATTERN_S;
         }
         /* fall-through */
         case MINIFLAC_OGG_CAPTUREPATTERN_S: {
             if(miniflac_bitreader_fill_nocrc(br,8)) return MINIFLAC_CONTINUE;
-            c = (unsigned char)miniflac_bitreader_read(br,8);
+            c = (uint8_t)miniflac_bitreader_read(br,8);
             if(c != 'S') {
                 miniflac_abort();
                 return MINIFLAC_ERROR;
             }
+            miniflac_ogg_crc32_header(ogg,&c,1);
             ogg->state = MINIFLAC_OGG_VERSION;
         }
         /* fall-through */
@@ -3317,12 +6196,14 @@ miniflac_ogg_sync(miniflac_ogg_t* ogg,miniflac_bitreader_t* br) {
                 miniflac_abort();
                 return MINIFLAC_ERROR;
             }
+            miniflac_ogg_crc32_header(ogg,&ogg->version,1);
             ogg->state = MINIFLAC_OGG_HEADERTYPE;
         }
         /* fall-through */
         case MINIFLAC_OGG_HEADERTYPE: {
             if(miniflac_bitreader_fill_nocrc(br,8)) return MINIFLAC_CONTINUE;
             ogg->headertype = (uint8_t)miniflac_bitreader_read(br,8);
+            miniflac_ogg_crc32_header(ogg,&ogg->headertype,1);
             ogg->state = MINIFLAC_OGG_GRANULEPOS;
         }
         /* fall-through */
@@ -3337,6 +6218,7 @@ miniflac_ogg_sync(miniflac_ogg_t* ogg,miniflac_bitreader_t* br) {
             buffer[6] = miniflac_bitreader_read(br,8);
             buffer[7] = miniflac_bitreader_read(br,8);
             ogg->granulepos = miniflac_unpack_int64le(buffer);
+            miniflac_ogg_crc32_header(ogg,buffer,8);
             ogg->state = MINIFLAC_OGG_SERIALNO;
         }
         /* fall-through */
@@ -3347,6 +6229,7 @@ miniflac_ogg_sync(miniflac_ogg_t* ogg,miniflac_bitreader_t* br) {
             buffer[2] = miniflac_bitreader_read(br,8);
             buffer[3] = miniflac_bitreader_read(br,8);
             ogg->serialno = miniflac_unpack_int32le(buffer);
+            miniflac_ogg_crc32_header(ogg,buffer,4);
             ogg->state = MINIFLAC_OGG_PAGENO;
         }
         /* fall-through */
@@ -3357,156 +6240,1139 @@ miniflac_ogg_sync(miniflac_ogg_t* ogg,miniflac_bitreader_t* br) {
             buffer[2] = miniflac_bitreader_read(br,8);
             buffer[3] = miniflac_bitreader_read(br,8);
             ogg->pageno = miniflac_unpack_uint32le(buffer);
+            miniflac_ogg_crc32_header(ogg,buffer,4);
             ogg->state = MINIFLAC_OGG_CHECKSUM;
         }
         /* fall-through */
         case MINIFLAC_OGG_CHECKSUM: {
             if(miniflac_bitreader_fill_nocrc(br,32)) return MINIFLAC_CONTINUE;
-            miniflac_bitreader_discard(br,32);
+            buffer[0] = miniflac_bitreader_read(br,8);
+            buffer[1] = miniflac_bitreader_read(br,8);
+            buffer[2] = miniflac_bitreader_read(br,8);
+            buffer[3] = miniflac_bitreader_read(br,8);
+            ogg->checksum = miniflac_unpack_uint32le(buffer);
+            /* the crc is taken with the checksum field zeroed */
+            buffer[0] = 0;
+            buffer[1] = 0;
+            buffer[2] = 0;
+            buffer[3] = 0;
+            miniflac_ogg_crc32_header(ogg,buffer,4);
             ogg->state = MINIFLAC_OGG_PAGESEGMENTS;
         }
         /* fall-through */
         case MINIFLAC_OGG_PAGESEGMENTS: {
             if(miniflac_bitreader_fill_nocrc(br,8)) return MINIFLAC_CONTINUE;
             ogg->segments = (uint8_t) miniflac_bitreader_read(br,8);
+            miniflac_ogg_crc32_header(ogg,&ogg->segments,1);
             ogg->curseg = 0;
             ogg->length = 0;
             ogg->state = MINIFLAC_OGG_SEGMENTTABLE;
         }
-        /* fall-through */
-        case MINIFLAC_OGG_SEGMENTTABLE: {
-            while(ogg->curseg < ogg->segments) {
-              if(miniflac_bitreader_fill_nocrc(br,8)) return MINIFLAC_CONTINUE;
-              ogg->length += miniflac_bitreader_read(br,8);
-              ogg->curseg++;
+        /* fall-through */
+        case MINIFLAC_OGG_SEGMENTTABLE: {
+            while(ogg->curseg < ogg->segments) {
+              if(miniflac_bitreader_fill_nocrc(br,8)) return MINIFLAC_CONTINUE;
+              c = (uint8_t)miniflac_bitreader_read(br,8);
+              miniflac_ogg_crc32_header(ogg,&c,1);
+              ogg->length += c;
+              ogg->lacing[ogg->curseg] = c;
+              ogg->curseg++;
+            }
+            miniflac_ogg_page_ready(ogg);
+            return MINIFLAC_OK;
+        }
+    }
+    return MINIFLAC_ERROR;
+}
+
+MINIFLAC_PRIVATE
+void
+miniflac_frame_init(miniflac_frame_t* frame) {
+    frame->crc16 = 0;
+    frame->cur_subframe = 0;
+    frame->state = MINIFLAC_FRAME_HEADER;
+    frame->skip_len = 0;
+    frame->skip_crc16 = 0;
+    frame->skip_after = 0;
+    miniflac_frame_header_init(&frame->header);
+    miniflac_subframe_init(&frame->subframe);
+}
+
+/* fills in defaults from STREAMINFO once a header has been read */
+static
+MINIFLAC_RESULT
+miniflac_frame_header_ready(miniflac_frame_t* frame, miniflac_streaminfo_t* info) {
+    if(frame->header.sample_rate == 0) {
+        if(info->sample_rate == 0) return MINIFLAC_FRAME_INVALID_SAMPLE_RATE;
+        frame->header.sample_rate = info->sample_rate;
+    }
+
+    if(frame->header.bps == 0) {
+        if(info->bps == 0) return MINIFLAC_FRAME_INVALID_SAMPLE_SIZE;
+        frame->header.bps = info->bps;
+    }
+
+    frame->state = MINIFLAC_FRAME_SUBFRAME;
+    frame->cur_subframe = 0;
+    miniflac_subframe_init(&frame->subframe);
+    return MINIFLAC_OK;
+}
+
+MINIFLAC_PRIVATE
+MINIFLAC_RESULT
+miniflac_frame_sync(miniflac_frame_t* frame, miniflac_bitreader_t* br, miniflac_streaminfo_t* info) {
+    MINIFLAC_RESULT r;
+    assert(frame->state == MINIFLAC_FRAME_HEADER);
+    r = miniflac_frame_header_decode(&frame->header,br);
+    if(r != MINIFLAC_OK) return r;
+
+    return miniflac_frame_header_ready(frame,info);
+}
+
+MINIFLAC_PRIVATE
+uint8_t
+miniflac_frame_header_fits(const miniflac_frame_header_t* header, const miniflac_streaminfo_t* info) {
+    if(header->bps != 0 && info->bps != 0 && header->bps != info->bps) return 0;
+    if(header->sample_rate != 0 && info->sample_rate != 0 && header->sample_rate != info->sample_rate) return 0;
+    if(info->max_block_size != 0 && header->block_size > info->max_block_size) return 0;
+    return 1;
+}
+
+/* The sync search returns the position of the first 0xFF that's
+ * followed by 0xF8 or 0xF9, or length if there isn't one. A 0xFF
+ * in the last byte counts too, since the next byte isn't known yet.
+ * The SIMD variants return where they stopped, the scalar loop
+ * picks up from there. */
+
+static
+uint32_t
+miniflac_frame_find_sync_scalar(const uint8_t* data, uint32_t start, uint32_t length) {
+    uint32_t i;
+    for(i = start; i < length; i++) {
+        if(data[i] == 0xFF && (i + 1 == length || (data[i + 1] & 0xFE) == 0xF8)) return i;
+    }
+    return length;
+}
+
+#if defined(MINIFLAC_SIMD_X86)
+static MINIFLAC_TARGET("sse2")
+uint32_t
+miniflac_frame_find_sync_sse2(const uint8_t* data, uint32_t start, uint32_t length) {
+    const __m128i ff = _mm_set1_epi8((char)0xFF);
+    const __m128i fe = _mm_set1_epi8((char)0xFE);
+    const __m128i f8 = _mm_set1_epi8((char)0xF8);
+    __m128i a, b;
+    uint32_t i = start;
+    int mask;
+
+    for(; i + 17 <= length; i += 16) {
+        a = _mm_loadu_si128((const __m128i*)&data[i]);
+        b = _mm_loadu_si128((const __m128i*)&data[i + 1]);
+        mask = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, ff), _mm_cmpeq_epi8(_mm_and_si128(b, fe), f8)));
+        if(mask != 0) return i + (uint32_t)__builtin_ctz((unsigned int)mask);
+    }
+    return i;
+}
+
+static MINIFLAC_TARGET("avx2")
+uint32_t
+miniflac_frame_find_sync_avx2(const uint8_t* data, uint32_t start, uint32_t length) {
+    const __m256i ff = _mm256_set1_epi8((char)0xFF);
+    const __m256i fe = _mm256_set1_epi8((char)0xFE);
+    const __m256i f8 = _mm256_set1_epi8((char)0xF8);
+    __m256i a, b;
+    uint32_t i = start;
+    unsigned int mask;
+
+    for(; i + 33 <= length; i += 32) {
+        a = _mm256_loadu_si256((const __m256i*)&data[i]);
+        b = _mm256_loadu_si256((const __m256i*)&data[i + 1]);
+        mask = (unsigned int)_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(a, ff), _mm256_cmpeq_epi8(_mm256_and_si256(b, fe), f8)));
+        if(mask != 0) return i + (uint32_t)__builtin_ctz(mask);
+    }
+    return i;
+}
+#endif
+
+#if defined(MINIFLAC_SIMD_NEON)
+static
+uint32_t
+miniflac_frame_find_sync_neon(const uint8_t* data, uint32_t start, uint32_t length) {
+    const uint8x16_t ff = vdupq_n_u8(0xFF);
+    const uint8x16_t fe = vdupq_n_u8(0xFE);
+    const uint8x16_t f8 = vdupq_n_u8(0xF8);
+    uint8x16_t a, b;
+    uint64x2_t m;
+    uint32_t i = start;
+
+    /* no movemask, stop at the block with a match and let the
+     * scalar loop find it */
+    for(; i + 17 <= length; i += 16) {
+        a = vld1q_u8(&data[i]);
+        b = vld1q_u8(&data[i + 1]);
+        m = vreinterpretq_u64_u8(vandq_u8(vceqq_u8(a, ff), vceqq_u8(vandq_u8(b, fe), f8)));
+        if((vgetq_lane_u64(m, 0) | vgetq_lane_u64(m, 1)) != 0) return i;
+    }
+    return i;
+}
+#endif
+
+static
+uint32_t
+miniflac_frame_find_sync(const uint8_t* data, uint32_t start, uint32_t length) {
+    uint32_t i = start;
+#if defined(MINIFLAC_SIMD_X86) || defined(MINIFLAC_SIMD_NEON)
+    uint32_t features = miniflac_cpu_features();
+#endif
+
+#if defined(MINIFLAC_SIMD_X86)
+    if(features & MINIFLAC_CPU_AVX2) {
+        i = miniflac_frame_find_sync_avx2(data,start,length);
+    } else if(features & MINIFLAC_CPU_SSE2) {
+        i = miniflac_frame_find_sync_sse2(data,start,length);
+    }
+#elif defined(MINIFLAC_SIMD_NEON)
+    if(features & MINIFLAC_CPU_NEON) {
+        i = miniflac_frame_find_sync_neon(data,start,length);
+    }
+#endif
+
+    return miniflac_frame_find_sync_scalar(data,i,length);
+}
+
+#ifndef MINIFLAC_NO_SKIP_CRC16
+/* the sample or frame number the header after this one should have */
+static
+uint64_t
+miniflac_frame_header_next(const miniflac_frame_header_t* header) {
+    if(header->blocking_strategy) {
+        return header->sample_number + header->block_size;
+    }
+    return header->sample_number + 1;
+}
+#endif
+
+/* decides whether the bytes in frame->skip start a frame header. On a
+ * match the header is decoded, the bytes after it are handed back to
+ * the bitreader and the crc is restarted as if it had been read the
+ * normal way. Otherwise it moves on to the next 0xFF in frame->skip,
+ * if there is one. Returns MINIFLAC_OK on a match, MINIFLAC_CONTINUE
+ * if more bytes are needed to tell, MINIFLAC_ERROR if the bytes
+ * weren't a header and MINIFLAC_FRAME_CRC16_INVALID if the skipped
+ * frame turned out to be damaged. */
+static
+MINIFLAC_RESULT
+miniflac_frame_skip_check(miniflac_frame_t* frame, miniflac_bitreader_t* br, miniflac_streaminfo_t* info) {
+    miniflac_frame_header_t header;
+    miniflac_bitreader_t hbr;
+    uint8_t i;
+    uint8_t rest;
+    int size;
+
+    while(frame->skip_len > 0) {
+        size = miniflac_frame_header_check(frame->skip,frame->skip_len);
+        if(size < 0) return MINIFLAC_CONTINUE;
+
+        rest = (uint8_t)(frame->skip_len - size);
+        if(size > 0 && br->bits + rest * 8 <= 64) {
+            miniflac_bitreader_init(&hbr);
+            hbr.buffer = frame->skip;
+            hbr.len = (uint32_t)size;
+            miniflac_frame_header_init(&header);
+            if(miniflac_frame_header_decode(&header,&hbr) != MINIFLAC_OK || !miniflac_frame_header_fits(&header,info)) {
+                size = 0;
+            }
+#ifndef MINIFLAC_NO_SKIP_CRC16
+            /* the skipped frame ends with its crc16, so the crc of
+             * everything up to a real header is 0 */
+            else if(frame->skip_crc16 != 0) {
+                if(header.blocking_strategy == frame->header.blocking_strategy) {
+                    /* a header numbered two after the skipped frame means
+                     * the one numbered right after it went by without
+                     * the crc coming out right: the frame is damaged.
+                     * Fail the way miniflac_frame_decode would have
+                     * rather than skipping on to the end of the stream. */
+                    if(frame->skip_after != 0 && header.sample_number == frame->skip_after) {
+                        miniflac_abort();
+                        return MINIFLAC_FRAME_CRC16_INVALID;
+                    }
+                    if(frame->skip_after == 0 && header.sample_number == miniflac_frame_header_next(&frame->header)) {
+                        frame->skip_after = miniflac_frame_header_next(&header);
+                    }
+                }
+                size = 0;
+            }
+#endif
+            if(size > 0) {
+                for(i = 0; i < rest; i++) {
+                    br->val |= ((uint64_t)frame->skip[size + i]) << (br->bits + (rest - 1 - i) * 8);
+                }
+                br->bits += rest * 8;
+                miniflac_bitreader_reset_crc(br);
+                br->crc16 = miniflac_bitreader_crc16(0,frame->skip,(uint32_t)size);
+                br->tot = (uint32_t)size;
+
+                frame->skip_len = 0;
+                frame->header = header;
+                return MINIFLAC_OK;
+            }
+        }
+
+        /* not a header, carry on from the next 0xFF */
+        for(i = 1; i < frame->skip_len && frame->skip[i] != 0xFF; i++);
+        frame->skip_crc16 = miniflac_bitreader_crc16(frame->skip_crc16,frame->skip,i);
+        frame->skip_len -= i;
+        for(rest = 0; rest < frame->skip_len; rest++) {
+            frame->skip[rest] = frame->skip[rest + i];
+        }
+    }
+    return MINIFLAC_ERROR;
+}
+
+MINIFLAC_PRIVATE
+MINIFLAC_RESULT
+miniflac_frame_skip(miniflac_frame_t* frame, miniflac_bitreader_t* br, miniflac_streaminfo_t* info) {
+    MINIFLAC_RESULT r;
+
+    if(frame->state != MINIFLAC_FRAME_SKIP) {
+        /* the rest of the current byte belongs to the skipped frame */
+        miniflac_bitreader_align(br);
+        frame->skip_len = 0;
+        frame->skip_after = 0;
+        frame->state = MINIFLAC_FRAME_SKIP;
+    }
+
+    for(;;) {
+        if(frame->skip_len > 0) {
+            r = miniflac_frame_skip_check(frame,br,info);
+            if(r == MINIFLAC_OK) return miniflac_frame_header_ready(frame,info);
+            if(r == MINIFLAC_FRAME_CRC16_INVALID) return r;
+            if(r == MINIFLAC_CONTINUE) {
+                /* needs another byte */
+                if(br->bits >= 8) {
+                    frame->skip[frame->skip_len++] = (uint8_t)miniflac_bitreader_read(br,8);
+                } else if(br->pos < br->len) {
+                    frame->skip[frame->skip_len++] = br->buffer[br->pos++];
+                } else {
+                    return MINIFLAC_CONTINUE;
+                }
+            }
+            continue;
+        }
+
+        /* bytes read ahead into the bitreader go one at a time */
+        if(br->bits >= 8) {
+            if(miniflac_bitreader_peek(br,8) == 0xFF) {
+                miniflac_bitreader_update_crc(br);
+                frame->skip_crc16 = br->crc16;
+                frame->skip[frame->skip_len++] = 0xFF;
+            }
+            miniflac_bitreader_discard(br,8);
+            continue;
+        }
+
+        br->pos = miniflac_frame_find_sync(br->buffer,br->pos,br->len);
+#ifdef MINIFLAC_NO_SKIP_CRC16
+        /* nothing skipped needs to be checksummed */
+        miniflac_bitreader_reset_crc(br);
+#endif
+        if(br->pos == br->len) return MINIFLAC_CONTINUE;
+
+        miniflac_bitreader_update_crc(br);
+        frame->skip_crc16 = br->crc16;
+        frame->skip[frame->skip_len++] = br->buffer[br->pos++];
+    }
+}
+
+static
+uint8_t
+miniflac_frame_subframe_bps(miniflac_frame_t* frame) {
+    uint8_t bps = frame->header.bps;
+    if(frame->header.channel_assignment == MINIFLAC_CHASSGN_LEFT_SIDE || frame->header.channel_assignment == MINIFLAC_CHASSGN_MID_SIDE) {
+        if(frame->cur_subframe == 1) bps += 1;
+    } else if(frame->header.channel_assignment == MINIFLAC_CHASSGN_RIGHT_SIDE) {
+        if(frame->cur_subframe == 0) bps += 1;
+    }
+    return bps;
+}
+
+/* the buffer the current subframe is decoded into. When packing,
+ * stereo frames keep both channels in scratch until the footer so they
+ * can be decorrelated and packed together, every other layout reuses
+ * the start of scratch for each channel. Narrow planar output is the
+ * exception, there the first channel of a pair is stored right away
+ * (see miniflac_output_stereo_narrow). */
+static
+int32_t*
+miniflac_frame_channel(miniflac_frame_t* frame, int32_t** output, const miniflac_output_t* packed) {
+    if(packed != NULL) {
+        if(frame->header.channels == 2 && frame->cur_subframe == 1 && !miniflac_output_narrow(packed,frame->header.bps)) {
+            return packed->scratch + frame->header.block_size;
+        }
+        return packed->scratch;
+    }
+    return output == NULL ? NULL : output[frame->cur_subframe];
+}
+
+/* packs the subframe that was just decoded, if it isn't waiting
+ * on its stereo pair */
+static
+void
+miniflac_frame_emit(miniflac_frame_t* frame, const miniflac_output_t* packed) {
+    if(packed == NULL) return;
+    if(frame->header.channels == 2) {
+        if(frame->cur_subframe == 1 || !miniflac_output_narrow(packed,frame->header.bps)) return;
+    }
+    miniflac_output_channel(packed,packed->scratch,frame->header.block_size,frame->header.bps,frame->cur_subframe,frame->header.channels);
+}
+
+/* decodes every subframe straight through when the rest of the frame
+ * should be in the buffer - either STREAMINFO's max_frame_size bytes
+ * are available, or enough for the frame to be stored verbatim.
+ * If we run out of data anyway (bad max_frame_size, or a frame that
+ * is larger than verbatim), the bitreader is rewound and
+ * MINIFLAC_CONTINUE is returned so the caller can fall back to the
+ * resumable decoder. */
+static
+MINIFLAC_RESULT
+miniflac_frame_decode_fast(miniflac_frame_t* frame, miniflac_bitreader_t* br, miniflac_streaminfo_t* info, int32_t** output, const miniflac_output_t* packed) {
+    MINIFLAC_RESULT r;
+    miniflac_bitreader_t saved;
+    uint32_t avail;
+    uint32_t need;
+
+    avail = br->len - br->pos + (br->bits >> 3);
+    need  = info->max_frame_size;
+    if(need == 0) {
+        need = ((((uint32_t)frame->header.block_size) * (frame->header.bps + 1) + 64) * frame->header.channels) / 8 + 2;
+    }
+    if(avail < need) return MINIFLAC_CONTINUE;
+
+    saved = *br;
+    while(frame->cur_subframe < frame->header.channels) {
+        r = miniflac_subframe_decode_fast(&frame->subframe,br,miniflac_frame_channel(frame,output,packed),frame->header.block_size,miniflac_frame_subframe_bps(frame));
+        if(r == MINIFLAC_CONTINUE) {
+            *br = saved;
+            miniflac_subframe_init(&frame->subframe);
+            frame->cur_subframe = 0;
+        }
+        if(r != MINIFLAC_OK) return r;
+        miniflac_frame_emit(frame,packed);
+        frame->cur_subframe++;
+    }
+
+    return MINIFLAC_OK;
+}
+
+/* Undoes the stereo decorrelation. For mid/side, with m the mid and s the
+ * side channel, the spec has left = ((m << 1 | (s & 1)) + s) >> 1 and
+ * right = ((m << 1 | (s & 1)) - s) >> 1, which needs 33 bits. The same
+ * values are left = m + (s >> 1) + (s & 1) and right = m - (s >> 1), where
+ * no intermediate is wider than the output samples. So every variant works
+ * in 32-bit lanes, and on a corrupt stream it wraps the same way a 64-bit
+ * version would truncate. */
+
+static
+void
+miniflac_frame_decorrelate_scalar(MINIFLAC_CHASSGN assignment, int32_t* left, int32_t* right, uint32_t start, uint32_t block_size) {
+    uint32_t i;
+    uint32_t m,s;
+
+    switch(assignment) {
+        case MINIFLAC_CHASSGN_LEFT_SIDE: {
+            for(i = start; i < block_size; i++) {
+                right[i] = (int32_t)((uint32_t)left[i] - (uint32_t)right[i]);
+            }
+            break;
+        }
+        case MINIFLAC_CHASSGN_RIGHT_SIDE: {
+            for(i = start; i < block_size; i++) {
+                left[i] = (int32_t)((uint32_t)left[i] + (uint32_t)right[i]);
+            }
+            break;
+        }
+        case MINIFLAC_CHASSGN_MID_SIDE: {
+            for(i = start; i < block_size; i++) {
+                m = (uint32_t)left[i];
+                s = (uint32_t)(right[i] >> 1);
+                left[i]  = (int32_t)(m + s + ((uint32_t)right[i] & 1));
+                right[i] = (int32_t)(m - s);
+            }
+            break;
+        }
+        default: break;
+    }
+}
+
+/* the SIMD variants handle whole vectors and return how many samples
+ * they did, the scalar loop finishes the rest */
+
+#if defined(MINIFLAC_SIMD_X86)
+static MINIFLAC_TARGET("sse2")
+uint32_t
+miniflac_frame_decorrelate_sse2(MINIFLAC_CHASSGN assignment, int32_t* left, int32_t* right, uint32_t block_size) {
+    __m128i l, r, s;
+    const __m128i one = _mm_set1_epi32(1);
+    uint32_t i = 0;
+
+    switch(assignment) {
+        case MINIFLAC_CHASSGN_LEFT_SIDE: {
+            for(; i + 4 <= block_size; i += 4) {
+                l = _mm_loadu_si128((const __m128i*)&left[i]);
+                r = _mm_loadu_si128((const __m128i*)&right[i]);
+                _mm_storeu_si128((__m128i*)&right[i], _mm_sub_epi32(l, r));
+            }
+            break;
+        }
+        case MINIFLAC_CHASSGN_RIGHT_SIDE: {
+            for(; i + 4 <= block_size; i += 4) {
+                l = _mm_loadu_si128((const __m128i*)&left[i]);
+                r = _mm_loadu_si128((const __m128i*)&right[i]);
+                _mm_storeu_si128((__m128i*)&left[i], _mm_add_epi32(l, r));
+            }
+            break;
+        }
+        case MINIFLAC_CHASSGN_MID_SIDE: {
+            for(; i + 4 <= block_size; i += 4) {
+                l = _mm_loadu_si128((const __m128i*)&left[i]);
+                r = _mm_loadu_si128((const __m128i*)&right[i]);
+                s = _mm_srai_epi32(r, 1);
+                _mm_storeu_si128((__m128i*)&left[i], _mm_add_epi32(_mm_add_epi32(l, s), _mm_and_si128(r, one)));
+                _mm_storeu_si128((__m128i*)&right[i], _mm_sub_epi32(l, s));
+            }
+            break;
+        }
+        default: break;
+    }
+    return i;
+}
+
+static MINIFLAC_TARGET("avx2")
+uint32_t
+miniflac_frame_decorrelate_avx2(MINIFLAC_CHASSGN assignment, int32_t* left, int32_t* right, uint32_t block_size) {
+    __m256i l, r, s;
+    const __m256i one = _mm256_set1_epi32(1);
+    uint32_t i = 0;
+
+    switch(assignment) {
+        case MINIFLAC_CHASSGN_LEFT_SIDE: {
+            for(; i + 8 <= block_size; i += 8) {
+                l = _mm256_loadu_si256((const __m256i*)&left[i]);
+                r = _mm256_loadu_si256((const __m256i*)&right[i]);
+                _mm256_storeu_si256((__m256i*)&right[i], _mm256_sub_epi32(l, r));
+            }
+            break;
+        }
+        case MINIFLAC_CHASSGN_RIGHT_SIDE: {
+            for(; i + 8 <= block_size; i += 8) {
+                l = _mm256_loadu_si256((const __m256i*)&left[i]);
+                r = _mm256_loadu_si256((const __m256i*)&right[i]);
+                _mm256_storeu_si256((__m256i*)&left[i], _mm256_add_epi32(l, r));
+            }
+            break;
+        }
+        case MINIFLAC_CHASSGN_MID_SIDE: {
+            for(; i + 8 <= block_size; i += 8) {
+                l = _mm256_loadu_si256((const __m256i*)&left[i]);
+                r = _mm256_loadu_si256((const __m256i*)&right[i]);
+                s = _mm256_srai_epi32(r, 1);
+                _mm256_storeu_si256((__m256i*)&left[i], _mm256_add_epi32(_mm256_add_epi32(l, s), _mm256_and_si256(r, one)));
+                _mm256_storeu_si256((__m256i*)&right[i], _mm256_sub_epi32(l, s));
+            }
+            break;
+        }
+        default: break;
+    }
+    return i;
+}
+#endif
+
+#if defined(MINIFLAC_SIMD_NEON)
+static
+uint32_t
+miniflac_frame_decorrelate_neon(MINIFLAC_CHASSGN assignment, int32_t* left, int32_t* right, uint32_t block_size) {
+    int32x4_t l, r, s;
+    const int32x4_t one = vdupq_n_s32(1);
+    uint32_t i = 0;
+
+    switch(assignment) {
+        case MINIFLAC_CHASSGN_LEFT_SIDE: {
+            for(; i + 4 <= block_size; i += 4) {
+                l = vld1q_s32(&left[i]);
+                r = vld1q_s32(&right[i]);
+                vst1q_s32(&right[i], vsubq_s32(l, r));
+            }
+            break;
+        }
+        case MINIFLAC_CHASSGN_RIGHT_SIDE: {
+            for(; i + 4 <= block_size; i += 4) {
+                l = vld1q_s32(&left[i]);
+                r = vld1q_s32(&right[i]);
+                vst1q_s32(&left[i], vaddq_s32(l, r));
+            }
+            break;
+        }
+        case MINIFLAC_CHASSGN_MID_SIDE: {
+            for(; i + 4 <= block_size; i += 4) {
+                l = vld1q_s32(&left[i]);
+                r = vld1q_s32(&right[i]);
+                s = vshrq_n_s32(r, 1);
+                vst1q_s32(&left[i], vaddq_s32(vaddq_s32(l, s), vandq_s32(r, one)));
+                vst1q_s32(&right[i], vsubq_s32(l, s));
+            }
+            break;
+        }
+        default: break;
+    }
+    return i;
+}
+#endif
+
+static
+void
+miniflac_frame_decorrelate(MINIFLAC_CHASSGN assignment, int32_t* left, int32_t* right, uint32_t block_size) {
+    uint32_t i = 0;
+#if defined(MINIFLAC_SIMD_X86) || defined(MINIFLAC_SIMD_NEON)
+    uint32_t features = miniflac_cpu_features();
+#endif
+
+#if defined(MINIFLAC_SIMD_X86)
+    if(features & MINIFLAC_CPU_AVX2) {
+        i = miniflac_frame_decorrelate_avx2(assignment,left,right,block_size);
+    } else if(features & MINIFLAC_CPU_SSE2) {
+        i = miniflac_frame_decorrelate_sse2(assignment,left,right,block_size);
+    }
+#elif defined(MINIFLAC_SIMD_NEON)
+    if(features & MINIFLAC_CPU_NEON) {
+        i = miniflac_frame_decorrelate_neon(assignment,left,right,block_size);
+    }
+#endif
+
+    miniflac_frame_decorrelate_scalar(assignment,left,right,i,block_size);
+}
+
+MINIFLAC_PRIVATE
+MINIFLAC_RESULT
+miniflac_frame_decode(miniflac_frame_t* frame, miniflac_bitreader_t* br, miniflac_streaminfo_t* info, int32_t** output, const miniflac_output_t* packed) {
+    MINIFLAC_RESULT r;
+    uint8_t bps;
+    uint16_t t;
+    switch(frame->state) {
+        case MINIFLAC_FRAME_SKIP: {
+            r = miniflac_frame_skip(frame,br,info);
+            if(r != MINIFLAC_OK) return r;
+            goto miniflac_frame_decode_subframe;
+        }
+        case MINIFLAC_FRAME_HEADER: {
+            r = miniflac_frame_sync(frame,br,info);
+            if(r != MINIFLAC_OK) return r;
+        }
+        /* fall-through */
+        case MINIFLAC_FRAME_SUBFRAME: {
+            miniflac_frame_decode_subframe:
+            if((output != NULL || packed != NULL) && frame->cur_subframe == 0 && frame->subframe.state == MINIFLAC_SUBFRAME_HEADER && frame->subframe.header.state == MINIFLAC_SUBFRAME_HEADER_RESERVEBIT1) {
+                r = miniflac_frame_decode_fast(frame,br,info,output,packed);
+                if(r < MINIFLAC_CONTINUE) return r;
+            }
+
+            while(frame->cur_subframe < frame->header.channels) {
+                bps = miniflac_frame_subframe_bps(frame);
+                r = miniflac_subframe_decode(&frame->subframe,br,miniflac_frame_channel(frame,output,packed),frame->header.block_size,bps);
+                if(r != MINIFLAC_OK) return r;
+                miniflac_frame_emit(frame,packed);
+
+                miniflac_subframe_init(&frame->subframe);
+                frame->cur_subframe++;
+            }
+
+            miniflac_bitreader_align(br);
+            miniflac_bitreader_update_crc(br);
+            frame->crc16 = br->crc16;
+            frame->state = MINIFLAC_FRAME_FOOTER;
+        }
+        /* fall-through */
+        case MINIFLAC_FRAME_FOOTER: {
+            if(miniflac_bitreader_fill(br,16)) return MINIFLAC_CONTINUE;
+            t = miniflac_bitreader_read(br,16);
+            if(frame->crc16 != t) {
+                miniflac_abort();
+                return MINIFLAC_FRAME_CRC16_INVALID;
+            }
+            miniflac_bitreader_update_crc(br);
+            frame->size = br->tot;
+            if(packed != NULL && frame->header.channels == 2) {
+                if(miniflac_output_narrow(packed,frame->header.bps)) {
+                    miniflac_output_stereo_narrow(packed,frame->header.channel_assignment,packed->scratch,frame->header.block_size,frame->header.bps);
+                } else {
+                    miniflac_output_stereo(packed,frame->header.channel_assignment,packed->scratch,packed->scratch + frame->header.block_size,frame->header.block_size,frame->header.bps);
+                }
+            } else if(output != NULL && frame->header.channel_assignment != MINIFLAC_CHASSGN_NONE) {
+                miniflac_frame_decorrelate(frame->header.channel_assignment,output[0],output[1],frame->header.block_size);
+            }
+            break;
+        }
+        default: {
+            /* invalid state */
+            miniflac_abort();
+            return MINIFLAC_ERROR;
+        }
+    }
+
+    miniflac_bitreader_reset_crc(br);
+    frame->cur_subframe = 0;
+    frame->state = MINIFLAC_FRAME_HEADER;
+    miniflac_subframe_init(&frame->subframe);
+    return MINIFLAC_OK;
+}
+
+/* Every integer format is produced the same way: the sample is shifted
+ * up so its top bit lands in bit 31, then shifted back down to the
+ * width of the format. That left-justifies narrow samples, truncates
+ * wide ones, and is the same in the scalar and SIMD paths. */
+
+#if defined(MINIFLAC_SIMD_X86) || defined(MINIFLAC_SIMD_NEON)
+static
+uint8_t
+miniflac_output_width(MINIFLAC_SAMPLE_FORMAT format) {
+    switch(format) {
+        case MINIFLAC_SAMPLE_INT16: return 16;
+        case MINIFLAC_SAMPLE_INT24: return 24;
+        default: break;
+    }
+    return 32;
+}
+#endif
+
+MINIFLAC_PRIVATE
+uint8_t
+miniflac_output_sample_size(MINIFLAC_SAMPLE_FORMAT format) {
+    switch(format) {
+        case MINIFLAC_SAMPLE_INT16: return 2;
+        case MINIFLAC_SAMPLE_INT24: return 3;
+        default: break;
+    }
+    return 4;
+}
+
+static
+float
+miniflac_output_scale(uint8_t bps) {
+    return 1.0f / (float)((uint32_t)1 << (bps - 1));
+}
+
+static
+void
+miniflac_output_store(MINIFLAC_SAMPLE_FORMAT format, void* buffer, uint32_t index, int32_t sample, uint8_t bps, float scale) {
+    uint32_t u = (uint32_t)sample << (32 - bps);
+    uint8_t* p;
+
+    switch(format) {
+        case MINIFLAC_SAMPLE_INT16: {
+            ((int16_t*)buffer)[index] = (int16_t)(u >> 16);
+            break;
+        }
+        case MINIFLAC_SAMPLE_INT24: {
+            p = (uint8_t*)buffer + (3 * index);
+            p[0] = (uint8_t)(u >> 8);
+            p[1] = (uint8_t)(u >> 16);
+            p[2] = (uint8_t)(u >> 24);
+            break;
+        }
+        case MINIFLAC_SAMPLE_INT32: {
+            ((int32_t*)buffer)[index] = (int32_t)u;
+            break;
+        }
+        case MINIFLAC_SAMPLE_FLOAT32: {
+            ((float*)buffer)[index] = (float)sample * scale;
+            break;
+        }
+        default: break;
+    }
+}
+
+MINIFLAC_PRIVATE
+void
+miniflac_output_channel(const miniflac_output_t* out, const int32_t* input, uint32_t block_size, uint8_t bps, uint8_t channel, uint8_t channels) {
+    uint32_t i;
+    void* buffer = out->samples;
+    const float scale = miniflac_output_scale(bps);
+
+    if(buffer == NULL) {
+        buffer = out->planes[channel];
+        channel = 0;
+        channels = 1;
+    }
+
+    for(i = 0; i < block_size; i++) {
+        miniflac_output_store(out->format, buffer, (i * channels) + channel, input[i], bps, scale);
+    }
+}
+
+/* Planar 16-bit output of a stereo pair only needs scratch for one
+ * channel. The first channel is stored as soon as it's restored,
+ * left-justified and cut down to 16 bits. Decorrelation only adds and
+ * subtracts the first channel, so doing it modulo 2^16 on those stored
+ * bits gives the same 16 bits as doing it on the full samples - as long
+ * as nothing was shifted out of the bottom, which holds while bps <= 16.
+ * The second channel (which is the side channel whenever a shift is
+ * involved) is still whole in scratch. */
+
+MINIFLAC_PRIVATE
+uint8_t
+miniflac_output_narrow(const miniflac_output_t* out, uint8_t bps) {
+    return out->samples == NULL && out->format == MINIFLAC_SAMPLE_INT16 && bps <= 16;
+}
+
+MINIFLAC_PRIVATE
+void
+miniflac_output_stereo_narrow(const miniflac_output_t* out, MINIFLAC_CHASSGN assignment, const int32_t* right, uint32_t block_size, uint8_t bps) {
+    uint32_t i;
+    uint32_t s;
+    int16_t* l16 = (int16_t*)out->planes[0];
+    int16_t* r16 = (int16_t*)out->planes[1];
+    const uint8_t shift = 16 - bps;
+
+    switch(assignment) {
+        case MINIFLAC_CHASSGN_LEFT_SIDE: {
+            for(i = 0; i < block_size; i++) {
+                r16[i] = (int16_t)((uint32_t)l16[i] - ((uint32_t)right[i] << shift));
+            }
+            break;
+        }
+        case MINIFLAC_CHASSGN_RIGHT_SIDE: {
+            for(i = 0; i < block_size; i++) {
+                r16[i] = (int16_t)((uint32_t)right[i] << shift);
+                l16[i] = (int16_t)((uint32_t)l16[i] + (uint32_t)r16[i]);
+            }
+            break;
+        }
+        case MINIFLAC_CHASSGN_MID_SIDE: {
+            for(i = 0; i < block_size; i++) {
+                s = (uint32_t)(right[i] >> 1);
+                r16[i] = (int16_t)((uint32_t)l16[i] - (s << shift));
+                l16[i] = (int16_t)((uint32_t)l16[i] + ((s + ((uint32_t)right[i] & 1)) << shift));
+            }
+            break;
+        }
+        default: {
+            for(i = 0; i < block_size; i++) {
+                r16[i] = (int16_t)((uint32_t)right[i] << shift);
             }
-            ogg->pos = 0;
-            ogg->state = MINIFLAC_OGG_DATA;
-            return MINIFLAC_OK;
+            break;
         }
     }
-    return MINIFLAC_ERROR;
 }
 
-MINIFLAC_PRIVATE
+/* see miniflac_frame_decorrelate_scalar for the mid/side math */
+static
 void
-miniflac_frame_init(miniflac_frame_t* frame) {
-    frame->crc16 = 0;
-    frame->cur_subframe = 0;
-    frame->state = MINIFLAC_FRAME_HEADER;
-    miniflac_frame_header_init(&frame->header);
-    miniflac_subframe_init(&frame->subframe);
-}
-
-MINIFLAC_PRIVATE
-MINIFLAC_RESULT
-miniflac_frame_sync(miniflac_frame_t* frame, miniflac_bitreader_t* br, miniflac_streaminfo_t* info) {
-    MINIFLAC_RESULT r;
-    assert(frame->state == MINIFLAC_FRAME_HEADER);
-    r = miniflac_frame_header_decode(&frame->header,br);
-    if(r != MINIFLAC_OK) return r;
-
-    if(frame->header.sample_rate == 0) {
-        if(info->sample_rate == 0) return MINIFLAC_FRAME_INVALID_SAMPLE_RATE;
-        frame->header.sample_rate = info->sample_rate;
+miniflac_output_stereo_scalar(const miniflac_output_t* out, MINIFLAC_CHASSGN assignment, const int32_t* left, const int32_t* right, uint32_t start, uint32_t block_size, uint8_t bps) {
+    uint32_t i;
+    uint32_t m, s;
+    int32_t l, r;
+    void* lbuf = out->samples;
+    void* rbuf = out->samples;
+    uint32_t stride = 2;
+    uint32_t roffset = 1;
+    const float scale = miniflac_output_scale(bps);
+
+    if(out->samples == NULL) {
+        lbuf = out->planes[0];
+        rbuf = out->planes[1];
+        stride = 1;
+        roffset = 0;
     }
 
-    if(frame->header.bps == 0) {
-        if(info->bps == 0) return MINIFLAC_FRAME_INVALID_SAMPLE_SIZE;
-        frame->header.bps = info->bps;
+    for(i = start; i < block_size; i++) {
+        l = left[i];
+        r = right[i];
+        switch(assignment) {
+            case MINIFLAC_CHASSGN_LEFT_SIDE: {
+                r = (int32_t)((uint32_t)l - (uint32_t)r);
+                break;
+            }
+            case MINIFLAC_CHASSGN_RIGHT_SIDE: {
+                l = (int32_t)((uint32_t)l + (uint32_t)r);
+                break;
+            }
+            case MINIFLAC_CHASSGN_MID_SIDE: {
+                m = (uint32_t)l;
+                s = (uint32_t)(r >> 1);
+                l = (int32_t)(m + s + ((uint32_t)r & 1));
+                r = (int32_t)(m - s);
+                break;
+            }
+            default: break;
+        }
+        miniflac_output_store(out->format, lbuf, stride * i, l, bps, scale);
+        miniflac_output_store(out->format, rbuf, (stride * i) + roffset, r, bps, scale);
     }
-
-    frame->state = MINIFLAC_FRAME_SUBFRAME;
-    frame->cur_subframe = 0;
-    miniflac_subframe_init(&frame->subframe);
-    return MINIFLAC_OK;
 }
 
-MINIFLAC_PRIVATE
-MINIFLAC_RESULT
-miniflac_frame_decode(miniflac_frame_t* frame, miniflac_bitreader_t* br, miniflac_streaminfo_t* info, int32_t** output) {
-    MINIFLAC_RESULT r;
-    uint32_t bps;
-    uint32_t i;
-    uint64_t m,s;
-    uint16_t t;
-    switch(frame->state) {
-        case MINIFLAC_FRAME_HEADER: {
-            r = miniflac_frame_sync(frame,br,info);
-            if(r != MINIFLAC_OK) return r;
+/* the SIMD variants decorrelate, convert and store (interleaved or
+ * planar) whole vectors in one pass and return how many samples they
+ * did, the scalar loop finishes the rest. 24-bit output is always
+ * scalar. */
+
+#if defined(MINIFLAC_SIMD_X86)
+static MINIFLAC_TARGET("sse2")
+uint32_t
+miniflac_output_stereo_sse2(const miniflac_output_t* out, MINIFLAC_CHASSGN assignment, const int32_t* left, const int32_t* right, uint32_t block_size, uint8_t bps) {
+    __m128i l, r, s, t;
+    __m128 lf, rf;
+    const __m128i one = _mm_set1_epi32(1);
+    const __m128i lshift = _mm_cvtsi32_si128(32 - bps);
+    const __m128i rshift = _mm_cvtsi32_si128(32 - miniflac_output_width(out->format));
+    const __m128 scale = _mm_set1_ps(miniflac_output_scale(bps));
+    uint32_t i = 0;
+
+    if(out->format == MINIFLAC_SAMPLE_INT24) return 0;
+
+    for(; i + 4 <= block_size; i += 4) {
+        l = _mm_loadu_si128((const __m128i*)&left[i]);
+        r = _mm_loadu_si128((const __m128i*)&right[i]);
+        switch(assignment) {
+            case MINIFLAC_CHASSGN_LEFT_SIDE: {
+                r = _mm_sub_epi32(l, r);
+                break;
+            }
+            case MINIFLAC_CHASSGN_RIGHT_SIDE: {
+                l = _mm_add_epi32(l, r);
+                break;
+            }
+            case MINIFLAC_CHASSGN_MID_SIDE: {
+                s = _mm_srai_epi32(r, 1);
+                t = _mm_add_epi32(_mm_add_epi32(l, s), _mm_and_si128(r, one));
+                r = _mm_sub_epi32(l, s);
+                l = t;
+                break;
+            }
+            default: break;
         }
-        /* fall-through */
-        case MINIFLAC_FRAME_SUBFRAME: {
-            while(frame->cur_subframe < frame->header.channels) {
-                bps = frame->header.bps;
-                if(frame->header.channel_assignment == MINIFLAC_CHASSGN_LEFT_SIDE || frame->header.channel_assignment == MINIFLAC_CHASSGN_MID_SIDE) {
-                    if(frame->cur_subframe == 1) bps += 1;
-                } else if(frame->header.channel_assignment == MINIFLAC_CHASSGN_RIGHT_SIDE) {
-                    if(frame->cur_subframe == 0) bps += 1;
+        switch(out->format) {
+            case MINIFLAC_SAMPLE_INT16: {
+                l = _mm_sra_epi32(_mm_sll_epi32(l, lshift), rshift);
+                r = _mm_sra_epi32(_mm_sll_epi32(r, lshift), rshift);
+                if(out->samples != NULL) {
+                    _mm_storeu_si128((__m128i*)&((int16_t*)out->samples)[2 * i], _mm_packs_epi32(_mm_unpacklo_epi32(l, r), _mm_unpackhi_epi32(l, r)));
+                } else {
+                    _mm_storel_epi64((__m128i*)&((int16_t*)out->planes[0])[i], _mm_packs_epi32(l, l));
+                    _mm_storel_epi64((__m128i*)&((int16_t*)out->planes[1])[i], _mm_packs_epi32(r, r));
                 }
-                r = miniflac_subframe_decode(&frame->subframe,br,output == NULL ? NULL : output[frame->cur_subframe],frame->header.block_size,bps);
-                if(r != MINIFLAC_OK) return r;
-
-                miniflac_subframe_init(&frame->subframe);
-                frame->cur_subframe++;
+                break;
+            }
+            case MINIFLAC_SAMPLE_INT32: {
+                l = _mm_sll_epi32(l, lshift);
+                r = _mm_sll_epi32(r, lshift);
+                if(out->samples != NULL) {
+                    _mm_storeu_si128((__m128i*)&((int32_t*)out->samples)[2 * i], _mm_unpacklo_epi32(l, r));
+                    _mm_storeu_si128((__m128i*)&((int32_t*)out->samples)[(2 * i) + 4], _mm_unpackhi_epi32(l, r));
+                } else {
+                    _mm_storeu_si128((__m128i*)&((int32_t*)out->planes[0])[i], l);
+                    _mm_storeu_si128((__m128i*)&((int32_t*)out->planes[1])[i], r);
+                }
+                break;
+            }
+            default: {
+                lf = _mm_mul_ps(_mm_cvtepi32_ps(l), scale);
+                rf = _mm_mul_ps(_mm_cvtepi32_ps(r), scale);
+                if(out->samples != NULL) {
+                    _mm_storeu_ps(&((float*)out->samples)[2 * i], _mm_unpacklo_ps(lf, rf));
+                    _mm_storeu_ps(&((float*)out->samples)[(2 * i) + 4], _mm_unpackhi_ps(lf, rf));
+                } else {
+                    _mm_storeu_ps(&((float*)out->planes[0])[i], lf);
+                    _mm_storeu_ps(&((float*)out->planes[1])[i], rf);
+                }
+                break;
             }
+        }
+    }
+    return i;
+}
 
-            miniflac_bitreader_align(br);
-            frame->crc16 = br->crc16;
-            frame->state = MINIFLAC_FRAME_FOOTER;
+static MINIFLAC_TARGET("avx2")
+uint32_t
+miniflac_output_stereo_avx2(const miniflac_output_t* out, MINIFLAC_CHASSGN assignment, const int32_t* left, const int32_t* right, uint32_t block_size, uint8_t bps) {
+    __m256i l, r, s, t, lo, hi;
+    __m256 lf, rf, lof, hif;
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m128i lshift = _mm_cvtsi32_si128(32 - bps);
+    const __m128i rshift = _mm_cvtsi32_si128(32 - miniflac_output_width(out->format));
+    const __m256 scale = _mm256_set1_ps(miniflac_output_scale(bps));
+    uint32_t i = 0;
+
+    if(out->format == MINIFLAC_SAMPLE_INT24) return 0;
+
+    for(; i + 8 <= block_size; i += 8) {
+        l = _mm256_loadu_si256((const __m256i*)&left[i]);
+        r = _mm256_loadu_si256((const __m256i*)&right[i]);
+        switch(assignment) {
+            case MINIFLAC_CHASSGN_LEFT_SIDE: {
+                r = _mm256_sub_epi32(l, r);
+                break;
+            }
+            case MINIFLAC_CHASSGN_RIGHT_SIDE: {
+                l = _mm256_add_epi32(l, r);
+                break;
+            }
+            case MINIFLAC_CHASSGN_MID_SIDE: {
+                s = _mm256_srai_epi32(r, 1);
+                t = _mm256_add_epi32(_mm256_add_epi32(l, s), _mm256_and_si256(r, one));
+                r = _mm256_sub_epi32(l, s);
+                l = t;
+                break;
+            }
+            default: break;
         }
-        /* fall-through */
-        case MINIFLAC_FRAME_FOOTER: {
-            if(miniflac_bitreader_fill(br,16)) return MINIFLAC_CONTINUE;
-            t = miniflac_bitreader_read(br,16);
-            if(frame->crc16 != t) {
-                miniflac_abort();
-                return MINIFLAC_FRAME_CRC16_INVALID;
+        /* the unpacks work within 128-bit lanes, so 32-bit results
+         * need the halves put back in order. packs_epi32 is also
+         * per-lane, which cancels that out for interleaved 16-bit
+         * results, and leaves planar ones as l0-3 r0-3 l4-7 r4-7. */
+        switch(out->format) {
+            case MINIFLAC_SAMPLE_INT16: {
+                l = _mm256_sra_epi32(_mm256_sll_epi32(l, lshift), rshift);
+                r = _mm256_sra_epi32(_mm256_sll_epi32(r, lshift), rshift);
+                if(out->samples != NULL) {
+                    _mm256_storeu_si256((__m256i*)&((int16_t*)out->samples)[2 * i], _mm256_packs_epi32(_mm256_unpacklo_epi32(l, r), _mm256_unpackhi_epi32(l, r)));
+                } else {
+                    lo = _mm256_permute4x64_epi64(_mm256_packs_epi32(l, r), 0xD8);
+                    _mm_storeu_si128((__m128i*)&((int16_t*)out->planes[0])[i], _mm256_castsi256_si128(lo));
+                    _mm_storeu_si128((__m128i*)&((int16_t*)out->planes[1])[i], _mm256_extracti128_si256(lo, 1));
+                }
+                break;
             }
-            frame->size = br->tot;
-            if(output != NULL) {
-                switch(frame->header.channel_assignment) {
-                    case MINIFLAC_CHASSGN_LEFT_SIDE: {
-                        for(i=0;i<frame->header.block_size;i++) {
-                            output[1][i] = output[0][i] - output[1][i];
-                        }
-                        break;
-                    }
-                    case MINIFLAC_CHASSGN_RIGHT_SIDE: {
-                        for(i=0;i<frame->header.block_size;i++) {
-                            output[0][i] = output[0][i] + output[1][i];
-                        }
-                        break;
-                    }
-                    case MINIFLAC_CHASSGN_MID_SIDE: {
-                        for(i=0;i<frame->header.block_size;i++) {
-                            m = (uint64_t)output[0][i];
-                            s = (uint64_t)output[1][i];
-                            m = (m << 1) | (s & 0x01);
-                            output[0][i] = (int32_t)((m + s) >> 1 );
-                            output[1][i] = (int32_t)((m - s) >> 1 );
-                        }
-                        break;
-                    }
-                    default: break;
+            case MINIFLAC_SAMPLE_INT32: {
+                l = _mm256_sll_epi32(l, lshift);
+                r = _mm256_sll_epi32(r, lshift);
+                if(out->samples != NULL) {
+                    lo = _mm256_unpacklo_epi32(l, r);
+                    hi = _mm256_unpackhi_epi32(l, r);
+                    _mm256_storeu_si256((__m256i*)&((int32_t*)out->samples)[2 * i], _mm256_permute2x128_si256(lo, hi, 0x20));
+                    _mm256_storeu_si256((__m256i*)&((int32_t*)out->samples)[(2 * i) + 8], _mm256_permute2x128_si256(lo, hi, 0x31));
+                } else {
+                    _mm256_storeu_si256((__m256i*)&((int32_t*)out->planes[0])[i], l);
+                    _mm256_storeu_si256((__m256i*)&((int32_t*)out->planes[1])[i], r);
                 }
+                break;
+            }
+            default: {
+                lf = _mm256_mul_ps(_mm256_cvtepi32_ps(l), scale);
+                rf = _mm256_mul_ps(_mm256_cvtepi32_ps(r), scale);
+                if(out->samples != NULL) {
+                    lof = _mm256_unpacklo_ps(lf, rf);
+                    hif = _mm256_unpackhi_ps(lf, rf);
+                    _mm256_storeu_ps(&((float*)out->samples)[2 * i], _mm256_permute2f128_ps(lof, hif, 0x20));
+                    _mm256_storeu_ps(&((float*)out->samples)[(2 * i) + 8], _mm256_permute2f128_ps(lof, hif, 0x31));
+                } else {
+                    _mm256_storeu_ps(&((float*)out->planes[0])[i], lf);
+                    _mm256_storeu_ps(&((float*)out->planes[1])[i], rf);
+                }
+                break;
             }
-            break;
         }
-        default: {
-            /* invalid state */
-            miniflac_abort();
-            return MINIFLAC_ERROR;
+    }
+    return i;
+}
+#endif
+
+#if defined(MINIFLAC_SIMD_NEON)
+static
+uint32_t
+miniflac_output_stereo_neon(const miniflac_output_t* out, MINIFLAC_CHASSGN assignment, const int32_t* left, const int32_t* right, uint32_t block_size, uint8_t bps) {
+    int32x4_t l, r, s, t;
+    int16x4x2_t v16;
+    int32x4x2_t v32;
+    float32x4x2_t vf;
+    const int32x4_t one = vdupq_n_s32(1);
+    const int32x4_t lshift = vdupq_n_s32(32 - bps);
+    const int32x4_t rshift = vdupq_n_s32(miniflac_output_width(out->format) - 32);
+    const float scale = miniflac_output_scale(bps);
+    uint32_t i = 0;
+
+    if(out->format == MINIFLAC_SAMPLE_INT24) return 0;
+
+    for(; i + 4 <= block_size; i += 4) {
+        l = vld1q_s32(&left[i]);
+        r = vld1q_s32(&right[i]);
+        switch(assignment) {
+            case MINIFLAC_CHASSGN_LEFT_SIDE: {
+                r = vsubq_s32(l, r);
+                break;
+            }
+            case MINIFLAC_CHASSGN_RIGHT_SIDE: {
+                l = vaddq_s32(l, r);
+                break;
+            }
+            case MINIFLAC_CHASSGN_MID_SIDE: {
+                s = vshrq_n_s32(r, 1);
+                t = vaddq_s32(vaddq_s32(l, s), vandq_s32(r, one));
+                r = vsubq_s32(l, s);
+                l = t;
+                break;
+            }
+            default: break;
+        }
+        switch(out->format) {
+            case MINIFLAC_SAMPLE_INT16: {
+                v16.val[0] = vmovn_s32(vshlq_s32(vshlq_s32(l, lshift), rshift));
+                v16.val[1] = vmovn_s32(vshlq_s32(vshlq_s32(r, lshift), rshift));
+                if(out->samples != NULL) {
+                    vst2_s16(&((int16_t*)out->samples)[2 * i], v16);
+                } else {
+                    vst1_s16(&((int16_t*)out->planes[0])[i], v16.val[0]);
+                    vst1_s16(&((int16_t*)out->planes[1])[i], v16.val[1]);
+                }
+                break;
+            }
+            case MINIFLAC_SAMPLE_INT32: {
+                v32.val[0] = vshlq_s32(l, lshift);
+                v32.val[1] = vshlq_s32(r, lshift);
+                if(out->samples != NULL) {
+                    vst2q_s32(&((int32_t*)out->samples)[2 * i], v32);
+                } else {
+                    vst1q_s32(&((int32_t*)out->planes[0])[i], v32.val[0]);
+                    vst1q_s32(&((int32_t*)out->planes[1])[i], v32.val[1]);
+                }
+                break;
+            }
+            default: {
+                vf.val[0] = vmulq_n_f32(vcvtq_f32_s32(l), scale);
+                vf.val[1] = vmulq_n_f32(vcvtq_f32_s32(r), scale);
+                if(out->samples != NULL) {
+                    vst2q_f32(&((float*)out->samples)[2 * i], vf);
+                } else {
+                    vst1q_f32(&((float*)out->planes[0])[i], vf.val[0]);
+                    vst1q_f32(&((float*)out->planes[1])[i], vf.val[1]);
+                }
+                break;
+            }
         }
     }
+    return i;
+}
+#endif
 
-    assert(br->bits == 0);
-    br->crc8 = 0;
-    br->crc16 = 0;
-    frame->cur_subframe = 0;
-    frame->state = MINIFLAC_FRAME_HEADER;
-    miniflac_subframe_init(&frame->subframe);
-    return MINIFLAC_OK;
+MINIFLAC_PRIVATE
+void
+miniflac_output_stereo(const miniflac_output_t* out, MINIFLAC_CHASSGN assignment, const int32_t* left, const int32_t* right, uint32_t block_size, uint8_t bps) {
+    uint32_t i = 0;
+#if defined(MINIFLAC_SIMD_X86) || defined(MINIFLAC_SIMD_NEON)
+    uint32_t features = miniflac_cpu_features();
+#endif
+
+#if defined(MINIFLAC_SIMD_X86)
+    if(features & MINIFLAC_CPU_AVX2) {
+        i = miniflac_output_stereo_avx2(out,assignment,left,right,block_size,bps);
+    } else if(features & MINIFLAC_CPU_SSE2) {
+        i = miniflac_output_stereo_sse2(out,assignment,left,right,block_size,bps);
+    }
+#elif defined(MINIFLAC_SIMD_NEON)
+    if(features & MINIFLAC_CPU_NEON) {
+        i = miniflac_output_stereo_neon(out,assignment,left,right,block_size,bps);
+    }
+#endif
+
+    miniflac_output_stereo_scalar(out,assignment,left,right,i,block_size,bps);
 }
 
 MINIFLAC_PRIVATE
@@ -3906,7 +7772,8 @@ miniflac_frame_header_decode(miniflac_frame_header_t* header, miniflac_bitreader
                 default: break;
             }
 
-            /* grab crc8 from bitreader before fill */
+            /* grab crc8 from bitreader before reading the crc byte */
+            miniflac_bitreader_update_crc(br);
             header->crc8 = br->crc8;
             header->state = MINIFLAC_FRAME_HEADER_CRC8;
         }
@@ -3928,6 +7795,54 @@ miniflac_frame_header_decode(miniflac_frame_header_t* header, miniflac_bitreader
     return MINIFLAC_OK;
 }
 
+MINIFLAC_PRIVATE
+int
+miniflac_frame_header_check(const uint8_t* data, uint32_t length) {
+    uint32_t size = 6; /* sync code, 2 bytes of codes, first sample number byte, crc8 */
+    uint32_t extra = 0;
+    uint32_t i;
+    uint8_t t;
+
+    if(length < 2) return length == 0 || data[0] == 0xFF ? -1 : 0;
+    if(data[0] != 0xFF || (data[1] & 0xFE) != 0xF8) return 0;
+    if(length < 5) return -1;
+
+    /* reserved block size and sample rate */
+    if((data[2] >> 4) == 0 || (data[2] & 0x0F) == 0x0F) return 0;
+    /* reserved channel assignment, sample size and bit */
+    if((data[3] >> 4) > 10 || ((data[3] >> 1) & 0x03) == 0x03 || (data[3] & 0x01)) return 0;
+
+    t = data[4];
+    if((t & 0x80) == 0x00) extra = 0;
+    else if((t & 0xE0) == 0xC0) extra = 1;
+    else if((t & 0xF0) == 0xE0) extra = 2;
+    else if((t & 0xF8) == 0xF0) extra = 3;
+    else if((t & 0xFC) == 0xF8) extra = 4;
+    else if((t & 0xFE) == 0xFC) extra = 5;
+    else if(t == 0xFE) extra = 6;
+    else return 0;
+    size += extra;
+
+    switch(data[2] >> 4) {
+        case 6: size += 1; break;
+        case 7: size += 2; break;
+        default: break;
+    }
+    switch(data[2] & 0x0F) {
+        case 12: size += 1; break;
+        case 13: /* fall-through */
+        case 14: size += 2; break;
+        default: break;
+    }
+
+    if(length < size) return -1;
+    for(i = 0; i < extra; i++) {
+        if((data[5 + i] & 0xC0) != 0x80) return 0;
+    }
+    if(miniflac_bitreader_crc8(data,size - 1) != data[size - 1]) return 0;
+    return (int)size;
+}
+
 
 MINIFLAC_PRIVATE
 void
@@ -5057,6 +8972,43 @@ miniflac_seektable_read_samples(miniflac_seektable_t* seektable, miniflac_bitrea
     return MINIFLAC_ERROR;
 }
 
+MINIFLAC_PRIVATE
+MINIFLAC_RESULT
+miniflac_seektable_read_points(miniflac_seektable_t* seektable, miniflac_bitreader_t* br, miniflac_seekpoint_t* points, uint32_t length, uint32_t* outlen) {
+    MINIFLAC_RESULT r = MINIFLAC_ERROR;
+    miniflac_seekpoint_t* point;
+
+    while(seektable->pos < seektable->len) {
+        point = (points != NULL && seektable->pos < length) ? &points[seektable->pos] : NULL;
+        switch(seektable->state) {
+            case MINIFLAC_SEEKTABLE_SAMPLE_NUMBER: {
+                r = miniflac_seektable_read_sample_number(seektable,br,point == NULL ? NULL : &point->sample_number);
+                if(r != MINIFLAC_OK) return r;
+            }
+            /* fall-through */
+            case MINIFLAC_SEEKTABLE_SAMPLE_OFFSET: {
+                r = miniflac_seektable_read_sample_offset(seektable,br,point == NULL ? NULL : &point->sample_offset);
+                if(r != MINIFLAC_OK) return r;
+            }
+            /* fall-through */
+            case MINIFLAC_SEEKTABLE_SAMPLES: {
+                r = miniflac_seektable_read_samples(seektable,br,point == NULL ? NULL : &point->samples);
+                if(r != MINIFLAC_OK) return r;
+                break;
+            }
+            default: {
+                miniflac_abort();
+                return MINIFLAC_ERROR;
+            }
+        }
+    }
+
+    if(outlen != NULL) {
+        *outlen = seektable->len < length ? seektable->len : length;
+    }
+    return MINIFLAC_OK;
+}
+
 MINIFLAC_PRIVATE
 void
 miniflac_application_init(miniflac_application_t* application) {
@@ -5308,9 +9260,7 @@ miniflac_metadata_decode(miniflac_metadata_t* metadata, miniflac_bitreader_t* br
 
     if(r != MINIFLAC_OK) return r;
 
-    assert(br->bits == 0);
-    br->crc8  = 0;
-    br->crc16 = 0;
+    miniflac_bitreader_reset_crc(br);
     metadata->state = MINIFLAC_METADATA_HEADER;
     metadata->pos   = 0;
     return MINIFLAC_OK;
@@ -5378,6 +9328,2597 @@ static const uint8_t escape_codes[2] = {
     31,
 };
 
+/* minimum number of residuals to decode before handing them to the
+ * restore callback, keeps the per-call setup of the predictors cheap
+ * when there are many tiny partitions */
+#ifndef MINIFLAC_RESIDUAL_RESTORE_CHUNK
+#define MINIFLAC_RESIDUAL_RESTORE_CHUNK 256
+#endif
+
+#ifdef MINIFLAC_RICE_TABLE
+/* generated by utils/rice-table.pl - for rice parameters 0-4, maps the
+ * next 12 bits to up to 3 decoded residuals:
+ *   bits 0-3:   number of bits used
+ *   bits 4-5:   number of residuals decoded (0 if the first codeword
+ *               doesn't fit in 12 bits)
+ *   bits 8-31:  the residuals, as int8 */
+#define MINIFLAC_RICE_TABLE_BITS 12
+#define MINIFLAC_RICE_TABLE_MAX_PARAMETER 4
+
+static const uint32_t miniflac_rice_table[5][4096] = {
+  {
+    0x00000000, 0x0000fa1c, 0x0000051b, 0x0000052c, 0x0000fb1a, 0x00fffb2c, 0x0000fb2b, 0x0000fb3c,
+    0x00000419, 0x0001042c, 0x00ff042b, 0x00ff043c, 0x0000042a, 0xff00043c, 0x0000043b, 0x0000043b,
+    0x0000fc18, 0x00fefc2c, 0x0001fc2b, 0x0001fc3c, 0x00fffc2a, 0xfffffc3c, 0x00fffc3b, 0x00fffc3b,
+    0x0000fc29, 0x0100fc3c, 0xff00fc3b, 0xff00fc3b, 0x0000fc3a, 0x0000fc3a, 0x0000fc3a, 0x0000fc3a,
+    0x00000317, 0x0002032c, 0x00fe032b, 0x00fe033c, 0x0001032a, 0xff01033c, 0x0001033b, 0x0001033b,
+    0x00ff0329, 0x01ff033c, 0xffff033b, 0xffff033b, 0x00ff033a, 0x00ff033a, 0x00ff033a, 0x00ff033a,
+    0x00000328, 0xfe00033c, 0x0100033b, 0x0100033b, 0xff00033a, 0xff00033a, 0xff00033a, 0xff00033a,
+    0x00000339, 0x00000339, 0x00000339, 0x00000339, 0x00000339, 0x00000339, 0x00000339, 0x00000339,
+    0x0000fd16, 0x00fdfd2c, 0x0002fd2b, 0x0002fd3c, 0x00fefd2a, 0xfffefd3c, 0x00fefd3b, 0x00fefd3b,
+    0x0001fd29, 0x0101fd3c, 0xff01fd3b, 0xff01fd3b, 0x0001fd3a, 0x0001fd3a, 0x0001fd3a, 0x0001fd3a,
+    0x00fffd28, 0xfefffd3c, 0x01fffd3b, 0x01fffd3b, 0xfffffd3a, 0xfffffd3a, 0xfffffd3a, 0xfffffd3a,
+    0x00fffd39, 0x00fffd39, 0x00fffd39, 0x00fffd39, 0x00fffd39, 0x00fffd39, 0x00fffd39, 0x00fffd39,
+    0x0000fd27, 0x0200fd3c, 0xfe00fd3b, 0xfe00fd3b, 0x0100fd3a, 0x0100fd3a, 0x0100fd3a, 0x0100fd3a,
+    0xff00fd39, 0xff00fd39, 0xff00fd39, 0xff00fd39, 0xff00fd39, 0xff00fd39, 0xff00fd39, 0xff00fd39,
+    0x0000fd38, 0x0000fd38, 0x0000fd38, 0x0000fd38, 0x0000fd38, 0x0000fd38, 0x0000fd38, 0x0000fd38,
+    0x0000fd38, 0x0000fd38, 0x0000fd38, 0x0000fd38, 0x0000fd38, 0x0000fd38, 0x0000fd38, 0x0000fd38,
+    0x00000215, 0x0003022c, 0x00fd022b, 0x00fd023c, 0x0002022a, 0xff02023c, 0x0002023b, 0x0002023b,
+    0x00fe0229, 0x01fe023c, 0xfffe023b, 0xfffe023b, 0x00fe023a, 0x00fe023a, 0x00fe023a, 0x00fe023a,
+    0x00010228, 0xfe01023c, 0x0101023b, 0x0101023b, 0xff01023a, 0xff01023a, 0xff01023a, 0xff01023a,
+    0x00010239, 0x00010239, 0x00010239, 0x00010239, 0x00010239, 0x00010239, 0x00010239, 0x00010239,
+    0x00ff0227, 0x02ff023c, 0xfeff023b, 0xfeff023b, 0x01ff023a, 0x01ff023a, 0x01ff023a, 0x01ff023a,
+    0xffff0239, 0xffff0239, 0xffff0239, 0xffff0239, 0xffff0239, 0xffff0239, 0xffff0239, 0xffff0239,
+    0x00ff0238, 0x00ff0238, 0x00ff0238, 0x00ff0238, 0x00ff0238, 0x00ff0238, 0x00ff0238, 0x00ff0238,
+    0x00ff0238, 0x00ff0238, 0x00ff0238, 0x00ff0238, 0x00ff0238, 0x00ff0238, 0x00ff0238, 0x00ff0238,
+    0x00000226, 0xfd00023c, 0x0200023b, 0x0200023b, 0xfe00023a, 0xfe00023a, 0xfe00023a, 0xfe00023a,
+    0x01000239, 0x01000239, 0x01000239, 0x01000239, 0x01000239, 0x01000239, 0x01000239, 0x01000239,
+    0xff000238, 0xff000238, 0xff000238, 0xff000238, 0xff000238, 0xff000238, 0xff000238, 0xff000238,
+    0xff000238, 0xff000238, 0xff000238, 0xff000238, 0xff000238, 0xff000238, 0xff000238, 0xff000238,
+    0x00000237, 0x00000237, 0x00000237, 0x00000237, 0x00000237, 0x00000237, 0x00000237, 0x00000237,
+    0x00000237, 0x00000237, 0x00000237, 0x00000237, 0x00000237, 0x00000237, 0x00000237, 0x00000237,
+    0x00000237, 0x00000237, 0x00000237, 0x00000237, 0x00000237, 0x00000237, 0x00000237, 0x00000237,
+    0x00000237, 0x00000237, 0x00000237, 0x00000237, 0x00000237, 0x00000237, 0x00000237, 0x00000237,
+    0x0000fe14, 0x00fcfe2c, 0x0003fe2b, 0x0003fe3c, 0x00fdfe2a, 0xfffdfe3c, 0x00fdfe3b, 0x00fdfe3b,
+    0x0002fe29, 0x0102fe3c, 0xff02fe3b, 0xff02fe3b, 0x0002fe3a, 0x0002fe3a, 0x0002fe3a, 0x0002fe3a,
+    0x00fefe28, 0xfefefe3c, 0x01fefe3b, 0x01fefe3b, 0xfffefe3a, 0xfffefe3a, 0xfffefe3a, 0xfffefe3a,
+    0x00fefe39, 0x00fefe39, 0x00fefe39, 0x00fefe39, 0x00fefe39, 0x00fefe39, 0x00fefe39, 0x00fefe39,
+    0x0001fe27, 0x0201fe3c, 0xfe01fe3b, 0xfe01fe3b, 0x0101fe3a, 0x0101fe3a, 0x0101fe3a, 0x0101fe3a,
+    0xff01fe39, 0xff01fe39, 0xff01fe39, 0xff01fe39, 0xff01fe39, 0xff01fe39, 0xff01fe39, 0xff01fe39,
+    0x0001fe38, 0x0001fe38, 0x0001fe38, 0x0001fe38, 0x0001fe38, 0x0001fe38, 0x0001fe38, 0x0001fe38,
+    0x0001fe38, 0x0001fe38, 0x0001fe38, 0x0001fe38, 0x0001fe38, 0x0001fe38, 0x0001fe38, 0x0001fe38,
+    0x00fffe26, 0xfdfffe3c, 0x02fffe3b, 0x02fffe3b, 0xfefffe3a, 0xfefffe3a, 0xfefffe3a, 0xfefffe3a,
+    0x01fffe39, 0x01fffe39, 0x01fffe39, 0x01fffe39, 0x01fffe39, 0x01fffe39, 0x01fffe39, 0x01fffe39,
+    0xfffffe38, 0xfffffe38, 0xfffffe38, 0xfffffe38, 0xfffffe38, 0xfffffe38, 0xfffffe38, 0xfffffe38,
+    0xfffffe38, 0xfffffe38, 0xfffffe38, 0xfffffe38, 0xfffffe38, 0xfffffe38, 0xfffffe38, 0xfffffe38,
+    0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37,
+    0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37,
+    0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37,
+    0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37,
+    0x0000fe25, 0x0300fe3c, 0xfd00fe3b, 0xfd00fe3b, 0x0200fe3a, 0x0200fe3a, 0x0200fe3a, 0x0200fe3a,
+    0xfe00fe39, 0xfe00fe39, 0xfe00fe39, 0xfe00fe39, 0xfe00fe39, 0xfe00fe39, 0xfe00fe39, 0xfe00fe39,
+    0x0100fe38, 0x0100fe38, 0x0100fe38, 0x0100fe38, 0x0100fe38, 0x0100fe38, 0x0100fe38, 0x0100fe38,
+    0x0100fe38, 0x0100fe38, 0x0100fe38, 0x0100fe38, 0x0100fe38, 0x0100fe38, 0x0100fe38, 0x0100fe38,
+    0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37,
+    0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37,
+    0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37,
+    0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37,
+    0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36,
+    0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36,
+    0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36,
+    0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36,
+    0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36,
+    0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36,
+    0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36,
+    0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36,
+    0x00000113, 0x0004012c, 0x00fc012b, 0x00fc013c, 0x0003012a, 0xff03013c, 0x0003013b, 0x0003013b,
+    0x00fd0129, 0x01fd013c, 0xfffd013b, 0xfffd013b, 0x00fd013a, 0x00fd013a, 0x00fd013a, 0x00fd013a,
+    0x00020128, 0xfe02013c, 0x0102013b, 0x0102013b, 0xff02013a, 0xff02013a, 0xff02013a, 0xff02013a,
+    0x00020139, 0x00020139, 0x00020139, 0x00020139, 0x00020139, 0x00020139, 0x00020139, 0x00020139,
+    0x00fe0127, 0x02fe013c, 0xfefe013b, 0xfefe013b, 0x01fe013a, 0x01fe013a, 0x01fe013a, 0x01fe013a,
+    0xfffe0139, 0xfffe0139, 0xfffe0139, 0xfffe0139, 0xfffe0139, 0xfffe0139, 0xfffe0139, 0xfffe0139,
+    0x00fe0138, 0x00fe0138, 0x00fe0138, 0x00fe0138, 0x00fe0138, 0x00fe0138, 0x00fe0138, 0x00fe0138,
+    0x00fe0138, 0x00fe0138, 0x00fe0138, 0x00fe0138, 0x00fe0138, 0x00fe0138, 0x00fe0138, 0x00fe0138,
+    0x00010126, 0xfd01013c, 0x0201013b, 0x0201013b, 0xfe01013a, 0xfe01013a, 0xfe01013a, 0xfe01013a,
+    0x01010139, 0x01010139, 0x01010139, 0x01010139, 0x01010139, 0x01010139, 0x01010139, 0x01010139,
+    0xff010138, 0xff010138, 0xff010138, 0xff010138, 0xff010138, 0xff010138, 0xff010138, 0xff010138,
+    0xff010138, 0xff010138, 0xff010138, 0xff010138, 0xff010138, 0xff010138, 0xff010138, 0xff010138,
+    0x00010137, 0x00010137, 0x00010137, 0x00010137, 0x00010137, 0x00010137, 0x00010137, 0x00010137,
+    0x00010137, 0x00010137, 0x00010137, 0x00010137, 0x00010137, 0x00010137, 0x00010137, 0x00010137,
+    0x00010137, 0x00010137, 0x00010137, 0x00010137, 0x00010137, 0x00010137, 0x00010137, 0x00010137,
+    0x00010137, 0x00010137, 0x00010137, 0x00010137, 0x00010137, 0x00010137, 0x00010137, 0x00010137,
+    0x00ff0125, 0x03ff013c, 0xfdff013b, 0xfdff013b, 0x02ff013a, 0x02ff013a, 0x02ff013a, 0x02ff013a,
+    0xfeff0139, 0xfeff0139, 0xfeff0139, 0xfeff0139, 0xfeff0139, 0xfeff0139, 0xfeff0139, 0xfeff0139,
+    0x01ff0138, 0x01ff0138, 0x01ff0138, 0x01ff0138, 0x01ff0138, 0x01ff0138, 0x01ff0138, 0x01ff0138,
+    0x01ff0138, 0x01ff0138, 0x01ff0138, 0x01ff0138, 0x01ff0138, 0x01ff0138, 0x01ff0138, 0x01ff0138,
+    0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137,
+    0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137,
+    0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137,
+    0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137,
+    0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136,
+    0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136,
+    0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136,
+    0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136,
+    0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136,
+    0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136,
+    0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136,
+    0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136,
+    0x00000124, 0xfc00013c, 0x0300013b, 0x0300013b, 0xfd00013a, 0xfd00013a, 0xfd00013a, 0xfd00013a,
+    0x02000139, 0x02000139, 0x02000139, 0x02000139, 0x02000139, 0x02000139, 0x02000139, 0x02000139,
+    0xfe000138, 0xfe000138, 0xfe000138, 0xfe000138, 0xfe000138, 0xfe000138, 0xfe000138, 0xfe000138,
+    0xfe000138, 0xfe000138, 0xfe000138, 0xfe000138, 0xfe000138, 0xfe000138, 0xfe000138, 0xfe000138,
+    0x01000137, 0x01000137, 0x01000137, 0x01000137, 0x01000137, 0x01000137, 0x01000137, 0x01000137,
+    0x01000137, 0x01000137, 0x01000137, 0x01000137, 0x01000137, 0x01000137, 0x01000137, 0x01000137,
+    0x01000137, 0x01000137, 0x01000137, 0x01000137, 0x01000137, 0x01000137, 0x01000137, 0x01000137,
+    0x01000137, 0x01000137, 0x01000137, 0x01000137, 0x01000137, 0x01000137, 0x01000137, 0x01000137,
+    0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136,
+    0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136,
+    0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136,
+    0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136,
+    0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136,
+    0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136,
+    0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136,
+    0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136,
+    0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135,
+    0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135,
+    0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135,
+    0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135,
+    0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135,
+    0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135,
+    0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135,
+    0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135,
+    0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135,
+    0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135,
+    0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135,
+    0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135,
+    0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135,
+    0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135,
+    0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135,
+    0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135,
+    0x0000ff12, 0x00fbff2c, 0x0004ff2b, 0x0004ff3c, 0x00fcff2a, 0xfffcff3c, 0x00fcff3b, 0x00fcff3b,
+    0x0003ff29, 0x0103ff3c, 0xff03ff3b, 0xff03ff3b, 0x0003ff3a, 0x0003ff3a, 0x0003ff3a, 0x0003ff3a,
+    0x00fdff28, 0xfefdff3c, 0x01fdff3b, 0x01fdff3b, 0xfffdff3a, 0xfffdff3a, 0xfffdff3a, 0xfffdff3a,
+    0x00fdff39, 0x00fdff39, 0x00fdff39, 0x00fdff39, 0x00fdff39, 0x00fdff39, 0x00fdff39, 0x00fdff39,
+    0x0002ff27, 0x0202ff3c, 0xfe02ff3b, 0xfe02ff3b, 0x0102ff3a, 0x0102ff3a, 0x0102ff3a, 0x0102ff3a,
+    0xff02ff39, 0xff02ff39, 0xff02ff39, 0xff02ff39, 0xff02ff39, 0xff02ff39, 0xff02ff39, 0xff02ff39,
+    0x0002ff38, 0x0002ff38, 0x0002ff38, 0x0002ff38, 0x0002ff38, 0x0002ff38, 0x0002ff38, 0x0002ff38,
+    0x0002ff38, 0x0002ff38, 0x0002ff38, 0x0002ff38, 0x0002ff38, 0x0002ff38, 0x0002ff38, 0x0002ff38,
+    0x00feff26, 0xfdfeff3c, 0x02feff3b, 0x02feff3b, 0xfefeff3a, 0xfefeff3a, 0xfefeff3a, 0xfefeff3a,
+    0x01feff39, 0x01feff39, 0x01feff39, 0x01feff39, 0x01feff39, 0x01feff39, 0x01feff39, 0x01feff39,
+    0xfffeff38, 0xfffeff38, 0xfffeff38, 0xfffeff38, 0xfffeff38, 0xfffeff38, 0xfffeff38, 0xfffeff38,
+    0xfffeff38, 0xfffeff38, 0xfffeff38, 0xfffeff38, 0xfffeff38, 0xfffeff38, 0xfffeff38, 0xfffeff38,
+    0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37,
+    0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37,
+    0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37,
+    0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37,
+    0x0001ff25, 0x0301ff3c, 0xfd01ff3b, 0xfd01ff3b, 0x0201ff3a, 0x0201ff3a, 0x0201ff3a, 0x0201ff3a,
+    0xfe01ff39, 0xfe01ff39, 0xfe01ff39, 0xfe01ff39, 0xfe01ff39, 0xfe01ff39, 0xfe01ff39, 0xfe01ff39,
+    0x0101ff38, 0x0101ff38, 0x0101ff38, 0x0101ff38, 0x0101ff38, 0x0101ff38, 0x0101ff38, 0x0101ff38,
+    0x0101ff38, 0x0101ff38, 0x0101ff38, 0x0101ff38, 0x0101ff38, 0x0101ff38, 0x0101ff38, 0x0101ff38,
+    0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37,
+    0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37,
+    0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37,
+    0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37,
+    0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36,
+    0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36,
+    0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36,
+    0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36,
+    0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36,
+    0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36,
+    0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36,
+    0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36,
+    0x00ffff24, 0xfcffff3c, 0x03ffff3b, 0x03ffff3b, 0xfdffff3a, 0xfdffff3a, 0xfdffff3a, 0xfdffff3a,
+    0x02ffff39, 0x02ffff39, 0x02ffff39, 0x02ffff39, 0x02ffff39, 0x02ffff39, 0x02ffff39, 0x02ffff39,
+    0xfeffff38, 0xfeffff38, 0xfeffff38, 0xfeffff38, 0xfeffff38, 0xfeffff38, 0xfeffff38, 0xfeffff38,
+    0xfeffff38, 0xfeffff38, 0xfeffff38, 0xfeffff38, 0xfeffff38, 0xfeffff38, 0xfeffff38, 0xfeffff38,
+    0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37,
+    0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37,
+    0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37,
+    0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37,
+    0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36,
+    0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36,
+    0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36,
+    0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36,
+    0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36,
+    0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36,
+    0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36,
+    0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36,
+    0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35,
+    0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35,
+    0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35,
+    0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35,
+    0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35,
+    0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35,
+    0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35,
+    0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35,
+    0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35,
+    0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35,
+    0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35,
+    0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35,
+    0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35,
+    0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35,
+    0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35,
+    0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35,
+    0x0000ff23, 0x0400ff3c, 0xfc00ff3b, 0xfc00ff3b, 0x0300ff3a, 0x0300ff3a, 0x0300ff3a, 0x0300ff3a,
+    0xfd00ff39, 0xfd00ff39, 0xfd00ff39, 0xfd00ff39, 0xfd00ff39, 0xfd00ff39, 0xfd00ff39, 0xfd00ff39,
+    0x0200ff38, 0x0200ff38, 0x0200ff38, 0x0200ff38, 0x0200ff38, 0x0200ff38, 0x0200ff38, 0x0200ff38,
+    0x0200ff38, 0x0200ff38, 0x0200ff38, 0x0200ff38, 0x0200ff38, 0x0200ff38, 0x0200ff38, 0x0200ff38,
+    0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37,
+    0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37,
+    0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37,
+    0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37,
+    0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36,
+    0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36,
+    0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36,
+    0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36,
+    0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36,
+    0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36,
+    0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36,
+    0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36,
+    0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35,
+    0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35,
+    0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35,
+    0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35,
+    0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35,
+    0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35,
+    0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35,
+    0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35,
+    0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35,
+    0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35,
+    0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35,
+    0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35,
+    0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35,
+    0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35,
+    0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35,
+    0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x00000011, 0x0005002c, 0x00fb002b, 0x00fb003c, 0x0004002a, 0xff04003c, 0x0004003b, 0x0004003b,
+    0x00fc0029, 0x01fc003c, 0xfffc003b, 0xfffc003b, 0x00fc003a, 0x00fc003a, 0x00fc003a, 0x00fc003a,
+    0x00030028, 0xfe03003c, 0x0103003b, 0x0103003b, 0xff03003a, 0xff03003a, 0xff03003a, 0xff03003a,
+    0x00030039, 0x00030039, 0x00030039, 0x00030039, 0x00030039, 0x00030039, 0x00030039, 0x00030039,
+    0x00fd0027, 0x02fd003c, 0xfefd003b, 0xfefd003b, 0x01fd003a, 0x01fd003a, 0x01fd003a, 0x01fd003a,
+    0xfffd0039, 0xfffd0039, 0xfffd0039, 0xfffd0039, 0xfffd0039, 0xfffd0039, 0xfffd0039, 0xfffd0039,
+    0x00fd0038, 0x00fd0038, 0x00fd0038, 0x00fd0038, 0x00fd0038, 0x00fd0038, 0x00fd0038, 0x00fd0038,
+    0x00fd0038, 0x00fd0038, 0x00fd0038, 0x00fd0038, 0x00fd0038, 0x00fd0038, 0x00fd0038, 0x00fd0038,
+    0x00020026, 0xfd02003c, 0x0202003b, 0x0202003b, 0xfe02003a, 0xfe02003a, 0xfe02003a, 0xfe02003a,
+    0x01020039, 0x01020039, 0x01020039, 0x01020039, 0x01020039, 0x01020039, 0x01020039, 0x01020039,
+    0xff020038, 0xff020038, 0xff020038, 0xff020038, 0xff020038, 0xff020038, 0xff020038, 0xff020038,
+    0xff020038, 0xff020038, 0xff020038, 0xff020038, 0xff020038, 0xff020038, 0xff020038, 0xff020038,
+    0x00020037, 0x00020037, 0x00020037, 0x00020037, 0x00020037, 0x00020037, 0x00020037, 0x00020037,
+    0x00020037, 0x00020037, 0x00020037, 0x00020037, 0x00020037, 0x00020037, 0x00020037, 0x00020037,
+    0x00020037, 0x00020037, 0x00020037, 0x00020037, 0x00020037, 0x00020037, 0x00020037, 0x00020037,
+    0x00020037, 0x00020037, 0x00020037, 0x00020037, 0x00020037, 0x00020037, 0x00020037, 0x00020037,
+    0x00fe0025, 0x03fe003c, 0xfdfe003b, 0xfdfe003b, 0x02fe003a, 0x02fe003a, 0x02fe003a, 0x02fe003a,
+    0xfefe0039, 0xfefe0039, 0xfefe0039, 0xfefe0039, 0xfefe0039, 0xfefe0039, 0xfefe0039, 0xfefe0039,
+    0x01fe0038, 0x01fe0038, 0x01fe0038, 0x01fe0038, 0x01fe0038, 0x01fe0038, 0x01fe0038, 0x01fe0038,
+    0x01fe0038, 0x01fe0038, 0x01fe0038, 0x01fe0038, 0x01fe0038, 0x01fe0038, 0x01fe0038, 0x01fe0038,
+    0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037,
+    0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037,
+    0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037,
+    0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037,
+    0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036,
+    0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036,
+    0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036,
+    0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036,
+    0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036,
+    0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036,
+    0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036,
+    0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036,
+    0x00010024, 0xfc01003c, 0x0301003b, 0x0301003b, 0xfd01003a, 0xfd01003a, 0xfd01003a, 0xfd01003a,
+    0x02010039, 0x02010039, 0x02010039, 0x02010039, 0x02010039, 0x02010039, 0x02010039, 0x02010039,
+    0xfe010038, 0xfe010038, 0xfe010038, 0xfe010038, 0xfe010038, 0xfe010038, 0xfe010038, 0xfe010038,
+    0xfe010038, 0xfe010038, 0xfe010038, 0xfe010038, 0xfe010038, 0xfe010038, 0xfe010038, 0xfe010038,
+    0x01010037, 0x01010037, 0x01010037, 0x01010037, 0x01010037, 0x01010037, 0x01010037, 0x01010037,
+    0x01010037, 0x01010037, 0x01010037, 0x01010037, 0x01010037, 0x01010037, 0x01010037, 0x01010037,
+    0x01010037, 0x01010037, 0x01010037, 0x01010037, 0x01010037, 0x01010037, 0x01010037, 0x01010037,
+    0x01010037, 0x01010037, 0x01010037, 0x01010037, 0x01010037, 0x01010037, 0x01010037, 0x01010037,
+    0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036,
+    0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036,
+    0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036,
+    0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036,
+    0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036,
+    0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036,
+    0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036,
+    0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036,
+    0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035,
+    0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035,
+    0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035,
+    0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035,
+    0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035,
+    0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035,
+    0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035,
+    0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035,
+    0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035,
+    0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035,
+    0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035,
+    0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035,
+    0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035,
+    0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035,
+    0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035,
+    0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035,
+    0x00ff0023, 0x04ff003c, 0xfcff003b, 0xfcff003b, 0x03ff003a, 0x03ff003a, 0x03ff003a, 0x03ff003a,
+    0xfdff0039, 0xfdff0039, 0xfdff0039, 0xfdff0039, 0xfdff0039, 0xfdff0039, 0xfdff0039, 0xfdff0039,
+    0x02ff0038, 0x02ff0038, 0x02ff0038, 0x02ff0038, 0x02ff0038, 0x02ff0038, 0x02ff0038, 0x02ff0038,
+    0x02ff0038, 0x02ff0038, 0x02ff0038, 0x02ff0038, 0x02ff0038, 0x02ff0038, 0x02ff0038, 0x02ff0038,
+    0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037,
+    0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037,
+    0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037,
+    0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037,
+    0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036,
+    0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036,
+    0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036,
+    0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036,
+    0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036,
+    0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036,
+    0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036,
+    0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036,
+    0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035,
+    0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035,
+    0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035,
+    0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035,
+    0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035,
+    0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035,
+    0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035,
+    0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035,
+    0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035,
+    0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035,
+    0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035,
+    0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035,
+    0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035,
+    0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035,
+    0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035,
+    0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00000022, 0xfb00003c, 0x0400003b, 0x0400003b, 0xfc00003a, 0xfc00003a, 0xfc00003a, 0xfc00003a,
+    0x03000039, 0x03000039, 0x03000039, 0x03000039, 0x03000039, 0x03000039, 0x03000039, 0x03000039,
+    0xfd000038, 0xfd000038, 0xfd000038, 0xfd000038, 0xfd000038, 0xfd000038, 0xfd000038, 0xfd000038,
+    0xfd000038, 0xfd000038, 0xfd000038, 0xfd000038, 0xfd000038, 0xfd000038, 0xfd000038, 0xfd000038,
+    0x02000037, 0x02000037, 0x02000037, 0x02000037, 0x02000037, 0x02000037, 0x02000037, 0x02000037,
+    0x02000037, 0x02000037, 0x02000037, 0x02000037, 0x02000037, 0x02000037, 0x02000037, 0x02000037,
+    0x02000037, 0x02000037, 0x02000037, 0x02000037, 0x02000037, 0x02000037, 0x02000037, 0x02000037,
+    0x02000037, 0x02000037, 0x02000037, 0x02000037, 0x02000037, 0x02000037, 0x02000037, 0x02000037,
+    0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036,
+    0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036,
+    0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036,
+    0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036,
+    0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036,
+    0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036,
+    0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036,
+    0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036,
+    0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035,
+    0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035,
+    0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035,
+    0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035,
+    0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035,
+    0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035,
+    0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035,
+    0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035,
+    0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035,
+    0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035,
+    0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035,
+    0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035,
+    0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035,
+    0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035,
+    0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035,
+    0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+  },
+  {
+    0x00000000, 0x00000000, 0x00000a1c, 0x0000f51c, 0x0000091b, 0x0000091b, 0x0000f61b, 0x0000f61b,
+    0x0000081a, 0x0000081a, 0x0000082c, 0x00ff082c, 0x0000f71a, 0x0000f71a, 0x0000f72c, 0x00fff72c,
+    0x00000719, 0x00000719, 0x0001072c, 0x00fe072c, 0x0000072b, 0x0000072b, 0x00ff072b, 0x00ff072b,
+    0x0000f819, 0x0000f819, 0x0001f82c, 0x00fef82c, 0x0000f82b, 0x0000f82b, 0x00fff82b, 0x00fff82b,
+    0x00000618, 0x00000618, 0x0002062c, 0x00fd062c, 0x0001062b, 0x0001062b, 0x00fe062b, 0x00fe062b,
+    0x0000062a, 0x0000062a, 0x0000063c, 0xff00063c, 0x00ff062a, 0x00ff062a, 0x00ff063c, 0xffff063c,
+    0x0000f918, 0x0000f918, 0x0002f92c, 0x00fdf92c, 0x0001f92b, 0x0001f92b, 0x00fef92b, 0x00fef92b,
+    0x0000f92a, 0x0000f92a, 0x0000f93c, 0xff00f93c, 0x00fff92a, 0x00fff92a, 0x00fff93c, 0xfffff93c,
+    0x00000517, 0x00000517, 0x0003052c, 0x00fc052c, 0x0002052b, 0x0002052b, 0x00fd052b, 0x00fd052b,
+    0x0001052a, 0x0001052a, 0x0001053c, 0xff01053c, 0x00fe052a, 0x00fe052a, 0x00fe053c, 0xfffe053c,
+    0x00000529, 0x00000529, 0x0100053c, 0xfe00053c, 0x0000053b, 0x0000053b, 0xff00053b, 0xff00053b,
+    0x00ff0529, 0x00ff0529, 0x01ff053c, 0xfeff053c, 0x00ff053b, 0x00ff053b, 0xffff053b, 0xffff053b,
+    0x0000fa17, 0x0000fa17, 0x0003fa2c, 0x00fcfa2c, 0x0002fa2b, 0x0002fa2b, 0x00fdfa2b, 0x00fdfa2b,
+    0x0001fa2a, 0x0001fa2a, 0x0001fa3c, 0xff01fa3c, 0x00fefa2a, 0x00fefa2a, 0x00fefa3c, 0xfffefa3c,
+    0x0000fa29, 0x0000fa29, 0x0100fa3c, 0xfe00fa3c, 0x0000fa3b, 0x0000fa3b, 0xff00fa3b, 0xff00fa3b,
+    0x00fffa29, 0x00fffa29, 0x01fffa3c, 0xfefffa3c, 0x00fffa3b, 0x00fffa3b, 0xfffffa3b, 0xfffffa3b,
+    0x00000416, 0x00000416, 0x0004042c, 0x00fb042c, 0x0003042b, 0x0003042b, 0x00fc042b, 0x00fc042b,
+    0x0002042a, 0x0002042a, 0x0002043c, 0xff02043c, 0x00fd042a, 0x00fd042a, 0x00fd043c, 0xfffd043c,
+    0x00010429, 0x00010429, 0x0101043c, 0xfe01043c, 0x0001043b, 0x0001043b, 0xff01043b, 0xff01043b,
+    0x00fe0429, 0x00fe0429, 0x01fe043c, 0xfefe043c, 0x00fe043b, 0x00fe043b, 0xfffe043b, 0xfffe043b,
+    0x00000428, 0x00000428, 0x0200043c, 0xfd00043c, 0x0100043b, 0x0100043b, 0xfe00043b, 0xfe00043b,
+    0x0000043a, 0x0000043a, 0x0000043a, 0x0000043a, 0xff00043a, 0xff00043a, 0xff00043a, 0xff00043a,
+    0x00ff0428, 0x00ff0428, 0x02ff043c, 0xfdff043c, 0x01ff043b, 0x01ff043b, 0xfeff043b, 0xfeff043b,
+    0x00ff043a, 0x00ff043a, 0x00ff043a, 0x00ff043a, 0xffff043a, 0xffff043a, 0xffff043a, 0xffff043a,
+    0x0000fb16, 0x0000fb16, 0x0004fb2c, 0x00fbfb2c, 0x0003fb2b, 0x0003fb2b, 0x00fcfb2b, 0x00fcfb2b,
+    0x0002fb2a, 0x0002fb2a, 0x0002fb3c, 0xff02fb3c, 0x00fdfb2a, 0x00fdfb2a, 0x00fdfb3c, 0xfffdfb3c,
+    0x0001fb29, 0x0001fb29, 0x0101fb3c, 0xfe01fb3c, 0x0001fb3b, 0x0001fb3b, 0xff01fb3b, 0xff01fb3b,
+    0x00fefb29, 0x00fefb29, 0x01fefb3c, 0xfefefb3c, 0x00fefb3b, 0x00fefb3b, 0xfffefb3b, 0xfffefb3b,
+    0x0000fb28, 0x0000fb28, 0x0200fb3c, 0xfd00fb3c, 0x0100fb3b, 0x0100fb3b, 0xfe00fb3b, 0xfe00fb3b,
+    0x0000fb3a, 0x0000fb3a, 0x0000fb3a, 0x0000fb3a, 0xff00fb3a, 0xff00fb3a, 0xff00fb3a, 0xff00fb3a,
+    0x00fffb28, 0x00fffb28, 0x02fffb3c, 0xfdfffb3c, 0x01fffb3b, 0x01fffb3b, 0xfefffb3b, 0xfefffb3b,
+    0x00fffb3a, 0x00fffb3a, 0x00fffb3a, 0x00fffb3a, 0xfffffb3a, 0xfffffb3a, 0xfffffb3a, 0xfffffb3a,
+    0x00000315, 0x00000315, 0x0005032c, 0x00fa032c, 0x0004032b, 0x0004032b, 0x00fb032b, 0x00fb032b,
+    0x0003032a, 0x0003032a, 0x0003033c, 0xff03033c, 0x00fc032a, 0x00fc032a, 0x00fc033c, 0xfffc033c,
+    0x00020329, 0x00020329, 0x0102033c, 0xfe02033c, 0x0002033b, 0x0002033b, 0xff02033b, 0xff02033b,
+    0x00fd0329, 0x00fd0329, 0x01fd033c, 0xfefd033c, 0x00fd033b, 0x00fd033b, 0xfffd033b, 0xfffd033b,
+    0x00010328, 0x00010328, 0x0201033c, 0xfd01033c, 0x0101033b, 0x0101033b, 0xfe01033b, 0xfe01033b,
+    0x0001033a, 0x0001033a, 0x0001033a, 0x0001033a, 0xff01033a, 0xff01033a, 0xff01033a, 0xff01033a,
+    0x00fe0328, 0x00fe0328, 0x02fe033c, 0xfdfe033c, 0x01fe033b, 0x01fe033b, 0xfefe033b, 0xfefe033b,
+    0x00fe033a, 0x00fe033a, 0x00fe033a, 0x00fe033a, 0xfffe033a, 0xfffe033a, 0xfffe033a, 0xfffe033a,
+    0x00000327, 0x00000327, 0x0300033c, 0xfc00033c, 0x0200033b, 0x0200033b, 0xfd00033b, 0xfd00033b,
+    0x0100033a, 0x0100033a, 0x0100033a, 0x0100033a, 0xfe00033a, 0xfe00033a, 0xfe00033a, 0xfe00033a,
+    0x00000339, 0x00000339, 0x00000339, 0x00000339, 0x00000339, 0x00000339, 0x00000339, 0x00000339,
+    0xff000339, 0xff000339, 0xff000339, 0xff000339, 0xff000339, 0xff000339, 0xff000339, 0xff000339,
+    0x00ff0327, 0x00ff0327, 0x03ff033c, 0xfcff033c, 0x02ff033b, 0x02ff033b, 0xfdff033b, 0xfdff033b,
+    0x01ff033a, 0x01ff033a, 0x01ff033a, 0x01ff033a, 0xfeff033a, 0xfeff033a, 0xfeff033a, 0xfeff033a,
+    0x00ff0339, 0x00ff0339, 0x00ff0339, 0x00ff0339, 0x00ff0339, 0x00ff0339, 0x00ff0339, 0x00ff0339,
+    0xffff0339, 0xffff0339, 0xffff0339, 0xffff0339, 0xffff0339, 0xffff0339, 0xffff0339, 0xffff0339,
+    0x0000fc15, 0x0000fc15, 0x0005fc2c, 0x00fafc2c, 0x0004fc2b, 0x0004fc2b, 0x00fbfc2b, 0x00fbfc2b,
+    0x0003fc2a, 0x0003fc2a, 0x0003fc3c, 0xff03fc3c, 0x00fcfc2a, 0x00fcfc2a, 0x00fcfc3c, 0xfffcfc3c,
+    0x0002fc29, 0x0002fc29, 0x0102fc3c, 0xfe02fc3c, 0x0002fc3b, 0x0002fc3b, 0xff02fc3b, 0xff02fc3b,
+    0x00fdfc29, 0x00fdfc29, 0x01fdfc3c, 0xfefdfc3c, 0x00fdfc3b, 0x00fdfc3b, 0xfffdfc3b, 0xfffdfc3b,
+    0x0001fc28, 0x0001fc28, 0x0201fc3c, 0xfd01fc3c, 0x0101fc3b, 0x0101fc3b, 0xfe01fc3b, 0xfe01fc3b,
+    0x0001fc3a, 0x0001fc3a, 0x0001fc3a, 0x0001fc3a, 0xff01fc3a, 0xff01fc3a, 0xff01fc3a, 0xff01fc3a,
+    0x00fefc28, 0x00fefc28, 0x02fefc3c, 0xfdfefc3c, 0x01fefc3b, 0x01fefc3b, 0xfefefc3b, 0xfefefc3b,
+    0x00fefc3a, 0x00fefc3a, 0x00fefc3a, 0x00fefc3a, 0xfffefc3a, 0xfffefc3a, 0xfffefc3a, 0xfffefc3a,
+    0x0000fc27, 0x0000fc27, 0x0300fc3c, 0xfc00fc3c, 0x0200fc3b, 0x0200fc3b, 0xfd00fc3b, 0xfd00fc3b,
+    0x0100fc3a, 0x0100fc3a, 0x0100fc3a, 0x0100fc3a, 0xfe00fc3a, 0xfe00fc3a, 0xfe00fc3a, 0xfe00fc3a,
+    0x0000fc39, 0x0000fc39, 0x0000fc39, 0x0000fc39, 0x0000fc39, 0x0000fc39, 0x0000fc39, 0x0000fc39,
+    0xff00fc39, 0xff00fc39, 0xff00fc39, 0xff00fc39, 0xff00fc39, 0xff00fc39, 0xff00fc39, 0xff00fc39,
+    0x00fffc27, 0x00fffc27, 0x03fffc3c, 0xfcfffc3c, 0x02fffc3b, 0x02fffc3b, 0xfdfffc3b, 0xfdfffc3b,
+    0x01fffc3a, 0x01fffc3a, 0x01fffc3a, 0x01fffc3a, 0xfefffc3a, 0xfefffc3a, 0xfefffc3a, 0xfefffc3a,
+    0x00fffc39, 0x00fffc39, 0x00fffc39, 0x00fffc39, 0x00fffc39, 0x00fffc39, 0x00fffc39, 0x00fffc39,
+    0xfffffc39, 0xfffffc39, 0xfffffc39, 0xfffffc39, 0xfffffc39, 0xfffffc39, 0xfffffc39, 0xfffffc39,
+    0x00000214, 0x00000214, 0x0006022c, 0x00f9022c, 0x0005022b, 0x0005022b, 0x00fa022b, 0x00fa022b,
+    0x0004022a, 0x0004022a, 0x0004023c, 0xff04023c, 0x00fb022a, 0x00fb022a, 0x00fb023c, 0xfffb023c,
+    0x00030229, 0x00030229, 0x0103023c, 0xfe03023c, 0x0003023b, 0x0003023b, 0xff03023b, 0xff03023b,
+    0x00fc0229, 0x00fc0229, 0x01fc023c, 0xfefc023c, 0x00fc023b, 0x00fc023b, 0xfffc023b, 0xfffc023b,
+    0x00020228, 0x00020228, 0x0202023c, 0xfd02023c, 0x0102023b, 0x0102023b, 0xfe02023b, 0xfe02023b,
+    0x0002023a, 0x0002023a, 0x0002023a, 0x0002023a, 0xff02023a, 0xff02023a, 0xff02023a, 0xff02023a,
+    0x00fd0228, 0x00fd0228, 0x02fd023c, 0xfdfd023c, 0x01fd023b, 0x01fd023b, 0xfefd023b, 0xfefd023b,
+    0x00fd023a, 0x00fd023a, 0x00fd023a, 0x00fd023a, 0xfffd023a, 0xfffd023a, 0xfffd023a, 0xfffd023a,
+    0x00010227, 0x00010227, 0x0301023c, 0xfc01023c, 0x0201023b, 0x0201023b, 0xfd01023b, 0xfd01023b,
+    0x0101023a, 0x0101023a, 0x0101023a, 0x0101023a, 0xfe01023a, 0xfe01023a, 0xfe01023a, 0xfe01023a,
+    0x00010239, 0x00010239, 0x00010239, 0x00010239, 0x00010239, 0x00010239, 0x00010239, 0x00010239,
+    0xff010239, 0xff010239, 0xff010239, 0xff010239, 0xff010239, 0xff010239, 0xff010239, 0xff010239,
+    0x00fe0227, 0x00fe0227, 0x03fe023c, 0xfcfe023c, 0x02fe023b, 0x02fe023b, 0xfdfe023b, 0xfdfe023b,
+    0x01fe023a, 0x01fe023a, 0x01fe023a, 0x01fe023a, 0xfefe023a, 0xfefe023a, 0xfefe023a, 0xfefe023a,
+    0x00fe0239, 0x00fe0239, 0x00fe0239, 0x00fe0239, 0x00fe0239, 0x00fe0239, 0x00fe0239, 0x00fe0239,
+    0xfffe0239, 0xfffe0239, 0xfffe0239, 0xfffe0239, 0xfffe0239, 0xfffe0239, 0xfffe0239, 0xfffe0239,
+    0x00000226, 0x00000226, 0x0400023c, 0xfb00023c, 0x0300023b, 0x0300023b, 0xfc00023b, 0xfc00023b,
+    0x0200023a, 0x0200023a, 0x0200023a, 0x0200023a, 0xfd00023a, 0xfd00023a, 0xfd00023a, 0xfd00023a,
+    0x01000239, 0x01000239, 0x01000239, 0x01000239, 0x01000239, 0x01000239, 0x01000239, 0x01000239,
+    0xfe000239, 0xfe000239, 0xfe000239, 0xfe000239, 0xfe000239, 0xfe000239, 0xfe000239, 0xfe000239,
+    0x00000238, 0x00000238, 0x00000238, 0x00000238, 0x00000238, 0x00000238, 0x00000238, 0x00000238,
+    0x00000238, 0x00000238, 0x00000238, 0x00000238, 0x00000238, 0x00000238, 0x00000238, 0x00000238,
+    0xff000238, 0xff000238, 0xff000238, 0xff000238, 0xff000238, 0xff000238, 0xff000238, 0xff000238,
+    0xff000238, 0xff000238, 0xff000238, 0xff000238, 0xff000238, 0xff000238, 0xff000238, 0xff000238,
+    0x00ff0226, 0x00ff0226, 0x04ff023c, 0xfbff023c, 0x03ff023b, 0x03ff023b, 0xfcff023b, 0xfcff023b,
+    0x02ff023a, 0x02ff023a, 0x02ff023a, 0x02ff023a, 0xfdff023a, 0xfdff023a, 0xfdff023a, 0xfdff023a,
+    0x01ff0239, 0x01ff0239, 0x01ff0239, 0x01ff0239, 0x01ff0239, 0x01ff0239, 0x01ff0239, 0x01ff0239,
+    0xfeff0239, 0xfeff0239, 0xfeff0239, 0xfeff0239, 0xfeff0239, 0xfeff0239, 0xfeff0239, 0xfeff0239,
+    0x00ff0238, 0x00ff0238, 0x00ff0238, 0x00ff0238, 0x00ff0238, 0x00ff0238, 0x00ff0238, 0x00ff0238,
+    0x00ff0238, 0x00ff0238, 0x00ff0238, 0x00ff0238, 0x00ff0238, 0x00ff0238, 0x00ff0238, 0x00ff0238,
+    0xffff0238, 0xffff0238, 0xffff0238, 0xffff0238, 0xffff0238, 0xffff0238, 0xffff0238, 0xffff0238,
+    0xffff0238, 0xffff0238, 0xffff0238, 0xffff0238, 0xffff0238, 0xffff0238, 0xffff0238, 0xffff0238,
+    0x0000fd14, 0x0000fd14, 0x0006fd2c, 0x00f9fd2c, 0x0005fd2b, 0x0005fd2b, 0x00fafd2b, 0x00fafd2b,
+    0x0004fd2a, 0x0004fd2a, 0x0004fd3c, 0xff04fd3c, 0x00fbfd2a, 0x00fbfd2a, 0x00fbfd3c, 0xfffbfd3c,
+    0x0003fd29, 0x0003fd29, 0x0103fd3c, 0xfe03fd3c, 0x0003fd3b, 0x0003fd3b, 0xff03fd3b, 0xff03fd3b,
+    0x00fcfd29, 0x00fcfd29, 0x01fcfd3c, 0xfefcfd3c, 0x00fcfd3b, 0x00fcfd3b, 0xfffcfd3b, 0xfffcfd3b,
+    0x0002fd28, 0x0002fd28, 0x0202fd3c, 0xfd02fd3c, 0x0102fd3b, 0x0102fd3b, 0xfe02fd3b, 0xfe02fd3b,
+    0x0002fd3a, 0x0002fd3a, 0x0002fd3a, 0x0002fd3a, 0xff02fd3a, 0xff02fd3a, 0xff02fd3a, 0xff02fd3a,
+    0x00fdfd28, 0x00fdfd28, 0x02fdfd3c, 0xfdfdfd3c, 0x01fdfd3b, 0x01fdfd3b, 0xfefdfd3b, 0xfefdfd3b,
+    0x00fdfd3a, 0x00fdfd3a, 0x00fdfd3a, 0x00fdfd3a, 0xfffdfd3a, 0xfffdfd3a, 0xfffdfd3a, 0xfffdfd3a,
+    0x0001fd27, 0x0001fd27, 0x0301fd3c, 0xfc01fd3c, 0x0201fd3b, 0x0201fd3b, 0xfd01fd3b, 0xfd01fd3b,
+    0x0101fd3a, 0x0101fd3a, 0x0101fd3a, 0x0101fd3a, 0xfe01fd3a, 0xfe01fd3a, 0xfe01fd3a, 0xfe01fd3a,
+    0x0001fd39, 0x0001fd39, 0x0001fd39, 0x0001fd39, 0x0001fd39, 0x0001fd39, 0x0001fd39, 0x0001fd39,
+    0xff01fd39, 0xff01fd39, 0xff01fd39, 0xff01fd39, 0xff01fd39, 0xff01fd39, 0xff01fd39, 0xff01fd39,
+    0x00fefd27, 0x00fefd27, 0x03fefd3c, 0xfcfefd3c, 0x02fefd3b, 0x02fefd3b, 0xfdfefd3b, 0xfdfefd3b,
+    0x01fefd3a, 0x01fefd3a, 0x01fefd3a, 0x01fefd3a, 0xfefefd3a, 0xfefefd3a, 0xfefefd3a, 0xfefefd3a,
+    0x00fefd39, 0x00fefd39, 0x00fefd39, 0x00fefd39, 0x00fefd39, 0x00fefd39, 0x00fefd39, 0x00fefd39,
+    0xfffefd39, 0xfffefd39, 0xfffefd39, 0xfffefd39, 0xfffefd39, 0xfffefd39, 0xfffefd39, 0xfffefd39,
+    0x0000fd26, 0x0000fd26, 0x0400fd3c, 0xfb00fd3c, 0x0300fd3b, 0x0300fd3b, 0xfc00fd3b, 0xfc00fd3b,
+    0x0200fd3a, 0x0200fd3a, 0x0200fd3a, 0x0200fd3a, 0xfd00fd3a, 0xfd00fd3a, 0xfd00fd3a, 0xfd00fd3a,
+    0x0100fd39, 0x0100fd39, 0x0100fd39, 0x0100fd39, 0x0100fd39, 0x0100fd39, 0x0100fd39, 0x0100fd39,
+    0xfe00fd39, 0xfe00fd39, 0xfe00fd39, 0xfe00fd39, 0xfe00fd39, 0xfe00fd39, 0xfe00fd39, 0xfe00fd39,
+    0x0000fd38, 0x0000fd38, 0x0000fd38, 0x0000fd38, 0x0000fd38, 0x0000fd38, 0x0000fd38, 0x0000fd38,
+    0x0000fd38, 0x0000fd38, 0x0000fd38, 0x0000fd38, 0x0000fd38, 0x0000fd38, 0x0000fd38, 0x0000fd38,
+    0xff00fd38, 0xff00fd38, 0xff00fd38, 0xff00fd38, 0xff00fd38, 0xff00fd38, 0xff00fd38, 0xff00fd38,
+    0xff00fd38, 0xff00fd38, 0xff00fd38, 0xff00fd38, 0xff00fd38, 0xff00fd38, 0xff00fd38, 0xff00fd38,
+    0x00fffd26, 0x00fffd26, 0x04fffd3c, 0xfbfffd3c, 0x03fffd3b, 0x03fffd3b, 0xfcfffd3b, 0xfcfffd3b,
+    0x02fffd3a, 0x02fffd3a, 0x02fffd3a, 0x02fffd3a, 0xfdfffd3a, 0xfdfffd3a, 0xfdfffd3a, 0xfdfffd3a,
+    0x01fffd39, 0x01fffd39, 0x01fffd39, 0x01fffd39, 0x01fffd39, 0x01fffd39, 0x01fffd39, 0x01fffd39,
+    0xfefffd39, 0xfefffd39, 0xfefffd39, 0xfefffd39, 0xfefffd39, 0xfefffd39, 0xfefffd39, 0xfefffd39,
+    0x00fffd38, 0x00fffd38, 0x00fffd38, 0x00fffd38, 0x00fffd38, 0x00fffd38, 0x00fffd38, 0x00fffd38,
+    0x00fffd38, 0x00fffd38, 0x00fffd38, 0x00fffd38, 0x00fffd38, 0x00fffd38, 0x00fffd38, 0x00fffd38,
+    0xfffffd38, 0xfffffd38, 0xfffffd38, 0xfffffd38, 0xfffffd38, 0xfffffd38, 0xfffffd38, 0xfffffd38,
+    0xfffffd38, 0xfffffd38, 0xfffffd38, 0xfffffd38, 0xfffffd38, 0xfffffd38, 0xfffffd38, 0xfffffd38,
+    0x00000113, 0x00000113, 0x0007012c, 0x00f8012c, 0x0006012b, 0x0006012b, 0x00f9012b, 0x00f9012b,
+    0x0005012a, 0x0005012a, 0x0005013c, 0xff05013c, 0x00fa012a, 0x00fa012a, 0x00fa013c, 0xfffa013c,
+    0x00040129, 0x00040129, 0x0104013c, 0xfe04013c, 0x0004013b, 0x0004013b, 0xff04013b, 0xff04013b,
+    0x00fb0129, 0x00fb0129, 0x01fb013c, 0xfefb013c, 0x00fb013b, 0x00fb013b, 0xfffb013b, 0xfffb013b,
+    0x00030128, 0x00030128, 0x0203013c, 0xfd03013c, 0x0103013b, 0x0103013b, 0xfe03013b, 0xfe03013b,
+    0x0003013a, 0x0003013a, 0x0003013a, 0x0003013a, 0xff03013a, 0xff03013a, 0xff03013a, 0xff03013a,
+    0x00fc0128, 0x00fc0128, 0x02fc013c, 0xfdfc013c, 0x01fc013b, 0x01fc013b, 0xfefc013b, 0xfefc013b,
+    0x00fc013a, 0x00fc013a, 0x00fc013a, 0x00fc013a, 0xfffc013a, 0xfffc013a, 0xfffc013a, 0xfffc013a,
+    0x00020127, 0x00020127, 0x0302013c, 0xfc02013c, 0x0202013b, 0x0202013b, 0xfd02013b, 0xfd02013b,
+    0x0102013a, 0x0102013a, 0x0102013a, 0x0102013a, 0xfe02013a, 0xfe02013a, 0xfe02013a, 0xfe02013a,
+    0x00020139, 0x00020139, 0x00020139, 0x00020139, 0x00020139, 0x00020139, 0x00020139, 0x00020139,
+    0xff020139, 0xff020139, 0xff020139, 0xff020139, 0xff020139, 0xff020139, 0xff020139, 0xff020139,
+    0x00fd0127, 0x00fd0127, 0x03fd013c, 0xfcfd013c, 0x02fd013b, 0x02fd013b, 0xfdfd013b, 0xfdfd013b,
+    0x01fd013a, 0x01fd013a, 0x01fd013a, 0x01fd013a, 0xfefd013a, 0xfefd013a, 0xfefd013a, 0xfefd013a,
+    0x00fd0139, 0x00fd0139, 0x00fd0139, 0x00fd0139, 0x00fd0139, 0x00fd0139, 0x00fd0139, 0x00fd0139,
+    0xfffd0139, 0xfffd0139, 0xfffd0139, 0xfffd0139, 0xfffd0139, 0xfffd0139, 0xfffd0139, 0xfffd0139,
+    0x00010126, 0x00010126, 0x0401013c, 0xfb01013c, 0x0301013b, 0x0301013b, 0xfc01013b, 0xfc01013b,
+    0x0201013a, 0x0201013a, 0x0201013a, 0x0201013a, 0xfd01013a, 0xfd01013a, 0xfd01013a, 0xfd01013a,
+    0x01010139, 0x01010139, 0x01010139, 0x01010139, 0x01010139, 0x01010139, 0x01010139, 0x01010139,
+    0xfe010139, 0xfe010139, 0xfe010139, 0xfe010139, 0xfe010139, 0xfe010139, 0xfe010139, 0xfe010139,
+    0x00010138, 0x00010138, 0x00010138, 0x00010138, 0x00010138, 0x00010138, 0x00010138, 0x00010138,
+    0x00010138, 0x00010138, 0x00010138, 0x00010138, 0x00010138, 0x00010138, 0x00010138, 0x00010138,
+    0xff010138, 0xff010138, 0xff010138, 0xff010138, 0xff010138, 0xff010138, 0xff010138, 0xff010138,
+    0xff010138, 0xff010138, 0xff010138, 0xff010138, 0xff010138, 0xff010138, 0xff010138, 0xff010138,
+    0x00fe0126, 0x00fe0126, 0x04fe013c, 0xfbfe013c, 0x03fe013b, 0x03fe013b, 0xfcfe013b, 0xfcfe013b,
+    0x02fe013a, 0x02fe013a, 0x02fe013a, 0x02fe013a, 0xfdfe013a, 0xfdfe013a, 0xfdfe013a, 0xfdfe013a,
+    0x01fe0139, 0x01fe0139, 0x01fe0139, 0x01fe0139, 0x01fe0139, 0x01fe0139, 0x01fe0139, 0x01fe0139,
+    0xfefe0139, 0xfefe0139, 0xfefe0139, 0xfefe0139, 0xfefe0139, 0xfefe0139, 0xfefe0139, 0xfefe0139,
+    0x00fe0138, 0x00fe0138, 0x00fe0138, 0x00fe0138, 0x00fe0138, 0x00fe0138, 0x00fe0138, 0x00fe0138,
+    0x00fe0138, 0x00fe0138, 0x00fe0138, 0x00fe0138, 0x00fe0138, 0x00fe0138, 0x00fe0138, 0x00fe0138,
+    0xfffe0138, 0xfffe0138, 0xfffe0138, 0xfffe0138, 0xfffe0138, 0xfffe0138, 0xfffe0138, 0xfffe0138,
+    0xfffe0138, 0xfffe0138, 0xfffe0138, 0xfffe0138, 0xfffe0138, 0xfffe0138, 0xfffe0138, 0xfffe0138,
+    0x00000125, 0x00000125, 0x0500013c, 0xfa00013c, 0x0400013b, 0x0400013b, 0xfb00013b, 0xfb00013b,
+    0x0300013a, 0x0300013a, 0x0300013a, 0x0300013a, 0xfc00013a, 0xfc00013a, 0xfc00013a, 0xfc00013a,
+    0x02000139, 0x02000139, 0x02000139, 0x02000139, 0x02000139, 0x02000139, 0x02000139, 0x02000139,
+    0xfd000139, 0xfd000139, 0xfd000139, 0xfd000139, 0xfd000139, 0xfd000139, 0xfd000139, 0xfd000139,
+    0x01000138, 0x01000138, 0x01000138, 0x01000138, 0x01000138, 0x01000138, 0x01000138, 0x01000138,
+    0x01000138, 0x01000138, 0x01000138, 0x01000138, 0x01000138, 0x01000138, 0x01000138, 0x01000138,
+    0xfe000138, 0xfe000138, 0xfe000138, 0xfe000138, 0xfe000138, 0xfe000138, 0xfe000138, 0xfe000138,
+    0xfe000138, 0xfe000138, 0xfe000138, 0xfe000138, 0xfe000138, 0xfe000138, 0xfe000138, 0xfe000138,
+    0x00000137, 0x00000137, 0x00000137, 0x00000137, 0x00000137, 0x00000137, 0x00000137, 0x00000137,
+    0x00000137, 0x00000137, 0x00000137, 0x00000137, 0x00000137, 0x00000137, 0x00000137, 0x00000137,
+    0x00000137, 0x00000137, 0x00000137, 0x00000137, 0x00000137, 0x00000137, 0x00000137, 0x00000137,
+    0x00000137, 0x00000137, 0x00000137, 0x00000137, 0x00000137, 0x00000137, 0x00000137, 0x00000137,
+    0xff000137, 0xff000137, 0xff000137, 0xff000137, 0xff000137, 0xff000137, 0xff000137, 0xff000137,
+    0xff000137, 0xff000137, 0xff000137, 0xff000137, 0xff000137, 0xff000137, 0xff000137, 0xff000137,
+    0xff000137, 0xff000137, 0xff000137, 0xff000137, 0xff000137, 0xff000137, 0xff000137, 0xff000137,
+    0xff000137, 0xff000137, 0xff000137, 0xff000137, 0xff000137, 0xff000137, 0xff000137, 0xff000137,
+    0x00ff0125, 0x00ff0125, 0x05ff013c, 0xfaff013c, 0x04ff013b, 0x04ff013b, 0xfbff013b, 0xfbff013b,
+    0x03ff013a, 0x03ff013a, 0x03ff013a, 0x03ff013a, 0xfcff013a, 0xfcff013a, 0xfcff013a, 0xfcff013a,
+    0x02ff0139, 0x02ff0139, 0x02ff0139, 0x02ff0139, 0x02ff0139, 0x02ff0139, 0x02ff0139, 0x02ff0139,
+    0xfdff0139, 0xfdff0139, 0xfdff0139, 0xfdff0139, 0xfdff0139, 0xfdff0139, 0xfdff0139, 0xfdff0139,
+    0x01ff0138, 0x01ff0138, 0x01ff0138, 0x01ff0138, 0x01ff0138, 0x01ff0138, 0x01ff0138, 0x01ff0138,
+    0x01ff0138, 0x01ff0138, 0x01ff0138, 0x01ff0138, 0x01ff0138, 0x01ff0138, 0x01ff0138, 0x01ff0138,
+    0xfeff0138, 0xfeff0138, 0xfeff0138, 0xfeff0138, 0xfeff0138, 0xfeff0138, 0xfeff0138, 0xfeff0138,
+    0xfeff0138, 0xfeff0138, 0xfeff0138, 0xfeff0138, 0xfeff0138, 0xfeff0138, 0xfeff0138, 0xfeff0138,
+    0x00ff0137, 0x00ff0137, 0x00ff0137, 0x00ff0137, 0x00ff0137, 0x00ff0137, 0x00ff0137, 0x00ff0137,
+    0x00ff0137, 0x00ff0137, 0x00ff0137, 0x00ff0137, 0x00ff0137, 0x00ff0137, 0x00ff0137, 0x00ff0137,
+    0x00ff0137, 0x00ff0137, 0x00ff0137, 0x00ff0137, 0x00ff0137, 0x00ff0137, 0x00ff0137, 0x00ff0137,
+    0x00ff0137, 0x00ff0137, 0x00ff0137, 0x00ff0137, 0x00ff0137, 0x00ff0137, 0x00ff0137, 0x00ff0137,
+    0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137,
+    0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137,
+    0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137,
+    0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137,
+    0x0000fe13, 0x0000fe13, 0x0007fe2c, 0x00f8fe2c, 0x0006fe2b, 0x0006fe2b, 0x00f9fe2b, 0x00f9fe2b,
+    0x0005fe2a, 0x0005fe2a, 0x0005fe3c, 0xff05fe3c, 0x00fafe2a, 0x00fafe2a, 0x00fafe3c, 0xfffafe3c,
+    0x0004fe29, 0x0004fe29, 0x0104fe3c, 0xfe04fe3c, 0x0004fe3b, 0x0004fe3b, 0xff04fe3b, 0xff04fe3b,
+    0x00fbfe29, 0x00fbfe29, 0x01fbfe3c, 0xfefbfe3c, 0x00fbfe3b, 0x00fbfe3b, 0xfffbfe3b, 0xfffbfe3b,
+    0x0003fe28, 0x0003fe28, 0x0203fe3c, 0xfd03fe3c, 0x0103fe3b, 0x0103fe3b, 0xfe03fe3b, 0xfe03fe3b,
+    0x0003fe3a, 0x0003fe3a, 0x0003fe3a, 0x0003fe3a, 0xff03fe3a, 0xff03fe3a, 0xff03fe3a, 0xff03fe3a,
+    0x00fcfe28, 0x00fcfe28, 0x02fcfe3c, 0xfdfcfe3c, 0x01fcfe3b, 0x01fcfe3b, 0xfefcfe3b, 0xfefcfe3b,
+    0x00fcfe3a, 0x00fcfe3a, 0x00fcfe3a, 0x00fcfe3a, 0xfffcfe3a, 0xfffcfe3a, 0xfffcfe3a, 0xfffcfe3a,
+    0x0002fe27, 0x0002fe27, 0x0302fe3c, 0xfc02fe3c, 0x0202fe3b, 0x0202fe3b, 0xfd02fe3b, 0xfd02fe3b,
+    0x0102fe3a, 0x0102fe3a, 0x0102fe3a, 0x0102fe3a, 0xfe02fe3a, 0xfe02fe3a, 0xfe02fe3a, 0xfe02fe3a,
+    0x0002fe39, 0x0002fe39, 0x0002fe39, 0x0002fe39, 0x0002fe39, 0x0002fe39, 0x0002fe39, 0x0002fe39,
+    0xff02fe39, 0xff02fe39, 0xff02fe39, 0xff02fe39, 0xff02fe39, 0xff02fe39, 0xff02fe39, 0xff02fe39,
+    0x00fdfe27, 0x00fdfe27, 0x03fdfe3c, 0xfcfdfe3c, 0x02fdfe3b, 0x02fdfe3b, 0xfdfdfe3b, 0xfdfdfe3b,
+    0x01fdfe3a, 0x01fdfe3a, 0x01fdfe3a, 0x01fdfe3a, 0xfefdfe3a, 0xfefdfe3a, 0xfefdfe3a, 0xfefdfe3a,
+    0x00fdfe39, 0x00fdfe39, 0x00fdfe39, 0x00fdfe39, 0x00fdfe39, 0x00fdfe39, 0x00fdfe39, 0x00fdfe39,
+    0xfffdfe39, 0xfffdfe39, 0xfffdfe39, 0xfffdfe39, 0xfffdfe39, 0xfffdfe39, 0xfffdfe39, 0xfffdfe39,
+    0x0001fe26, 0x0001fe26, 0x0401fe3c, 0xfb01fe3c, 0x0301fe3b, 0x0301fe3b, 0xfc01fe3b, 0xfc01fe3b,
+    0x0201fe3a, 0x0201fe3a, 0x0201fe3a, 0x0201fe3a, 0xfd01fe3a, 0xfd01fe3a, 0xfd01fe3a, 0xfd01fe3a,
+    0x0101fe39, 0x0101fe39, 0x0101fe39, 0x0101fe39, 0x0101fe39, 0x0101fe39, 0x0101fe39, 0x0101fe39,
+    0xfe01fe39, 0xfe01fe39, 0xfe01fe39, 0xfe01fe39, 0xfe01fe39, 0xfe01fe39, 0xfe01fe39, 0xfe01fe39,
+    0x0001fe38, 0x0001fe38, 0x0001fe38, 0x0001fe38, 0x0001fe38, 0x0001fe38, 0x0001fe38, 0x0001fe38,
+    0x0001fe38, 0x0001fe38, 0x0001fe38, 0x0001fe38, 0x0001fe38, 0x0001fe38, 0x0001fe38, 0x0001fe38,
+    0xff01fe38, 0xff01fe38, 0xff01fe38, 0xff01fe38, 0xff01fe38, 0xff01fe38, 0xff01fe38, 0xff01fe38,
+    0xff01fe38, 0xff01fe38, 0xff01fe38, 0xff01fe38, 0xff01fe38, 0xff01fe38, 0xff01fe38, 0xff01fe38,
+    0x00fefe26, 0x00fefe26, 0x04fefe3c, 0xfbfefe3c, 0x03fefe3b, 0x03fefe3b, 0xfcfefe3b, 0xfcfefe3b,
+    0x02fefe3a, 0x02fefe3a, 0x02fefe3a, 0x02fefe3a, 0xfdfefe3a, 0xfdfefe3a, 0xfdfefe3a, 0xfdfefe3a,
+    0x01fefe39, 0x01fefe39, 0x01fefe39, 0x01fefe39, 0x01fefe39, 0x01fefe39, 0x01fefe39, 0x01fefe39,
+    0xfefefe39, 0xfefefe39, 0xfefefe39, 0xfefefe39, 0xfefefe39, 0xfefefe39, 0xfefefe39, 0xfefefe39,
+    0x00fefe38, 0x00fefe38, 0x00fefe38, 0x00fefe38, 0x00fefe38, 0x00fefe38, 0x00fefe38, 0x00fefe38,
+    0x00fefe38, 0x00fefe38, 0x00fefe38, 0x00fefe38, 0x00fefe38, 0x00fefe38, 0x00fefe38, 0x00fefe38,
+    0xfffefe38, 0xfffefe38, 0xfffefe38, 0xfffefe38, 0xfffefe38, 0xfffefe38, 0xfffefe38, 0xfffefe38,
+    0xfffefe38, 0xfffefe38, 0xfffefe38, 0xfffefe38, 0xfffefe38, 0xfffefe38, 0xfffefe38, 0xfffefe38,
+    0x0000fe25, 0x0000fe25, 0x0500fe3c, 0xfa00fe3c, 0x0400fe3b, 0x0400fe3b, 0xfb00fe3b, 0xfb00fe3b,
+    0x0300fe3a, 0x0300fe3a, 0x0300fe3a, 0x0300fe3a, 0xfc00fe3a, 0xfc00fe3a, 0xfc00fe3a, 0xfc00fe3a,
+    0x0200fe39, 0x0200fe39, 0x0200fe39, 0x0200fe39, 0x0200fe39, 0x0200fe39, 0x0200fe39, 0x0200fe39,
+    0xfd00fe39, 0xfd00fe39, 0xfd00fe39, 0xfd00fe39, 0xfd00fe39, 0xfd00fe39, 0xfd00fe39, 0xfd00fe39,
+    0x0100fe38, 0x0100fe38, 0x0100fe38, 0x0100fe38, 0x0100fe38, 0x0100fe38, 0x0100fe38, 0x0100fe38,
+    0x0100fe38, 0x0100fe38, 0x0100fe38, 0x0100fe38, 0x0100fe38, 0x0100fe38, 0x0100fe38, 0x0100fe38,
+    0xfe00fe38, 0xfe00fe38, 0xfe00fe38, 0xfe00fe38, 0xfe00fe38, 0xfe00fe38, 0xfe00fe38, 0xfe00fe38,
+    0xfe00fe38, 0xfe00fe38, 0xfe00fe38, 0xfe00fe38, 0xfe00fe38, 0xfe00fe38, 0xfe00fe38, 0xfe00fe38,
+    0x0000fe37, 0x0000fe37, 0x0000fe37, 0x0000fe37, 0x0000fe37, 0x0000fe37, 0x0000fe37, 0x0000fe37,
+    0x0000fe37, 0x0000fe37, 0x0000fe37, 0x0000fe37, 0x0000fe37, 0x0000fe37, 0x0000fe37, 0x0000fe37,
+    0x0000fe37, 0x0000fe37, 0x0000fe37, 0x0000fe37, 0x0000fe37, 0x0000fe37, 0x0000fe37, 0x0000fe37,
+    0x0000fe37, 0x0000fe37, 0x0000fe37, 0x0000fe37, 0x0000fe37, 0x0000fe37, 0x0000fe37, 0x0000fe37,
+    0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37,
+    0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37,
+    0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37,
+    0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37,
+    0x00fffe25, 0x00fffe25, 0x05fffe3c, 0xfafffe3c, 0x04fffe3b, 0x04fffe3b, 0xfbfffe3b, 0xfbfffe3b,
+    0x03fffe3a, 0x03fffe3a, 0x03fffe3a, 0x03fffe3a, 0xfcfffe3a, 0xfcfffe3a, 0xfcfffe3a, 0xfcfffe3a,
+    0x02fffe39, 0x02fffe39, 0x02fffe39, 0x02fffe39, 0x02fffe39, 0x02fffe39, 0x02fffe39, 0x02fffe39,
+    0xfdfffe39, 0xfdfffe39, 0xfdfffe39, 0xfdfffe39, 0xfdfffe39, 0xfdfffe39, 0xfdfffe39, 0xfdfffe39,
+    0x01fffe38, 0x01fffe38, 0x01fffe38, 0x01fffe38, 0x01fffe38, 0x01fffe38, 0x01fffe38, 0x01fffe38,
+    0x01fffe38, 0x01fffe38, 0x01fffe38, 0x01fffe38, 0x01fffe38, 0x01fffe38, 0x01fffe38, 0x01fffe38,
+    0xfefffe38, 0xfefffe38, 0xfefffe38, 0xfefffe38, 0xfefffe38, 0xfefffe38, 0xfefffe38, 0xfefffe38,
+    0xfefffe38, 0xfefffe38, 0xfefffe38, 0xfefffe38, 0xfefffe38, 0xfefffe38, 0xfefffe38, 0xfefffe38,
+    0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37,
+    0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37,
+    0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37,
+    0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37,
+    0xfffffe37, 0xfffffe37, 0xfffffe37, 0xfffffe37, 0xfffffe37, 0xfffffe37, 0xfffffe37, 0xfffffe37,
+    0xfffffe37, 0xfffffe37, 0xfffffe37, 0xfffffe37, 0xfffffe37, 0xfffffe37, 0xfffffe37, 0xfffffe37,
+    0xfffffe37, 0xfffffe37, 0xfffffe37, 0xfffffe37, 0xfffffe37, 0xfffffe37, 0xfffffe37, 0xfffffe37,
+    0xfffffe37, 0xfffffe37, 0xfffffe37, 0xfffffe37, 0xfffffe37, 0xfffffe37, 0xfffffe37, 0xfffffe37,
+    0x00000012, 0x00000012, 0x0008002c, 0x00f7002c, 0x0007002b, 0x0007002b, 0x00f8002b, 0x00f8002b,
+    0x0006002a, 0x0006002a, 0x0006003c, 0xff06003c, 0x00f9002a, 0x00f9002a, 0x00f9003c, 0xfff9003c,
+    0x00050029, 0x00050029, 0x0105003c, 0xfe05003c, 0x0005003b, 0x0005003b, 0xff05003b, 0xff05003b,
+    0x00fa0029, 0x00fa0029, 0x01fa003c, 0xfefa003c, 0x00fa003b, 0x00fa003b, 0xfffa003b, 0xfffa003b,
+    0x00040028, 0x00040028, 0x0204003c, 0xfd04003c, 0x0104003b, 0x0104003b, 0xfe04003b, 0xfe04003b,
+    0x0004003a, 0x0004003a, 0x0004003a, 0x0004003a, 0xff04003a, 0xff04003a, 0xff04003a, 0xff04003a,
+    0x00fb0028, 0x00fb0028, 0x02fb003c, 0xfdfb003c, 0x01fb003b, 0x01fb003b, 0xfefb003b, 0xfefb003b,
+    0x00fb003a, 0x00fb003a, 0x00fb003a, 0x00fb003a, 0xfffb003a, 0xfffb003a, 0xfffb003a, 0xfffb003a,
+    0x00030027, 0x00030027, 0x0303003c, 0xfc03003c, 0x0203003b, 0x0203003b, 0xfd03003b, 0xfd03003b,
+    0x0103003a, 0x0103003a, 0x0103003a, 0x0103003a, 0xfe03003a, 0xfe03003a, 0xfe03003a, 0xfe03003a,
+    0x00030039, 0x00030039, 0x00030039, 0x00030039, 0x00030039, 0x00030039, 0x00030039, 0x00030039,
+    0xff030039, 0xff030039, 0xff030039, 0xff030039, 0xff030039, 0xff030039, 0xff030039, 0xff030039,
+    0x00fc0027, 0x00fc0027, 0x03fc003c, 0xfcfc003c, 0x02fc003b, 0x02fc003b, 0xfdfc003b, 0xfdfc003b,
+    0x01fc003a, 0x01fc003a, 0x01fc003a, 0x01fc003a, 0xfefc003a, 0xfefc003a, 0xfefc003a, 0xfefc003a,
+    0x00fc0039, 0x00fc0039, 0x00fc0039, 0x00fc0039, 0x00fc0039, 0x00fc0039, 0x00fc0039, 0x00fc0039,
+    0xfffc0039, 0xfffc0039, 0xfffc0039, 0xfffc0039, 0xfffc0039, 0xfffc0039, 0xfffc0039, 0xfffc0039,
+    0x00020026, 0x00020026, 0x0402003c, 0xfb02003c, 0x0302003b, 0x0302003b, 0xfc02003b, 0xfc02003b,
+    0x0202003a, 0x0202003a, 0x0202003a, 0x0202003a, 0xfd02003a, 0xfd02003a, 0xfd02003a, 0xfd02003a,
+    0x01020039, 0x01020039, 0x01020039, 0x01020039, 0x01020039, 0x01020039, 0x01020039, 0x01020039,
+    0xfe020039, 0xfe020039, 0xfe020039, 0xfe020039, 0xfe020039, 0xfe020039, 0xfe020039, 0xfe020039,
+    0x00020038, 0x00020038, 0x00020038, 0x00020038, 0x00020038, 0x00020038, 0x00020038, 0x00020038,
+    0x00020038, 0x00020038, 0x00020038, 0x00020038, 0x00020038, 0x00020038, 0x00020038, 0x00020038,
+    0xff020038, 0xff020038, 0xff020038, 0xff020038, 0xff020038, 0xff020038, 0xff020038, 0xff020038,
+    0xff020038, 0xff020038, 0xff020038, 0xff020038, 0xff020038, 0xff020038, 0xff020038, 0xff020038,
+    0x00fd0026, 0x00fd0026, 0x04fd003c, 0xfbfd003c, 0x03fd003b, 0x03fd003b, 0xfcfd003b, 0xfcfd003b,
+    0x02fd003a, 0x02fd003a, 0x02fd003a, 0x02fd003a, 0xfdfd003a, 0xfdfd003a, 0xfdfd003a, 0xfdfd003a,
+    0x01fd0039, 0x01fd0039, 0x01fd0039, 0x01fd0039, 0x01fd0039, 0x01fd0039, 0x01fd0039, 0x01fd0039,
+    0xfefd0039, 0xfefd0039, 0xfefd0039, 0xfefd0039, 0xfefd0039, 0xfefd0039, 0xfefd0039, 0xfefd0039,
+    0x00fd0038, 0x00fd0038, 0x00fd0038, 0x00fd0038, 0x00fd0038, 0x00fd0038, 0x00fd0038, 0x00fd0038,
+    0x00fd0038, 0x00fd0038, 0x00fd0038, 0x00fd0038, 0x00fd0038, 0x00fd0038, 0x00fd0038, 0x00fd0038,
+    0xfffd0038, 0xfffd0038, 0xfffd0038, 0xfffd0038, 0xfffd0038, 0xfffd0038, 0xfffd0038, 0xfffd0038,
+    0xfffd0038, 0xfffd0038, 0xfffd0038, 0xfffd0038, 0xfffd0038, 0xfffd0038, 0xfffd0038, 0xfffd0038,
+    0x00010025, 0x00010025, 0x0501003c, 0xfa01003c, 0x0401003b, 0x0401003b, 0xfb01003b, 0xfb01003b,
+    0x0301003a, 0x0301003a, 0x0301003a, 0x0301003a, 0xfc01003a, 0xfc01003a, 0xfc01003a, 0xfc01003a,
+    0x02010039, 0x02010039, 0x02010039, 0x02010039, 0x02010039, 0x02010039, 0x02010039, 0x02010039,
+    0xfd010039, 0xfd010039, 0xfd010039, 0xfd010039, 0xfd010039, 0xfd010039, 0xfd010039, 0xfd010039,
+    0x01010038, 0x01010038, 0x01010038, 0x01010038, 0x01010038, 0x01010038, 0x01010038, 0x01010038,
+    0x01010038, 0x01010038, 0x01010038, 0x01010038, 0x01010038, 0x01010038, 0x01010038, 0x01010038,
+    0xfe010038, 0xfe010038, 0xfe010038, 0xfe010038, 0xfe010038, 0xfe010038, 0xfe010038, 0xfe010038,
+    0xfe010038, 0xfe010038, 0xfe010038, 0xfe010038, 0xfe010038, 0xfe010038, 0xfe010038, 0xfe010038,
+    0x00010037, 0x00010037, 0x00010037, 0x00010037, 0x00010037, 0x00010037, 0x00010037, 0x00010037,
+    0x00010037, 0x00010037, 0x00010037, 0x00010037, 0x00010037, 0x00010037, 0x00010037, 0x00010037,
+    0x00010037, 0x00010037, 0x00010037, 0x00010037, 0x00010037, 0x00010037, 0x00010037, 0x00010037,
+    0x00010037, 0x00010037, 0x00010037, 0x00010037, 0x00010037, 0x00010037, 0x00010037, 0x00010037,
+    0xff010037, 0xff010037, 0xff010037, 0xff010037, 0xff010037, 0xff010037, 0xff010037, 0xff010037,
+    0xff010037, 0xff010037, 0xff010037, 0xff010037, 0xff010037, 0xff010037, 0xff010037, 0xff010037,
+    0xff010037, 0xff010037, 0xff010037, 0xff010037, 0xff010037, 0xff010037, 0xff010037, 0xff010037,
+    0xff010037, 0xff010037, 0xff010037, 0xff010037, 0xff010037, 0xff010037, 0xff010037, 0xff010037,
+    0x00fe0025, 0x00fe0025, 0x05fe003c, 0xfafe003c, 0x04fe003b, 0x04fe003b, 0xfbfe003b, 0xfbfe003b,
+    0x03fe003a, 0x03fe003a, 0x03fe003a, 0x03fe003a, 0xfcfe003a, 0xfcfe003a, 0xfcfe003a, 0xfcfe003a,
+    0x02fe0039, 0x02fe0039, 0x02fe0039, 0x02fe0039, 0x02fe0039, 0x02fe0039, 0x02fe0039, 0x02fe0039,
+    0xfdfe0039, 0xfdfe0039, 0xfdfe0039, 0xfdfe0039, 0xfdfe0039, 0xfdfe0039, 0xfdfe0039, 0xfdfe0039,
+    0x01fe0038, 0x01fe0038, 0x01fe0038, 0x01fe0038, 0x01fe0038, 0x01fe0038, 0x01fe0038, 0x01fe0038,
+    0x01fe0038, 0x01fe0038, 0x01fe0038, 0x01fe0038, 0x01fe0038, 0x01fe0038, 0x01fe0038, 0x01fe0038,
+    0xfefe0038, 0xfefe0038, 0xfefe0038, 0xfefe0038, 0xfefe0038, 0xfefe0038, 0xfefe0038, 0xfefe0038,
+    0xfefe0038, 0xfefe0038, 0xfefe0038, 0xfefe0038, 0xfefe0038, 0xfefe0038, 0xfefe0038, 0xfefe0038,
+    0x00fe0037, 0x00fe0037, 0x00fe0037, 0x00fe0037, 0x00fe0037, 0x00fe0037, 0x00fe0037, 0x00fe0037,
+    0x00fe0037, 0x00fe0037, 0x00fe0037, 0x00fe0037, 0x00fe0037, 0x00fe0037, 0x00fe0037, 0x00fe0037,
+    0x00fe0037, 0x00fe0037, 0x00fe0037, 0x00fe0037, 0x00fe0037, 0x00fe0037, 0x00fe0037, 0x00fe0037,
+    0x00fe0037, 0x00fe0037, 0x00fe0037, 0x00fe0037, 0x00fe0037, 0x00fe0037, 0x00fe0037, 0x00fe0037,
+    0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037,
+    0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037,
+    0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037,
+    0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037,
+    0x00000024, 0x00000024, 0x0600003c, 0xf900003c, 0x0500003b, 0x0500003b, 0xfa00003b, 0xfa00003b,
+    0x0400003a, 0x0400003a, 0x0400003a, 0x0400003a, 0xfb00003a, 0xfb00003a, 0xfb00003a, 0xfb00003a,
+    0x03000039, 0x03000039, 0x03000039, 0x03000039, 0x03000039, 0x03000039, 0x03000039, 0x03000039,
+    0xfc000039, 0xfc000039, 0xfc000039, 0xfc000039, 0xfc000039, 0xfc000039, 0xfc000039, 0xfc000039,
+    0x02000038, 0x02000038, 0x02000038, 0x02000038, 0x02000038, 0x02000038, 0x02000038, 0x02000038,
+    0x02000038, 0x02000038, 0x02000038, 0x02000038, 0x02000038, 0x02000038, 0x02000038, 0x02000038,
+    0xfd000038, 0xfd000038, 0xfd000038, 0xfd000038, 0xfd000038, 0xfd000038, 0xfd000038, 0xfd000038,
+    0xfd000038, 0xfd000038, 0xfd000038, 0xfd000038, 0xfd000038, 0xfd000038, 0xfd000038, 0xfd000038,
+    0x01000037, 0x01000037, 0x01000037, 0x01000037, 0x01000037, 0x01000037, 0x01000037, 0x01000037,
+    0x01000037, 0x01000037, 0x01000037, 0x01000037, 0x01000037, 0x01000037, 0x01000037, 0x01000037,
+    0x01000037, 0x01000037, 0x01000037, 0x01000037, 0x01000037, 0x01000037, 0x01000037, 0x01000037,
+    0x01000037, 0x01000037, 0x01000037, 0x01000037, 0x01000037, 0x01000037, 0x01000037, 0x01000037,
+    0xfe000037, 0xfe000037, 0xfe000037, 0xfe000037, 0xfe000037, 0xfe000037, 0xfe000037, 0xfe000037,
+    0xfe000037, 0xfe000037, 0xfe000037, 0xfe000037, 0xfe000037, 0xfe000037, 0xfe000037, 0xfe000037,
+    0xfe000037, 0xfe000037, 0xfe000037, 0xfe000037, 0xfe000037, 0xfe000037, 0xfe000037, 0xfe000037,
+    0xfe000037, 0xfe000037, 0xfe000037, 0xfe000037, 0xfe000037, 0xfe000037, 0xfe000037, 0xfe000037,
+    0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036,
+    0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036,
+    0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036,
+    0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036,
+    0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036,
+    0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036,
+    0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036,
+    0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036,
+    0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036,
+    0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036,
+    0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036,
+    0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036,
+    0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036,
+    0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036,
+    0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036,
+    0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036,
+    0x00ff0024, 0x00ff0024, 0x06ff003c, 0xf9ff003c, 0x05ff003b, 0x05ff003b, 0xfaff003b, 0xfaff003b,
+    0x04ff003a, 0x04ff003a, 0x04ff003a, 0x04ff003a, 0xfbff003a, 0xfbff003a, 0xfbff003a, 0xfbff003a,
+    0x03ff0039, 0x03ff0039, 0x03ff0039, 0x03ff0039, 0x03ff0039, 0x03ff0039, 0x03ff0039, 0x03ff0039,
+    0xfcff0039, 0xfcff0039, 0xfcff0039, 0xfcff0039, 0xfcff0039, 0xfcff0039, 0xfcff0039, 0xfcff0039,
+    0x02ff0038, 0x02ff0038, 0x02ff0038, 0x02ff0038, 0x02ff0038, 0x02ff0038, 0x02ff0038, 0x02ff0038,
+    0x02ff0038, 0x02ff0038, 0x02ff0038, 0x02ff0038, 0x02ff0038, 0x02ff0038, 0x02ff0038, 0x02ff0038,
+    0xfdff0038, 0xfdff0038, 0xfdff0038, 0xfdff0038, 0xfdff0038, 0xfdff0038, 0xfdff0038, 0xfdff0038,
+    0xfdff0038, 0xfdff0038, 0xfdff0038, 0xfdff0038, 0xfdff0038, 0xfdff0038, 0xfdff0038, 0xfdff0038,
+    0x01ff0037, 0x01ff0037, 0x01ff0037, 0x01ff0037, 0x01ff0037, 0x01ff0037, 0x01ff0037, 0x01ff0037,
+    0x01ff0037, 0x01ff0037, 0x01ff0037, 0x01ff0037, 0x01ff0037, 0x01ff0037, 0x01ff0037, 0x01ff0037,
+    0x01ff0037, 0x01ff0037, 0x01ff0037, 0x01ff0037, 0x01ff0037, 0x01ff0037, 0x01ff0037, 0x01ff0037,
+    0x01ff0037, 0x01ff0037, 0x01ff0037, 0x01ff0037, 0x01ff0037, 0x01ff0037, 0x01ff0037, 0x01ff0037,
+    0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037,
+    0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037,
+    0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037,
+    0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037,
+    0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036,
+    0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036,
+    0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036,
+    0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036,
+    0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036,
+    0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036,
+    0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036,
+    0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036,
+    0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036,
+    0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036,
+    0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036,
+    0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036,
+    0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036,
+    0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036,
+    0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036,
+    0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036,
+    0x0000ff12, 0x0000ff12, 0x0008ff2c, 0x00f7ff2c, 0x0007ff2b, 0x0007ff2b, 0x00f8ff2b, 0x00f8ff2b,
+    0x0006ff2a, 0x0006ff2a, 0x0006ff3c, 0xff06ff3c, 0x00f9ff2a, 0x00f9ff2a, 0x00f9ff3c, 0xfff9ff3c,
+    0x0005ff29, 0x0005ff29, 0x0105ff3c, 0xfe05ff3c, 0x0005ff3b, 0x0005ff3b, 0xff05ff3b, 0xff05ff3b,
+    0x00faff29, 0x00faff29, 0x01faff3c, 0xfefaff3c, 0x00faff3b, 0x00faff3b, 0xfffaff3b, 0xfffaff3b,
+    0x0004ff28, 0x0004ff28, 0x0204ff3c, 0xfd04ff3c, 0x0104ff3b, 0x0104ff3b, 0xfe04ff3b, 0xfe04ff3b,
+    0x0004ff3a, 0x0004ff3a, 0x0004ff3a, 0x0004ff3a, 0xff04ff3a, 0xff04ff3a, 0xff04ff3a, 0xff04ff3a,
+    0x00fbff28, 0x00fbff28, 0x02fbff3c, 0xfdfbff3c, 0x01fbff3b, 0x01fbff3b, 0xfefbff3b, 0xfefbff3b,
+    0x00fbff3a, 0x00fbff3a, 0x00fbff3a, 0x00fbff3a, 0xfffbff3a, 0xfffbff3a, 0xfffbff3a, 0xfffbff3a,
+    0x0003ff27, 0x0003ff27, 0x0303ff3c, 0xfc03ff3c, 0x0203ff3b, 0x0203ff3b, 0xfd03ff3b, 0xfd03ff3b,
+    0x0103ff3a, 0x0103ff3a, 0x0103ff3a, 0x0103ff3a, 0xfe03ff3a, 0xfe03ff3a, 0xfe03ff3a, 0xfe03ff3a,
+    0x0003ff39, 0x0003ff39, 0x0003ff39, 0x0003ff39, 0x0003ff39, 0x0003ff39, 0x0003ff39, 0x0003ff39,
+    0xff03ff39, 0xff03ff39, 0xff03ff39, 0xff03ff39, 0xff03ff39, 0xff03ff39, 0xff03ff39, 0xff03ff39,
+    0x00fcff27, 0x00fcff27, 0x03fcff3c, 0xfcfcff3c, 0x02fcff3b, 0x02fcff3b, 0xfdfcff3b, 0xfdfcff3b,
+    0x01fcff3a, 0x01fcff3a, 0x01fcff3a, 0x01fcff3a, 0xfefcff3a, 0xfefcff3a, 0xfefcff3a, 0xfefcff3a,
+    0x00fcff39, 0x00fcff39, 0x00fcff39, 0x00fcff39, 0x00fcff39, 0x00fcff39, 0x00fcff39, 0x00fcff39,
+    0xfffcff39, 0xfffcff39, 0xfffcff39, 0xfffcff39, 0xfffcff39, 0xfffcff39, 0xfffcff39, 0xfffcff39,
+    0x0002ff26, 0x0002ff26, 0x0402ff3c, 0xfb02ff3c, 0x0302ff3b, 0x0302ff3b, 0xfc02ff3b, 0xfc02ff3b,
+    0x0202ff3a, 0x0202ff3a, 0x0202ff3a, 0x0202ff3a, 0xfd02ff3a, 0xfd02ff3a, 0xfd02ff3a, 0xfd02ff3a,
+    0x0102ff39, 0x0102ff39, 0x0102ff39, 0x0102ff39, 0x0102ff39, 0x0102ff39, 0x0102ff39, 0x0102ff39,
+    0xfe02ff39, 0xfe02ff39, 0xfe02ff39, 0xfe02ff39, 0xfe02ff39, 0xfe02ff39, 0xfe02ff39, 0xfe02ff39,
+    0x0002ff38, 0x0002ff38, 0x0002ff38, 0x0002ff38, 0x0002ff38, 0x0002ff38, 0x0002ff38, 0x0002ff38,
+    0x0002ff38, 0x0002ff38, 0x0002ff38, 0x0002ff38, 0x0002ff38, 0x0002ff38, 0x0002ff38, 0x0002ff38,
+    0xff02ff38, 0xff02ff38, 0xff02ff38, 0xff02ff38, 0xff02ff38, 0xff02ff38, 0xff02ff38, 0xff02ff38,
+    0xff02ff38, 0xff02ff38, 0xff02ff38, 0xff02ff38, 0xff02ff38, 0xff02ff38, 0xff02ff38, 0xff02ff38,
+    0x00fdff26, 0x00fdff26, 0x04fdff3c, 0xfbfdff3c, 0x03fdff3b, 0x03fdff3b, 0xfcfdff3b, 0xfcfdff3b,
+    0x02fdff3a, 0x02fdff3a, 0x02fdff3a, 0x02fdff3a, 0xfdfdff3a, 0xfdfdff3a, 0xfdfdff3a, 0xfdfdff3a,
+    0x01fdff39, 0x01fdff39, 0x01fdff39, 0x01fdff39, 0x01fdff39, 0x01fdff39, 0x01fdff39, 0x01fdff39,
+    0xfefdff39, 0xfefdff39, 0xfefdff39, 0xfefdff39, 0xfefdff39, 0xfefdff39, 0xfefdff39, 0xfefdff39,
+    0x00fdff38, 0x00fdff38, 0x00fdff38, 0x00fdff38, 0x00fdff38, 0x00fdff38, 0x00fdff38, 0x00fdff38,
+    0x00fdff38, 0x00fdff38, 0x00fdff38, 0x00fdff38, 0x00fdff38, 0x00fdff38, 0x00fdff38, 0x00fdff38,
+    0xfffdff38, 0xfffdff38, 0xfffdff38, 0xfffdff38, 0xfffdff38, 0xfffdff38, 0xfffdff38, 0xfffdff38,
+    0xfffdff38, 0xfffdff38, 0xfffdff38, 0xfffdff38, 0xfffdff38, 0xfffdff38, 0xfffdff38, 0xfffdff38,
+    0x0001ff25, 0x0001ff25, 0x0501ff3c, 0xfa01ff3c, 0x0401ff3b, 0x0401ff3b, 0xfb01ff3b, 0xfb01ff3b,
+    0x0301ff3a, 0x0301ff3a, 0x0301ff3a, 0x0301ff3a, 0xfc01ff3a, 0xfc01ff3a, 0xfc01ff3a, 0xfc01ff3a,
+    0x0201ff39, 0x0201ff39, 0x0201ff39, 0x0201ff39, 0x0201ff39, 0x0201ff39, 0x0201ff39, 0x0201ff39,
+    0xfd01ff39, 0xfd01ff39, 0xfd01ff39, 0xfd01ff39, 0xfd01ff39, 0xfd01ff39, 0xfd01ff39, 0xfd01ff39,
+    0x0101ff38, 0x0101ff38, 0x0101ff38, 0x0101ff38, 0x0101ff38, 0x0101ff38, 0x0101ff38, 0x0101ff38,
+    0x0101ff38, 0x0101ff38, 0x0101ff38, 0x0101ff38, 0x0101ff38, 0x0101ff38, 0x0101ff38, 0x0101ff38,
+    0xfe01ff38, 0xfe01ff38, 0xfe01ff38, 0xfe01ff38, 0xfe01ff38, 0xfe01ff38, 0xfe01ff38, 0xfe01ff38,
+    0xfe01ff38, 0xfe01ff38, 0xfe01ff38, 0xfe01ff38, 0xfe01ff38, 0xfe01ff38, 0xfe01ff38, 0xfe01ff38,
+    0x0001ff37, 0x0001ff37, 0x0001ff37, 0x0001ff37, 0x0001ff37, 0x0001ff37, 0x0001ff37, 0x0001ff37,
+    0x0001ff37, 0x0001ff37, 0x0001ff37, 0x0001ff37, 0x0001ff37, 0x0001ff37, 0x0001ff37, 0x0001ff37,
+    0x0001ff37, 0x0001ff37, 0x0001ff37, 0x0001ff37, 0x0001ff37, 0x0001ff37, 0x0001ff37, 0x0001ff37,
+    0x0001ff37, 0x0001ff37, 0x0001ff37, 0x0001ff37, 0x0001ff37, 0x0001ff37, 0x0001ff37, 0x0001ff37,
+    0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37,
+    0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37,
+    0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37,
+    0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37,
+    0x00feff25, 0x00feff25, 0x05feff3c, 0xfafeff3c, 0x04feff3b, 0x04feff3b, 0xfbfeff3b, 0xfbfeff3b,
+    0x03feff3a, 0x03feff3a, 0x03feff3a, 0x03feff3a, 0xfcfeff3a, 0xfcfeff3a, 0xfcfeff3a, 0xfcfeff3a,
+    0x02feff39, 0x02feff39, 0x02feff39, 0x02feff39, 0x02feff39, 0x02feff39, 0x02feff39, 0x02feff39,
+    0xfdfeff39, 0xfdfeff39, 0xfdfeff39, 0xfdfeff39, 0xfdfeff39, 0xfdfeff39, 0xfdfeff39, 0xfdfeff39,
+    0x01feff38, 0x01feff38, 0x01feff38, 0x01feff38, 0x01feff38, 0x01feff38, 0x01feff38, 0x01feff38,
+    0x01feff38, 0x01feff38, 0x01feff38, 0x01feff38, 0x01feff38, 0x01feff38, 0x01feff38, 0x01feff38,
+    0xfefeff38, 0xfefeff38, 0xfefeff38, 0xfefeff38, 0xfefeff38, 0xfefeff38, 0xfefeff38, 0xfefeff38,
+    0xfefeff38, 0xfefeff38, 0xfefeff38, 0xfefeff38, 0xfefeff38, 0xfefeff38, 0xfefeff38, 0xfefeff38,
+    0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37,
+    0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37,
+    0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37,
+    0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37,
+    0xfffeff37, 0xfffeff37, 0xfffeff37, 0xfffeff37, 0xfffeff37, 0xfffeff37, 0xfffeff37, 0xfffeff37,
+    0xfffeff37, 0xfffeff37, 0xfffeff37, 0xfffeff37, 0xfffeff37, 0xfffeff37, 0xfffeff37, 0xfffeff37,
+    0xfffeff37, 0xfffeff37, 0xfffeff37, 0xfffeff37, 0xfffeff37, 0xfffeff37, 0xfffeff37, 0xfffeff37,
+    0xfffeff37, 0xfffeff37, 0xfffeff37, 0xfffeff37, 0xfffeff37, 0xfffeff37, 0xfffeff37, 0xfffeff37,
+    0x0000ff24, 0x0000ff24, 0x0600ff3c, 0xf900ff3c, 0x0500ff3b, 0x0500ff3b, 0xfa00ff3b, 0xfa00ff3b,
+    0x0400ff3a, 0x0400ff3a, 0x0400ff3a, 0x0400ff3a, 0xfb00ff3a, 0xfb00ff3a, 0xfb00ff3a, 0xfb00ff3a,
+    0x0300ff39, 0x0300ff39, 0x0300ff39, 0x0300ff39, 0x0300ff39, 0x0300ff39, 0x0300ff39, 0x0300ff39,
+    0xfc00ff39, 0xfc00ff39, 0xfc00ff39, 0xfc00ff39, 0xfc00ff39, 0xfc00ff39, 0xfc00ff39, 0xfc00ff39,
+    0x0200ff38, 0x0200ff38, 0x0200ff38, 0x0200ff38, 0x0200ff38, 0x0200ff38, 0x0200ff38, 0x0200ff38,
+    0x0200ff38, 0x0200ff38, 0x0200ff38, 0x0200ff38, 0x0200ff38, 0x0200ff38, 0x0200ff38, 0x0200ff38,
+    0xfd00ff38, 0xfd00ff38, 0xfd00ff38, 0xfd00ff38, 0xfd00ff38, 0xfd00ff38, 0xfd00ff38, 0xfd00ff38,
+    0xfd00ff38, 0xfd00ff38, 0xfd00ff38, 0xfd00ff38, 0xfd00ff38, 0xfd00ff38, 0xfd00ff38, 0xfd00ff38,
+    0x0100ff37, 0x0100ff37, 0x0100ff37, 0x0100ff37, 0x0100ff37, 0x0100ff37, 0x0100ff37, 0x0100ff37,
+    0x0100ff37, 0x0100ff37, 0x0100ff37, 0x0100ff37, 0x0100ff37, 0x0100ff37, 0x0100ff37, 0x0100ff37,
+    0x0100ff37, 0x0100ff37, 0x0100ff37, 0x0100ff37, 0x0100ff37, 0x0100ff37, 0x0100ff37, 0x0100ff37,
+    0x0100ff37, 0x0100ff37, 0x0100ff37, 0x0100ff37, 0x0100ff37, 0x0100ff37, 0x0100ff37, 0x0100ff37,
+    0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37,
+    0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37,
+    0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37,
+    0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37,
+    0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36,
+    0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36,
+    0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36,
+    0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36,
+    0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36,
+    0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36,
+    0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36,
+    0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36,
+    0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36,
+    0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36,
+    0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36,
+    0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36,
+    0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36,
+    0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36,
+    0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36,
+    0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36,
+    0x00ffff24, 0x00ffff24, 0x06ffff3c, 0xf9ffff3c, 0x05ffff3b, 0x05ffff3b, 0xfaffff3b, 0xfaffff3b,
+    0x04ffff3a, 0x04ffff3a, 0x04ffff3a, 0x04ffff3a, 0xfbffff3a, 0xfbffff3a, 0xfbffff3a, 0xfbffff3a,
+    0x03ffff39, 0x03ffff39, 0x03ffff39, 0x03ffff39, 0x03ffff39, 0x03ffff39, 0x03ffff39, 0x03ffff39,
+    0xfcffff39, 0xfcffff39, 0xfcffff39, 0xfcffff39, 0xfcffff39, 0xfcffff39, 0xfcffff39, 0xfcffff39,
+    0x02ffff38, 0x02ffff38, 0x02ffff38, 0x02ffff38, 0x02ffff38, 0x02ffff38, 0x02ffff38, 0x02ffff38,
+    0x02ffff38, 0x02ffff38, 0x02ffff38, 0x02ffff38, 0x02ffff38, 0x02ffff38, 0x02ffff38, 0x02ffff38,
+    0xfdffff38, 0xfdffff38, 0xfdffff38, 0xfdffff38, 0xfdffff38, 0xfdffff38, 0xfdffff38, 0xfdffff38,
+    0xfdffff38, 0xfdffff38, 0xfdffff38, 0xfdffff38, 0xfdffff38, 0xfdffff38, 0xfdffff38, 0xfdffff38,
+    0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37,
+    0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37,
+    0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37,
+    0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37,
+    0xfeffff37, 0xfeffff37, 0xfeffff37, 0xfeffff37, 0xfeffff37, 0xfeffff37, 0xfeffff37, 0xfeffff37,
+    0xfeffff37, 0xfeffff37, 0xfeffff37, 0xfeffff37, 0xfeffff37, 0xfeffff37, 0xfeffff37, 0xfeffff37,
+    0xfeffff37, 0xfeffff37, 0xfeffff37, 0xfeffff37, 0xfeffff37, 0xfeffff37, 0xfeffff37, 0xfeffff37,
+    0xfeffff37, 0xfeffff37, 0xfeffff37, 0xfeffff37, 0xfeffff37, 0xfeffff37, 0xfeffff37, 0xfeffff37,
+    0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36,
+    0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36,
+    0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36,
+    0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36,
+    0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36,
+    0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36,
+    0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36,
+    0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36,
+    0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36,
+    0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36,
+    0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36,
+    0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36,
+    0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36,
+    0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36,
+    0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36,
+    0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36,
+  },
+  {
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000121c, 0x0000ed1c, 0x0000131c, 0x0000ec1c,
+    0x0000101b, 0x0000101b, 0x0000ef1b, 0x0000ef1b, 0x0000111b, 0x0000111b, 0x0000ee1b, 0x0000ee1b,
+    0x00000e1a, 0x00000e1a, 0x00000e1a, 0x00000e1a, 0x0000f11a, 0x0000f11a, 0x0000f11a, 0x0000f11a,
+    0x00000f1a, 0x00000f1a, 0x00000f1a, 0x00000f1a, 0x0000f01a, 0x0000f01a, 0x0000f01a, 0x0000f01a,
+    0x00000c19, 0x00000c19, 0x00000c19, 0x00000c19, 0x00000c2c, 0x00ff0c2c, 0x00010c2c, 0x00fe0c2c,
+    0x0000f319, 0x0000f319, 0x0000f319, 0x0000f319, 0x0000f32c, 0x00fff32c, 0x0001f32c, 0x00fef32c,
+    0x00000d19, 0x00000d19, 0x00000d19, 0x00000d19, 0x00000d2c, 0x00ff0d2c, 0x00010d2c, 0x00fe0d2c,
+    0x0000f219, 0x0000f219, 0x0000f219, 0x0000f219, 0x0000f22c, 0x00fff22c, 0x0001f22c, 0x00fef22c,
+    0x00000a18, 0x00000a18, 0x00000a18, 0x00000a18, 0x00020a2c, 0x00fd0a2c, 0x00030a2c, 0x00fc0a2c,
+    0x00000a2b, 0x00000a2b, 0x00ff0a2b, 0x00ff0a2b, 0x00010a2b, 0x00010a2b, 0x00fe0a2b, 0x00fe0a2b,
+    0x0000f518, 0x0000f518, 0x0000f518, 0x0000f518, 0x0002f52c, 0x00fdf52c, 0x0003f52c, 0x00fcf52c,
+    0x0000f52b, 0x0000f52b, 0x00fff52b, 0x00fff52b, 0x0001f52b, 0x0001f52b, 0x00fef52b, 0x00fef52b,
+    0x00000b18, 0x00000b18, 0x00000b18, 0x00000b18, 0x00020b2c, 0x00fd0b2c, 0x00030b2c, 0x00fc0b2c,
+    0x00000b2b, 0x00000b2b, 0x00ff0b2b, 0x00ff0b2b, 0x00010b2b, 0x00010b2b, 0x00fe0b2b, 0x00fe0b2b,
+    0x0000f418, 0x0000f418, 0x0000f418, 0x0000f418, 0x0002f42c, 0x00fdf42c, 0x0003f42c, 0x00fcf42c,
+    0x0000f42b, 0x0000f42b, 0x00fff42b, 0x00fff42b, 0x0001f42b, 0x0001f42b, 0x00fef42b, 0x00fef42b,
+    0x00000817, 0x00000817, 0x00000817, 0x00000817, 0x0004082c, 0x00fb082c, 0x0005082c, 0x00fa082c,
+    0x0002082b, 0x0002082b, 0x00fd082b, 0x00fd082b, 0x0003082b, 0x0003082b, 0x00fc082b, 0x00fc082b,
+    0x0000082a, 0x0000082a, 0x0000082a, 0x0000082a, 0x00ff082a, 0x00ff082a, 0x00ff082a, 0x00ff082a,
+    0x0001082a, 0x0001082a, 0x0001082a, 0x0001082a, 0x00fe082a, 0x00fe082a, 0x00fe082a, 0x00fe082a,
+    0x0000f717, 0x0000f717, 0x0000f717, 0x0000f717, 0x0004f72c, 0x00fbf72c, 0x0005f72c, 0x00faf72c,
+    0x0002f72b, 0x0002f72b, 0x00fdf72b, 0x00fdf72b, 0x0003f72b, 0x0003f72b, 0x00fcf72b, 0x00fcf72b,
+    0x0000f72a, 0x0000f72a, 0x0000f72a, 0x0000f72a, 0x00fff72a, 0x00fff72a, 0x00fff72a, 0x00fff72a,
+    0x0001f72a, 0x0001f72a, 0x0001f72a, 0x0001f72a, 0x00fef72a, 0x00fef72a, 0x00fef72a, 0x00fef72a,
+    0x00000917, 0x00000917, 0x00000917, 0x00000917, 0x0004092c, 0x00fb092c, 0x0005092c, 0x00fa092c,
+    0x0002092b, 0x0002092b, 0x00fd092b, 0x00fd092b, 0x0003092b, 0x0003092b, 0x00fc092b, 0x00fc092b,
+    0x0000092a, 0x0000092a, 0x0000092a, 0x0000092a, 0x00ff092a, 0x00ff092a, 0x00ff092a, 0x00ff092a,
+    0x0001092a, 0x0001092a, 0x0001092a, 0x0001092a, 0x00fe092a, 0x00fe092a, 0x00fe092a, 0x00fe092a,
+    0x0000f617, 0x0000f617, 0x0000f617, 0x0000f617, 0x0004f62c, 0x00fbf62c, 0x0005f62c, 0x00faf62c,
+    0x0002f62b, 0x0002f62b, 0x00fdf62b, 0x00fdf62b, 0x0003f62b, 0x0003f62b, 0x00fcf62b, 0x00fcf62b,
+    0x0000f62a, 0x0000f62a, 0x0000f62a, 0x0000f62a, 0x00fff62a, 0x00fff62a, 0x00fff62a, 0x00fff62a,
+    0x0001f62a, 0x0001f62a, 0x0001f62a, 0x0001f62a, 0x00fef62a, 0x00fef62a, 0x00fef62a, 0x00fef62a,
+    0x00000616, 0x00000616, 0x00000616, 0x00000616, 0x0006062c, 0x00f9062c, 0x0007062c, 0x00f8062c,
+    0x0004062b, 0x0004062b, 0x00fb062b, 0x00fb062b, 0x0005062b, 0x0005062b, 0x00fa062b, 0x00fa062b,
+    0x0002062a, 0x0002062a, 0x0002062a, 0x0002062a, 0x00fd062a, 0x00fd062a, 0x00fd062a, 0x00fd062a,
+    0x0003062a, 0x0003062a, 0x0003062a, 0x0003062a, 0x00fc062a, 0x00fc062a, 0x00fc062a, 0x00fc062a,
+    0x00000629, 0x00000629, 0x00000629, 0x00000629, 0x0000063c, 0xff00063c, 0x0100063c, 0xfe00063c,
+    0x00ff0629, 0x00ff0629, 0x00ff0629, 0x00ff0629, 0x00ff063c, 0xffff063c, 0x01ff063c, 0xfeff063c,
+    0x00010629, 0x00010629, 0x00010629, 0x00010629, 0x0001063c, 0xff01063c, 0x0101063c, 0xfe01063c,
+    0x00fe0629, 0x00fe0629, 0x00fe0629, 0x00fe0629, 0x00fe063c, 0xfffe063c, 0x01fe063c, 0xfefe063c,
+    0x0000f916, 0x0000f916, 0x0000f916, 0x0000f916, 0x0006f92c, 0x00f9f92c, 0x0007f92c, 0x00f8f92c,
+    0x0004f92b, 0x0004f92b, 0x00fbf92b, 0x00fbf92b, 0x0005f92b, 0x0005f92b, 0x00faf92b, 0x00faf92b,
+    0x0002f92a, 0x0002f92a, 0x0002f92a, 0x0002f92a, 0x00fdf92a, 0x00fdf92a, 0x00fdf92a, 0x00fdf92a,
+    0x0003f92a, 0x0003f92a, 0x0003f92a, 0x0003f92a, 0x00fcf92a, 0x00fcf92a, 0x00fcf92a, 0x00fcf92a,
+    0x0000f929, 0x0000f929, 0x0000f929, 0x0000f929, 0x0000f93c, 0xff00f93c, 0x0100f93c, 0xfe00f93c,
+    0x00fff929, 0x00fff929, 0x00fff929, 0x00fff929, 0x00fff93c, 0xfffff93c, 0x01fff93c, 0xfefff93c,
+    0x0001f929, 0x0001f929, 0x0001f929, 0x0001f929, 0x0001f93c, 0xff01f93c, 0x0101f93c, 0xfe01f93c,
+    0x00fef929, 0x00fef929, 0x00fef929, 0x00fef929, 0x00fef93c, 0xfffef93c, 0x01fef93c, 0xfefef93c,
+    0x00000716, 0x00000716, 0x00000716, 0x00000716, 0x0006072c, 0x00f9072c, 0x0007072c, 0x00f8072c,
+    0x0004072b, 0x0004072b, 0x00fb072b, 0x00fb072b, 0x0005072b, 0x0005072b, 0x00fa072b, 0x00fa072b,
+    0x0002072a, 0x0002072a, 0x0002072a, 0x0002072a, 0x00fd072a, 0x00fd072a, 0x00fd072a, 0x00fd072a,
+    0x0003072a, 0x0003072a, 0x0003072a, 0x0003072a, 0x00fc072a, 0x00fc072a, 0x00fc072a, 0x00fc072a,
+    0x00000729, 0x00000729, 0x00000729, 0x00000729, 0x0000073c, 0xff00073c, 0x0100073c, 0xfe00073c,
+    0x00ff0729, 0x00ff0729, 0x00ff0729, 0x00ff0729, 0x00ff073c, 0xffff073c, 0x01ff073c, 0xfeff073c,
+    0x00010729, 0x00010729, 0x00010729, 0x00010729, 0x0001073c, 0xff01073c, 0x0101073c, 0xfe01073c,
+    0x00fe0729, 0x00fe0729, 0x00fe0729, 0x00fe0729, 0x00fe073c, 0xfffe073c, 0x01fe073c, 0xfefe073c,
+    0x0000f816, 0x0000f816, 0x0000f816, 0x0000f816, 0x0006f82c, 0x00f9f82c, 0x0007f82c, 0x00f8f82c,
+    0x0004f82b, 0x0004f82b, 0x00fbf82b, 0x00fbf82b, 0x0005f82b, 0x0005f82b, 0x00faf82b, 0x00faf82b,
+    0x0002f82a, 0x0002f82a, 0x0002f82a, 0x0002f82a, 0x00fdf82a, 0x00fdf82a, 0x00fdf82a, 0x00fdf82a,
+    0x0003f82a, 0x0003f82a, 0x0003f82a, 0x0003f82a, 0x00fcf82a, 0x00fcf82a, 0x00fcf82a, 0x00fcf82a,
+    0x0000f829, 0x0000f829, 0x0000f829, 0x0000f829, 0x0000f83c, 0xff00f83c, 0x0100f83c, 0xfe00f83c,
+    0x00fff829, 0x00fff829, 0x00fff829, 0x00fff829, 0x00fff83c, 0xfffff83c, 0x01fff83c, 0xfefff83c,
+    0x0001f829, 0x0001f829, 0x0001f829, 0x0001f829, 0x0001f83c, 0xff01f83c, 0x0101f83c, 0xfe01f83c,
+    0x00fef829, 0x00fef829, 0x00fef829, 0x00fef829, 0x00fef83c, 0xfffef83c, 0x01fef83c, 0xfefef83c,
+    0x00000415, 0x00000415, 0x00000415, 0x00000415, 0x0008042c, 0x00f7042c, 0x0009042c, 0x00f6042c,
+    0x0006042b, 0x0006042b, 0x00f9042b, 0x00f9042b, 0x0007042b, 0x0007042b, 0x00f8042b, 0x00f8042b,
+    0x0004042a, 0x0004042a, 0x0004042a, 0x0004042a, 0x00fb042a, 0x00fb042a, 0x00fb042a, 0x00fb042a,
+    0x0005042a, 0x0005042a, 0x0005042a, 0x0005042a, 0x00fa042a, 0x00fa042a, 0x00fa042a, 0x00fa042a,
+    0x00020429, 0x00020429, 0x00020429, 0x00020429, 0x0002043c, 0xff02043c, 0x0102043c, 0xfe02043c,
+    0x00fd0429, 0x00fd0429, 0x00fd0429, 0x00fd0429, 0x00fd043c, 0xfffd043c, 0x01fd043c, 0xfefd043c,
+    0x00030429, 0x00030429, 0x00030429, 0x00030429, 0x0003043c, 0xff03043c, 0x0103043c, 0xfe03043c,
+    0x00fc0429, 0x00fc0429, 0x00fc0429, 0x00fc0429, 0x00fc043c, 0xfffc043c, 0x01fc043c, 0xfefc043c,
+    0x00000428, 0x00000428, 0x00000428, 0x00000428, 0x0200043c, 0xfd00043c, 0x0300043c, 0xfc00043c,
+    0x0000043b, 0x0000043b, 0xff00043b, 0xff00043b, 0x0100043b, 0x0100043b, 0xfe00043b, 0xfe00043b,
+    0x00ff0428, 0x00ff0428, 0x00ff0428, 0x00ff0428, 0x02ff043c, 0xfdff043c, 0x03ff043c, 0xfcff043c,
+    0x00ff043b, 0x00ff043b, 0xffff043b, 0xffff043b, 0x01ff043b, 0x01ff043b, 0xfeff043b, 0xfeff043b,
+    0x00010428, 0x00010428, 0x00010428, 0x00010428, 0x0201043c, 0xfd01043c, 0x0301043c, 0xfc01043c,
+    0x0001043b, 0x0001043b, 0xff01043b, 0xff01043b, 0x0101043b, 0x0101043b, 0xfe01043b, 0xfe01043b,
+    0x00fe0428, 0x00fe0428, 0x00fe0428, 0x00fe0428, 0x02fe043c, 0xfdfe043c, 0x03fe043c, 0xfcfe043c,
+    0x00fe043b, 0x00fe043b, 0xfffe043b, 0xfffe043b, 0x01fe043b, 0x01fe043b, 0xfefe043b, 0xfefe043b,
+    0x0000fb15, 0x0000fb15, 0x0000fb15, 0x0000fb15, 0x0008fb2c, 0x00f7fb2c, 0x0009fb2c, 0x00f6fb2c,
+    0x0006fb2b, 0x0006fb2b, 0x00f9fb2b, 0x00f9fb2b, 0x0007fb2b, 0x0007fb2b, 0x00f8fb2b, 0x00f8fb2b,
+    0x0004fb2a, 0x0004fb2a, 0x0004fb2a, 0x0004fb2a, 0x00fbfb2a, 0x00fbfb2a, 0x00fbfb2a, 0x00fbfb2a,
+    0x0005fb2a, 0x0005fb2a, 0x0005fb2a, 0x0005fb2a, 0x00fafb2a, 0x00fafb2a, 0x00fafb2a, 0x00fafb2a,
+    0x0002fb29, 0x0002fb29, 0x0002fb29, 0x0002fb29, 0x0002fb3c, 0xff02fb3c, 0x0102fb3c, 0xfe02fb3c,
+    0x00fdfb29, 0x00fdfb29, 0x00fdfb29, 0x00fdfb29, 0x00fdfb3c, 0xfffdfb3c, 0x01fdfb3c, 0xfefdfb3c,
+    0x0003fb29, 0x0003fb29, 0x0003fb29, 0x0003fb29, 0x0003fb3c, 0xff03fb3c, 0x0103fb3c, 0xfe03fb3c,
+    0x00fcfb29, 0x00fcfb29, 0x00fcfb29, 0x00fcfb29, 0x00fcfb3c, 0xfffcfb3c, 0x01fcfb3c, 0xfefcfb3c,
+    0x0000fb28, 0x0000fb28, 0x0000fb28, 0x0000fb28, 0x0200fb3c, 0xfd00fb3c, 0x0300fb3c, 0xfc00fb3c,
+    0x0000fb3b, 0x0000fb3b, 0xff00fb3b, 0xff00fb3b, 0x0100fb3b, 0x0100fb3b, 0xfe00fb3b, 0xfe00fb3b,
+    0x00fffb28, 0x00fffb28, 0x00fffb28, 0x00fffb28, 0x02fffb3c, 0xfdfffb3c, 0x03fffb3c, 0xfcfffb3c,
+    0x00fffb3b, 0x00fffb3b, 0xfffffb3b, 0xfffffb3b, 0x01fffb3b, 0x01fffb3b, 0xfefffb3b, 0xfefffb3b,
+    0x0001fb28, 0x0001fb28, 0x0001fb28, 0x0001fb28, 0x0201fb3c, 0xfd01fb3c, 0x0301fb3c, 0xfc01fb3c,
+    0x0001fb3b, 0x0001fb3b, 0xff01fb3b, 0xff01fb3b, 0x0101fb3b, 0x0101fb3b, 0xfe01fb3b, 0xfe01fb3b,
+    0x00fefb28, 0x00fefb28, 0x00fefb28, 0x00fefb28, 0x02fefb3c, 0xfdfefb3c, 0x03fefb3c, 0xfcfefb3c,
+    0x00fefb3b, 0x00fefb3b, 0xfffefb3b, 0xfffefb3b, 0x01fefb3b, 0x01fefb3b, 0xfefefb3b, 0xfefefb3b,
+    0x00000515, 0x00000515, 0x00000515, 0x00000515, 0x0008052c, 0x00f7052c, 0x0009052c, 0x00f6052c,
+    0x0006052b, 0x0006052b, 0x00f9052b, 0x00f9052b, 0x0007052b, 0x0007052b, 0x00f8052b, 0x00f8052b,
+    0x0004052a, 0x0004052a, 0x0004052a, 0x0004052a, 0x00fb052a, 0x00fb052a, 0x00fb052a, 0x00fb052a,
+    0x0005052a, 0x0005052a, 0x0005052a, 0x0005052a, 0x00fa052a, 0x00fa052a, 0x00fa052a, 0x00fa052a,
+    0x00020529, 0x00020529, 0x00020529, 0x00020529, 0x0002053c, 0xff02053c, 0x0102053c, 0xfe02053c,
+    0x00fd0529, 0x00fd0529, 0x00fd0529, 0x00fd0529, 0x00fd053c, 0xfffd053c, 0x01fd053c, 0xfefd053c,
+    0x00030529, 0x00030529, 0x00030529, 0x00030529, 0x0003053c, 0xff03053c, 0x0103053c, 0xfe03053c,
+    0x00fc0529, 0x00fc0529, 0x00fc0529, 0x00fc0529, 0x00fc053c, 0xfffc053c, 0x01fc053c, 0xfefc053c,
+    0x00000528, 0x00000528, 0x00000528, 0x00000528, 0x0200053c, 0xfd00053c, 0x0300053c, 0xfc00053c,
+    0x0000053b, 0x0000053b, 0xff00053b, 0xff00053b, 0x0100053b, 0x0100053b, 0xfe00053b, 0xfe00053b,
+    0x00ff0528, 0x00ff0528, 0x00ff0528, 0x00ff0528, 0x02ff053c, 0xfdff053c, 0x03ff053c, 0xfcff053c,
+    0x00ff053b, 0x00ff053b, 0xffff053b, 0xffff053b, 0x01ff053b, 0x01ff053b, 0xfeff053b, 0xfeff053b,
+    0x00010528, 0x00010528, 0x00010528, 0x00010528, 0x0201053c, 0xfd01053c, 0x0301053c, 0xfc01053c,
+    0x0001053b, 0x0001053b, 0xff01053b, 0xff01053b, 0x0101053b, 0x0101053b, 0xfe01053b, 0xfe01053b,
+    0x00fe0528, 0x00fe0528, 0x00fe0528, 0x00fe0528, 0x02fe053c, 0xfdfe053c, 0x03fe053c, 0xfcfe053c,
+    0x00fe053b, 0x00fe053b, 0xfffe053b, 0xfffe053b, 0x01fe053b, 0x01fe053b, 0xfefe053b, 0xfefe053b,
+    0x0000fa15, 0x0000fa15, 0x0000fa15, 0x0000fa15, 0x0008fa2c, 0x00f7fa2c, 0x0009fa2c, 0x00f6fa2c,
+    0x0006fa2b, 0x0006fa2b, 0x00f9fa2b, 0x00f9fa2b, 0x0007fa2b, 0x0007fa2b, 0x00f8fa2b, 0x00f8fa2b,
+    0x0004fa2a, 0x0004fa2a, 0x0004fa2a, 0x0004fa2a, 0x00fbfa2a, 0x00fbfa2a, 0x00fbfa2a, 0x00fbfa2a,
+    0x0005fa2a, 0x0005fa2a, 0x0005fa2a, 0x0005fa2a, 0x00fafa2a, 0x00fafa2a, 0x00fafa2a, 0x00fafa2a,
+    0x0002fa29, 0x0002fa29, 0x0002fa29, 0x0002fa29, 0x0002fa3c, 0xff02fa3c, 0x0102fa3c, 0xfe02fa3c,
+    0x00fdfa29, 0x00fdfa29, 0x00fdfa29, 0x00fdfa29, 0x00fdfa3c, 0xfffdfa3c, 0x01fdfa3c, 0xfefdfa3c,
+    0x0003fa29, 0x0003fa29, 0x0003fa29, 0x0003fa29, 0x0003fa3c, 0xff03fa3c, 0x0103fa3c, 0xfe03fa3c,
+    0x00fcfa29, 0x00fcfa29, 0x00fcfa29, 0x00fcfa29, 0x00fcfa3c, 0xfffcfa3c, 0x01fcfa3c, 0xfefcfa3c,
+    0x0000fa28, 0x0000fa28, 0x0000fa28, 0x0000fa28, 0x0200fa3c, 0xfd00fa3c, 0x0300fa3c, 0xfc00fa3c,
+    0x0000fa3b, 0x0000fa3b, 0xff00fa3b, 0xff00fa3b, 0x0100fa3b, 0x0100fa3b, 0xfe00fa3b, 0xfe00fa3b,
+    0x00fffa28, 0x00fffa28, 0x00fffa28, 0x00fffa28, 0x02fffa3c, 0xfdfffa3c, 0x03fffa3c, 0xfcfffa3c,
+    0x00fffa3b, 0x00fffa3b, 0xfffffa3b, 0xfffffa3b, 0x01fffa3b, 0x01fffa3b, 0xfefffa3b, 0xfefffa3b,
+    0x0001fa28, 0x0001fa28, 0x0001fa28, 0x0001fa28, 0x0201fa3c, 0xfd01fa3c, 0x0301fa3c, 0xfc01fa3c,
+    0x0001fa3b, 0x0001fa3b, 0xff01fa3b, 0xff01fa3b, 0x0101fa3b, 0x0101fa3b, 0xfe01fa3b, 0xfe01fa3b,
+    0x00fefa28, 0x00fefa28, 0x00fefa28, 0x00fefa28, 0x02fefa3c, 0xfdfefa3c, 0x03fefa3c, 0xfcfefa3c,
+    0x00fefa3b, 0x00fefa3b, 0xfffefa3b, 0xfffefa3b, 0x01fefa3b, 0x01fefa3b, 0xfefefa3b, 0xfefefa3b,
+    0x00000214, 0x00000214, 0x00000214, 0x00000214, 0x000a022c, 0x00f5022c, 0x000b022c, 0x00f4022c,
+    0x0008022b, 0x0008022b, 0x00f7022b, 0x00f7022b, 0x0009022b, 0x0009022b, 0x00f6022b, 0x00f6022b,
+    0x0006022a, 0x0006022a, 0x0006022a, 0x0006022a, 0x00f9022a, 0x00f9022a, 0x00f9022a, 0x00f9022a,
+    0x0007022a, 0x0007022a, 0x0007022a, 0x0007022a, 0x00f8022a, 0x00f8022a, 0x00f8022a, 0x00f8022a,
+    0x00040229, 0x00040229, 0x00040229, 0x00040229, 0x0004023c, 0xff04023c, 0x0104023c, 0xfe04023c,
+    0x00fb0229, 0x00fb0229, 0x00fb0229, 0x00fb0229, 0x00fb023c, 0xfffb023c, 0x01fb023c, 0xfefb023c,
+    0x00050229, 0x00050229, 0x00050229, 0x00050229, 0x0005023c, 0xff05023c, 0x0105023c, 0xfe05023c,
+    0x00fa0229, 0x00fa0229, 0x00fa0229, 0x00fa0229, 0x00fa023c, 0xfffa023c, 0x01fa023c, 0xfefa023c,
+    0x00020228, 0x00020228, 0x00020228, 0x00020228, 0x0202023c, 0xfd02023c, 0x0302023c, 0xfc02023c,
+    0x0002023b, 0x0002023b, 0xff02023b, 0xff02023b, 0x0102023b, 0x0102023b, 0xfe02023b, 0xfe02023b,
+    0x00fd0228, 0x00fd0228, 0x00fd0228, 0x00fd0228, 0x02fd023c, 0xfdfd023c, 0x03fd023c, 0xfcfd023c,
+    0x00fd023b, 0x00fd023b, 0xfffd023b, 0xfffd023b, 0x01fd023b, 0x01fd023b, 0xfefd023b, 0xfefd023b,
+    0x00030228, 0x00030228, 0x00030228, 0x00030228, 0x0203023c, 0xfd03023c, 0x0303023c, 0xfc03023c,
+    0x0003023b, 0x0003023b, 0xff03023b, 0xff03023b, 0x0103023b, 0x0103023b, 0xfe03023b, 0xfe03023b,
+    0x00fc0228, 0x00fc0228, 0x00fc0228, 0x00fc0228, 0x02fc023c, 0xfdfc023c, 0x03fc023c, 0xfcfc023c,
+    0x00fc023b, 0x00fc023b, 0xfffc023b, 0xfffc023b, 0x01fc023b, 0x01fc023b, 0xfefc023b, 0xfefc023b,
+    0x00000227, 0x00000227, 0x00000227, 0x00000227, 0x0400023c, 0xfb00023c, 0x0500023c, 0xfa00023c,
+    0x0200023b, 0x0200023b, 0xfd00023b, 0xfd00023b, 0x0300023b, 0x0300023b, 0xfc00023b, 0xfc00023b,
+    0x0000023a, 0x0000023a, 0x0000023a, 0x0000023a, 0xff00023a, 0xff00023a, 0xff00023a, 0xff00023a,
+    0x0100023a, 0x0100023a, 0x0100023a, 0x0100023a, 0xfe00023a, 0xfe00023a, 0xfe00023a, 0xfe00023a,
+    0x00ff0227, 0x00ff0227, 0x00ff0227, 0x00ff0227, 0x04ff023c, 0xfbff023c, 0x05ff023c, 0xfaff023c,
+    0x02ff023b, 0x02ff023b, 0xfdff023b, 0xfdff023b, 0x03ff023b, 0x03ff023b, 0xfcff023b, 0xfcff023b,
+    0x00ff023a, 0x00ff023a, 0x00ff023a, 0x00ff023a, 0xffff023a, 0xffff023a, 0xffff023a, 0xffff023a,
+    0x01ff023a, 0x01ff023a, 0x01ff023a, 0x01ff023a, 0xfeff023a, 0xfeff023a, 0xfeff023a, 0xfeff023a,
+    0x00010227, 0x00010227, 0x00010227, 0x00010227, 0x0401023c, 0xfb01023c, 0x0501023c, 0xfa01023c,
+    0x0201023b, 0x0201023b, 0xfd01023b, 0xfd01023b, 0x0301023b, 0x0301023b, 0xfc01023b, 0xfc01023b,
+    0x0001023a, 0x0001023a, 0x0001023a, 0x0001023a, 0xff01023a, 0xff01023a, 0xff01023a, 0xff01023a,
+    0x0101023a, 0x0101023a, 0x0101023a, 0x0101023a, 0xfe01023a, 0xfe01023a, 0xfe01023a, 0xfe01023a,
+    0x00fe0227, 0x00fe0227, 0x00fe0227, 0x00fe0227, 0x04fe023c, 0xfbfe023c, 0x05fe023c, 0xfafe023c,
+    0x02fe023b, 0x02fe023b, 0xfdfe023b, 0xfdfe023b, 0x03fe023b, 0x03fe023b, 0xfcfe023b, 0xfcfe023b,
+    0x00fe023a, 0x00fe023a, 0x00fe023a, 0x00fe023a, 0xfffe023a, 0xfffe023a, 0xfffe023a, 0xfffe023a,
+    0x01fe023a, 0x01fe023a, 0x01fe023a, 0x01fe023a, 0xfefe023a, 0xfefe023a, 0xfefe023a, 0xfefe023a,
+    0x0000fd14, 0x0000fd14, 0x0000fd14, 0x0000fd14, 0x000afd2c, 0x00f5fd2c, 0x000bfd2c, 0x00f4fd2c,
+    0x0008fd2b, 0x0008fd2b, 0x00f7fd2b, 0x00f7fd2b, 0x0009fd2b, 0x0009fd2b, 0x00f6fd2b, 0x00f6fd2b,
+    0x0006fd2a, 0x0006fd2a, 0x0006fd2a, 0x0006fd2a, 0x00f9fd2a, 0x00f9fd2a, 0x00f9fd2a, 0x00f9fd2a,
+    0x0007fd2a, 0x0007fd2a, 0x0007fd2a, 0x0007fd2a, 0x00f8fd2a, 0x00f8fd2a, 0x00f8fd2a, 0x00f8fd2a,
+    0x0004fd29, 0x0004fd29, 0x0004fd29, 0x0004fd29, 0x0004fd3c, 0xff04fd3c, 0x0104fd3c, 0xfe04fd3c,
+    0x00fbfd29, 0x00fbfd29, 0x00fbfd29, 0x00fbfd29, 0x00fbfd3c, 0xfffbfd3c, 0x01fbfd3c, 0xfefbfd3c,
+    0x0005fd29, 0x0005fd29, 0x0005fd29, 0x0005fd29, 0x0005fd3c, 0xff05fd3c, 0x0105fd3c, 0xfe05fd3c,
+    0x00fafd29, 0x00fafd29, 0x00fafd29, 0x00fafd29, 0x00fafd3c, 0xfffafd3c, 0x01fafd3c, 0xfefafd3c,
+    0x0002fd28, 0x0002fd28, 0x0002fd28, 0x0002fd28, 0x0202fd3c, 0xfd02fd3c, 0x0302fd3c, 0xfc02fd3c,
+    0x0002fd3b, 0x0002fd3b, 0xff02fd3b, 0xff02fd3b, 0x0102fd3b, 0x0102fd3b, 0xfe02fd3b, 0xfe02fd3b,
+    0x00fdfd28, 0x00fdfd28, 0x00fdfd28, 0x00fdfd28, 0x02fdfd3c, 0xfdfdfd3c, 0x03fdfd3c, 0xfcfdfd3c,
+    0x00fdfd3b, 0x00fdfd3b, 0xfffdfd3b, 0xfffdfd3b, 0x01fdfd3b, 0x01fdfd3b, 0xfefdfd3b, 0xfefdfd3b,
+    0x0003fd28, 0x0003fd28, 0x0003fd28, 0x0003fd28, 0x0203fd3c, 0xfd03fd3c, 0x0303fd3c, 0xfc03fd3c,
+    0x0003fd3b, 0x0003fd3b, 0xff03fd3b, 0xff03fd3b, 0x0103fd3b, 0x0103fd3b, 0xfe03fd3b, 0xfe03fd3b,
+    0x00fcfd28, 0x00fcfd28, 0x00fcfd28, 0x00fcfd28, 0x02fcfd3c, 0xfdfcfd3c, 0x03fcfd3c, 0xfcfcfd3c,
+    0x00fcfd3b, 0x00fcfd3b, 0xfffcfd3b, 0xfffcfd3b, 0x01fcfd3b, 0x01fcfd3b, 0xfefcfd3b, 0xfefcfd3b,
+    0x0000fd27, 0x0000fd27, 0x0000fd27, 0x0000fd27, 0x0400fd3c, 0xfb00fd3c, 0x0500fd3c, 0xfa00fd3c,
+    0x0200fd3b, 0x0200fd3b, 0xfd00fd3b, 0xfd00fd3b, 0x0300fd3b, 0x0300fd3b, 0xfc00fd3b, 0xfc00fd3b,
+    0x0000fd3a, 0x0000fd3a, 0x0000fd3a, 0x0000fd3a, 0xff00fd3a, 0xff00fd3a, 0xff00fd3a, 0xff00fd3a,
+    0x0100fd3a, 0x0100fd3a, 0x0100fd3a, 0x0100fd3a, 0xfe00fd3a, 0xfe00fd3a, 0xfe00fd3a, 0xfe00fd3a,
+    0x00fffd27, 0x00fffd27, 0x00fffd27, 0x00fffd27, 0x04fffd3c, 0xfbfffd3c, 0x05fffd3c, 0xfafffd3c,
+    0x02fffd3b, 0x02fffd3b, 0xfdfffd3b, 0xfdfffd3b, 0x03fffd3b, 0x03fffd3b, 0xfcfffd3b, 0xfcfffd3b,
+    0x00fffd3a, 0x00fffd3a, 0x00fffd3a, 0x00fffd3a, 0xfffffd3a, 0xfffffd3a, 0xfffffd3a, 0xfffffd3a,
+    0x01fffd3a, 0x01fffd3a, 0x01fffd3a, 0x01fffd3a, 0xfefffd3a, 0xfefffd3a, 0xfefffd3a, 0xfefffd3a,
+    0x0001fd27, 0x0001fd27, 0x0001fd27, 0x0001fd27, 0x0401fd3c, 0xfb01fd3c, 0x0501fd3c, 0xfa01fd3c,
+    0x0201fd3b, 0x0201fd3b, 0xfd01fd3b, 0xfd01fd3b, 0x0301fd3b, 0x0301fd3b, 0xfc01fd3b, 0xfc01fd3b,
+    0x0001fd3a, 0x0001fd3a, 0x0001fd3a, 0x0001fd3a, 0xff01fd3a, 0xff01fd3a, 0xff01fd3a, 0xff01fd3a,
+    0x0101fd3a, 0x0101fd3a, 0x0101fd3a, 0x0101fd3a, 0xfe01fd3a, 0xfe01fd3a, 0xfe01fd3a, 0xfe01fd3a,
+    0x00fefd27, 0x00fefd27, 0x00fefd27, 0x00fefd27, 0x04fefd3c, 0xfbfefd3c, 0x05fefd3c, 0xfafefd3c,
+    0x02fefd3b, 0x02fefd3b, 0xfdfefd3b, 0xfdfefd3b, 0x03fefd3b, 0x03fefd3b, 0xfcfefd3b, 0xfcfefd3b,
+    0x00fefd3a, 0x00fefd3a, 0x00fefd3a, 0x00fefd3a, 0xfffefd3a, 0xfffefd3a, 0xfffefd3a, 0xfffefd3a,
+    0x01fefd3a, 0x01fefd3a, 0x01fefd3a, 0x01fefd3a, 0xfefefd3a, 0xfefefd3a, 0xfefefd3a, 0xfefefd3a,
+    0x00000314, 0x00000314, 0x00000314, 0x00000314, 0x000a032c, 0x00f5032c, 0x000b032c, 0x00f4032c,
+    0x0008032b, 0x0008032b, 0x00f7032b, 0x00f7032b, 0x0009032b, 0x0009032b, 0x00f6032b, 0x00f6032b,
+    0x0006032a, 0x0006032a, 0x0006032a, 0x0006032a, 0x00f9032a, 0x00f9032a, 0x00f9032a, 0x00f9032a,
+    0x0007032a, 0x0007032a, 0x0007032a, 0x0007032a, 0x00f8032a, 0x00f8032a, 0x00f8032a, 0x00f8032a,
+    0x00040329, 0x00040329, 0x00040329, 0x00040329, 0x0004033c, 0xff04033c, 0x0104033c, 0xfe04033c,
+    0x00fb0329, 0x00fb0329, 0x00fb0329, 0x00fb0329, 0x00fb033c, 0xfffb033c, 0x01fb033c, 0xfefb033c,
+    0x00050329, 0x00050329, 0x00050329, 0x00050329, 0x0005033c, 0xff05033c, 0x0105033c, 0xfe05033c,
+    0x00fa0329, 0x00fa0329, 0x00fa0329, 0x00fa0329, 0x00fa033c, 0xfffa033c, 0x01fa033c, 0xfefa033c,
+    0x00020328, 0x00020328, 0x00020328, 0x00020328, 0x0202033c, 0xfd02033c, 0x0302033c, 0xfc02033c,
+    0x0002033b, 0x0002033b, 0xff02033b, 0xff02033b, 0x0102033b, 0x0102033b, 0xfe02033b, 0xfe02033b,
+    0x00fd0328, 0x00fd0328, 0x00fd0328, 0x00fd0328, 0x02fd033c, 0xfdfd033c, 0x03fd033c, 0xfcfd033c,
+    0x00fd033b, 0x00fd033b, 0xfffd033b, 0xfffd033b, 0x01fd033b, 0x01fd033b, 0xfefd033b, 0xfefd033b,
+    0x00030328, 0x00030328, 0x00030328, 0x00030328, 0x0203033c, 0xfd03033c, 0x0303033c, 0xfc03033c,
+    0x0003033b, 0x0003033b, 0xff03033b, 0xff03033b, 0x0103033b, 0x0103033b, 0xfe03033b, 0xfe03033b,
+    0x00fc0328, 0x00fc0328, 0x00fc0328, 0x00fc0328, 0x02fc033c, 0xfdfc033c, 0x03fc033c, 0xfcfc033c,
+    0x00fc033b, 0x00fc033b, 0xfffc033b, 0xfffc033b, 0x01fc033b, 0x01fc033b, 0xfefc033b, 0xfefc033b,
+    0x00000327, 0x00000327, 0x00000327, 0x00000327, 0x0400033c, 0xfb00033c, 0x0500033c, 0xfa00033c,
+    0x0200033b, 0x0200033b, 0xfd00033b, 0xfd00033b, 0x0300033b, 0x0300033b, 0xfc00033b, 0xfc00033b,
+    0x0000033a, 0x0000033a, 0x0000033a, 0x0000033a, 0xff00033a, 0xff00033a, 0xff00033a, 0xff00033a,
+    0x0100033a, 0x0100033a, 0x0100033a, 0x0100033a, 0xfe00033a, 0xfe00033a, 0xfe00033a, 0xfe00033a,
+    0x00ff0327, 0x00ff0327, 0x00ff0327, 0x00ff0327, 0x04ff033c, 0xfbff033c, 0x05ff033c, 0xfaff033c,
+    0x02ff033b, 0x02ff033b, 0xfdff033b, 0xfdff033b, 0x03ff033b, 0x03ff033b, 0xfcff033b, 0xfcff033b,
+    0x00ff033a, 0x00ff033a, 0x00ff033a, 0x00ff033a, 0xffff033a, 0xffff033a, 0xffff033a, 0xffff033a,
+    0x01ff033a, 0x01ff033a, 0x01ff033a, 0x01ff033a, 0xfeff033a, 0xfeff033a, 0xfeff033a, 0xfeff033a,
+    0x00010327, 0x00010327, 0x00010327, 0x00010327, 0x0401033c, 0xfb01033c, 0x0501033c, 0xfa01033c,
+    0x0201033b, 0x0201033b, 0xfd01033b, 0xfd01033b, 0x0301033b, 0x0301033b, 0xfc01033b, 0xfc01033b,
+    0x0001033a, 0x0001033a, 0x0001033a, 0x0001033a, 0xff01033a, 0xff01033a, 0xff01033a, 0xff01033a,
+    0x0101033a, 0x0101033a, 0x0101033a, 0x0101033a, 0xfe01033a, 0xfe01033a, 0xfe01033a, 0xfe01033a,
+    0x00fe0327, 0x00fe0327, 0x00fe0327, 0x00fe0327, 0x04fe033c, 0xfbfe033c, 0x05fe033c, 0xfafe033c,
+    0x02fe033b, 0x02fe033b, 0xfdfe033b, 0xfdfe033b, 0x03fe033b, 0x03fe033b, 0xfcfe033b, 0xfcfe033b,
+    0x00fe033a, 0x00fe033a, 0x00fe033a, 0x00fe033a, 0xfffe033a, 0xfffe033a, 0xfffe033a, 0xfffe033a,
+    0x01fe033a, 0x01fe033a, 0x01fe033a, 0x01fe033a, 0xfefe033a, 0xfefe033a, 0xfefe033a, 0xfefe033a,
+    0x0000fc14, 0x0000fc14, 0x0000fc14, 0x0000fc14, 0x000afc2c, 0x00f5fc2c, 0x000bfc2c, 0x00f4fc2c,
+    0x0008fc2b, 0x0008fc2b, 0x00f7fc2b, 0x00f7fc2b, 0x0009fc2b, 0x0009fc2b, 0x00f6fc2b, 0x00f6fc2b,
+    0x0006fc2a, 0x0006fc2a, 0x0006fc2a, 0x0006fc2a, 0x00f9fc2a, 0x00f9fc2a, 0x00f9fc2a, 0x00f9fc2a,
+    0x0007fc2a, 0x0007fc2a, 0x0007fc2a, 0x0007fc2a, 0x00f8fc2a, 0x00f8fc2a, 0x00f8fc2a, 0x00f8fc2a,
+    0x0004fc29, 0x0004fc29, 0x0004fc29, 0x0004fc29, 0x0004fc3c, 0xff04fc3c, 0x0104fc3c, 0xfe04fc3c,
+    0x00fbfc29, 0x00fbfc29, 0x00fbfc29, 0x00fbfc29, 0x00fbfc3c, 0xfffbfc3c, 0x01fbfc3c, 0xfefbfc3c,
+    0x0005fc29, 0x0005fc29, 0x0005fc29, 0x0005fc29, 0x0005fc3c, 0xff05fc3c, 0x0105fc3c, 0xfe05fc3c,
+    0x00fafc29, 0x00fafc29, 0x00fafc29, 0x00fafc29, 0x00fafc3c, 0xfffafc3c, 0x01fafc3c, 0xfefafc3c,
+    0x0002fc28, 0x0002fc28, 0x0002fc28, 0x0002fc28, 0x0202fc3c, 0xfd02fc3c, 0x0302fc3c, 0xfc02fc3c,
+    0x0002fc3b, 0x0002fc3b, 0xff02fc3b, 0xff02fc3b, 0x0102fc3b, 0x0102fc3b, 0xfe02fc3b, 0xfe02fc3b,
+    0x00fdfc28, 0x00fdfc28, 0x00fdfc28, 0x00fdfc28, 0x02fdfc3c, 0xfdfdfc3c, 0x03fdfc3c, 0xfcfdfc3c,
+    0x00fdfc3b, 0x00fdfc3b, 0xfffdfc3b, 0xfffdfc3b, 0x01fdfc3b, 0x01fdfc3b, 0xfefdfc3b, 0xfefdfc3b,
+    0x0003fc28, 0x0003fc28, 0x0003fc28, 0x0003fc28, 0x0203fc3c, 0xfd03fc3c, 0x0303fc3c, 0xfc03fc3c,
+    0x0003fc3b, 0x0003fc3b, 0xff03fc3b, 0xff03fc3b, 0x0103fc3b, 0x0103fc3b, 0xfe03fc3b, 0xfe03fc3b,
+    0x00fcfc28, 0x00fcfc28, 0x00fcfc28, 0x00fcfc28, 0x02fcfc3c, 0xfdfcfc3c, 0x03fcfc3c, 0xfcfcfc3c,
+    0x00fcfc3b, 0x00fcfc3b, 0xfffcfc3b, 0xfffcfc3b, 0x01fcfc3b, 0x01fcfc3b, 0xfefcfc3b, 0xfefcfc3b,
+    0x0000fc27, 0x0000fc27, 0x0000fc27, 0x0000fc27, 0x0400fc3c, 0xfb00fc3c, 0x0500fc3c, 0xfa00fc3c,
+    0x0200fc3b, 0x0200fc3b, 0xfd00fc3b, 0xfd00fc3b, 0x0300fc3b, 0x0300fc3b, 0xfc00fc3b, 0xfc00fc3b,
+    0x0000fc3a, 0x0000fc3a, 0x0000fc3a, 0x0000fc3a, 0xff00fc3a, 0xff00fc3a, 0xff00fc3a, 0xff00fc3a,
+    0x0100fc3a, 0x0100fc3a, 0x0100fc3a, 0x0100fc3a, 0xfe00fc3a, 0xfe00fc3a, 0xfe00fc3a, 0xfe00fc3a,
+    0x00fffc27, 0x00fffc27, 0x00fffc27, 0x00fffc27, 0x04fffc3c, 0xfbfffc3c, 0x05fffc3c, 0xfafffc3c,
+    0x02fffc3b, 0x02fffc3b, 0xfdfffc3b, 0xfdfffc3b, 0x03fffc3b, 0x03fffc3b, 0xfcfffc3b, 0xfcfffc3b,
+    0x00fffc3a, 0x00fffc3a, 0x00fffc3a, 0x00fffc3a, 0xfffffc3a, 0xfffffc3a, 0xfffffc3a, 0xfffffc3a,
+    0x01fffc3a, 0x01fffc3a, 0x01fffc3a, 0x01fffc3a, 0xfefffc3a, 0xfefffc3a, 0xfefffc3a, 0xfefffc3a,
+    0x0001fc27, 0x0001fc27, 0x0001fc27, 0x0001fc27, 0x0401fc3c, 0xfb01fc3c, 0x0501fc3c, 0xfa01fc3c,
+    0x0201fc3b, 0x0201fc3b, 0xfd01fc3b, 0xfd01fc3b, 0x0301fc3b, 0x0301fc3b, 0xfc01fc3b, 0xfc01fc3b,
+    0x0001fc3a, 0x0001fc3a, 0x0001fc3a, 0x0001fc3a, 0xff01fc3a, 0xff01fc3a, 0xff01fc3a, 0xff01fc3a,
+    0x0101fc3a, 0x0101fc3a, 0x0101fc3a, 0x0101fc3a, 0xfe01fc3a, 0xfe01fc3a, 0xfe01fc3a, 0xfe01fc3a,
+    0x00fefc27, 0x00fefc27, 0x00fefc27, 0x00fefc27, 0x04fefc3c, 0xfbfefc3c, 0x05fefc3c, 0xfafefc3c,
+    0x02fefc3b, 0x02fefc3b, 0xfdfefc3b, 0xfdfefc3b, 0x03fefc3b, 0x03fefc3b, 0xfcfefc3b, 0xfcfefc3b,
+    0x00fefc3a, 0x00fefc3a, 0x00fefc3a, 0x00fefc3a, 0xfffefc3a, 0xfffefc3a, 0xfffefc3a, 0xfffefc3a,
+    0x01fefc3a, 0x01fefc3a, 0x01fefc3a, 0x01fefc3a, 0xfefefc3a, 0xfefefc3a, 0xfefefc3a, 0xfefefc3a,
+    0x00000013, 0x00000013, 0x00000013, 0x00000013, 0x000c002c, 0x00f3002c, 0x000d002c, 0x00f2002c,
+    0x000a002b, 0x000a002b, 0x00f5002b, 0x00f5002b, 0x000b002b, 0x000b002b, 0x00f4002b, 0x00f4002b,
+    0x0008002a, 0x0008002a, 0x0008002a, 0x0008002a, 0x00f7002a, 0x00f7002a, 0x00f7002a, 0x00f7002a,
+    0x0009002a, 0x0009002a, 0x0009002a, 0x0009002a, 0x00f6002a, 0x00f6002a, 0x00f6002a, 0x00f6002a,
+    0x00060029, 0x00060029, 0x00060029, 0x00060029, 0x0006003c, 0xff06003c, 0x0106003c, 0xfe06003c,
+    0x00f90029, 0x00f90029, 0x00f90029, 0x00f90029, 0x00f9003c, 0xfff9003c, 0x01f9003c, 0xfef9003c,
+    0x00070029, 0x00070029, 0x00070029, 0x00070029, 0x0007003c, 0xff07003c, 0x0107003c, 0xfe07003c,
+    0x00f80029, 0x00f80029, 0x00f80029, 0x00f80029, 0x00f8003c, 0xfff8003c, 0x01f8003c, 0xfef8003c,
+    0x00040028, 0x00040028, 0x00040028, 0x00040028, 0x0204003c, 0xfd04003c, 0x0304003c, 0xfc04003c,
+    0x0004003b, 0x0004003b, 0xff04003b, 0xff04003b, 0x0104003b, 0x0104003b, 0xfe04003b, 0xfe04003b,
+    0x00fb0028, 0x00fb0028, 0x00fb0028, 0x00fb0028, 0x02fb003c, 0xfdfb003c, 0x03fb003c, 0xfcfb003c,
+    0x00fb003b, 0x00fb003b, 0xfffb003b, 0xfffb003b, 0x01fb003b, 0x01fb003b, 0xfefb003b, 0xfefb003b,
+    0x00050028, 0x00050028, 0x00050028, 0x00050028, 0x0205003c, 0xfd05003c, 0x0305003c, 0xfc05003c,
+    0x0005003b, 0x0005003b, 0xff05003b, 0xff05003b, 0x0105003b, 0x0105003b, 0xfe05003b, 0xfe05003b,
+    0x00fa0028, 0x00fa0028, 0x00fa0028, 0x00fa0028, 0x02fa003c, 0xfdfa003c, 0x03fa003c, 0xfcfa003c,
+    0x00fa003b, 0x00fa003b, 0xfffa003b, 0xfffa003b, 0x01fa003b, 0x01fa003b, 0xfefa003b, 0xfefa003b,
+    0x00020027, 0x00020027, 0x00020027, 0x00020027, 0x0402003c, 0xfb02003c, 0x0502003c, 0xfa02003c,
+    0x0202003b, 0x0202003b, 0xfd02003b, 0xfd02003b, 0x0302003b, 0x0302003b, 0xfc02003b, 0xfc02003b,
+    0x0002003a, 0x0002003a, 0x0002003a, 0x0002003a, 0xff02003a, 0xff02003a, 0xff02003a, 0xff02003a,
+    0x0102003a, 0x0102003a, 0x0102003a, 0x0102003a, 0xfe02003a, 0xfe02003a, 0xfe02003a, 0xfe02003a,
+    0x00fd0027, 0x00fd0027, 0x00fd0027, 0x00fd0027, 0x04fd003c, 0xfbfd003c, 0x05fd003c, 0xfafd003c,
+    0x02fd003b, 0x02fd003b, 0xfdfd003b, 0xfdfd003b, 0x03fd003b, 0x03fd003b, 0xfcfd003b, 0xfcfd003b,
+    0x00fd003a, 0x00fd003a, 0x00fd003a, 0x00fd003a, 0xfffd003a, 0xfffd003a, 0xfffd003a, 0xfffd003a,
+    0x01fd003a, 0x01fd003a, 0x01fd003a, 0x01fd003a, 0xfefd003a, 0xfefd003a, 0xfefd003a, 0xfefd003a,
+    0x00030027, 0x00030027, 0x00030027, 0x00030027, 0x0403003c, 0xfb03003c, 0x0503003c, 0xfa03003c,
+    0x0203003b, 0x0203003b, 0xfd03003b, 0xfd03003b, 0x0303003b, 0x0303003b, 0xfc03003b, 0xfc03003b,
+    0x0003003a, 0x0003003a, 0x0003003a, 0x0003003a, 0xff03003a, 0xff03003a, 0xff03003a, 0xff03003a,
+    0x0103003a, 0x0103003a, 0x0103003a, 0x0103003a, 0xfe03003a, 0xfe03003a, 0xfe03003a, 0xfe03003a,
+    0x00fc0027, 0x00fc0027, 0x00fc0027, 0x00fc0027, 0x04fc003c, 0xfbfc003c, 0x05fc003c, 0xfafc003c,
+    0x02fc003b, 0x02fc003b, 0xfdfc003b, 0xfdfc003b, 0x03fc003b, 0x03fc003b, 0xfcfc003b, 0xfcfc003b,
+    0x00fc003a, 0x00fc003a, 0x00fc003a, 0x00fc003a, 0xfffc003a, 0xfffc003a, 0xfffc003a, 0xfffc003a,
+    0x01fc003a, 0x01fc003a, 0x01fc003a, 0x01fc003a, 0xfefc003a, 0xfefc003a, 0xfefc003a, 0xfefc003a,
+    0x00000026, 0x00000026, 0x00000026, 0x00000026, 0x0600003c, 0xf900003c, 0x0700003c, 0xf800003c,
+    0x0400003b, 0x0400003b, 0xfb00003b, 0xfb00003b, 0x0500003b, 0x0500003b, 0xfa00003b, 0xfa00003b,
+    0x0200003a, 0x0200003a, 0x0200003a, 0x0200003a, 0xfd00003a, 0xfd00003a, 0xfd00003a, 0xfd00003a,
+    0x0300003a, 0x0300003a, 0x0300003a, 0x0300003a, 0xfc00003a, 0xfc00003a, 0xfc00003a, 0xfc00003a,
+    0x00000039, 0x00000039, 0x00000039, 0x00000039, 0x00000039, 0x00000039, 0x00000039, 0x00000039,
+    0xff000039, 0xff000039, 0xff000039, 0xff000039, 0xff000039, 0xff000039, 0xff000039, 0xff000039,
+    0x01000039, 0x01000039, 0x01000039, 0x01000039, 0x01000039, 0x01000039, 0x01000039, 0x01000039,
+    0xfe000039, 0xfe000039, 0xfe000039, 0xfe000039, 0xfe000039, 0xfe000039, 0xfe000039, 0xfe000039,
+    0x00ff0026, 0x00ff0026, 0x00ff0026, 0x00ff0026, 0x06ff003c, 0xf9ff003c, 0x07ff003c, 0xf8ff003c,
+    0x04ff003b, 0x04ff003b, 0xfbff003b, 0xfbff003b, 0x05ff003b, 0x05ff003b, 0xfaff003b, 0xfaff003b,
+    0x02ff003a, 0x02ff003a, 0x02ff003a, 0x02ff003a, 0xfdff003a, 0xfdff003a, 0xfdff003a, 0xfdff003a,
+    0x03ff003a, 0x03ff003a, 0x03ff003a, 0x03ff003a, 0xfcff003a, 0xfcff003a, 0xfcff003a, 0xfcff003a,
+    0x00ff0039, 0x00ff0039, 0x00ff0039, 0x00ff0039, 0x00ff0039, 0x00ff0039, 0x00ff0039, 0x00ff0039,
+    0xffff0039, 0xffff0039, 0xffff0039, 0xffff0039, 0xffff0039, 0xffff0039, 0xffff0039, 0xffff0039,
+    0x01ff0039, 0x01ff0039, 0x01ff0039, 0x01ff0039, 0x01ff0039, 0x01ff0039, 0x01ff0039, 0x01ff0039,
+    0xfeff0039, 0xfeff0039, 0xfeff0039, 0xfeff0039, 0xfeff0039, 0xfeff0039, 0xfeff0039, 0xfeff0039,
+    0x00010026, 0x00010026, 0x00010026, 0x00010026, 0x0601003c, 0xf901003c, 0x0701003c, 0xf801003c,
+    0x0401003b, 0x0401003b, 0xfb01003b, 0xfb01003b, 0x0501003b, 0x0501003b, 0xfa01003b, 0xfa01003b,
+    0x0201003a, 0x0201003a, 0x0201003a, 0x0201003a, 0xfd01003a, 0xfd01003a, 0xfd01003a, 0xfd01003a,
+    0x0301003a, 0x0301003a, 0x0301003a, 0x0301003a, 0xfc01003a, 0xfc01003a, 0xfc01003a, 0xfc01003a,
+    0x00010039, 0x00010039, 0x00010039, 0x00010039, 0x00010039, 0x00010039, 0x00010039, 0x00010039,
+    0xff010039, 0xff010039, 0xff010039, 0xff010039, 0xff010039, 0xff010039, 0xff010039, 0xff010039,
+    0x01010039, 0x01010039, 0x01010039, 0x01010039, 0x01010039, 0x01010039, 0x01010039, 0x01010039,
+    0xfe010039, 0xfe010039, 0xfe010039, 0xfe010039, 0xfe010039, 0xfe010039, 0xfe010039, 0xfe010039,
+    0x00fe0026, 0x00fe0026, 0x00fe0026, 0x00fe0026, 0x06fe003c, 0xf9fe003c, 0x07fe003c, 0xf8fe003c,
+    0x04fe003b, 0x04fe003b, 0xfbfe003b, 0xfbfe003b, 0x05fe003b, 0x05fe003b, 0xfafe003b, 0xfafe003b,
+    0x02fe003a, 0x02fe003a, 0x02fe003a, 0x02fe003a, 0xfdfe003a, 0xfdfe003a, 0xfdfe003a, 0xfdfe003a,
+    0x03fe003a, 0x03fe003a, 0x03fe003a, 0x03fe003a, 0xfcfe003a, 0xfcfe003a, 0xfcfe003a, 0xfcfe003a,
+    0x00fe0039, 0x00fe0039, 0x00fe0039, 0x00fe0039, 0x00fe0039, 0x00fe0039, 0x00fe0039, 0x00fe0039,
+    0xfffe0039, 0xfffe0039, 0xfffe0039, 0xfffe0039, 0xfffe0039, 0xfffe0039, 0xfffe0039, 0xfffe0039,
+    0x01fe0039, 0x01fe0039, 0x01fe0039, 0x01fe0039, 0x01fe0039, 0x01fe0039, 0x01fe0039, 0x01fe0039,
+    0xfefe0039, 0xfefe0039, 0xfefe0039, 0xfefe0039, 0xfefe0039, 0xfefe0039, 0xfefe0039, 0xfefe0039,
+    0x0000ff13, 0x0000ff13, 0x0000ff13, 0x0000ff13, 0x000cff2c, 0x00f3ff2c, 0x000dff2c, 0x00f2ff2c,
+    0x000aff2b, 0x000aff2b, 0x00f5ff2b, 0x00f5ff2b, 0x000bff2b, 0x000bff2b, 0x00f4ff2b, 0x00f4ff2b,
+    0x0008ff2a, 0x0008ff2a, 0x0008ff2a, 0x0008ff2a, 0x00f7ff2a, 0x00f7ff2a, 0x00f7ff2a, 0x00f7ff2a,
+    0x0009ff2a, 0x0009ff2a, 0x0009ff2a, 0x0009ff2a, 0x00f6ff2a, 0x00f6ff2a, 0x00f6ff2a, 0x00f6ff2a,
+    0x0006ff29, 0x0006ff29, 0x0006ff29, 0x0006ff29, 0x0006ff3c, 0xff06ff3c, 0x0106ff3c, 0xfe06ff3c,
+    0x00f9ff29, 0x00f9ff29, 0x00f9ff29, 0x00f9ff29, 0x00f9ff3c, 0xfff9ff3c, 0x01f9ff3c, 0xfef9ff3c,
+    0x0007ff29, 0x0007ff29, 0x0007ff29, 0x0007ff29, 0x0007ff3c, 0xff07ff3c, 0x0107ff3c, 0xfe07ff3c,
+    0x00f8ff29, 0x00f8ff29, 0x00f8ff29, 0x00f8ff29, 0x00f8ff3c, 0xfff8ff3c, 0x01f8ff3c, 0xfef8ff3c,
+    0x0004ff28, 0x0004ff28, 0x0004ff28, 0x0004ff28, 0x0204ff3c, 0xfd04ff3c, 0x0304ff3c, 0xfc04ff3c,
+    0x0004ff3b, 0x0004ff3b, 0xff04ff3b, 0xff04ff3b, 0x0104ff3b, 0x0104ff3b, 0xfe04ff3b, 0xfe04ff3b,
+    0x00fbff28, 0x00fbff28, 0x00fbff28, 0x00fbff28, 0x02fbff3c, 0xfdfbff3c, 0x03fbff3c, 0xfcfbff3c,
+    0x00fbff3b, 0x00fbff3b, 0xfffbff3b, 0xfffbff3b, 0x01fbff3b, 0x01fbff3b, 0xfefbff3b, 0xfefbff3b,
+    0x0005ff28, 0x0005ff28, 0x0005ff28, 0x0005ff28, 0x0205ff3c, 0xfd05ff3c, 0x0305ff3c, 0xfc05ff3c,
+    0x0005ff3b, 0x0005ff3b, 0xff05ff3b, 0xff05ff3b, 0x0105ff3b, 0x0105ff3b, 0xfe05ff3b, 0xfe05ff3b,
+    0x00faff28, 0x00faff28, 0x00faff28, 0x00faff28, 0x02faff3c, 0xfdfaff3c, 0x03faff3c, 0xfcfaff3c,
+    0x00faff3b, 0x00faff3b, 0xfffaff3b, 0xfffaff3b, 0x01faff3b, 0x01faff3b, 0xfefaff3b, 0xfefaff3b,
+    0x0002ff27, 0x0002ff27, 0x0002ff27, 0x0002ff27, 0x0402ff3c, 0xfb02ff3c, 0x0502ff3c, 0xfa02ff3c,
+    0x0202ff3b, 0x0202ff3b, 0xfd02ff3b, 0xfd02ff3b, 0x0302ff3b, 0x0302ff3b, 0xfc02ff3b, 0xfc02ff3b,
+    0x0002ff3a, 0x0002ff3a, 0x0002ff3a, 0x0002ff3a, 0xff02ff3a, 0xff02ff3a, 0xff02ff3a, 0xff02ff3a,
+    0x0102ff3a, 0x0102ff3a, 0x0102ff3a, 0x0102ff3a, 0xfe02ff3a, 0xfe02ff3a, 0xfe02ff3a, 0xfe02ff3a,
+    0x00fdff27, 0x00fdff27, 0x00fdff27, 0x00fdff27, 0x04fdff3c, 0xfbfdff3c, 0x05fdff3c, 0xfafdff3c,
+    0x02fdff3b, 0x02fdff3b, 0xfdfdff3b, 0xfdfdff3b, 0x03fdff3b, 0x03fdff3b, 0xfcfdff3b, 0xfcfdff3b,
+    0x00fdff3a, 0x00fdff3a, 0x00fdff3a, 0x00fdff3a, 0xfffdff3a, 0xfffdff3a, 0xfffdff3a, 0xfffdff3a,
+    0x01fdff3a, 0x01fdff3a, 0x01fdff3a, 0x01fdff3a, 0xfefdff3a, 0xfefdff3a, 0xfefdff3a, 0xfefdff3a,
+    0x0003ff27, 0x0003ff27, 0x0003ff27, 0x0003ff27, 0x0403ff3c, 0xfb03ff3c, 0x0503ff3c, 0xfa03ff3c,
+    0x0203ff3b, 0x0203ff3b, 0xfd03ff3b, 0xfd03ff3b, 0x0303ff3b, 0x0303ff3b, 0xfc03ff3b, 0xfc03ff3b,
+    0x0003ff3a, 0x0003ff3a, 0x0003ff3a, 0x0003ff3a, 0xff03ff3a, 0xff03ff3a, 0xff03ff3a, 0xff03ff3a,
+    0x0103ff3a, 0x0103ff3a, 0x0103ff3a, 0x0103ff3a, 0xfe03ff3a, 0xfe03ff3a, 0xfe03ff3a, 0xfe03ff3a,
+    0x00fcff27, 0x00fcff27, 0x00fcff27, 0x00fcff27, 0x04fcff3c, 0xfbfcff3c, 0x05fcff3c, 0xfafcff3c,
+    0x02fcff3b, 0x02fcff3b, 0xfdfcff3b, 0xfdfcff3b, 0x03fcff3b, 0x03fcff3b, 0xfcfcff3b, 0xfcfcff3b,
+    0x00fcff3a, 0x00fcff3a, 0x00fcff3a, 0x00fcff3a, 0xfffcff3a, 0xfffcff3a, 0xfffcff3a, 0xfffcff3a,
+    0x01fcff3a, 0x01fcff3a, 0x01fcff3a, 0x01fcff3a, 0xfefcff3a, 0xfefcff3a, 0xfefcff3a, 0xfefcff3a,
+    0x0000ff26, 0x0000ff26, 0x0000ff26, 0x0000ff26, 0x0600ff3c, 0xf900ff3c, 0x0700ff3c, 0xf800ff3c,
+    0x0400ff3b, 0x0400ff3b, 0xfb00ff3b, 0xfb00ff3b, 0x0500ff3b, 0x0500ff3b, 0xfa00ff3b, 0xfa00ff3b,
+    0x0200ff3a, 0x0200ff3a, 0x0200ff3a, 0x0200ff3a, 0xfd00ff3a, 0xfd00ff3a, 0xfd00ff3a, 0xfd00ff3a,
+    0x0300ff3a, 0x0300ff3a, 0x0300ff3a, 0x0300ff3a, 0xfc00ff3a, 0xfc00ff3a, 0xfc00ff3a, 0xfc00ff3a,
+    0x0000ff39, 0x0000ff39, 0x0000ff39, 0x0000ff39, 0x0000ff39, 0x0000ff39, 0x0000ff39, 0x0000ff39,
+    0xff00ff39, 0xff00ff39, 0xff00ff39, 0xff00ff39, 0xff00ff39, 0xff00ff39, 0xff00ff39, 0xff00ff39,
+    0x0100ff39, 0x0100ff39, 0x0100ff39, 0x0100ff39, 0x0100ff39, 0x0100ff39, 0x0100ff39, 0x0100ff39,
+    0xfe00ff39, 0xfe00ff39, 0xfe00ff39, 0xfe00ff39, 0xfe00ff39, 0xfe00ff39, 0xfe00ff39, 0xfe00ff39,
+    0x00ffff26, 0x00ffff26, 0x00ffff26, 0x00ffff26, 0x06ffff3c, 0xf9ffff3c, 0x07ffff3c, 0xf8ffff3c,
+    0x04ffff3b, 0x04ffff3b, 0xfbffff3b, 0xfbffff3b, 0x05ffff3b, 0x05ffff3b, 0xfaffff3b, 0xfaffff3b,
+    0x02ffff3a, 0x02ffff3a, 0x02ffff3a, 0x02ffff3a, 0xfdffff3a, 0xfdffff3a, 0xfdffff3a, 0xfdffff3a,
+    0x03ffff3a, 0x03ffff3a, 0x03ffff3a, 0x03ffff3a, 0xfcffff3a, 0xfcffff3a, 0xfcffff3a, 0xfcffff3a,
+    0x00ffff39, 0x00ffff39, 0x00ffff39, 0x00ffff39, 0x00ffff39, 0x00ffff39, 0x00ffff39, 0x00ffff39,
+    0xffffff39, 0xffffff39, 0xffffff39, 0xffffff39, 0xffffff39, 0xffffff39, 0xffffff39, 0xffffff39,
+    0x01ffff39, 0x01ffff39, 0x01ffff39, 0x01ffff39, 0x01ffff39, 0x01ffff39, 0x01ffff39, 0x01ffff39,
+    0xfeffff39, 0xfeffff39, 0xfeffff39, 0xfeffff39, 0xfeffff39, 0xfeffff39, 0xfeffff39, 0xfeffff39,
+    0x0001ff26, 0x0001ff26, 0x0001ff26, 0x0001ff26, 0x0601ff3c, 0xf901ff3c, 0x0701ff3c, 0xf801ff3c,
+    0x0401ff3b, 0x0401ff3b, 0xfb01ff3b, 0xfb01ff3b, 0x0501ff3b, 0x0501ff3b, 0xfa01ff3b, 0xfa01ff3b,
+    0x0201ff3a, 0x0201ff3a, 0x0201ff3a, 0x0201ff3a, 0xfd01ff3a, 0xfd01ff3a, 0xfd01ff3a, 0xfd01ff3a,
+    0x0301ff3a, 0x0301ff3a, 0x0301ff3a, 0x0301ff3a, 0xfc01ff3a, 0xfc01ff3a, 0xfc01ff3a, 0xfc01ff3a,
+    0x0001ff39, 0x0001ff39, 0x0001ff39, 0x0001ff39, 0x0001ff39, 0x0001ff39, 0x0001ff39, 0x0001ff39,
+    0xff01ff39, 0xff01ff39, 0xff01ff39, 0xff01ff39, 0xff01ff39, 0xff01ff39, 0xff01ff39, 0xff01ff39,
+    0x0101ff39, 0x0101ff39, 0x0101ff39, 0x0101ff39, 0x0101ff39, 0x0101ff39, 0x0101ff39, 0x0101ff39,
+    0xfe01ff39, 0xfe01ff39, 0xfe01ff39, 0xfe01ff39, 0xfe01ff39, 0xfe01ff39, 0xfe01ff39, 0xfe01ff39,
+    0x00feff26, 0x00feff26, 0x00feff26, 0x00feff26, 0x06feff3c, 0xf9feff3c, 0x07feff3c, 0xf8feff3c,
+    0x04feff3b, 0x04feff3b, 0xfbfeff3b, 0xfbfeff3b, 0x05feff3b, 0x05feff3b, 0xfafeff3b, 0xfafeff3b,
+    0x02feff3a, 0x02feff3a, 0x02feff3a, 0x02feff3a, 0xfdfeff3a, 0xfdfeff3a, 0xfdfeff3a, 0xfdfeff3a,
+    0x03feff3a, 0x03feff3a, 0x03feff3a, 0x03feff3a, 0xfcfeff3a, 0xfcfeff3a, 0xfcfeff3a, 0xfcfeff3a,
+    0x00feff39, 0x00feff39, 0x00feff39, 0x00feff39, 0x00feff39, 0x00feff39, 0x00feff39, 0x00feff39,
+    0xfffeff39, 0xfffeff39, 0xfffeff39, 0xfffeff39, 0xfffeff39, 0xfffeff39, 0xfffeff39, 0xfffeff39,
+    0x01feff39, 0x01feff39, 0x01feff39, 0x01feff39, 0x01feff39, 0x01feff39, 0x01feff39, 0x01feff39,
+    0xfefeff39, 0xfefeff39, 0xfefeff39, 0xfefeff39, 0xfefeff39, 0xfefeff39, 0xfefeff39, 0xfefeff39,
+    0x00000113, 0x00000113, 0x00000113, 0x00000113, 0x000c012c, 0x00f3012c, 0x000d012c, 0x00f2012c,
+    0x000a012b, 0x000a012b, 0x00f5012b, 0x00f5012b, 0x000b012b, 0x000b012b, 0x00f4012b, 0x00f4012b,
+    0x0008012a, 0x0008012a, 0x0008012a, 0x0008012a, 0x00f7012a, 0x00f7012a, 0x00f7012a, 0x00f7012a,
+    0x0009012a, 0x0009012a, 0x0009012a, 0x0009012a, 0x00f6012a, 0x00f6012a, 0x00f6012a, 0x00f6012a,
+    0x00060129, 0x00060129, 0x00060129, 0x00060129, 0x0006013c, 0xff06013c, 0x0106013c, 0xfe06013c,
+    0x00f90129, 0x00f90129, 0x00f90129, 0x00f90129, 0x00f9013c, 0xfff9013c, 0x01f9013c, 0xfef9013c,
+    0x00070129, 0x00070129, 0x00070129, 0x00070129, 0x0007013c, 0xff07013c, 0x0107013c, 0xfe07013c,
+    0x00f80129, 0x00f80129, 0x00f80129, 0x00f80129, 0x00f8013c, 0xfff8013c, 0x01f8013c, 0xfef8013c,
+    0x00040128, 0x00040128, 0x00040128, 0x00040128, 0x0204013c, 0xfd04013c, 0x0304013c, 0xfc04013c,
+    0x0004013b, 0x0004013b, 0xff04013b, 0xff04013b, 0x0104013b, 0x0104013b, 0xfe04013b, 0xfe04013b,
+    0x00fb0128, 0x00fb0128, 0x00fb0128, 0x00fb0128, 0x02fb013c, 0xfdfb013c, 0x03fb013c, 0xfcfb013c,
+    0x00fb013b, 0x00fb013b, 0xfffb013b, 0xfffb013b, 0x01fb013b, 0x01fb013b, 0xfefb013b, 0xfefb013b,
+    0x00050128, 0x00050128, 0x00050128, 0x00050128, 0x0205013c, 0xfd05013c, 0x0305013c, 0xfc05013c,
+    0x0005013b, 0x0005013b, 0xff05013b, 0xff05013b, 0x0105013b, 0x0105013b, 0xfe05013b, 0xfe05013b,
+    0x00fa0128, 0x00fa0128, 0x00fa0128, 0x00fa0128, 0x02fa013c, 0xfdfa013c, 0x03fa013c, 0xfcfa013c,
+    0x00fa013b, 0x00fa013b, 0xfffa013b, 0xfffa013b, 0x01fa013b, 0x01fa013b, 0xfefa013b, 0xfefa013b,
+    0x00020127, 0x00020127, 0x00020127, 0x00020127, 0x0402013c, 0xfb02013c, 0x0502013c, 0xfa02013c,
+    0x0202013b, 0x0202013b, 0xfd02013b, 0xfd02013b, 0x0302013b, 0x0302013b, 0xfc02013b, 0xfc02013b,
+    0x0002013a, 0x0002013a, 0x0002013a, 0x0002013a, 0xff02013a, 0xff02013a, 0xff02013a, 0xff02013a,
+    0x0102013a, 0x0102013a, 0x0102013a, 0x0102013a, 0xfe02013a, 0xfe02013a, 0xfe02013a, 0xfe02013a,
+    0x00fd0127, 0x00fd0127, 0x00fd0127, 0x00fd0127, 0x04fd013c, 0xfbfd013c, 0x05fd013c, 0xfafd013c,
+    0x02fd013b, 0x02fd013b, 0xfdfd013b, 0xfdfd013b, 0x03fd013b, 0x03fd013b, 0xfcfd013b, 0xfcfd013b,
+    0x00fd013a, 0x00fd013a, 0x00fd013a, 0x00fd013a, 0xfffd013a, 0xfffd013a, 0xfffd013a, 0xfffd013a,
+    0x01fd013a, 0x01fd013a, 0x01fd013a, 0x01fd013a, 0xfefd013a, 0xfefd013a, 0xfefd013a, 0xfefd013a,
+    0x00030127, 0x00030127, 0x00030127, 0x00030127, 0x0403013c, 0xfb03013c, 0x0503013c, 0xfa03013c,
+    0x0203013b, 0x0203013b, 0xfd03013b, 0xfd03013b, 0x0303013b, 0x0303013b, 0xfc03013b, 0xfc03013b,
+    0x0003013a, 0x0003013a, 0x0003013a, 0x0003013a, 0xff03013a, 0xff03013a, 0xff03013a, 0xff03013a,
+    0x0103013a, 0x0103013a, 0x0103013a, 0x0103013a, 0xfe03013a, 0xfe03013a, 0xfe03013a, 0xfe03013a,
+    0x00fc0127, 0x00fc0127, 0x00fc0127, 0x00fc0127, 0x04fc013c, 0xfbfc013c, 0x05fc013c, 0xfafc013c,
+    0x02fc013b, 0x02fc013b, 0xfdfc013b, 0xfdfc013b, 0x03fc013b, 0x03fc013b, 0xfcfc013b, 0xfcfc013b,
+    0x00fc013a, 0x00fc013a, 0x00fc013a, 0x00fc013a, 0xfffc013a, 0xfffc013a, 0xfffc013a, 0xfffc013a,
+    0x01fc013a, 0x01fc013a, 0x01fc013a, 0x01fc013a, 0xfefc013a, 0xfefc013a, 0xfefc013a, 0xfefc013a,
+    0x00000126, 0x00000126, 0x00000126, 0x00000126, 0x0600013c, 0xf900013c, 0x0700013c, 0xf800013c,
+    0x0400013b, 0x0400013b, 0xfb00013b, 0xfb00013b, 0x0500013b, 0x0500013b, 0xfa00013b, 0xfa00013b,
+    0x0200013a, 0x0200013a, 0x0200013a, 0x0200013a, 0xfd00013a, 0xfd00013a, 0xfd00013a, 0xfd00013a,
+    0x0300013a, 0x0300013a, 0x0300013a, 0x0300013a, 0xfc00013a, 0xfc00013a, 0xfc00013a, 0xfc00013a,
+    0x00000139, 0x00000139, 0x00000139, 0x00000139, 0x00000139, 0x00000139, 0x00000139, 0x00000139,
+    0xff000139, 0xff000139, 0xff000139, 0xff000139, 0xff000139, 0xff000139, 0xff000139, 0xff000139,
+    0x01000139, 0x01000139, 0x01000139, 0x01000139, 0x01000139, 0x01000139, 0x01000139, 0x01000139,
+    0xfe000139, 0xfe000139, 0xfe000139, 0xfe000139, 0xfe000139, 0xfe000139, 0xfe000139, 0xfe000139,
+    0x00ff0126, 0x00ff0126, 0x00ff0126, 0x00ff0126, 0x06ff013c, 0xf9ff013c, 0x07ff013c, 0xf8ff013c,
+    0x04ff013b, 0x04ff013b, 0xfbff013b, 0xfbff013b, 0x05ff013b, 0x05ff013b, 0xfaff013b, 0xfaff013b,
+    0x02ff013a, 0x02ff013a, 0x02ff013a, 0x02ff013a, 0xfdff013a, 0xfdff013a, 0xfdff013a, 0xfdff013a,
+    0x03ff013a, 0x03ff013a, 0x03ff013a, 0x03ff013a, 0xfcff013a, 0xfcff013a, 0xfcff013a, 0xfcff013a,
+    0x00ff0139, 0x00ff0139, 0x00ff0139, 0x00ff0139, 0x00ff0139, 0x00ff0139, 0x00ff0139, 0x00ff0139,
+    0xffff0139, 0xffff0139, 0xffff0139, 0xffff0139, 0xffff0139, 0xffff0139, 0xffff0139, 0xffff0139,
+    0x01ff0139, 0x01ff0139, 0x01ff0139, 0x01ff0139, 0x01ff0139, 0x01ff0139, 0x01ff0139, 0x01ff0139,
+    0xfeff0139, 0xfeff0139, 0xfeff0139, 0xfeff0139, 0xfeff0139, 0xfeff0139, 0xfeff0139, 0xfeff0139,
+    0x00010126, 0x00010126, 0x00010126, 0x00010126, 0x0601013c, 0xf901013c, 0x0701013c, 0xf801013c,
+    0x0401013b, 0x0401013b, 0xfb01013b, 0xfb01013b, 0x0501013b, 0x0501013b, 0xfa01013b, 0xfa01013b,
+    0x0201013a, 0x0201013a, 0x0201013a, 0x0201013a, 0xfd01013a, 0xfd01013a, 0xfd01013a, 0xfd01013a,
+    0x0301013a, 0x0301013a, 0x0301013a, 0x0301013a, 0xfc01013a, 0xfc01013a, 0xfc01013a, 0xfc01013a,
+    0x00010139, 0x00010139, 0x00010139, 0x00010139, 0x00010139, 0x00010139, 0x00010139, 0x00010139,
+    0xff010139, 0xff010139, 0xff010139, 0xff010139, 0xff010139, 0xff010139, 0xff010139, 0xff010139,
+    0x01010139, 0x01010139, 0x01010139, 0x01010139, 0x01010139, 0x01010139, 0x01010139, 0x01010139,
+    0xfe010139, 0xfe010139, 0xfe010139, 0xfe010139, 0xfe010139, 0xfe010139, 0xfe010139, 0xfe010139,
+    0x00fe0126, 0x00fe0126, 0x00fe0126, 0x00fe0126, 0x06fe013c, 0xf9fe013c, 0x07fe013c, 0xf8fe013c,
+    0x04fe013b, 0x04fe013b, 0xfbfe013b, 0xfbfe013b, 0x05fe013b, 0x05fe013b, 0xfafe013b, 0xfafe013b,
+    0x02fe013a, 0x02fe013a, 0x02fe013a, 0x02fe013a, 0xfdfe013a, 0xfdfe013a, 0xfdfe013a, 0xfdfe013a,
+    0x03fe013a, 0x03fe013a, 0x03fe013a, 0x03fe013a, 0xfcfe013a, 0xfcfe013a, 0xfcfe013a, 0xfcfe013a,
+    0x00fe0139, 0x00fe0139, 0x00fe0139, 0x00fe0139, 0x00fe0139, 0x00fe0139, 0x00fe0139, 0x00fe0139,
+    0xfffe0139, 0xfffe0139, 0xfffe0139, 0xfffe0139, 0xfffe0139, 0xfffe0139, 0xfffe0139, 0xfffe0139,
+    0x01fe0139, 0x01fe0139, 0x01fe0139, 0x01fe0139, 0x01fe0139, 0x01fe0139, 0x01fe0139, 0x01fe0139,
+    0xfefe0139, 0xfefe0139, 0xfefe0139, 0xfefe0139, 0xfefe0139, 0xfefe0139, 0xfefe0139, 0xfefe0139,
+    0x0000fe13, 0x0000fe13, 0x0000fe13, 0x0000fe13, 0x000cfe2c, 0x00f3fe2c, 0x000dfe2c, 0x00f2fe2c,
+    0x000afe2b, 0x000afe2b, 0x00f5fe2b, 0x00f5fe2b, 0x000bfe2b, 0x000bfe2b, 0x00f4fe2b, 0x00f4fe2b,
+    0x0008fe2a, 0x0008fe2a, 0x0008fe2a, 0x0008fe2a, 0x00f7fe2a, 0x00f7fe2a, 0x00f7fe2a, 0x00f7fe2a,
+    0x0009fe2a, 0x0009fe2a, 0x0009fe2a, 0x0009fe2a, 0x00f6fe2a, 0x00f6fe2a, 0x00f6fe2a, 0x00f6fe2a,
+    0x0006fe29, 0x0006fe29, 0x0006fe29, 0x0006fe29, 0x0006fe3c, 0xff06fe3c, 0x0106fe3c, 0xfe06fe3c,
+    0x00f9fe29, 0x00f9fe29, 0x00f9fe29, 0x00f9fe29, 0x00f9fe3c, 0xfff9fe3c, 0x01f9fe3c, 0xfef9fe3c,
+    0x0007fe29, 0x0007fe29, 0x0007fe29, 0x0007fe29, 0x0007fe3c, 0xff07fe3c, 0x0107fe3c, 0xfe07fe3c,
+    0x00f8fe29, 0x00f8fe29, 0x00f8fe29, 0x00f8fe29, 0x00f8fe3c, 0xfff8fe3c, 0x01f8fe3c, 0xfef8fe3c,
+    0x0004fe28, 0x0004fe28, 0x0004fe28, 0x0004fe28, 0x0204fe3c, 0xfd04fe3c, 0x0304fe3c, 0xfc04fe3c,
+    0x0004fe3b, 0x0004fe3b, 0xff04fe3b, 0xff04fe3b, 0x0104fe3b, 0x0104fe3b, 0xfe04fe3b, 0xfe04fe3b,
+    0x00fbfe28, 0x00fbfe28, 0x00fbfe28, 0x00fbfe28, 0x02fbfe3c, 0xfdfbfe3c, 0x03fbfe3c, 0xfcfbfe3c,
+    0x00fbfe3b, 0x00fbfe3b, 0xfffbfe3b, 0xfffbfe3b, 0x01fbfe3b, 0x01fbfe3b, 0xfefbfe3b, 0xfefbfe3b,
+    0x0005fe28, 0x0005fe28, 0x0005fe28, 0x0005fe28, 0x0205fe3c, 0xfd05fe3c, 0x0305fe3c, 0xfc05fe3c,
+    0x0005fe3b, 0x0005fe3b, 0xff05fe3b, 0xff05fe3b, 0x0105fe3b, 0x0105fe3b, 0xfe05fe3b, 0xfe05fe3b,
+    0x00fafe28, 0x00fafe28, 0x00fafe28, 0x00fafe28, 0x02fafe3c, 0xfdfafe3c, 0x03fafe3c, 0xfcfafe3c,
+    0x00fafe3b, 0x00fafe3b, 0xfffafe3b, 0xfffafe3b, 0x01fafe3b, 0x01fafe3b, 0xfefafe3b, 0xfefafe3b,
+    0x0002fe27, 0x0002fe27, 0x0002fe27, 0x0002fe27, 0x0402fe3c, 0xfb02fe3c, 0x0502fe3c, 0xfa02fe3c,
+    0x0202fe3b, 0x0202fe3b, 0xfd02fe3b, 0xfd02fe3b, 0x0302fe3b, 0x0302fe3b, 0xfc02fe3b, 0xfc02fe3b,
+    0x0002fe3a, 0x0002fe3a, 0x0002fe3a, 0x0002fe3a, 0xff02fe3a, 0xff02fe3a, 0xff02fe3a, 0xff02fe3a,
+    0x0102fe3a, 0x0102fe3a, 0x0102fe3a, 0x0102fe3a, 0xfe02fe3a, 0xfe02fe3a, 0xfe02fe3a, 0xfe02fe3a,
+    0x00fdfe27, 0x00fdfe27, 0x00fdfe27, 0x00fdfe27, 0x04fdfe3c, 0xfbfdfe3c, 0x05fdfe3c, 0xfafdfe3c,
+    0x02fdfe3b, 0x02fdfe3b, 0xfdfdfe3b, 0xfdfdfe3b, 0x03fdfe3b, 0x03fdfe3b, 0xfcfdfe3b, 0xfcfdfe3b,
+    0x00fdfe3a, 0x00fdfe3a, 0x00fdfe3a, 0x00fdfe3a, 0xfffdfe3a, 0xfffdfe3a, 0xfffdfe3a, 0xfffdfe3a,
+    0x01fdfe3a, 0x01fdfe3a, 0x01fdfe3a, 0x01fdfe3a, 0xfefdfe3a, 0xfefdfe3a, 0xfefdfe3a, 0xfefdfe3a,
+    0x0003fe27, 0x0003fe27, 0x0003fe27, 0x0003fe27, 0x0403fe3c, 0xfb03fe3c, 0x0503fe3c, 0xfa03fe3c,
+    0x0203fe3b, 0x0203fe3b, 0xfd03fe3b, 0xfd03fe3b, 0x0303fe3b, 0x0303fe3b, 0xfc03fe3b, 0xfc03fe3b,
+    0x0003fe3a, 0x0003fe3a, 0x0003fe3a, 0x0003fe3a, 0xff03fe3a, 0xff03fe3a, 0xff03fe3a, 0xff03fe3a,
+    0x0103fe3a, 0x0103fe3a, 0x0103fe3a, 0x0103fe3a, 0xfe03fe3a, 0xfe03fe3a, 0xfe03fe3a, 0xfe03fe3a,
+    0x00fcfe27, 0x00fcfe27, 0x00fcfe27, 0x00fcfe27, 0x04fcfe3c, 0xfbfcfe3c, 0x05fcfe3c, 0xfafcfe3c,
+    0x02fcfe3b, 0x02fcfe3b, 0xfdfcfe3b, 0xfdfcfe3b, 0x03fcfe3b, 0x03fcfe3b, 0xfcfcfe3b, 0xfcfcfe3b,
+    0x00fcfe3a, 0x00fcfe3a, 0x00fcfe3a, 0x00fcfe3a, 0xfffcfe3a, 0xfffcfe3a, 0xfffcfe3a, 0xfffcfe3a,
+    0x01fcfe3a, 0x01fcfe3a, 0x01fcfe3a, 0x01fcfe3a, 0xfefcfe3a, 0xfefcfe3a, 0xfefcfe3a, 0xfefcfe3a,
+    0x0000fe26, 0x0000fe26, 0x0000fe26, 0x0000fe26, 0x0600fe3c, 0xf900fe3c, 0x0700fe3c, 0xf800fe3c,
+    0x0400fe3b, 0x0400fe3b, 0xfb00fe3b, 0xfb00fe3b, 0x0500fe3b, 0x0500fe3b, 0xfa00fe3b, 0xfa00fe3b,
+    0x0200fe3a, 0x0200fe3a, 0x0200fe3a, 0x0200fe3a, 0xfd00fe3a, 0xfd00fe3a, 0xfd00fe3a, 0xfd00fe3a,
+    0x0300fe3a, 0x0300fe3a, 0x0300fe3a, 0x0300fe3a, 0xfc00fe3a, 0xfc00fe3a, 0xfc00fe3a, 0xfc00fe3a,
+    0x0000fe39, 0x0000fe39, 0x0000fe39, 0x0000fe39, 0x0000fe39, 0x0000fe39, 0x0000fe39, 0x0000fe39,
+    0xff00fe39, 0xff00fe39, 0xff00fe39, 0xff00fe39, 0xff00fe39, 0xff00fe39, 0xff00fe39, 0xff00fe39,
+    0x0100fe39, 0x0100fe39, 0x0100fe39, 0x0100fe39, 0x0100fe39, 0x0100fe39, 0x0100fe39, 0x0100fe39,
+    0xfe00fe39, 0xfe00fe39, 0xfe00fe39, 0xfe00fe39, 0xfe00fe39, 0xfe00fe39, 0xfe00fe39, 0xfe00fe39,
+    0x00fffe26, 0x00fffe26, 0x00fffe26, 0x00fffe26, 0x06fffe3c, 0xf9fffe3c, 0x07fffe3c, 0xf8fffe3c,
+    0x04fffe3b, 0x04fffe3b, 0xfbfffe3b, 0xfbfffe3b, 0x05fffe3b, 0x05fffe3b, 0xfafffe3b, 0xfafffe3b,
+    0x02fffe3a, 0x02fffe3a, 0x02fffe3a, 0x02fffe3a, 0xfdfffe3a, 0xfdfffe3a, 0xfdfffe3a, 0xfdfffe3a,
+    0x03fffe3a, 0x03fffe3a, 0x03fffe3a, 0x03fffe3a, 0xfcfffe3a, 0xfcfffe3a, 0xfcfffe3a, 0xfcfffe3a,
+    0x00fffe39, 0x00fffe39, 0x00fffe39, 0x00fffe39, 0x00fffe39, 0x00fffe39, 0x00fffe39, 0x00fffe39,
+    0xfffffe39, 0xfffffe39, 0xfffffe39, 0xfffffe39, 0xfffffe39, 0xfffffe39, 0xfffffe39, 0xfffffe39,
+    0x01fffe39, 0x01fffe39, 0x01fffe39, 0x01fffe39, 0x01fffe39, 0x01fffe39, 0x01fffe39, 0x01fffe39,
+    0xfefffe39, 0xfefffe39, 0xfefffe39, 0xfefffe39, 0xfefffe39, 0xfefffe39, 0xfefffe39, 0xfefffe39,
+    0x0001fe26, 0x0001fe26, 0x0001fe26, 0x0001fe26, 0x0601fe3c, 0xf901fe3c, 0x0701fe3c, 0xf801fe3c,
+    0x0401fe3b, 0x0401fe3b, 0xfb01fe3b, 0xfb01fe3b, 0x0501fe3b, 0x0501fe3b, 0xfa01fe3b, 0xfa01fe3b,
+    0x0201fe3a, 0x0201fe3a, 0x0201fe3a, 0x0201fe3a, 0xfd01fe3a, 0xfd01fe3a, 0xfd01fe3a, 0xfd01fe3a,
+    0x0301fe3a, 0x0301fe3a, 0x0301fe3a, 0x0301fe3a, 0xfc01fe3a, 0xfc01fe3a, 0xfc01fe3a, 0xfc01fe3a,
+    0x0001fe39, 0x0001fe39, 0x0001fe39, 0x0001fe39, 0x0001fe39, 0x0001fe39, 0x0001fe39, 0x0001fe39,
+    0xff01fe39, 0xff01fe39, 0xff01fe39, 0xff01fe39, 0xff01fe39, 0xff01fe39, 0xff01fe39, 0xff01fe39,
+    0x0101fe39, 0x0101fe39, 0x0101fe39, 0x0101fe39, 0x0101fe39, 0x0101fe39, 0x0101fe39, 0x0101fe39,
+    0xfe01fe39, 0xfe01fe39, 0xfe01fe39, 0xfe01fe39, 0xfe01fe39, 0xfe01fe39, 0xfe01fe39, 0xfe01fe39,
+    0x00fefe26, 0x00fefe26, 0x00fefe26, 0x00fefe26, 0x06fefe3c, 0xf9fefe3c, 0x07fefe3c, 0xf8fefe3c,
+    0x04fefe3b, 0x04fefe3b, 0xfbfefe3b, 0xfbfefe3b, 0x05fefe3b, 0x05fefe3b, 0xfafefe3b, 0xfafefe3b,
+    0x02fefe3a, 0x02fefe3a, 0x02fefe3a, 0x02fefe3a, 0xfdfefe3a, 0xfdfefe3a, 0xfdfefe3a, 0xfdfefe3a,
+    0x03fefe3a, 0x03fefe3a, 0x03fefe3a, 0x03fefe3a, 0xfcfefe3a, 0xfcfefe3a, 0xfcfefe3a, 0xfcfefe3a,
+    0x00fefe39, 0x00fefe39, 0x00fefe39, 0x00fefe39, 0x00fefe39, 0x00fefe39, 0x00fefe39, 0x00fefe39,
+    0xfffefe39, 0xfffefe39, 0xfffefe39, 0xfffefe39, 0xfffefe39, 0xfffefe39, 0xfffefe39, 0xfffefe39,
+    0x01fefe39, 0x01fefe39, 0x01fefe39, 0x01fefe39, 0x01fefe39, 0x01fefe39, 0x01fefe39, 0x01fefe39,
+    0xfefefe39, 0xfefefe39, 0xfefefe39, 0xfefefe39, 0xfefefe39, 0xfefefe39, 0xfefefe39, 0xfefefe39,
+  },
+  {
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x0000201c, 0x0000df1c, 0x0000211c, 0x0000de1c, 0x0000221c, 0x0000dd1c, 0x0000231c, 0x0000dc1c,
+    0x00001c1b, 0x00001c1b, 0x0000e31b, 0x0000e31b, 0x00001d1b, 0x00001d1b, 0x0000e21b, 0x0000e21b,
+    0x00001e1b, 0x00001e1b, 0x0000e11b, 0x0000e11b, 0x00001f1b, 0x00001f1b, 0x0000e01b, 0x0000e01b,
+    0x0000181a, 0x0000181a, 0x0000181a, 0x0000181a, 0x0000e71a, 0x0000e71a, 0x0000e71a, 0x0000e71a,
+    0x0000191a, 0x0000191a, 0x0000191a, 0x0000191a, 0x0000e61a, 0x0000e61a, 0x0000e61a, 0x0000e61a,
+    0x00001a1a, 0x00001a1a, 0x00001a1a, 0x00001a1a, 0x0000e51a, 0x0000e51a, 0x0000e51a, 0x0000e51a,
+    0x00001b1a, 0x00001b1a, 0x00001b1a, 0x00001b1a, 0x0000e41a, 0x0000e41a, 0x0000e41a, 0x0000e41a,
+    0x00001419, 0x00001419, 0x00001419, 0x00001419, 0x00001419, 0x00001419, 0x00001419, 0x00001419,
+    0x0000eb19, 0x0000eb19, 0x0000eb19, 0x0000eb19, 0x0000eb19, 0x0000eb19, 0x0000eb19, 0x0000eb19,
+    0x00001519, 0x00001519, 0x00001519, 0x00001519, 0x00001519, 0x00001519, 0x00001519, 0x00001519,
+    0x0000ea19, 0x0000ea19, 0x0000ea19, 0x0000ea19, 0x0000ea19, 0x0000ea19, 0x0000ea19, 0x0000ea19,
+    0x00001619, 0x00001619, 0x00001619, 0x00001619, 0x00001619, 0x00001619, 0x00001619, 0x00001619,
+    0x0000e919, 0x0000e919, 0x0000e919, 0x0000e919, 0x0000e919, 0x0000e919, 0x0000e919, 0x0000e919,
+    0x00001719, 0x00001719, 0x00001719, 0x00001719, 0x00001719, 0x00001719, 0x00001719, 0x00001719,
+    0x0000e819, 0x0000e819, 0x0000e819, 0x0000e819, 0x0000e819, 0x0000e819, 0x0000e819, 0x0000e819,
+    0x00001018, 0x00001018, 0x00001018, 0x00001018, 0x00001018, 0x00001018, 0x00001018, 0x00001018,
+    0x0000102c, 0x00ff102c, 0x0001102c, 0x00fe102c, 0x0002102c, 0x00fd102c, 0x0003102c, 0x00fc102c,
+    0x0000ef18, 0x0000ef18, 0x0000ef18, 0x0000ef18, 0x0000ef18, 0x0000ef18, 0x0000ef18, 0x0000ef18,
+    0x0000ef2c, 0x00ffef2c, 0x0001ef2c, 0x00feef2c, 0x0002ef2c, 0x00fdef2c, 0x0003ef2c, 0x00fcef2c,
+    0x00001118, 0x00001118, 0x00001118, 0x00001118, 0x00001118, 0x00001118, 0x00001118, 0x00001118,
+    0x0000112c, 0x00ff112c, 0x0001112c, 0x00fe112c, 0x0002112c, 0x00fd112c, 0x0003112c, 0x00fc112c,
+    0x0000ee18, 0x0000ee18, 0x0000ee18, 0x0000ee18, 0x0000ee18, 0x0000ee18, 0x0000ee18, 0x0000ee18,
+    0x0000ee2c, 0x00ffee2c, 0x0001ee2c, 0x00feee2c, 0x0002ee2c, 0x00fdee2c, 0x0003ee2c, 0x00fcee2c,
+    0x00001218, 0x00001218, 0x00001218, 0x00001218, 0x00001218, 0x00001218, 0x00001218, 0x00001218,
+    0x0000122c, 0x00ff122c, 0x0001122c, 0x00fe122c, 0x0002122c, 0x00fd122c, 0x0003122c, 0x00fc122c,
+    0x0000ed18, 0x0000ed18, 0x0000ed18, 0x0000ed18, 0x0000ed18, 0x0000ed18, 0x0000ed18, 0x0000ed18,
+    0x0000ed2c, 0x00ffed2c, 0x0001ed2c, 0x00feed2c, 0x0002ed2c, 0x00fded2c, 0x0003ed2c, 0x00fced2c,
+    0x00001318, 0x00001318, 0x00001318, 0x00001318, 0x00001318, 0x00001318, 0x00001318, 0x00001318,
+    0x0000132c, 0x00ff132c, 0x0001132c, 0x00fe132c, 0x0002132c, 0x00fd132c, 0x0003132c, 0x00fc132c,
+    0x0000ec18, 0x0000ec18, 0x0000ec18, 0x0000ec18, 0x0000ec18, 0x0000ec18, 0x0000ec18, 0x0000ec18,
+    0x0000ec2c, 0x00ffec2c, 0x0001ec2c, 0x00feec2c, 0x0002ec2c, 0x00fdec2c, 0x0003ec2c, 0x00fcec2c,
+    0x00000c17, 0x00000c17, 0x00000c17, 0x00000c17, 0x00000c17, 0x00000c17, 0x00000c17, 0x00000c17,
+    0x00040c2c, 0x00fb0c2c, 0x00050c2c, 0x00fa0c2c, 0x00060c2c, 0x00f90c2c, 0x00070c2c, 0x00f80c2c,
+    0x00000c2b, 0x00000c2b, 0x00ff0c2b, 0x00ff0c2b, 0x00010c2b, 0x00010c2b, 0x00fe0c2b, 0x00fe0c2b,
+    0x00020c2b, 0x00020c2b, 0x00fd0c2b, 0x00fd0c2b, 0x00030c2b, 0x00030c2b, 0x00fc0c2b, 0x00fc0c2b,
+    0x0000f317, 0x0000f317, 0x0000f317, 0x0000f317, 0x0000f317, 0x0000f317, 0x0000f317, 0x0000f317,
+    0x0004f32c, 0x00fbf32c, 0x0005f32c, 0x00faf32c, 0x0006f32c, 0x00f9f32c, 0x0007f32c, 0x00f8f32c,
+    0x0000f32b, 0x0000f32b, 0x00fff32b, 0x00fff32b, 0x0001f32b, 0x0001f32b, 0x00fef32b, 0x00fef32b,
+    0x0002f32b, 0x0002f32b, 0x00fdf32b, 0x00fdf32b, 0x0003f32b, 0x0003f32b, 0x00fcf32b, 0x00fcf32b,
+    0x00000d17, 0x00000d17, 0x00000d17, 0x00000d17, 0x00000d17, 0x00000d17, 0x00000d17, 0x00000d17,
+    0x00040d2c, 0x00fb0d2c, 0x00050d2c, 0x00fa0d2c, 0x00060d2c, 0x00f90d2c, 0x00070d2c, 0x00f80d2c,
+    0x00000d2b, 0x00000d2b, 0x00ff0d2b, 0x00ff0d2b, 0x00010d2b, 0x00010d2b, 0x00fe0d2b, 0x00fe0d2b,
+    0x00020d2b, 0x00020d2b, 0x00fd0d2b, 0x00fd0d2b, 0x00030d2b, 0x00030d2b, 0x00fc0d2b, 0x00fc0d2b,
+    0x0000f217, 0x0000f217, 0x0000f217, 0x0000f217, 0x0000f217, 0x0000f217, 0x0000f217, 0x0000f217,
+    0x0004f22c, 0x00fbf22c, 0x0005f22c, 0x00faf22c, 0x0006f22c, 0x00f9f22c, 0x0007f22c, 0x00f8f22c,
+    0x0000f22b, 0x0000f22b, 0x00fff22b, 0x00fff22b, 0x0001f22b, 0x0001f22b, 0x00fef22b, 0x00fef22b,
+    0x0002f22b, 0x0002f22b, 0x00fdf22b, 0x00fdf22b, 0x0003f22b, 0x0003f22b, 0x00fcf22b, 0x00fcf22b,
+    0x00000e17, 0x00000e17, 0x00000e17, 0x00000e17, 0x00000e17, 0x00000e17, 0x00000e17, 0x00000e17,
+    0x00040e2c, 0x00fb0e2c, 0x00050e2c, 0x00fa0e2c, 0x00060e2c, 0x00f90e2c, 0x00070e2c, 0x00f80e2c,
+    0x00000e2b, 0x00000e2b, 0x00ff0e2b, 0x00ff0e2b, 0x00010e2b, 0x00010e2b, 0x00fe0e2b, 0x00fe0e2b,
+    0x00020e2b, 0x00020e2b, 0x00fd0e2b, 0x00fd0e2b, 0x00030e2b, 0x00030e2b, 0x00fc0e2b, 0x00fc0e2b,
+    0x0000f117, 0x0000f117, 0x0000f117, 0x0000f117, 0x0000f117, 0x0000f117, 0x0000f117, 0x0000f117,
+    0x0004f12c, 0x00fbf12c, 0x0005f12c, 0x00faf12c, 0x0006f12c, 0x00f9f12c, 0x0007f12c, 0x00f8f12c,
+    0x0000f12b, 0x0000f12b, 0x00fff12b, 0x00fff12b, 0x0001f12b, 0x0001f12b, 0x00fef12b, 0x00fef12b,
+    0x0002f12b, 0x0002f12b, 0x00fdf12b, 0x00fdf12b, 0x0003f12b, 0x0003f12b, 0x00fcf12b, 0x00fcf12b,
+    0x00000f17, 0x00000f17, 0x00000f17, 0x00000f17, 0x00000f17, 0x00000f17, 0x00000f17, 0x00000f17,
+    0x00040f2c, 0x00fb0f2c, 0x00050f2c, 0x00fa0f2c, 0x00060f2c, 0x00f90f2c, 0x00070f2c, 0x00f80f2c,
+    0x00000f2b, 0x00000f2b, 0x00ff0f2b, 0x00ff0f2b, 0x00010f2b, 0x00010f2b, 0x00fe0f2b, 0x00fe0f2b,
+    0x00020f2b, 0x00020f2b, 0x00fd0f2b, 0x00fd0f2b, 0x00030f2b, 0x00030f2b, 0x00fc0f2b, 0x00fc0f2b,
+    0x0000f017, 0x0000f017, 0x0000f017, 0x0000f017, 0x0000f017, 0x0000f017, 0x0000f017, 0x0000f017,
+    0x0004f02c, 0x00fbf02c, 0x0005f02c, 0x00faf02c, 0x0006f02c, 0x00f9f02c, 0x0007f02c, 0x00f8f02c,
+    0x0000f02b, 0x0000f02b, 0x00fff02b, 0x00fff02b, 0x0001f02b, 0x0001f02b, 0x00fef02b, 0x00fef02b,
+    0x0002f02b, 0x0002f02b, 0x00fdf02b, 0x00fdf02b, 0x0003f02b, 0x0003f02b, 0x00fcf02b, 0x00fcf02b,
+    0x00000816, 0x00000816, 0x00000816, 0x00000816, 0x00000816, 0x00000816, 0x00000816, 0x00000816,
+    0x0008082c, 0x00f7082c, 0x0009082c, 0x00f6082c, 0x000a082c, 0x00f5082c, 0x000b082c, 0x00f4082c,
+    0x0004082b, 0x0004082b, 0x00fb082b, 0x00fb082b, 0x0005082b, 0x0005082b, 0x00fa082b, 0x00fa082b,
+    0x0006082b, 0x0006082b, 0x00f9082b, 0x00f9082b, 0x0007082b, 0x0007082b, 0x00f8082b, 0x00f8082b,
+    0x0000082a, 0x0000082a, 0x0000082a, 0x0000082a, 0x00ff082a, 0x00ff082a, 0x00ff082a, 0x00ff082a,
+    0x0001082a, 0x0001082a, 0x0001082a, 0x0001082a, 0x00fe082a, 0x00fe082a, 0x00fe082a, 0x00fe082a,
+    0x0002082a, 0x0002082a, 0x0002082a, 0x0002082a, 0x00fd082a, 0x00fd082a, 0x00fd082a, 0x00fd082a,
+    0x0003082a, 0x0003082a, 0x0003082a, 0x0003082a, 0x00fc082a, 0x00fc082a, 0x00fc082a, 0x00fc082a,
+    0x0000f716, 0x0000f716, 0x0000f716, 0x0000f716, 0x0000f716, 0x0000f716, 0x0000f716, 0x0000f716,
+    0x0008f72c, 0x00f7f72c, 0x0009f72c, 0x00f6f72c, 0x000af72c, 0x00f5f72c, 0x000bf72c, 0x00f4f72c,
+    0x0004f72b, 0x0004f72b, 0x00fbf72b, 0x00fbf72b, 0x0005f72b, 0x0005f72b, 0x00faf72b, 0x00faf72b,
+    0x0006f72b, 0x0006f72b, 0x00f9f72b, 0x00f9f72b, 0x0007f72b, 0x0007f72b, 0x00f8f72b, 0x00f8f72b,
+    0x0000f72a, 0x0000f72a, 0x0000f72a, 0x0000f72a, 0x00fff72a, 0x00fff72a, 0x00fff72a, 0x00fff72a,
+    0x0001f72a, 0x0001f72a, 0x0001f72a, 0x0001f72a, 0x00fef72a, 0x00fef72a, 0x00fef72a, 0x00fef72a,
+    0x0002f72a, 0x0002f72a, 0x0002f72a, 0x0002f72a, 0x00fdf72a, 0x00fdf72a, 0x00fdf72a, 0x00fdf72a,
+    0x0003f72a, 0x0003f72a, 0x0003f72a, 0x0003f72a, 0x00fcf72a, 0x00fcf72a, 0x00fcf72a, 0x00fcf72a,
+    0x00000916, 0x00000916, 0x00000916, 0x00000916, 0x00000916, 0x00000916, 0x00000916, 0x00000916,
+    0x0008092c, 0x00f7092c, 0x0009092c, 0x00f6092c, 0x000a092c, 0x00f5092c, 0x000b092c, 0x00f4092c,
+    0x0004092b, 0x0004092b, 0x00fb092b, 0x00fb092b, 0x0005092b, 0x0005092b, 0x00fa092b, 0x00fa092b,
+    0x0006092b, 0x0006092b, 0x00f9092b, 0x00f9092b, 0x0007092b, 0x0007092b, 0x00f8092b, 0x00f8092b,
+    0x0000092a, 0x0000092a, 0x0000092a, 0x0000092a, 0x00ff092a, 0x00ff092a, 0x00ff092a, 0x00ff092a,
+    0x0001092a, 0x0001092a, 0x0001092a, 0x0001092a, 0x00fe092a, 0x00fe092a, 0x00fe092a, 0x00fe092a,
+    0x0002092a, 0x0002092a, 0x0002092a, 0x0002092a, 0x00fd092a, 0x00fd092a, 0x00fd092a, 0x00fd092a,
+    0x0003092a, 0x0003092a, 0x0003092a, 0x0003092a, 0x00fc092a, 0x00fc092a, 0x00fc092a, 0x00fc092a,
+    0x0000f616, 0x0000f616, 0x0000f616, 0x0000f616, 0x0000f616, 0x0000f616, 0x0000f616, 0x0000f616,
+    0x0008f62c, 0x00f7f62c, 0x0009f62c, 0x00f6f62c, 0x000af62c, 0x00f5f62c, 0x000bf62c, 0x00f4f62c,
+    0x0004f62b, 0x0004f62b, 0x00fbf62b, 0x00fbf62b, 0x0005f62b, 0x0005f62b, 0x00faf62b, 0x00faf62b,
+    0x0006f62b, 0x0006f62b, 0x00f9f62b, 0x00f9f62b, 0x0007f62b, 0x0007f62b, 0x00f8f62b, 0x00f8f62b,
+    0x0000f62a, 0x0000f62a, 0x0000f62a, 0x0000f62a, 0x00fff62a, 0x00fff62a, 0x00fff62a, 0x00fff62a,
+    0x0001f62a, 0x0001f62a, 0x0001f62a, 0x0001f62a, 0x00fef62a, 0x00fef62a, 0x00fef62a, 0x00fef62a,
+    0x0002f62a, 0x0002f62a, 0x0002f62a, 0x0002f62a, 0x00fdf62a, 0x00fdf62a, 0x00fdf62a, 0x00fdf62a,
+    0x0003f62a, 0x0003f62a, 0x0003f62a, 0x0003f62a, 0x00fcf62a, 0x00fcf62a, 0x00fcf62a, 0x00fcf62a,
+    0x00000a16, 0x00000a16, 0x00000a16, 0x00000a16, 0x00000a16, 0x00000a16, 0x00000a16, 0x00000a16,
+    0x00080a2c, 0x00f70a2c, 0x00090a2c, 0x00f60a2c, 0x000a0a2c, 0x00f50a2c, 0x000b0a2c, 0x00f40a2c,
+    0x00040a2b, 0x00040a2b, 0x00fb0a2b, 0x00fb0a2b, 0x00050a2b, 0x00050a2b, 0x00fa0a2b, 0x00fa0a2b,
+    0x00060a2b, 0x00060a2b, 0x00f90a2b, 0x00f90a2b, 0x00070a2b, 0x00070a2b, 0x00f80a2b, 0x00f80a2b,
+    0x00000a2a, 0x00000a2a, 0x00000a2a, 0x00000a2a, 0x00ff0a2a, 0x00ff0a2a, 0x00ff0a2a, 0x00ff0a2a,
+    0x00010a2a, 0x00010a2a, 0x00010a2a, 0x00010a2a, 0x00fe0a2a, 0x00fe0a2a, 0x00fe0a2a, 0x00fe0a2a,
+    0x00020a2a, 0x00020a2a, 0x00020a2a, 0x00020a2a, 0x00fd0a2a, 0x00fd0a2a, 0x00fd0a2a, 0x00fd0a2a,
+    0x00030a2a, 0x00030a2a, 0x00030a2a, 0x00030a2a, 0x00fc0a2a, 0x00fc0a2a, 0x00fc0a2a, 0x00fc0a2a,
+    0x0000f516, 0x0000f516, 0x0000f516, 0x0000f516, 0x0000f516, 0x0000f516, 0x0000f516, 0x0000f516,
+    0x0008f52c, 0x00f7f52c, 0x0009f52c, 0x00f6f52c, 0x000af52c, 0x00f5f52c, 0x000bf52c, 0x00f4f52c,
+    0x0004f52b, 0x0004f52b, 0x00fbf52b, 0x00fbf52b, 0x0005f52b, 0x0005f52b, 0x00faf52b, 0x00faf52b,
+    0x0006f52b, 0x0006f52b, 0x00f9f52b, 0x00f9f52b, 0x0007f52b, 0x0007f52b, 0x00f8f52b, 0x00f8f52b,
+    0x0000f52a, 0x0000f52a, 0x0000f52a, 0x0000f52a, 0x00fff52a, 0x00fff52a, 0x00fff52a, 0x00fff52a,
+    0x0001f52a, 0x0001f52a, 0x0001f52a, 0x0001f52a, 0x00fef52a, 0x00fef52a, 0x00fef52a, 0x00fef52a,
+    0x0002f52a, 0x0002f52a, 0x0002f52a, 0x0002f52a, 0x00fdf52a, 0x00fdf52a, 0x00fdf52a, 0x00fdf52a,
+    0x0003f52a, 0x0003f52a, 0x0003f52a, 0x0003f52a, 0x00fcf52a, 0x00fcf52a, 0x00fcf52a, 0x00fcf52a,
+    0x00000b16, 0x00000b16, 0x00000b16, 0x00000b16, 0x00000b16, 0x00000b16, 0x00000b16, 0x00000b16,
+    0x00080b2c, 0x00f70b2c, 0x00090b2c, 0x00f60b2c, 0x000a0b2c, 0x00f50b2c, 0x000b0b2c, 0x00f40b2c,
+    0x00040b2b, 0x00040b2b, 0x00fb0b2b, 0x00fb0b2b, 0x00050b2b, 0x00050b2b, 0x00fa0b2b, 0x00fa0b2b,
+    0x00060b2b, 0x00060b2b, 0x00f90b2b, 0x00f90b2b, 0x00070b2b, 0x00070b2b, 0x00f80b2b, 0x00f80b2b,
+    0x00000b2a, 0x00000b2a, 0x00000b2a, 0x00000b2a, 0x00ff0b2a, 0x00ff0b2a, 0x00ff0b2a, 0x00ff0b2a,
+    0x00010b2a, 0x00010b2a, 0x00010b2a, 0x00010b2a, 0x00fe0b2a, 0x00fe0b2a, 0x00fe0b2a, 0x00fe0b2a,
+    0x00020b2a, 0x00020b2a, 0x00020b2a, 0x00020b2a, 0x00fd0b2a, 0x00fd0b2a, 0x00fd0b2a, 0x00fd0b2a,
+    0x00030b2a, 0x00030b2a, 0x00030b2a, 0x00030b2a, 0x00fc0b2a, 0x00fc0b2a, 0x00fc0b2a, 0x00fc0b2a,
+    0x0000f416, 0x0000f416, 0x0000f416, 0x0000f416, 0x0000f416, 0x0000f416, 0x0000f416, 0x0000f416,
+    0x0008f42c, 0x00f7f42c, 0x0009f42c, 0x00f6f42c, 0x000af42c, 0x00f5f42c, 0x000bf42c, 0x00f4f42c,
+    0x0004f42b, 0x0004f42b, 0x00fbf42b, 0x00fbf42b, 0x0005f42b, 0x0005f42b, 0x00faf42b, 0x00faf42b,
+    0x0006f42b, 0x0006f42b, 0x00f9f42b, 0x00f9f42b, 0x0007f42b, 0x0007f42b, 0x00f8f42b, 0x00f8f42b,
+    0x0000f42a, 0x0000f42a, 0x0000f42a, 0x0000f42a, 0x00fff42a, 0x00fff42a, 0x00fff42a, 0x00fff42a,
+    0x0001f42a, 0x0001f42a, 0x0001f42a, 0x0001f42a, 0x00fef42a, 0x00fef42a, 0x00fef42a, 0x00fef42a,
+    0x0002f42a, 0x0002f42a, 0x0002f42a, 0x0002f42a, 0x00fdf42a, 0x00fdf42a, 0x00fdf42a, 0x00fdf42a,
+    0x0003f42a, 0x0003f42a, 0x0003f42a, 0x0003f42a, 0x00fcf42a, 0x00fcf42a, 0x00fcf42a, 0x00fcf42a,
+    0x00000415, 0x00000415, 0x00000415, 0x00000415, 0x00000415, 0x00000415, 0x00000415, 0x00000415,
+    0x000c042c, 0x00f3042c, 0x000d042c, 0x00f2042c, 0x000e042c, 0x00f1042c, 0x000f042c, 0x00f0042c,
+    0x0008042b, 0x0008042b, 0x00f7042b, 0x00f7042b, 0x0009042b, 0x0009042b, 0x00f6042b, 0x00f6042b,
+    0x000a042b, 0x000a042b, 0x00f5042b, 0x00f5042b, 0x000b042b, 0x000b042b, 0x00f4042b, 0x00f4042b,
+    0x0004042a, 0x0004042a, 0x0004042a, 0x0004042a, 0x00fb042a, 0x00fb042a, 0x00fb042a, 0x00fb042a,
+    0x0005042a, 0x0005042a, 0x0005042a, 0x0005042a, 0x00fa042a, 0x00fa042a, 0x00fa042a, 0x00fa042a,
+    0x0006042a, 0x0006042a, 0x0006042a, 0x0006042a, 0x00f9042a, 0x00f9042a, 0x00f9042a, 0x00f9042a,
+    0x0007042a, 0x0007042a, 0x0007042a, 0x0007042a, 0x00f8042a, 0x00f8042a, 0x00f8042a, 0x00f8042a,
+    0x00000429, 0x00000429, 0x00000429, 0x00000429, 0x00000429, 0x00000429, 0x00000429, 0x00000429,
+    0x00ff0429, 0x00ff0429, 0x00ff0429, 0x00ff0429, 0x00ff0429, 0x00ff0429, 0x00ff0429, 0x00ff0429,
+    0x00010429, 0x00010429, 0x00010429, 0x00010429, 0x00010429, 0x00010429, 0x00010429, 0x00010429,
+    0x00fe0429, 0x00fe0429, 0x00fe0429, 0x00fe0429, 0x00fe0429, 0x00fe0429, 0x00fe0429, 0x00fe0429,
+    0x00020429, 0x00020429, 0x00020429, 0x00020429, 0x00020429, 0x00020429, 0x00020429, 0x00020429,
+    0x00fd0429, 0x00fd0429, 0x00fd0429, 0x00fd0429, 0x00fd0429, 0x00fd0429, 0x00fd0429, 0x00fd0429,
+    0x00030429, 0x00030429, 0x00030429, 0x00030429, 0x00030429, 0x00030429, 0x00030429, 0x00030429,
+    0x00fc0429, 0x00fc0429, 0x00fc0429, 0x00fc0429, 0x00fc0429, 0x00fc0429, 0x00fc0429, 0x00fc0429,
+    0x0000fb15, 0x0000fb15, 0x0000fb15, 0x0000fb15, 0x0000fb15, 0x0000fb15, 0x0000fb15, 0x0000fb15,
+    0x000cfb2c, 0x00f3fb2c, 0x000dfb2c, 0x00f2fb2c, 0x000efb2c, 0x00f1fb2c, 0x000ffb2c, 0x00f0fb2c,
+    0x0008fb2b, 0x0008fb2b, 0x00f7fb2b, 0x00f7fb2b, 0x0009fb2b, 0x0009fb2b, 0x00f6fb2b, 0x00f6fb2b,
+    0x000afb2b, 0x000afb2b, 0x00f5fb2b, 0x00f5fb2b, 0x000bfb2b, 0x000bfb2b, 0x00f4fb2b, 0x00f4fb2b,
+    0x0004fb2a, 0x0004fb2a, 0x0004fb2a, 0x0004fb2a, 0x00fbfb2a, 0x00fbfb2a, 0x00fbfb2a, 0x00fbfb2a,
+    0x0005fb2a, 0x0005fb2a, 0x0005fb2a, 0x0005fb2a, 0x00fafb2a, 0x00fafb2a, 0x00fafb2a, 0x00fafb2a,
+    0x0006fb2a, 0x0006fb2a, 0x0006fb2a, 0x0006fb2a, 0x00f9fb2a, 0x00f9fb2a, 0x00f9fb2a, 0x00f9fb2a,
+    0x0007fb2a, 0x0007fb2a, 0x0007fb2a, 0x0007fb2a, 0x00f8fb2a, 0x00f8fb2a, 0x00f8fb2a, 0x00f8fb2a,
+    0x0000fb29, 0x0000fb29, 0x0000fb29, 0x0000fb29, 0x0000fb29, 0x0000fb29, 0x0000fb29, 0x0000fb29,
+    0x00fffb29, 0x00fffb29, 0x00fffb29, 0x00fffb29, 0x00fffb29, 0x00fffb29, 0x00fffb29, 0x00fffb29,
+    0x0001fb29, 0x0001fb29, 0x0001fb29, 0x0001fb29, 0x0001fb29, 0x0001fb29, 0x0001fb29, 0x0001fb29,
+    0x00fefb29, 0x00fefb29, 0x00fefb29, 0x00fefb29, 0x00fefb29, 0x00fefb29, 0x00fefb29, 0x00fefb29,
+    0x0002fb29, 0x0002fb29, 0x0002fb29, 0x0002fb29, 0x0002fb29, 0x0002fb29, 0x0002fb29, 0x0002fb29,
+    0x00fdfb29, 0x00fdfb29, 0x00fdfb29, 0x00fdfb29, 0x00fdfb29, 0x00fdfb29, 0x00fdfb29, 0x00fdfb29,
+    0x0003fb29, 0x0003fb29, 0x0003fb29, 0x0003fb29, 0x0003fb29, 0x0003fb29, 0x0003fb29, 0x0003fb29,
+    0x00fcfb29, 0x00fcfb29, 0x00fcfb29, 0x00fcfb29, 0x00fcfb29, 0x00fcfb29, 0x00fcfb29, 0x00fcfb29,
+    0x00000515, 0x00000515, 0x00000515, 0x00000515, 0x00000515, 0x00000515, 0x00000515, 0x00000515,
+    0x000c052c, 0x00f3052c, 0x000d052c, 0x00f2052c, 0x000e052c, 0x00f1052c, 0x000f052c, 0x00f0052c,
+    0x0008052b, 0x0008052b, 0x00f7052b, 0x00f7052b, 0x0009052b, 0x0009052b, 0x00f6052b, 0x00f6052b,
+    0x000a052b, 0x000a052b, 0x00f5052b, 0x00f5052b, 0x000b052b, 0x000b052b, 0x00f4052b, 0x00f4052b,
+    0x0004052a, 0x0004052a, 0x0004052a, 0x0004052a, 0x00fb052a, 0x00fb052a, 0x00fb052a, 0x00fb052a,
+    0x0005052a, 0x0005052a, 0x0005052a, 0x0005052a, 0x00fa052a, 0x00fa052a, 0x00fa052a, 0x00fa052a,
+    0x0006052a, 0x0006052a, 0x0006052a, 0x0006052a, 0x00f9052a, 0x00f9052a, 0x00f9052a, 0x00f9052a,
+    0x0007052a, 0x0007052a, 0x0007052a, 0x0007052a, 0x00f8052a, 0x00f8052a, 0x00f8052a, 0x00f8052a,
+    0x00000529, 0x00000529, 0x00000529, 0x00000529, 0x00000529, 0x00000529, 0x00000529, 0x00000529,
+    0x00ff0529, 0x00ff0529, 0x00ff0529, 0x00ff0529, 0x00ff0529, 0x00ff0529, 0x00ff0529, 0x00ff0529,
+    0x00010529, 0x00010529, 0x00010529, 0x00010529, 0x00010529, 0x00010529, 0x00010529, 0x00010529,
+    0x00fe0529, 0x00fe0529, 0x00fe0529, 0x00fe0529, 0x00fe0529, 0x00fe0529, 0x00fe0529, 0x00fe0529,
+    0x00020529, 0x00020529, 0x00020529, 0x00020529, 0x00020529, 0x00020529, 0x00020529, 0x00020529,
+    0x00fd0529, 0x00fd0529, 0x00fd0529, 0x00fd0529, 0x00fd0529, 0x00fd0529, 0x00fd0529, 0x00fd0529,
+    0x00030529, 0x00030529, 0x00030529, 0x00030529, 0x00030529, 0x00030529, 0x00030529, 0x00030529,
+    0x00fc0529, 0x00fc0529, 0x00fc0529, 0x00fc0529, 0x00fc0529, 0x00fc0529, 0x00fc0529, 0x00fc0529,
+    0x0000fa15, 0x0000fa15, 0x0000fa15, 0x0000fa15, 0x0000fa15, 0x0000fa15, 0x0000fa15, 0x0000fa15,
+    0x000cfa2c, 0x00f3fa2c, 0x000dfa2c, 0x00f2fa2c, 0x000efa2c, 0x00f1fa2c, 0x000ffa2c, 0x00f0fa2c,
+    0x0008fa2b, 0x0008fa2b, 0x00f7fa2b, 0x00f7fa2b, 0x0009fa2b, 0x0009fa2b, 0x00f6fa2b, 0x00f6fa2b,
+    0x000afa2b, 0x000afa2b, 0x00f5fa2b, 0x00f5fa2b, 0x000bfa2b, 0x000bfa2b, 0x00f4fa2b, 0x00f4fa2b,
+    0x0004fa2a, 0x0004fa2a, 0x0004fa2a, 0x0004fa2a, 0x00fbfa2a, 0x00fbfa2a, 0x00fbfa2a, 0x00fbfa2a,
+    0x0005fa2a, 0x0005fa2a, 0x0005fa2a, 0x0005fa2a, 0x00fafa2a, 0x00fafa2a, 0x00fafa2a, 0x00fafa2a,
+    0x0006fa2a, 0x0006fa2a, 0x0006fa2a, 0x0006fa2a, 0x00f9fa2a, 0x00f9fa2a, 0x00f9fa2a, 0x00f9fa2a,
+    0x0007fa2a, 0x0007fa2a, 0x0007fa2a, 0x0007fa2a, 0x00f8fa2a, 0x00f8fa2a, 0x00f8fa2a, 0x00f8fa2a,
+    0x0000fa29, 0x0000fa29, 0x0000fa29, 0x0000fa29, 0x0000fa29, 0x0000fa29, 0x0000fa29, 0x0000fa29,
+    0x00fffa29, 0x00fffa29, 0x00fffa29, 0x00fffa29, 0x00fffa29, 0x00fffa29, 0x00fffa29, 0x00fffa29,
+    0x0001fa29, 0x0001fa29, 0x0001fa29, 0x0001fa29, 0x0001fa29, 0x0001fa29, 0x0001fa29, 0x0001fa29,
+    0x00fefa29, 0x00fefa29, 0x00fefa29, 0x00fefa29, 0x00fefa29, 0x00fefa29, 0x00fefa29, 0x00fefa29,
+    0x0002fa29, 0x0002fa29, 0x0002fa29, 0x0002fa29, 0x0002fa29, 0x0002fa29, 0x0002fa29, 0x0002fa29,
+    0x00fdfa29, 0x00fdfa29, 0x00fdfa29, 0x00fdfa29, 0x00fdfa29, 0x00fdfa29, 0x00fdfa29, 0x00fdfa29,
+    0x0003fa29, 0x0003fa29, 0x0003fa29, 0x0003fa29, 0x0003fa29, 0x0003fa29, 0x0003fa29, 0x0003fa29,
+    0x00fcfa29, 0x00fcfa29, 0x00fcfa29, 0x00fcfa29, 0x00fcfa29, 0x00fcfa29, 0x00fcfa29, 0x00fcfa29,
+    0x00000615, 0x00000615, 0x00000615, 0x00000615, 0x00000615, 0x00000615, 0x00000615, 0x00000615,
+    0x000c062c, 0x00f3062c, 0x000d062c, 0x00f2062c, 0x000e062c, 0x00f1062c, 0x000f062c, 0x00f0062c,
+    0x0008062b, 0x0008062b, 0x00f7062b, 0x00f7062b, 0x0009062b, 0x0009062b, 0x00f6062b, 0x00f6062b,
+    0x000a062b, 0x000a062b, 0x00f5062b, 0x00f5062b, 0x000b062b, 0x000b062b, 0x00f4062b, 0x00f4062b,
+    0x0004062a, 0x0004062a, 0x0004062a, 0x0004062a, 0x00fb062a, 0x00fb062a, 0x00fb062a, 0x00fb062a,
+    0x0005062a, 0x0005062a, 0x0005062a, 0x0005062a, 0x00fa062a, 0x00fa062a, 0x00fa062a, 0x00fa062a,
+    0x0006062a, 0x0006062a, 0x0006062a, 0x0006062a, 0x00f9062a, 0x00f9062a, 0x00f9062a, 0x00f9062a,
+    0x0007062a, 0x0007062a, 0x0007062a, 0x0007062a, 0x00f8062a, 0x00f8062a, 0x00f8062a, 0x00f8062a,
+    0x00000629, 0x00000629, 0x00000629, 0x00000629, 0x00000629, 0x00000629, 0x00000629, 0x00000629,
+    0x00ff0629, 0x00ff0629, 0x00ff0629, 0x00ff0629, 0x00ff0629, 0x00ff0629, 0x00ff0629, 0x00ff0629,
+    0x00010629, 0x00010629, 0x00010629, 0x00010629, 0x00010629, 0x00010629, 0x00010629, 0x00010629,
+    0x00fe0629, 0x00fe0629, 0x00fe0629, 0x00fe0629, 0x00fe0629, 0x00fe0629, 0x00fe0629, 0x00fe0629,
+    0x00020629, 0x00020629, 0x00020629, 0x00020629, 0x00020629, 0x00020629, 0x00020629, 0x00020629,
+    0x00fd0629, 0x00fd0629, 0x00fd0629, 0x00fd0629, 0x00fd0629, 0x00fd0629, 0x00fd0629, 0x00fd0629,
+    0x00030629, 0x00030629, 0x00030629, 0x00030629, 0x00030629, 0x00030629, 0x00030629, 0x00030629,
+    0x00fc0629, 0x00fc0629, 0x00fc0629, 0x00fc0629, 0x00fc0629, 0x00fc0629, 0x00fc0629, 0x00fc0629,
+    0x0000f915, 0x0000f915, 0x0000f915, 0x0000f915, 0x0000f915, 0x0000f915, 0x0000f915, 0x0000f915,
+    0x000cf92c, 0x00f3f92c, 0x000df92c, 0x00f2f92c, 0x000ef92c, 0x00f1f92c, 0x000ff92c, 0x00f0f92c,
+    0x0008f92b, 0x0008f92b, 0x00f7f92b, 0x00f7f92b, 0x0009f92b, 0x0009f92b, 0x00f6f92b, 0x00f6f92b,
+    0x000af92b, 0x000af92b, 0x00f5f92b, 0x00f5f92b, 0x000bf92b, 0x000bf92b, 0x00f4f92b, 0x00f4f92b,
+    0x0004f92a, 0x0004f92a, 0x0004f92a, 0x0004f92a, 0x00fbf92a, 0x00fbf92a, 0x00fbf92a, 0x00fbf92a,
+    0x0005f92a, 0x0005f92a, 0x0005f92a, 0x0005f92a, 0x00faf92a, 0x00faf92a, 0x00faf92a, 0x00faf92a,
+    0x0006f92a, 0x0006f92a, 0x0006f92a, 0x0006f92a, 0x00f9f92a, 0x00f9f92a, 0x00f9f92a, 0x00f9f92a,
+    0x0007f92a, 0x0007f92a, 0x0007f92a, 0x0007f92a, 0x00f8f92a, 0x00f8f92a, 0x00f8f92a, 0x00f8f92a,
+    0x0000f929, 0x0000f929, 0x0000f929, 0x0000f929, 0x0000f929, 0x0000f929, 0x0000f929, 0x0000f929,
+    0x00fff929, 0x00fff929, 0x00fff929, 0x00fff929, 0x00fff929, 0x00fff929, 0x00fff929, 0x00fff929,
+    0x0001f929, 0x0001f929, 0x0001f929, 0x0001f929, 0x0001f929, 0x0001f929, 0x0001f929, 0x0001f929,
+    0x00fef929, 0x00fef929, 0x00fef929, 0x00fef929, 0x00fef929, 0x00fef929, 0x00fef929, 0x00fef929,
+    0x0002f929, 0x0002f929, 0x0002f929, 0x0002f929, 0x0002f929, 0x0002f929, 0x0002f929, 0x0002f929,
+    0x00fdf929, 0x00fdf929, 0x00fdf929, 0x00fdf929, 0x00fdf929, 0x00fdf929, 0x00fdf929, 0x00fdf929,
+    0x0003f929, 0x0003f929, 0x0003f929, 0x0003f929, 0x0003f929, 0x0003f929, 0x0003f929, 0x0003f929,
+    0x00fcf929, 0x00fcf929, 0x00fcf929, 0x00fcf929, 0x00fcf929, 0x00fcf929, 0x00fcf929, 0x00fcf929,
+    0x00000715, 0x00000715, 0x00000715, 0x00000715, 0x00000715, 0x00000715, 0x00000715, 0x00000715,
+    0x000c072c, 0x00f3072c, 0x000d072c, 0x00f2072c, 0x000e072c, 0x00f1072c, 0x000f072c, 0x00f0072c,
+    0x0008072b, 0x0008072b, 0x00f7072b, 0x00f7072b, 0x0009072b, 0x0009072b, 0x00f6072b, 0x00f6072b,
+    0x000a072b, 0x000a072b, 0x00f5072b, 0x00f5072b, 0x000b072b, 0x000b072b, 0x00f4072b, 0x00f4072b,
+    0x0004072a, 0x0004072a, 0x0004072a, 0x0004072a, 0x00fb072a, 0x00fb072a, 0x00fb072a, 0x00fb072a,
+    0x0005072a, 0x0005072a, 0x0005072a, 0x0005072a, 0x00fa072a, 0x00fa072a, 0x00fa072a, 0x00fa072a,
+    0x0006072a, 0x0006072a, 0x0006072a, 0x0006072a, 0x00f9072a, 0x00f9072a, 0x00f9072a, 0x00f9072a,
+    0x0007072a, 0x0007072a, 0x0007072a, 0x0007072a, 0x00f8072a, 0x00f8072a, 0x00f8072a, 0x00f8072a,
+    0x00000729, 0x00000729, 0x00000729, 0x00000729, 0x00000729, 0x00000729, 0x00000729, 0x00000729,
+    0x00ff0729, 0x00ff0729, 0x00ff0729, 0x00ff0729, 0x00ff0729, 0x00ff0729, 0x00ff0729, 0x00ff0729,
+    0x00010729, 0x00010729, 0x00010729, 0x00010729, 0x00010729, 0x00010729, 0x00010729, 0x00010729,
+    0x00fe0729, 0x00fe0729, 0x00fe0729, 0x00fe0729, 0x00fe0729, 0x00fe0729, 0x00fe0729, 0x00fe0729,
+    0x00020729, 0x00020729, 0x00020729, 0x00020729, 0x00020729, 0x00020729, 0x00020729, 0x00020729,
+    0x00fd0729, 0x00fd0729, 0x00fd0729, 0x00fd0729, 0x00fd0729, 0x00fd0729, 0x00fd0729, 0x00fd0729,
+    0x00030729, 0x00030729, 0x00030729, 0x00030729, 0x00030729, 0x00030729, 0x00030729, 0x00030729,
+    0x00fc0729, 0x00fc0729, 0x00fc0729, 0x00fc0729, 0x00fc0729, 0x00fc0729, 0x00fc0729, 0x00fc0729,
+    0x0000f815, 0x0000f815, 0x0000f815, 0x0000f815, 0x0000f815, 0x0000f815, 0x0000f815, 0x0000f815,
+    0x000cf82c, 0x00f3f82c, 0x000df82c, 0x00f2f82c, 0x000ef82c, 0x00f1f82c, 0x000ff82c, 0x00f0f82c,
+    0x0008f82b, 0x0008f82b, 0x00f7f82b, 0x00f7f82b, 0x0009f82b, 0x0009f82b, 0x00f6f82b, 0x00f6f82b,
+    0x000af82b, 0x000af82b, 0x00f5f82b, 0x00f5f82b, 0x000bf82b, 0x000bf82b, 0x00f4f82b, 0x00f4f82b,
+    0x0004f82a, 0x0004f82a, 0x0004f82a, 0x0004f82a, 0x00fbf82a, 0x00fbf82a, 0x00fbf82a, 0x00fbf82a,
+    0x0005f82a, 0x0005f82a, 0x0005f82a, 0x0005f82a, 0x00faf82a, 0x00faf82a, 0x00faf82a, 0x00faf82a,
+    0x0006f82a, 0x0006f82a, 0x0006f82a, 0x0006f82a, 0x00f9f82a, 0x00f9f82a, 0x00f9f82a, 0x00f9f82a,
+    0x0007f82a, 0x0007f82a, 0x0007f82a, 0x0007f82a, 0x00f8f82a, 0x00f8f82a, 0x00f8f82a, 0x00f8f82a,
+    0x0000f829, 0x0000f829, 0x0000f829, 0x0000f829, 0x0000f829, 0x0000f829, 0x0000f829, 0x0000f829,
+    0x00fff829, 0x00fff829, 0x00fff829, 0x00fff829, 0x00fff829, 0x00fff829, 0x00fff829, 0x00fff829,
+    0x0001f829, 0x0001f829, 0x0001f829, 0x0001f829, 0x0001f829, 0x0001f829, 0x0001f829, 0x0001f829,
+    0x00fef829, 0x00fef829, 0x00fef829, 0x00fef829, 0x00fef829, 0x00fef829, 0x00fef829, 0x00fef829,
+    0x0002f829, 0x0002f829, 0x0002f829, 0x0002f829, 0x0002f829, 0x0002f829, 0x0002f829, 0x0002f829,
+    0x00fdf829, 0x00fdf829, 0x00fdf829, 0x00fdf829, 0x00fdf829, 0x00fdf829, 0x00fdf829, 0x00fdf829,
+    0x0003f829, 0x0003f829, 0x0003f829, 0x0003f829, 0x0003f829, 0x0003f829, 0x0003f829, 0x0003f829,
+    0x00fcf829, 0x00fcf829, 0x00fcf829, 0x00fcf829, 0x00fcf829, 0x00fcf829, 0x00fcf829, 0x00fcf829,
+    0x00000014, 0x00000014, 0x00000014, 0x00000014, 0x00000014, 0x00000014, 0x00000014, 0x00000014,
+    0x0010002c, 0x00ef002c, 0x0011002c, 0x00ee002c, 0x0012002c, 0x00ed002c, 0x0013002c, 0x00ec002c,
+    0x000c002b, 0x000c002b, 0x00f3002b, 0x00f3002b, 0x000d002b, 0x000d002b, 0x00f2002b, 0x00f2002b,
+    0x000e002b, 0x000e002b, 0x00f1002b, 0x00f1002b, 0x000f002b, 0x000f002b, 0x00f0002b, 0x00f0002b,
+    0x0008002a, 0x0008002a, 0x0008002a, 0x0008002a, 0x00f7002a, 0x00f7002a, 0x00f7002a, 0x00f7002a,
+    0x0009002a, 0x0009002a, 0x0009002a, 0x0009002a, 0x00f6002a, 0x00f6002a, 0x00f6002a, 0x00f6002a,
+    0x000a002a, 0x000a002a, 0x000a002a, 0x000a002a, 0x00f5002a, 0x00f5002a, 0x00f5002a, 0x00f5002a,
+    0x000b002a, 0x000b002a, 0x000b002a, 0x000b002a, 0x00f4002a, 0x00f4002a, 0x00f4002a, 0x00f4002a,
+    0x00040029, 0x00040029, 0x00040029, 0x00040029, 0x00040029, 0x00040029, 0x00040029, 0x00040029,
+    0x00fb0029, 0x00fb0029, 0x00fb0029, 0x00fb0029, 0x00fb0029, 0x00fb0029, 0x00fb0029, 0x00fb0029,
+    0x00050029, 0x00050029, 0x00050029, 0x00050029, 0x00050029, 0x00050029, 0x00050029, 0x00050029,
+    0x00fa0029, 0x00fa0029, 0x00fa0029, 0x00fa0029, 0x00fa0029, 0x00fa0029, 0x00fa0029, 0x00fa0029,
+    0x00060029, 0x00060029, 0x00060029, 0x00060029, 0x00060029, 0x00060029, 0x00060029, 0x00060029,
+    0x00f90029, 0x00f90029, 0x00f90029, 0x00f90029, 0x00f90029, 0x00f90029, 0x00f90029, 0x00f90029,
+    0x00070029, 0x00070029, 0x00070029, 0x00070029, 0x00070029, 0x00070029, 0x00070029, 0x00070029,
+    0x00f80029, 0x00f80029, 0x00f80029, 0x00f80029, 0x00f80029, 0x00f80029, 0x00f80029, 0x00f80029,
+    0x00000028, 0x00000028, 0x00000028, 0x00000028, 0x00000028, 0x00000028, 0x00000028, 0x00000028,
+    0x0000003c, 0xff00003c, 0x0100003c, 0xfe00003c, 0x0200003c, 0xfd00003c, 0x0300003c, 0xfc00003c,
+    0x00ff0028, 0x00ff0028, 0x00ff0028, 0x00ff0028, 0x00ff0028, 0x00ff0028, 0x00ff0028, 0x00ff0028,
+    0x00ff003c, 0xffff003c, 0x01ff003c, 0xfeff003c, 0x02ff003c, 0xfdff003c, 0x03ff003c, 0xfcff003c,
+    0x00010028, 0x00010028, 0x00010028, 0x00010028, 0x00010028, 0x00010028, 0x00010028, 0x00010028,
+    0x0001003c, 0xff01003c, 0x0101003c, 0xfe01003c, 0x0201003c, 0xfd01003c, 0x0301003c, 0xfc01003c,
+    0x00fe0028, 0x00fe0028, 0x00fe0028, 0x00fe0028, 0x00fe0028, 0x00fe0028, 0x00fe0028, 0x00fe0028,
+    0x00fe003c, 0xfffe003c, 0x01fe003c, 0xfefe003c, 0x02fe003c, 0xfdfe003c, 0x03fe003c, 0xfcfe003c,
+    0x00020028, 0x00020028, 0x00020028, 0x00020028, 0x00020028, 0x00020028, 0x00020028, 0x00020028,
+    0x0002003c, 0xff02003c, 0x0102003c, 0xfe02003c, 0x0202003c, 0xfd02003c, 0x0302003c, 0xfc02003c,
+    0x00fd0028, 0x00fd0028, 0x00fd0028, 0x00fd0028, 0x00fd0028, 0x00fd0028, 0x00fd0028, 0x00fd0028,
+    0x00fd003c, 0xfffd003c, 0x01fd003c, 0xfefd003c, 0x02fd003c, 0xfdfd003c, 0x03fd003c, 0xfcfd003c,
+    0x00030028, 0x00030028, 0x00030028, 0x00030028, 0x00030028, 0x00030028, 0x00030028, 0x00030028,
+    0x0003003c, 0xff03003c, 0x0103003c, 0xfe03003c, 0x0203003c, 0xfd03003c, 0x0303003c, 0xfc03003c,
+    0x00fc0028, 0x00fc0028, 0x00fc0028, 0x00fc0028, 0x00fc0028, 0x00fc0028, 0x00fc0028, 0x00fc0028,
+    0x00fc003c, 0xfffc003c, 0x01fc003c, 0xfefc003c, 0x02fc003c, 0xfdfc003c, 0x03fc003c, 0xfcfc003c,
+    0x0000ff14, 0x0000ff14, 0x0000ff14, 0x0000ff14, 0x0000ff14, 0x0000ff14, 0x0000ff14, 0x0000ff14,
+    0x0010ff2c, 0x00efff2c, 0x0011ff2c, 0x00eeff2c, 0x0012ff2c, 0x00edff2c, 0x0013ff2c, 0x00ecff2c,
+    0x000cff2b, 0x000cff2b, 0x00f3ff2b, 0x00f3ff2b, 0x000dff2b, 0x000dff2b, 0x00f2ff2b, 0x00f2ff2b,
+    0x000eff2b, 0x000eff2b, 0x00f1ff2b, 0x00f1ff2b, 0x000fff2b, 0x000fff2b, 0x00f0ff2b, 0x00f0ff2b,
+    0x0008ff2a, 0x0008ff2a, 0x0008ff2a, 0x0008ff2a, 0x00f7ff2a, 0x00f7ff2a, 0x00f7ff2a, 0x00f7ff2a,
+    0x0009ff2a, 0x0009ff2a, 0x0009ff2a, 0x0009ff2a, 0x00f6ff2a, 0x00f6ff2a, 0x00f6ff2a, 0x00f6ff2a,
+    0x000aff2a, 0x000aff2a, 0x000aff2a, 0x000aff2a, 0x00f5ff2a, 0x00f5ff2a, 0x00f5ff2a, 0x00f5ff2a,
+    0x000bff2a, 0x000bff2a, 0x000bff2a, 0x000bff2a, 0x00f4ff2a, 0x00f4ff2a, 0x00f4ff2a, 0x00f4ff2a,
+    0x0004ff29, 0x0004ff29, 0x0004ff29, 0x0004ff29, 0x0004ff29, 0x0004ff29, 0x0004ff29, 0x0004ff29,
+    0x00fbff29, 0x00fbff29, 0x00fbff29, 0x00fbff29, 0x00fbff29, 0x00fbff29, 0x00fbff29, 0x00fbff29,
+    0x0005ff29, 0x0005ff29, 0x0005ff29, 0x0005ff29, 0x0005ff29, 0x0005ff29, 0x0005ff29, 0x0005ff29,
+    0x00faff29, 0x00faff29, 0x00faff29, 0x00faff29, 0x00faff29, 0x00faff29, 0x00faff29, 0x00faff29,
+    0x0006ff29, 0x0006ff29, 0x0006ff29, 0x0006ff29, 0x0006ff29, 0x0006ff29, 0x0006ff29, 0x0006ff29,
+    0x00f9ff29, 0x00f9ff29, 0x00f9ff29, 0x00f9ff29, 0x00f9ff29, 0x00f9ff29, 0x00f9ff29, 0x00f9ff29,
+    0x0007ff29, 0x0007ff29, 0x0007ff29, 0x0007ff29, 0x0007ff29, 0x0007ff29, 0x0007ff29, 0x0007ff29,
+    0x00f8ff29, 0x00f8ff29, 0x00f8ff29, 0x00f8ff29, 0x00f8ff29, 0x00f8ff29, 0x00f8ff29, 0x00f8ff29,
+    0x0000ff28, 0x0000ff28, 0x0000ff28, 0x0000ff28, 0x0000ff28, 0x0000ff28, 0x0000ff28, 0x0000ff28,
+    0x0000ff3c, 0xff00ff3c, 0x0100ff3c, 0xfe00ff3c, 0x0200ff3c, 0xfd00ff3c, 0x0300ff3c, 0xfc00ff3c,
+    0x00ffff28, 0x00ffff28, 0x00ffff28, 0x00ffff28, 0x00ffff28, 0x00ffff28, 0x00ffff28, 0x00ffff28,
+    0x00ffff3c, 0xffffff3c, 0x01ffff3c, 0xfeffff3c, 0x02ffff3c, 0xfdffff3c, 0x03ffff3c, 0xfcffff3c,
+    0x0001ff28, 0x0001ff28, 0x0001ff28, 0x0001ff28, 0x0001ff28, 0x0001ff28, 0x0001ff28, 0x0001ff28,
+    0x0001ff3c, 0xff01ff3c, 0x0101ff3c, 0xfe01ff3c, 0x0201ff3c, 0xfd01ff3c, 0x0301ff3c, 0xfc01ff3c,
+    0x00feff28, 0x00feff28, 0x00feff28, 0x00feff28, 0x00feff28, 0x00feff28, 0x00feff28, 0x00feff28,
+    0x00feff3c, 0xfffeff3c, 0x01feff3c, 0xfefeff3c, 0x02feff3c, 0xfdfeff3c, 0x03feff3c, 0xfcfeff3c,
+    0x0002ff28, 0x0002ff28, 0x0002ff28, 0x0002ff28, 0x0002ff28, 0x0002ff28, 0x0002ff28, 0x0002ff28,
+    0x0002ff3c, 0xff02ff3c, 0x0102ff3c, 0xfe02ff3c, 0x0202ff3c, 0xfd02ff3c, 0x0302ff3c, 0xfc02ff3c,
+    0x00fdff28, 0x00fdff28, 0x00fdff28, 0x00fdff28, 0x00fdff28, 0x00fdff28, 0x00fdff28, 0x00fdff28,
+    0x00fdff3c, 0xfffdff3c, 0x01fdff3c, 0xfefdff3c, 0x02fdff3c, 0xfdfdff3c, 0x03fdff3c, 0xfcfdff3c,
+    0x0003ff28, 0x0003ff28, 0x0003ff28, 0x0003ff28, 0x0003ff28, 0x0003ff28, 0x0003ff28, 0x0003ff28,
+    0x0003ff3c, 0xff03ff3c, 0x0103ff3c, 0xfe03ff3c, 0x0203ff3c, 0xfd03ff3c, 0x0303ff3c, 0xfc03ff3c,
+    0x00fcff28, 0x00fcff28, 0x00fcff28, 0x00fcff28, 0x00fcff28, 0x00fcff28, 0x00fcff28, 0x00fcff28,
+    0x00fcff3c, 0xfffcff3c, 0x01fcff3c, 0xfefcff3c, 0x02fcff3c, 0xfdfcff3c, 0x03fcff3c, 0xfcfcff3c,
+    0x00000114, 0x00000114, 0x00000114, 0x00000114, 0x00000114, 0x00000114, 0x00000114, 0x00000114,
+    0x0010012c, 0x00ef012c, 0x0011012c, 0x00ee012c, 0x0012012c, 0x00ed012c, 0x0013012c, 0x00ec012c,
+    0x000c012b, 0x000c012b, 0x00f3012b, 0x00f3012b, 0x000d012b, 0x000d012b, 0x00f2012b, 0x00f2012b,
+    0x000e012b, 0x000e012b, 0x00f1012b, 0x00f1012b, 0x000f012b, 0x000f012b, 0x00f0012b, 0x00f0012b,
+    0x0008012a, 0x0008012a, 0x0008012a, 0x0008012a, 0x00f7012a, 0x00f7012a, 0x00f7012a, 0x00f7012a,
+    0x0009012a, 0x0009012a, 0x0009012a, 0x0009012a, 0x00f6012a, 0x00f6012a, 0x00f6012a, 0x00f6012a,
+    0x000a012a, 0x000a012a, 0x000a012a, 0x000a012a, 0x00f5012a, 0x00f5012a, 0x00f5012a, 0x00f5012a,
+    0x000b012a, 0x000b012a, 0x000b012a, 0x000b012a, 0x00f4012a, 0x00f4012a, 0x00f4012a, 0x00f4012a,
+    0x00040129, 0x00040129, 0x00040129, 0x00040129, 0x00040129, 0x00040129, 0x00040129, 0x00040129,
+    0x00fb0129, 0x00fb0129, 0x00fb0129, 0x00fb0129, 0x00fb0129, 0x00fb0129, 0x00fb0129, 0x00fb0129,
+    0x00050129, 0x00050129, 0x00050129, 0x00050129, 0x00050129, 0x00050129, 0x00050129, 0x00050129,
+    0x00fa0129, 0x00fa0129, 0x00fa0129, 0x00fa0129, 0x00fa0129, 0x00fa0129, 0x00fa0129, 0x00fa0129,
+    0x00060129, 0x00060129, 0x00060129, 0x00060129, 0x00060129, 0x00060129, 0x00060129, 0x00060129,
+    0x00f90129, 0x00f90129, 0x00f90129, 0x00f90129, 0x00f90129, 0x00f90129, 0x00f90129, 0x00f90129,
+    0x00070129, 0x00070129, 0x00070129, 0x00070129, 0x00070129, 0x00070129, 0x00070129, 0x00070129,
+    0x00f80129, 0x00f80129, 0x00f80129, 0x00f80129, 0x00f80129, 0x00f80129, 0x00f80129, 0x00f80129,
+    0x00000128, 0x00000128, 0x00000128, 0x00000128, 0x00000128, 0x00000128, 0x00000128, 0x00000128,
+    0x0000013c, 0xff00013c, 0x0100013c, 0xfe00013c, 0x0200013c, 0xfd00013c, 0x0300013c, 0xfc00013c,
+    0x00ff0128, 0x00ff0128, 0x00ff0128, 0x00ff0128, 0x00ff0128, 0x00ff0128, 0x00ff0128, 0x00ff0128,
+    0x00ff013c, 0xffff013c, 0x01ff013c, 0xfeff013c, 0x02ff013c, 0xfdff013c, 0x03ff013c, 0xfcff013c,
+    0x00010128, 0x00010128, 0x00010128, 0x00010128, 0x00010128, 0x00010128, 0x00010128, 0x00010128,
+    0x0001013c, 0xff01013c, 0x0101013c, 0xfe01013c, 0x0201013c, 0xfd01013c, 0x0301013c, 0xfc01013c,
+    0x00fe0128, 0x00fe0128, 0x00fe0128, 0x00fe0128, 0x00fe0128, 0x00fe0128, 0x00fe0128, 0x00fe0128,
+    0x00fe013c, 0xfffe013c, 0x01fe013c, 0xfefe013c, 0x02fe013c, 0xfdfe013c, 0x03fe013c, 0xfcfe013c,
+    0x00020128, 0x00020128, 0x00020128, 0x00020128, 0x00020128, 0x00020128, 0x00020128, 0x00020128,
+    0x0002013c, 0xff02013c, 0x0102013c, 0xfe02013c, 0x0202013c, 0xfd02013c, 0x0302013c, 0xfc02013c,
+    0x00fd0128, 0x00fd0128, 0x00fd0128, 0x00fd0128, 0x00fd0128, 0x00fd0128, 0x00fd0128, 0x00fd0128,
+    0x00fd013c, 0xfffd013c, 0x01fd013c, 0xfefd013c, 0x02fd013c, 0xfdfd013c, 0x03fd013c, 0xfcfd013c,
+    0x00030128, 0x00030128, 0x00030128, 0x00030128, 0x00030128, 0x00030128, 0x00030128, 0x00030128,
+    0x0003013c, 0xff03013c, 0x0103013c, 0xfe03013c, 0x0203013c, 0xfd03013c, 0x0303013c, 0xfc03013c,
+    0x00fc0128, 0x00fc0128, 0x00fc0128, 0x00fc0128, 0x00fc0128, 0x00fc0128, 0x00fc0128, 0x00fc0128,
+    0x00fc013c, 0xfffc013c, 0x01fc013c, 0xfefc013c, 0x02fc013c, 0xfdfc013c, 0x03fc013c, 0xfcfc013c,
+    0x0000fe14, 0x0000fe14, 0x0000fe14, 0x0000fe14, 0x0000fe14, 0x0000fe14, 0x0000fe14, 0x0000fe14,
+    0x0010fe2c, 0x00effe2c, 0x0011fe2c, 0x00eefe2c, 0x0012fe2c, 0x00edfe2c, 0x0013fe2c, 0x00ecfe2c,
+    0x000cfe2b, 0x000cfe2b, 0x00f3fe2b, 0x00f3fe2b, 0x000dfe2b, 0x000dfe2b, 0x00f2fe2b, 0x00f2fe2b,
+    0x000efe2b, 0x000efe2b, 0x00f1fe2b, 0x00f1fe2b, 0x000ffe2b, 0x000ffe2b, 0x00f0fe2b, 0x00f0fe2b,
+    0x0008fe2a, 0x0008fe2a, 0x0008fe2a, 0x0008fe2a, 0x00f7fe2a, 0x00f7fe2a, 0x00f7fe2a, 0x00f7fe2a,
+    0x0009fe2a, 0x0009fe2a, 0x0009fe2a, 0x0009fe2a, 0x00f6fe2a, 0x00f6fe2a, 0x00f6fe2a, 0x00f6fe2a,
+    0x000afe2a, 0x000afe2a, 0x000afe2a, 0x000afe2a, 0x00f5fe2a, 0x00f5fe2a, 0x00f5fe2a, 0x00f5fe2a,
+    0x000bfe2a, 0x000bfe2a, 0x000bfe2a, 0x000bfe2a, 0x00f4fe2a, 0x00f4fe2a, 0x00f4fe2a, 0x00f4fe2a,
+    0x0004fe29, 0x0004fe29, 0x0004fe29, 0x0004fe29, 0x0004fe29, 0x0004fe29, 0x0004fe29, 0x0004fe29,
+    0x00fbfe29, 0x00fbfe29, 0x00fbfe29, 0x00fbfe29, 0x00fbfe29, 0x00fbfe29, 0x00fbfe29, 0x00fbfe29,
+    0x0005fe29, 0x0005fe29, 0x0005fe29, 0x0005fe29, 0x0005fe29, 0x0005fe29, 0x0005fe29, 0x0005fe29,
+    0x00fafe29, 0x00fafe29, 0x00fafe29, 0x00fafe29, 0x00fafe29, 0x00fafe29, 0x00fafe29, 0x00fafe29,
+    0x0006fe29, 0x0006fe29, 0x0006fe29, 0x0006fe29, 0x0006fe29, 0x0006fe29, 0x0006fe29, 0x0006fe29,
+    0x00f9fe29, 0x00f9fe29, 0x00f9fe29, 0x00f9fe29, 0x00f9fe29, 0x00f9fe29, 0x00f9fe29, 0x00f9fe29,
+    0x0007fe29, 0x0007fe29, 0x0007fe29, 0x0007fe29, 0x0007fe29, 0x0007fe29, 0x0007fe29, 0x0007fe29,
+    0x00f8fe29, 0x00f8fe29, 0x00f8fe29, 0x00f8fe29, 0x00f8fe29, 0x00f8fe29, 0x00f8fe29, 0x00f8fe29,
+    0x0000fe28, 0x0000fe28, 0x0000fe28, 0x0000fe28, 0x0000fe28, 0x0000fe28, 0x0000fe28, 0x0000fe28,
+    0x0000fe3c, 0xff00fe3c, 0x0100fe3c, 0xfe00fe3c, 0x0200fe3c, 0xfd00fe3c, 0x0300fe3c, 0xfc00fe3c,
+    0x00fffe28, 0x00fffe28, 0x00fffe28, 0x00fffe28, 0x00fffe28, 0x00fffe28, 0x00fffe28, 0x00fffe28,
+    0x00fffe3c, 0xfffffe3c, 0x01fffe3c, 0xfefffe3c, 0x02fffe3c, 0xfdfffe3c, 0x03fffe3c, 0xfcfffe3c,
+    0x0001fe28, 0x0001fe28, 0x0001fe28, 0x0001fe28, 0x0001fe28, 0x0001fe28, 0x0001fe28, 0x0001fe28,
+    0x0001fe3c, 0xff01fe3c, 0x0101fe3c, 0xfe01fe3c, 0x0201fe3c, 0xfd01fe3c, 0x0301fe3c, 0xfc01fe3c,
+    0x00fefe28, 0x00fefe28, 0x00fefe28, 0x00fefe28, 0x00fefe28, 0x00fefe28, 0x00fefe28, 0x00fefe28,
+    0x00fefe3c, 0xfffefe3c, 0x01fefe3c, 0xfefefe3c, 0x02fefe3c, 0xfdfefe3c, 0x03fefe3c, 0xfcfefe3c,
+    0x0002fe28, 0x0002fe28, 0x0002fe28, 0x0002fe28, 0x0002fe28, 0x0002fe28, 0x0002fe28, 0x0002fe28,
+    0x0002fe3c, 0xff02fe3c, 0x0102fe3c, 0xfe02fe3c, 0x0202fe3c, 0xfd02fe3c, 0x0302fe3c, 0xfc02fe3c,
+    0x00fdfe28, 0x00fdfe28, 0x00fdfe28, 0x00fdfe28, 0x00fdfe28, 0x00fdfe28, 0x00fdfe28, 0x00fdfe28,
+    0x00fdfe3c, 0xfffdfe3c, 0x01fdfe3c, 0xfefdfe3c, 0x02fdfe3c, 0xfdfdfe3c, 0x03fdfe3c, 0xfcfdfe3c,
+    0x0003fe28, 0x0003fe28, 0x0003fe28, 0x0003fe28, 0x0003fe28, 0x0003fe28, 0x0003fe28, 0x0003fe28,
+    0x0003fe3c, 0xff03fe3c, 0x0103fe3c, 0xfe03fe3c, 0x0203fe3c, 0xfd03fe3c, 0x0303fe3c, 0xfc03fe3c,
+    0x00fcfe28, 0x00fcfe28, 0x00fcfe28, 0x00fcfe28, 0x00fcfe28, 0x00fcfe28, 0x00fcfe28, 0x00fcfe28,
+    0x00fcfe3c, 0xfffcfe3c, 0x01fcfe3c, 0xfefcfe3c, 0x02fcfe3c, 0xfdfcfe3c, 0x03fcfe3c, 0xfcfcfe3c,
+    0x00000214, 0x00000214, 0x00000214, 0x00000214, 0x00000214, 0x00000214, 0x00000214, 0x00000214,
+    0x0010022c, 0x00ef022c, 0x0011022c, 0x00ee022c, 0x0012022c, 0x00ed022c, 0x0013022c, 0x00ec022c,
+    0x000c022b, 0x000c022b, 0x00f3022b, 0x00f3022b, 0x000d022b, 0x000d022b, 0x00f2022b, 0x00f2022b,
+    0x000e022b, 0x000e022b, 0x00f1022b, 0x00f1022b, 0x000f022b, 0x000f022b, 0x00f0022b, 0x00f0022b,
+    0x0008022a, 0x0008022a, 0x0008022a, 0x0008022a, 0x00f7022a, 0x00f7022a, 0x00f7022a, 0x00f7022a,
+    0x0009022a, 0x0009022a, 0x0009022a, 0x0009022a, 0x00f6022a, 0x00f6022a, 0x00f6022a, 0x00f6022a,
+    0x000a022a, 0x000a022a, 0x000a022a, 0x000a022a, 0x00f5022a, 0x00f5022a, 0x00f5022a, 0x00f5022a,
+    0x000b022a, 0x000b022a, 0x000b022a, 0x000b022a, 0x00f4022a, 0x00f4022a, 0x00f4022a, 0x00f4022a,
+    0x00040229, 0x00040229, 0x00040229, 0x00040229, 0x00040229, 0x00040229, 0x00040229, 0x00040229,
+    0x00fb0229, 0x00fb0229, 0x00fb0229, 0x00fb0229, 0x00fb0229, 0x00fb0229, 0x00fb0229, 0x00fb0229,
+    0x00050229, 0x00050229, 0x00050229, 0x00050229, 0x00050229, 0x00050229, 0x00050229, 0x00050229,
+    0x00fa0229, 0x00fa0229, 0x00fa0229, 0x00fa0229, 0x00fa0229, 0x00fa0229, 0x00fa0229, 0x00fa0229,
+    0x00060229, 0x00060229, 0x00060229, 0x00060229, 0x00060229, 0x00060229, 0x00060229, 0x00060229,
+    0x00f90229, 0x00f90229, 0x00f90229, 0x00f90229, 0x00f90229, 0x00f90229, 0x00f90229, 0x00f90229,
+    0x00070229, 0x00070229, 0x00070229, 0x00070229, 0x00070229, 0x00070229, 0x00070229, 0x00070229,
+    0x00f80229, 0x00f80229, 0x00f80229, 0x00f80229, 0x00f80229, 0x00f80229, 0x00f80229, 0x00f80229,
+    0x00000228, 0x00000228, 0x00000228, 0x00000228, 0x00000228, 0x00000228, 0x00000228, 0x00000228,
+    0x0000023c, 0xff00023c, 0x0100023c, 0xfe00023c, 0x0200023c, 0xfd00023c, 0x0300023c, 0xfc00023c,
+    0x00ff0228, 0x00ff0228, 0x00ff0228, 0x00ff0228, 0x00ff0228, 0x00ff0228, 0x00ff0228, 0x00ff0228,
+    0x00ff023c, 0xffff023c, 0x01ff023c, 0xfeff023c, 0x02ff023c, 0xfdff023c, 0x03ff023c, 0xfcff023c,
+    0x00010228, 0x00010228, 0x00010228, 0x00010228, 0x00010228, 0x00010228, 0x00010228, 0x00010228,
+    0x0001023c, 0xff01023c, 0x0101023c, 0xfe01023c, 0x0201023c, 0xfd01023c, 0x0301023c, 0xfc01023c,
+    0x00fe0228, 0x00fe0228, 0x00fe0228, 0x00fe0228, 0x00fe0228, 0x00fe0228, 0x00fe0228, 0x00fe0228,
+    0x00fe023c, 0xfffe023c, 0x01fe023c, 0xfefe023c, 0x02fe023c, 0xfdfe023c, 0x03fe023c, 0xfcfe023c,
+    0x00020228, 0x00020228, 0x00020228, 0x00020228, 0x00020228, 0x00020228, 0x00020228, 0x00020228,
+    0x0002023c, 0xff02023c, 0x0102023c, 0xfe02023c, 0x0202023c, 0xfd02023c, 0x0302023c, 0xfc02023c,
+    0x00fd0228, 0x00fd0228, 0x00fd0228, 0x00fd0228, 0x00fd0228, 0x00fd0228, 0x00fd0228, 0x00fd0228,
+    0x00fd023c, 0xfffd023c, 0x01fd023c, 0xfefd023c, 0x02fd023c, 0xfdfd023c, 0x03fd023c, 0xfcfd023c,
+    0x00030228, 0x00030228, 0x00030228, 0x00030228, 0x00030228, 0x00030228, 0x00030228, 0x00030228,
+    0x0003023c, 0xff03023c, 0x0103023c, 0xfe03023c, 0x0203023c, 0xfd03023c, 0x0303023c, 0xfc03023c,
+    0x00fc0228, 0x00fc0228, 0x00fc0228, 0x00fc0228, 0x00fc0228, 0x00fc0228, 0x00fc0228, 0x00fc0228,
+    0x00fc023c, 0xfffc023c, 0x01fc023c, 0xfefc023c, 0x02fc023c, 0xfdfc023c, 0x03fc023c, 0xfcfc023c,
+    0x0000fd14, 0x0000fd14, 0x0000fd14, 0x0000fd14, 0x0000fd14, 0x0000fd14, 0x0000fd14, 0x0000fd14,
+    0x0010fd2c, 0x00effd2c, 0x0011fd2c, 0x00eefd2c, 0x0012fd2c, 0x00edfd2c, 0x0013fd2c, 0x00ecfd2c,
+    0x000cfd2b, 0x000cfd2b, 0x00f3fd2b, 0x00f3fd2b, 0x000dfd2b, 0x000dfd2b, 0x00f2fd2b, 0x00f2fd2b,
+    0x000efd2b, 0x000efd2b, 0x00f1fd2b, 0x00f1fd2b, 0x000ffd2b, 0x000ffd2b, 0x00f0fd2b, 0x00f0fd2b,
+    0x0008fd2a, 0x0008fd2a, 0x0008fd2a, 0x0008fd2a, 0x00f7fd2a, 0x00f7fd2a, 0x00f7fd2a, 0x00f7fd2a,
+    0x0009fd2a, 0x0009fd2a, 0x0009fd2a, 0x0009fd2a, 0x00f6fd2a, 0x00f6fd2a, 0x00f6fd2a, 0x00f6fd2a,
+    0x000afd2a, 0x000afd2a, 0x000afd2a, 0x000afd2a, 0x00f5fd2a, 0x00f5fd2a, 0x00f5fd2a, 0x00f5fd2a,
+    0x000bfd2a, 0x000bfd2a, 0x000bfd2a, 0x000bfd2a, 0x00f4fd2a, 0x00f4fd2a, 0x00f4fd2a, 0x00f4fd2a,
+    0x0004fd29, 0x0004fd29, 0x0004fd29, 0x0004fd29, 0x0004fd29, 0x0004fd29, 0x0004fd29, 0x0004fd29,
+    0x00fbfd29, 0x00fbfd29, 0x00fbfd29, 0x00fbfd29, 0x00fbfd29, 0x00fbfd29, 0x00fbfd29, 0x00fbfd29,
+    0x0005fd29, 0x0005fd29, 0x0005fd29, 0x0005fd29, 0x0005fd29, 0x0005fd29, 0x0005fd29, 0x0005fd29,
+    0x00fafd29, 0x00fafd29, 0x00fafd29, 0x00fafd29, 0x00fafd29, 0x00fafd29, 0x00fafd29, 0x00fafd29,
+    0x0006fd29, 0x0006fd29, 0x0006fd29, 0x0006fd29, 0x0006fd29, 0x0006fd29, 0x0006fd29, 0x0006fd29,
+    0x00f9fd29, 0x00f9fd29, 0x00f9fd29, 0x00f9fd29, 0x00f9fd29, 0x00f9fd29, 0x00f9fd29, 0x00f9fd29,
+    0x0007fd29, 0x0007fd29, 0x0007fd29, 0x0007fd29, 0x0007fd29, 0x0007fd29, 0x0007fd29, 0x0007fd29,
+    0x00f8fd29, 0x00f8fd29, 0x00f8fd29, 0x00f8fd29, 0x00f8fd29, 0x00f8fd29, 0x00f8fd29, 0x00f8fd29,
+    0x0000fd28, 0x0000fd28, 0x0000fd28, 0x0000fd28, 0x0000fd28, 0x0000fd28, 0x0000fd28, 0x0000fd28,
+    0x0000fd3c, 0xff00fd3c, 0x0100fd3c, 0xfe00fd3c, 0x0200fd3c, 0xfd00fd3c, 0x0300fd3c, 0xfc00fd3c,
+    0x00fffd28, 0x00fffd28, 0x00fffd28, 0x00fffd28, 0x00fffd28, 0x00fffd28, 0x00fffd28, 0x00fffd28,
+    0x00fffd3c, 0xfffffd3c, 0x01fffd3c, 0xfefffd3c, 0x02fffd3c, 0xfdfffd3c, 0x03fffd3c, 0xfcfffd3c,
+    0x0001fd28, 0x0001fd28, 0x0001fd28, 0x0001fd28, 0x0001fd28, 0x0001fd28, 0x0001fd28, 0x0001fd28,
+    0x0001fd3c, 0xff01fd3c, 0x0101fd3c, 0xfe01fd3c, 0x0201fd3c, 0xfd01fd3c, 0x0301fd3c, 0xfc01fd3c,
+    0x00fefd28, 0x00fefd28, 0x00fefd28, 0x00fefd28, 0x00fefd28, 0x00fefd28, 0x00fefd28, 0x00fefd28,
+    0x00fefd3c, 0xfffefd3c, 0x01fefd3c, 0xfefefd3c, 0x02fefd3c, 0xfdfefd3c, 0x03fefd3c, 0xfcfefd3c,
+    0x0002fd28, 0x0002fd28, 0x0002fd28, 0x0002fd28, 0x0002fd28, 0x0002fd28, 0x0002fd28, 0x0002fd28,
+    0x0002fd3c, 0xff02fd3c, 0x0102fd3c, 0xfe02fd3c, 0x0202fd3c, 0xfd02fd3c, 0x0302fd3c, 0xfc02fd3c,
+    0x00fdfd28, 0x00fdfd28, 0x00fdfd28, 0x00fdfd28, 0x00fdfd28, 0x00fdfd28, 0x00fdfd28, 0x00fdfd28,
+    0x00fdfd3c, 0xfffdfd3c, 0x01fdfd3c, 0xfefdfd3c, 0x02fdfd3c, 0xfdfdfd3c, 0x03fdfd3c, 0xfcfdfd3c,
+    0x0003fd28, 0x0003fd28, 0x0003fd28, 0x0003fd28, 0x0003fd28, 0x0003fd28, 0x0003fd28, 0x0003fd28,
+    0x0003fd3c, 0xff03fd3c, 0x0103fd3c, 0xfe03fd3c, 0x0203fd3c, 0xfd03fd3c, 0x0303fd3c, 0xfc03fd3c,
+    0x00fcfd28, 0x00fcfd28, 0x00fcfd28, 0x00fcfd28, 0x00fcfd28, 0x00fcfd28, 0x00fcfd28, 0x00fcfd28,
+    0x00fcfd3c, 0xfffcfd3c, 0x01fcfd3c, 0xfefcfd3c, 0x02fcfd3c, 0xfdfcfd3c, 0x03fcfd3c, 0xfcfcfd3c,
+    0x00000314, 0x00000314, 0x00000314, 0x00000314, 0x00000314, 0x00000314, 0x00000314, 0x00000314,
+    0x0010032c, 0x00ef032c, 0x0011032c, 0x00ee032c, 0x0012032c, 0x00ed032c, 0x0013032c, 0x00ec032c,
+    0x000c032b, 0x000c032b, 0x00f3032b, 0x00f3032b, 0x000d032b, 0x000d032b, 0x00f2032b, 0x00f2032b,
+    0x000e032b, 0x000e032b, 0x00f1032b, 0x00f1032b, 0x000f032b, 0x000f032b, 0x00f0032b, 0x00f0032b,
+    0x0008032a, 0x0008032a, 0x0008032a, 0x0008032a, 0x00f7032a, 0x00f7032a, 0x00f7032a, 0x00f7032a,
+    0x0009032a, 0x0009032a, 0x0009032a, 0x0009032a, 0x00f6032a, 0x00f6032a, 0x00f6032a, 0x00f6032a,
+    0x000a032a, 0x000a032a, 0x000a032a, 0x000a032a, 0x00f5032a, 0x00f5032a, 0x00f5032a, 0x00f5032a,
+    0x000b032a, 0x000b032a, 0x000b032a, 0x000b032a, 0x00f4032a, 0x00f4032a, 0x00f4032a, 0x00f4032a,
+    0x00040329, 0x00040329, 0x00040329, 0x00040329, 0x00040329, 0x00040329, 0x00040329, 0x00040329,
+    0x00fb0329, 0x00fb0329, 0x00fb0329, 0x00fb0329, 0x00fb0329, 0x00fb0329, 0x00fb0329, 0x00fb0329,
+    0x00050329, 0x00050329, 0x00050329, 0x00050329, 0x00050329, 0x00050329, 0x00050329, 0x00050329,
+    0x00fa0329, 0x00fa0329, 0x00fa0329, 0x00fa0329, 0x00fa0329, 0x00fa0329, 0x00fa0329, 0x00fa0329,
+    0x00060329, 0x00060329, 0x00060329, 0x00060329, 0x00060329, 0x00060329, 0x00060329, 0x00060329,
+    0x00f90329, 0x00f90329, 0x00f90329, 0x00f90329, 0x00f90329, 0x00f90329, 0x00f90329, 0x00f90329,
+    0x00070329, 0x00070329, 0x00070329, 0x00070329, 0x00070329, 0x00070329, 0x00070329, 0x00070329,
+    0x00f80329, 0x00f80329, 0x00f80329, 0x00f80329, 0x00f80329, 0x00f80329, 0x00f80329, 0x00f80329,
+    0x00000328, 0x00000328, 0x00000328, 0x00000328, 0x00000328, 0x00000328, 0x00000328, 0x00000328,
+    0x0000033c, 0xff00033c, 0x0100033c, 0xfe00033c, 0x0200033c, 0xfd00033c, 0x0300033c, 0xfc00033c,
+    0x00ff0328, 0x00ff0328, 0x00ff0328, 0x00ff0328, 0x00ff0328, 0x00ff0328, 0x00ff0328, 0x00ff0328,
+    0x00ff033c, 0xffff033c, 0x01ff033c, 0xfeff033c, 0x02ff033c, 0xfdff033c, 0x03ff033c, 0xfcff033c,
+    0x00010328, 0x00010328, 0x00010328, 0x00010328, 0x00010328, 0x00010328, 0x00010328, 0x00010328,
+    0x0001033c, 0xff01033c, 0x0101033c, 0xfe01033c, 0x0201033c, 0xfd01033c, 0x0301033c, 0xfc01033c,
+    0x00fe0328, 0x00fe0328, 0x00fe0328, 0x00fe0328, 0x00fe0328, 0x00fe0328, 0x00fe0328, 0x00fe0328,
+    0x00fe033c, 0xfffe033c, 0x01fe033c, 0xfefe033c, 0x02fe033c, 0xfdfe033c, 0x03fe033c, 0xfcfe033c,
+    0x00020328, 0x00020328, 0x00020328, 0x00020328, 0x00020328, 0x00020328, 0x00020328, 0x00020328,
+    0x0002033c, 0xff02033c, 0x0102033c, 0xfe02033c, 0x0202033c, 0xfd02033c, 0x0302033c, 0xfc02033c,
+    0x00fd0328, 0x00fd0328, 0x00fd0328, 0x00fd0328, 0x00fd0328, 0x00fd0328, 0x00fd0328, 0x00fd0328,
+    0x00fd033c, 0xfffd033c, 0x01fd033c, 0xfefd033c, 0x02fd033c, 0xfdfd033c, 0x03fd033c, 0xfcfd033c,
+    0x00030328, 0x00030328, 0x00030328, 0x00030328, 0x00030328, 0x00030328, 0x00030328, 0x00030328,
+    0x0003033c, 0xff03033c, 0x0103033c, 0xfe03033c, 0x0203033c, 0xfd03033c, 0x0303033c, 0xfc03033c,
+    0x00fc0328, 0x00fc0328, 0x00fc0328, 0x00fc0328, 0x00fc0328, 0x00fc0328, 0x00fc0328, 0x00fc0328,
+    0x00fc033c, 0xfffc033c, 0x01fc033c, 0xfefc033c, 0x02fc033c, 0xfdfc033c, 0x03fc033c, 0xfcfc033c,
+    0x0000fc14, 0x0000fc14, 0x0000fc14, 0x0000fc14, 0x0000fc14, 0x0000fc14, 0x0000fc14, 0x0000fc14,
+    0x0010fc2c, 0x00effc2c, 0x0011fc2c, 0x00eefc2c, 0x0012fc2c, 0x00edfc2c, 0x0013fc2c, 0x00ecfc2c,
+    0x000cfc2b, 0x000cfc2b, 0x00f3fc2b, 0x00f3fc2b, 0x000dfc2b, 0x000dfc2b, 0x00f2fc2b, 0x00f2fc2b,
+    0x000efc2b, 0x000efc2b, 0x00f1fc2b, 0x00f1fc2b, 0x000ffc2b, 0x000ffc2b, 0x00f0fc2b, 0x00f0fc2b,
+    0x0008fc2a, 0x0008fc2a, 0x0008fc2a, 0x0008fc2a, 0x00f7fc2a, 0x00f7fc2a, 0x00f7fc2a, 0x00f7fc2a,
+    0x0009fc2a, 0x0009fc2a, 0x0009fc2a, 0x0009fc2a, 0x00f6fc2a, 0x00f6fc2a, 0x00f6fc2a, 0x00f6fc2a,
+    0x000afc2a, 0x000afc2a, 0x000afc2a, 0x000afc2a, 0x00f5fc2a, 0x00f5fc2a, 0x00f5fc2a, 0x00f5fc2a,
+    0x000bfc2a, 0x000bfc2a, 0x000bfc2a, 0x000bfc2a, 0x00f4fc2a, 0x00f4fc2a, 0x00f4fc2a, 0x00f4fc2a,
+    0x0004fc29, 0x0004fc29, 0x0004fc29, 0x0004fc29, 0x0004fc29, 0x0004fc29, 0x0004fc29, 0x0004fc29,
+    0x00fbfc29, 0x00fbfc29, 0x00fbfc29, 0x00fbfc29, 0x00fbfc29, 0x00fbfc29, 0x00fbfc29, 0x00fbfc29,
+    0x0005fc29, 0x0005fc29, 0x0005fc29, 0x0005fc29, 0x0005fc29, 0x0005fc29, 0x0005fc29, 0x0005fc29,
+    0x00fafc29, 0x00fafc29, 0x00fafc29, 0x00fafc29, 0x00fafc29, 0x00fafc29, 0x00fafc29, 0x00fafc29,
+    0x0006fc29, 0x0006fc29, 0x0006fc29, 0x0006fc29, 0x0006fc29, 0x0006fc29, 0x0006fc29, 0x0006fc29,
+    0x00f9fc29, 0x00f9fc29, 0x00f9fc29, 0x00f9fc29, 0x00f9fc29, 0x00f9fc29, 0x00f9fc29, 0x00f9fc29,
+    0x0007fc29, 0x0007fc29, 0x0007fc29, 0x0007fc29, 0x0007fc29, 0x0007fc29, 0x0007fc29, 0x0007fc29,
+    0x00f8fc29, 0x00f8fc29, 0x00f8fc29, 0x00f8fc29, 0x00f8fc29, 0x00f8fc29, 0x00f8fc29, 0x00f8fc29,
+    0x0000fc28, 0x0000fc28, 0x0000fc28, 0x0000fc28, 0x0000fc28, 0x0000fc28, 0x0000fc28, 0x0000fc28,
+    0x0000fc3c, 0xff00fc3c, 0x0100fc3c, 0xfe00fc3c, 0x0200fc3c, 0xfd00fc3c, 0x0300fc3c, 0xfc00fc3c,
+    0x00fffc28, 0x00fffc28, 0x00fffc28, 0x00fffc28, 0x00fffc28, 0x00fffc28, 0x00fffc28, 0x00fffc28,
+    0x00fffc3c, 0xfffffc3c, 0x01fffc3c, 0xfefffc3c, 0x02fffc3c, 0xfdfffc3c, 0x03fffc3c, 0xfcfffc3c,
+    0x0001fc28, 0x0001fc28, 0x0001fc28, 0x0001fc28, 0x0001fc28, 0x0001fc28, 0x0001fc28, 0x0001fc28,
+    0x0001fc3c, 0xff01fc3c, 0x0101fc3c, 0xfe01fc3c, 0x0201fc3c, 0xfd01fc3c, 0x0301fc3c, 0xfc01fc3c,
+    0x00fefc28, 0x00fefc28, 0x00fefc28, 0x00fefc28, 0x00fefc28, 0x00fefc28, 0x00fefc28, 0x00fefc28,
+    0x00fefc3c, 0xfffefc3c, 0x01fefc3c, 0xfefefc3c, 0x02fefc3c, 0xfdfefc3c, 0x03fefc3c, 0xfcfefc3c,
+    0x0002fc28, 0x0002fc28, 0x0002fc28, 0x0002fc28, 0x0002fc28, 0x0002fc28, 0x0002fc28, 0x0002fc28,
+    0x0002fc3c, 0xff02fc3c, 0x0102fc3c, 0xfe02fc3c, 0x0202fc3c, 0xfd02fc3c, 0x0302fc3c, 0xfc02fc3c,
+    0x00fdfc28, 0x00fdfc28, 0x00fdfc28, 0x00fdfc28, 0x00fdfc28, 0x00fdfc28, 0x00fdfc28, 0x00fdfc28,
+    0x00fdfc3c, 0xfffdfc3c, 0x01fdfc3c, 0xfefdfc3c, 0x02fdfc3c, 0xfdfdfc3c, 0x03fdfc3c, 0xfcfdfc3c,
+    0x0003fc28, 0x0003fc28, 0x0003fc28, 0x0003fc28, 0x0003fc28, 0x0003fc28, 0x0003fc28, 0x0003fc28,
+    0x0003fc3c, 0xff03fc3c, 0x0103fc3c, 0xfe03fc3c, 0x0203fc3c, 0xfd03fc3c, 0x0303fc3c, 0xfc03fc3c,
+    0x00fcfc28, 0x00fcfc28, 0x00fcfc28, 0x00fcfc28, 0x00fcfc28, 0x00fcfc28, 0x00fcfc28, 0x00fcfc28,
+    0x00fcfc3c, 0xfffcfc3c, 0x01fcfc3c, 0xfefcfc3c, 0x02fcfc3c, 0xfdfcfc3c, 0x03fcfc3c, 0xfcfcfc3c,
+  },
+  {
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x0000381c, 0x0000c71c, 0x0000391c, 0x0000c61c, 0x00003a1c, 0x0000c51c, 0x00003b1c, 0x0000c41c,
+    0x00003c1c, 0x0000c31c, 0x00003d1c, 0x0000c21c, 0x00003e1c, 0x0000c11c, 0x00003f1c, 0x0000c01c,
+    0x0000301b, 0x0000301b, 0x0000cf1b, 0x0000cf1b, 0x0000311b, 0x0000311b, 0x0000ce1b, 0x0000ce1b,
+    0x0000321b, 0x0000321b, 0x0000cd1b, 0x0000cd1b, 0x0000331b, 0x0000331b, 0x0000cc1b, 0x0000cc1b,
+    0x0000341b, 0x0000341b, 0x0000cb1b, 0x0000cb1b, 0x0000351b, 0x0000351b, 0x0000ca1b, 0x0000ca1b,
+    0x0000361b, 0x0000361b, 0x0000c91b, 0x0000c91b, 0x0000371b, 0x0000371b, 0x0000c81b, 0x0000c81b,
+    0x0000281a, 0x0000281a, 0x0000281a, 0x0000281a, 0x0000d71a, 0x0000d71a, 0x0000d71a, 0x0000d71a,
+    0x0000291a, 0x0000291a, 0x0000291a, 0x0000291a, 0x0000d61a, 0x0000d61a, 0x0000d61a, 0x0000d61a,
+    0x00002a1a, 0x00002a1a, 0x00002a1a, 0x00002a1a, 0x0000d51a, 0x0000d51a, 0x0000d51a, 0x0000d51a,
+    0x00002b1a, 0x00002b1a, 0x00002b1a, 0x00002b1a, 0x0000d41a, 0x0000d41a, 0x0000d41a, 0x0000d41a,
+    0x00002c1a, 0x00002c1a, 0x00002c1a, 0x00002c1a, 0x0000d31a, 0x0000d31a, 0x0000d31a, 0x0000d31a,
+    0x00002d1a, 0x00002d1a, 0x00002d1a, 0x00002d1a, 0x0000d21a, 0x0000d21a, 0x0000d21a, 0x0000d21a,
+    0x00002e1a, 0x00002e1a, 0x00002e1a, 0x00002e1a, 0x0000d11a, 0x0000d11a, 0x0000d11a, 0x0000d11a,
+    0x00002f1a, 0x00002f1a, 0x00002f1a, 0x00002f1a, 0x0000d01a, 0x0000d01a, 0x0000d01a, 0x0000d01a,
+    0x00002019, 0x00002019, 0x00002019, 0x00002019, 0x00002019, 0x00002019, 0x00002019, 0x00002019,
+    0x0000df19, 0x0000df19, 0x0000df19, 0x0000df19, 0x0000df19, 0x0000df19, 0x0000df19, 0x0000df19,
+    0x00002119, 0x00002119, 0x00002119, 0x00002119, 0x00002119, 0x00002119, 0x00002119, 0x00002119,
+    0x0000de19, 0x0000de19, 0x0000de19, 0x0000de19, 0x0000de19, 0x0000de19, 0x0000de19, 0x0000de19,
+    0x00002219, 0x00002219, 0x00002219, 0x00002219, 0x00002219, 0x00002219, 0x00002219, 0x00002219,
+    0x0000dd19, 0x0000dd19, 0x0000dd19, 0x0000dd19, 0x0000dd19, 0x0000dd19, 0x0000dd19, 0x0000dd19,
+    0x00002319, 0x00002319, 0x00002319, 0x00002319, 0x00002319, 0x00002319, 0x00002319, 0x00002319,
+    0x0000dc19, 0x0000dc19, 0x0000dc19, 0x0000dc19, 0x0000dc19, 0x0000dc19, 0x0000dc19, 0x0000dc19,
+    0x00002419, 0x00002419, 0x00002419, 0x00002419, 0x00002419, 0x00002419, 0x00002419, 0x00002419,
+    0x0000db19, 0x0000db19, 0x0000db19, 0x0000db19, 0x0000db19, 0x0000db19, 0x0000db19, 0x0000db19,
+    0x00002519, 0x00002519, 0x00002519, 0x00002519, 0x00002519, 0x00002519, 0x00002519, 0x00002519,
+    0x0000da19, 0x0000da19, 0x0000da19, 0x0000da19, 0x0000da19, 0x0000da19, 0x0000da19, 0x0000da19,
+    0x00002619, 0x00002619, 0x00002619, 0x00002619, 0x00002619, 0x00002619, 0x00002619, 0x00002619,
+    0x0000d919, 0x0000d919, 0x0000d919, 0x0000d919, 0x0000d919, 0x0000d919, 0x0000d919, 0x0000d919,
+    0x00002719, 0x00002719, 0x00002719, 0x00002719, 0x00002719, 0x00002719, 0x00002719, 0x00002719,
+    0x0000d819, 0x0000d819, 0x0000d819, 0x0000d819, 0x0000d819, 0x0000d819, 0x0000d819, 0x0000d819,
+    0x00001818, 0x00001818, 0x00001818, 0x00001818, 0x00001818, 0x00001818, 0x00001818, 0x00001818,
+    0x00001818, 0x00001818, 0x00001818, 0x00001818, 0x00001818, 0x00001818, 0x00001818, 0x00001818,
+    0x0000e718, 0x0000e718, 0x0000e718, 0x0000e718, 0x0000e718, 0x0000e718, 0x0000e718, 0x0000e718,
+    0x0000e718, 0x0000e718, 0x0000e718, 0x0000e718, 0x0000e718, 0x0000e718, 0x0000e718, 0x0000e718,
+    0x00001918, 0x00001918, 0x00001918, 0x00001918, 0x00001918, 0x00001918, 0x00001918, 0x00001918,
+    0x00001918, 0x00001918, 0x00001918, 0x00001918, 0x00001918, 0x00001918, 0x00001918, 0x00001918,
+    0x0000e618, 0x0000e618, 0x0000e618, 0x0000e618, 0x0000e618, 0x0000e618, 0x0000e618, 0x0000e618,
+    0x0000e618, 0x0000e618, 0x0000e618, 0x0000e618, 0x0000e618, 0x0000e618, 0x0000e618, 0x0000e618,
+    0x00001a18, 0x00001a18, 0x00001a18, 0x00001a18, 0x00001a18, 0x00001a18, 0x00001a18, 0x00001a18,
+    0x00001a18, 0x00001a18, 0x00001a18, 0x00001a18, 0x00001a18, 0x00001a18, 0x00001a18, 0x00001a18,
+    0x0000e518, 0x0000e518, 0x0000e518, 0x0000e518, 0x0000e518, 0x0000e518, 0x0000e518, 0x0000e518,
+    0x0000e518, 0x0000e518, 0x0000e518, 0x0000e518, 0x0000e518, 0x0000e518, 0x0000e518, 0x0000e518,
+    0x00001b18, 0x00001b18, 0x00001b18, 0x00001b18, 0x00001b18, 0x00001b18, 0x00001b18, 0x00001b18,
+    0x00001b18, 0x00001b18, 0x00001b18, 0x00001b18, 0x00001b18, 0x00001b18, 0x00001b18, 0x00001b18,
+    0x0000e418, 0x0000e418, 0x0000e418, 0x0000e418, 0x0000e418, 0x0000e418, 0x0000e418, 0x0000e418,
+    0x0000e418, 0x0000e418, 0x0000e418, 0x0000e418, 0x0000e418, 0x0000e418, 0x0000e418, 0x0000e418,
+    0x00001c18, 0x00001c18, 0x00001c18, 0x00001c18, 0x00001c18, 0x00001c18, 0x00001c18, 0x00001c18,
+    0x00001c18, 0x00001c18, 0x00001c18, 0x00001c18, 0x00001c18, 0x00001c18, 0x00001c18, 0x00001c18,
+    0x0000e318, 0x0000e318, 0x0000e318, 0x0000e318, 0x0000e318, 0x0000e318, 0x0000e318, 0x0000e318,
+    0x0000e318, 0x0000e318, 0x0000e318, 0x0000e318, 0x0000e318, 0x0000e318, 0x0000e318, 0x0000e318,
+    0x00001d18, 0x00001d18, 0x00001d18, 0x00001d18, 0x00001d18, 0x00001d18, 0x00001d18, 0x00001d18,
+    0x00001d18, 0x00001d18, 0x00001d18, 0x00001d18, 0x00001d18, 0x00001d18, 0x00001d18, 0x00001d18,
+    0x0000e218, 0x0000e218, 0x0000e218, 0x0000e218, 0x0000e218, 0x0000e218, 0x0000e218, 0x0000e218,
+    0x0000e218, 0x0000e218, 0x0000e218, 0x0000e218, 0x0000e218, 0x0000e218, 0x0000e218, 0x0000e218,
+    0x00001e18, 0x00001e18, 0x00001e18, 0x00001e18, 0x00001e18, 0x00001e18, 0x00001e18, 0x00001e18,
+    0x00001e18, 0x00001e18, 0x00001e18, 0x00001e18, 0x00001e18, 0x00001e18, 0x00001e18, 0x00001e18,
+    0x0000e118, 0x0000e118, 0x0000e118, 0x0000e118, 0x0000e118, 0x0000e118, 0x0000e118, 0x0000e118,
+    0x0000e118, 0x0000e118, 0x0000e118, 0x0000e118, 0x0000e118, 0x0000e118, 0x0000e118, 0x0000e118,
+    0x00001f18, 0x00001f18, 0x00001f18, 0x00001f18, 0x00001f18, 0x00001f18, 0x00001f18, 0x00001f18,
+    0x00001f18, 0x00001f18, 0x00001f18, 0x00001f18, 0x00001f18, 0x00001f18, 0x00001f18, 0x00001f18,
+    0x0000e018, 0x0000e018, 0x0000e018, 0x0000e018, 0x0000e018, 0x0000e018, 0x0000e018, 0x0000e018,
+    0x0000e018, 0x0000e018, 0x0000e018, 0x0000e018, 0x0000e018, 0x0000e018, 0x0000e018, 0x0000e018,
+    0x00001017, 0x00001017, 0x00001017, 0x00001017, 0x00001017, 0x00001017, 0x00001017, 0x00001017,
+    0x00001017, 0x00001017, 0x00001017, 0x00001017, 0x00001017, 0x00001017, 0x00001017, 0x00001017,
+    0x0000102c, 0x00ff102c, 0x0001102c, 0x00fe102c, 0x0002102c, 0x00fd102c, 0x0003102c, 0x00fc102c,
+    0x0004102c, 0x00fb102c, 0x0005102c, 0x00fa102c, 0x0006102c, 0x00f9102c, 0x0007102c, 0x00f8102c,
+    0x0000ef17, 0x0000ef17, 0x0000ef17, 0x0000ef17, 0x0000ef17, 0x0000ef17, 0x0000ef17, 0x0000ef17,
+    0x0000ef17, 0x0000ef17, 0x0000ef17, 0x0000ef17, 0x0000ef17, 0x0000ef17, 0x0000ef17, 0x0000ef17,
+    0x0000ef2c, 0x00ffef2c, 0x0001ef2c, 0x00feef2c, 0x0002ef2c, 0x00fdef2c, 0x0003ef2c, 0x00fcef2c,
+    0x0004ef2c, 0x00fbef2c, 0x0005ef2c, 0x00faef2c, 0x0006ef2c, 0x00f9ef2c, 0x0007ef2c, 0x00f8ef2c,
+    0x00001117, 0x00001117, 0x00001117, 0x00001117, 0x00001117, 0x00001117, 0x00001117, 0x00001117,
+    0x00001117, 0x00001117, 0x00001117, 0x00001117, 0x00001117, 0x00001117, 0x00001117, 0x00001117,
+    0x0000112c, 0x00ff112c, 0x0001112c, 0x00fe112c, 0x0002112c, 0x00fd112c, 0x0003112c, 0x00fc112c,
+    0x0004112c, 0x00fb112c, 0x0005112c, 0x00fa112c, 0x0006112c, 0x00f9112c, 0x0007112c, 0x00f8112c,
+    0x0000ee17, 0x0000ee17, 0x0000ee17, 0x0000ee17, 0x0000ee17, 0x0000ee17, 0x0000ee17, 0x0000ee17,
+    0x0000ee17, 0x0000ee17, 0x0000ee17, 0x0000ee17, 0x0000ee17, 0x0000ee17, 0x0000ee17, 0x0000ee17,
+    0x0000ee2c, 0x00ffee2c, 0x0001ee2c, 0x00feee2c, 0x0002ee2c, 0x00fdee2c, 0x0003ee2c, 0x00fcee2c,
+    0x0004ee2c, 0x00fbee2c, 0x0005ee2c, 0x00faee2c, 0x0006ee2c, 0x00f9ee2c, 0x0007ee2c, 0x00f8ee2c,
+    0x00001217, 0x00001217, 0x00001217, 0x00001217, 0x00001217, 0x00001217, 0x00001217, 0x00001217,
+    0x00001217, 0x00001217, 0x00001217, 0x00001217, 0x00001217, 0x00001217, 0x00001217, 0x00001217,
+    0x0000122c, 0x00ff122c, 0x0001122c, 0x00fe122c, 0x0002122c, 0x00fd122c, 0x0003122c, 0x00fc122c,
+    0x0004122c, 0x00fb122c, 0x0005122c, 0x00fa122c, 0x0006122c, 0x00f9122c, 0x0007122c, 0x00f8122c,
+    0x0000ed17, 0x0000ed17, 0x0000ed17, 0x0000ed17, 0x0000ed17, 0x0000ed17, 0x0000ed17, 0x0000ed17,
+    0x0000ed17, 0x0000ed17, 0x0000ed17, 0x0000ed17, 0x0000ed17, 0x0000ed17, 0x0000ed17, 0x0000ed17,
+    0x0000ed2c, 0x00ffed2c, 0x0001ed2c, 0x00feed2c, 0x0002ed2c, 0x00fded2c, 0x0003ed2c, 0x00fced2c,
+    0x0004ed2c, 0x00fbed2c, 0x0005ed2c, 0x00faed2c, 0x0006ed2c, 0x00f9ed2c, 0x0007ed2c, 0x00f8ed2c,
+    0x00001317, 0x00001317, 0x00001317, 0x00001317, 0x00001317, 0x00001317, 0x00001317, 0x00001317,
+    0x00001317, 0x00001317, 0x00001317, 0x00001317, 0x00001317, 0x00001317, 0x00001317, 0x00001317,
+    0x0000132c, 0x00ff132c, 0x0001132c, 0x00fe132c, 0x0002132c, 0x00fd132c, 0x0003132c, 0x00fc132c,
+    0x0004132c, 0x00fb132c, 0x0005132c, 0x00fa132c, 0x0006132c, 0x00f9132c, 0x0007132c, 0x00f8132c,
+    0x0000ec17, 0x0000ec17, 0x0000ec17, 0x0000ec17, 0x0000ec17, 0x0000ec17, 0x0000ec17, 0x0000ec17,
+    0x0000ec17, 0x0000ec17, 0x0000ec17, 0x0000ec17, 0x0000ec17, 0x0000ec17, 0x0000ec17, 0x0000ec17,
+    0x0000ec2c, 0x00ffec2c, 0x0001ec2c, 0x00feec2c, 0x0002ec2c, 0x00fdec2c, 0x0003ec2c, 0x00fcec2c,
+    0x0004ec2c, 0x00fbec2c, 0x0005ec2c, 0x00faec2c, 0x0006ec2c, 0x00f9ec2c, 0x0007ec2c, 0x00f8ec2c,
+    0x00001417, 0x00001417, 0x00001417, 0x00001417, 0x00001417, 0x00001417, 0x00001417, 0x00001417,
+    0x00001417, 0x00001417, 0x00001417, 0x00001417, 0x00001417, 0x00001417, 0x00001417, 0x00001417,
+    0x0000142c, 0x00ff142c, 0x0001142c, 0x00fe142c, 0x0002142c, 0x00fd142c, 0x0003142c, 0x00fc142c,
+    0x0004142c, 0x00fb142c, 0x0005142c, 0x00fa142c, 0x0006142c, 0x00f9142c, 0x0007142c, 0x00f8142c,
+    0x0000eb17, 0x0000eb17, 0x0000eb17, 0x0000eb17, 0x0000eb17, 0x0000eb17, 0x0000eb17, 0x0000eb17,
+    0x0000eb17, 0x0000eb17, 0x0000eb17, 0x0000eb17, 0x0000eb17, 0x0000eb17, 0x0000eb17, 0x0000eb17,
+    0x0000eb2c, 0x00ffeb2c, 0x0001eb2c, 0x00feeb2c, 0x0002eb2c, 0x00fdeb2c, 0x0003eb2c, 0x00fceb2c,
+    0x0004eb2c, 0x00fbeb2c, 0x0005eb2c, 0x00faeb2c, 0x0006eb2c, 0x00f9eb2c, 0x0007eb2c, 0x00f8eb2c,
+    0x00001517, 0x00001517, 0x00001517, 0x00001517, 0x00001517, 0x00001517, 0x00001517, 0x00001517,
+    0x00001517, 0x00001517, 0x00001517, 0x00001517, 0x00001517, 0x00001517, 0x00001517, 0x00001517,
+    0x0000152c, 0x00ff152c, 0x0001152c, 0x00fe152c, 0x0002152c, 0x00fd152c, 0x0003152c, 0x00fc152c,
+    0x0004152c, 0x00fb152c, 0x0005152c, 0x00fa152c, 0x0006152c, 0x00f9152c, 0x0007152c, 0x00f8152c,
+    0x0000ea17, 0x0000ea17, 0x0000ea17, 0x0000ea17, 0x0000ea17, 0x0000ea17, 0x0000ea17, 0x0000ea17,
+    0x0000ea17, 0x0000ea17, 0x0000ea17, 0x0000ea17, 0x0000ea17, 0x0000ea17, 0x0000ea17, 0x0000ea17,
+    0x0000ea2c, 0x00ffea2c, 0x0001ea2c, 0x00feea2c, 0x0002ea2c, 0x00fdea2c, 0x0003ea2c, 0x00fcea2c,
+    0x0004ea2c, 0x00fbea2c, 0x0005ea2c, 0x00faea2c, 0x0006ea2c, 0x00f9ea2c, 0x0007ea2c, 0x00f8ea2c,
+    0x00001617, 0x00001617, 0x00001617, 0x00001617, 0x00001617, 0x00001617, 0x00001617, 0x00001617,
+    0x00001617, 0x00001617, 0x00001617, 0x00001617, 0x00001617, 0x00001617, 0x00001617, 0x00001617,
+    0x0000162c, 0x00ff162c, 0x0001162c, 0x00fe162c, 0x0002162c, 0x00fd162c, 0x0003162c, 0x00fc162c,
+    0x0004162c, 0x00fb162c, 0x0005162c, 0x00fa162c, 0x0006162c, 0x00f9162c, 0x0007162c, 0x00f8162c,
+    0x0000e917, 0x0000e917, 0x0000e917, 0x0000e917, 0x0000e917, 0x0000e917, 0x0000e917, 0x0000e917,
+    0x0000e917, 0x0000e917, 0x0000e917, 0x0000e917, 0x0000e917, 0x0000e917, 0x0000e917, 0x0000e917,
+    0x0000e92c, 0x00ffe92c, 0x0001e92c, 0x00fee92c, 0x0002e92c, 0x00fde92c, 0x0003e92c, 0x00fce92c,
+    0x0004e92c, 0x00fbe92c, 0x0005e92c, 0x00fae92c, 0x0006e92c, 0x00f9e92c, 0x0007e92c, 0x00f8e92c,
+    0x00001717, 0x00001717, 0x00001717, 0x00001717, 0x00001717, 0x00001717, 0x00001717, 0x00001717,
+    0x00001717, 0x00001717, 0x00001717, 0x00001717, 0x00001717, 0x00001717, 0x00001717, 0x00001717,
+    0x0000172c, 0x00ff172c, 0x0001172c, 0x00fe172c, 0x0002172c, 0x00fd172c, 0x0003172c, 0x00fc172c,
+    0x0004172c, 0x00fb172c, 0x0005172c, 0x00fa172c, 0x0006172c, 0x00f9172c, 0x0007172c, 0x00f8172c,
+    0x0000e817, 0x0000e817, 0x0000e817, 0x0000e817, 0x0000e817, 0x0000e817, 0x0000e817, 0x0000e817,
+    0x0000e817, 0x0000e817, 0x0000e817, 0x0000e817, 0x0000e817, 0x0000e817, 0x0000e817, 0x0000e817,
+    0x0000e82c, 0x00ffe82c, 0x0001e82c, 0x00fee82c, 0x0002e82c, 0x00fde82c, 0x0003e82c, 0x00fce82c,
+    0x0004e82c, 0x00fbe82c, 0x0005e82c, 0x00fae82c, 0x0006e82c, 0x00f9e82c, 0x0007e82c, 0x00f8e82c,
+    0x00000816, 0x00000816, 0x00000816, 0x00000816, 0x00000816, 0x00000816, 0x00000816, 0x00000816,
+    0x00000816, 0x00000816, 0x00000816, 0x00000816, 0x00000816, 0x00000816, 0x00000816, 0x00000816,
+    0x0008082c, 0x00f7082c, 0x0009082c, 0x00f6082c, 0x000a082c, 0x00f5082c, 0x000b082c, 0x00f4082c,
+    0x000c082c, 0x00f3082c, 0x000d082c, 0x00f2082c, 0x000e082c, 0x00f1082c, 0x000f082c, 0x00f0082c,
+    0x0000082b, 0x0000082b, 0x00ff082b, 0x00ff082b, 0x0001082b, 0x0001082b, 0x00fe082b, 0x00fe082b,
+    0x0002082b, 0x0002082b, 0x00fd082b, 0x00fd082b, 0x0003082b, 0x0003082b, 0x00fc082b, 0x00fc082b,
+    0x0004082b, 0x0004082b, 0x00fb082b, 0x00fb082b, 0x0005082b, 0x0005082b, 0x00fa082b, 0x00fa082b,
+    0x0006082b, 0x0006082b, 0x00f9082b, 0x00f9082b, 0x0007082b, 0x0007082b, 0x00f8082b, 0x00f8082b,
+    0x0000f716, 0x0000f716, 0x0000f716, 0x0000f716, 0x0000f716, 0x0000f716, 0x0000f716, 0x0000f716,
+    0x0000f716, 0x0000f716, 0x0000f716, 0x0000f716, 0x0000f716, 0x0000f716, 0x0000f716, 0x0000f716,
+    0x0008f72c, 0x00f7f72c, 0x0009f72c, 0x00f6f72c, 0x000af72c, 0x00f5f72c, 0x000bf72c, 0x00f4f72c,
+    0x000cf72c, 0x00f3f72c, 0x000df72c, 0x00f2f72c, 0x000ef72c, 0x00f1f72c, 0x000ff72c, 0x00f0f72c,
+    0x0000f72b, 0x0000f72b, 0x00fff72b, 0x00fff72b, 0x0001f72b, 0x0001f72b, 0x00fef72b, 0x00fef72b,
+    0x0002f72b, 0x0002f72b, 0x00fdf72b, 0x00fdf72b, 0x0003f72b, 0x0003f72b, 0x00fcf72b, 0x00fcf72b,
+    0x0004f72b, 0x0004f72b, 0x00fbf72b, 0x00fbf72b, 0x0005f72b, 0x0005f72b, 0x00faf72b, 0x00faf72b,
+    0x0006f72b, 0x0006f72b, 0x00f9f72b, 0x00f9f72b, 0x0007f72b, 0x0007f72b, 0x00f8f72b, 0x00f8f72b,
+    0x00000916, 0x00000916, 0x00000916, 0x00000916, 0x00000916, 0x00000916, 0x00000916, 0x00000916,
+    0x00000916, 0x00000916, 0x00000916, 0x00000916, 0x00000916, 0x00000916, 0x00000916, 0x00000916,
+    0x0008092c, 0x00f7092c, 0x0009092c, 0x00f6092c, 0x000a092c, 0x00f5092c, 0x000b092c, 0x00f4092c,
+    0x000c092c, 0x00f3092c, 0x000d092c, 0x00f2092c, 0x000e092c, 0x00f1092c, 0x000f092c, 0x00f0092c,
+    0x0000092b, 0x0000092b, 0x00ff092b, 0x00ff092b, 0x0001092b, 0x0001092b, 0x00fe092b, 0x00fe092b,
+    0x0002092b, 0x0002092b, 0x00fd092b, 0x00fd092b, 0x0003092b, 0x0003092b, 0x00fc092b, 0x00fc092b,
+    0x0004092b, 0x0004092b, 0x00fb092b, 0x00fb092b, 0x0005092b, 0x0005092b, 0x00fa092b, 0x00fa092b,
+    0x0006092b, 0x0006092b, 0x00f9092b, 0x00f9092b, 0x0007092b, 0x0007092b, 0x00f8092b, 0x00f8092b,
+    0x0000f616, 0x0000f616, 0x0000f616, 0x0000f616, 0x0000f616, 0x0000f616, 0x0000f616, 0x0000f616,
+    0x0000f616, 0x0000f616, 0x0000f616, 0x0000f616, 0x0000f616, 0x0000f616, 0x0000f616, 0x0000f616,
+    0x0008f62c, 0x00f7f62c, 0x0009f62c, 0x00f6f62c, 0x000af62c, 0x00f5f62c, 0x000bf62c, 0x00f4f62c,
+    0x000cf62c, 0x00f3f62c, 0x000df62c, 0x00f2f62c, 0x000ef62c, 0x00f1f62c, 0x000ff62c, 0x00f0f62c,
+    0x0000f62b, 0x0000f62b, 0x00fff62b, 0x00fff62b, 0x0001f62b, 0x0001f62b, 0x00fef62b, 0x00fef62b,
+    0x0002f62b, 0x0002f62b, 0x00fdf62b, 0x00fdf62b, 0x0003f62b, 0x0003f62b, 0x00fcf62b, 0x00fcf62b,
+    0x0004f62b, 0x0004f62b, 0x00fbf62b, 0x00fbf62b, 0x0005f62b, 0x0005f62b, 0x00faf62b, 0x00faf62b,
+    0x0006f62b, 0x0006f62b, 0x00f9f62b, 0x00f9f62b, 0x0007f62b, 0x0007f62b, 0x00f8f62b, 0x00f8f62b,
+    0x00000a16, 0x00000a16, 0x00000a16, 0x00000a16, 0x00000a16, 0x00000a16, 0x00000a16, 0x00000a16,
+    0x00000a16, 0x00000a16, 0x00000a16, 0x00000a16, 0x00000a16, 0x00000a16, 0x00000a16, 0x00000a16,
+    0x00080a2c, 0x00f70a2c, 0x00090a2c, 0x00f60a2c, 0x000a0a2c, 0x00f50a2c, 0x000b0a2c, 0x00f40a2c,
+    0x000c0a2c, 0x00f30a2c, 0x000d0a2c, 0x00f20a2c, 0x000e0a2c, 0x00f10a2c, 0x000f0a2c, 0x00f00a2c,
+    0x00000a2b, 0x00000a2b, 0x00ff0a2b, 0x00ff0a2b, 0x00010a2b, 0x00010a2b, 0x00fe0a2b, 0x00fe0a2b,
+    0x00020a2b, 0x00020a2b, 0x00fd0a2b, 0x00fd0a2b, 0x00030a2b, 0x00030a2b, 0x00fc0a2b, 0x00fc0a2b,
+    0x00040a2b, 0x00040a2b, 0x00fb0a2b, 0x00fb0a2b, 0x00050a2b, 0x00050a2b, 0x00fa0a2b, 0x00fa0a2b,
+    0x00060a2b, 0x00060a2b, 0x00f90a2b, 0x00f90a2b, 0x00070a2b, 0x00070a2b, 0x00f80a2b, 0x00f80a2b,
+    0x0000f516, 0x0000f516, 0x0000f516, 0x0000f516, 0x0000f516, 0x0000f516, 0x0000f516, 0x0000f516,
+    0x0000f516, 0x0000f516, 0x0000f516, 0x0000f516, 0x0000f516, 0x0000f516, 0x0000f516, 0x0000f516,
+    0x0008f52c, 0x00f7f52c, 0x0009f52c, 0x00f6f52c, 0x000af52c, 0x00f5f52c, 0x000bf52c, 0x00f4f52c,
+    0x000cf52c, 0x00f3f52c, 0x000df52c, 0x00f2f52c, 0x000ef52c, 0x00f1f52c, 0x000ff52c, 0x00f0f52c,
+    0x0000f52b, 0x0000f52b, 0x00fff52b, 0x00fff52b, 0x0001f52b, 0x0001f52b, 0x00fef52b, 0x00fef52b,
+    0x0002f52b, 0x0002f52b, 0x00fdf52b, 0x00fdf52b, 0x0003f52b, 0x0003f52b, 0x00fcf52b, 0x00fcf52b,
+    0x0004f52b, 0x0004f52b, 0x00fbf52b, 0x00fbf52b, 0x0005f52b, 0x0005f52b, 0x00faf52b, 0x00faf52b,
+    0x0006f52b, 0x0006f52b, 0x00f9f52b, 0x00f9f52b, 0x0007f52b, 0x0007f52b, 0x00f8f52b, 0x00f8f52b,
+    0x00000b16, 0x00000b16, 0x00000b16, 0x00000b16, 0x00000b16, 0x00000b16, 0x00000b16, 0x00000b16,
+    0x00000b16, 0x00000b16, 0x00000b16, 0x00000b16, 0x00000b16, 0x00000b16, 0x00000b16, 0x00000b16,
+    0x00080b2c, 0x00f70b2c, 0x00090b2c, 0x00f60b2c, 0x000a0b2c, 0x00f50b2c, 0x000b0b2c, 0x00f40b2c,
+    0x000c0b2c, 0x00f30b2c, 0x000d0b2c, 0x00f20b2c, 0x000e0b2c, 0x00f10b2c, 0x000f0b2c, 0x00f00b2c,
+    0x00000b2b, 0x00000b2b, 0x00ff0b2b, 0x00ff0b2b, 0x00010b2b, 0x00010b2b, 0x00fe0b2b, 0x00fe0b2b,
+    0x00020b2b, 0x00020b2b, 0x00fd0b2b, 0x00fd0b2b, 0x00030b2b, 0x00030b2b, 0x00fc0b2b, 0x00fc0b2b,
+    0x00040b2b, 0x00040b2b, 0x00fb0b2b, 0x00fb0b2b, 0x00050b2b, 0x00050b2b, 0x00fa0b2b, 0x00fa0b2b,
+    0x00060b2b, 0x00060b2b, 0x00f90b2b, 0x00f90b2b, 0x00070b2b, 0x00070b2b, 0x00f80b2b, 0x00f80b2b,
+    0x0000f416, 0x0000f416, 0x0000f416, 0x0000f416, 0x0000f416, 0x0000f416, 0x0000f416, 0x0000f416,
+    0x0000f416, 0x0000f416, 0x0000f416, 0x0000f416, 0x0000f416, 0x0000f416, 0x0000f416, 0x0000f416,
+    0x0008f42c, 0x00f7f42c, 0x0009f42c, 0x00f6f42c, 0x000af42c, 0x00f5f42c, 0x000bf42c, 0x00f4f42c,
+    0x000cf42c, 0x00f3f42c, 0x000df42c, 0x00f2f42c, 0x000ef42c, 0x00f1f42c, 0x000ff42c, 0x00f0f42c,
+    0x0000f42b, 0x0000f42b, 0x00fff42b, 0x00fff42b, 0x0001f42b, 0x0001f42b, 0x00fef42b, 0x00fef42b,
+    0x0002f42b, 0x0002f42b, 0x00fdf42b, 0x00fdf42b, 0x0003f42b, 0x0003f42b, 0x00fcf42b, 0x00fcf42b,
+    0x0004f42b, 0x0004f42b, 0x00fbf42b, 0x00fbf42b, 0x0005f42b, 0x0005f42b, 0x00faf42b, 0x00faf42b,
+    0x0006f42b, 0x0006f42b, 0x00f9f42b, 0x00f9f42b, 0x0007f42b, 0x0007f42b, 0x00f8f42b, 0x00f8f42b,
+    0x00000c16, 0x00000c16, 0x00000c16, 0x00000c16, 0x00000c16, 0x00000c16, 0x00000c16, 0x00000c16,
+    0x00000c16, 0x00000c16, 0x00000c16, 0x00000c16, 0x00000c16, 0x00000c16, 0x00000c16, 0x00000c16,
+    0x00080c2c, 0x00f70c2c, 0x00090c2c, 0x00f60c2c, 0x000a0c2c, 0x00f50c2c, 0x000b0c2c, 0x00f40c2c,
+    0x000c0c2c, 0x00f30c2c, 0x000d0c2c, 0x00f20c2c, 0x000e0c2c, 0x00f10c2c, 0x000f0c2c, 0x00f00c2c,
+    0x00000c2b, 0x00000c2b, 0x00ff0c2b, 0x00ff0c2b, 0x00010c2b, 0x00010c2b, 0x00fe0c2b, 0x00fe0c2b,
+    0x00020c2b, 0x00020c2b, 0x00fd0c2b, 0x00fd0c2b, 0x00030c2b, 0x00030c2b, 0x00fc0c2b, 0x00fc0c2b,
+    0x00040c2b, 0x00040c2b, 0x00fb0c2b, 0x00fb0c2b, 0x00050c2b, 0x00050c2b, 0x00fa0c2b, 0x00fa0c2b,
+    0x00060c2b, 0x00060c2b, 0x00f90c2b, 0x00f90c2b, 0x00070c2b, 0x00070c2b, 0x00f80c2b, 0x00f80c2b,
+    0x0000f316, 0x0000f316, 0x0000f316, 0x0000f316, 0x0000f316, 0x0000f316, 0x0000f316, 0x0000f316,
+    0x0000f316, 0x0000f316, 0x0000f316, 0x0000f316, 0x0000f316, 0x0000f316, 0x0000f316, 0x0000f316,
+    0x0008f32c, 0x00f7f32c, 0x0009f32c, 0x00f6f32c, 0x000af32c, 0x00f5f32c, 0x000bf32c, 0x00f4f32c,
+    0x000cf32c, 0x00f3f32c, 0x000df32c, 0x00f2f32c, 0x000ef32c, 0x00f1f32c, 0x000ff32c, 0x00f0f32c,
+    0x0000f32b, 0x0000f32b, 0x00fff32b, 0x00fff32b, 0x0001f32b, 0x0001f32b, 0x00fef32b, 0x00fef32b,
+    0x0002f32b, 0x0002f32b, 0x00fdf32b, 0x00fdf32b, 0x0003f32b, 0x0003f32b, 0x00fcf32b, 0x00fcf32b,
+    0x0004f32b, 0x0004f32b, 0x00fbf32b, 0x00fbf32b, 0x0005f32b, 0x0005f32b, 0x00faf32b, 0x00faf32b,
+    0x0006f32b, 0x0006f32b, 0x00f9f32b, 0x00f9f32b, 0x0007f32b, 0x0007f32b, 0x00f8f32b, 0x00f8f32b,
+    0x00000d16, 0x00000d16, 0x00000d16, 0x00000d16, 0x00000d16, 0x00000d16, 0x00000d16, 0x00000d16,
+    0x00000d16, 0x00000d16, 0x00000d16, 0x00000d16, 0x00000d16, 0x00000d16, 0x00000d16, 0x00000d16,
+    0x00080d2c, 0x00f70d2c, 0x00090d2c, 0x00f60d2c, 0x000a0d2c, 0x00f50d2c, 0x000b0d2c, 0x00f40d2c,
+    0x000c0d2c, 0x00f30d2c, 0x000d0d2c, 0x00f20d2c, 0x000e0d2c, 0x00f10d2c, 0x000f0d2c, 0x00f00d2c,
+    0x00000d2b, 0x00000d2b, 0x00ff0d2b, 0x00ff0d2b, 0x00010d2b, 0x00010d2b, 0x00fe0d2b, 0x00fe0d2b,
+    0x00020d2b, 0x00020d2b, 0x00fd0d2b, 0x00fd0d2b, 0x00030d2b, 0x00030d2b, 0x00fc0d2b, 0x00fc0d2b,
+    0x00040d2b, 0x00040d2b, 0x00fb0d2b, 0x00fb0d2b, 0x00050d2b, 0x00050d2b, 0x00fa0d2b, 0x00fa0d2b,
+    0x00060d2b, 0x00060d2b, 0x00f90d2b, 0x00f90d2b, 0x00070d2b, 0x00070d2b, 0x00f80d2b, 0x00f80d2b,
+    0x0000f216, 0x0000f216, 0x0000f216, 0x0000f216, 0x0000f216, 0x0000f216, 0x0000f216, 0x0000f216,
+    0x0000f216, 0x0000f216, 0x0000f216, 0x0000f216, 0x0000f216, 0x0000f216, 0x0000f216, 0x0000f216,
+    0x0008f22c, 0x00f7f22c, 0x0009f22c, 0x00f6f22c, 0x000af22c, 0x00f5f22c, 0x000bf22c, 0x00f4f22c,
+    0x000cf22c, 0x00f3f22c, 0x000df22c, 0x00f2f22c, 0x000ef22c, 0x00f1f22c, 0x000ff22c, 0x00f0f22c,
+    0x0000f22b, 0x0000f22b, 0x00fff22b, 0x00fff22b, 0x0001f22b, 0x0001f22b, 0x00fef22b, 0x00fef22b,
+    0x0002f22b, 0x0002f22b, 0x00fdf22b, 0x00fdf22b, 0x0003f22b, 0x0003f22b, 0x00fcf22b, 0x00fcf22b,
+    0x0004f22b, 0x0004f22b, 0x00fbf22b, 0x00fbf22b, 0x0005f22b, 0x0005f22b, 0x00faf22b, 0x00faf22b,
+    0x0006f22b, 0x0006f22b, 0x00f9f22b, 0x00f9f22b, 0x0007f22b, 0x0007f22b, 0x00f8f22b, 0x00f8f22b,
+    0x00000e16, 0x00000e16, 0x00000e16, 0x00000e16, 0x00000e16, 0x00000e16, 0x00000e16, 0x00000e16,
+    0x00000e16, 0x00000e16, 0x00000e16, 0x00000e16, 0x00000e16, 0x00000e16, 0x00000e16, 0x00000e16,
+    0x00080e2c, 0x00f70e2c, 0x00090e2c, 0x00f60e2c, 0x000a0e2c, 0x00f50e2c, 0x000b0e2c, 0x00f40e2c,
+    0x000c0e2c, 0x00f30e2c, 0x000d0e2c, 0x00f20e2c, 0x000e0e2c, 0x00f10e2c, 0x000f0e2c, 0x00f00e2c,
+    0x00000e2b, 0x00000e2b, 0x00ff0e2b, 0x00ff0e2b, 0x00010e2b, 0x00010e2b, 0x00fe0e2b, 0x00fe0e2b,
+    0x00020e2b, 0x00020e2b, 0x00fd0e2b, 0x00fd0e2b, 0x00030e2b, 0x00030e2b, 0x00fc0e2b, 0x00fc0e2b,
+    0x00040e2b, 0x00040e2b, 0x00fb0e2b, 0x00fb0e2b, 0x00050e2b, 0x00050e2b, 0x00fa0e2b, 0x00fa0e2b,
+    0x00060e2b, 0x00060e2b, 0x00f90e2b, 0x00f90e2b, 0x00070e2b, 0x00070e2b, 0x00f80e2b, 0x00f80e2b,
+    0x0000f116, 0x0000f116, 0x0000f116, 0x0000f116, 0x0000f116, 0x0000f116, 0x0000f116, 0x0000f116,
+    0x0000f116, 0x0000f116, 0x0000f116, 0x0000f116, 0x0000f116, 0x0000f116, 0x0000f116, 0x0000f116,
+    0x0008f12c, 0x00f7f12c, 0x0009f12c, 0x00f6f12c, 0x000af12c, 0x00f5f12c, 0x000bf12c, 0x00f4f12c,
+    0x000cf12c, 0x00f3f12c, 0x000df12c, 0x00f2f12c, 0x000ef12c, 0x00f1f12c, 0x000ff12c, 0x00f0f12c,
+    0x0000f12b, 0x0000f12b, 0x00fff12b, 0x00fff12b, 0x0001f12b, 0x0001f12b, 0x00fef12b, 0x00fef12b,
+    0x0002f12b, 0x0002f12b, 0x00fdf12b, 0x00fdf12b, 0x0003f12b, 0x0003f12b, 0x00fcf12b, 0x00fcf12b,
+    0x0004f12b, 0x0004f12b, 0x00fbf12b, 0x00fbf12b, 0x0005f12b, 0x0005f12b, 0x00faf12b, 0x00faf12b,
+    0x0006f12b, 0x0006f12b, 0x00f9f12b, 0x00f9f12b, 0x0007f12b, 0x0007f12b, 0x00f8f12b, 0x00f8f12b,
+    0x00000f16, 0x00000f16, 0x00000f16, 0x00000f16, 0x00000f16, 0x00000f16, 0x00000f16, 0x00000f16,
+    0x00000f16, 0x00000f16, 0x00000f16, 0x00000f16, 0x00000f16, 0x00000f16, 0x00000f16, 0x00000f16,
+    0x00080f2c, 0x00f70f2c, 0x00090f2c, 0x00f60f2c, 0x000a0f2c, 0x00f50f2c, 0x000b0f2c, 0x00f40f2c,
+    0x000c0f2c, 0x00f30f2c, 0x000d0f2c, 0x00f20f2c, 0x000e0f2c, 0x00f10f2c, 0x000f0f2c, 0x00f00f2c,
+    0x00000f2b, 0x00000f2b, 0x00ff0f2b, 0x00ff0f2b, 0x00010f2b, 0x00010f2b, 0x00fe0f2b, 0x00fe0f2b,
+    0x00020f2b, 0x00020f2b, 0x00fd0f2b, 0x00fd0f2b, 0x00030f2b, 0x00030f2b, 0x00fc0f2b, 0x00fc0f2b,
+    0x00040f2b, 0x00040f2b, 0x00fb0f2b, 0x00fb0f2b, 0x00050f2b, 0x00050f2b, 0x00fa0f2b, 0x00fa0f2b,
+    0x00060f2b, 0x00060f2b, 0x00f90f2b, 0x00f90f2b, 0x00070f2b, 0x00070f2b, 0x00f80f2b, 0x00f80f2b,
+    0x0000f016, 0x0000f016, 0x0000f016, 0x0000f016, 0x0000f016, 0x0000f016, 0x0000f016, 0x0000f016,
+    0x0000f016, 0x0000f016, 0x0000f016, 0x0000f016, 0x0000f016, 0x0000f016, 0x0000f016, 0x0000f016,
+    0x0008f02c, 0x00f7f02c, 0x0009f02c, 0x00f6f02c, 0x000af02c, 0x00f5f02c, 0x000bf02c, 0x00f4f02c,
+    0x000cf02c, 0x00f3f02c, 0x000df02c, 0x00f2f02c, 0x000ef02c, 0x00f1f02c, 0x000ff02c, 0x00f0f02c,
+    0x0000f02b, 0x0000f02b, 0x00fff02b, 0x00fff02b, 0x0001f02b, 0x0001f02b, 0x00fef02b, 0x00fef02b,
+    0x0002f02b, 0x0002f02b, 0x00fdf02b, 0x00fdf02b, 0x0003f02b, 0x0003f02b, 0x00fcf02b, 0x00fcf02b,
+    0x0004f02b, 0x0004f02b, 0x00fbf02b, 0x00fbf02b, 0x0005f02b, 0x0005f02b, 0x00faf02b, 0x00faf02b,
+    0x0006f02b, 0x0006f02b, 0x00f9f02b, 0x00f9f02b, 0x0007f02b, 0x0007f02b, 0x00f8f02b, 0x00f8f02b,
+    0x00000015, 0x00000015, 0x00000015, 0x00000015, 0x00000015, 0x00000015, 0x00000015, 0x00000015,
+    0x00000015, 0x00000015, 0x00000015, 0x00000015, 0x00000015, 0x00000015, 0x00000015, 0x00000015,
+    0x0010002c, 0x00ef002c, 0x0011002c, 0x00ee002c, 0x0012002c, 0x00ed002c, 0x0013002c, 0x00ec002c,
+    0x0014002c, 0x00eb002c, 0x0015002c, 0x00ea002c, 0x0016002c, 0x00e9002c, 0x0017002c, 0x00e8002c,
+    0x0008002b, 0x0008002b, 0x00f7002b, 0x00f7002b, 0x0009002b, 0x0009002b, 0x00f6002b, 0x00f6002b,
+    0x000a002b, 0x000a002b, 0x00f5002b, 0x00f5002b, 0x000b002b, 0x000b002b, 0x00f4002b, 0x00f4002b,
+    0x000c002b, 0x000c002b, 0x00f3002b, 0x00f3002b, 0x000d002b, 0x000d002b, 0x00f2002b, 0x00f2002b,
+    0x000e002b, 0x000e002b, 0x00f1002b, 0x00f1002b, 0x000f002b, 0x000f002b, 0x00f0002b, 0x00f0002b,
+    0x0000002a, 0x0000002a, 0x0000002a, 0x0000002a, 0x00ff002a, 0x00ff002a, 0x00ff002a, 0x00ff002a,
+    0x0001002a, 0x0001002a, 0x0001002a, 0x0001002a, 0x00fe002a, 0x00fe002a, 0x00fe002a, 0x00fe002a,
+    0x0002002a, 0x0002002a, 0x0002002a, 0x0002002a, 0x00fd002a, 0x00fd002a, 0x00fd002a, 0x00fd002a,
+    0x0003002a, 0x0003002a, 0x0003002a, 0x0003002a, 0x00fc002a, 0x00fc002a, 0x00fc002a, 0x00fc002a,
+    0x0004002a, 0x0004002a, 0x0004002a, 0x0004002a, 0x00fb002a, 0x00fb002a, 0x00fb002a, 0x00fb002a,
+    0x0005002a, 0x0005002a, 0x0005002a, 0x0005002a, 0x00fa002a, 0x00fa002a, 0x00fa002a, 0x00fa002a,
+    0x0006002a, 0x0006002a, 0x0006002a, 0x0006002a, 0x00f9002a, 0x00f9002a, 0x00f9002a, 0x00f9002a,
+    0x0007002a, 0x0007002a, 0x0007002a, 0x0007002a, 0x00f8002a, 0x00f8002a, 0x00f8002a, 0x00f8002a,
+    0x0000ff15, 0x0000ff15, 0x0000ff15, 0x0000ff15, 0x0000ff15, 0x0000ff15, 0x0000ff15, 0x0000ff15,
+    0x0000ff15, 0x0000ff15, 0x0000ff15, 0x0000ff15, 0x0000ff15, 0x0000ff15, 0x0000ff15, 0x0000ff15,
+    0x0010ff2c, 0x00efff2c, 0x0011ff2c, 0x00eeff2c, 0x0012ff2c, 0x00edff2c, 0x0013ff2c, 0x00ecff2c,
+    0x0014ff2c, 0x00ebff2c, 0x0015ff2c, 0x00eaff2c, 0x0016ff2c, 0x00e9ff2c, 0x0017ff2c, 0x00e8ff2c,
+    0x0008ff2b, 0x0008ff2b, 0x00f7ff2b, 0x00f7ff2b, 0x0009ff2b, 0x0009ff2b, 0x00f6ff2b, 0x00f6ff2b,
+    0x000aff2b, 0x000aff2b, 0x00f5ff2b, 0x00f5ff2b, 0x000bff2b, 0x000bff2b, 0x00f4ff2b, 0x00f4ff2b,
+    0x000cff2b, 0x000cff2b, 0x00f3ff2b, 0x00f3ff2b, 0x000dff2b, 0x000dff2b, 0x00f2ff2b, 0x00f2ff2b,
+    0x000eff2b, 0x000eff2b, 0x00f1ff2b, 0x00f1ff2b, 0x000fff2b, 0x000fff2b, 0x00f0ff2b, 0x00f0ff2b,
+    0x0000ff2a, 0x0000ff2a, 0x0000ff2a, 0x0000ff2a, 0x00ffff2a, 0x00ffff2a, 0x00ffff2a, 0x00ffff2a,
+    0x0001ff2a, 0x0001ff2a, 0x0001ff2a, 0x0001ff2a, 0x00feff2a, 0x00feff2a, 0x00feff2a, 0x00feff2a,
+    0x0002ff2a, 0x0002ff2a, 0x0002ff2a, 0x0002ff2a, 0x00fdff2a, 0x00fdff2a, 0x00fdff2a, 0x00fdff2a,
+    0x0003ff2a, 0x0003ff2a, 0x0003ff2a, 0x0003ff2a, 0x00fcff2a, 0x00fcff2a, 0x00fcff2a, 0x00fcff2a,
+    0x0004ff2a, 0x0004ff2a, 0x0004ff2a, 0x0004ff2a, 0x00fbff2a, 0x00fbff2a, 0x00fbff2a, 0x00fbff2a,
+    0x0005ff2a, 0x0005ff2a, 0x0005ff2a, 0x0005ff2a, 0x00faff2a, 0x00faff2a, 0x00faff2a, 0x00faff2a,
+    0x0006ff2a, 0x0006ff2a, 0x0006ff2a, 0x0006ff2a, 0x00f9ff2a, 0x00f9ff2a, 0x00f9ff2a, 0x00f9ff2a,
+    0x0007ff2a, 0x0007ff2a, 0x0007ff2a, 0x0007ff2a, 0x00f8ff2a, 0x00f8ff2a, 0x00f8ff2a, 0x00f8ff2a,
+    0x00000115, 0x00000115, 0x00000115, 0x00000115, 0x00000115, 0x00000115, 0x00000115, 0x00000115,
+    0x00000115, 0x00000115, 0x00000115, 0x00000115, 0x00000115, 0x00000115, 0x00000115, 0x00000115,
+    0x0010012c, 0x00ef012c, 0x0011012c, 0x00ee012c, 0x0012012c, 0x00ed012c, 0x0013012c, 0x00ec012c,
+    0x0014012c, 0x00eb012c, 0x0015012c, 0x00ea012c, 0x0016012c, 0x00e9012c, 0x0017012c, 0x00e8012c,
+    0x0008012b, 0x0008012b, 0x00f7012b, 0x00f7012b, 0x0009012b, 0x0009012b, 0x00f6012b, 0x00f6012b,
+    0x000a012b, 0x000a012b, 0x00f5012b, 0x00f5012b, 0x000b012b, 0x000b012b, 0x00f4012b, 0x00f4012b,
+    0x000c012b, 0x000c012b, 0x00f3012b, 0x00f3012b, 0x000d012b, 0x000d012b, 0x00f2012b, 0x00f2012b,
+    0x000e012b, 0x000e012b, 0x00f1012b, 0x00f1012b, 0x000f012b, 0x000f012b, 0x00f0012b, 0x00f0012b,
+    0x0000012a, 0x0000012a, 0x0000012a, 0x0000012a, 0x00ff012a, 0x00ff012a, 0x00ff012a, 0x00ff012a,
+    0x0001012a, 0x0001012a, 0x0001012a, 0x0001012a, 0x00fe012a, 0x00fe012a, 0x00fe012a, 0x00fe012a,
+    0x0002012a, 0x0002012a, 0x0002012a, 0x0002012a, 0x00fd012a, 0x00fd012a, 0x00fd012a, 0x00fd012a,
+    0x0003012a, 0x0003012a, 0x0003012a, 0x0003012a, 0x00fc012a, 0x00fc012a, 0x00fc012a, 0x00fc012a,
+    0x0004012a, 0x0004012a, 0x0004012a, 0x0004012a, 0x00fb012a, 0x00fb012a, 0x00fb012a, 0x00fb012a,
+    0x0005012a, 0x0005012a, 0x0005012a, 0x0005012a, 0x00fa012a, 0x00fa012a, 0x00fa012a, 0x00fa012a,
+    0x0006012a, 0x0006012a, 0x0006012a, 0x0006012a, 0x00f9012a, 0x00f9012a, 0x00f9012a, 0x00f9012a,
+    0x0007012a, 0x0007012a, 0x0007012a, 0x0007012a, 0x00f8012a, 0x00f8012a, 0x00f8012a, 0x00f8012a,
+    0x0000fe15, 0x0000fe15, 0x0000fe15, 0x0000fe15, 0x0000fe15, 0x0000fe15, 0x0000fe15, 0x0000fe15,
+    0x0000fe15, 0x0000fe15, 0x0000fe15, 0x0000fe15, 0x0000fe15, 0x0000fe15, 0x0000fe15, 0x0000fe15,
+    0x0010fe2c, 0x00effe2c, 0x0011fe2c, 0x00eefe2c, 0x0012fe2c, 0x00edfe2c, 0x0013fe2c, 0x00ecfe2c,
+    0x0014fe2c, 0x00ebfe2c, 0x0015fe2c, 0x00eafe2c, 0x0016fe2c, 0x00e9fe2c, 0x0017fe2c, 0x00e8fe2c,
+    0x0008fe2b, 0x0008fe2b, 0x00f7fe2b, 0x00f7fe2b, 0x0009fe2b, 0x0009fe2b, 0x00f6fe2b, 0x00f6fe2b,
+    0x000afe2b, 0x000afe2b, 0x00f5fe2b, 0x00f5fe2b, 0x000bfe2b, 0x000bfe2b, 0x00f4fe2b, 0x00f4fe2b,
+    0x000cfe2b, 0x000cfe2b, 0x00f3fe2b, 0x00f3fe2b, 0x000dfe2b, 0x000dfe2b, 0x00f2fe2b, 0x00f2fe2b,
+    0x000efe2b, 0x000efe2b, 0x00f1fe2b, 0x00f1fe2b, 0x000ffe2b, 0x000ffe2b, 0x00f0fe2b, 0x00f0fe2b,
+    0x0000fe2a, 0x0000fe2a, 0x0000fe2a, 0x0000fe2a, 0x00fffe2a, 0x00fffe2a, 0x00fffe2a, 0x00fffe2a,
+    0x0001fe2a, 0x0001fe2a, 0x0001fe2a, 0x0001fe2a, 0x00fefe2a, 0x00fefe2a, 0x00fefe2a, 0x00fefe2a,
+    0x0002fe2a, 0x0002fe2a, 0x0002fe2a, 0x0002fe2a, 0x00fdfe2a, 0x00fdfe2a, 0x00fdfe2a, 0x00fdfe2a,
+    0x0003fe2a, 0x0003fe2a, 0x0003fe2a, 0x0003fe2a, 0x00fcfe2a, 0x00fcfe2a, 0x00fcfe2a, 0x00fcfe2a,
+    0x0004fe2a, 0x0004fe2a, 0x0004fe2a, 0x0004fe2a, 0x00fbfe2a, 0x00fbfe2a, 0x00fbfe2a, 0x00fbfe2a,
+    0x0005fe2a, 0x0005fe2a, 0x0005fe2a, 0x0005fe2a, 0x00fafe2a, 0x00fafe2a, 0x00fafe2a, 0x00fafe2a,
+    0x0006fe2a, 0x0006fe2a, 0x0006fe2a, 0x0006fe2a, 0x00f9fe2a, 0x00f9fe2a, 0x00f9fe2a, 0x00f9fe2a,
+    0x0007fe2a, 0x0007fe2a, 0x0007fe2a, 0x0007fe2a, 0x00f8fe2a, 0x00f8fe2a, 0x00f8fe2a, 0x00f8fe2a,
+    0x00000215, 0x00000215, 0x00000215, 0x00000215, 0x00000215, 0x00000215, 0x00000215, 0x00000215,
+    0x00000215, 0x00000215, 0x00000215, 0x00000215, 0x00000215, 0x00000215, 0x00000215, 0x00000215,
+    0x0010022c, 0x00ef022c, 0x0011022c, 0x00ee022c, 0x0012022c, 0x00ed022c, 0x0013022c, 0x00ec022c,
+    0x0014022c, 0x00eb022c, 0x0015022c, 0x00ea022c, 0x0016022c, 0x00e9022c, 0x0017022c, 0x00e8022c,
+    0x0008022b, 0x0008022b, 0x00f7022b, 0x00f7022b, 0x0009022b, 0x0009022b, 0x00f6022b, 0x00f6022b,
+    0x000a022b, 0x000a022b, 0x00f5022b, 0x00f5022b, 0x000b022b, 0x000b022b, 0x00f4022b, 0x00f4022b,
+    0x000c022b, 0x000c022b, 0x00f3022b, 0x00f3022b, 0x000d022b, 0x000d022b, 0x00f2022b, 0x00f2022b,
+    0x000e022b, 0x000e022b, 0x00f1022b, 0x00f1022b, 0x000f022b, 0x000f022b, 0x00f0022b, 0x00f0022b,
+    0x0000022a, 0x0000022a, 0x0000022a, 0x0000022a, 0x00ff022a, 0x00ff022a, 0x00ff022a, 0x00ff022a,
+    0x0001022a, 0x0001022a, 0x0001022a, 0x0001022a, 0x00fe022a, 0x00fe022a, 0x00fe022a, 0x00fe022a,
+    0x0002022a, 0x0002022a, 0x0002022a, 0x0002022a, 0x00fd022a, 0x00fd022a, 0x00fd022a, 0x00fd022a,
+    0x0003022a, 0x0003022a, 0x0003022a, 0x0003022a, 0x00fc022a, 0x00fc022a, 0x00fc022a, 0x00fc022a,
+    0x0004022a, 0x0004022a, 0x0004022a, 0x0004022a, 0x00fb022a, 0x00fb022a, 0x00fb022a, 0x00fb022a,
+    0x0005022a, 0x0005022a, 0x0005022a, 0x0005022a, 0x00fa022a, 0x00fa022a, 0x00fa022a, 0x00fa022a,
+    0x0006022a, 0x0006022a, 0x0006022a, 0x0006022a, 0x00f9022a, 0x00f9022a, 0x00f9022a, 0x00f9022a,
+    0x0007022a, 0x0007022a, 0x0007022a, 0x0007022a, 0x00f8022a, 0x00f8022a, 0x00f8022a, 0x00f8022a,
+    0x0000fd15, 0x0000fd15, 0x0000fd15, 0x0000fd15, 0x0000fd15, 0x0000fd15, 0x0000fd15, 0x0000fd15,
+    0x0000fd15, 0x0000fd15, 0x0000fd15, 0x0000fd15, 0x0000fd15, 0x0000fd15, 0x0000fd15, 0x0000fd15,
+    0x0010fd2c, 0x00effd2c, 0x0011fd2c, 0x00eefd2c, 0x0012fd2c, 0x00edfd2c, 0x0013fd2c, 0x00ecfd2c,
+    0x0014fd2c, 0x00ebfd2c, 0x0015fd2c, 0x00eafd2c, 0x0016fd2c, 0x00e9fd2c, 0x0017fd2c, 0x00e8fd2c,
+    0x0008fd2b, 0x0008fd2b, 0x00f7fd2b, 0x00f7fd2b, 0x0009fd2b, 0x0009fd2b, 0x00f6fd2b, 0x00f6fd2b,
+    0x000afd2b, 0x000afd2b, 0x00f5fd2b, 0x00f5fd2b, 0x000bfd2b, 0x000bfd2b, 0x00f4fd2b, 0x00f4fd2b,
+    0x000cfd2b, 0x000cfd2b, 0x00f3fd2b, 0x00f3fd2b, 0x000dfd2b, 0x000dfd2b, 0x00f2fd2b, 0x00f2fd2b,
+    0x000efd2b, 0x000efd2b, 0x00f1fd2b, 0x00f1fd2b, 0x000ffd2b, 0x000ffd2b, 0x00f0fd2b, 0x00f0fd2b,
+    0x0000fd2a, 0x0000fd2a, 0x0000fd2a, 0x0000fd2a, 0x00fffd2a, 0x00fffd2a, 0x00fffd2a, 0x00fffd2a,
+    0x0001fd2a, 0x0001fd2a, 0x0001fd2a, 0x0001fd2a, 0x00fefd2a, 0x00fefd2a, 0x00fefd2a, 0x00fefd2a,
+    0x0002fd2a, 0x0002fd2a, 0x0002fd2a, 0x0002fd2a, 0x00fdfd2a, 0x00fdfd2a, 0x00fdfd2a, 0x00fdfd2a,
+    0x0003fd2a, 0x0003fd2a, 0x0003fd2a, 0x0003fd2a, 0x00fcfd2a, 0x00fcfd2a, 0x00fcfd2a, 0x00fcfd2a,
+    0x0004fd2a, 0x0004fd2a, 0x0004fd2a, 0x0004fd2a, 0x00fbfd2a, 0x00fbfd2a, 0x00fbfd2a, 0x00fbfd2a,
+    0x0005fd2a, 0x0005fd2a, 0x0005fd2a, 0x0005fd2a, 0x00fafd2a, 0x00fafd2a, 0x00fafd2a, 0x00fafd2a,
+    0x0006fd2a, 0x0006fd2a, 0x0006fd2a, 0x0006fd2a, 0x00f9fd2a, 0x00f9fd2a, 0x00f9fd2a, 0x00f9fd2a,
+    0x0007fd2a, 0x0007fd2a, 0x0007fd2a, 0x0007fd2a, 0x00f8fd2a, 0x00f8fd2a, 0x00f8fd2a, 0x00f8fd2a,
+    0x00000315, 0x00000315, 0x00000315, 0x00000315, 0x00000315, 0x00000315, 0x00000315, 0x00000315,
+    0x00000315, 0x00000315, 0x00000315, 0x00000315, 0x00000315, 0x00000315, 0x00000315, 0x00000315,
+    0x0010032c, 0x00ef032c, 0x0011032c, 0x00ee032c, 0x0012032c, 0x00ed032c, 0x0013032c, 0x00ec032c,
+    0x0014032c, 0x00eb032c, 0x0015032c, 0x00ea032c, 0x0016032c, 0x00e9032c, 0x0017032c, 0x00e8032c,
+    0x0008032b, 0x0008032b, 0x00f7032b, 0x00f7032b, 0x0009032b, 0x0009032b, 0x00f6032b, 0x00f6032b,
+    0x000a032b, 0x000a032b, 0x00f5032b, 0x00f5032b, 0x000b032b, 0x000b032b, 0x00f4032b, 0x00f4032b,
+    0x000c032b, 0x000c032b, 0x00f3032b, 0x00f3032b, 0x000d032b, 0x000d032b, 0x00f2032b, 0x00f2032b,
+    0x000e032b, 0x000e032b, 0x00f1032b, 0x00f1032b, 0x000f032b, 0x000f032b, 0x00f0032b, 0x00f0032b,
+    0x0000032a, 0x0000032a, 0x0000032a, 0x0000032a, 0x00ff032a, 0x00ff032a, 0x00ff032a, 0x00ff032a,
+    0x0001032a, 0x0001032a, 0x0001032a, 0x0001032a, 0x00fe032a, 0x00fe032a, 0x00fe032a, 0x00fe032a,
+    0x0002032a, 0x0002032a, 0x0002032a, 0x0002032a, 0x00fd032a, 0x00fd032a, 0x00fd032a, 0x00fd032a,
+    0x0003032a, 0x0003032a, 0x0003032a, 0x0003032a, 0x00fc032a, 0x00fc032a, 0x00fc032a, 0x00fc032a,
+    0x0004032a, 0x0004032a, 0x0004032a, 0x0004032a, 0x00fb032a, 0x00fb032a, 0x00fb032a, 0x00fb032a,
+    0x0005032a, 0x0005032a, 0x0005032a, 0x0005032a, 0x00fa032a, 0x00fa032a, 0x00fa032a, 0x00fa032a,
+    0x0006032a, 0x0006032a, 0x0006032a, 0x0006032a, 0x00f9032a, 0x00f9032a, 0x00f9032a, 0x00f9032a,
+    0x0007032a, 0x0007032a, 0x0007032a, 0x0007032a, 0x00f8032a, 0x00f8032a, 0x00f8032a, 0x00f8032a,
+    0x0000fc15, 0x0000fc15, 0x0000fc15, 0x0000fc15, 0x0000fc15, 0x0000fc15, 0x0000fc15, 0x0000fc15,
+    0x0000fc15, 0x0000fc15, 0x0000fc15, 0x0000fc15, 0x0000fc15, 0x0000fc15, 0x0000fc15, 0x0000fc15,
+    0x0010fc2c, 0x00effc2c, 0x0011fc2c, 0x00eefc2c, 0x0012fc2c, 0x00edfc2c, 0x0013fc2c, 0x00ecfc2c,
+    0x0014fc2c, 0x00ebfc2c, 0x0015fc2c, 0x00eafc2c, 0x0016fc2c, 0x00e9fc2c, 0x0017fc2c, 0x00e8fc2c,
+    0x0008fc2b, 0x0008fc2b, 0x00f7fc2b, 0x00f7fc2b, 0x0009fc2b, 0x0009fc2b, 0x00f6fc2b, 0x00f6fc2b,
+    0x000afc2b, 0x000afc2b, 0x00f5fc2b, 0x00f5fc2b, 0x000bfc2b, 0x000bfc2b, 0x00f4fc2b, 0x00f4fc2b,
+    0x000cfc2b, 0x000cfc2b, 0x00f3fc2b, 0x00f3fc2b, 0x000dfc2b, 0x000dfc2b, 0x00f2fc2b, 0x00f2fc2b,
+    0x000efc2b, 0x000efc2b, 0x00f1fc2b, 0x00f1fc2b, 0x000ffc2b, 0x000ffc2b, 0x00f0fc2b, 0x00f0fc2b,
+    0x0000fc2a, 0x0000fc2a, 0x0000fc2a, 0x0000fc2a, 0x00fffc2a, 0x00fffc2a, 0x00fffc2a, 0x00fffc2a,
+    0x0001fc2a, 0x0001fc2a, 0x0001fc2a, 0x0001fc2a, 0x00fefc2a, 0x00fefc2a, 0x00fefc2a, 0x00fefc2a,
+    0x0002fc2a, 0x0002fc2a, 0x0002fc2a, 0x0002fc2a, 0x00fdfc2a, 0x00fdfc2a, 0x00fdfc2a, 0x00fdfc2a,
+    0x0003fc2a, 0x0003fc2a, 0x0003fc2a, 0x0003fc2a, 0x00fcfc2a, 0x00fcfc2a, 0x00fcfc2a, 0x00fcfc2a,
+    0x0004fc2a, 0x0004fc2a, 0x0004fc2a, 0x0004fc2a, 0x00fbfc2a, 0x00fbfc2a, 0x00fbfc2a, 0x00fbfc2a,
+    0x0005fc2a, 0x0005fc2a, 0x0005fc2a, 0x0005fc2a, 0x00fafc2a, 0x00fafc2a, 0x00fafc2a, 0x00fafc2a,
+    0x0006fc2a, 0x0006fc2a, 0x0006fc2a, 0x0006fc2a, 0x00f9fc2a, 0x00f9fc2a, 0x00f9fc2a, 0x00f9fc2a,
+    0x0007fc2a, 0x0007fc2a, 0x0007fc2a, 0x0007fc2a, 0x00f8fc2a, 0x00f8fc2a, 0x00f8fc2a, 0x00f8fc2a,
+    0x00000415, 0x00000415, 0x00000415, 0x00000415, 0x00000415, 0x00000415, 0x00000415, 0x00000415,
+    0x00000415, 0x00000415, 0x00000415, 0x00000415, 0x00000415, 0x00000415, 0x00000415, 0x00000415,
+    0x0010042c, 0x00ef042c, 0x0011042c, 0x00ee042c, 0x0012042c, 0x00ed042c, 0x0013042c, 0x00ec042c,
+    0x0014042c, 0x00eb042c, 0x0015042c, 0x00ea042c, 0x0016042c, 0x00e9042c, 0x0017042c, 0x00e8042c,
+    0x0008042b, 0x0008042b, 0x00f7042b, 0x00f7042b, 0x0009042b, 0x0009042b, 0x00f6042b, 0x00f6042b,
+    0x000a042b, 0x000a042b, 0x00f5042b, 0x00f5042b, 0x000b042b, 0x000b042b, 0x00f4042b, 0x00f4042b,
+    0x000c042b, 0x000c042b, 0x00f3042b, 0x00f3042b, 0x000d042b, 0x000d042b, 0x00f2042b, 0x00f2042b,
+    0x000e042b, 0x000e042b, 0x00f1042b, 0x00f1042b, 0x000f042b, 0x000f042b, 0x00f0042b, 0x00f0042b,
+    0x0000042a, 0x0000042a, 0x0000042a, 0x0000042a, 0x00ff042a, 0x00ff042a, 0x00ff042a, 0x00ff042a,
+    0x0001042a, 0x0001042a, 0x0001042a, 0x0001042a, 0x00fe042a, 0x00fe042a, 0x00fe042a, 0x00fe042a,
+    0x0002042a, 0x0002042a, 0x0002042a, 0x0002042a, 0x00fd042a, 0x00fd042a, 0x00fd042a, 0x00fd042a,
+    0x0003042a, 0x0003042a, 0x0003042a, 0x0003042a, 0x00fc042a, 0x00fc042a, 0x00fc042a, 0x00fc042a,
+    0x0004042a, 0x0004042a, 0x0004042a, 0x0004042a, 0x00fb042a, 0x00fb042a, 0x00fb042a, 0x00fb042a,
+    0x0005042a, 0x0005042a, 0x0005042a, 0x0005042a, 0x00fa042a, 0x00fa042a, 0x00fa042a, 0x00fa042a,
+    0x0006042a, 0x0006042a, 0x0006042a, 0x0006042a, 0x00f9042a, 0x00f9042a, 0x00f9042a, 0x00f9042a,
+    0x0007042a, 0x0007042a, 0x0007042a, 0x0007042a, 0x00f8042a, 0x00f8042a, 0x00f8042a, 0x00f8042a,
+    0x0000fb15, 0x0000fb15, 0x0000fb15, 0x0000fb15, 0x0000fb15, 0x0000fb15, 0x0000fb15, 0x0000fb15,
+    0x0000fb15, 0x0000fb15, 0x0000fb15, 0x0000fb15, 0x0000fb15, 0x0000fb15, 0x0000fb15, 0x0000fb15,
+    0x0010fb2c, 0x00effb2c, 0x0011fb2c, 0x00eefb2c, 0x0012fb2c, 0x00edfb2c, 0x0013fb2c, 0x00ecfb2c,
+    0x0014fb2c, 0x00ebfb2c, 0x0015fb2c, 0x00eafb2c, 0x0016fb2c, 0x00e9fb2c, 0x0017fb2c, 0x00e8fb2c,
+    0x0008fb2b, 0x0008fb2b, 0x00f7fb2b, 0x00f7fb2b, 0x0009fb2b, 0x0009fb2b, 0x00f6fb2b, 0x00f6fb2b,
+    0x000afb2b, 0x000afb2b, 0x00f5fb2b, 0x00f5fb2b, 0x000bfb2b, 0x000bfb2b, 0x00f4fb2b, 0x00f4fb2b,
+    0x000cfb2b, 0x000cfb2b, 0x00f3fb2b, 0x00f3fb2b, 0x000dfb2b, 0x000dfb2b, 0x00f2fb2b, 0x00f2fb2b,
+    0x000efb2b, 0x000efb2b, 0x00f1fb2b, 0x00f1fb2b, 0x000ffb2b, 0x000ffb2b, 0x00f0fb2b, 0x00f0fb2b,
+    0x0000fb2a, 0x0000fb2a, 0x0000fb2a, 0x0000fb2a, 0x00fffb2a, 0x00fffb2a, 0x00fffb2a, 0x00fffb2a,
+    0x0001fb2a, 0x0001fb2a, 0x0001fb2a, 0x0001fb2a, 0x00fefb2a, 0x00fefb2a, 0x00fefb2a, 0x00fefb2a,
+    0x0002fb2a, 0x0002fb2a, 0x0002fb2a, 0x0002fb2a, 0x00fdfb2a, 0x00fdfb2a, 0x00fdfb2a, 0x00fdfb2a,
+    0x0003fb2a, 0x0003fb2a, 0x0003fb2a, 0x0003fb2a, 0x00fcfb2a, 0x00fcfb2a, 0x00fcfb2a, 0x00fcfb2a,
+    0x0004fb2a, 0x0004fb2a, 0x0004fb2a, 0x0004fb2a, 0x00fbfb2a, 0x00fbfb2a, 0x00fbfb2a, 0x00fbfb2a,
+    0x0005fb2a, 0x0005fb2a, 0x0005fb2a, 0x0005fb2a, 0x00fafb2a, 0x00fafb2a, 0x00fafb2a, 0x00fafb2a,
+    0x0006fb2a, 0x0006fb2a, 0x0006fb2a, 0x0006fb2a, 0x00f9fb2a, 0x00f9fb2a, 0x00f9fb2a, 0x00f9fb2a,
+    0x0007fb2a, 0x0007fb2a, 0x0007fb2a, 0x0007fb2a, 0x00f8fb2a, 0x00f8fb2a, 0x00f8fb2a, 0x00f8fb2a,
+    0x00000515, 0x00000515, 0x00000515, 0x00000515, 0x00000515, 0x00000515, 0x00000515, 0x00000515,
+    0x00000515, 0x00000515, 0x00000515, 0x00000515, 0x00000515, 0x00000515, 0x00000515, 0x00000515,
+    0x0010052c, 0x00ef052c, 0x0011052c, 0x00ee052c, 0x0012052c, 0x00ed052c, 0x0013052c, 0x00ec052c,
+    0x0014052c, 0x00eb052c, 0x0015052c, 0x00ea052c, 0x0016052c, 0x00e9052c, 0x0017052c, 0x00e8052c,
+    0x0008052b, 0x0008052b, 0x00f7052b, 0x00f7052b, 0x0009052b, 0x0009052b, 0x00f6052b, 0x00f6052b,
+    0x000a052b, 0x000a052b, 0x00f5052b, 0x00f5052b, 0x000b052b, 0x000b052b, 0x00f4052b, 0x00f4052b,
+    0x000c052b, 0x000c052b, 0x00f3052b, 0x00f3052b, 0x000d052b, 0x000d052b, 0x00f2052b, 0x00f2052b,
+    0x000e052b, 0x000e052b, 0x00f1052b, 0x00f1052b, 0x000f052b, 0x000f052b, 0x00f0052b, 0x00f0052b,
+    0x0000052a, 0x0000052a, 0x0000052a, 0x0000052a, 0x00ff052a, 0x00ff052a, 0x00ff052a, 0x00ff052a,
+    0x0001052a, 0x0001052a, 0x0001052a, 0x0001052a, 0x00fe052a, 0x00fe052a, 0x00fe052a, 0x00fe052a,
+    0x0002052a, 0x0002052a, 0x0002052a, 0x0002052a, 0x00fd052a, 0x00fd052a, 0x00fd052a, 0x00fd052a,
+    0x0003052a, 0x0003052a, 0x0003052a, 0x0003052a, 0x00fc052a, 0x00fc052a, 0x00fc052a, 0x00fc052a,
+    0x0004052a, 0x0004052a, 0x0004052a, 0x0004052a, 0x00fb052a, 0x00fb052a, 0x00fb052a, 0x00fb052a,
+    0x0005052a, 0x0005052a, 0x0005052a, 0x0005052a, 0x00fa052a, 0x00fa052a, 0x00fa052a, 0x00fa052a,
+    0x0006052a, 0x0006052a, 0x0006052a, 0x0006052a, 0x00f9052a, 0x00f9052a, 0x00f9052a, 0x00f9052a,
+    0x0007052a, 0x0007052a, 0x0007052a, 0x0007052a, 0x00f8052a, 0x00f8052a, 0x00f8052a, 0x00f8052a,
+    0x0000fa15, 0x0000fa15, 0x0000fa15, 0x0000fa15, 0x0000fa15, 0x0000fa15, 0x0000fa15, 0x0000fa15,
+    0x0000fa15, 0x0000fa15, 0x0000fa15, 0x0000fa15, 0x0000fa15, 0x0000fa15, 0x0000fa15, 0x0000fa15,
+    0x0010fa2c, 0x00effa2c, 0x0011fa2c, 0x00eefa2c, 0x0012fa2c, 0x00edfa2c, 0x0013fa2c, 0x00ecfa2c,
+    0x0014fa2c, 0x00ebfa2c, 0x0015fa2c, 0x00eafa2c, 0x0016fa2c, 0x00e9fa2c, 0x0017fa2c, 0x00e8fa2c,
+    0x0008fa2b, 0x0008fa2b, 0x00f7fa2b, 0x00f7fa2b, 0x0009fa2b, 0x0009fa2b, 0x00f6fa2b, 0x00f6fa2b,
+    0x000afa2b, 0x000afa2b, 0x00f5fa2b, 0x00f5fa2b, 0x000bfa2b, 0x000bfa2b, 0x00f4fa2b, 0x00f4fa2b,
+    0x000cfa2b, 0x000cfa2b, 0x00f3fa2b, 0x00f3fa2b, 0x000dfa2b, 0x000dfa2b, 0x00f2fa2b, 0x00f2fa2b,
+    0x000efa2b, 0x000efa2b, 0x00f1fa2b, 0x00f1fa2b, 0x000ffa2b, 0x000ffa2b, 0x00f0fa2b, 0x00f0fa2b,
+    0x0000fa2a, 0x0000fa2a, 0x0000fa2a, 0x0000fa2a, 0x00fffa2a, 0x00fffa2a, 0x00fffa2a, 0x00fffa2a,
+    0x0001fa2a, 0x0001fa2a, 0x0001fa2a, 0x0001fa2a, 0x00fefa2a, 0x00fefa2a, 0x00fefa2a, 0x00fefa2a,
+    0x0002fa2a, 0x0002fa2a, 0x0002fa2a, 0x0002fa2a, 0x00fdfa2a, 0x00fdfa2a, 0x00fdfa2a, 0x00fdfa2a,
+    0x0003fa2a, 0x0003fa2a, 0x0003fa2a, 0x0003fa2a, 0x00fcfa2a, 0x00fcfa2a, 0x00fcfa2a, 0x00fcfa2a,
+    0x0004fa2a, 0x0004fa2a, 0x0004fa2a, 0x0004fa2a, 0x00fbfa2a, 0x00fbfa2a, 0x00fbfa2a, 0x00fbfa2a,
+    0x0005fa2a, 0x0005fa2a, 0x0005fa2a, 0x0005fa2a, 0x00fafa2a, 0x00fafa2a, 0x00fafa2a, 0x00fafa2a,
+    0x0006fa2a, 0x0006fa2a, 0x0006fa2a, 0x0006fa2a, 0x00f9fa2a, 0x00f9fa2a, 0x00f9fa2a, 0x00f9fa2a,
+    0x0007fa2a, 0x0007fa2a, 0x0007fa2a, 0x0007fa2a, 0x00f8fa2a, 0x00f8fa2a, 0x00f8fa2a, 0x00f8fa2a,
+    0x00000615, 0x00000615, 0x00000615, 0x00000615, 0x00000615, 0x00000615, 0x00000615, 0x00000615,
+    0x00000615, 0x00000615, 0x00000615, 0x00000615, 0x00000615, 0x00000615, 0x00000615, 0x00000615,
+    0x0010062c, 0x00ef062c, 0x0011062c, 0x00ee062c, 0x0012062c, 0x00ed062c, 0x0013062c, 0x00ec062c,
+    0x0014062c, 0x00eb062c, 0x0015062c, 0x00ea062c, 0x0016062c, 0x00e9062c, 0x0017062c, 0x00e8062c,
+    0x0008062b, 0x0008062b, 0x00f7062b, 0x00f7062b, 0x0009062b, 0x0009062b, 0x00f6062b, 0x00f6062b,
+    0x000a062b, 0x000a062b, 0x00f5062b, 0x00f5062b, 0x000b062b, 0x000b062b, 0x00f4062b, 0x00f4062b,
+    0x000c062b, 0x000c062b, 0x00f3062b, 0x00f3062b, 0x000d062b, 0x000d062b, 0x00f2062b, 0x00f2062b,
+    0x000e062b, 0x000e062b, 0x00f1062b, 0x00f1062b, 0x000f062b, 0x000f062b, 0x00f0062b, 0x00f0062b,
+    0x0000062a, 0x0000062a, 0x0000062a, 0x0000062a, 0x00ff062a, 0x00ff062a, 0x00ff062a, 0x00ff062a,
+    0x0001062a, 0x0001062a, 0x0001062a, 0x0001062a, 0x00fe062a, 0x00fe062a, 0x00fe062a, 0x00fe062a,
+    0x0002062a, 0x0002062a, 0x0002062a, 0x0002062a, 0x00fd062a, 0x00fd062a, 0x00fd062a, 0x00fd062a,
+    0x0003062a, 0x0003062a, 0x0003062a, 0x0003062a, 0x00fc062a, 0x00fc062a, 0x00fc062a, 0x00fc062a,
+    0x0004062a, 0x0004062a, 0x0004062a, 0x0004062a, 0x00fb062a, 0x00fb062a, 0x00fb062a, 0x00fb062a,
+    0x0005062a, 0x0005062a, 0x0005062a, 0x0005062a, 0x00fa062a, 0x00fa062a, 0x00fa062a, 0x00fa062a,
+    0x0006062a, 0x0006062a, 0x0006062a, 0x0006062a, 0x00f9062a, 0x00f9062a, 0x00f9062a, 0x00f9062a,
+    0x0007062a, 0x0007062a, 0x0007062a, 0x0007062a, 0x00f8062a, 0x00f8062a, 0x00f8062a, 0x00f8062a,
+    0x0000f915, 0x0000f915, 0x0000f915, 0x0000f915, 0x0000f915, 0x0000f915, 0x0000f915, 0x0000f915,
+    0x0000f915, 0x0000f915, 0x0000f915, 0x0000f915, 0x0000f915, 0x0000f915, 0x0000f915, 0x0000f915,
+    0x0010f92c, 0x00eff92c, 0x0011f92c, 0x00eef92c, 0x0012f92c, 0x00edf92c, 0x0013f92c, 0x00ecf92c,
+    0x0014f92c, 0x00ebf92c, 0x0015f92c, 0x00eaf92c, 0x0016f92c, 0x00e9f92c, 0x0017f92c, 0x00e8f92c,
+    0x0008f92b, 0x0008f92b, 0x00f7f92b, 0x00f7f92b, 0x0009f92b, 0x0009f92b, 0x00f6f92b, 0x00f6f92b,
+    0x000af92b, 0x000af92b, 0x00f5f92b, 0x00f5f92b, 0x000bf92b, 0x000bf92b, 0x00f4f92b, 0x00f4f92b,
+    0x000cf92b, 0x000cf92b, 0x00f3f92b, 0x00f3f92b, 0x000df92b, 0x000df92b, 0x00f2f92b, 0x00f2f92b,
+    0x000ef92b, 0x000ef92b, 0x00f1f92b, 0x00f1f92b, 0x000ff92b, 0x000ff92b, 0x00f0f92b, 0x00f0f92b,
+    0x0000f92a, 0x0000f92a, 0x0000f92a, 0x0000f92a, 0x00fff92a, 0x00fff92a, 0x00fff92a, 0x00fff92a,
+    0x0001f92a, 0x0001f92a, 0x0001f92a, 0x0001f92a, 0x00fef92a, 0x00fef92a, 0x00fef92a, 0x00fef92a,
+    0x0002f92a, 0x0002f92a, 0x0002f92a, 0x0002f92a, 0x00fdf92a, 0x00fdf92a, 0x00fdf92a, 0x00fdf92a,
+    0x0003f92a, 0x0003f92a, 0x0003f92a, 0x0003f92a, 0x00fcf92a, 0x00fcf92a, 0x00fcf92a, 0x00fcf92a,
+    0x0004f92a, 0x0004f92a, 0x0004f92a, 0x0004f92a, 0x00fbf92a, 0x00fbf92a, 0x00fbf92a, 0x00fbf92a,
+    0x0005f92a, 0x0005f92a, 0x0005f92a, 0x0005f92a, 0x00faf92a, 0x00faf92a, 0x00faf92a, 0x00faf92a,
+    0x0006f92a, 0x0006f92a, 0x0006f92a, 0x0006f92a, 0x00f9f92a, 0x00f9f92a, 0x00f9f92a, 0x00f9f92a,
+    0x0007f92a, 0x0007f92a, 0x0007f92a, 0x0007f92a, 0x00f8f92a, 0x00f8f92a, 0x00f8f92a, 0x00f8f92a,
+    0x00000715, 0x00000715, 0x00000715, 0x00000715, 0x00000715, 0x00000715, 0x00000715, 0x00000715,
+    0x00000715, 0x00000715, 0x00000715, 0x00000715, 0x00000715, 0x00000715, 0x00000715, 0x00000715,
+    0x0010072c, 0x00ef072c, 0x0011072c, 0x00ee072c, 0x0012072c, 0x00ed072c, 0x0013072c, 0x00ec072c,
+    0x0014072c, 0x00eb072c, 0x0015072c, 0x00ea072c, 0x0016072c, 0x00e9072c, 0x0017072c, 0x00e8072c,
+    0x0008072b, 0x0008072b, 0x00f7072b, 0x00f7072b, 0x0009072b, 0x0009072b, 0x00f6072b, 0x00f6072b,
+    0x000a072b, 0x000a072b, 0x00f5072b, 0x00f5072b, 0x000b072b, 0x000b072b, 0x00f4072b, 0x00f4072b,
+    0x000c072b, 0x000c072b, 0x00f3072b, 0x00f3072b, 0x000d072b, 0x000d072b, 0x00f2072b, 0x00f2072b,
+    0x000e072b, 0x000e072b, 0x00f1072b, 0x00f1072b, 0x000f072b, 0x000f072b, 0x00f0072b, 0x00f0072b,
+    0x0000072a, 0x0000072a, 0x0000072a, 0x0000072a, 0x00ff072a, 0x00ff072a, 0x00ff072a, 0x00ff072a,
+    0x0001072a, 0x0001072a, 0x0001072a, 0x0001072a, 0x00fe072a, 0x00fe072a, 0x00fe072a, 0x00fe072a,
+    0x0002072a, 0x0002072a, 0x0002072a, 0x0002072a, 0x00fd072a, 0x00fd072a, 0x00fd072a, 0x00fd072a,
+    0x0003072a, 0x0003072a, 0x0003072a, 0x0003072a, 0x00fc072a, 0x00fc072a, 0x00fc072a, 0x00fc072a,
+    0x0004072a, 0x0004072a, 0x0004072a, 0x0004072a, 0x00fb072a, 0x00fb072a, 0x00fb072a, 0x00fb072a,
+    0x0005072a, 0x0005072a, 0x0005072a, 0x0005072a, 0x00fa072a, 0x00fa072a, 0x00fa072a, 0x00fa072a,
+    0x0006072a, 0x0006072a, 0x0006072a, 0x0006072a, 0x00f9072a, 0x00f9072a, 0x00f9072a, 0x00f9072a,
+    0x0007072a, 0x0007072a, 0x0007072a, 0x0007072a, 0x00f8072a, 0x00f8072a, 0x00f8072a, 0x00f8072a,
+    0x0000f815, 0x0000f815, 0x0000f815, 0x0000f815, 0x0000f815, 0x0000f815, 0x0000f815, 0x0000f815,
+    0x0000f815, 0x0000f815, 0x0000f815, 0x0000f815, 0x0000f815, 0x0000f815, 0x0000f815, 0x0000f815,
+    0x0010f82c, 0x00eff82c, 0x0011f82c, 0x00eef82c, 0x0012f82c, 0x00edf82c, 0x0013f82c, 0x00ecf82c,
+    0x0014f82c, 0x00ebf82c, 0x0015f82c, 0x00eaf82c, 0x0016f82c, 0x00e9f82c, 0x0017f82c, 0x00e8f82c,
+    0x0008f82b, 0x0008f82b, 0x00f7f82b, 0x00f7f82b, 0x0009f82b, 0x0009f82b, 0x00f6f82b, 0x00f6f82b,
+    0x000af82b, 0x000af82b, 0x00f5f82b, 0x00f5f82b, 0x000bf82b, 0x000bf82b, 0x00f4f82b, 0x00f4f82b,
+    0x000cf82b, 0x000cf82b, 0x00f3f82b, 0x00f3f82b, 0x000df82b, 0x000df82b, 0x00f2f82b, 0x00f2f82b,
+    0x000ef82b, 0x000ef82b, 0x00f1f82b, 0x00f1f82b, 0x000ff82b, 0x000ff82b, 0x00f0f82b, 0x00f0f82b,
+    0x0000f82a, 0x0000f82a, 0x0000f82a, 0x0000f82a, 0x00fff82a, 0x00fff82a, 0x00fff82a, 0x00fff82a,
+    0x0001f82a, 0x0001f82a, 0x0001f82a, 0x0001f82a, 0x00fef82a, 0x00fef82a, 0x00fef82a, 0x00fef82a,
+    0x0002f82a, 0x0002f82a, 0x0002f82a, 0x0002f82a, 0x00fdf82a, 0x00fdf82a, 0x00fdf82a, 0x00fdf82a,
+    0x0003f82a, 0x0003f82a, 0x0003f82a, 0x0003f82a, 0x00fcf82a, 0x00fcf82a, 0x00fcf82a, 0x00fcf82a,
+    0x0004f82a, 0x0004f82a, 0x0004f82a, 0x0004f82a, 0x00fbf82a, 0x00fbf82a, 0x00fbf82a, 0x00fbf82a,
+    0x0005f82a, 0x0005f82a, 0x0005f82a, 0x0005f82a, 0x00faf82a, 0x00faf82a, 0x00faf82a, 0x00faf82a,
+    0x0006f82a, 0x0006f82a, 0x0006f82a, 0x0006f82a, 0x00f9f82a, 0x00f9f82a, 0x00f9f82a, 0x00f9f82a,
+    0x0007f82a, 0x0007f82a, 0x0007f82a, 0x0007f82a, 0x00f8f82a, 0x00f8f82a, 0x00f8f82a, 0x00f8f82a,
+  },
+};
+#endif
+
 MINIFLAC_PRIVATE
 void
 miniflac_residual_init(miniflac_residual_t* residual) {
@@ -5479,31 +12020,24 @@ miniflac_residual_decode(miniflac_residual_t* residual, miniflac_bitreader_t* br
         /* fall-through */
         case MINIFLAC_RESIDUAL_MSB: {
             miniflac_residual_msb:
-            while(!miniflac_bitreader_fill(br,1)) {
-                if(miniflac_bitreader_read(br,1)) {
+            while(residual->residual < residual->residual_total) {
+                if(miniflac_bitreader_read_unary(br,&residual->msb)) return MINIFLAC_CONTINUE;
+                if(miniflac_bitreader_fill(br,residual->rice_parameter)) {
                     residual->state = MINIFLAC_RESIDUAL_LSB;
-                    goto miniflac_residual_lsb;
+                    return MINIFLAC_CONTINUE;
                 }
-                residual->msb++;
-            }
-            return MINIFLAC_CONTINUE;
-        }
-        case MINIFLAC_RESIDUAL_LSB: {
-            miniflac_residual_lsb:
-            if(miniflac_bitreader_fill(br,residual->rice_parameter)) return MINIFLAC_CONTINUE;
-            temp_32 = (residual->msb << residual->rice_parameter) | ((uint32_t)miniflac_bitreader_read(br,residual->rice_parameter));
-            residual->value = (temp_32 >> 1) ^ -(temp_32 & 1);
 
-            if(output != NULL) {
-                output[*pos] = residual->value;
-            }
-            *pos += 1;
+                miniflac_residual_lsb:
+                temp_32 = (residual->msb << residual->rice_parameter) | ((uint32_t)miniflac_bitreader_read(br,residual->rice_parameter));
+                residual->value = (temp_32 >> 1) ^ -(temp_32 & 1);
 
-            residual->msb = 0;
-            residual->residual++;
-            if(residual->residual < residual->residual_total) {
-                residual->state = MINIFLAC_RESIDUAL_MSB;
-                goto miniflac_residual_msb;
+                if(output != NULL) {
+                    output[*pos] = residual->value;
+                }
+                *pos += 1;
+
+                residual->msb = 0;
+                residual->residual++;
             }
 
             miniflac_residual_nextpart:
@@ -5515,20 +12049,135 @@ miniflac_residual_decode(miniflac_residual_t* residual, miniflac_bitreader_t* br
             }
             break;
         }
+        case MINIFLAC_RESIDUAL_LSB: {
+            if(miniflac_bitreader_fill(br,residual->rice_parameter)) return MINIFLAC_CONTINUE;
+            residual->state = MINIFLAC_RESIDUAL_MSB;
+            goto miniflac_residual_lsb;
+        }
         default: break;
     }
 
-    miniflac_residual_init(residual);
+    miniflac_residual_init(residual);
+    return MINIFLAC_OK;
+}
+
+MINIFLAC_PRIVATE
+MINIFLAC_RESULT
+miniflac_residual_decode_fast(miniflac_bitreader_t* br, uint32_t block_size, uint8_t predictor_order, int32_t *output, miniflac_residual_restore restore, void* userdata) {
+    uint8_t coding_method;
+    uint8_t partition_order;
+    uint8_t rice_parameter_size;
+    uint8_t rice_parameter;
+    uint8_t rice_size;
+    uint32_t partition;
+    uint32_t partition_total;
+    uint32_t residual_total;
+    uint32_t msb;
+    uint32_t temp_32;
+#ifdef MINIFLAC_RICE_TABLE
+    uint32_t entry;
+    uint32_t count;
+    const uint32_t* table;
+#endif
+    int32_t* start;
+    int32_t* restored;
+    int32_t* end;
+
+    if(miniflac_bitreader_fill(br,6)) return MINIFLAC_CONTINUE;
+    coding_method = (uint8_t)miniflac_bitreader_read(br,2);
+    if(coding_method > 1) {
+        miniflac_abort();
+        return MINIFLAC_RESERVED_CODING_METHOD;
+    }
+    rice_parameter_size = coding_method == 0 ? 4 : 5;
+    partition_order = (uint8_t)miniflac_bitreader_read(br,4);
+    partition_total = 1 << partition_order;
+
+    start = output;
+    output += predictor_order;
+    restored = output;
+
+    for(partition = 0; partition < partition_total; partition++) {
+        if(restore != NULL && output - restored >= MINIFLAC_RESIDUAL_RESTORE_CHUNK) {
+            restore(userdata,start,(uint32_t)(restored - start),(uint32_t)(output - start));
+            restored = output;
+        }
+        if(miniflac_bitreader_fill(br,rice_parameter_size)) return MINIFLAC_CONTINUE;
+        rice_parameter = (uint8_t)miniflac_bitreader_read(br,rice_parameter_size);
+        residual_total = block_size >> partition_order;
+        if(partition == 0) {
+            if(residual_total < predictor_order) {
+                miniflac_abort();
+                return MINIFLAC_ERROR;
+            }
+            residual_total -= predictor_order;
+        }
+        end = output + residual_total;
+
+        if(rice_parameter == escape_codes[coding_method]) {
+            if(miniflac_bitreader_fill(br,5)) return MINIFLAC_CONTINUE;
+            rice_size = (uint8_t)miniflac_bitreader_read(br,5);
+            while(output < end) {
+                if(miniflac_bitreader_fill(br,rice_size)) return MINIFLAC_CONTINUE;
+                *output++ = (int32_t)miniflac_bitreader_read_signed(br,rice_size);
+            }
+            continue;
+        }
+
+#ifdef MINIFLAC_RICE_TABLE
+        table = rice_parameter <= MINIFLAC_RICE_TABLE_MAX_PARAMETER ? miniflac_rice_table[rice_parameter] : NULL;
+#endif
+
+        while(output < end) {
+#ifdef MINIFLAC_RICE_TABLE
+            if(table != NULL && !miniflac_bitreader_fill(br,MINIFLAC_RICE_TABLE_BITS)) {
+                entry = table[miniflac_bitreader_peek(br,MINIFLAC_RICE_TABLE_BITS)];
+                count = (entry >> 4) & 0x03;
+                /* codewords longer than the window, and the last few
+                 * residuals of a partition, are decoded one at a time */
+                if(count != 0 && count <= (uint32_t)(end - output)) {
+                    miniflac_bitreader_discard(br,entry & 0x0F);
+                    *output++ = (int8_t)(entry >> 8);
+                    if(count > 1) {
+                        *output++ = (int8_t)(entry >> 16);
+                        if(count > 2) {
+                            *output++ = (int8_t)(entry >> 24);
+                        }
+                    }
+                    continue;
+                }
+            }
+#endif
+
+            msb = 0;
+            if(miniflac_bitreader_read_unary(br,&msb)) return MINIFLAC_CONTINUE;
+            if(miniflac_bitreader_fill(br,rice_parameter)) return MINIFLAC_CONTINUE;
+            temp_32 = (msb << rice_parameter) | ((uint32_t)miniflac_bitreader_read(br,rice_parameter));
+            *output++ = (temp_32 >> 1) ^ -(temp_32 & 1);
+        }
+    }
+
+    if(restore != NULL && output != restored) {
+        restore(userdata,start,(uint32_t)(restored - start),(uint32_t)(output - start));
+    }
+
     return MINIFLAC_OK;
 }
 
 MINIFLAC_PRIVATE
 void
 miniflac_streaminfo_init(miniflac_streaminfo_t* streaminfo) {
+    uint8_t i;
     streaminfo->state = MINIFLAC_STREAMINFO_MINBLOCKSIZE;
     streaminfo->pos = 0;
+    streaminfo->max_block_size = 0;
+    streaminfo->max_frame_size = 0;
     streaminfo->sample_rate = 0;
+    streaminfo->channels = 0;
     streaminfo->bps = 0;
+    for(i = 0; i < 16; i++) {
+        streaminfo->md5[i] = 0;
+    }
 }
 
 MINIFLAC_PRIVATE
@@ -5555,7 +12204,6 @@ miniflac_streaminfo_read_min_block_size(miniflac_streaminfo_t* streaminfo, minif
 MINIFLAC_PRIVATE
 MINIFLAC_RESULT
 miniflac_streaminfo_read_max_block_size(miniflac_streaminfo_t* streaminfo, miniflac_bitreader_t* br, uint16_t* max_block_size) {
-    uint16_t t;
     MINIFLAC_RESULT r = MINIFLAC_ERROR;
     switch(streaminfo->state) {
         case MINIFLAC_STREAMINFO_MINBLOCKSIZE: {
@@ -5565,9 +12213,9 @@ miniflac_streaminfo_read_max_block_size(miniflac_streaminfo_t* streaminfo, minif
         /* fall-through */
         case MINIFLAC_STREAMINFO_MAXBLOCKSIZE: {
             if(miniflac_bitreader_fill_nocrc(br,16)) return MINIFLAC_CONTINUE;
-            t = (uint16_t) miniflac_bitreader_read(br,16);
+            streaminfo->max_block_size = (uint16_t) miniflac_bitreader_read(br,16);
             if(max_block_size != NULL) {
-                *max_block_size = t;
+                *max_block_size = streaminfo->max_block_size;
             }
             streaminfo->state = MINIFLAC_STREAMINFO_MINFRAMESIZE;
             return MINIFLAC_OK;
@@ -5611,7 +12259,6 @@ miniflac_streaminfo_read_min_frame_size(miniflac_streaminfo_t* streaminfo, minif
 MINIFLAC_PRIVATE
 MINIFLAC_RESULT
 miniflac_streaminfo_read_max_frame_size(miniflac_streaminfo_t* streaminfo, miniflac_bitreader_t* br, uint32_t* max_frame_size) {
-    uint32_t t;
     MINIFLAC_RESULT r = MINIFLAC_ERROR;
     switch(streaminfo->state) {
         case MINIFLAC_STREAMINFO_MINBLOCKSIZE: /* fall-through */
@@ -5623,9 +12270,9 @@ miniflac_streaminfo_read_max_frame_size(miniflac_streaminfo_t* streaminfo, minif
         /* fall-through */
         case MINIFLAC_STREAMINFO_MAXFRAMESIZE: {
             if(miniflac_bitreader_fill_nocrc(br,24)) return MINIFLAC_CONTINUE;
-            t = (uint32_t) miniflac_bitreader_read(br,24);
+            streaminfo->max_frame_size = (uint32_t) miniflac_bitreader_read(br,24);
             if(max_frame_size != NULL) {
-                *max_frame_size = t;
+                *max_frame_size = streaminfo->max_frame_size;
             }
             streaminfo->state = MINIFLAC_STREAMINFO_SAMPLERATE;
             return MINIFLAC_OK;
@@ -5684,6 +12331,7 @@ miniflac_streaminfo_read_channels(miniflac_streaminfo_t* streaminfo, miniflac_bi
         case MINIFLAC_STREAMINFO_CHANNELS: {
             if(miniflac_bitreader_fill_nocrc(br,3)) return MINIFLAC_CONTINUE;
             t = (uint8_t) miniflac_bitreader_read(br,3) + 1;
+            streaminfo->channels = t;
             if(channels != NULL) {
                 *channels = t;
             }
@@ -5809,6 +12457,7 @@ miniflac_streaminfo_read_md5_data(miniflac_streaminfo_t* streaminfo, miniflac_bi
             while(streaminfo->pos < 16) {
                 if(miniflac_bitreader_fill_nocrc(br,8)) return MINIFLAC_CONTINUE;
                 t = (uint8_t)miniflac_bitreader_read(br,8);
+                streaminfo->md5[streaminfo->pos] = t;
                 if(output != NULL && streaminfo->pos < length) {
                     output[streaminfo->pos] = t;
                 }
@@ -5884,9 +12533,7 @@ miniflac_streammarker_decode(miniflac_streammarker_t* streammarker, miniflac_bit
 
     miniflac_streammarker_init(streammarker);
 
-    assert(br->bits == 0);
-    br->crc8  = 0;
-    br->crc16 = 0;
+    miniflac_bitreader_reset_crc(br);
 
     return MINIFLAC_OK;
 }
@@ -5904,11 +12551,21 @@ miniflac_subframe_init(miniflac_subframe_t* subframe) {
     miniflac_residual_init(&subframe->residual);
 }
 
+static
+void
+miniflac_subframe_shift_wasted(miniflac_subframe_t* subframe, int32_t* output, uint32_t block_size) {
+    uint32_t i;
+    if(subframe->header.wasted_bits > 0) {
+        for(i=0;i<block_size;i++) {
+            output[i] <<= subframe->header.wasted_bits;
+        }
+    }
+}
+
 MINIFLAC_PRIVATE
 MINIFLAC_RESULT
 miniflac_subframe_decode(miniflac_subframe_t* subframe, miniflac_bitreader_t* br, int32_t* output, uint32_t block_size, uint8_t bps) {
     MINIFLAC_RESULT r;
-    uint32_t i;
 
     switch(subframe->state) {
         case MINIFLAC_SUBFRAME_HEADER: {
@@ -5979,12 +12636,54 @@ miniflac_subframe_decode(miniflac_subframe_t* subframe, miniflac_bitreader_t* br
         default: break;
     }
 
-    if(output != NULL && subframe->header.wasted_bits > 0) {
-        for(i=0;i<block_size;i++) {
-            output[i] <<= subframe->header.wasted_bits;
+    if(output != NULL) {
+        miniflac_subframe_shift_wasted(subframe,output,block_size);
+    }
+
+    miniflac_subframe_init(subframe);
+    return MINIFLAC_OK;
+}
+
+MINIFLAC_PRIVATE
+MINIFLAC_RESULT
+miniflac_subframe_decode_fast(miniflac_subframe_t* subframe, miniflac_bitreader_t* br, int32_t* output, uint32_t block_size, uint8_t bps) {
+    MINIFLAC_RESULT r;
+
+    r = miniflac_subframe_header_decode(&subframe->header,br);
+    if(r != MINIFLAC_OK) return r;
+
+    if(subframe->header.wasted_bits >= bps) {
+        miniflac_abort();
+        return MINIFLAC_ERROR;
+    }
+
+    subframe->bps = bps - subframe->header.wasted_bits;
+
+    switch(subframe->header.type) {
+        case MINIFLAC_SUBFRAME_TYPE_CONSTANT: {
+            r = miniflac_subframe_constant_decode(&subframe->constant,br,output,block_size,subframe->bps);
+            break;
+        }
+        case MINIFLAC_SUBFRAME_TYPE_VERBATIM: {
+            r = miniflac_subframe_verbatim_decode_fast(br,output,block_size,subframe->bps);
+            break;
+        }
+        case MINIFLAC_SUBFRAME_TYPE_FIXED: {
+            r = miniflac_subframe_fixed_decode_fast(br,output,block_size,subframe->bps,subframe->header.order);
+            break;
+        }
+        case MINIFLAC_SUBFRAME_TYPE_LPC: {
+            r = miniflac_subframe_lpc_decode_fast(&subframe->lpc,br,output,block_size,subframe->bps,subframe->header.order);
+            break;
+        }
+        default: {
+            miniflac_abort();
+            return MINIFLAC_ERROR;
         }
     }
+    if(r != MINIFLAC_OK) return r;
 
+    miniflac_subframe_shift_wasted(subframe,output,block_size);
     miniflac_subframe_init(subframe);
     return MINIFLAC_OK;
 }
@@ -6021,18 +12720,109 @@ miniflac_subframe_fixed_init(miniflac_subframe_fixed_t* f) {
     f->state = MINIFLAC_SUBFRAME_FIXED_DECODE;
 }
 
+/* Order-specialised restoration loops. The previous samples are carried
+ * along in locals instead of being read back from output on every sample. */
+
+static
+void
+miniflac_subframe_fixed_predict_0(int32_t* output, uint32_t start, uint32_t end) {
+    /* the residual is the signal */
+    (void)output;
+    (void)start;
+    (void)end;
+}
+
+static
+void
+miniflac_subframe_fixed_predict_1(int32_t* output, uint32_t start, uint32_t end) {
+    uint32_t i;
+    int64_t sample1 = output[start - 1];
+
+    for(i = start; i < end; i++) {
+        output[i] = (int32_t)(sample1 + output[i]);
+        sample1 = output[i];
+    }
+}
+
+static
+void
+miniflac_subframe_fixed_predict_2(int32_t* output, uint32_t start, uint32_t end) {
+    uint32_t i;
+    int64_t sample1 = output[start - 1];
+    int64_t sample2 = output[start - 2];
+
+    for(i = start; i < end; i++) {
+        output[i] = (int32_t)(2 * sample1 - sample2 + output[i]);
+        sample2 = sample1;
+        sample1 = output[i];
+    }
+}
+
+static
+void
+miniflac_subframe_fixed_predict_3(int32_t* output, uint32_t start, uint32_t end) {
+    uint32_t i;
+    int64_t sample1 = output[start - 1];
+    int64_t sample2 = output[start - 2];
+    int64_t sample3 = output[start - 3];
+
+    for(i = start; i < end; i++) {
+        output[i] = (int32_t)(3 * sample1 - 3 * sample2 + sample3 + output[i]);
+        sample3 = sample2;
+        sample2 = sample1;
+        sample1 = output[i];
+    }
+}
+
+static
+void
+miniflac_subframe_fixed_predict_4(int32_t* output, uint32_t start, uint32_t end) {
+    uint32_t i;
+    int64_t sample1 = output[start - 1];
+    int64_t sample2 = output[start - 2];
+    int64_t sample3 = output[start - 3];
+    int64_t sample4 = output[start - 4];
+
+    for(i = start; i < end; i++) {
+        output[i] = (int32_t)(4 * sample1 - 6 * sample2 + 4 * sample3 - sample4 + output[i]);
+        sample4 = sample3;
+        sample3 = sample2;
+        sample2 = sample1;
+        sample1 = output[i];
+    }
+}
+
+typedef void (*miniflac_subframe_fixed_predictor)(int32_t* output, uint32_t start, uint32_t end);
+
+static const miniflac_subframe_fixed_predictor miniflac_subframe_fixed_predictors[5] = {
+    miniflac_subframe_fixed_predict_0,
+    miniflac_subframe_fixed_predict_1,
+    miniflac_subframe_fixed_predict_2,
+    miniflac_subframe_fixed_predict_3,
+    miniflac_subframe_fixed_predict_4,
+};
+
+MINIFLAC_PRIVATE
+void
+miniflac_subframe_fixed_predict(int32_t* output, uint32_t start, uint32_t end, uint8_t predictor_order) {
+    if(predictor_order > 4 || start < predictor_order || end <= start) return;
+    miniflac_subframe_fixed_predictors[predictor_order](output,start,end);
+}
+
+#ifdef MINIFLAC_FUSED_PREDICTION
+static
+void
+miniflac_subframe_fixed_restore(void* userdata, int32_t* output, uint32_t start, uint32_t end) {
+    miniflac_subframe_fixed_predict(output,start,end,*(const uint8_t*)userdata);
+}
+#endif
+
 MINIFLAC_PRIVATE
 MINIFLAC_RESULT
 miniflac_subframe_fixed_decode(miniflac_subframe_fixed_t* f, miniflac_bitreader_t* br, int32_t* output, uint32_t block_size, uint8_t bps, miniflac_residual_t* residual, uint8_t predictor_order) {
     int32_t sample;
-
-    int64_t sample1;
-    int64_t sample2;
-    int64_t sample3;
-    int64_t sample4;
-    int64_t current_residual;
-
     MINIFLAC_RESULT r;
+
     while(f->pos < predictor_order) {
         if(miniflac_bitreader_fill(br,bps)) return MINIFLAC_CONTINUE;
         sample = (int32_t) miniflac_bitreader_read_signed(br,bps);
@@ -6041,76 +12831,39 @@ miniflac_subframe_fixed_decode(miniflac_subframe_fixed_t* f, miniflac_bitreader_
         }
         f->pos++;
     }
+
     r = miniflac_residual_decode(residual,br,&f->pos,block_size,predictor_order,output);
     if(r != MINIFLAC_OK) return r;
 
     if(output != NULL) {
-        switch(predictor_order) {
-            case 0:
-#if 0
-                /* this is here for reference but not actually needed */
-                for(f->pos = predictor_order; f->pos < block_size; f->pos++) {
-                    current_residual = output[f->pos];
-                    output[f->pos] = (int32_t)current_residual;
-                }
-#endif
-                break;
-            case 1: {
-                for(f->pos = predictor_order; f->pos < block_size; f->pos++) {
-                    current_residual = output[f->pos];
-                    sample1  = output[f->pos-1];
-                    output[f->pos] = (int32_t)(sample1 + current_residual);
-                }
-                break;
-            }
-            case 2: {
-                for(f->pos = predictor_order; f->pos < block_size; f->pos++) {
-                    current_residual = output[f->pos];
-                    sample1  = output[f->pos-1];
-                    sample2  = output[f->pos-2];
-
-                    sample1 *= 2;
-
-                    output[f->pos] = (int32_t)(sample1 - sample2 + current_residual);
-                }
-                break;
-            }
-            case 3: {
-                for(f->pos = predictor_order; f->pos < block_size; f->pos++) {
-                    current_residual = output[f->pos];
-                    sample1  = output[f->pos-1];
-                    sample2  = output[f->pos-2];
-                    sample3  = output[f->pos-3];
-
-                    sample1 *= 3;
-                    sample2 *= 3;
+        miniflac_subframe_fixed_predict(output,predictor_order,block_size,predictor_order);
+    }
 
-                    output[f->pos] = (int32_t)(sample1 - sample2 + sample3 + current_residual);
-                }
-                break;
-            }
-            case 4: {
-                for(f->pos = predictor_order; f->pos < block_size; f->pos++) {
-                    current_residual = output[f->pos];
-                    sample1  = output[f->pos-1];
-                    sample2  = output[f->pos-2];
-                    sample3  = output[f->pos-3];
-                    sample4  = output[f->pos-4];
+    return MINIFLAC_OK;
+}
 
-                    sample1 *= 4;
-                    sample2 *= 6;
-                    sample3 *= 4;
+MINIFLAC_PRIVATE
+MINIFLAC_RESULT
+miniflac_subframe_fixed_decode_fast(miniflac_bitreader_t* br, int32_t* output, uint32_t block_size, uint8_t bps, uint8_t predictor_order) {
+    uint32_t i;
+#ifndef MINIFLAC_FUSED_PREDICTION
+    MINIFLAC_RESULT r;
+#endif
 
-                    output[f->pos] = (int32_t)(sample1  - sample2 + sample3 - sample4 + current_residual);
-                }
-                break;
-            }
-            default: break;
-        }
+    for(i = 0; i < predictor_order; i++) {
+        if(miniflac_bitreader_fill(br,bps)) return MINIFLAC_CONTINUE;
+        output[i] = (int32_t) miniflac_bitreader_read_signed(br,bps);
     }
 
-    return MINIFLAC_OK;
+#ifdef MINIFLAC_FUSED_PREDICTION
+    return miniflac_residual_decode_fast(br,block_size,predictor_order,output,miniflac_subframe_fixed_restore,&predictor_order);
+#else
+    r = miniflac_residual_decode_fast(br,block_size,predictor_order,output,NULL,NULL);
+    if(r != MINIFLAC_OK) return r;
 
+    miniflac_subframe_fixed_predict(output,predictor_order,block_size,predictor_order);
+    return MINIFLAC_OK;
+#endif
 }
 
 MINIFLAC_PRIVATE
@@ -6206,19 +12959,408 @@ miniflac_subframe_lpc_init(miniflac_subframe_lpc_t* l) {
     l->precision = 0;
     l->shift = 0;
     l->coeff = 0;
+    l->predictor = NULL;
     for(i = 0; i < 32; i++) {
         l->coefficients[i] = 0;
     }
     l->state = MINIFLAC_SUBFRAME_LPC_PRECISION;
 }
 
+/* Order-specialised restoration loops. Each one holds its coefficients
+ * in locals and has the multiply-accumulate fully unrolled, so nothing
+ * is reloaded from l->coefficients per sample.
+ *
+ * The 32-bit versions are only used when bps + precision + log2(order)
+ * fits in 32 bits, so the sum can't overflow on a valid stream. They sum
+ * in unsigned math so a corrupt stream wraps instead, same as the
+ * truncation at the end of the 64-bit loop. */
+
+#define MINIFLAC_LPC_REPEAT_1(m) m(0)
+#define MINIFLAC_LPC_REPEAT_2(m) MINIFLAC_LPC_REPEAT_1(m) m(1)
+#define MINIFLAC_LPC_REPEAT_3(m) MINIFLAC_LPC_REPEAT_2(m) m(2)
+#define MINIFLAC_LPC_REPEAT_4(m) MINIFLAC_LPC_REPEAT_3(m) m(3)
+#define MINIFLAC_LPC_REPEAT_5(m) MINIFLAC_LPC_REPEAT_4(m) m(4)
+#define MINIFLAC_LPC_REPEAT_6(m) MINIFLAC_LPC_REPEAT_5(m) m(5)
+#define MINIFLAC_LPC_REPEAT_7(m) MINIFLAC_LPC_REPEAT_6(m) m(6)
+#define MINIFLAC_LPC_REPEAT_8(m) MINIFLAC_LPC_REPEAT_7(m) m(7)
+#define MINIFLAC_LPC_REPEAT_9(m) MINIFLAC_LPC_REPEAT_8(m) m(8)
+#define MINIFLAC_LPC_REPEAT_10(m) MINIFLAC_LPC_REPEAT_9(m) m(9)
+#define MINIFLAC_LPC_REPEAT_11(m) MINIFLAC_LPC_REPEAT_10(m) m(10)
+#define MINIFLAC_LPC_REPEAT_12(m) MINIFLAC_LPC_REPEAT_11(m) m(11)
+#define MINIFLAC_LPC_REPEAT_13(m) MINIFLAC_LPC_REPEAT_12(m) m(12)
+#define MINIFLAC_LPC_REPEAT_14(m) MINIFLAC_LPC_REPEAT_13(m) m(13)
+#define MINIFLAC_LPC_REPEAT_15(m) MINIFLAC_LPC_REPEAT_14(m) m(14)
+#define MINIFLAC_LPC_REPEAT_16(m) MINIFLAC_LPC_REPEAT_15(m) m(15)
+#define MINIFLAC_LPC_REPEAT_17(m) MINIFLAC_LPC_REPEAT_16(m) m(16)
+#define MINIFLAC_LPC_REPEAT_18(m) MINIFLAC_LPC_REPEAT_17(m) m(17)
+#define MINIFLAC_LPC_REPEAT_19(m) MINIFLAC_LPC_REPEAT_18(m) m(18)
+#define MINIFLAC_LPC_REPEAT_20(m) MINIFLAC_LPC_REPEAT_19(m) m(19)
+#define MINIFLAC_LPC_REPEAT_21(m) MINIFLAC_LPC_REPEAT_20(m) m(20)
+#define MINIFLAC_LPC_REPEAT_22(m) MINIFLAC_LPC_REPEAT_21(m) m(21)
+#define MINIFLAC_LPC_REPEAT_23(m) MINIFLAC_LPC_REPEAT_22(m) m(22)
+#define MINIFLAC_LPC_REPEAT_24(m) MINIFLAC_LPC_REPEAT_23(m) m(23)
+#define MINIFLAC_LPC_REPEAT_25(m) MINIFLAC_LPC_REPEAT_24(m) m(24)
+#define MINIFLAC_LPC_REPEAT_26(m) MINIFLAC_LPC_REPEAT_25(m) m(25)
+#define MINIFLAC_LPC_REPEAT_27(m) MINIFLAC_LPC_REPEAT_26(m) m(26)
+#define MINIFLAC_LPC_REPEAT_28(m) MINIFLAC_LPC_REPEAT_27(m) m(27)
+#define MINIFLAC_LPC_REPEAT_29(m) MINIFLAC_LPC_REPEAT_28(m) m(28)
+#define MINIFLAC_LPC_REPEAT_30(m) MINIFLAC_LPC_REPEAT_29(m) m(29)
+#define MINIFLAC_LPC_REPEAT_31(m) MINIFLAC_LPC_REPEAT_30(m) m(30)
+#define MINIFLAC_LPC_REPEAT_32(m) MINIFLAC_LPC_REPEAT_31(m) m(31)
+
+#define MINIFLAC_LPC_COEFF64(j) const int64_t c##j = coefficients[j];
+#define MINIFLAC_LPC_TERM64(j) + c##j * output[i - j - 1]
+#define MINIFLAC_LPC_COEFF32(j) const uint32_t c##j = (uint32_t)coefficients[j];
+#define MINIFLAC_LPC_TERM32(j) + c##j * (uint32_t)output[i - j - 1]
+
+#define MINIFLAC_LPC_PREDICT(N) \
+static \
+void \
+miniflac_subframe_lpc_predict64_##N(const int32_t* coefficients, uint8_t shift, uint8_t predictor_order, int32_t* output, uint32_t start, uint32_t end) { \
+    MINIFLAC_LPC_REPEAT_##N(MINIFLAC_LPC_COEFF64) \
+    int64_t prediction; \
+    uint32_t i; \
+    (void)predictor_order; \
+    for(i = start; i < end; i++) { \
+        prediction = 0 MINIFLAC_LPC_REPEAT_##N(MINIFLAC_LPC_TERM64); \
+        prediction >>= shift; \
+        prediction += output[i]; \
+        output[i] = (int32_t)prediction; \
+    } \
+} \
+\
+static \
+void \
+miniflac_subframe_lpc_predict32_##N(const int32_t* coefficients, uint8_t shift, uint8_t predictor_order, int32_t* output, uint32_t start, uint32_t end) { \
+    MINIFLAC_LPC_REPEAT_##N(MINIFLAC_LPC_COEFF32) \
+    uint32_t prediction; \
+    uint32_t i; \
+    (void)predictor_order; \
+    for(i = start; i < end; i++) { \
+        prediction = 0 MINIFLAC_LPC_REPEAT_##N(MINIFLAC_LPC_TERM32); \
+        output[i] = (int32_t)((uint32_t)output[i] + (uint32_t)(((int32_t)prediction) >> shift)); \
+    } \
+}
+
+MINIFLAC_LPC_PREDICT(1)
+MINIFLAC_LPC_PREDICT(2)
+MINIFLAC_LPC_PREDICT(3)
+MINIFLAC_LPC_PREDICT(4)
+MINIFLAC_LPC_PREDICT(5)
+MINIFLAC_LPC_PREDICT(6)
+MINIFLAC_LPC_PREDICT(7)
+MINIFLAC_LPC_PREDICT(8)
+MINIFLAC_LPC_PREDICT(9)
+MINIFLAC_LPC_PREDICT(10)
+MINIFLAC_LPC_PREDICT(11)
+MINIFLAC_LPC_PREDICT(12)
+MINIFLAC_LPC_PREDICT(13)
+MINIFLAC_LPC_PREDICT(14)
+MINIFLAC_LPC_PREDICT(15)
+MINIFLAC_LPC_PREDICT(16)
+MINIFLAC_LPC_PREDICT(17)
+MINIFLAC_LPC_PREDICT(18)
+MINIFLAC_LPC_PREDICT(19)
+MINIFLAC_LPC_PREDICT(20)
+MINIFLAC_LPC_PREDICT(21)
+MINIFLAC_LPC_PREDICT(22)
+MINIFLAC_LPC_PREDICT(23)
+MINIFLAC_LPC_PREDICT(24)
+MINIFLAC_LPC_PREDICT(25)
+MINIFLAC_LPC_PREDICT(26)
+MINIFLAC_LPC_PREDICT(27)
+MINIFLAC_LPC_PREDICT(28)
+MINIFLAC_LPC_PREDICT(29)
+MINIFLAC_LPC_PREDICT(30)
+MINIFLAC_LPC_PREDICT(31)
+MINIFLAC_LPC_PREDICT(32)
+
+/* indexed by predictor order, LPC subframes are always order 1 or higher */
+static const miniflac_subframe_lpc_predictor miniflac_subframe_lpc_predictors64[33] = {
+    NULL,
+    miniflac_subframe_lpc_predict64_1,
+    miniflac_subframe_lpc_predict64_2,
+    miniflac_subframe_lpc_predict64_3,
+    miniflac_subframe_lpc_predict64_4,
+    miniflac_subframe_lpc_predict64_5,
+    miniflac_subframe_lpc_predict64_6,
+    miniflac_subframe_lpc_predict64_7,
+    miniflac_subframe_lpc_predict64_8,
+    miniflac_subframe_lpc_predict64_9,
+    miniflac_subframe_lpc_predict64_10,
+    miniflac_subframe_lpc_predict64_11,
+    miniflac_subframe_lpc_predict64_12,
+    miniflac_subframe_lpc_predict64_13,
+    miniflac_subframe_lpc_predict64_14,
+    miniflac_subframe_lpc_predict64_15,
+    miniflac_subframe_lpc_predict64_16,
+    miniflac_subframe_lpc_predict64_17,
+    miniflac_subframe_lpc_predict64_18,
+    miniflac_subframe_lpc_predict64_19,
+    miniflac_subframe_lpc_predict64_20,
+    miniflac_subframe_lpc_predict64_21,
+    miniflac_subframe_lpc_predict64_22,
+    miniflac_subframe_lpc_predict64_23,
+    miniflac_subframe_lpc_predict64_24,
+    miniflac_subframe_lpc_predict64_25,
+    miniflac_subframe_lpc_predict64_26,
+    miniflac_subframe_lpc_predict64_27,
+    miniflac_subframe_lpc_predict64_28,
+    miniflac_subframe_lpc_predict64_29,
+    miniflac_subframe_lpc_predict64_30,
+    miniflac_subframe_lpc_predict64_31,
+    miniflac_subframe_lpc_predict64_32
+};
+
+static const miniflac_subframe_lpc_predictor miniflac_subframe_lpc_predictors32[33] = {
+    NULL,
+    miniflac_subframe_lpc_predict32_1,
+    miniflac_subframe_lpc_predict32_2,
+    miniflac_subframe_lpc_predict32_3,
+    miniflac_subframe_lpc_predict32_4,
+    miniflac_subframe_lpc_predict32_5,
+    miniflac_subframe_lpc_predict32_6,
+    miniflac_subframe_lpc_predict32_7,
+    miniflac_subframe_lpc_predict32_8,
+    miniflac_subframe_lpc_predict32_9,
+    miniflac_subframe_lpc_predict32_10,
+    miniflac_subframe_lpc_predict32_11,
+    miniflac_subframe_lpc_predict32_12,
+    miniflac_subframe_lpc_predict32_13,
+    miniflac_subframe_lpc_predict32_14,
+    miniflac_subframe_lpc_predict32_15,
+    miniflac_subframe_lpc_predict32_16,
+    miniflac_subframe_lpc_predict32_17,
+    miniflac_subframe_lpc_predict32_18,
+    miniflac_subframe_lpc_predict32_19,
+    miniflac_subframe_lpc_predict32_20,
+    miniflac_subframe_lpc_predict32_21,
+    miniflac_subframe_lpc_predict32_22,
+    miniflac_subframe_lpc_predict32_23,
+    miniflac_subframe_lpc_predict32_24,
+    miniflac_subframe_lpc_predict32_25,
+    miniflac_subframe_lpc_predict32_26,
+    miniflac_subframe_lpc_predict32_27,
+    miniflac_subframe_lpc_predict32_28,
+    miniflac_subframe_lpc_predict32_29,
+    miniflac_subframe_lpc_predict32_30,
+    miniflac_subframe_lpc_predict32_31,
+    miniflac_subframe_lpc_predict32_32
+};
+
+/* a sum of order products of a bps-bit sample and a precision-bit
+ * coefficient needs at most bps + precision + log2(order) - 1 bits */
+static
+uint8_t
+miniflac_subframe_lpc_fits32(uint8_t precision, uint8_t bps, uint8_t predictor_order) {
+    uint8_t log2_order = 0;
+    while(predictor_order >>= 1) log2_order++;
+    return bps + precision + log2_order <= 32;
+}
+
+/* The SIMD kernels below also accumulate in 32 bits. Each vector computes
+ * a group of consecutive samples; lane k of the vector for coefficient j
+ * reads output[i+k-j-1], which for k > j is a sample in the same group that
+ * hasn't been restored yet. Those lanes get a zero coefficient and the
+ * missing terms are added one sample at a time afterwards. */
+
+#if defined(MINIFLAC_SIMD_X86) || defined(MINIFLAC_SIMD_NEON)
+#define MINIFLAC_LPC_SIMD_MIN_ORDER 8
+
+static
+void
+miniflac_subframe_lpc_finish_group(const int32_t* coefficients, uint8_t shift, int32_t* output, const uint32_t* partial, uint32_t group) {
+    uint32_t sum;
+    uint32_t j,k;
+
+    for(k = 0; k < group; k++) {
+        sum = partial[k];
+        for(j = 0; j < k; j++) {
+            sum += (uint32_t)coefficients[j] * (uint32_t)output[k - j - 1];
+        }
+        output[k] = (int32_t)((uint32_t)output[k] + (uint32_t)(((int32_t)sum) >> shift));
+    }
+}
+
+static
+void
+miniflac_subframe_lpc_predict_tail32(const int32_t* coefficients, uint8_t shift, uint8_t predictor_order, int32_t* output, uint32_t start, uint32_t end) {
+    uint32_t sum;
+    uint32_t i,j;
+
+    for(i = start; i < end; i++) {
+        sum = 0;
+        for(j = 0; j < predictor_order; j++) {
+            sum += (uint32_t)coefficients[j] * (uint32_t)output[i - j - 1];
+        }
+        output[i] = (int32_t)((uint32_t)output[i] + (uint32_t)(((int32_t)sum) >> shift));
+    }
+}
+#endif
+
+#if defined(MINIFLAC_SIMD_X86)
+static MINIFLAC_TARGET("sse4.1")
+void
+miniflac_subframe_lpc_predict_sse41(const int32_t* coefficients, uint8_t shift, uint8_t predictor_order, int32_t* output, uint32_t start, uint32_t end) {
+    __m128i c[32];
+    __m128i sum0, sum1;
+    uint32_t partial[4];
+    uint32_t i,j;
+
+    for(j = 0; j < predictor_order; j++) {
+        c[j] = _mm_set_epi32(
+          j >= 3 ? coefficients[j] : 0,
+          j >= 2 ? coefficients[j] : 0,
+          j >= 1 ? coefficients[j] : 0,
+          coefficients[j]);
+    }
+
+    for(i = start; i + 4 <= end; i += 4) {
+        sum0 = _mm_setzero_si128();
+        sum1 = _mm_setzero_si128();
+        for(j = 0; j + 1 < predictor_order; j += 2) {
+            sum0 = _mm_add_epi32(sum0, _mm_mullo_epi32(c[j], _mm_loadu_si128((const __m128i*)&output[i - j - 1])));
+            sum1 = _mm_add_epi32(sum1, _mm_mullo_epi32(c[j+1], _mm_loadu_si128((const __m128i*)&output[i - j - 2])));
+        }
+        if(j < predictor_order) {
+            sum0 = _mm_add_epi32(sum0, _mm_mullo_epi32(c[j], _mm_loadu_si128((const __m128i*)&output[i - j - 1])));
+        }
+        _mm_storeu_si128((__m128i*)partial, _mm_add_epi32(sum0, sum1));
+        miniflac_subframe_lpc_finish_group(coefficients, shift, &output[i], partial, 4);
+    }
+
+    miniflac_subframe_lpc_predict_tail32(coefficients, shift, predictor_order, output, i, end);
+}
+
+static MINIFLAC_TARGET("avx2")
+void
+miniflac_subframe_lpc_predict_avx2(const int32_t* coefficients, uint8_t shift, uint8_t predictor_order, int32_t* output, uint32_t start, uint32_t end) {
+    __m256i c[32];
+    __m256i sum0, sum1;
+    uint32_t partial[8];
+    uint32_t i,j;
+
+    for(j = 0; j < predictor_order; j++) {
+        c[j] = _mm256_set_epi32(
+          j >= 7 ? coefficients[j] : 0,
+          j >= 6 ? coefficients[j] : 0,
+          j >= 5 ? coefficients[j] : 0,
+          j >= 4 ? coefficients[j] : 0,
+          j >= 3 ? coefficients[j] : 0,
+          j >= 2 ? coefficients[j] : 0,
+          j >= 1 ? coefficients[j] : 0,
+          coefficients[j]);
+    }
+
+    for(i = start; i + 8 <= end; i += 8) {
+        sum0 = _mm256_setzero_si256();
+        sum1 = _mm256_setzero_si256();
+        for(j = 0; j + 1 < predictor_order; j += 2) {
+            sum0 = _mm256_add_epi32(sum0, _mm256_mullo_epi32(c[j], _mm256_loadu_si256((const __m256i*)&output[i - j - 1])));
+            sum1 = _mm256_add_epi32(sum1, _mm256_mullo_epi32(c[j+1], _mm256_loadu_si256((const __m256i*)&output[i - j - 2])));
+        }
+        if(j < predictor_order) {
+            sum0 = _mm256_add_epi32(sum0, _mm256_mullo_epi32(c[j], _mm256_loadu_si256((const __m256i*)&output[i - j - 1])));
+        }
+        _mm256_storeu_si256((__m256i*)partial, _mm256_add_epi32(sum0, sum1));
+        miniflac_subframe_lpc_finish_group(coefficients, shift, &output[i], partial, 8);
+    }
+
+    miniflac_subframe_lpc_predict_tail32(coefficients, shift, predictor_order, output, i, end);
+}
+#endif
+
+#if defined(MINIFLAC_SIMD_NEON)
+static
+void
+miniflac_subframe_lpc_predict_neon(const int32_t* coefficients, uint8_t shift, uint8_t predictor_order, int32_t* output, uint32_t start, uint32_t end) {
+    int32x4_t c[32];
+    int32x4_t sum0, sum1;
+    uint32_t partial[4];
+    int32_t lanes[4];
+    uint32_t i,j;
+
+    for(j = 0; j < predictor_order; j++) {
+        lanes[0] = coefficients[j];
+        lanes[1] = j >= 1 ? coefficients[j] : 0;
+        lanes[2] = j >= 2 ? coefficients[j] : 0;
+        lanes[3] = j >= 3 ? coefficients[j] : 0;
+        c[j] = vld1q_s32(lanes);
+    }
+
+    for(i = start; i + 4 <= end; i += 4) {
+        sum0 = vdupq_n_s32(0);
+        sum1 = vdupq_n_s32(0);
+        for(j = 0; j + 1 < predictor_order; j += 2) {
+            sum0 = vmlaq_s32(sum0, c[j], vld1q_s32(&output[i - j - 1]));
+            sum1 = vmlaq_s32(sum1, c[j+1], vld1q_s32(&output[i - j - 2]));
+        }
+        if(j < predictor_order) {
+            sum0 = vmlaq_s32(sum0, c[j], vld1q_s32(&output[i - j - 1]));
+        }
+        vst1q_u32(partial, vreinterpretq_u32_s32(vaddq_s32(sum0, sum1)));
+        miniflac_subframe_lpc_finish_group(coefficients, shift, &output[i], partial, 4);
+    }
+
+    miniflac_subframe_lpc_predict_tail32(coefficients, shift, predictor_order, output, i, end);
+}
+#endif
+
+MINIFLAC_PRIVATE
+void
+miniflac_subframe_lpc_select(miniflac_subframe_lpc_t* l, uint8_t bps, uint8_t predictor_order) {
+#if defined(MINIFLAC_SIMD_X86) || defined(MINIFLAC_SIMD_NEON)
+    uint32_t features;
+#endif
+
+    if(!miniflac_subframe_lpc_fits32(l->precision,bps,predictor_order)) {
+        l->predictor = miniflac_subframe_lpc_predictors64[predictor_order];
+        return;
+    }
+
+#if defined(MINIFLAC_SIMD_X86) || defined(MINIFLAC_SIMD_NEON)
+    if(predictor_order >= MINIFLAC_LPC_SIMD_MIN_ORDER) {
+        features = miniflac_cpu_features();
+#if defined(MINIFLAC_SIMD_X86)
+        if(features & MINIFLAC_CPU_AVX2) {
+            l->predictor = miniflac_subframe_lpc_predict_avx2;
+            return;
+        }
+        if(features & MINIFLAC_CPU_SSE41) {
+            l->predictor = miniflac_subframe_lpc_predict_sse41;
+            return;
+        }
+#else
+        if(features & MINIFLAC_CPU_NEON) {
+            l->predictor = miniflac_subframe_lpc_predict_neon;
+            return;
+        }
+#endif
+    }
+#endif
+
+    l->predictor = miniflac_subframe_lpc_predictors32[predictor_order];
+}
+
+MINIFLAC_PRIVATE
+void
+miniflac_subframe_lpc_predict(miniflac_subframe_lpc_t* l, int32_t* output, uint32_t start, uint32_t end) {
+    l->predictor(l->coefficients,l->shift,l->coeff,output,start,end);
+}
+
+#ifdef MINIFLAC_FUSED_PREDICTION
+static
+void
+miniflac_subframe_lpc_restore(void* userdata, int32_t* output, uint32_t start, uint32_t end) {
+    miniflac_subframe_lpc_predict((miniflac_subframe_lpc_t*)userdata,output,start,end);
+}
+#endif
+
 MINIFLAC_PRIVATE
 MINIFLAC_RESULT
 miniflac_subframe_lpc_decode(miniflac_subframe_lpc_t* l, miniflac_bitreader_t* br, int32_t* output, uint32_t block_size, uint8_t bps, miniflac_residual_t* residual, uint8_t predictor_order) {
     int32_t sample;
     int64_t temp;
-    int64_t prediction;
-    uint32_t i,j;
     MINIFLAC_RESULT r;
 
     while(l->pos < predictor_order) {
@@ -6257,20 +13399,49 @@ miniflac_subframe_lpc_decode(miniflac_subframe_lpc_t* l, miniflac_bitreader_t* b
     if(r != MINIFLAC_OK) return r;
 
     if(output != NULL) {
-        for(i=predictor_order;i<block_size;i++) {
-            prediction = 0;
-            for(j=0;j<predictor_order;j++) {
-                temp = output[i - j - 1];
-                temp *= l->coefficients[j];
-                prediction += temp;
-            }
-            prediction >>= l->shift;
-            prediction += output[i];
-            output[i] = prediction;
-        }
+        miniflac_subframe_lpc_select(l,bps,predictor_order);
+        miniflac_subframe_lpc_predict(l,output,predictor_order,block_size);
+    }
+
+    return MINIFLAC_OK;
+}
+
+MINIFLAC_PRIVATE
+MINIFLAC_RESULT
+miniflac_subframe_lpc_decode_fast(miniflac_subframe_lpc_t* l, miniflac_bitreader_t* br, int32_t* output, uint32_t block_size, uint8_t bps, uint8_t predictor_order) {
+    int64_t temp;
+    uint32_t i;
+#ifndef MINIFLAC_FUSED_PREDICTION
+    MINIFLAC_RESULT r;
+#endif
+
+    for(i = 0; i < predictor_order; i++) {
+        if(miniflac_bitreader_fill(br,bps)) return MINIFLAC_CONTINUE;
+        output[i] = (int32_t) miniflac_bitreader_read_signed(br,bps);
     }
 
+    if(miniflac_bitreader_fill(br,9)) return MINIFLAC_CONTINUE;
+    l->precision = miniflac_bitreader_read(br,4) + 1;
+    temp = miniflac_bitreader_read_signed(br,5);
+    if(temp < 0) temp = 0;
+    l->shift = temp;
+
+    for(i = 0; i < predictor_order; i++) {
+        if(miniflac_bitreader_fill(br,l->precision)) return MINIFLAC_CONTINUE;
+        l->coefficients[i] = (int32_t) miniflac_bitreader_read_signed(br,l->precision);
+    }
+    l->coeff = predictor_order;
+
+    miniflac_subframe_lpc_select(l,bps,predictor_order);
+#ifdef MINIFLAC_FUSED_PREDICTION
+    return miniflac_residual_decode_fast(br,block_size,predictor_order,output,miniflac_subframe_lpc_restore,l);
+#else
+    r = miniflac_residual_decode_fast(br,block_size,predictor_order,output,NULL,NULL);
+    if(r != MINIFLAC_OK) return r;
+
+    miniflac_subframe_lpc_predict(l,output,predictor_order,block_size);
     return MINIFLAC_OK;
+#endif
 }
 
 MINIFLAC_PRIVATE
@@ -6299,4 +13470,16 @@ miniflac_subframe_verbatim_decode(miniflac_subframe_verbatim_t* c, miniflac_bitr
 
 }
 
+MINIFLAC_PRIVATE
+MINIFLAC_RESULT
+miniflac_subframe_verbatim_decode_fast(miniflac_bitreader_t* br, int32_t* output, uint32_t block_size, uint8_t bps) {
+    uint32_t i;
+
+    for(i = 0; i < block_size; i++) {
+        if(miniflac_bitreader_fill(br,bps)) return MINIFLAC_CONTINUE;
+        output[i] = (int32_t) miniflac_bitreader_read_signed(br,bps);
+    }
+    return MINIFLAC_OK;
+}
+
 #endif
@@ -0,0 +1,422 @@
+/* SPDX-License-Identifier: 0BSD */
+#include "miniflac_batch.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+/* frames per decode task, small enough that a long file makes plenty
+ * of tasks to steal and large enough that the locking doesn't matter */
+#define FRAMES_PER_TASK 64
+
+/* a task either scans a file (last == 0) or decodes frames
+ * [first, last) of a file that has been scanned */
+struct batch_task_s {
+    uint32_t file;
+    uint32_t first;
+    uint32_t last;
+};
+
+typedef struct batch_task_s batch_task_t;
+
+/* a thread's tasks. The owner pushes and pops at the tail, thieves
+ * take from the head. */
+struct batch_queue_s {
+    pthread_mutex_t lock;
+    batch_task_t* tasks;
+    uint32_t capacity; /* power of 2 */
+    uint32_t head;
+    uint32_t tail;
+};
+
+typedef struct batch_queue_s batch_queue_t;
+
+struct batch_file_s {
+    const uint8_t* data;
+    uint32_t length;
+    uint8_t owned; /* data was read by the scan and gets freed */
+    miniflac_streaminfo_t streaminfo;
+    miniflac_frameinfo_t* index;
+    uint32_t frames;
+    uint32_t pending; /* decode tasks not finished yet */
+    miniflac_batch_result_t result;
+};
+
+typedef struct batch_file_s batch_file_t;
+
+struct batch_s {
+    const miniflac_batch_input_t* inputs;
+    batch_file_t* files;
+    batch_queue_t* queues;
+    uint32_t threads;
+    miniflac_batch_resultcb callback;
+    void* userdata;
+
+    /* guards everything below and the pending/result fields of files */
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+    uint32_t queued; /* tasks sitting in any queue */
+    uint32_t remaining; /* files not reported yet */
+};
+
+typedef struct batch_s batch_t;
+
+struct batch_worker_s {
+    batch_t* batch;
+    uint32_t id;
+    miniflac_t* decoder;
+    int32_t* samples[8];
+};
+
+typedef struct batch_worker_s batch_worker_t;
+
+static int
+queue_push(batch_queue_t* queue, const batch_task_t* task) {
+    batch_task_t* tasks;
+    uint32_t capacity;
+    uint32_t i;
+    int r = 0;
+
+    pthread_mutex_lock(&queue->lock);
+    if(queue->tail - queue->head == queue->capacity) {
+        capacity = queue->capacity == 0 ? 64 : queue->capacity * 2;
+        tasks = (batch_task_t*)malloc(sizeof(batch_task_t) * capacity);
+        if(tasks == NULL) {
+            r = 1;
+            goto queue_push_unlock;
+        }
+        for(i = 0; i < queue->tail - queue->head; i++) {
+            tasks[i] = queue->tasks[(queue->head + i) & (queue->capacity - 1)];
+        }
+        free(queue->tasks);
+        queue->tasks = tasks;
+        queue->tail -= queue->head;
+        queue->head = 0;
+        queue->capacity = capacity;
+    }
+    queue->tasks[queue->tail++ & (queue->capacity - 1)] = *task;
+
+    queue_push_unlock:
+    pthread_mutex_unlock(&queue->lock);
+    return r;
+}
+
+/* takes the newest task if owner is set, otherwise the oldest */
+static int
+queue_take(batch_queue_t* queue, batch_task_t* task, int owner) {
+    int r = 0;
+    pthread_mutex_lock(&queue->lock);
+    if(queue->tail != queue->head) {
+        if(owner) {
+            *task = queue->tasks[--queue->tail & (queue->capacity - 1)];
+        } else {
+            *task = queue->tasks[queue->head++ & (queue->capacity - 1)];
+        }
+        r = 1;
+    }
+    pthread_mutex_unlock(&queue->lock);
+    return r;
+}
+
+static int
+batch_push(batch_t* batch, uint32_t id, const batch_task_t* task) {
+    if(queue_push(&batch->queues[id],task)) return 1;
+    pthread_mutex_lock(&batch->lock);
+    batch->queued++;
+    pthread_cond_signal(&batch->wake);
+    pthread_mutex_unlock(&batch->lock);
+    return 0;
+}
+
+/* waits for a task from our own queue or anybody else's, returns 0
+ * once every file is done */
+static int
+batch_next(batch_t* batch, uint32_t id, batch_task_t* task) {
+    uint32_t i;
+
+    pthread_mutex_lock(&batch->lock);
+    for(;;) {
+        if(batch->remaining == 0) {
+            pthread_mutex_unlock(&batch->lock);
+            return 0;
+        }
+        if(batch->queued > 0) break;
+        pthread_cond_wait(&batch->wake,&batch->lock);
+    }
+    batch->queued--;
+    pthread_mutex_unlock(&batch->lock);
+
+    /* a task is reserved for us, but it may be in any queue */
+    for(;;) {
+        if(queue_take(&batch->queues[id],task,1)) return 1;
+        for(i = 1; i < batch->threads; i++) {
+            if(queue_take(&batch->queues[(id + i) % batch->threads],task,0)) return 1;
+        }
+    }
+}
+
+/* reports a file once its last task is done */
+static void
+batch_finish(batch_t* batch, uint32_t f) {
+    batch_file_t* file = &batch->files[f];
+
+    batch->callback(f,&file->result,batch->userdata);
+
+    free(file->index);
+    file->index = NULL;
+    if(file->owned) free((void*)file->data);
+    file->data = NULL;
+
+    pthread_mutex_lock(&batch->lock);
+    if(--batch->remaining == 0) pthread_cond_broadcast(&batch->wake);
+    pthread_mutex_unlock(&batch->lock);
+}
+
+/* loads up a whole file, returns NULL if it can't be read */
+static uint8_t*
+batch_read(const char* path, uint32_t* length) {
+    FILE* input;
+    uint8_t* data = NULL;
+    long size;
+
+    input = fopen(path,"rb");
+    if(input == NULL) return NULL;
+
+    if(fseek(input,0,SEEK_END) != 0) goto batch_read_cleanup;
+    size = ftell(input);
+    if(size <= 0 || (unsigned long)size > 0xFFFFFFFFUL) goto batch_read_cleanup;
+    if(fseek(input,0,SEEK_SET) != 0) goto batch_read_cleanup;
+
+    data = (uint8_t*)malloc((size_t)size);
+    if(data == NULL) goto batch_read_cleanup;
+    if(fread(data,1,(size_t)size,input) != (size_t)size) {
+        free(data);
+        data = NULL;
+        goto batch_read_cleanup;
+    }
+    *length = (uint32_t)size;
+
+    batch_read_cleanup:
+    fclose(input);
+    return data;
+}
+
+/* builds the frame index and splits the file into decode tasks */
+static void
+batch_scan(batch_worker_t* worker, uint32_t f) {
+    batch_t* batch = worker->batch;
+    batch_file_t* file = &batch->files[f];
+    const miniflac_batch_input_t* input = &batch->inputs[f];
+    miniflac_t* decoder = worker->decoder;
+    miniflac_frameinfo_t* index;
+    miniflac_frameinfo_t info;
+    batch_task_t task;
+    uint32_t capacity = 0;
+    uint32_t pos = 0;
+    uint32_t used = 0;
+    uint32_t tasks;
+    MINIFLAC_RESULT res;
+
+    file->result.result = MINIFLAC_ERROR;
+    file->data = input->data;
+    file->length = input->length;
+    if(file->data == NULL) {
+        file->data = batch_read(input->path,&file->length);
+        if(file->data == NULL) goto batch_scan_fail;
+        file->owned = 1;
+    }
+
+    miniflac_reset(decoder,MINIFLAC_STREAMMARKER_OR_FRAME);
+    while( (res = miniflac_frameinfo(decoder,&file->data[pos],file->length - pos,&used,&info)) == MINIFLAC_OK) {
+        pos += used;
+        if(file->frames == capacity) {
+            capacity = capacity == 0 ? 256 : capacity * 2;
+            index = (miniflac_frameinfo_t*)realloc(file->index,sizeof(miniflac_frameinfo_t) * capacity);
+            if(index == NULL) goto batch_scan_fail;
+            file->index = index;
+        }
+        file->index[file->frames++] = info;
+    }
+    if(res != MINIFLAC_CONTINUE) {
+        file->result.result = res;
+        goto batch_scan_fail;
+    }
+
+    file->streaminfo = decoder->metadata.streaminfo;
+    file->result.result = MINIFLAC_OK;
+    file->result.frames = file->frames;
+    if(file->frames == 0) goto batch_scan_fail;
+
+    tasks = (file->frames + FRAMES_PER_TASK - 1) / FRAMES_PER_TASK;
+    file->pending = tasks;
+
+    /* pushed back to front, so this thread carries on from the start
+     * of the file while others steal from the end */
+    task.file = f;
+    while(tasks-- > 0) {
+        task.first = tasks * FRAMES_PER_TASK;
+        task.last = task.first + FRAMES_PER_TASK;
+        if(task.last > file->frames) task.last = file->frames;
+        if(batch_push(batch,worker->id,&task)) {
+            /* the tasks already queued will finish the file */
+            pthread_mutex_lock(&batch->lock);
+            file->result.result = MINIFLAC_ERROR;
+            file->pending -= tasks + 1;
+            tasks = file->pending;
+            pthread_mutex_unlock(&batch->lock);
+            if(tasks == 0) batch_finish(batch,f);
+            return;
+        }
+    }
+    return;
+
+    batch_scan_fail:
+    batch_finish(batch,f);
+}
+
+static void
+batch_run(batch_worker_t* worker, const batch_task_t* task) {
+    batch_t* batch = worker->batch;
+    batch_file_t* file = &batch->files[task->file];
+    miniflac_t* decoder = worker->decoder;
+    MINIFLAC_RESULT res = MINIFLAC_OK;
+    uint64_t samples = 0;
+    uint32_t pos;
+    uint32_t end;
+    uint32_t used;
+    uint32_t i;
+    uint32_t pending;
+
+    /* miniflac_reset keeps what it needs from the stream info */
+    decoder->metadata.streaminfo = file->streaminfo;
+    miniflac_reset(decoder,MINIFLAC_FRAME);
+
+    pos = (uint32_t)file->index[task->first].offset;
+    end = task->last < file->frames ? (uint32_t)file->index[task->last].offset : file->length;
+
+    for(i = task->first; i < task->last; i++) {
+        res = miniflac_decode(decoder,&file->data[pos],end - pos,&used,worker->samples);
+        pos += used;
+        if(res != MINIFLAC_OK) break;
+        if(decoder->frame.header.block_size != file->index[i].block_size) {
+            res = MINIFLAC_ERROR;
+            break;
+        }
+        samples += decoder->frame.header.block_size;
+    }
+    if(res == MINIFLAC_CONTINUE) res = MINIFLAC_ERROR;
+
+    pthread_mutex_lock(&batch->lock);
+    file->result.samples += samples;
+    if(res != MINIFLAC_OK && file->result.result == MINIFLAC_OK) file->result.result = res;
+    pending = --file->pending;
+    pthread_mutex_unlock(&batch->lock);
+
+    if(pending == 0) batch_finish(batch,task->file);
+}
+
+static void*
+batch_worker(void* userdata) {
+    batch_worker_t* worker = (batch_worker_t*)userdata;
+    batch_task_t task;
+
+    while(batch_next(worker->batch,worker->id,&task)) {
+        if(task.last == 0) {
+            batch_scan(worker,task.file);
+        } else {
+            batch_run(worker,&task);
+        }
+    }
+    return NULL;
+}
+
+MINIFLAC_API
+int
+miniflac_batch_decode(const miniflac_batch_input_t* inputs, uint32_t count, uint32_t threads, miniflac_batch_resultcb callback, void* userdata) {
+    batch_t batch;
+    batch_worker_t* workers = NULL;
+    pthread_t* tids = NULL;
+    batch_task_t task;
+    uint32_t started = 0;
+    uint32_t i;
+    uint32_t j;
+    int r = 1;
+
+    if(threads == 0 || callback == NULL) return 1;
+    if(count == 0) return 0;
+
+    memset(&batch,0,sizeof(batch));
+    batch.inputs = inputs;
+    batch.threads = threads;
+    batch.callback = callback;
+    batch.userdata = userdata;
+    pthread_mutex_init(&batch.lock,NULL);
+    pthread_cond_init(&batch.wake,NULL);
+
+    batch.files = (batch_file_t*)calloc(count,sizeof(batch_file_t));
+    batch.queues = (batch_queue_t*)calloc(threads,sizeof(batch_queue_t));
+    workers = (batch_worker_t*)calloc(threads,sizeof(batch_worker_t));
+    tids = (pthread_t*)calloc(threads,sizeof(pthread_t));
+    if(batch.files == NULL || batch.queues == NULL || workers == NULL || tids == NULL) goto cleanup;
+
+    for(i = 0; i < threads; i++) {
+        pthread_mutex_init(&batch.queues[i].lock,NULL);
+    }
+
+    /* the decoder pool, one per worker */
+    for(i = 0; i < threads; i++) {
+        workers[i].batch = &batch;
+        workers[i].id = i;
+        workers[i].decoder = (miniflac_t*)malloc(miniflac_size());
+        if(workers[i].decoder == NULL) goto cleanup;
+        miniflac_init(workers[i].decoder,MINIFLAC_CONTAINER_NATIVE);
+        for(j = 0; j < 8; j++) {
+            workers[i].samples[j] = (int32_t*)malloc(sizeof(int32_t) * 65536);
+            if(workers[i].samples[j] == NULL) goto cleanup;
+        }
+    }
+
+    /* deal out the scans, the decode tasks they make get shared out
+     * by stealing */
+    task.first = 0;
+    task.last = 0;
+    for(i = 0; i < count; i++) {
+        task.file = i;
+        if(batch_push(&batch,i % threads,&task)) goto cleanup;
+    }
+    batch.remaining = count;
+
+    for(started = 0; started < threads; started++) {
+        if(pthread_create(&tids[started],NULL,batch_worker,&workers[started]) != 0) break;
+    }
+    /* as long as one thread started it can do all the work */
+    if(started > 0) r = 0;
+
+    for(i = 0; i < started; i++) {
+        pthread_join(tids[i],NULL);
+    }
+
+    cleanup:
+    if(workers != NULL) {
+        for(i = 0; i < threads; i++) {
+            if(workers[i].decoder != NULL) free(workers[i].decoder);
+            for(j = 0; j < 8; j++) {
+                if(workers[i].samples[j] != NULL) free(workers[i].samples[j]);
+            }
+        }
+        free(workers);
+    }
+    if(batch.queues != NULL) {
+        for(i = 0; i < threads; i++) {
+            pthread_mutex_destroy(&batch.queues[i].lock);
+            free(batch.queues[i].tasks);
+        }
+        free(batch.queues);
+    }
+    if(batch.files != NULL) free(batch.files);
+    if(tids != NULL) free(tids);
+    pthread_cond_destroy(&batch.wake);
+    pthread_mutex_destroy(&batch.lock);
+    return r;
+}
@@ -0,0 +1,62 @@
+/* SPDX-License-Identifier: 0BSD */
+#ifndef MINIFLAC_BATCH_H
+#define MINIFLAC_BATCH_H
+
+#include <stdint.h>
+#include "miniflac.h"
+
+/* optional add-on to miniflac: decodes many native FLAC files across a
+ * pool of threads. It needs POSIX threads and the C library, so it isn't
+ * part of miniflac.h - build miniflac_batch.c (make libminiflac_batch.a)
+ * alongside a file that has MINIFLAC_IMPLEMENTATION defined.
+ *
+ * Every file starts out as one task that scans its frame headers with
+ * miniflac_frameinfo, the scan then splits the file into tasks of a few
+ * frames each. Each thread works through its own queue of tasks, newest
+ * first, and when it runs dry it steals the oldest task from another
+ * thread's queue - so one long file gets spread over every thread
+ * instead of keeping one busy while the rest sit idle.
+ *
+ * Each thread keeps one miniflac_t for the whole batch, nothing is
+ * allocated per file besides the frame index. */
+
+/* one file to decode, either already in memory (data and length) or
+ * read from path when its scan task runs (data NULL), and freed once
+ * it's finished */
+struct miniflac_batch_input_s {
+    const char* path;
+    const uint8_t* data;
+    uint32_t length;
+};
+
+typedef struct miniflac_batch_input_s miniflac_batch_input_t;
+
+/* the outcome of one file, result is MINIFLAC_OK if every frame decoded */
+struct miniflac_batch_result_s {
+    MINIFLAC_RESULT result;
+    uint32_t frames;
+    uint64_t samples;
+};
+
+typedef struct miniflac_batch_result_s miniflac_batch_result_t;
+
+/* called once per file, from whichever thread finished it - the order
+ * is unpredictable and calls can happen at the same time */
+typedef void (*miniflac_batch_resultcb)(uint32_t file, const miniflac_batch_result_t* result, void* userdata);
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* decodes inputs[0..count) with the given number of threads, returns
+ * 0 once every file has been reported through the callback or nonzero
+ * if the batch couldn't be started */
+MINIFLAC_API
+int
+miniflac_batch_decode(const miniflac_batch_input_t* inputs, uint32_t count, uint32_t threads, miniflac_batch_resultcb callback, void* userdata);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
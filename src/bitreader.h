@@ -15,7 +15,10 @@ struct miniflac_bitreader_s {
     uint32_t pos;
     uint32_t len;
     const uint8_t* buffer;
-    uint32_t tot; /* total bytes read since last reset */
+    uint32_t tot; /* total bytes consumed since last reset */
+    uint32_t crcpos; /* position in buffer of the next byte to add to the crc */
+    uint64_t crcval; /* bytes from a previous buffer that still need to be added to the crc */
+    uint8_t  crclen; /* number of bytes in crcval */
 };
 
 
@@ -51,6 +54,10 @@ MINIFLAC_PRIVATE
 void
 miniflac_bitreader_discard(miniflac_bitreader_t* br, uint8_t bits);
 
+MINIFLAC_PRIVATE
+int
+miniflac_bitreader_read_unary(miniflac_bitreader_t* br, uint32_t* zeros);
+
 MINIFLAC_PRIVATE
 void
 miniflac_bitreader_align(miniflac_bitreader_t* br);
@@ -59,6 +66,28 @@ MINIFLAC_PRIVATE
 void
 miniflac_bitreader_reset_crc(miniflac_bitreader_t* br);
 
+MINIFLAC_PRIVATE
+void
+miniflac_bitreader_update_crc(miniflac_bitreader_t* br);
+
+MINIFLAC_PRIVATE
+void
+miniflac_bitreader_unfill(miniflac_bitreader_t* br);
+
+MINIFLAC_PRIVATE
+void
+miniflac_bitreader_detach(miniflac_bitreader_t* br);
+
+/* crc8 of a buffer, for checking frame headers without a bitreader */
+MINIFLAC_PRIVATE
+uint8_t
+miniflac_bitreader_crc8(const uint8_t* data, uint32_t length);
+
+/* continues a crc16 over a buffer */
+MINIFLAC_PRIVATE
+uint16_t
+miniflac_bitreader_crc16(uint16_t crc16, const uint8_t* data, uint32_t length);
+
 #ifdef __cplusplus
 }
 #endif
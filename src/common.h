@@ -3,6 +3,9 @@
 #define MINIFLAC_COMMON_H
 
 enum MINIFLAC_RESULT {
+    MINIFLAC_OGG_CRC32_INVALID                 = -21, /* an Ogg page didn't match its crc32 */
+    MINIFLAC_MD5_UNAVAILABLE                   = -20, /* the STREAMINFO block had no MD5 to verify against */
+    MINIFLAC_MD5_MISMATCH                      = -19, /* the decoded audio doesn't match the STREAMINFO MD5 */
     MINIFLAC_OGG_HEADER_NOTFLAC                = -18, /* attempted to read an Ogg header packet that isn't a FLAC-in-Ogg packet */
     MINIFLAC_SUBFRAME_RESERVED_TYPE            = -17, /* subframe header specified a reserved type */
     MINIFLAC_SUBFRAME_RESERVED_BIT             = -16, /* subframe header found a non-zero value in the reserved bit */
@@ -44,6 +47,18 @@ typedef enum MINIFLAC_RESULT MINIFLAC_RESULT;
 #define miniflac_abort()
 #endif
 
+#if !defined(MINIFLAC_NO_SIMD) && (defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 5))
+#if defined(__x86_64__) || defined(__i386__)
+#define MINIFLAC_SIMD_X86
+#define MINIFLAC_TARGET(x) __attribute__((__target__(x)))
+#include <cpuid.h>
+#include <immintrin.h>
+#elif defined(__aarch64__) || defined(__ARM_NEON)
+#define MINIFLAC_SIMD_NEON
+#include <arm_neon.h>
+#endif
+#endif
+
 #define MINIFLAC_API
 #define MINIFLAC_PRIVATE
 
@@ -0,0 +1,82 @@
+/* SPDX-License-Identifier: 0BSD */
+#include "cpu.h"
+#include <stddef.h>
+
+#if defined(MINIFLAC_SIMD_X86) || defined(MINIFLAC_SIMD_NEON)
+/* set in the detected features once the CPU has been probed */
+#define MINIFLAC_CPU_DETECTED 0x80000000U
+
+/* the features, 0 until the first probe. Every probe comes up with the
+ * same value, so decoders set up on several threads at once just store
+ * it more than once - the atomics keep that from being a data race. */
+static uint32_t miniflac_cpu = 0;
+#endif
+
+#if defined(MINIFLAC_SIMD_X86)
+static
+uint32_t
+miniflac_cpu_detect_x86(void) {
+    unsigned int eax, ebx, ecx, edx;
+    unsigned int xcr0_lo, xcr0_hi;
+    uint32_t features = 0;
+
+    if(!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) return 0;
+
+    if(edx & bit_SSE2) features |= MINIFLAC_CPU_SSE2;
+    if(ecx & bit_SSE4_1) features |= MINIFLAC_CPU_SSE41;
+    if((ecx & bit_PCLMUL) && (ecx & bit_SSSE3)) features |= MINIFLAC_CPU_PCLMUL;
+
+    /* AVX2 also needs the OS to save the upper halves of the ymm registers */
+    if(!(ecx & bit_OSXSAVE) || !(ecx & bit_AVX)) return features;
+    __asm__ __volatile__("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+    (void)xcr0_hi;
+    if((xcr0_lo & 0x06) != 0x06) return features;
+
+    if(__get_cpuid_max(0, NULL) < 7) return features;
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+    if(ebx & bit_AVX2) features |= MINIFLAC_CPU_AVX2;
+
+    return features;
+}
+#endif
+
+#if defined(MINIFLAC_SIMD_X86) || defined(MINIFLAC_SIMD_NEON)
+static
+uint32_t
+miniflac_cpu_detect(void) {
+#if defined(MINIFLAC_SIMD_X86)
+    return miniflac_cpu_detect_x86();
+#else
+    /* NEON is mandatory on aarch64, and __ARM_NEON means the
+     * compiler was told it's present */
+    return MINIFLAC_CPU_NEON;
+#endif
+}
+#endif
+
+MINIFLAC_PRIVATE
+uint32_t
+miniflac_cpu_features(void) {
+#if defined(MINIFLAC_SIMD_X86) || defined(MINIFLAC_SIMD_NEON)
+    uint32_t features = __atomic_load_n(&miniflac_cpu,__ATOMIC_RELAXED);
+    if(features == 0) {
+        features = miniflac_cpu_detect() | MINIFLAC_CPU_DETECTED;
+        __atomic_store_n(&miniflac_cpu,features,__ATOMIC_RELAXED);
+    }
+    return features;
+#else
+    return 0;
+#endif
+}
+
+MINIFLAC_PRIVATE
+void
+miniflac_cpu_init(void) {
+#if defined(MINIFLAC_SIMD_X86) || defined(MINIFLAC_SIMD_NEON)
+    /* probe now rather than in the middle of the first frame */
+    (void)miniflac_cpu_features();
+#else
+    /* no kernels to pick from, nothing reads the result */
+    (void)miniflac_cpu_features;
+#endif
+}
@@ -0,0 +1,39 @@
+/* SPDX-License-Identifier: 0BSD */
+#ifndef MINIFLAC_CPU_H
+#define MINIFLAC_CPU_H
+
+#include "common.h"
+#include <stdint.h>
+
+enum MINIFLAC_CPU_FEATURE {
+    MINIFLAC_CPU_SSE41 = 0x01,
+    MINIFLAC_CPU_AVX2  = 0x02,
+    MINIFLAC_CPU_NEON  = 0x04,
+    MINIFLAC_CPU_SSE2  = 0x08,
+    MINIFLAC_CPU_PCLMUL = 0x10, /* PCLMULQDQ and SSSE3 */
+};
+
+typedef enum MINIFLAC_CPU_FEATURE MINIFLAC_CPU_FEATURE;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* probes the CPU, if that hasn't happened yet, and records which SIMD
+ * kernels can be used. Called from miniflac_init, it's safe to set up
+ * decoders on several threads at once. */
+MINIFLAC_PRIVATE
+void
+miniflac_cpu_init(void);
+
+/* returns a bitmask of MINIFLAC_CPU_FEATURE values, probing the CPU
+ * first if need be */
+MINIFLAC_PRIVATE
+uint32_t
+miniflac_cpu_features(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -69,6 +69,7 @@ static const char* const miniflac_frame_state_str[] = {
     "MINIFLAC_FRAME_HEADER",
     "MINIFLAC_FRAME_SUBFRAME",
     "MINIFLAC_FRAME_FOOTER",
+    "MINIFLAC_FRAME_SKIP",
 };
 
 static const char* const miniflac_ogg_state_str[] = {
@@ -391,7 +392,9 @@ void miniflac_dump_streaminfo(miniflac_streaminfo_t* streaminfo, uint8_t indent)
     indent += 2;
     dumpf(indent,"state: %s\n",miniflac_streaminfo_state_str[streaminfo->state]);
     dumpf(indent,"pos: %u\n",streaminfo->pos);
+    dumpf(indent,"max_frame_size: %u\n",streaminfo->max_frame_size);
     dumpf(indent,"sample_rate: %u\n",streaminfo->sample_rate);
+    dumpf(indent,"channels: %u\n",streaminfo->channels);
     dumpf(indent,"bps: %u\n",streaminfo->bps);
 }
 
@@ -1,5 +1,7 @@
 /* SPDX-License-Identifier: 0BSD */
 #include "flac.h"
+#include "cpu.h"
+#include "unpack.h"
 #include <stddef.h>
 
 #define MINIFLAC_VERSION_MAJOR 1
@@ -44,6 +46,8 @@ miniflac_oggreset(miniflac_t* pFlac) {
     miniflac_streammarker_init(&pFlac->streammarker);
     miniflac_metadata_init(&pFlac->metadata);
     miniflac_frame_init(&pFlac->frame);
+    pFlac->frame_offset = 0;
+    pFlac->frame_offset_set = 0;
     pFlac->state = MINIFLAC_OGGHEADER;
 }
 
@@ -52,17 +56,57 @@ MINIFLAC_RESULT
 miniflac_oggfunction_start(miniflac_t* pFlac, const uint8_t* data, const uint8_t** packet, uint32_t* packet_length) {
     MINIFLAC_RESULT r;
 
-    while(pFlac->ogg.state != MINIFLAC_OGG_DATA) {
-        r = miniflac_ogg_sync(&pFlac->ogg,&pFlac->ogg.br);
-        if(r != MINIFLAC_OK) return r;
+    for(;;) {
+        while(pFlac->ogg.state != MINIFLAC_OGG_DATA) {
+            if(pFlac->oggserial_set) {
+                miniflac_ogg_skip_foreign(&pFlac->ogg,pFlac->oggserial);
+            }
+
+            r = miniflac_ogg_sync(&pFlac->ogg,&pFlac->ogg.br);
+            if(r != MINIFLAC_OK) return r;
 
-        if(pFlac->oggserial_set == 0) {
-            if(pFlac->ogg.headertype & 0x02) {
-                miniflac_oggreset(pFlac);
+            if(pFlac->oggserial_set == 0) {
+                /* only a new stream can be picked up, pages of other
+                 * streams can carry on past the end of ours */
+                if(pFlac->ogg.headertype & 0x02) {
+                    miniflac_oggreset(pFlac);
+                } else if(pFlac->state != MINIFLAC_OGGHEADER) {
+                    pFlac->ogg.state = MINIFLAC_OGG_SKIP;
+                }
+            } else {
+                if(pFlac->oggserial != pFlac->ogg.serialno) pFlac->ogg.state = MINIFLAC_OGG_SKIP;
             }
-        } else {
-            if(pFlac->oggserial != pFlac->ogg.serialno) pFlac->ogg.state = MINIFLAC_OGG_SKIP;
+
+            if(pFlac->ogg.state == MINIFLAC_OGG_DATA) {
+                r = miniflac_ogg_verify(&pFlac->ogg);
+                if(r != MINIFLAC_OK) return r;
+                pFlac->oggpage_last = pFlac->oggpage_offset;
+                pFlac->oggpage_offset = pFlac->bytes_read_ogg + pFlac->ogg.br.pos - 27 - pFlac->ogg.segments;
+            }
+        }
+
+        /* after a seek, drop packets until one starts with a frame
+         * sync code. The page may start with the end of a packet from
+         * the page before, and the page with the first frame can have
+         * metadata on it too */
+        while(pFlac->oggresync && pFlac->ogg.state == MINIFLAC_OGG_DATA) {
+            if(pFlac->ogg.pos == 0 && (pFlac->ogg.headertype & 0x01)) {
+                pFlac->oggresync = 2;
+            }
+            if(pFlac->oggresync == 1) {
+                if(pFlac->ogg.br.pos == pFlac->ogg.br.len) return MINIFLAC_CONTINUE;
+                if(pFlac->ogg.br.buffer[pFlac->ogg.br.pos] == 0xFF) {
+                    pFlac->oggresync = 0;
+                    break;
+                }
+                pFlac->oggresync = 2;
+            }
+            r = miniflac_ogg_skip_packet(&pFlac->ogg);
+            if(r != MINIFLAC_OK) return r;
+            pFlac->oggresync = 1;
         }
+
+        if(pFlac->ogg.state == MINIFLAC_OGG_DATA) break;
     }
 
     *packet = &data[pFlac->ogg.br.pos];
@@ -74,21 +118,22 @@ miniflac_oggfunction_start(miniflac_t* pFlac, const uint8_t* data, const uint8_t
     return MINIFLAC_OK;
 }
 
+/* a bad page checksum takes priority over whatever the packet
+ * function returned */
 static
-void
-miniflac_oggfunction_end(miniflac_t* pFlac, uint32_t packet_used) {
-    pFlac->ogg.br.pos += packet_used;
-    pFlac->ogg.pos    += packet_used;
+MINIFLAC_RESULT
+miniflac_oggfunction_end(miniflac_t* pFlac, uint32_t packet_used, MINIFLAC_RESULT r) {
+    MINIFLAC_RESULT res = miniflac_ogg_advance(&pFlac->ogg,packet_used);
+    if(res != MINIFLAC_OK) r = res;
 
     if(pFlac->ogg.pos == pFlac->ogg.length) {
-        pFlac->ogg.state = MINIFLAC_OGG_CAPTUREPATTERN_O;
         if(pFlac->ogg.headertype & 0x04) {
             if(pFlac->oggserial_set == 1 && pFlac->oggserial == pFlac->ogg.serialno) {
                 pFlac->oggserial_set = 0;
-                pFlac->oggserial = 0;
             }
         }
     }
+    return r;
 }
 
 MINIFLAC_API
@@ -101,11 +146,17 @@ miniflac_size(void) {
 MINIFLAC_API
 void
 miniflac_reset(miniflac_t* pFlac, MINIFLAC_STATE state) {
+    uint16_t max_block_size = 0;
+    uint32_t max_frame_size = 0;
     uint32_t sample_rate = 0;
+    uint8_t channels = 0;
     uint8_t bps = 0;
 
     if(state == MINIFLAC_FRAME) {
+        max_block_size = pFlac->metadata.streaminfo.max_block_size;
+        max_frame_size = pFlac->metadata.streaminfo.max_frame_size;
         sample_rate = pFlac->metadata.streaminfo.sample_rate;
+        channels = pFlac->metadata.streaminfo.channels;
         bps = pFlac->metadata.streaminfo.bps;
     }
 
@@ -117,16 +168,26 @@ miniflac_reset(miniflac_t* pFlac, MINIFLAC_STATE state) {
     miniflac_frame_init(&pFlac->frame);
     pFlac->bytes_read_flac = 0;
     pFlac->bytes_read_ogg = 0;
+    pFlac->seek_pending = 0;
+    pFlac->oggpage_offset = 0;
+    pFlac->oggpage_last = 0;
+    pFlac->oggresync = state == MINIFLAC_FRAME;
     pFlac->state = state;
 
     if(state == MINIFLAC_FRAME) {
+        pFlac->metadata.streaminfo.max_block_size = max_block_size;
+        pFlac->metadata.streaminfo.max_frame_size = max_frame_size;
         pFlac->metadata.streaminfo.sample_rate = sample_rate;
+        pFlac->metadata.streaminfo.channels = channels;
         pFlac->metadata.streaminfo.bps = bps;
+    } else {
+        pFlac->frame_offset = 0;
+        pFlac->frame_offset_set = 0;
     }
 
-    /* if we're using an ogg container we need to look for an ogg header
-     * no matter what */
-    if(pFlac->container == MINIFLAC_CONTAINER_OGG) {
+    /* if we're using an ogg container we need to look for an ogg header,
+     * unless we're picking up frames after a seek */
+    if(pFlac->container == MINIFLAC_CONTAINER_OGG && state != MINIFLAC_FRAME) {
         pFlac->state = MINIFLAC_OGGHEADER;
     }
 
@@ -135,6 +196,8 @@ miniflac_reset(miniflac_t* pFlac, MINIFLAC_STATE state) {
 MINIFLAC_API
 void
 miniflac_init(miniflac_t* pFlac, MINIFLAC_CONTAINER container) {
+    miniflac_cpu_init();
+
     pFlac->container = container;
     pFlac->oggserial = -1;
     pFlac->oggserial_set = 0;
@@ -155,6 +218,26 @@ miniflac_init(miniflac_t* pFlac, MINIFLAC_CONTAINER container) {
     }
 }
 
+/* remembers where the first audio frame starts, seekpoint offsets
+ * are relative to it. Called with the sync code peeked but not read.
+ * In Ogg it's the page the frame starts on, which is the page before
+ * the current one if the sync code was split across them. */
+static
+void
+miniflac_mark_frame_offset(miniflac_t* pFlac, miniflac_bitreader_t* br) {
+    if(pFlac->frame_offset_set) return;
+    if(pFlac->container == MINIFLAC_CONTAINER_OGG) {
+        if((uint32_t)pFlac->ogg.pos + br->pos < (uint32_t)(br->bits >> 3)) {
+            pFlac->frame_offset = pFlac->oggpage_last;
+        } else {
+            pFlac->frame_offset = pFlac->oggpage_offset;
+        }
+    } else {
+        pFlac->frame_offset = pFlac->bytes_read_flac + br->pos - (br->bits >> 3);
+    }
+    pFlac->frame_offset_set = 1;
+}
+
 static
 MINIFLAC_RESULT
 miniflac_sync_internal(miniflac_t* pFlac, miniflac_bitreader_t* br) {
@@ -178,6 +261,7 @@ miniflac_sync_internal(miniflac_t* pFlac, miniflac_bitreader_t* br) {
                 pFlac->state = MINIFLAC_STREAMMARKER;
                 goto miniflac_sync_streammarker;
             } else if(c == 0xFF) {
+                miniflac_mark_frame_offset(pFlac,br);
                 pFlac->state = MINIFLAC_FRAME;
                 goto miniflac_sync_frame;
             }
@@ -198,6 +282,7 @@ miniflac_sync_internal(miniflac_t* pFlac, miniflac_bitreader_t* br) {
             if(miniflac_bitreader_fill(br,16)) return MINIFLAC_CONTINUE;
             peek = (uint16_t)miniflac_bitreader_peek(br,14);
             if(peek == 0x3FFE) {
+                miniflac_mark_frame_offset(pFlac,br);
                 pFlac->state = MINIFLAC_FRAME;
                 goto miniflac_sync_frame;
             }
@@ -222,9 +307,10 @@ miniflac_sync_internal(miniflac_t* pFlac, miniflac_bitreader_t* br) {
 
         case MINIFLAC_FRAME: {
             miniflac_sync_frame:
-            while(pFlac->frame.state != MINIFLAC_FRAME_HEADER) {
-                r = miniflac_frame_decode(&pFlac->frame,br,&pFlac->metadata.streaminfo,NULL);
-                if(r != MINIFLAC_OK) return r;
+            /* in the middle of a frame, jump straight to the next
+             * header instead of decoding the rest of it */
+            if(pFlac->frame.state != MINIFLAC_FRAME_HEADER) {
+                return miniflac_frame_skip(&pFlac->frame,br,&pFlac->metadata.streaminfo);
             }
 
             return miniflac_frame_sync(&pFlac->frame,br,&pFlac->metadata.streaminfo);
@@ -235,6 +321,18 @@ miniflac_sync_internal(miniflac_t* pFlac, miniflac_bitreader_t* br) {
     return MINIFLAC_ERROR;
 }
 
+static
+void
+miniflac_native_exit(miniflac_t* pFlac, MINIFLAC_RESULT r, uint32_t* out_length) {
+    /* the bitreader reads ahead, return any whole bytes past the
+     * point we stopped at so out_length is exact. On MINIFLAC_CONTINUE
+     * everything has been used. */
+    if(r != MINIFLAC_CONTINUE) miniflac_bitreader_unfill(&pFlac->br);
+    *out_length = pFlac->br.pos;
+    pFlac->bytes_read_flac += pFlac->br.pos;
+    miniflac_bitreader_detach(&pFlac->br);
+}
+
 static
 MINIFLAC_RESULT
 miniflac_sync_native(miniflac_t* pFlac, const uint8_t* data, uint32_t length, uint32_t* out_length) {
@@ -245,14 +343,90 @@ miniflac_sync_native(miniflac_t* pFlac, const uint8_t* data, uint32_t length, ui
 
     r = miniflac_sync_internal(pFlac,&pFlac->br);
 
-    *out_length = pFlac->br.pos;
-    pFlac->bytes_read_flac += pFlac->br.pos;
+    miniflac_native_exit(pFlac,r,out_length);
     return r;
 }
 
+/* the first sample of a frame, from its decoded header */
+static
+uint64_t
+miniflac_frame_first_sample(miniflac_t* pFlac, const miniflac_frame_header_t* header) {
+    uint64_t block_size;
+    if(header->blocking_strategy) return header->sample_number;
+
+    block_size = pFlac->metadata.streaminfo.max_block_size;
+    if(block_size == 0) block_size = header->block_size;
+    return header->sample_number * block_size;
+}
+
+/* after a seek, skips over frames that end before the target, stops
+ * with the header of the frame holding the target decoded */
 static
 MINIFLAC_RESULT
-miniflac_decode_native(miniflac_t* pFlac, const uint8_t* data, uint32_t length, uint32_t* out_length, int32_t** samples) {
+miniflac_seek_skip(miniflac_t* pFlac) {
+    MINIFLAC_RESULT r;
+
+    for(;;) {
+        if(pFlac->frame.state == MINIFLAC_FRAME_HEADER) {
+            r = miniflac_frame_sync(&pFlac->frame,&pFlac->br,&pFlac->metadata.streaminfo);
+            if(r != MINIFLAC_OK) return r;
+        }
+        if(miniflac_frame_first_sample(pFlac,&pFlac->frame.header) + pFlac->frame.header.block_size > pFlac->seek_target) {
+            return MINIFLAC_OK;
+        }
+        r = miniflac_frame_skip(&pFlac->frame,&pFlac->br,&pFlac->metadata.streaminfo);
+        if(r != MINIFLAC_OK) return r;
+    }
+}
+
+static
+void
+miniflac_seek_move(uint8_t* buffer, uint32_t skip, uint32_t length) {
+    uint32_t i;
+    for(i = 0; i < length; i++) {
+        buffer[i] = buffer[i + skip];
+    }
+}
+
+/* drops the samples before the seek target from the frame that
+ * was just decoded */
+static
+void
+miniflac_seek_trim(miniflac_t* pFlac, int32_t** samples, const miniflac_output_t* packed) {
+    uint64_t first = miniflac_frame_first_sample(pFlac,&pFlac->frame.header);
+    uint32_t skip;
+    uint32_t keep;
+    uint32_t size;
+    uint8_t c;
+    uint8_t channels = pFlac->frame.header.channels;
+
+    pFlac->seek_pending = 0;
+    if(pFlac->seek_target <= first) return;
+
+    skip = (uint32_t)(pFlac->seek_target - first);
+    keep = pFlac->frame.header.block_size - skip;
+
+    if(samples != NULL) {
+        for(c = 0; c < channels; c++) {
+            miniflac_seek_move((uint8_t*)samples[c],skip * sizeof(int32_t),keep * sizeof(int32_t));
+        }
+    } else if(packed != NULL) {
+        size = miniflac_output_sample_size(packed->format);
+        if(packed->samples != NULL) {
+            miniflac_seek_move((uint8_t*)packed->samples,skip * size * channels,keep * size * channels);
+        } else {
+            for(c = 0; c < channels; c++) {
+                miniflac_seek_move((uint8_t*)packed->planes[c],skip * size,keep * size);
+            }
+        }
+    }
+
+    pFlac->frame.header.block_size = (uint16_t)keep;
+}
+
+static
+MINIFLAC_RESULT
+miniflac_decode_native(miniflac_t* pFlac, const uint8_t* data, uint32_t length, uint32_t* out_length, int32_t** samples, const miniflac_output_t* packed) {
     MINIFLAC_RESULT r;
     pFlac->br.buffer = data;
     pFlac->br.len    = length;
@@ -263,11 +437,18 @@ miniflac_decode_native(miniflac_t* pFlac, const uint8_t* data, uint32_t length,
         if(r != MINIFLAC_OK) goto miniflac_decode_exit;
     }
 
-    r = miniflac_frame_decode(&pFlac->frame,&pFlac->br,&pFlac->metadata.streaminfo,samples);
+    if(pFlac->seek_pending) {
+        r = miniflac_seek_skip(pFlac);
+        if(r != MINIFLAC_OK) goto miniflac_decode_exit;
+    }
+
+    r = miniflac_frame_decode(&pFlac->frame,&pFlac->br,&pFlac->metadata.streaminfo,samples,packed);
+    if(r == MINIFLAC_OK && pFlac->seek_pending) {
+        miniflac_seek_trim(pFlac,samples,packed);
+    }
 
     miniflac_decode_exit:
-    *out_length = pFlac->br.pos;
-    pFlac->bytes_read_flac += pFlac->br.pos;
+    miniflac_native_exit(pFlac,r,out_length);
     return r;
 }
 
@@ -289,7 +470,7 @@ miniflac_sync_ogg(miniflac_t* pFlac, const uint8_t* data, uint32_t length, uint3
         if(r != MINIFLAC_OK) break;
 
         r = miniflac_sync_native(pFlac,packet,packet_length,&packet_used);
-        miniflac_oggfunction_end(pFlac,packet_used);
+        r = miniflac_oggfunction_end(pFlac,packet_used,r);
 
         if(r == MINIFLAC_OGG_HEADER_NOTFLAC) {
             /* try reading more data */
@@ -305,7 +486,7 @@ miniflac_sync_ogg(miniflac_t* pFlac, const uint8_t* data, uint32_t length, uint3
 
 static
 MINIFLAC_RESULT
-miniflac_decode_ogg(miniflac_t* pFlac, const uint8_t* data, uint32_t length, uint32_t* out_length, int32_t** samples) {
+miniflac_decode_ogg(miniflac_t* pFlac, const uint8_t* data, uint32_t length, uint32_t* out_length, int32_t** samples, const miniflac_output_t* packed) {
     MINIFLAC_RESULT r = MINIFLAC_CONTINUE;
 
     const uint8_t* packet = NULL;
@@ -320,8 +501,8 @@ miniflac_decode_ogg(miniflac_t* pFlac, const uint8_t* data, uint32_t length, uin
         r = miniflac_oggfunction_start(pFlac,data,&packet,&packet_length);
         if(r  != MINIFLAC_OK) break;
 
-        r = miniflac_decode_native(pFlac,packet,packet_length,&packet_used,samples);
-        miniflac_oggfunction_end(pFlac,packet_used);
+        r = miniflac_decode_native(pFlac,packet,packet_length,&packet_used,samples,packed);
+        r = miniflac_oggfunction_end(pFlac,packet_used,r);
     } while(r == MINIFLAC_CONTINUE && pFlac->ogg.br.pos < length);
 
     *out_length = pFlac->ogg.br.pos;
@@ -361,14 +542,298 @@ miniflac_decode(miniflac_t* pFlac, const uint8_t* data, uint32_t length, uint32_
     }
 
     if(pFlac->container == MINIFLAC_CONTAINER_NATIVE) {
-        r = miniflac_decode_native(pFlac,data,length,out_length,samples);
+        r = miniflac_decode_native(pFlac,data,length,out_length,samples,NULL);
     } else {
-        r = miniflac_decode_ogg(pFlac,data,length,out_length,samples);
+        r = miniflac_decode_ogg(pFlac,data,length,out_length,samples,NULL);
     }
 
     return r;
 }
 
+static
+MINIFLAC_RESULT
+miniflac_decode_packed(miniflac_t* pFlac, const uint8_t* data, uint32_t length, uint32_t* out_length, const miniflac_output_t* packed) {
+    MINIFLAC_RESULT r;
+
+    if(pFlac->container == MINIFLAC_CONTAINER_UNKNOWN) {
+        r = miniflac_probe(pFlac,data,length);
+        if(r != MINIFLAC_OK) return r;
+    }
+
+    if(pFlac->container == MINIFLAC_CONTAINER_NATIVE) {
+        r = miniflac_decode_native(pFlac,data,length,out_length,NULL,packed);
+    } else {
+        r = miniflac_decode_ogg(pFlac,data,length,out_length,NULL,packed);
+    }
+
+    return r;
+}
+
+MINIFLAC_API
+MINIFLAC_RESULT
+miniflac_decode_interleaved(miniflac_t* pFlac, const uint8_t* data, uint32_t length, uint32_t* out_length, MINIFLAC_SAMPLE_FORMAT format, void* samples, int32_t* scratch) {
+    miniflac_output_t packed;
+
+    packed.format  = format;
+    packed.samples = samples;
+    packed.planes  = NULL;
+    packed.scratch = scratch;
+
+    return miniflac_decode_packed(pFlac,data,length,out_length,&packed);
+}
+
+MINIFLAC_API
+MINIFLAC_RESULT
+miniflac_decode_planar(miniflac_t* pFlac, const uint8_t* data, uint32_t length, uint32_t* out_length, MINIFLAC_SAMPLE_FORMAT format, void** samples, int32_t* scratch) {
+    miniflac_output_t packed;
+
+    packed.format  = format;
+    packed.samples = NULL;
+    packed.planes  = samples;
+    packed.scratch = scratch;
+
+    return miniflac_decode_packed(pFlac,data,length,out_length,&packed);
+}
+
+MINIFLAC_API
+MINIFLAC_RESULT
+miniflac_seek(miniflac_t* pFlac, const miniflac_seekpoint_t* points, uint32_t points_length, uint64_t sample_number, uint64_t* offset) {
+    uint32_t i;
+    uint64_t point_offset = 0;
+
+    if(pFlac->container == MINIFLAC_CONTAINER_UNKNOWN || !pFlac->frame_offset_set) {
+        miniflac_abort();
+        return MINIFLAC_ERROR;
+    }
+
+    /* seekpoints are sorted by sample number, with placeholders last */
+    if(points != NULL) {
+        for(i = 0; i < points_length; i++) {
+            if(points[i].sample_number == ~(uint64_t)0 || points[i].sample_number > sample_number) break;
+            point_offset = points[i].sample_offset;
+        }
+    }
+
+    miniflac_reset(pFlac,MINIFLAC_FRAME);
+    pFlac->seek_target = sample_number;
+    pFlac->seek_pending = 1;
+    *offset = pFlac->frame_offset + point_offset;
+    if(pFlac->container == MINIFLAC_CONTAINER_OGG) {
+        /* the end-of-stream page clears oggserial_set but keeps
+         * oggserial, so re-arm it to follow the same stream again
+         * after seeking back */
+        pFlac->oggserial_set = 1;
+        pFlac->bytes_read_ogg = *offset;
+    } else {
+        pFlac->bytes_read_flac = *offset;
+    }
+    return MINIFLAC_OK;
+}
+
+MINIFLAC_API
+MINIFLAC_RESULT
+miniflac_frameinfo(miniflac_t* pFlac, const uint8_t* data, uint32_t length, uint32_t* out_length, miniflac_frameinfo_t* info) {
+    MINIFLAC_RESULT r;
+    uint32_t pos = 0;
+    uint32_t used = 0;
+
+    do {
+        r = miniflac_sync(pFlac,&data[pos],length - pos,&used);
+        pos += used;
+        if(r != MINIFLAC_OK) goto miniflac_frameinfo_exit;
+    } while(pFlac->state != MINIFLAC_FRAME);
+
+    if(pFlac->container != MINIFLAC_CONTAINER_NATIVE) {
+        miniflac_abort();
+        r = MINIFLAC_ERROR;
+        goto miniflac_frameinfo_exit;
+    }
+
+    /* miniflac_sync stops right after the header */
+    info->offset = pFlac->bytes_read_flac - pFlac->frame.header.size;
+    info->sample_number = miniflac_frame_first_sample(pFlac,&pFlac->frame.header);
+    info->block_size = pFlac->frame.header.block_size;
+    info->header_size = (uint8_t)pFlac->frame.header.size;
+
+    miniflac_frameinfo_exit:
+    *out_length = pos;
+    return r;
+}
+
+MINIFLAC_API
+uint32_t
+miniflac_frameinfo_find(const miniflac_frameinfo_t* index, uint32_t length, uint64_t sample_number) {
+    uint32_t lo = 0;
+    uint32_t hi = length;
+    uint32_t mid;
+    uint64_t guess;
+
+    if(length == 0) return 0;
+
+    /* with a fixed block size the frame can be worked out directly */
+    if(index[0].block_size != 0) {
+        guess = sample_number / index[0].block_size;
+        if(guess < length && index[guess].sample_number <= sample_number && sample_number < index[guess].sample_number + index[guess].block_size) {
+            return (uint32_t)guess;
+        }
+    }
+
+    while(hi - lo > 1) {
+        mid = lo + (hi - lo) / 2;
+        if(index[mid].sample_number <= sample_number) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+MINIFLAC_API
+MINIFLAC_RESULT
+miniflac_seek_probe(miniflac_t* pFlac, const uint8_t* data, uint32_t length, uint32_t* out_length, uint64_t* sample_number, uint16_t* block_size) {
+    miniflac_frame_header_t header;
+    miniflac_bitreader_t br;
+    miniflac_streaminfo_t* info = &pFlac->metadata.streaminfo;
+    uint32_t pos;
+    int size;
+
+    if(pFlac->container != MINIFLAC_CONTAINER_NATIVE) {
+        miniflac_abort();
+        return MINIFLAC_ERROR;
+    }
+
+    for(pos = 0; pos < length; pos++) {
+        size = miniflac_frame_header_check(&data[pos],length - pos);
+        if(size < 0) break;
+        if(size == 0) continue;
+
+        /* the crc8 matched, so this can't fail */
+        miniflac_bitreader_init(&br);
+        br.buffer = &data[pos];
+        br.len = (uint32_t)size;
+        miniflac_frame_header_init(&header);
+        if(miniflac_frame_header_decode(&header,&br) != MINIFLAC_OK) continue;
+
+        /* a crc8 matches by chance 1 time in 256, weed out headers
+         * that don't fit the stream */
+        if(!miniflac_frame_header_fits(&header,info)) continue;
+
+        *out_length = pos;
+        *sample_number = miniflac_frame_first_sample(pFlac,&header);
+        *block_size = header.block_size;
+        return MINIFLAC_OK;
+    }
+
+    *out_length = pos;
+    return MINIFLAC_CONTINUE;
+}
+
+MINIFLAC_API
+MINIFLAC_RESULT
+miniflac_ogg_probe(miniflac_t* pFlac, const uint8_t* data, uint32_t length, uint32_t* out_length, int64_t* granulepos) {
+    miniflac_ogg_t page;
+    uint32_t pos = 0;
+    uint32_t used;
+    uint32_t size;
+
+    if(pFlac->container != MINIFLAC_CONTAINER_OGG || !pFlac->frame_offset_set) {
+        miniflac_abort();
+        return MINIFLAC_ERROR;
+    }
+
+    while(miniflac_ogg_find(&page,&data[pos],length - pos,&used) == MINIFLAC_OK) {
+        pos += used;
+        if(page.serialno == pFlac->oggserial) {
+            if(page.granulepos != -1) {
+                *out_length = pos;
+                *granulepos = page.granulepos;
+                return MINIFLAC_OK;
+            }
+        } else if(page.headertype & 0x02) {
+            /* beginning-of-stream pages of a multiplexed file all come
+             * first, so this is the next link of a chained file */
+            *out_length = pos;
+            *granulepos = -1;
+            return MINIFLAC_OK;
+        }
+
+        /* jump over pages that don't tell us anything */
+        size = 27 + (uint32_t)page.segments + page.length;
+        if(size > length - pos) {
+            *out_length = length;
+            return MINIFLAC_CONTINUE;
+        }
+        pos += size;
+    }
+
+    *out_length = pos + used;
+    return MINIFLAC_CONTINUE;
+}
+
+MINIFLAC_API
+MINIFLAC_RESULT
+miniflac_ogg_pageinfo(const uint8_t* data, uint32_t length, miniflac_ogg_pageinfo_t* info) {
+    const uint8_t* packet;
+
+    if(length < 27) return MINIFLAC_CONTINUE;
+    if(data[0] != 'O' || data[1] != 'g' || data[2] != 'g' || data[3] != 'S' || data[4] != 0) {
+        miniflac_abort();
+        return MINIFLAC_ERROR;
+    }
+    if(length < 27 + (uint32_t)data[26]) return MINIFLAC_CONTINUE;
+
+    info->size = miniflac_ogg_page_size(data);
+    if(length < info->size) return MINIFLAC_CONTINUE;
+
+    info->headertype = data[5];
+    info->granulepos = miniflac_unpack_int64le(&data[6]);
+    info->serialno   = miniflac_unpack_int32le(&data[14]);
+    info->pageno     = miniflac_unpack_uint32le(&data[18]);
+
+    /* the first packet of a FLAC stream starts with 0x7F "FLAC" */
+    packet = &data[27 + (uint32_t)data[26]];
+    info->flac = (info->headertype & 0x02) && info->size - (uint32_t)(packet - data) >= 5 &&
+      packet[0] == 0x7F && packet[1] == 'F' && packet[2] == 'L' && packet[3] == 'A' && packet[4] == 'C';
+
+    return MINIFLAC_OK;
+}
+
+MINIFLAC_API
+void
+miniflac_verify_init(miniflac_md5_t* md5) {
+    miniflac_md5_init(md5);
+}
+
+MINIFLAC_API
+void
+miniflac_verify_frame(miniflac_md5_t* md5, miniflac_t* pFlac, int32_t** samples) {
+    miniflac_md5_samples(md5,samples,pFlac->frame.header.channels,pFlac->frame.header.block_size,pFlac->frame.header.bps);
+}
+
+MINIFLAC_API
+MINIFLAC_RESULT
+miniflac_verify_check(miniflac_md5_t* md5, miniflac_t* pFlac) {
+    uint8_t digest[16];
+    uint8_t set = 0;
+    uint8_t i;
+
+    miniflac_md5_final(md5,digest);
+
+    for(i = 0; i < 16; i++) {
+        set |= pFlac->metadata.streaminfo.md5[i];
+    }
+    if(!set) return MINIFLAC_MD5_UNAVAILABLE;
+
+    for(i = 0; i < 16; i++) {
+        if(digest[i] != pFlac->metadata.streaminfo.md5[i]) {
+            miniflac_abort();
+            return MINIFLAC_MD5_MISMATCH;
+        }
+    }
+    return MINIFLAC_OK;
+}
+
 MINIFLAC_API
 MINIFLAC_RESULT
 miniflac_sync(miniflac_t* pFlac, const uint8_t* data, uint32_t length, uint32_t* out_length) {
@@ -566,8 +1031,7 @@ miniflac_ ## subsys ## _ ## val ## _native(miniflac_t *pFlac, const uint8_t* dat
     } \
     r = miniflac_ ## subsys ## _read_ ## val(MINIFLAC_SUBSYS(subsys),&pFlac->br, outvar); \
     miniflac_ ## subsys ## _ ## val ## _exit: \
-    *out_length = pFlac->br.pos; \
-    pFlac->bytes_read_flac += pFlac->br.pos; \
+    miniflac_native_exit(pFlac,r,out_length); \
     return r; \
 }
 
@@ -586,7 +1050,7 @@ miniflac_ ## subsys ## _ ## val ## _ogg(miniflac_t *pFlac, const uint8_t* data,
         r = miniflac_oggfunction_start(pFlac,data,&packet,&packet_length); \
         if(r  != MINIFLAC_OK) break; \
         r = miniflac_ ## subsys ## _ ## val ## _native(pFlac,packet,packet_length,&packet_used,outvar); \
-        miniflac_oggfunction_end(pFlac,packet_used); \
+        r = miniflac_oggfunction_end(pFlac,packet_used,r); \
     } while(r == MINIFLAC_CONTINUE && pFlac->ogg.br.pos < length); \
     *out_length = pFlac->ogg.br.pos; \
     pFlac->bytes_read_ogg += pFlac->ogg.br.pos; \
@@ -634,8 +1098,7 @@ miniflac_ ## subsys ## _ ## val ## _native(miniflac_t *pFlac, const uint8_t* dat
     } \
     r = miniflac_ ## subsys ## _read_ ## val(MINIFLAC_SUBSYS(subsys),&pFlac->br, buffer, bufferlen, outlen); \
     miniflac_ ## subsys ## _ ## val ## _exit: \
-    *out_length = pFlac->br.pos; \
-    pFlac->bytes_read_flac += pFlac->br.pos; \
+    miniflac_native_exit(pFlac,r,out_length); \
     return r; \
 }
 
@@ -654,7 +1117,7 @@ miniflac_ ## subsys ## _ ## val ## _ogg(miniflac_t *pFlac, const uint8_t* data,
         r = miniflac_oggfunction_start(pFlac,data,&packet,&packet_length); \
         if(r  != MINIFLAC_OK) break; \
         r = miniflac_ ## subsys ## _ ## val ##_native(pFlac,packet,packet_length,&packet_used,buffer,bufferlen,outlen); \
-        miniflac_oggfunction_end(pFlac,packet_used); \
+        r = miniflac_oggfunction_end(pFlac,packet_used,r); \
     } while(r == MINIFLAC_CONTINUE && pFlac->ogg.br.pos < length); \
     *out_length = pFlac->ogg.br.pos; \
     pFlac->bytes_read_ogg += pFlac->ogg.br.pos; \
@@ -728,6 +1191,7 @@ MINIFLAC_GEN_FUNC1(SEEKTABLE,seektable,seekpoints,uint32_t)
 MINIFLAC_GEN_FUNC1(SEEKTABLE,seektable,sample_number,uint64_t)
 MINIFLAC_GEN_FUNC1(SEEKTABLE,seektable,sample_offset,uint64_t)
 MINIFLAC_GEN_FUNC1(SEEKTABLE,seektable,samples,uint16_t)
+MINIFLAC_GEN_FUNCSTR(SEEKTABLE,seektable,points,miniflac_seekpoint_t)
 
 MINIFLAC_GEN_FUNC1(APPLICATION,application,id,uint32_t)
 MINIFLAC_GEN_FUNC1(APPLICATION,application,length,uint32_t)
@@ -12,6 +12,7 @@
 #include "streammarker.h"
 #include "metadata.h"
 #include "frame.h"
+#include "md5.h"
 
 enum MINIFLAC_STATE {
     MINIFLAC_OGGHEADER, /* will try to find an ogg header */
@@ -40,6 +41,13 @@ struct miniflac_s {
     struct miniflac_frame_s frame;
     int32_t oggserial;
     uint8_t oggserial_set;
+    uint64_t frame_offset; /* byte offset of the first audio frame, or in Ogg of the page it starts on */
+    uint8_t frame_offset_set;
+    uint64_t oggpage_offset; /* byte offset of the Ogg page being read */
+    uint64_t oggpage_last; /* and of the page of the stream before it */
+    uint8_t oggresync; /* after a seek, 1 while looking for a packet with a frame, 2 while skipping one */
+    uint64_t seek_target; /* sample the next decoded frame should start at */
+    uint8_t seek_pending;
     uint64_t bytes_read_flac; /* total bytes of flac data read */
     uint64_t bytes_read_ogg; /* total bytes of ogg data read */
 };
@@ -83,6 +91,23 @@ MINIFLAC_API
 MINIFLAC_RESULT
 miniflac_decode(miniflac_t* pFlac, const uint8_t* data, uint32_t length, uint32_t* out_length, int32_t** samples);
 
+/* decode a frame of audio straight into a single interleaved buffer of
+ * the given format, with room for block size * channels samples.
+ * scratch needs room for 2 * block size int32_t samples, 2 * the STREAMINFO
+ * max block size (or 2 * 65535 when that's unknown) is always enough. */
+MINIFLAC_API
+MINIFLAC_RESULT
+miniflac_decode_interleaved(miniflac_t* pFlac, const uint8_t* data, uint32_t length, uint32_t* out_length, MINIFLAC_SAMPLE_FORMAT format, void* samples, int32_t* scratch);
+
+/* same as miniflac_decode_interleaved, but with one buffer per channel.
+ * With MINIFLAC_SAMPLE_FLOAT32 the scaling is done in the same pass as
+ * the stereo decorrelation. With MINIFLAC_SAMPLE_INT16 and a stream of
+ * at most 16 bits per sample, scratch only needs room for block size
+ * int32_t samples. */
+MINIFLAC_API
+MINIFLAC_RESULT
+miniflac_decode_planar(miniflac_t* pFlac, const uint8_t* data, uint32_t length, uint32_t* out_length, MINIFLAC_SAMPLE_FORMAT format, void** samples, int32_t* scratch);
+
 
 /* functions to query the state without inspecting structs,
  * only valid to call after miniflac_sync returns MINIFLAC_OK */
@@ -410,6 +435,101 @@ MINIFLAC_API
 MINIFLAC_RESULT
 miniflac_seektable_samples(miniflac_t* pFlac, const uint8_t* data, uint32_t length, uint32_t* out_length, uint16_t* samples);
 
+/* read the seekpoints into a table, up to points_length of them.
+ * outlen is set to the number of seekpoints stored, including any
+ * placeholder points at the end of the table */
+MINIFLAC_API
+MINIFLAC_RESULT
+miniflac_seektable_points(miniflac_t* pFlac, const uint8_t* data, uint32_t length, uint32_t* out_length, miniflac_seekpoint_t* points, uint32_t points_length, uint32_t* outlen);
+
+/* prepare to seek a FLAC stream to a sample. Picks the nearest
+ * seekpoint at or before sample_number from points (which may be NULL),
+ * resets the decoder and sets offset to the byte position in the stream
+ * to continue reading from. The following decode skips frames until it
+ * reaches the target, and the frame it returns is cut down to start at
+ * exactly sample_number (frame.header.block_size is reduced to match).
+ * Decoding has to have reached the first audio frame before calling
+ * this.
+ *
+ * In an Ogg stream a seekpoint's sample_offset has to be the position of
+ * a page (found with miniflac_ogg_probe) minus frame_offset, and its
+ * sample_number the page's granule position - the offsets in a
+ * SEEKTABLE block can't be used. */
+MINIFLAC_API
+MINIFLAC_RESULT
+miniflac_seek(miniflac_t* pFlac, const miniflac_seekpoint_t* points, uint32_t points_length, uint64_t sample_number, uint64_t* offset);
+
+/* sync to the next audio frame (skipping the current one and any
+ * metadata) and describe it, for building a frame index with one
+ * entry per frame. Only the frame headers are parsed. Native FLAC
+ * streams only, offsets count from the start of the stream. */
+MINIFLAC_API
+MINIFLAC_RESULT
+miniflac_frameinfo(miniflac_t* pFlac, const uint8_t* data, uint32_t length, uint32_t* out_length, miniflac_frameinfo_t* info);
+
+/* find the entry of a frame index (built with miniflac_frameinfo) for
+ * the frame holding sample_number. Pass it to miniflac_seek as a
+ * seekpoint with sample_offset set to its offset minus frame_offset. */
+MINIFLAC_API
+uint32_t
+miniflac_frameinfo_find(const miniflac_frameinfo_t* index, uint32_t length, uint64_t sample_number);
+
+/* look for a frame header in data read from anywhere in a native FLAC
+ * stream, for seeking by bisection when there's no seektable. Headers
+ * need a valid crc8 and have to agree with the STREAMINFO block. On
+ * MINIFLAC_OK out_length is the position of the header in data, and
+ * sample_number and block_size describe its frame. Returns
+ * MINIFLAC_CONTINUE if there's no header, out_length is then the number
+ * of bytes that can be skipped - the rest may be the start of a header.
+ * The decoder's state isn't changed, pass what's found to miniflac_seek
+ * as a seekpoint. */
+MINIFLAC_API
+MINIFLAC_RESULT
+miniflac_seek_probe(miniflac_t* pFlac, const uint8_t* data, uint32_t length, uint32_t* out_length, uint64_t* sample_number, uint16_t* block_size);
+
+/* look for a page of the Ogg FLAC stream being decoded in data read from
+ * anywhere in the file, for seeking by bisection. Pages of other streams,
+ * and pages no frame ends on, are skipped. On MINIFLAC_OK out_length is
+ * the position of the page and granulepos is its granule position (the
+ * number of samples up to the end of the last frame that ends on it), or
+ * -1 if the page starts another stream - the next link of a chained
+ * file, so the stream being decoded has ended before it. Returns
+ * MINIFLAC_CONTINUE if there's no page, out_length is then the number of
+ * bytes that can be skipped. The decoder's state isn't changed. */
+MINIFLAC_API
+MINIFLAC_RESULT
+miniflac_ogg_probe(miniflac_t* pFlac, const uint8_t* data, uint32_t length, uint32_t* out_length, int64_t* granulepos);
+
+/* read the header of the Ogg page at the start of data, to split a
+ * multiplexed file into its logical streams. Each stream's pages can be
+ * fed to a decoder of its own, which picks the stream up from its first
+ * page (info->flac is set on the first page of a FLAC stream). Returns
+ * MINIFLAC_CONTINUE until the whole page is in data, and MINIFLAC_ERROR
+ * if data doesn't start with a page. The page's crc isn't checked here,
+ * the decoder it goes to checks it only when built with
+ * MINIFLAC_OGG_CRC32. */
+MINIFLAC_API
+MINIFLAC_RESULT
+miniflac_ogg_pageinfo(const uint8_t* data, uint32_t length, miniflac_ogg_pageinfo_t* info);
+
+/* start verifying decoded audio against the STREAMINFO MD5, before
+ * decoding the first frame */
+MINIFLAC_API
+void
+miniflac_verify_init(miniflac_md5_t* md5);
+
+/* hash the frame just decoded into samples with miniflac_decode */
+MINIFLAC_API
+void
+miniflac_verify_frame(miniflac_md5_t* md5, miniflac_t* pFlac, int32_t** samples);
+
+/* at the end of the stream, returns MINIFLAC_OK if everything hashed
+ * matches the STREAMINFO MD5, MINIFLAC_MD5_MISMATCH if it doesn't, or
+ * MINIFLAC_MD5_UNAVAILABLE if the encoder left the MD5 blank */
+MINIFLAC_API
+MINIFLAC_RESULT
+miniflac_verify_check(miniflac_md5_t* md5, miniflac_t* pFlac);
+
 /* read an application block's ID */
 MINIFLAC_API
 MINIFLAC_RESULT
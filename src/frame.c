@@ -1,5 +1,6 @@
 /* SPDX-License-Identifier: 0BSD */
 #include "frame.h"
+#include "cpu.h"
 #include <stddef.h>
 #include <assert.h>
 
@@ -9,18 +10,17 @@ miniflac_frame_init(miniflac_frame_t* frame) {
     frame->crc16 = 0;
     frame->cur_subframe = 0;
     frame->state = MINIFLAC_FRAME_HEADER;
+    frame->skip_len = 0;
+    frame->skip_crc16 = 0;
+    frame->skip_after = 0;
     miniflac_frame_header_init(&frame->header);
     miniflac_subframe_init(&frame->subframe);
 }
 
-MINIFLAC_PRIVATE
+/* fills in defaults from STREAMINFO once a header has been read */
+static
 MINIFLAC_RESULT
-miniflac_frame_sync(miniflac_frame_t* frame, miniflac_bitreader_t* br, miniflac_streaminfo_t* info) {
-    MINIFLAC_RESULT r;
-    assert(frame->state == MINIFLAC_FRAME_HEADER);
-    r = miniflac_frame_header_decode(&frame->header,br);
-    if(r != MINIFLAC_OK) return r;
-
+miniflac_frame_header_ready(miniflac_frame_t* frame, miniflac_streaminfo_t* info) {
     if(frame->header.sample_rate == 0) {
         if(info->sample_rate == 0) return MINIFLAC_FRAME_INVALID_SAMPLE_RATE;
         frame->header.sample_rate = info->sample_rate;
@@ -39,34 +39,573 @@ miniflac_frame_sync(miniflac_frame_t* frame, miniflac_bitreader_t* br, miniflac_
 
 MINIFLAC_PRIVATE
 MINIFLAC_RESULT
-miniflac_frame_decode(miniflac_frame_t* frame, miniflac_bitreader_t* br, miniflac_streaminfo_t* info, int32_t** output) {
+miniflac_frame_sync(miniflac_frame_t* frame, miniflac_bitreader_t* br, miniflac_streaminfo_t* info) {
+    MINIFLAC_RESULT r;
+    assert(frame->state == MINIFLAC_FRAME_HEADER);
+    r = miniflac_frame_header_decode(&frame->header,br);
+    if(r != MINIFLAC_OK) return r;
+
+    return miniflac_frame_header_ready(frame,info);
+}
+
+MINIFLAC_PRIVATE
+uint8_t
+miniflac_frame_header_fits(const miniflac_frame_header_t* header, const miniflac_streaminfo_t* info) {
+    if(header->bps != 0 && info->bps != 0 && header->bps != info->bps) return 0;
+    if(header->sample_rate != 0 && info->sample_rate != 0 && header->sample_rate != info->sample_rate) return 0;
+    if(info->max_block_size != 0 && header->block_size > info->max_block_size) return 0;
+    return 1;
+}
+
+/* The sync search returns the position of the first 0xFF that's
+ * followed by 0xF8 or 0xF9, or length if there isn't one. A 0xFF
+ * in the last byte counts too, since the next byte isn't known yet.
+ * The SIMD variants return where they stopped, the scalar loop
+ * picks up from there. */
+
+static
+uint32_t
+miniflac_frame_find_sync_scalar(const uint8_t* data, uint32_t start, uint32_t length) {
+    uint32_t i;
+    for(i = start; i < length; i++) {
+        if(data[i] == 0xFF && (i + 1 == length || (data[i + 1] & 0xFE) == 0xF8)) return i;
+    }
+    return length;
+}
+
+#if defined(MINIFLAC_SIMD_X86)
+static MINIFLAC_TARGET("sse2")
+uint32_t
+miniflac_frame_find_sync_sse2(const uint8_t* data, uint32_t start, uint32_t length) {
+    const __m128i ff = _mm_set1_epi8((char)0xFF);
+    const __m128i fe = _mm_set1_epi8((char)0xFE);
+    const __m128i f8 = _mm_set1_epi8((char)0xF8);
+    __m128i a, b;
+    uint32_t i = start;
+    int mask;
+
+    for(; i + 17 <= length; i += 16) {
+        a = _mm_loadu_si128((const __m128i*)&data[i]);
+        b = _mm_loadu_si128((const __m128i*)&data[i + 1]);
+        mask = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, ff), _mm_cmpeq_epi8(_mm_and_si128(b, fe), f8)));
+        if(mask != 0) return i + (uint32_t)__builtin_ctz((unsigned int)mask);
+    }
+    return i;
+}
+
+static MINIFLAC_TARGET("avx2")
+uint32_t
+miniflac_frame_find_sync_avx2(const uint8_t* data, uint32_t start, uint32_t length) {
+    const __m256i ff = _mm256_set1_epi8((char)0xFF);
+    const __m256i fe = _mm256_set1_epi8((char)0xFE);
+    const __m256i f8 = _mm256_set1_epi8((char)0xF8);
+    __m256i a, b;
+    uint32_t i = start;
+    unsigned int mask;
+
+    for(; i + 33 <= length; i += 32) {
+        a = _mm256_loadu_si256((const __m256i*)&data[i]);
+        b = _mm256_loadu_si256((const __m256i*)&data[i + 1]);
+        mask = (unsigned int)_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(a, ff), _mm256_cmpeq_epi8(_mm256_and_si256(b, fe), f8)));
+        if(mask != 0) return i + (uint32_t)__builtin_ctz(mask);
+    }
+    return i;
+}
+#endif
+
+#if defined(MINIFLAC_SIMD_NEON)
+static
+uint32_t
+miniflac_frame_find_sync_neon(const uint8_t* data, uint32_t start, uint32_t length) {
+    const uint8x16_t ff = vdupq_n_u8(0xFF);
+    const uint8x16_t fe = vdupq_n_u8(0xFE);
+    const uint8x16_t f8 = vdupq_n_u8(0xF8);
+    uint8x16_t a, b;
+    uint64x2_t m;
+    uint32_t i = start;
+
+    /* no movemask, stop at the block with a match and let the
+     * scalar loop find it */
+    for(; i + 17 <= length; i += 16) {
+        a = vld1q_u8(&data[i]);
+        b = vld1q_u8(&data[i + 1]);
+        m = vreinterpretq_u64_u8(vandq_u8(vceqq_u8(a, ff), vceqq_u8(vandq_u8(b, fe), f8)));
+        if((vgetq_lane_u64(m, 0) | vgetq_lane_u64(m, 1)) != 0) return i;
+    }
+    return i;
+}
+#endif
+
+static
+uint32_t
+miniflac_frame_find_sync(const uint8_t* data, uint32_t start, uint32_t length) {
+    uint32_t i = start;
+#if defined(MINIFLAC_SIMD_X86) || defined(MINIFLAC_SIMD_NEON)
+    uint32_t features = miniflac_cpu_features();
+#endif
+
+#if defined(MINIFLAC_SIMD_X86)
+    if(features & MINIFLAC_CPU_AVX2) {
+        i = miniflac_frame_find_sync_avx2(data,start,length);
+    } else if(features & MINIFLAC_CPU_SSE2) {
+        i = miniflac_frame_find_sync_sse2(data,start,length);
+    }
+#elif defined(MINIFLAC_SIMD_NEON)
+    if(features & MINIFLAC_CPU_NEON) {
+        i = miniflac_frame_find_sync_neon(data,start,length);
+    }
+#endif
+
+    return miniflac_frame_find_sync_scalar(data,i,length);
+}
+
+#ifndef MINIFLAC_NO_SKIP_CRC16
+/* the sample or frame number the header after this one should have */
+static
+uint64_t
+miniflac_frame_header_next(const miniflac_frame_header_t* header) {
+    if(header->blocking_strategy) {
+        return header->sample_number + header->block_size;
+    }
+    return header->sample_number + 1;
+}
+#endif
+
+/* decides whether the bytes in frame->skip start a frame header. On a
+ * match the header is decoded, the bytes after it are handed back to
+ * the bitreader and the crc is restarted as if it had been read the
+ * normal way. Otherwise it moves on to the next 0xFF in frame->skip,
+ * if there is one. Returns MINIFLAC_OK on a match, MINIFLAC_CONTINUE
+ * if more bytes are needed to tell, MINIFLAC_ERROR if the bytes
+ * weren't a header and MINIFLAC_FRAME_CRC16_INVALID if the skipped
+ * frame turned out to be damaged. */
+static
+MINIFLAC_RESULT
+miniflac_frame_skip_check(miniflac_frame_t* frame, miniflac_bitreader_t* br, miniflac_streaminfo_t* info) {
+    miniflac_frame_header_t header;
+    miniflac_bitreader_t hbr;
+    uint8_t i;
+    uint8_t rest;
+    int size;
+
+    while(frame->skip_len > 0) {
+        size = miniflac_frame_header_check(frame->skip,frame->skip_len);
+        if(size < 0) return MINIFLAC_CONTINUE;
+
+        rest = (uint8_t)(frame->skip_len - size);
+        if(size > 0 && br->bits + rest * 8 <= 64) {
+            miniflac_bitreader_init(&hbr);
+            hbr.buffer = frame->skip;
+            hbr.len = (uint32_t)size;
+            miniflac_frame_header_init(&header);
+            if(miniflac_frame_header_decode(&header,&hbr) != MINIFLAC_OK || !miniflac_frame_header_fits(&header,info)) {
+                size = 0;
+            }
+#ifndef MINIFLAC_NO_SKIP_CRC16
+            /* the skipped frame ends with its crc16, so the crc of
+             * everything up to a real header is 0 */
+            else if(frame->skip_crc16 != 0) {
+                if(header.blocking_strategy == frame->header.blocking_strategy) {
+                    /* a header numbered two after the skipped frame means
+                     * the one numbered right after it went by without
+                     * the crc coming out right: the frame is damaged.
+                     * Fail the way miniflac_frame_decode would have
+                     * rather than skipping on to the end of the stream. */
+                    if(frame->skip_after != 0 && header.sample_number == frame->skip_after) {
+                        miniflac_abort();
+                        return MINIFLAC_FRAME_CRC16_INVALID;
+                    }
+                    if(frame->skip_after == 0 && header.sample_number == miniflac_frame_header_next(&frame->header)) {
+                        frame->skip_after = miniflac_frame_header_next(&header);
+                    }
+                }
+                size = 0;
+            }
+#endif
+            if(size > 0) {
+                for(i = 0; i < rest; i++) {
+                    br->val |= ((uint64_t)frame->skip[size + i]) << (br->bits + (rest - 1 - i) * 8);
+                }
+                br->bits += rest * 8;
+                miniflac_bitreader_reset_crc(br);
+                br->crc16 = miniflac_bitreader_crc16(0,frame->skip,(uint32_t)size);
+                br->tot = (uint32_t)size;
+
+                frame->skip_len = 0;
+                frame->header = header;
+                return MINIFLAC_OK;
+            }
+        }
+
+        /* not a header, carry on from the next 0xFF */
+        for(i = 1; i < frame->skip_len && frame->skip[i] != 0xFF; i++);
+        frame->skip_crc16 = miniflac_bitreader_crc16(frame->skip_crc16,frame->skip,i);
+        frame->skip_len -= i;
+        for(rest = 0; rest < frame->skip_len; rest++) {
+            frame->skip[rest] = frame->skip[rest + i];
+        }
+    }
+    return MINIFLAC_ERROR;
+}
+
+MINIFLAC_PRIVATE
+MINIFLAC_RESULT
+miniflac_frame_skip(miniflac_frame_t* frame, miniflac_bitreader_t* br, miniflac_streaminfo_t* info) {
+    MINIFLAC_RESULT r;
+
+    if(frame->state != MINIFLAC_FRAME_SKIP) {
+        /* the rest of the current byte belongs to the skipped frame */
+        miniflac_bitreader_align(br);
+        frame->skip_len = 0;
+        frame->skip_after = 0;
+        frame->state = MINIFLAC_FRAME_SKIP;
+    }
+
+    for(;;) {
+        if(frame->skip_len > 0) {
+            r = miniflac_frame_skip_check(frame,br,info);
+            if(r == MINIFLAC_OK) return miniflac_frame_header_ready(frame,info);
+            if(r == MINIFLAC_FRAME_CRC16_INVALID) return r;
+            if(r == MINIFLAC_CONTINUE) {
+                /* needs another byte */
+                if(br->bits >= 8) {
+                    frame->skip[frame->skip_len++] = (uint8_t)miniflac_bitreader_read(br,8);
+                } else if(br->pos < br->len) {
+                    frame->skip[frame->skip_len++] = br->buffer[br->pos++];
+                } else {
+                    return MINIFLAC_CONTINUE;
+                }
+            }
+            continue;
+        }
+
+        /* bytes read ahead into the bitreader go one at a time */
+        if(br->bits >= 8) {
+            if(miniflac_bitreader_peek(br,8) == 0xFF) {
+                miniflac_bitreader_update_crc(br);
+                frame->skip_crc16 = br->crc16;
+                frame->skip[frame->skip_len++] = 0xFF;
+            }
+            miniflac_bitreader_discard(br,8);
+            continue;
+        }
+
+        br->pos = miniflac_frame_find_sync(br->buffer,br->pos,br->len);
+#ifdef MINIFLAC_NO_SKIP_CRC16
+        /* nothing skipped needs to be checksummed */
+        miniflac_bitreader_reset_crc(br);
+#endif
+        if(br->pos == br->len) return MINIFLAC_CONTINUE;
+
+        miniflac_bitreader_update_crc(br);
+        frame->skip_crc16 = br->crc16;
+        frame->skip[frame->skip_len++] = br->buffer[br->pos++];
+    }
+}
+
+static
+uint8_t
+miniflac_frame_subframe_bps(miniflac_frame_t* frame) {
+    uint8_t bps = frame->header.bps;
+    if(frame->header.channel_assignment == MINIFLAC_CHASSGN_LEFT_SIDE || frame->header.channel_assignment == MINIFLAC_CHASSGN_MID_SIDE) {
+        if(frame->cur_subframe == 1) bps += 1;
+    } else if(frame->header.channel_assignment == MINIFLAC_CHASSGN_RIGHT_SIDE) {
+        if(frame->cur_subframe == 0) bps += 1;
+    }
+    return bps;
+}
+
+/* the buffer the current subframe is decoded into. When packing,
+ * stereo frames keep both channels in scratch until the footer so they
+ * can be decorrelated and packed together, every other layout reuses
+ * the start of scratch for each channel. Narrow planar output is the
+ * exception, there the first channel of a pair is stored right away
+ * (see miniflac_output_stereo_narrow). */
+static
+int32_t*
+miniflac_frame_channel(miniflac_frame_t* frame, int32_t** output, const miniflac_output_t* packed) {
+    if(packed != NULL) {
+        if(frame->header.channels == 2 && frame->cur_subframe == 1 && !miniflac_output_narrow(packed,frame->header.bps)) {
+            return packed->scratch + frame->header.block_size;
+        }
+        return packed->scratch;
+    }
+    return output == NULL ? NULL : output[frame->cur_subframe];
+}
+
+/* packs the subframe that was just decoded, if it isn't waiting
+ * on its stereo pair */
+static
+void
+miniflac_frame_emit(miniflac_frame_t* frame, const miniflac_output_t* packed) {
+    if(packed == NULL) return;
+    if(frame->header.channels == 2) {
+        if(frame->cur_subframe == 1 || !miniflac_output_narrow(packed,frame->header.bps)) return;
+    }
+    miniflac_output_channel(packed,packed->scratch,frame->header.block_size,frame->header.bps,frame->cur_subframe,frame->header.channels);
+}
+
+/* decodes every subframe straight through when the rest of the frame
+ * should be in the buffer - either STREAMINFO's max_frame_size bytes
+ * are available, or enough for the frame to be stored verbatim.
+ * If we run out of data anyway (bad max_frame_size, or a frame that
+ * is larger than verbatim), the bitreader is rewound and
+ * MINIFLAC_CONTINUE is returned so the caller can fall back to the
+ * resumable decoder. */
+static
+MINIFLAC_RESULT
+miniflac_frame_decode_fast(miniflac_frame_t* frame, miniflac_bitreader_t* br, miniflac_streaminfo_t* info, int32_t** output, const miniflac_output_t* packed) {
     MINIFLAC_RESULT r;
-    uint32_t bps;
+    miniflac_bitreader_t saved;
+    uint32_t avail;
+    uint32_t need;
+
+    avail = br->len - br->pos + (br->bits >> 3);
+    need  = info->max_frame_size;
+    if(need == 0) {
+        need = ((((uint32_t)frame->header.block_size) * (frame->header.bps + 1) + 64) * frame->header.channels) / 8 + 2;
+    }
+    if(avail < need) return MINIFLAC_CONTINUE;
+
+    saved = *br;
+    while(frame->cur_subframe < frame->header.channels) {
+        r = miniflac_subframe_decode_fast(&frame->subframe,br,miniflac_frame_channel(frame,output,packed),frame->header.block_size,miniflac_frame_subframe_bps(frame));
+        if(r == MINIFLAC_CONTINUE) {
+            *br = saved;
+            miniflac_subframe_init(&frame->subframe);
+            frame->cur_subframe = 0;
+        }
+        if(r != MINIFLAC_OK) return r;
+        miniflac_frame_emit(frame,packed);
+        frame->cur_subframe++;
+    }
+
+    return MINIFLAC_OK;
+}
+
+/* Undoes the stereo decorrelation. For mid/side, with m the mid and s the
+ * side channel, the spec has left = ((m << 1 | (s & 1)) + s) >> 1 and
+ * right = ((m << 1 | (s & 1)) - s) >> 1, which needs 33 bits. The same
+ * values are left = m + (s >> 1) + (s & 1) and right = m - (s >> 1), where
+ * no intermediate is wider than the output samples. So every variant works
+ * in 32-bit lanes, and on a corrupt stream it wraps the same way a 64-bit
+ * version would truncate. */
+
+static
+void
+miniflac_frame_decorrelate_scalar(MINIFLAC_CHASSGN assignment, int32_t* left, int32_t* right, uint32_t start, uint32_t block_size) {
     uint32_t i;
-    uint64_t m,s;
+    uint32_t m,s;
+
+    switch(assignment) {
+        case MINIFLAC_CHASSGN_LEFT_SIDE: {
+            for(i = start; i < block_size; i++) {
+                right[i] = (int32_t)((uint32_t)left[i] - (uint32_t)right[i]);
+            }
+            break;
+        }
+        case MINIFLAC_CHASSGN_RIGHT_SIDE: {
+            for(i = start; i < block_size; i++) {
+                left[i] = (int32_t)((uint32_t)left[i] + (uint32_t)right[i]);
+            }
+            break;
+        }
+        case MINIFLAC_CHASSGN_MID_SIDE: {
+            for(i = start; i < block_size; i++) {
+                m = (uint32_t)left[i];
+                s = (uint32_t)(right[i] >> 1);
+                left[i]  = (int32_t)(m + s + ((uint32_t)right[i] & 1));
+                right[i] = (int32_t)(m - s);
+            }
+            break;
+        }
+        default: break;
+    }
+}
+
+/* the SIMD variants handle whole vectors and return how many samples
+ * they did, the scalar loop finishes the rest */
+
+#if defined(MINIFLAC_SIMD_X86)
+static MINIFLAC_TARGET("sse2")
+uint32_t
+miniflac_frame_decorrelate_sse2(MINIFLAC_CHASSGN assignment, int32_t* left, int32_t* right, uint32_t block_size) {
+    __m128i l, r, s;
+    const __m128i one = _mm_set1_epi32(1);
+    uint32_t i = 0;
+
+    switch(assignment) {
+        case MINIFLAC_CHASSGN_LEFT_SIDE: {
+            for(; i + 4 <= block_size; i += 4) {
+                l = _mm_loadu_si128((const __m128i*)&left[i]);
+                r = _mm_loadu_si128((const __m128i*)&right[i]);
+                _mm_storeu_si128((__m128i*)&right[i], _mm_sub_epi32(l, r));
+            }
+            break;
+        }
+        case MINIFLAC_CHASSGN_RIGHT_SIDE: {
+            for(; i + 4 <= block_size; i += 4) {
+                l = _mm_loadu_si128((const __m128i*)&left[i]);
+                r = _mm_loadu_si128((const __m128i*)&right[i]);
+                _mm_storeu_si128((__m128i*)&left[i], _mm_add_epi32(l, r));
+            }
+            break;
+        }
+        case MINIFLAC_CHASSGN_MID_SIDE: {
+            for(; i + 4 <= block_size; i += 4) {
+                l = _mm_loadu_si128((const __m128i*)&left[i]);
+                r = _mm_loadu_si128((const __m128i*)&right[i]);
+                s = _mm_srai_epi32(r, 1);
+                _mm_storeu_si128((__m128i*)&left[i], _mm_add_epi32(_mm_add_epi32(l, s), _mm_and_si128(r, one)));
+                _mm_storeu_si128((__m128i*)&right[i], _mm_sub_epi32(l, s));
+            }
+            break;
+        }
+        default: break;
+    }
+    return i;
+}
+
+static MINIFLAC_TARGET("avx2")
+uint32_t
+miniflac_frame_decorrelate_avx2(MINIFLAC_CHASSGN assignment, int32_t* left, int32_t* right, uint32_t block_size) {
+    __m256i l, r, s;
+    const __m256i one = _mm256_set1_epi32(1);
+    uint32_t i = 0;
+
+    switch(assignment) {
+        case MINIFLAC_CHASSGN_LEFT_SIDE: {
+            for(; i + 8 <= block_size; i += 8) {
+                l = _mm256_loadu_si256((const __m256i*)&left[i]);
+                r = _mm256_loadu_si256((const __m256i*)&right[i]);
+                _mm256_storeu_si256((__m256i*)&right[i], _mm256_sub_epi32(l, r));
+            }
+            break;
+        }
+        case MINIFLAC_CHASSGN_RIGHT_SIDE: {
+            for(; i + 8 <= block_size; i += 8) {
+                l = _mm256_loadu_si256((const __m256i*)&left[i]);
+                r = _mm256_loadu_si256((const __m256i*)&right[i]);
+                _mm256_storeu_si256((__m256i*)&left[i], _mm256_add_epi32(l, r));
+            }
+            break;
+        }
+        case MINIFLAC_CHASSGN_MID_SIDE: {
+            for(; i + 8 <= block_size; i += 8) {
+                l = _mm256_loadu_si256((const __m256i*)&left[i]);
+                r = _mm256_loadu_si256((const __m256i*)&right[i]);
+                s = _mm256_srai_epi32(r, 1);
+                _mm256_storeu_si256((__m256i*)&left[i], _mm256_add_epi32(_mm256_add_epi32(l, s), _mm256_and_si256(r, one)));
+                _mm256_storeu_si256((__m256i*)&right[i], _mm256_sub_epi32(l, s));
+            }
+            break;
+        }
+        default: break;
+    }
+    return i;
+}
+#endif
+
+#if defined(MINIFLAC_SIMD_NEON)
+static
+uint32_t
+miniflac_frame_decorrelate_neon(MINIFLAC_CHASSGN assignment, int32_t* left, int32_t* right, uint32_t block_size) {
+    int32x4_t l, r, s;
+    const int32x4_t one = vdupq_n_s32(1);
+    uint32_t i = 0;
+
+    switch(assignment) {
+        case MINIFLAC_CHASSGN_LEFT_SIDE: {
+            for(; i + 4 <= block_size; i += 4) {
+                l = vld1q_s32(&left[i]);
+                r = vld1q_s32(&right[i]);
+                vst1q_s32(&right[i], vsubq_s32(l, r));
+            }
+            break;
+        }
+        case MINIFLAC_CHASSGN_RIGHT_SIDE: {
+            for(; i + 4 <= block_size; i += 4) {
+                l = vld1q_s32(&left[i]);
+                r = vld1q_s32(&right[i]);
+                vst1q_s32(&left[i], vaddq_s32(l, r));
+            }
+            break;
+        }
+        case MINIFLAC_CHASSGN_MID_SIDE: {
+            for(; i + 4 <= block_size; i += 4) {
+                l = vld1q_s32(&left[i]);
+                r = vld1q_s32(&right[i]);
+                s = vshrq_n_s32(r, 1);
+                vst1q_s32(&left[i], vaddq_s32(vaddq_s32(l, s), vandq_s32(r, one)));
+                vst1q_s32(&right[i], vsubq_s32(l, s));
+            }
+            break;
+        }
+        default: break;
+    }
+    return i;
+}
+#endif
+
+static
+void
+miniflac_frame_decorrelate(MINIFLAC_CHASSGN assignment, int32_t* left, int32_t* right, uint32_t block_size) {
+    uint32_t i = 0;
+#if defined(MINIFLAC_SIMD_X86) || defined(MINIFLAC_SIMD_NEON)
+    uint32_t features = miniflac_cpu_features();
+#endif
+
+#if defined(MINIFLAC_SIMD_X86)
+    if(features & MINIFLAC_CPU_AVX2) {
+        i = miniflac_frame_decorrelate_avx2(assignment,left,right,block_size);
+    } else if(features & MINIFLAC_CPU_SSE2) {
+        i = miniflac_frame_decorrelate_sse2(assignment,left,right,block_size);
+    }
+#elif defined(MINIFLAC_SIMD_NEON)
+    if(features & MINIFLAC_CPU_NEON) {
+        i = miniflac_frame_decorrelate_neon(assignment,left,right,block_size);
+    }
+#endif
+
+    miniflac_frame_decorrelate_scalar(assignment,left,right,i,block_size);
+}
+
+MINIFLAC_PRIVATE
+MINIFLAC_RESULT
+miniflac_frame_decode(miniflac_frame_t* frame, miniflac_bitreader_t* br, miniflac_streaminfo_t* info, int32_t** output, const miniflac_output_t* packed) {
+    MINIFLAC_RESULT r;
+    uint8_t bps;
     uint16_t t;
     switch(frame->state) {
+        case MINIFLAC_FRAME_SKIP: {
+            r = miniflac_frame_skip(frame,br,info);
+            if(r != MINIFLAC_OK) return r;
+            goto miniflac_frame_decode_subframe;
+        }
         case MINIFLAC_FRAME_HEADER: {
             r = miniflac_frame_sync(frame,br,info);
             if(r != MINIFLAC_OK) return r;
         }
         /* fall-through */
         case MINIFLAC_FRAME_SUBFRAME: {
+            miniflac_frame_decode_subframe:
+            if((output != NULL || packed != NULL) && frame->cur_subframe == 0 && frame->subframe.state == MINIFLAC_SUBFRAME_HEADER && frame->subframe.header.state == MINIFLAC_SUBFRAME_HEADER_RESERVEBIT1) {
+                r = miniflac_frame_decode_fast(frame,br,info,output,packed);
+                if(r < MINIFLAC_CONTINUE) return r;
+            }
+
             while(frame->cur_subframe < frame->header.channels) {
-                bps = frame->header.bps;
-                if(frame->header.channel_assignment == MINIFLAC_CHASSGN_LEFT_SIDE || frame->header.channel_assignment == MINIFLAC_CHASSGN_MID_SIDE) {
-                    if(frame->cur_subframe == 1) bps += 1;
-                } else if(frame->header.channel_assignment == MINIFLAC_CHASSGN_RIGHT_SIDE) {
-                    if(frame->cur_subframe == 0) bps += 1;
-                }
-                r = miniflac_subframe_decode(&frame->subframe,br,output == NULL ? NULL : output[frame->cur_subframe],frame->header.block_size,bps);
+                bps = miniflac_frame_subframe_bps(frame);
+                r = miniflac_subframe_decode(&frame->subframe,br,miniflac_frame_channel(frame,output,packed),frame->header.block_size,bps);
                 if(r != MINIFLAC_OK) return r;
+                miniflac_frame_emit(frame,packed);
 
                 miniflac_subframe_init(&frame->subframe);
                 frame->cur_subframe++;
             }
 
             miniflac_bitreader_align(br);
+            miniflac_bitreader_update_crc(br);
             frame->crc16 = br->crc16;
             frame->state = MINIFLAC_FRAME_FOOTER;
         }
@@ -78,33 +617,16 @@ miniflac_frame_decode(miniflac_frame_t* frame, miniflac_bitreader_t* br, minifla
                 miniflac_abort();
                 return MINIFLAC_FRAME_CRC16_INVALID;
             }
+            miniflac_bitreader_update_crc(br);
             frame->size = br->tot;
-            if(output != NULL) {
-                switch(frame->header.channel_assignment) {
-                    case MINIFLAC_CHASSGN_LEFT_SIDE: {
-                        for(i=0;i<frame->header.block_size;i++) {
-                            output[1][i] = output[0][i] - output[1][i];
-                        }
-                        break;
-                    }
-                    case MINIFLAC_CHASSGN_RIGHT_SIDE: {
-                        for(i=0;i<frame->header.block_size;i++) {
-                            output[0][i] = output[0][i] + output[1][i];
-                        }
-                        break;
-                    }
-                    case MINIFLAC_CHASSGN_MID_SIDE: {
-                        for(i=0;i<frame->header.block_size;i++) {
-                            m = (uint64_t)output[0][i];
-                            s = (uint64_t)output[1][i];
-                            m = (m << 1) | (s & 0x01);
-                            output[0][i] = (int32_t)((m + s) >> 1 );
-                            output[1][i] = (int32_t)((m - s) >> 1 );
-                        }
-                        break;
-                    }
-                    default: break;
+            if(packed != NULL && frame->header.channels == 2) {
+                if(miniflac_output_narrow(packed,frame->header.bps)) {
+                    miniflac_output_stereo_narrow(packed,frame->header.channel_assignment,packed->scratch,frame->header.block_size,frame->header.bps);
+                } else {
+                    miniflac_output_stereo(packed,frame->header.channel_assignment,packed->scratch,packed->scratch + frame->header.block_size,frame->header.block_size,frame->header.bps);
                 }
+            } else if(output != NULL && frame->header.channel_assignment != MINIFLAC_CHASSGN_NONE) {
+                miniflac_frame_decorrelate(frame->header.channel_assignment,output[0],output[1],frame->header.block_size);
             }
             break;
         }
@@ -115,9 +637,7 @@ miniflac_frame_decode(miniflac_frame_t* frame, miniflac_bitreader_t* br, minifla
         }
     }
 
-    assert(br->bits == 0);
-    br->crc8 = 0;
-    br->crc16 = 0;
+    miniflac_bitreader_reset_crc(br);
     frame->cur_subframe = 0;
     frame->state = MINIFLAC_FRAME_HEADER;
     miniflac_subframe_init(&frame->subframe);
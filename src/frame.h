@@ -10,11 +10,13 @@
 #include "streaminfo.h"
 #include "frameheader.h"
 #include "subframe.h"
+#include "output.h"
 
 enum MINIFLAC_FRAME_STATE {
     MINIFLAC_FRAME_HEADER,
     MINIFLAC_FRAME_SUBFRAME,
     MINIFLAC_FRAME_FOOTER,
+    MINIFLAC_FRAME_SKIP,
 };
 
 /* represents an audio frame including parsed header */
@@ -25,9 +27,22 @@ struct miniflac_frame_s {
     size_t size; /* size of the frame, in bytes, only valid after decode */
     struct miniflac_frame_header_s header;
     struct miniflac_subframe_s subframe;
+    uint8_t skip[16]; /* possible frame header found while skipping */
+    uint8_t skip_len;
+    uint16_t skip_crc16; /* crc16 of the skipped frame up to skip[0] */
+    uint64_t skip_after; /* number due two headers on, 0 until the next one turns up */
+};
+
+/* one entry of a frame index, see miniflac_frameinfo */
+struct miniflac_frameinfo_s {
+    uint64_t offset; /* byte offset of the frame header in the stream */
+    uint64_t sample_number; /* first sample of the frame */
+    uint16_t block_size;
+    uint8_t header_size;
 };
 
 typedef struct miniflac_frame_s miniflac_frame_t;
+typedef struct miniflac_frameinfo_s miniflac_frameinfo_t;
 typedef enum MINIFLAC_FRAME_STATE MINIFLAC_FRAME_STATE;
 
 #ifdef __cplusplus
@@ -41,8 +56,21 @@ void miniflac_frame_init(miniflac_frame_t* frame);
 MINIFLAC_PRIVATE
 MINIFLAC_RESULT miniflac_frame_sync(miniflac_frame_t* frame, miniflac_bitreader_t* br, miniflac_streaminfo_t* info);
 
+/* true if a frame header agrees with STREAMINFO, for weeding out
+ * false syncs */
+MINIFLAC_PRIVATE
+uint8_t miniflac_frame_header_fits(const miniflac_frame_header_t* header, const miniflac_streaminfo_t* info);
+
+/* skips the rest of the current frame without decoding it, by looking
+ * for the next frame header. Stops with that header read, like
+ * miniflac_frame_sync. */
+MINIFLAC_PRIVATE
+MINIFLAC_RESULT miniflac_frame_skip(miniflac_frame_t* frame, miniflac_bitreader_t* br, miniflac_streaminfo_t* info);
+
+/* decodes into either output (one int32_t buffer per channel) or packed,
+ * at most one should be non-NULL. With both NULL the frame is skipped. */
 MINIFLAC_PRIVATE
-MINIFLAC_RESULT miniflac_frame_decode(miniflac_frame_t* frame, miniflac_bitreader_t* br, miniflac_streaminfo_t* info, int32_t** output);
+MINIFLAC_RESULT miniflac_frame_decode(miniflac_frame_t* frame, miniflac_bitreader_t* br, miniflac_streaminfo_t* info, int32_t** output, const miniflac_output_t* packed);
 
 #ifdef __cplusplus
 }
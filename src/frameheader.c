@@ -398,7 +398,8 @@ miniflac_frame_header_decode(miniflac_frame_header_t* header, miniflac_bitreader
                 default: break;
             }
 
-            /* grab crc8 from bitreader before fill */
+            /* grab crc8 from bitreader before reading the crc byte */
+            miniflac_bitreader_update_crc(br);
             header->crc8 = br->crc8;
             header->state = MINIFLAC_FRAME_HEADER_CRC8;
         }
@@ -420,3 +421,50 @@ miniflac_frame_header_decode(miniflac_frame_header_t* header, miniflac_bitreader
     return MINIFLAC_OK;
 }
 
+MINIFLAC_PRIVATE
+int
+miniflac_frame_header_check(const uint8_t* data, uint32_t length) {
+    uint32_t size = 6; /* sync code, 2 bytes of codes, first sample number byte, crc8 */
+    uint32_t extra = 0;
+    uint32_t i;
+    uint8_t t;
+
+    if(length < 2) return length == 0 || data[0] == 0xFF ? -1 : 0;
+    if(data[0] != 0xFF || (data[1] & 0xFE) != 0xF8) return 0;
+    if(length < 5) return -1;
+
+    /* reserved block size and sample rate */
+    if((data[2] >> 4) == 0 || (data[2] & 0x0F) == 0x0F) return 0;
+    /* reserved channel assignment, sample size and bit */
+    if((data[3] >> 4) > 10 || ((data[3] >> 1) & 0x03) == 0x03 || (data[3] & 0x01)) return 0;
+
+    t = data[4];
+    if((t & 0x80) == 0x00) extra = 0;
+    else if((t & 0xE0) == 0xC0) extra = 1;
+    else if((t & 0xF0) == 0xE0) extra = 2;
+    else if((t & 0xF8) == 0xF0) extra = 3;
+    else if((t & 0xFC) == 0xF8) extra = 4;
+    else if((t & 0xFE) == 0xFC) extra = 5;
+    else if(t == 0xFE) extra = 6;
+    else return 0;
+    size += extra;
+
+    switch(data[2] >> 4) {
+        case 6: size += 1; break;
+        case 7: size += 2; break;
+        default: break;
+    }
+    switch(data[2] & 0x0F) {
+        case 12: size += 1; break;
+        case 13: /* fall-through */
+        case 14: size += 2; break;
+        default: break;
+    }
+
+    if(length < size) return -1;
+    for(i = 0; i < extra; i++) {
+        if((data[5 + i] & 0xC0) != 0x80) return 0;
+    }
+    if(miniflac_bitreader_crc8(data,size - 1) != data[size - 1]) return 0;
+    return (int)size;
+}
@@ -70,6 +70,13 @@ miniflac_frame_header_init(miniflac_frame_header_t* frame_header);
 MINIFLAC_PRIVATE
 MINIFLAC_RESULT miniflac_frame_header_decode(miniflac_frame_header_t* frame_header, miniflac_bitreader_t* br);
 
+/* checks if data starts with a frame header, for resyncing in the
+ * middle of a stream. Returns the header size if the reserved values
+ * and crc8 check out, 0 if it's not a header, -1 if length is too
+ * short to tell */
+MINIFLAC_PRIVATE
+int miniflac_frame_header_check(const uint8_t* data, uint32_t length);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,187 @@
+/* SPDX-License-Identifier: 0BSD */
+#include "md5.h"
+
+#define MINIFLAC_MD5_R1(x,y,z) ((z) ^ ((x) & ((y) ^ (z))))
+#define MINIFLAC_MD5_R2(x,y,z) ((y) ^ ((z) & ((x) ^ (y))))
+#define MINIFLAC_MD5_R3(x,y,z) ((x) ^ (y) ^ (z))
+#define MINIFLAC_MD5_R4(x,y,z) ((y) ^ ((x) | ~(z)))
+
+#define MINIFLAC_MD5_STEP(f,a,b,c,d,x,t,s) \
+    (a) += f((b),(c),(d)) + (x) + (uint32_t)(t); \
+    (a) = ((a) << (s)) | ((a) >> (32 - (s))); \
+    (a) += (b);
+
+static
+void
+miniflac_md5_compress(uint32_t* state, const uint32_t* x) {
+    uint32_t a = state[0];
+    uint32_t b = state[1];
+    uint32_t c = state[2];
+    uint32_t d = state[3];
+
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R1, a, b, c, d, x[ 0], 0xd76aa478,  7)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R1, d, a, b, c, x[ 1], 0xe8c7b756, 12)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R1, c, d, a, b, x[ 2], 0x242070db, 17)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R1, b, c, d, a, x[ 3], 0xc1bdceee, 22)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R1, a, b, c, d, x[ 4], 0xf57c0faf,  7)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R1, d, a, b, c, x[ 5], 0x4787c62a, 12)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R1, c, d, a, b, x[ 6], 0xa8304613, 17)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R1, b, c, d, a, x[ 7], 0xfd469501, 22)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R1, a, b, c, d, x[ 8], 0x698098d8,  7)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R1, d, a, b, c, x[ 9], 0x8b44f7af, 12)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R1, c, d, a, b, x[10], 0xffff5bb1, 17)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R1, b, c, d, a, x[11], 0x895cd7be, 22)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R1, a, b, c, d, x[12], 0x6b901122,  7)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R1, d, a, b, c, x[13], 0xfd987193, 12)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R1, c, d, a, b, x[14], 0xa679438e, 17)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R1, b, c, d, a, x[15], 0x49b40821, 22)
+
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R2, a, b, c, d, x[ 1], 0xf61e2562,  5)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R2, d, a, b, c, x[ 6], 0xc040b340,  9)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R2, c, d, a, b, x[11], 0x265e5a51, 14)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R2, b, c, d, a, x[ 0], 0xe9b6c7aa, 20)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R2, a, b, c, d, x[ 5], 0xd62f105d,  5)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R2, d, a, b, c, x[10], 0x02441453,  9)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R2, c, d, a, b, x[15], 0xd8a1e681, 14)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R2, b, c, d, a, x[ 4], 0xe7d3fbc8, 20)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R2, a, b, c, d, x[ 9], 0x21e1cde6,  5)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R2, d, a, b, c, x[14], 0xc33707d6,  9)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R2, c, d, a, b, x[ 3], 0xf4d50d87, 14)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R2, b, c, d, a, x[ 8], 0x455a14ed, 20)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R2, a, b, c, d, x[13], 0xa9e3e905,  5)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R2, d, a, b, c, x[ 2], 0xfcefa3f8,  9)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R2, c, d, a, b, x[ 7], 0x676f02d9, 14)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R2, b, c, d, a, x[12], 0x8d2a4c8a, 20)
+
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R3, a, b, c, d, x[ 5], 0xfffa3942,  4)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R3, d, a, b, c, x[ 8], 0x8771f681, 11)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R3, c, d, a, b, x[11], 0x6d9d6122, 16)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R3, b, c, d, a, x[14], 0xfde5380c, 23)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R3, a, b, c, d, x[ 1], 0xa4beea44,  4)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R3, d, a, b, c, x[ 4], 0x4bdecfa9, 11)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R3, c, d, a, b, x[ 7], 0xf6bb4b60, 16)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R3, b, c, d, a, x[10], 0xbebfbc70, 23)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R3, a, b, c, d, x[13], 0x289b7ec6,  4)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R3, d, a, b, c, x[ 0], 0xeaa127fa, 11)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R3, c, d, a, b, x[ 3], 0xd4ef3085, 16)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R3, b, c, d, a, x[ 6], 0x04881d05, 23)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R3, a, b, c, d, x[ 9], 0xd9d4d039,  4)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R3, d, a, b, c, x[12], 0xe6db99e5, 11)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R3, c, d, a, b, x[15], 0x1fa27cf8, 16)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R3, b, c, d, a, x[ 2], 0xc4ac5665, 23)
+
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R4, a, b, c, d, x[ 0], 0xf4292244,  6)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R4, d, a, b, c, x[ 7], 0x432aff97, 10)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R4, c, d, a, b, x[14], 0xab9423a7, 15)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R4, b, c, d, a, x[ 5], 0xfc93a039, 21)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R4, a, b, c, d, x[12], 0x655b59c3,  6)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R4, d, a, b, c, x[ 3], 0x8f0ccc92, 10)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R4, c, d, a, b, x[10], 0xffeff47d, 15)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R4, b, c, d, a, x[ 1], 0x85845dd1, 21)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R4, a, b, c, d, x[ 8], 0x6fa87e4f,  6)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R4, d, a, b, c, x[15], 0xfe2ce6e0, 10)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R4, c, d, a, b, x[ 6], 0xa3014314, 15)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R4, b, c, d, a, x[13], 0x4e0811a1, 21)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R4, a, b, c, d, x[ 4], 0xf7537e82,  6)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R4, d, a, b, c, x[11], 0xbd3af235, 10)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R4, c, d, a, b, x[ 2], 0x2ad7d2bb, 15)
+    MINIFLAC_MD5_STEP(MINIFLAC_MD5_R4, b, c, d, a, x[ 9], 0xeb86d391, 21)
+
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+}
+
+MINIFLAC_PRIVATE
+void
+miniflac_md5_init(miniflac_md5_t* md5) {
+    md5->state[0] = 0x67452301;
+    md5->state[1] = 0xefcdab89;
+    md5->state[2] = 0x98badcfe;
+    md5->state[3] = 0x10325476;
+    md5->length = 0;
+    md5->acc = 0;
+    md5->acc_bits = 0;
+    md5->words = 0;
+}
+
+static
+void
+miniflac_md5_word(miniflac_md5_t* md5, uint32_t word) {
+    md5->block[md5->words++] = word;
+    if(md5->words == 16) {
+        miniflac_md5_compress(md5->state,md5->block);
+        md5->words = 0;
+    }
+}
+
+/* MD5 reads its input as little-endian words, so packing each sample
+ * into the low end of acc and taking 32 bits at a time builds the
+ * words in the right order on any host, without an interleaved byte
+ * buffer in between */
+MINIFLAC_PRIVATE
+void
+miniflac_md5_samples(miniflac_md5_t* md5, int32_t** samples, uint8_t channels, uint32_t block_size, uint8_t bps) {
+    uint8_t bits = (uint8_t)(((bps + 7) / 8) * 8);
+    uint32_t mask = bits == 32 ? 0xFFFFFFFF : ((uint32_t)1 << bits) - 1;
+    uint64_t acc = md5->acc;
+    uint8_t acc_bits = md5->acc_bits;
+    uint32_t i = 0;
+    uint8_t c;
+
+    md5->length += (uint64_t)block_size * channels * (bits / 8);
+
+    /* 16-bit stereo is one word per sample, whole blocks are packed
+     * and compressed without going through miniflac_md5_word */
+    if(bits == 16 && channels == 2 && acc_bits == 0) {
+        while(md5->words != 0 && i < block_size) {
+            miniflac_md5_word(md5,((uint32_t)samples[0][i] & 0xFFFF) | ((uint32_t)samples[1][i] << 16));
+            i++;
+        }
+        for(; i + 16 <= block_size; i += 16) {
+            for(c = 0; c < 16; c++) {
+                md5->block[c] = ((uint32_t)samples[0][i + c] & 0xFFFF) | ((uint32_t)samples[1][i + c] << 16);
+            }
+            miniflac_md5_compress(md5->state,md5->block);
+        }
+    }
+
+    for(; i < block_size; i++) {
+        for(c = 0; c < channels; c++) {
+            acc |= ((uint64_t)((uint32_t)samples[c][i] & mask)) << acc_bits;
+            acc_bits += bits;
+            if(acc_bits >= 32) {
+                miniflac_md5_word(md5,(uint32_t)acc);
+                acc >>= 32;
+                acc_bits -= 32;
+            }
+        }
+    }
+
+    md5->acc = acc;
+    md5->acc_bits = acc_bits;
+}
+
+MINIFLAC_PRIVATE
+void
+miniflac_md5_final(miniflac_md5_t* md5, uint8_t* digest) {
+    uint64_t length = md5->length * 8;
+    uint8_t i;
+
+    /* a single 1 bit, then zeros up to the length */
+    md5->acc |= ((uint64_t)0x80) << md5->acc_bits;
+    miniflac_md5_word(md5,(uint32_t)md5->acc);
+    md5->acc = 0;
+    md5->acc_bits = 0;
+
+    while(md5->words != 14) {
+        miniflac_md5_word(md5,0);
+    }
+    miniflac_md5_word(md5,(uint32_t)length);
+    miniflac_md5_word(md5,(uint32_t)(length >> 32));
+
+    for(i = 0; i < 16; i++) {
+        digest[i] = (uint8_t)(md5->state[i / 4] >> ((i % 4) * 8));
+    }
+}
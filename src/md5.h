@@ -0,0 +1,45 @@
+/* SPDX-License-Identifier: 0BSD */
+#ifndef MINIFLAC_MD5_H
+#define MINIFLAC_MD5_H
+
+#include <stdint.h>
+
+#include "common.h"
+
+/* running MD5 of decoded audio, see miniflac_verify_init. Samples are
+ * packed straight into the 32-bit words of the current block, acc
+ * holds the bytes that don't make up a whole word yet. */
+struct miniflac_md5_s {
+    uint32_t state[4];
+    uint32_t block[16];
+    uint64_t length; /* bytes hashed so far */
+    uint64_t acc;
+    uint8_t acc_bits;
+    uint8_t words; /* whole words in block */
+};
+
+typedef struct miniflac_md5_s miniflac_md5_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+MINIFLAC_PRIVATE
+void
+miniflac_md5_init(miniflac_md5_t* md5);
+
+/* hashes a block of samples as interleaved, little-endian integers of
+ * (bps + 7) / 8 bytes - the layout the STREAMINFO MD5 is taken over */
+MINIFLAC_PRIVATE
+void
+miniflac_md5_samples(miniflac_md5_t* md5, int32_t** samples, uint8_t channels, uint32_t block_size, uint8_t bps);
+
+MINIFLAC_PRIVATE
+void
+miniflac_md5_final(miniflac_md5_t* md5, uint8_t* digest);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
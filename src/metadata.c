@@ -137,9 +137,7 @@ miniflac_metadata_decode(miniflac_metadata_t* metadata, miniflac_bitreader_t* br
 
     if(r != MINIFLAC_OK) return r;
 
-    assert(br->bits == 0);
-    br->crc8  = 0;
-    br->crc16 = 0;
+    miniflac_bitreader_reset_crc(br);
     metadata->state = MINIFLAC_METADATA_HEADER;
     metadata->pos   = 0;
     return MINIFLAC_OK;
@@ -2,6 +2,9 @@
 
 #define MFLAC_PASTE(a,b) a ## b
 
+/* a few of the largest possible Ogg pages */
+#define MFLAC_OGG_SCAN_LIMIT (4 * 65307)
+
 #define MFLAC_FUNC_BODY(a) \
     while( (res = a) == MINIFLAC_CONTINUE ) { \
         received = m->read(m->buffer, MFLAC_BUFFER_SIZE, m->userdata); \
@@ -47,6 +50,7 @@ void
 mflac_init(mflac_t* m, MINIFLAC_CONTAINER container, mflac_readcb read, void *userdata) {
     miniflac_init(&m->flac, container);
     m->read = read;
+    m->seek = NULL;
     m->userdata = userdata;
     m->bufpos = 0;
     m->buflen = 0;
@@ -60,10 +64,222 @@ mflac_reset(mflac_t* m, MINIFLAC_STATE state) {
     m->buflen = 0;
 }
 
+MINIFLAC_API
+void
+mflac_set_seek(mflac_t* m, mflac_seekcb seek) {
+    m->seek = seek;
+}
+
 MFLAC_GET0_FUNC(sync)
 
+/* seekpoints are relative to the first frame, so it has to have been found */
+static
+MFLAC_RESULT
+mflac_seek_prepare(mflac_t* m) {
+    MFLAC_RESULT res;
+
+    if(m->seek == NULL) return (MFLAC_RESULT)MINIFLAC_ERROR;
+
+    while(!m->flac.frame_offset_set) {
+        res = mflac_sync(m);
+        if(res != MFLAC_OK) return res;
+    }
+    return MFLAC_OK;
+}
+
+/* reads from offset until miniflac_seek_probe finds a frame header,
+ * returns MFLAC_EOF if there isn't one before limit */
+static
+MFLAC_RESULT
+mflac_seek_scan(mflac_t* m, uint64_t offset, uint64_t limit, uint64_t* header_offset, uint64_t* sample_number, uint16_t* block_size) {
+    MINIFLAC_RESULT r;
+    uint32_t used;
+    size_t received;
+    size_t i;
+
+    if(m->seek(offset,m->userdata) != 0) return (MFLAC_RESULT)MINIFLAC_ERROR;
+    m->bufpos = 0;
+    m->buflen = 0;
+
+    while(offset < limit) {
+        /* keep the bytes that may be the start of a header */
+        for(i = 0; i < m->buflen; i++) {
+            m->buffer[i] = m->buffer[m->bufpos + i];
+        }
+        m->bufpos = 0;
+
+        received = m->read(&m->buffer[m->buflen], MFLAC_BUFFER_SIZE - m->buflen, m->userdata);
+        if(received == 0) break;
+        m->buflen += received;
+
+        r = miniflac_seek_probe(&m->flac,m->buffer,(uint32_t)m->buflen,&used,sample_number,block_size);
+        if(r == MINIFLAC_OK) {
+            *header_offset = offset + used;
+            return *header_offset < limit ? MFLAC_OK : MFLAC_EOF;
+        }
+        if(r != MINIFLAC_CONTINUE) return (MFLAC_RESULT)r;
+
+        offset += used;
+        m->bufpos = used;
+        m->buflen -= used;
+    }
+    return MFLAC_EOF;
+}
+
+/* the Ogg version of mflac_seek_scan, reads from offset until
+ * miniflac_ogg_probe finds a page of the stream */
+static
+MFLAC_RESULT
+mflac_ogg_scan(mflac_t* m, uint64_t offset, uint64_t limit, uint64_t* page_offset, int64_t* granulepos) {
+    MINIFLAC_RESULT r;
+    uint32_t used;
+    size_t received;
+    size_t i;
+
+    if(m->seek(offset,m->userdata) != 0) return (MFLAC_RESULT)MINIFLAC_ERROR;
+    m->bufpos = 0;
+    m->buflen = 0;
+
+    while(offset < limit) {
+        for(i = 0; i < m->buflen; i++) {
+            m->buffer[i] = m->buffer[m->bufpos + i];
+        }
+        m->bufpos = 0;
+
+        received = m->read(&m->buffer[m->buflen], MFLAC_BUFFER_SIZE - m->buflen, m->userdata);
+        if(received == 0) break;
+        m->buflen += received;
+
+        r = miniflac_ogg_probe(&m->flac,m->buffer,(uint32_t)m->buflen,&used,granulepos);
+        if(r == MINIFLAC_OK) {
+            *page_offset = offset + used;
+            return *page_offset < limit ? MFLAC_OK : MFLAC_EOF;
+        }
+        if(r != MINIFLAC_CONTINUE) return (MFLAC_RESULT)r;
+
+        offset += used;
+        m->bufpos = used;
+        m->buflen -= used;
+    }
+    return MFLAC_EOF;
+}
+
+/* bisects an Ogg stream on the granule positions of its pages, lo is
+ * always a page that's safe to start decoding from: one whose last
+ * frame ends before the target, or the page with the first frame */
+static
+MFLAC_RESULT
+mflac_seek_bisect_ogg(mflac_t* m, uint64_t length, uint64_t sample_number) {
+    MFLAC_RESULT res;
+    miniflac_seekpoint_t point;
+    uint64_t lo = m->flac.frame_offset;
+    uint64_t hi = length;
+    uint64_t mid;
+    uint64_t limit;
+    uint64_t pos;
+    int64_t granulepos;
+
+    point.sample_number = 0;
+    point.samples = 0;
+
+    while(hi > lo && hi - lo > MFLAC_BUFFER_SIZE) {
+        mid = lo + (hi - lo) / 2;
+        /* pages from a later link of a chained file, or a busy stream
+         * multiplexed with this one, can go on for a long way - give
+         * up after a few of the largest possible pages and look in the
+         * first half instead */
+        limit = hi - mid > MFLAC_OGG_SCAN_LIMIT ? mid + MFLAC_OGG_SCAN_LIMIT : hi;
+        res = mflac_ogg_scan(m,mid,limit,&pos,&granulepos);
+        if(res == MFLAC_EOF) {
+            hi = mid;
+            continue;
+        }
+        if(res != MFLAC_OK) return res;
+        if(granulepos == -1) {
+            hi = pos;
+            continue;
+        }
+        if((uint64_t)granulepos >= sample_number) {
+            hi = mid;
+            continue;
+        }
+
+        lo = pos;
+        point.sample_number = (uint64_t)granulepos;
+    }
+
+    point.sample_offset = lo - m->flac.frame_offset;
+    return mflac_seek(m,&point,1,sample_number);
+}
+
+MINIFLAC_API
+MFLAC_RESULT
+mflac_seek(mflac_t* m, const miniflac_seekpoint_t* points, uint32_t points_length, uint64_t sample_number) {
+    MFLAC_RESULT res;
+    MINIFLAC_RESULT r;
+    uint64_t offset;
+
+    res = mflac_seek_prepare(m);
+    if(res != MFLAC_OK) return res;
+
+    r = miniflac_seek(&m->flac,points,points_length,sample_number,&offset);
+    if(r != MINIFLAC_OK) return (MFLAC_RESULT)r;
+
+    if(m->seek(offset,m->userdata) != 0) return (MFLAC_RESULT)MINIFLAC_ERROR;
+    m->bufpos = 0;
+    m->buflen = 0;
+    return MFLAC_OK;
+}
+
+MINIFLAC_API
+MFLAC_RESULT
+mflac_seek_bisect(mflac_t* m, uint64_t length, uint64_t sample_number) {
+    MFLAC_RESULT res;
+    miniflac_seekpoint_t point;
+    uint64_t lo;
+    uint64_t hi = length;
+    uint64_t mid;
+    uint64_t pos;
+    uint64_t first;
+    uint16_t block_size;
+
+    res = mflac_seek_prepare(m);
+    if(res != MFLAC_OK) return res;
+    if(m->flac.container == MINIFLAC_CONTAINER_OGG) return mflac_seek_bisect_ogg(m,length,sample_number);
+
+    /* lo is always a frame header at or before the target, anything
+     * at or past hi starts after it. Once the gap is down to one
+     * buffer it's quicker to decode forward than to keep seeking. */
+    lo = m->flac.frame_offset;
+    point.sample_number = 0;
+    point.samples = 0;
+
+    while(hi > lo && hi - lo > MFLAC_BUFFER_SIZE) {
+        mid = lo + (hi - lo) / 2;
+        res = mflac_seek_scan(m,mid,hi,&pos,&first,&block_size);
+        if(res == MFLAC_EOF || (res == MFLAC_OK && first > sample_number)) {
+            hi = mid;
+            continue;
+        }
+        if(res != MFLAC_OK) return res;
+
+        lo = pos;
+        point.sample_number = first;
+        if(first + block_size > sample_number) break;
+    }
+
+    point.sample_offset = lo - m->flac.frame_offset;
+    return mflac_seek(m,&point,1,sample_number);
+}
+
 MFLAC_GET1_FUNC(decode,int32_t**)
 
+MFLAC_GET1_FUNC(frameinfo,miniflac_frameinfo_t*)
+
+MFLAC_FUNC(mflac_decode_interleaved(mflac_t* m, MINIFLAC_SAMPLE_FORMAT format, void* samples, int32_t* scratch),MFLAC_FUNC_BODY(miniflac_decode_interleaved(&m->flac, &m->buffer[m->bufpos], m->buflen, &used, format, samples, scratch)))
+
+MFLAC_FUNC(mflac_decode_planar(mflac_t* m, MINIFLAC_SAMPLE_FORMAT format, void** samples, int32_t* scratch),MFLAC_FUNC_BODY(miniflac_decode_planar(&m->flac, &m->buffer[m->bufpos], m->buflen, &used, format, samples, scratch)))
+
 MFLAC_GET1_FUNC(streaminfo_min_block_size, uint16_t*)
 MFLAC_GET1_FUNC(streaminfo_max_block_size, uint16_t*)
 MFLAC_GET1_FUNC(streaminfo_min_frame_size, uint32_t*)
@@ -92,6 +308,7 @@ MFLAC_GET1_FUNC(seektable_seekpoints, uint32_t*)
 MFLAC_GET1_FUNC(seektable_sample_number, uint64_t*)
 MFLAC_GET1_FUNC(seektable_sample_offset, uint64_t*)
 MFLAC_GET1_FUNC(seektable_samples, uint16_t*)
+MFLAC_GET3_FUNC(seektable_points, miniflac_seekpoint_t*)
 
 MFLAC_GET1_FUNC(cuesheet_catalog_length, uint32_t*)
 MFLAC_GET3_FUNC(cuesheet_catalog_string, char*)
@@ -120,6 +337,18 @@ MFLAC_GET1_FUNC(picture_totalcolors, uint32_t*)
 MFLAC_GET1_FUNC(picture_length, uint32_t*)
 MFLAC_GET3_FUNC(picture_data, uint8_t*)
 
+MINIFLAC_API
+void
+mflac_verify_frame(miniflac_md5_t* md5, mflac_t* m, int32_t** samples) {
+    miniflac_verify_frame(md5,&m->flac,samples);
+}
+
+MINIFLAC_API
+MFLAC_RESULT
+mflac_verify_check(miniflac_md5_t* md5, mflac_t* m) {
+    return (MFLAC_RESULT)miniflac_verify_check(md5,&m->flac);
+}
+
 MINIFLAC_API
 uint8_t
 mflac_is_native(mflac_t* m) {
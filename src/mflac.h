@@ -10,6 +10,10 @@
 
 typedef size_t (*mflac_readcb)(uint8_t* buffer, size_t bytes, void* userdata);
 
+/* moves the read position to offset bytes from the start of the stream,
+ * returns 0 on success */
+typedef int (*mflac_seekcb)(uint64_t offset, void* userdata);
+
 enum MFLAC_RESULT {
     MFLAC_EOF          = 0,
     MFLAC_OK           = 1,
@@ -19,6 +23,7 @@ enum MFLAC_RESULT {
 struct mflac_s {
     struct miniflac_s flac;
     mflac_readcb read;
+    mflac_seekcb seek;
     void* userdata;
     size_t bufpos;
     size_t buflen;
@@ -48,14 +53,56 @@ MINIFLAC_API
 void
 mflac_reset(mflac_t* m, MINIFLAC_STATE state);
 
+/* sets the callback used by mflac_seek */
+MINIFLAC_API
+void
+mflac_set_seek(mflac_t* m, mflac_seekcb seek);
+
 MINIFLAC_API
 MFLAC_RESULT
 mflac_sync(mflac_t* m);
 
+/* seeks to a sample using miniflac_seek and the seek callback, the next
+ * mflac_decode starts at exactly sample_number. points may be NULL. */
+MINIFLAC_API
+MFLAC_RESULT
+mflac_seek(mflac_t* m, const miniflac_seekpoint_t* points, uint32_t points_length, uint64_t sample_number);
+
+/* seeks to a sample without a seektable, bisecting the stream with
+ * miniflac_seek_probe, or miniflac_ogg_probe and the granule positions
+ * of the pages in an Ogg file. length is the size of the stream in
+ * bytes. In a chained Ogg file the seek is within the current link. */
+MINIFLAC_API
+MFLAC_RESULT
+mflac_seek_bisect(mflac_t* m, uint64_t length, uint64_t sample_number);
+
 MINIFLAC_API
 MFLAC_RESULT
 mflac_decode(mflac_t* m, int32_t** samples);
 
+MINIFLAC_API
+MFLAC_RESULT
+mflac_frameinfo(mflac_t* m, miniflac_frameinfo_t* info);
+
+/* see miniflac_verify_frame and miniflac_verify_check */
+MINIFLAC_API
+void
+mflac_verify_frame(miniflac_md5_t* md5, mflac_t* m, int32_t** samples);
+
+MINIFLAC_API
+MFLAC_RESULT
+mflac_verify_check(miniflac_md5_t* md5, mflac_t* m);
+
+/* see miniflac_decode_interleaved */
+MINIFLAC_API
+MFLAC_RESULT
+mflac_decode_interleaved(mflac_t* m, MINIFLAC_SAMPLE_FORMAT format, void* samples, int32_t* scratch);
+
+/* see miniflac_decode_planar */
+MINIFLAC_API
+MFLAC_RESULT
+mflac_decode_planar(mflac_t* m, MINIFLAC_SAMPLE_FORMAT format, void** samples, int32_t* scratch);
+
 /* functions to query the state without inspecting structs,
  * only valid to call after mflac_sync returns MFLAC_OK */
 
@@ -257,6 +304,10 @@ MINIFLAC_API
 MFLAC_RESULT
 mflac_seektable_samples(mflac_t* m, uint16_t* samples);
 
+MINIFLAC_API
+MFLAC_RESULT
+mflac_seektable_points(mflac_t* m, miniflac_seekpoint_t* points, uint32_t points_length, uint32_t* outlen);
+
 /*
  * MINIFLAC_METADATA_VORBIS_COMMENT (4)
  * ===================================
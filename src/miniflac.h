@@ -106,14 +106,17 @@ frame, or call miniflac_decode to continue on.
 
 #define MINIFLAC_APPLICATION_H
 #define MINIFLAC_COMMON_H
+#define MINIFLAC_CPU_H
 #define MINIFLAC_BITREADER_H
 #define MINIFLAC_CUESHEET_H
 #define MINIFLAC_FRAME_H
 #define MINIFLAC_FRAMEHEADER_H
+#define MINIFLAC_MD5_H
 #define MINIFLAC_METADATA_H
 #define MINIFLAC_METADATA_HEADER_H
 #define MINIFLAC_OGG_H
 #define MINIFLAC_OGGHEADER_H
+#define MINIFLAC_OUTPUT_H
 #define MINIFLAC_PADDING_H
 #define MINIFLAC_PICTURE_H
 #define MINIFLAC_RESIDUAL_H
@@ -165,6 +168,18 @@ extern "C" {
 #define miniflac_abort()
 #endif
 
+#if !defined(MINIFLAC_NO_SIMD) && (defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 5))
+#if defined(__x86_64__) || defined(__i386__)
+#define MINIFLAC_SIMD_X86
+#define MINIFLAC_TARGET(x) __attribute__((__target__(x)))
+#include <cpuid.h>
+#include <immintrin.h>
+#elif defined(__aarch64__) || defined(__ARM_NEON)
+#define MINIFLAC_SIMD_NEON
+#include <arm_neon.h>
+#endif
+#endif
+
 #inject private_function_declarations
 
 #inject code
@@ -35,9 +35,24 @@ struct miniflac_ogg_s {
     uint8_t curseg; /* current position within the segment table */
     uint16_t length; /* length of data within page */
     uint16_t pos; /* where we are within page */
+    uint8_t lacing[255]; /* the page's segment table */
+    uint32_t checksum; /* crc32 stored in the page header */
+    uint32_t crc32; /* crc32 of the page so far */
+    uint8_t verified; /* the page was checked in one go, or is being skipped */
+};
+
+/* a page header, as read by miniflac_ogg_pageinfo */
+struct miniflac_ogg_pageinfo_s {
+    uint32_t size; /* the whole page, header and data */
+    int32_t serialno;
+    int64_t granulepos;
+    uint32_t pageno;
+    uint8_t headertype;
+    uint8_t flac; /* the page starts a FLAC stream */
 };
 
 typedef struct miniflac_ogg_s miniflac_ogg_t;
+typedef struct miniflac_ogg_pageinfo_s miniflac_ogg_pageinfo_t;
 typedef enum MINIFLAC_OGG_STATE MINIFLAC_OGG_STATE;
 
 #ifdef __cplusplus
@@ -52,6 +67,49 @@ MINIFLAC_PRIVATE
 MINIFLAC_RESULT
 miniflac_ogg_sync(miniflac_ogg_t* ogg, miniflac_bitreader_t* br);
 
+/* moves past used bytes of page data, once the end of the page is
+ * reached the page checksum is compared and the state goes back to
+ * looking for a capture pattern */
+MINIFLAC_PRIVATE
+MINIFLAC_RESULT
+miniflac_ogg_advance(miniflac_ogg_t* ogg, uint32_t used);
+
+/* the size of the page with its header at b, including the segment
+ * table - which has to be there */
+MINIFLAC_PRIVATE
+uint32_t
+miniflac_ogg_page_size(const uint8_t* b);
+
+/* checks the crc of a page that's about to be used, when built with
+ * MINIFLAC_OGG_CRC32 */
+MINIFLAC_PRIVATE
+MINIFLAC_RESULT
+miniflac_ogg_verify(miniflac_ogg_t* ogg);
+
+/* jumps straight over whole pages in the buffer that aren't from
+ * serialno, going by the capture pattern, serial number and lacing
+ * values alone - they're not parsed or checked. Stops at anything
+ * else, and leaves it to miniflac_ogg_sync */
+MINIFLAC_PRIVATE
+void
+miniflac_ogg_skip_foreign(miniflac_ogg_t* ogg, int32_t serialno);
+
+/* looks for a page header in data from anywhere in an Ogg stream. On
+ * MINIFLAC_OK pos is where it starts and the header fields are filled
+ * in. With MINIFLAC_OGG_CRC32, if the whole page is in data its crc has
+ * been checked too. On
+ * MINIFLAC_CONTINUE pos is how much of data can be skipped */
+MINIFLAC_PRIVATE
+MINIFLAC_RESULT
+miniflac_ogg_find(miniflac_ogg_t* ogg, const uint8_t* data, uint32_t length, uint32_t* pos);
+
+/* skips to the end of the packet at the current position, which may
+ * be the end of one carried over from the page before. Returns
+ * MINIFLAC_CONTINUE if more data is needed */
+MINIFLAC_PRIVATE
+MINIFLAC_RESULT
+miniflac_ogg_skip_packet(miniflac_ogg_t* ogg);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,453 @@
+/* SPDX-License-Identifier: 0BSD */
+#include "output.h"
+#include "cpu.h"
+
+/* Every integer format is produced the same way: the sample is shifted
+ * up so its top bit lands in bit 31, then shifted back down to the
+ * width of the format. That left-justifies narrow samples, truncates
+ * wide ones, and is the same in the scalar and SIMD paths. */
+
+#if defined(MINIFLAC_SIMD_X86) || defined(MINIFLAC_SIMD_NEON)
+static
+uint8_t
+miniflac_output_width(MINIFLAC_SAMPLE_FORMAT format) {
+    switch(format) {
+        case MINIFLAC_SAMPLE_INT16: return 16;
+        case MINIFLAC_SAMPLE_INT24: return 24;
+        default: break;
+    }
+    return 32;
+}
+#endif
+
+MINIFLAC_PRIVATE
+uint8_t
+miniflac_output_sample_size(MINIFLAC_SAMPLE_FORMAT format) {
+    switch(format) {
+        case MINIFLAC_SAMPLE_INT16: return 2;
+        case MINIFLAC_SAMPLE_INT24: return 3;
+        default: break;
+    }
+    return 4;
+}
+
+static
+float
+miniflac_output_scale(uint8_t bps) {
+    return 1.0f / (float)((uint32_t)1 << (bps - 1));
+}
+
+static
+void
+miniflac_output_store(MINIFLAC_SAMPLE_FORMAT format, void* buffer, uint32_t index, int32_t sample, uint8_t bps, float scale) {
+    uint32_t u = (uint32_t)sample << (32 - bps);
+    uint8_t* p;
+
+    switch(format) {
+        case MINIFLAC_SAMPLE_INT16: {
+            ((int16_t*)buffer)[index] = (int16_t)(u >> 16);
+            break;
+        }
+        case MINIFLAC_SAMPLE_INT24: {
+            p = (uint8_t*)buffer + (3 * index);
+            p[0] = (uint8_t)(u >> 8);
+            p[1] = (uint8_t)(u >> 16);
+            p[2] = (uint8_t)(u >> 24);
+            break;
+        }
+        case MINIFLAC_SAMPLE_INT32: {
+            ((int32_t*)buffer)[index] = (int32_t)u;
+            break;
+        }
+        case MINIFLAC_SAMPLE_FLOAT32: {
+            ((float*)buffer)[index] = (float)sample * scale;
+            break;
+        }
+        default: break;
+    }
+}
+
+MINIFLAC_PRIVATE
+void
+miniflac_output_channel(const miniflac_output_t* out, const int32_t* input, uint32_t block_size, uint8_t bps, uint8_t channel, uint8_t channels) {
+    uint32_t i;
+    void* buffer = out->samples;
+    const float scale = miniflac_output_scale(bps);
+
+    if(buffer == NULL) {
+        buffer = out->planes[channel];
+        channel = 0;
+        channels = 1;
+    }
+
+    for(i = 0; i < block_size; i++) {
+        miniflac_output_store(out->format, buffer, (i * channels) + channel, input[i], bps, scale);
+    }
+}
+
+/* Planar 16-bit output of a stereo pair only needs scratch for one
+ * channel. The first channel is stored as soon as it's restored,
+ * left-justified and cut down to 16 bits. Decorrelation only adds and
+ * subtracts the first channel, so doing it modulo 2^16 on those stored
+ * bits gives the same 16 bits as doing it on the full samples - as long
+ * as nothing was shifted out of the bottom, which holds while bps <= 16.
+ * The second channel (which is the side channel whenever a shift is
+ * involved) is still whole in scratch. */
+
+MINIFLAC_PRIVATE
+uint8_t
+miniflac_output_narrow(const miniflac_output_t* out, uint8_t bps) {
+    return out->samples == NULL && out->format == MINIFLAC_SAMPLE_INT16 && bps <= 16;
+}
+
+MINIFLAC_PRIVATE
+void
+miniflac_output_stereo_narrow(const miniflac_output_t* out, MINIFLAC_CHASSGN assignment, const int32_t* right, uint32_t block_size, uint8_t bps) {
+    uint32_t i;
+    uint32_t s;
+    int16_t* l16 = (int16_t*)out->planes[0];
+    int16_t* r16 = (int16_t*)out->planes[1];
+    const uint8_t shift = 16 - bps;
+
+    switch(assignment) {
+        case MINIFLAC_CHASSGN_LEFT_SIDE: {
+            for(i = 0; i < block_size; i++) {
+                r16[i] = (int16_t)((uint32_t)l16[i] - ((uint32_t)right[i] << shift));
+            }
+            break;
+        }
+        case MINIFLAC_CHASSGN_RIGHT_SIDE: {
+            for(i = 0; i < block_size; i++) {
+                r16[i] = (int16_t)((uint32_t)right[i] << shift);
+                l16[i] = (int16_t)((uint32_t)l16[i] + (uint32_t)r16[i]);
+            }
+            break;
+        }
+        case MINIFLAC_CHASSGN_MID_SIDE: {
+            for(i = 0; i < block_size; i++) {
+                s = (uint32_t)(right[i] >> 1);
+                r16[i] = (int16_t)((uint32_t)l16[i] - (s << shift));
+                l16[i] = (int16_t)((uint32_t)l16[i] + ((s + ((uint32_t)right[i] & 1)) << shift));
+            }
+            break;
+        }
+        default: {
+            for(i = 0; i < block_size; i++) {
+                r16[i] = (int16_t)((uint32_t)right[i] << shift);
+            }
+            break;
+        }
+    }
+}
+
+/* see miniflac_frame_decorrelate_scalar for the mid/side math */
+static
+void
+miniflac_output_stereo_scalar(const miniflac_output_t* out, MINIFLAC_CHASSGN assignment, const int32_t* left, const int32_t* right, uint32_t start, uint32_t block_size, uint8_t bps) {
+    uint32_t i;
+    uint32_t m, s;
+    int32_t l, r;
+    void* lbuf = out->samples;
+    void* rbuf = out->samples;
+    uint32_t stride = 2;
+    uint32_t roffset = 1;
+    const float scale = miniflac_output_scale(bps);
+
+    if(out->samples == NULL) {
+        lbuf = out->planes[0];
+        rbuf = out->planes[1];
+        stride = 1;
+        roffset = 0;
+    }
+
+    for(i = start; i < block_size; i++) {
+        l = left[i];
+        r = right[i];
+        switch(assignment) {
+            case MINIFLAC_CHASSGN_LEFT_SIDE: {
+                r = (int32_t)((uint32_t)l - (uint32_t)r);
+                break;
+            }
+            case MINIFLAC_CHASSGN_RIGHT_SIDE: {
+                l = (int32_t)((uint32_t)l + (uint32_t)r);
+                break;
+            }
+            case MINIFLAC_CHASSGN_MID_SIDE: {
+                m = (uint32_t)l;
+                s = (uint32_t)(r >> 1);
+                l = (int32_t)(m + s + ((uint32_t)r & 1));
+                r = (int32_t)(m - s);
+                break;
+            }
+            default: break;
+        }
+        miniflac_output_store(out->format, lbuf, stride * i, l, bps, scale);
+        miniflac_output_store(out->format, rbuf, (stride * i) + roffset, r, bps, scale);
+    }
+}
+
+/* the SIMD variants decorrelate, convert and store (interleaved or
+ * planar) whole vectors in one pass and return how many samples they
+ * did, the scalar loop finishes the rest. 24-bit output is always
+ * scalar. */
+
+#if defined(MINIFLAC_SIMD_X86)
+static MINIFLAC_TARGET("sse2")
+uint32_t
+miniflac_output_stereo_sse2(const miniflac_output_t* out, MINIFLAC_CHASSGN assignment, const int32_t* left, const int32_t* right, uint32_t block_size, uint8_t bps) {
+    __m128i l, r, s, t;
+    __m128 lf, rf;
+    const __m128i one = _mm_set1_epi32(1);
+    const __m128i lshift = _mm_cvtsi32_si128(32 - bps);
+    const __m128i rshift = _mm_cvtsi32_si128(32 - miniflac_output_width(out->format));
+    const __m128 scale = _mm_set1_ps(miniflac_output_scale(bps));
+    uint32_t i = 0;
+
+    if(out->format == MINIFLAC_SAMPLE_INT24) return 0;
+
+    for(; i + 4 <= block_size; i += 4) {
+        l = _mm_loadu_si128((const __m128i*)&left[i]);
+        r = _mm_loadu_si128((const __m128i*)&right[i]);
+        switch(assignment) {
+            case MINIFLAC_CHASSGN_LEFT_SIDE: {
+                r = _mm_sub_epi32(l, r);
+                break;
+            }
+            case MINIFLAC_CHASSGN_RIGHT_SIDE: {
+                l = _mm_add_epi32(l, r);
+                break;
+            }
+            case MINIFLAC_CHASSGN_MID_SIDE: {
+                s = _mm_srai_epi32(r, 1);
+                t = _mm_add_epi32(_mm_add_epi32(l, s), _mm_and_si128(r, one));
+                r = _mm_sub_epi32(l, s);
+                l = t;
+                break;
+            }
+            default: break;
+        }
+        switch(out->format) {
+            case MINIFLAC_SAMPLE_INT16: {
+                l = _mm_sra_epi32(_mm_sll_epi32(l, lshift), rshift);
+                r = _mm_sra_epi32(_mm_sll_epi32(r, lshift), rshift);
+                if(out->samples != NULL) {
+                    _mm_storeu_si128((__m128i*)&((int16_t*)out->samples)[2 * i], _mm_packs_epi32(_mm_unpacklo_epi32(l, r), _mm_unpackhi_epi32(l, r)));
+                } else {
+                    _mm_storel_epi64((__m128i*)&((int16_t*)out->planes[0])[i], _mm_packs_epi32(l, l));
+                    _mm_storel_epi64((__m128i*)&((int16_t*)out->planes[1])[i], _mm_packs_epi32(r, r));
+                }
+                break;
+            }
+            case MINIFLAC_SAMPLE_INT32: {
+                l = _mm_sll_epi32(l, lshift);
+                r = _mm_sll_epi32(r, lshift);
+                if(out->samples != NULL) {
+                    _mm_storeu_si128((__m128i*)&((int32_t*)out->samples)[2 * i], _mm_unpacklo_epi32(l, r));
+                    _mm_storeu_si128((__m128i*)&((int32_t*)out->samples)[(2 * i) + 4], _mm_unpackhi_epi32(l, r));
+                } else {
+                    _mm_storeu_si128((__m128i*)&((int32_t*)out->planes[0])[i], l);
+                    _mm_storeu_si128((__m128i*)&((int32_t*)out->planes[1])[i], r);
+                }
+                break;
+            }
+            default: {
+                lf = _mm_mul_ps(_mm_cvtepi32_ps(l), scale);
+                rf = _mm_mul_ps(_mm_cvtepi32_ps(r), scale);
+                if(out->samples != NULL) {
+                    _mm_storeu_ps(&((float*)out->samples)[2 * i], _mm_unpacklo_ps(lf, rf));
+                    _mm_storeu_ps(&((float*)out->samples)[(2 * i) + 4], _mm_unpackhi_ps(lf, rf));
+                } else {
+                    _mm_storeu_ps(&((float*)out->planes[0])[i], lf);
+                    _mm_storeu_ps(&((float*)out->planes[1])[i], rf);
+                }
+                break;
+            }
+        }
+    }
+    return i;
+}
+
+static MINIFLAC_TARGET("avx2")
+uint32_t
+miniflac_output_stereo_avx2(const miniflac_output_t* out, MINIFLAC_CHASSGN assignment, const int32_t* left, const int32_t* right, uint32_t block_size, uint8_t bps) {
+    __m256i l, r, s, t, lo, hi;
+    __m256 lf, rf, lof, hif;
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m128i lshift = _mm_cvtsi32_si128(32 - bps);
+    const __m128i rshift = _mm_cvtsi32_si128(32 - miniflac_output_width(out->format));
+    const __m256 scale = _mm256_set1_ps(miniflac_output_scale(bps));
+    uint32_t i = 0;
+
+    if(out->format == MINIFLAC_SAMPLE_INT24) return 0;
+
+    for(; i + 8 <= block_size; i += 8) {
+        l = _mm256_loadu_si256((const __m256i*)&left[i]);
+        r = _mm256_loadu_si256((const __m256i*)&right[i]);
+        switch(assignment) {
+            case MINIFLAC_CHASSGN_LEFT_SIDE: {
+                r = _mm256_sub_epi32(l, r);
+                break;
+            }
+            case MINIFLAC_CHASSGN_RIGHT_SIDE: {
+                l = _mm256_add_epi32(l, r);
+                break;
+            }
+            case MINIFLAC_CHASSGN_MID_SIDE: {
+                s = _mm256_srai_epi32(r, 1);
+                t = _mm256_add_epi32(_mm256_add_epi32(l, s), _mm256_and_si256(r, one));
+                r = _mm256_sub_epi32(l, s);
+                l = t;
+                break;
+            }
+            default: break;
+        }
+        /* the unpacks work within 128-bit lanes, so 32-bit results
+         * need the halves put back in order. packs_epi32 is also
+         * per-lane, which cancels that out for interleaved 16-bit
+         * results, and leaves planar ones as l0-3 r0-3 l4-7 r4-7. */
+        switch(out->format) {
+            case MINIFLAC_SAMPLE_INT16: {
+                l = _mm256_sra_epi32(_mm256_sll_epi32(l, lshift), rshift);
+                r = _mm256_sra_epi32(_mm256_sll_epi32(r, lshift), rshift);
+                if(out->samples != NULL) {
+                    _mm256_storeu_si256((__m256i*)&((int16_t*)out->samples)[2 * i], _mm256_packs_epi32(_mm256_unpacklo_epi32(l, r), _mm256_unpackhi_epi32(l, r)));
+                } else {
+                    lo = _mm256_permute4x64_epi64(_mm256_packs_epi32(l, r), 0xD8);
+                    _mm_storeu_si128((__m128i*)&((int16_t*)out->planes[0])[i], _mm256_castsi256_si128(lo));
+                    _mm_storeu_si128((__m128i*)&((int16_t*)out->planes[1])[i], _mm256_extracti128_si256(lo, 1));
+                }
+                break;
+            }
+            case MINIFLAC_SAMPLE_INT32: {
+                l = _mm256_sll_epi32(l, lshift);
+                r = _mm256_sll_epi32(r, lshift);
+                if(out->samples != NULL) {
+                    lo = _mm256_unpacklo_epi32(l, r);
+                    hi = _mm256_unpackhi_epi32(l, r);
+                    _mm256_storeu_si256((__m256i*)&((int32_t*)out->samples)[2 * i], _mm256_permute2x128_si256(lo, hi, 0x20));
+                    _mm256_storeu_si256((__m256i*)&((int32_t*)out->samples)[(2 * i) + 8], _mm256_permute2x128_si256(lo, hi, 0x31));
+                } else {
+                    _mm256_storeu_si256((__m256i*)&((int32_t*)out->planes[0])[i], l);
+                    _mm256_storeu_si256((__m256i*)&((int32_t*)out->planes[1])[i], r);
+                }
+                break;
+            }
+            default: {
+                lf = _mm256_mul_ps(_mm256_cvtepi32_ps(l), scale);
+                rf = _mm256_mul_ps(_mm256_cvtepi32_ps(r), scale);
+                if(out->samples != NULL) {
+                    lof = _mm256_unpacklo_ps(lf, rf);
+                    hif = _mm256_unpackhi_ps(lf, rf);
+                    _mm256_storeu_ps(&((float*)out->samples)[2 * i], _mm256_permute2f128_ps(lof, hif, 0x20));
+                    _mm256_storeu_ps(&((float*)out->samples)[(2 * i) + 8], _mm256_permute2f128_ps(lof, hif, 0x31));
+                } else {
+                    _mm256_storeu_ps(&((float*)out->planes[0])[i], lf);
+                    _mm256_storeu_ps(&((float*)out->planes[1])[i], rf);
+                }
+                break;
+            }
+        }
+    }
+    return i;
+}
+#endif
+
+#if defined(MINIFLAC_SIMD_NEON)
+static
+uint32_t
+miniflac_output_stereo_neon(const miniflac_output_t* out, MINIFLAC_CHASSGN assignment, const int32_t* left, const int32_t* right, uint32_t block_size, uint8_t bps) {
+    int32x4_t l, r, s, t;
+    int16x4x2_t v16;
+    int32x4x2_t v32;
+    float32x4x2_t vf;
+    const int32x4_t one = vdupq_n_s32(1);
+    const int32x4_t lshift = vdupq_n_s32(32 - bps);
+    const int32x4_t rshift = vdupq_n_s32(miniflac_output_width(out->format) - 32);
+    const float scale = miniflac_output_scale(bps);
+    uint32_t i = 0;
+
+    if(out->format == MINIFLAC_SAMPLE_INT24) return 0;
+
+    for(; i + 4 <= block_size; i += 4) {
+        l = vld1q_s32(&left[i]);
+        r = vld1q_s32(&right[i]);
+        switch(assignment) {
+            case MINIFLAC_CHASSGN_LEFT_SIDE: {
+                r = vsubq_s32(l, r);
+                break;
+            }
+            case MINIFLAC_CHASSGN_RIGHT_SIDE: {
+                l = vaddq_s32(l, r);
+                break;
+            }
+            case MINIFLAC_CHASSGN_MID_SIDE: {
+                s = vshrq_n_s32(r, 1);
+                t = vaddq_s32(vaddq_s32(l, s), vandq_s32(r, one));
+                r = vsubq_s32(l, s);
+                l = t;
+                break;
+            }
+            default: break;
+        }
+        switch(out->format) {
+            case MINIFLAC_SAMPLE_INT16: {
+                v16.val[0] = vmovn_s32(vshlq_s32(vshlq_s32(l, lshift), rshift));
+                v16.val[1] = vmovn_s32(vshlq_s32(vshlq_s32(r, lshift), rshift));
+                if(out->samples != NULL) {
+                    vst2_s16(&((int16_t*)out->samples)[2 * i], v16);
+                } else {
+                    vst1_s16(&((int16_t*)out->planes[0])[i], v16.val[0]);
+                    vst1_s16(&((int16_t*)out->planes[1])[i], v16.val[1]);
+                }
+                break;
+            }
+            case MINIFLAC_SAMPLE_INT32: {
+                v32.val[0] = vshlq_s32(l, lshift);
+                v32.val[1] = vshlq_s32(r, lshift);
+                if(out->samples != NULL) {
+                    vst2q_s32(&((int32_t*)out->samples)[2 * i], v32);
+                } else {
+                    vst1q_s32(&((int32_t*)out->planes[0])[i], v32.val[0]);
+                    vst1q_s32(&((int32_t*)out->planes[1])[i], v32.val[1]);
+                }
+                break;
+            }
+            default: {
+                vf.val[0] = vmulq_n_f32(vcvtq_f32_s32(l), scale);
+                vf.val[1] = vmulq_n_f32(vcvtq_f32_s32(r), scale);
+                if(out->samples != NULL) {
+                    vst2q_f32(&((float*)out->samples)[2 * i], vf);
+                } else {
+                    vst1q_f32(&((float*)out->planes[0])[i], vf.val[0]);
+                    vst1q_f32(&((float*)out->planes[1])[i], vf.val[1]);
+                }
+                break;
+            }
+        }
+    }
+    return i;
+}
+#endif
+
+MINIFLAC_PRIVATE
+void
+miniflac_output_stereo(const miniflac_output_t* out, MINIFLAC_CHASSGN assignment, const int32_t* left, const int32_t* right, uint32_t block_size, uint8_t bps) {
+    uint32_t i = 0;
+#if defined(MINIFLAC_SIMD_X86) || defined(MINIFLAC_SIMD_NEON)
+    uint32_t features = miniflac_cpu_features();
+#endif
+
+#if defined(MINIFLAC_SIMD_X86)
+    if(features & MINIFLAC_CPU_AVX2) {
+        i = miniflac_output_stereo_avx2(out,assignment,left,right,block_size,bps);
+    } else if(features & MINIFLAC_CPU_SSE2) {
+        i = miniflac_output_stereo_sse2(out,assignment,left,right,block_size,bps);
+    }
+#elif defined(MINIFLAC_SIMD_NEON)
+    if(features & MINIFLAC_CPU_NEON) {
+        i = miniflac_output_stereo_neon(out,assignment,left,right,block_size,bps);
+    }
+#endif
+
+    miniflac_output_stereo_scalar(out,assignment,left,right,i,block_size,bps);
+}
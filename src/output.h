@@ -0,0 +1,64 @@
+/* SPDX-License-Identifier: 0BSD */
+#ifndef MINIFLAC_OUTPUT_H
+#define MINIFLAC_OUTPUT_H
+
+#include <stdint.h>
+
+#include "common.h"
+#include "frameheader.h"
+
+/* sample formats for miniflac_decode_interleaved and
+ * miniflac_decode_planar. Integer formats are left-justified: samples
+ * with fewer bits than the format are shifted up, samples with more
+ * bits are shifted down. FLOAT32 samples are scaled by 1/2^(bps-1),
+ * using the bps of each frame. */
+enum MINIFLAC_SAMPLE_FORMAT {
+    MINIFLAC_SAMPLE_INT16,   /* int16_t */
+    MINIFLAC_SAMPLE_INT24,   /* 3 bytes per sample, little-endian */
+    MINIFLAC_SAMPLE_INT32,   /* int32_t */
+    MINIFLAC_SAMPLE_FLOAT32, /* float */
+};
+
+/* where a frame goes when it isn't decoded into caller-supplied
+ * int32_t channel buffers - the subframes are restored in scratch
+ * and packed into samples, or into planes if samples is NULL */
+struct miniflac_output_s {
+    enum MINIFLAC_SAMPLE_FORMAT format;
+    void* samples;
+    void** planes;
+    int32_t* scratch;
+};
+
+typedef struct miniflac_output_s miniflac_output_t;
+typedef enum MINIFLAC_SAMPLE_FORMAT MINIFLAC_SAMPLE_FORMAT;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* bytes per sample of a format */
+MINIFLAC_PRIVATE
+uint8_t miniflac_output_sample_size(MINIFLAC_SAMPLE_FORMAT format);
+
+/* packs one channel */
+MINIFLAC_PRIVATE
+void miniflac_output_channel(const miniflac_output_t* out, const int32_t* input, uint32_t block_size, uint8_t bps, uint8_t channel, uint8_t channels);
+
+/* true when a stereo pair can be packed with scratch for one channel */
+MINIFLAC_PRIVATE
+uint8_t miniflac_output_narrow(const miniflac_output_t* out, uint8_t bps);
+
+/* finishes a stereo pair in narrow mode, the first channel has already
+ * been stored by miniflac_output_channel and right is the second */
+MINIFLAC_PRIVATE
+void miniflac_output_stereo_narrow(const miniflac_output_t* out, MINIFLAC_CHASSGN assignment, const int32_t* right, uint32_t block_size, uint8_t bps);
+
+/* undoes the stereo decorrelation (if any) and packs both channels */
+MINIFLAC_PRIVATE
+void miniflac_output_stereo(const miniflac_output_t* out, MINIFLAC_CHASSGN assignment, const int32_t* left, const int32_t* right, uint32_t block_size, uint8_t bps);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
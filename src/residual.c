@@ -7,6 +7,2597 @@ static const uint8_t escape_codes[2] = {
     31,
 };
 
+/* minimum number of residuals to decode before handing them to the
+ * restore callback, keeps the per-call setup of the predictors cheap
+ * when there are many tiny partitions */
+#ifndef MINIFLAC_RESIDUAL_RESTORE_CHUNK
+#define MINIFLAC_RESIDUAL_RESTORE_CHUNK 256
+#endif
+
+#ifdef MINIFLAC_RICE_TABLE
+/* generated by utils/rice-table.pl - for rice parameters 0-4, maps the
+ * next 12 bits to up to 3 decoded residuals:
+ *   bits 0-3:   number of bits used
+ *   bits 4-5:   number of residuals decoded (0 if the first codeword
+ *               doesn't fit in 12 bits)
+ *   bits 8-31:  the residuals, as int8 */
+#define MINIFLAC_RICE_TABLE_BITS 12
+#define MINIFLAC_RICE_TABLE_MAX_PARAMETER 4
+
+static const uint32_t miniflac_rice_table[5][4096] = {
+  {
+    0x00000000, 0x0000fa1c, 0x0000051b, 0x0000052c, 0x0000fb1a, 0x00fffb2c, 0x0000fb2b, 0x0000fb3c,
+    0x00000419, 0x0001042c, 0x00ff042b, 0x00ff043c, 0x0000042a, 0xff00043c, 0x0000043b, 0x0000043b,
+    0x0000fc18, 0x00fefc2c, 0x0001fc2b, 0x0001fc3c, 0x00fffc2a, 0xfffffc3c, 0x00fffc3b, 0x00fffc3b,
+    0x0000fc29, 0x0100fc3c, 0xff00fc3b, 0xff00fc3b, 0x0000fc3a, 0x0000fc3a, 0x0000fc3a, 0x0000fc3a,
+    0x00000317, 0x0002032c, 0x00fe032b, 0x00fe033c, 0x0001032a, 0xff01033c, 0x0001033b, 0x0001033b,
+    0x00ff0329, 0x01ff033c, 0xffff033b, 0xffff033b, 0x00ff033a, 0x00ff033a, 0x00ff033a, 0x00ff033a,
+    0x00000328, 0xfe00033c, 0x0100033b, 0x0100033b, 0xff00033a, 0xff00033a, 0xff00033a, 0xff00033a,
+    0x00000339, 0x00000339, 0x00000339, 0x00000339, 0x00000339, 0x00000339, 0x00000339, 0x00000339,
+    0x0000fd16, 0x00fdfd2c, 0x0002fd2b, 0x0002fd3c, 0x00fefd2a, 0xfffefd3c, 0x00fefd3b, 0x00fefd3b,
+    0x0001fd29, 0x0101fd3c, 0xff01fd3b, 0xff01fd3b, 0x0001fd3a, 0x0001fd3a, 0x0001fd3a, 0x0001fd3a,
+    0x00fffd28, 0xfefffd3c, 0x01fffd3b, 0x01fffd3b, 0xfffffd3a, 0xfffffd3a, 0xfffffd3a, 0xfffffd3a,
+    0x00fffd39, 0x00fffd39, 0x00fffd39, 0x00fffd39, 0x00fffd39, 0x00fffd39, 0x00fffd39, 0x00fffd39,
+    0x0000fd27, 0x0200fd3c, 0xfe00fd3b, 0xfe00fd3b, 0x0100fd3a, 0x0100fd3a, 0x0100fd3a, 0x0100fd3a,
+    0xff00fd39, 0xff00fd39, 0xff00fd39, 0xff00fd39, 0xff00fd39, 0xff00fd39, 0xff00fd39, 0xff00fd39,
+    0x0000fd38, 0x0000fd38, 0x0000fd38, 0x0000fd38, 0x0000fd38, 0x0000fd38, 0x0000fd38, 0x0000fd38,
+    0x0000fd38, 0x0000fd38, 0x0000fd38, 0x0000fd38, 0x0000fd38, 0x0000fd38, 0x0000fd38, 0x0000fd38,
+    0x00000215, 0x0003022c, 0x00fd022b, 0x00fd023c, 0x0002022a, 0xff02023c, 0x0002023b, 0x0002023b,
+    0x00fe0229, 0x01fe023c, 0xfffe023b, 0xfffe023b, 0x00fe023a, 0x00fe023a, 0x00fe023a, 0x00fe023a,
+    0x00010228, 0xfe01023c, 0x0101023b, 0x0101023b, 0xff01023a, 0xff01023a, 0xff01023a, 0xff01023a,
+    0x00010239, 0x00010239, 0x00010239, 0x00010239, 0x00010239, 0x00010239, 0x00010239, 0x00010239,
+    0x00ff0227, 0x02ff023c, 0xfeff023b, 0xfeff023b, 0x01ff023a, 0x01ff023a, 0x01ff023a, 0x01ff023a,
+    0xffff0239, 0xffff0239, 0xffff0239, 0xffff0239, 0xffff0239, 0xffff0239, 0xffff0239, 0xffff0239,
+    0x00ff0238, 0x00ff0238, 0x00ff0238, 0x00ff0238, 0x00ff0238, 0x00ff0238, 0x00ff0238, 0x00ff0238,
+    0x00ff0238, 0x00ff0238, 0x00ff0238, 0x00ff0238, 0x00ff0238, 0x00ff0238, 0x00ff0238, 0x00ff0238,
+    0x00000226, 0xfd00023c, 0x0200023b, 0x0200023b, 0xfe00023a, 0xfe00023a, 0xfe00023a, 0xfe00023a,
+    0x01000239, 0x01000239, 0x01000239, 0x01000239, 0x01000239, 0x01000239, 0x01000239, 0x01000239,
+    0xff000238, 0xff000238, 0xff000238, 0xff000238, 0xff000238, 0xff000238, 0xff000238, 0xff000238,
+    0xff000238, 0xff000238, 0xff000238, 0xff000238, 0xff000238, 0xff000238, 0xff000238, 0xff000238,
+    0x00000237, 0x00000237, 0x00000237, 0x00000237, 0x00000237, 0x00000237, 0x00000237, 0x00000237,
+    0x00000237, 0x00000237, 0x00000237, 0x00000237, 0x00000237, 0x00000237, 0x00000237, 0x00000237,
+    0x00000237, 0x00000237, 0x00000237, 0x00000237, 0x00000237, 0x00000237, 0x00000237, 0x00000237,
+    0x00000237, 0x00000237, 0x00000237, 0x00000237, 0x00000237, 0x00000237, 0x00000237, 0x00000237,
+    0x0000fe14, 0x00fcfe2c, 0x0003fe2b, 0x0003fe3c, 0x00fdfe2a, 0xfffdfe3c, 0x00fdfe3b, 0x00fdfe3b,
+    0x0002fe29, 0x0102fe3c, 0xff02fe3b, 0xff02fe3b, 0x0002fe3a, 0x0002fe3a, 0x0002fe3a, 0x0002fe3a,
+    0x00fefe28, 0xfefefe3c, 0x01fefe3b, 0x01fefe3b, 0xfffefe3a, 0xfffefe3a, 0xfffefe3a, 0xfffefe3a,
+    0x00fefe39, 0x00fefe39, 0x00fefe39, 0x00fefe39, 0x00fefe39, 0x00fefe39, 0x00fefe39, 0x00fefe39,
+    0x0001fe27, 0x0201fe3c, 0xfe01fe3b, 0xfe01fe3b, 0x0101fe3a, 0x0101fe3a, 0x0101fe3a, 0x0101fe3a,
+    0xff01fe39, 0xff01fe39, 0xff01fe39, 0xff01fe39, 0xff01fe39, 0xff01fe39, 0xff01fe39, 0xff01fe39,
+    0x0001fe38, 0x0001fe38, 0x0001fe38, 0x0001fe38, 0x0001fe38, 0x0001fe38, 0x0001fe38, 0x0001fe38,
+    0x0001fe38, 0x0001fe38, 0x0001fe38, 0x0001fe38, 0x0001fe38, 0x0001fe38, 0x0001fe38, 0x0001fe38,
+    0x00fffe26, 0xfdfffe3c, 0x02fffe3b, 0x02fffe3b, 0xfefffe3a, 0xfefffe3a, 0xfefffe3a, 0xfefffe3a,
+    0x01fffe39, 0x01fffe39, 0x01fffe39, 0x01fffe39, 0x01fffe39, 0x01fffe39, 0x01fffe39, 0x01fffe39,
+    0xfffffe38, 0xfffffe38, 0xfffffe38, 0xfffffe38, 0xfffffe38, 0xfffffe38, 0xfffffe38, 0xfffffe38,
+    0xfffffe38, 0xfffffe38, 0xfffffe38, 0xfffffe38, 0xfffffe38, 0xfffffe38, 0xfffffe38, 0xfffffe38,
+    0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37,
+    0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37,
+    0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37,
+    0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37,
+    0x0000fe25, 0x0300fe3c, 0xfd00fe3b, 0xfd00fe3b, 0x0200fe3a, 0x0200fe3a, 0x0200fe3a, 0x0200fe3a,
+    0xfe00fe39, 0xfe00fe39, 0xfe00fe39, 0xfe00fe39, 0xfe00fe39, 0xfe00fe39, 0xfe00fe39, 0xfe00fe39,
+    0x0100fe38, 0x0100fe38, 0x0100fe38, 0x0100fe38, 0x0100fe38, 0x0100fe38, 0x0100fe38, 0x0100fe38,
+    0x0100fe38, 0x0100fe38, 0x0100fe38, 0x0100fe38, 0x0100fe38, 0x0100fe38, 0x0100fe38, 0x0100fe38,
+    0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37,
+    0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37,
+    0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37,
+    0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37,
+    0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36,
+    0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36,
+    0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36,
+    0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36,
+    0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36,
+    0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36,
+    0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36,
+    0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36, 0x0000fe36,
+    0x00000113, 0x0004012c, 0x00fc012b, 0x00fc013c, 0x0003012a, 0xff03013c, 0x0003013b, 0x0003013b,
+    0x00fd0129, 0x01fd013c, 0xfffd013b, 0xfffd013b, 0x00fd013a, 0x00fd013a, 0x00fd013a, 0x00fd013a,
+    0x00020128, 0xfe02013c, 0x0102013b, 0x0102013b, 0xff02013a, 0xff02013a, 0xff02013a, 0xff02013a,
+    0x00020139, 0x00020139, 0x00020139, 0x00020139, 0x00020139, 0x00020139, 0x00020139, 0x00020139,
+    0x00fe0127, 0x02fe013c, 0xfefe013b, 0xfefe013b, 0x01fe013a, 0x01fe013a, 0x01fe013a, 0x01fe013a,
+    0xfffe0139, 0xfffe0139, 0xfffe0139, 0xfffe0139, 0xfffe0139, 0xfffe0139, 0xfffe0139, 0xfffe0139,
+    0x00fe0138, 0x00fe0138, 0x00fe0138, 0x00fe0138, 0x00fe0138, 0x00fe0138, 0x00fe0138, 0x00fe0138,
+    0x00fe0138, 0x00fe0138, 0x00fe0138, 0x00fe0138, 0x00fe0138, 0x00fe0138, 0x00fe0138, 0x00fe0138,
+    0x00010126, 0xfd01013c, 0x0201013b, 0x0201013b, 0xfe01013a, 0xfe01013a, 0xfe01013a, 0xfe01013a,
+    0x01010139, 0x01010139, 0x01010139, 0x01010139, 0x01010139, 0x01010139, 0x01010139, 0x01010139,
+    0xff010138, 0xff010138, 0xff010138, 0xff010138, 0xff010138, 0xff010138, 0xff010138, 0xff010138,
+    0xff010138, 0xff010138, 0xff010138, 0xff010138, 0xff010138, 0xff010138, 0xff010138, 0xff010138,
+    0x00010137, 0x00010137, 0x00010137, 0x00010137, 0x00010137, 0x00010137, 0x00010137, 0x00010137,
+    0x00010137, 0x00010137, 0x00010137, 0x00010137, 0x00010137, 0x00010137, 0x00010137, 0x00010137,
+    0x00010137, 0x00010137, 0x00010137, 0x00010137, 0x00010137, 0x00010137, 0x00010137, 0x00010137,
+    0x00010137, 0x00010137, 0x00010137, 0x00010137, 0x00010137, 0x00010137, 0x00010137, 0x00010137,
+    0x00ff0125, 0x03ff013c, 0xfdff013b, 0xfdff013b, 0x02ff013a, 0x02ff013a, 0x02ff013a, 0x02ff013a,
+    0xfeff0139, 0xfeff0139, 0xfeff0139, 0xfeff0139, 0xfeff0139, 0xfeff0139, 0xfeff0139, 0xfeff0139,
+    0x01ff0138, 0x01ff0138, 0x01ff0138, 0x01ff0138, 0x01ff0138, 0x01ff0138, 0x01ff0138, 0x01ff0138,
+    0x01ff0138, 0x01ff0138, 0x01ff0138, 0x01ff0138, 0x01ff0138, 0x01ff0138, 0x01ff0138, 0x01ff0138,
+    0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137,
+    0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137,
+    0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137,
+    0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137,
+    0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136,
+    0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136,
+    0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136,
+    0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136,
+    0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136,
+    0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136,
+    0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136,
+    0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136, 0x00ff0136,
+    0x00000124, 0xfc00013c, 0x0300013b, 0x0300013b, 0xfd00013a, 0xfd00013a, 0xfd00013a, 0xfd00013a,
+    0x02000139, 0x02000139, 0x02000139, 0x02000139, 0x02000139, 0x02000139, 0x02000139, 0x02000139,
+    0xfe000138, 0xfe000138, 0xfe000138, 0xfe000138, 0xfe000138, 0xfe000138, 0xfe000138, 0xfe000138,
+    0xfe000138, 0xfe000138, 0xfe000138, 0xfe000138, 0xfe000138, 0xfe000138, 0xfe000138, 0xfe000138,
+    0x01000137, 0x01000137, 0x01000137, 0x01000137, 0x01000137, 0x01000137, 0x01000137, 0x01000137,
+    0x01000137, 0x01000137, 0x01000137, 0x01000137, 0x01000137, 0x01000137, 0x01000137, 0x01000137,
+    0x01000137, 0x01000137, 0x01000137, 0x01000137, 0x01000137, 0x01000137, 0x01000137, 0x01000137,
+    0x01000137, 0x01000137, 0x01000137, 0x01000137, 0x01000137, 0x01000137, 0x01000137, 0x01000137,
+    0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136,
+    0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136,
+    0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136,
+    0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136,
+    0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136,
+    0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136,
+    0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136,
+    0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136, 0xff000136,
+    0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135,
+    0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135,
+    0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135,
+    0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135,
+    0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135,
+    0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135,
+    0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135,
+    0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135,
+    0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135,
+    0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135,
+    0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135,
+    0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135,
+    0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135,
+    0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135,
+    0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135,
+    0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135, 0x00000135,
+    0x0000ff12, 0x00fbff2c, 0x0004ff2b, 0x0004ff3c, 0x00fcff2a, 0xfffcff3c, 0x00fcff3b, 0x00fcff3b,
+    0x0003ff29, 0x0103ff3c, 0xff03ff3b, 0xff03ff3b, 0x0003ff3a, 0x0003ff3a, 0x0003ff3a, 0x0003ff3a,
+    0x00fdff28, 0xfefdff3c, 0x01fdff3b, 0x01fdff3b, 0xfffdff3a, 0xfffdff3a, 0xfffdff3a, 0xfffdff3a,
+    0x00fdff39, 0x00fdff39, 0x00fdff39, 0x00fdff39, 0x00fdff39, 0x00fdff39, 0x00fdff39, 0x00fdff39,
+    0x0002ff27, 0x0202ff3c, 0xfe02ff3b, 0xfe02ff3b, 0x0102ff3a, 0x0102ff3a, 0x0102ff3a, 0x0102ff3a,
+    0xff02ff39, 0xff02ff39, 0xff02ff39, 0xff02ff39, 0xff02ff39, 0xff02ff39, 0xff02ff39, 0xff02ff39,
+    0x0002ff38, 0x0002ff38, 0x0002ff38, 0x0002ff38, 0x0002ff38, 0x0002ff38, 0x0002ff38, 0x0002ff38,
+    0x0002ff38, 0x0002ff38, 0x0002ff38, 0x0002ff38, 0x0002ff38, 0x0002ff38, 0x0002ff38, 0x0002ff38,
+    0x00feff26, 0xfdfeff3c, 0x02feff3b, 0x02feff3b, 0xfefeff3a, 0xfefeff3a, 0xfefeff3a, 0xfefeff3a,
+    0x01feff39, 0x01feff39, 0x01feff39, 0x01feff39, 0x01feff39, 0x01feff39, 0x01feff39, 0x01feff39,
+    0xfffeff38, 0xfffeff38, 0xfffeff38, 0xfffeff38, 0xfffeff38, 0xfffeff38, 0xfffeff38, 0xfffeff38,
+    0xfffeff38, 0xfffeff38, 0xfffeff38, 0xfffeff38, 0xfffeff38, 0xfffeff38, 0xfffeff38, 0xfffeff38,
+    0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37,
+    0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37,
+    0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37,
+    0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37,
+    0x0001ff25, 0x0301ff3c, 0xfd01ff3b, 0xfd01ff3b, 0x0201ff3a, 0x0201ff3a, 0x0201ff3a, 0x0201ff3a,
+    0xfe01ff39, 0xfe01ff39, 0xfe01ff39, 0xfe01ff39, 0xfe01ff39, 0xfe01ff39, 0xfe01ff39, 0xfe01ff39,
+    0x0101ff38, 0x0101ff38, 0x0101ff38, 0x0101ff38, 0x0101ff38, 0x0101ff38, 0x0101ff38, 0x0101ff38,
+    0x0101ff38, 0x0101ff38, 0x0101ff38, 0x0101ff38, 0x0101ff38, 0x0101ff38, 0x0101ff38, 0x0101ff38,
+    0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37,
+    0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37,
+    0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37,
+    0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37,
+    0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36,
+    0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36,
+    0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36,
+    0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36,
+    0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36,
+    0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36,
+    0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36,
+    0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36, 0x0001ff36,
+    0x00ffff24, 0xfcffff3c, 0x03ffff3b, 0x03ffff3b, 0xfdffff3a, 0xfdffff3a, 0xfdffff3a, 0xfdffff3a,
+    0x02ffff39, 0x02ffff39, 0x02ffff39, 0x02ffff39, 0x02ffff39, 0x02ffff39, 0x02ffff39, 0x02ffff39,
+    0xfeffff38, 0xfeffff38, 0xfeffff38, 0xfeffff38, 0xfeffff38, 0xfeffff38, 0xfeffff38, 0xfeffff38,
+    0xfeffff38, 0xfeffff38, 0xfeffff38, 0xfeffff38, 0xfeffff38, 0xfeffff38, 0xfeffff38, 0xfeffff38,
+    0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37,
+    0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37,
+    0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37,
+    0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37,
+    0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36,
+    0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36,
+    0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36,
+    0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36,
+    0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36,
+    0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36,
+    0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36,
+    0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36,
+    0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35,
+    0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35,
+    0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35,
+    0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35,
+    0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35,
+    0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35,
+    0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35,
+    0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35,
+    0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35,
+    0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35,
+    0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35,
+    0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35,
+    0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35,
+    0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35,
+    0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35,
+    0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35, 0x00ffff35,
+    0x0000ff23, 0x0400ff3c, 0xfc00ff3b, 0xfc00ff3b, 0x0300ff3a, 0x0300ff3a, 0x0300ff3a, 0x0300ff3a,
+    0xfd00ff39, 0xfd00ff39, 0xfd00ff39, 0xfd00ff39, 0xfd00ff39, 0xfd00ff39, 0xfd00ff39, 0xfd00ff39,
+    0x0200ff38, 0x0200ff38, 0x0200ff38, 0x0200ff38, 0x0200ff38, 0x0200ff38, 0x0200ff38, 0x0200ff38,
+    0x0200ff38, 0x0200ff38, 0x0200ff38, 0x0200ff38, 0x0200ff38, 0x0200ff38, 0x0200ff38, 0x0200ff38,
+    0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37,
+    0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37,
+    0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37,
+    0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37,
+    0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36,
+    0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36,
+    0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36,
+    0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36,
+    0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36,
+    0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36,
+    0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36,
+    0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36, 0x0100ff36,
+    0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35,
+    0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35,
+    0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35,
+    0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35,
+    0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35,
+    0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35,
+    0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35,
+    0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35,
+    0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35,
+    0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35,
+    0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35,
+    0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35,
+    0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35,
+    0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35,
+    0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35,
+    0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35, 0xff00ff35,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34, 0x0000ff34,
+    0x00000011, 0x0005002c, 0x00fb002b, 0x00fb003c, 0x0004002a, 0xff04003c, 0x0004003b, 0x0004003b,
+    0x00fc0029, 0x01fc003c, 0xfffc003b, 0xfffc003b, 0x00fc003a, 0x00fc003a, 0x00fc003a, 0x00fc003a,
+    0x00030028, 0xfe03003c, 0x0103003b, 0x0103003b, 0xff03003a, 0xff03003a, 0xff03003a, 0xff03003a,
+    0x00030039, 0x00030039, 0x00030039, 0x00030039, 0x00030039, 0x00030039, 0x00030039, 0x00030039,
+    0x00fd0027, 0x02fd003c, 0xfefd003b, 0xfefd003b, 0x01fd003a, 0x01fd003a, 0x01fd003a, 0x01fd003a,
+    0xfffd0039, 0xfffd0039, 0xfffd0039, 0xfffd0039, 0xfffd0039, 0xfffd0039, 0xfffd0039, 0xfffd0039,
+    0x00fd0038, 0x00fd0038, 0x00fd0038, 0x00fd0038, 0x00fd0038, 0x00fd0038, 0x00fd0038, 0x00fd0038,
+    0x00fd0038, 0x00fd0038, 0x00fd0038, 0x00fd0038, 0x00fd0038, 0x00fd0038, 0x00fd0038, 0x00fd0038,
+    0x00020026, 0xfd02003c, 0x0202003b, 0x0202003b, 0xfe02003a, 0xfe02003a, 0xfe02003a, 0xfe02003a,
+    0x01020039, 0x01020039, 0x01020039, 0x01020039, 0x01020039, 0x01020039, 0x01020039, 0x01020039,
+    0xff020038, 0xff020038, 0xff020038, 0xff020038, 0xff020038, 0xff020038, 0xff020038, 0xff020038,
+    0xff020038, 0xff020038, 0xff020038, 0xff020038, 0xff020038, 0xff020038, 0xff020038, 0xff020038,
+    0x00020037, 0x00020037, 0x00020037, 0x00020037, 0x00020037, 0x00020037, 0x00020037, 0x00020037,
+    0x00020037, 0x00020037, 0x00020037, 0x00020037, 0x00020037, 0x00020037, 0x00020037, 0x00020037,
+    0x00020037, 0x00020037, 0x00020037, 0x00020037, 0x00020037, 0x00020037, 0x00020037, 0x00020037,
+    0x00020037, 0x00020037, 0x00020037, 0x00020037, 0x00020037, 0x00020037, 0x00020037, 0x00020037,
+    0x00fe0025, 0x03fe003c, 0xfdfe003b, 0xfdfe003b, 0x02fe003a, 0x02fe003a, 0x02fe003a, 0x02fe003a,
+    0xfefe0039, 0xfefe0039, 0xfefe0039, 0xfefe0039, 0xfefe0039, 0xfefe0039, 0xfefe0039, 0xfefe0039,
+    0x01fe0038, 0x01fe0038, 0x01fe0038, 0x01fe0038, 0x01fe0038, 0x01fe0038, 0x01fe0038, 0x01fe0038,
+    0x01fe0038, 0x01fe0038, 0x01fe0038, 0x01fe0038, 0x01fe0038, 0x01fe0038, 0x01fe0038, 0x01fe0038,
+    0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037,
+    0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037,
+    0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037,
+    0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037,
+    0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036,
+    0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036,
+    0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036,
+    0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036,
+    0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036,
+    0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036,
+    0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036,
+    0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036, 0x00fe0036,
+    0x00010024, 0xfc01003c, 0x0301003b, 0x0301003b, 0xfd01003a, 0xfd01003a, 0xfd01003a, 0xfd01003a,
+    0x02010039, 0x02010039, 0x02010039, 0x02010039, 0x02010039, 0x02010039, 0x02010039, 0x02010039,
+    0xfe010038, 0xfe010038, 0xfe010038, 0xfe010038, 0xfe010038, 0xfe010038, 0xfe010038, 0xfe010038,
+    0xfe010038, 0xfe010038, 0xfe010038, 0xfe010038, 0xfe010038, 0xfe010038, 0xfe010038, 0xfe010038,
+    0x01010037, 0x01010037, 0x01010037, 0x01010037, 0x01010037, 0x01010037, 0x01010037, 0x01010037,
+    0x01010037, 0x01010037, 0x01010037, 0x01010037, 0x01010037, 0x01010037, 0x01010037, 0x01010037,
+    0x01010037, 0x01010037, 0x01010037, 0x01010037, 0x01010037, 0x01010037, 0x01010037, 0x01010037,
+    0x01010037, 0x01010037, 0x01010037, 0x01010037, 0x01010037, 0x01010037, 0x01010037, 0x01010037,
+    0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036,
+    0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036,
+    0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036,
+    0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036,
+    0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036,
+    0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036,
+    0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036,
+    0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036, 0xff010036,
+    0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035,
+    0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035,
+    0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035,
+    0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035,
+    0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035,
+    0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035,
+    0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035,
+    0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035,
+    0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035,
+    0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035,
+    0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035,
+    0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035,
+    0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035,
+    0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035,
+    0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035,
+    0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035, 0x00010035,
+    0x00ff0023, 0x04ff003c, 0xfcff003b, 0xfcff003b, 0x03ff003a, 0x03ff003a, 0x03ff003a, 0x03ff003a,
+    0xfdff0039, 0xfdff0039, 0xfdff0039, 0xfdff0039, 0xfdff0039, 0xfdff0039, 0xfdff0039, 0xfdff0039,
+    0x02ff0038, 0x02ff0038, 0x02ff0038, 0x02ff0038, 0x02ff0038, 0x02ff0038, 0x02ff0038, 0x02ff0038,
+    0x02ff0038, 0x02ff0038, 0x02ff0038, 0x02ff0038, 0x02ff0038, 0x02ff0038, 0x02ff0038, 0x02ff0038,
+    0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037,
+    0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037,
+    0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037,
+    0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037,
+    0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036,
+    0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036,
+    0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036,
+    0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036,
+    0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036,
+    0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036,
+    0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036,
+    0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036, 0x01ff0036,
+    0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035,
+    0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035,
+    0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035,
+    0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035,
+    0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035,
+    0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035,
+    0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035,
+    0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035,
+    0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035,
+    0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035,
+    0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035,
+    0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035,
+    0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035,
+    0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035,
+    0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035,
+    0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035, 0xffff0035,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034, 0x00ff0034,
+    0x00000022, 0xfb00003c, 0x0400003b, 0x0400003b, 0xfc00003a, 0xfc00003a, 0xfc00003a, 0xfc00003a,
+    0x03000039, 0x03000039, 0x03000039, 0x03000039, 0x03000039, 0x03000039, 0x03000039, 0x03000039,
+    0xfd000038, 0xfd000038, 0xfd000038, 0xfd000038, 0xfd000038, 0xfd000038, 0xfd000038, 0xfd000038,
+    0xfd000038, 0xfd000038, 0xfd000038, 0xfd000038, 0xfd000038, 0xfd000038, 0xfd000038, 0xfd000038,
+    0x02000037, 0x02000037, 0x02000037, 0x02000037, 0x02000037, 0x02000037, 0x02000037, 0x02000037,
+    0x02000037, 0x02000037, 0x02000037, 0x02000037, 0x02000037, 0x02000037, 0x02000037, 0x02000037,
+    0x02000037, 0x02000037, 0x02000037, 0x02000037, 0x02000037, 0x02000037, 0x02000037, 0x02000037,
+    0x02000037, 0x02000037, 0x02000037, 0x02000037, 0x02000037, 0x02000037, 0x02000037, 0x02000037,
+    0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036,
+    0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036,
+    0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036,
+    0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036,
+    0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036,
+    0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036,
+    0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036,
+    0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036, 0xfe000036,
+    0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035,
+    0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035,
+    0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035,
+    0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035,
+    0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035,
+    0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035,
+    0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035,
+    0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035,
+    0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035,
+    0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035,
+    0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035,
+    0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035,
+    0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035,
+    0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035,
+    0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035,
+    0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035, 0x01000035,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034, 0xff000034,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+    0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033, 0x00000033,
+  },
+  {
+    0x00000000, 0x00000000, 0x00000a1c, 0x0000f51c, 0x0000091b, 0x0000091b, 0x0000f61b, 0x0000f61b,
+    0x0000081a, 0x0000081a, 0x0000082c, 0x00ff082c, 0x0000f71a, 0x0000f71a, 0x0000f72c, 0x00fff72c,
+    0x00000719, 0x00000719, 0x0001072c, 0x00fe072c, 0x0000072b, 0x0000072b, 0x00ff072b, 0x00ff072b,
+    0x0000f819, 0x0000f819, 0x0001f82c, 0x00fef82c, 0x0000f82b, 0x0000f82b, 0x00fff82b, 0x00fff82b,
+    0x00000618, 0x00000618, 0x0002062c, 0x00fd062c, 0x0001062b, 0x0001062b, 0x00fe062b, 0x00fe062b,
+    0x0000062a, 0x0000062a, 0x0000063c, 0xff00063c, 0x00ff062a, 0x00ff062a, 0x00ff063c, 0xffff063c,
+    0x0000f918, 0x0000f918, 0x0002f92c, 0x00fdf92c, 0x0001f92b, 0x0001f92b, 0x00fef92b, 0x00fef92b,
+    0x0000f92a, 0x0000f92a, 0x0000f93c, 0xff00f93c, 0x00fff92a, 0x00fff92a, 0x00fff93c, 0xfffff93c,
+    0x00000517, 0x00000517, 0x0003052c, 0x00fc052c, 0x0002052b, 0x0002052b, 0x00fd052b, 0x00fd052b,
+    0x0001052a, 0x0001052a, 0x0001053c, 0xff01053c, 0x00fe052a, 0x00fe052a, 0x00fe053c, 0xfffe053c,
+    0x00000529, 0x00000529, 0x0100053c, 0xfe00053c, 0x0000053b, 0x0000053b, 0xff00053b, 0xff00053b,
+    0x00ff0529, 0x00ff0529, 0x01ff053c, 0xfeff053c, 0x00ff053b, 0x00ff053b, 0xffff053b, 0xffff053b,
+    0x0000fa17, 0x0000fa17, 0x0003fa2c, 0x00fcfa2c, 0x0002fa2b, 0x0002fa2b, 0x00fdfa2b, 0x00fdfa2b,
+    0x0001fa2a, 0x0001fa2a, 0x0001fa3c, 0xff01fa3c, 0x00fefa2a, 0x00fefa2a, 0x00fefa3c, 0xfffefa3c,
+    0x0000fa29, 0x0000fa29, 0x0100fa3c, 0xfe00fa3c, 0x0000fa3b, 0x0000fa3b, 0xff00fa3b, 0xff00fa3b,
+    0x00fffa29, 0x00fffa29, 0x01fffa3c, 0xfefffa3c, 0x00fffa3b, 0x00fffa3b, 0xfffffa3b, 0xfffffa3b,
+    0x00000416, 0x00000416, 0x0004042c, 0x00fb042c, 0x0003042b, 0x0003042b, 0x00fc042b, 0x00fc042b,
+    0x0002042a, 0x0002042a, 0x0002043c, 0xff02043c, 0x00fd042a, 0x00fd042a, 0x00fd043c, 0xfffd043c,
+    0x00010429, 0x00010429, 0x0101043c, 0xfe01043c, 0x0001043b, 0x0001043b, 0xff01043b, 0xff01043b,
+    0x00fe0429, 0x00fe0429, 0x01fe043c, 0xfefe043c, 0x00fe043b, 0x00fe043b, 0xfffe043b, 0xfffe043b,
+    0x00000428, 0x00000428, 0x0200043c, 0xfd00043c, 0x0100043b, 0x0100043b, 0xfe00043b, 0xfe00043b,
+    0x0000043a, 0x0000043a, 0x0000043a, 0x0000043a, 0xff00043a, 0xff00043a, 0xff00043a, 0xff00043a,
+    0x00ff0428, 0x00ff0428, 0x02ff043c, 0xfdff043c, 0x01ff043b, 0x01ff043b, 0xfeff043b, 0xfeff043b,
+    0x00ff043a, 0x00ff043a, 0x00ff043a, 0x00ff043a, 0xffff043a, 0xffff043a, 0xffff043a, 0xffff043a,
+    0x0000fb16, 0x0000fb16, 0x0004fb2c, 0x00fbfb2c, 0x0003fb2b, 0x0003fb2b, 0x00fcfb2b, 0x00fcfb2b,
+    0x0002fb2a, 0x0002fb2a, 0x0002fb3c, 0xff02fb3c, 0x00fdfb2a, 0x00fdfb2a, 0x00fdfb3c, 0xfffdfb3c,
+    0x0001fb29, 0x0001fb29, 0x0101fb3c, 0xfe01fb3c, 0x0001fb3b, 0x0001fb3b, 0xff01fb3b, 0xff01fb3b,
+    0x00fefb29, 0x00fefb29, 0x01fefb3c, 0xfefefb3c, 0x00fefb3b, 0x00fefb3b, 0xfffefb3b, 0xfffefb3b,
+    0x0000fb28, 0x0000fb28, 0x0200fb3c, 0xfd00fb3c, 0x0100fb3b, 0x0100fb3b, 0xfe00fb3b, 0xfe00fb3b,
+    0x0000fb3a, 0x0000fb3a, 0x0000fb3a, 0x0000fb3a, 0xff00fb3a, 0xff00fb3a, 0xff00fb3a, 0xff00fb3a,
+    0x00fffb28, 0x00fffb28, 0x02fffb3c, 0xfdfffb3c, 0x01fffb3b, 0x01fffb3b, 0xfefffb3b, 0xfefffb3b,
+    0x00fffb3a, 0x00fffb3a, 0x00fffb3a, 0x00fffb3a, 0xfffffb3a, 0xfffffb3a, 0xfffffb3a, 0xfffffb3a,
+    0x00000315, 0x00000315, 0x0005032c, 0x00fa032c, 0x0004032b, 0x0004032b, 0x00fb032b, 0x00fb032b,
+    0x0003032a, 0x0003032a, 0x0003033c, 0xff03033c, 0x00fc032a, 0x00fc032a, 0x00fc033c, 0xfffc033c,
+    0x00020329, 0x00020329, 0x0102033c, 0xfe02033c, 0x0002033b, 0x0002033b, 0xff02033b, 0xff02033b,
+    0x00fd0329, 0x00fd0329, 0x01fd033c, 0xfefd033c, 0x00fd033b, 0x00fd033b, 0xfffd033b, 0xfffd033b,
+    0x00010328, 0x00010328, 0x0201033c, 0xfd01033c, 0x0101033b, 0x0101033b, 0xfe01033b, 0xfe01033b,
+    0x0001033a, 0x0001033a, 0x0001033a, 0x0001033a, 0xff01033a, 0xff01033a, 0xff01033a, 0xff01033a,
+    0x00fe0328, 0x00fe0328, 0x02fe033c, 0xfdfe033c, 0x01fe033b, 0x01fe033b, 0xfefe033b, 0xfefe033b,
+    0x00fe033a, 0x00fe033a, 0x00fe033a, 0x00fe033a, 0xfffe033a, 0xfffe033a, 0xfffe033a, 0xfffe033a,
+    0x00000327, 0x00000327, 0x0300033c, 0xfc00033c, 0x0200033b, 0x0200033b, 0xfd00033b, 0xfd00033b,
+    0x0100033a, 0x0100033a, 0x0100033a, 0x0100033a, 0xfe00033a, 0xfe00033a, 0xfe00033a, 0xfe00033a,
+    0x00000339, 0x00000339, 0x00000339, 0x00000339, 0x00000339, 0x00000339, 0x00000339, 0x00000339,
+    0xff000339, 0xff000339, 0xff000339, 0xff000339, 0xff000339, 0xff000339, 0xff000339, 0xff000339,
+    0x00ff0327, 0x00ff0327, 0x03ff033c, 0xfcff033c, 0x02ff033b, 0x02ff033b, 0xfdff033b, 0xfdff033b,
+    0x01ff033a, 0x01ff033a, 0x01ff033a, 0x01ff033a, 0xfeff033a, 0xfeff033a, 0xfeff033a, 0xfeff033a,
+    0x00ff0339, 0x00ff0339, 0x00ff0339, 0x00ff0339, 0x00ff0339, 0x00ff0339, 0x00ff0339, 0x00ff0339,
+    0xffff0339, 0xffff0339, 0xffff0339, 0xffff0339, 0xffff0339, 0xffff0339, 0xffff0339, 0xffff0339,
+    0x0000fc15, 0x0000fc15, 0x0005fc2c, 0x00fafc2c, 0x0004fc2b, 0x0004fc2b, 0x00fbfc2b, 0x00fbfc2b,
+    0x0003fc2a, 0x0003fc2a, 0x0003fc3c, 0xff03fc3c, 0x00fcfc2a, 0x00fcfc2a, 0x00fcfc3c, 0xfffcfc3c,
+    0x0002fc29, 0x0002fc29, 0x0102fc3c, 0xfe02fc3c, 0x0002fc3b, 0x0002fc3b, 0xff02fc3b, 0xff02fc3b,
+    0x00fdfc29, 0x00fdfc29, 0x01fdfc3c, 0xfefdfc3c, 0x00fdfc3b, 0x00fdfc3b, 0xfffdfc3b, 0xfffdfc3b,
+    0x0001fc28, 0x0001fc28, 0x0201fc3c, 0xfd01fc3c, 0x0101fc3b, 0x0101fc3b, 0xfe01fc3b, 0xfe01fc3b,
+    0x0001fc3a, 0x0001fc3a, 0x0001fc3a, 0x0001fc3a, 0xff01fc3a, 0xff01fc3a, 0xff01fc3a, 0xff01fc3a,
+    0x00fefc28, 0x00fefc28, 0x02fefc3c, 0xfdfefc3c, 0x01fefc3b, 0x01fefc3b, 0xfefefc3b, 0xfefefc3b,
+    0x00fefc3a, 0x00fefc3a, 0x00fefc3a, 0x00fefc3a, 0xfffefc3a, 0xfffefc3a, 0xfffefc3a, 0xfffefc3a,
+    0x0000fc27, 0x0000fc27, 0x0300fc3c, 0xfc00fc3c, 0x0200fc3b, 0x0200fc3b, 0xfd00fc3b, 0xfd00fc3b,
+    0x0100fc3a, 0x0100fc3a, 0x0100fc3a, 0x0100fc3a, 0xfe00fc3a, 0xfe00fc3a, 0xfe00fc3a, 0xfe00fc3a,
+    0x0000fc39, 0x0000fc39, 0x0000fc39, 0x0000fc39, 0x0000fc39, 0x0000fc39, 0x0000fc39, 0x0000fc39,
+    0xff00fc39, 0xff00fc39, 0xff00fc39, 0xff00fc39, 0xff00fc39, 0xff00fc39, 0xff00fc39, 0xff00fc39,
+    0x00fffc27, 0x00fffc27, 0x03fffc3c, 0xfcfffc3c, 0x02fffc3b, 0x02fffc3b, 0xfdfffc3b, 0xfdfffc3b,
+    0x01fffc3a, 0x01fffc3a, 0x01fffc3a, 0x01fffc3a, 0xfefffc3a, 0xfefffc3a, 0xfefffc3a, 0xfefffc3a,
+    0x00fffc39, 0x00fffc39, 0x00fffc39, 0x00fffc39, 0x00fffc39, 0x00fffc39, 0x00fffc39, 0x00fffc39,
+    0xfffffc39, 0xfffffc39, 0xfffffc39, 0xfffffc39, 0xfffffc39, 0xfffffc39, 0xfffffc39, 0xfffffc39,
+    0x00000214, 0x00000214, 0x0006022c, 0x00f9022c, 0x0005022b, 0x0005022b, 0x00fa022b, 0x00fa022b,
+    0x0004022a, 0x0004022a, 0x0004023c, 0xff04023c, 0x00fb022a, 0x00fb022a, 0x00fb023c, 0xfffb023c,
+    0x00030229, 0x00030229, 0x0103023c, 0xfe03023c, 0x0003023b, 0x0003023b, 0xff03023b, 0xff03023b,
+    0x00fc0229, 0x00fc0229, 0x01fc023c, 0xfefc023c, 0x00fc023b, 0x00fc023b, 0xfffc023b, 0xfffc023b,
+    0x00020228, 0x00020228, 0x0202023c, 0xfd02023c, 0x0102023b, 0x0102023b, 0xfe02023b, 0xfe02023b,
+    0x0002023a, 0x0002023a, 0x0002023a, 0x0002023a, 0xff02023a, 0xff02023a, 0xff02023a, 0xff02023a,
+    0x00fd0228, 0x00fd0228, 0x02fd023c, 0xfdfd023c, 0x01fd023b, 0x01fd023b, 0xfefd023b, 0xfefd023b,
+    0x00fd023a, 0x00fd023a, 0x00fd023a, 0x00fd023a, 0xfffd023a, 0xfffd023a, 0xfffd023a, 0xfffd023a,
+    0x00010227, 0x00010227, 0x0301023c, 0xfc01023c, 0x0201023b, 0x0201023b, 0xfd01023b, 0xfd01023b,
+    0x0101023a, 0x0101023a, 0x0101023a, 0x0101023a, 0xfe01023a, 0xfe01023a, 0xfe01023a, 0xfe01023a,
+    0x00010239, 0x00010239, 0x00010239, 0x00010239, 0x00010239, 0x00010239, 0x00010239, 0x00010239,
+    0xff010239, 0xff010239, 0xff010239, 0xff010239, 0xff010239, 0xff010239, 0xff010239, 0xff010239,
+    0x00fe0227, 0x00fe0227, 0x03fe023c, 0xfcfe023c, 0x02fe023b, 0x02fe023b, 0xfdfe023b, 0xfdfe023b,
+    0x01fe023a, 0x01fe023a, 0x01fe023a, 0x01fe023a, 0xfefe023a, 0xfefe023a, 0xfefe023a, 0xfefe023a,
+    0x00fe0239, 0x00fe0239, 0x00fe0239, 0x00fe0239, 0x00fe0239, 0x00fe0239, 0x00fe0239, 0x00fe0239,
+    0xfffe0239, 0xfffe0239, 0xfffe0239, 0xfffe0239, 0xfffe0239, 0xfffe0239, 0xfffe0239, 0xfffe0239,
+    0x00000226, 0x00000226, 0x0400023c, 0xfb00023c, 0x0300023b, 0x0300023b, 0xfc00023b, 0xfc00023b,
+    0x0200023a, 0x0200023a, 0x0200023a, 0x0200023a, 0xfd00023a, 0xfd00023a, 0xfd00023a, 0xfd00023a,
+    0x01000239, 0x01000239, 0x01000239, 0x01000239, 0x01000239, 0x01000239, 0x01000239, 0x01000239,
+    0xfe000239, 0xfe000239, 0xfe000239, 0xfe000239, 0xfe000239, 0xfe000239, 0xfe000239, 0xfe000239,
+    0x00000238, 0x00000238, 0x00000238, 0x00000238, 0x00000238, 0x00000238, 0x00000238, 0x00000238,
+    0x00000238, 0x00000238, 0x00000238, 0x00000238, 0x00000238, 0x00000238, 0x00000238, 0x00000238,
+    0xff000238, 0xff000238, 0xff000238, 0xff000238, 0xff000238, 0xff000238, 0xff000238, 0xff000238,
+    0xff000238, 0xff000238, 0xff000238, 0xff000238, 0xff000238, 0xff000238, 0xff000238, 0xff000238,
+    0x00ff0226, 0x00ff0226, 0x04ff023c, 0xfbff023c, 0x03ff023b, 0x03ff023b, 0xfcff023b, 0xfcff023b,
+    0x02ff023a, 0x02ff023a, 0x02ff023a, 0x02ff023a, 0xfdff023a, 0xfdff023a, 0xfdff023a, 0xfdff023a,
+    0x01ff0239, 0x01ff0239, 0x01ff0239, 0x01ff0239, 0x01ff0239, 0x01ff0239, 0x01ff0239, 0x01ff0239,
+    0xfeff0239, 0xfeff0239, 0xfeff0239, 0xfeff0239, 0xfeff0239, 0xfeff0239, 0xfeff0239, 0xfeff0239,
+    0x00ff0238, 0x00ff0238, 0x00ff0238, 0x00ff0238, 0x00ff0238, 0x00ff0238, 0x00ff0238, 0x00ff0238,
+    0x00ff0238, 0x00ff0238, 0x00ff0238, 0x00ff0238, 0x00ff0238, 0x00ff0238, 0x00ff0238, 0x00ff0238,
+    0xffff0238, 0xffff0238, 0xffff0238, 0xffff0238, 0xffff0238, 0xffff0238, 0xffff0238, 0xffff0238,
+    0xffff0238, 0xffff0238, 0xffff0238, 0xffff0238, 0xffff0238, 0xffff0238, 0xffff0238, 0xffff0238,
+    0x0000fd14, 0x0000fd14, 0x0006fd2c, 0x00f9fd2c, 0x0005fd2b, 0x0005fd2b, 0x00fafd2b, 0x00fafd2b,
+    0x0004fd2a, 0x0004fd2a, 0x0004fd3c, 0xff04fd3c, 0x00fbfd2a, 0x00fbfd2a, 0x00fbfd3c, 0xfffbfd3c,
+    0x0003fd29, 0x0003fd29, 0x0103fd3c, 0xfe03fd3c, 0x0003fd3b, 0x0003fd3b, 0xff03fd3b, 0xff03fd3b,
+    0x00fcfd29, 0x00fcfd29, 0x01fcfd3c, 0xfefcfd3c, 0x00fcfd3b, 0x00fcfd3b, 0xfffcfd3b, 0xfffcfd3b,
+    0x0002fd28, 0x0002fd28, 0x0202fd3c, 0xfd02fd3c, 0x0102fd3b, 0x0102fd3b, 0xfe02fd3b, 0xfe02fd3b,
+    0x0002fd3a, 0x0002fd3a, 0x0002fd3a, 0x0002fd3a, 0xff02fd3a, 0xff02fd3a, 0xff02fd3a, 0xff02fd3a,
+    0x00fdfd28, 0x00fdfd28, 0x02fdfd3c, 0xfdfdfd3c, 0x01fdfd3b, 0x01fdfd3b, 0xfefdfd3b, 0xfefdfd3b,
+    0x00fdfd3a, 0x00fdfd3a, 0x00fdfd3a, 0x00fdfd3a, 0xfffdfd3a, 0xfffdfd3a, 0xfffdfd3a, 0xfffdfd3a,
+    0x0001fd27, 0x0001fd27, 0x0301fd3c, 0xfc01fd3c, 0x0201fd3b, 0x0201fd3b, 0xfd01fd3b, 0xfd01fd3b,
+    0x0101fd3a, 0x0101fd3a, 0x0101fd3a, 0x0101fd3a, 0xfe01fd3a, 0xfe01fd3a, 0xfe01fd3a, 0xfe01fd3a,
+    0x0001fd39, 0x0001fd39, 0x0001fd39, 0x0001fd39, 0x0001fd39, 0x0001fd39, 0x0001fd39, 0x0001fd39,
+    0xff01fd39, 0xff01fd39, 0xff01fd39, 0xff01fd39, 0xff01fd39, 0xff01fd39, 0xff01fd39, 0xff01fd39,
+    0x00fefd27, 0x00fefd27, 0x03fefd3c, 0xfcfefd3c, 0x02fefd3b, 0x02fefd3b, 0xfdfefd3b, 0xfdfefd3b,
+    0x01fefd3a, 0x01fefd3a, 0x01fefd3a, 0x01fefd3a, 0xfefefd3a, 0xfefefd3a, 0xfefefd3a, 0xfefefd3a,
+    0x00fefd39, 0x00fefd39, 0x00fefd39, 0x00fefd39, 0x00fefd39, 0x00fefd39, 0x00fefd39, 0x00fefd39,
+    0xfffefd39, 0xfffefd39, 0xfffefd39, 0xfffefd39, 0xfffefd39, 0xfffefd39, 0xfffefd39, 0xfffefd39,
+    0x0000fd26, 0x0000fd26, 0x0400fd3c, 0xfb00fd3c, 0x0300fd3b, 0x0300fd3b, 0xfc00fd3b, 0xfc00fd3b,
+    0x0200fd3a, 0x0200fd3a, 0x0200fd3a, 0x0200fd3a, 0xfd00fd3a, 0xfd00fd3a, 0xfd00fd3a, 0xfd00fd3a,
+    0x0100fd39, 0x0100fd39, 0x0100fd39, 0x0100fd39, 0x0100fd39, 0x0100fd39, 0x0100fd39, 0x0100fd39,
+    0xfe00fd39, 0xfe00fd39, 0xfe00fd39, 0xfe00fd39, 0xfe00fd39, 0xfe00fd39, 0xfe00fd39, 0xfe00fd39,
+    0x0000fd38, 0x0000fd38, 0x0000fd38, 0x0000fd38, 0x0000fd38, 0x0000fd38, 0x0000fd38, 0x0000fd38,
+    0x0000fd38, 0x0000fd38, 0x0000fd38, 0x0000fd38, 0x0000fd38, 0x0000fd38, 0x0000fd38, 0x0000fd38,
+    0xff00fd38, 0xff00fd38, 0xff00fd38, 0xff00fd38, 0xff00fd38, 0xff00fd38, 0xff00fd38, 0xff00fd38,
+    0xff00fd38, 0xff00fd38, 0xff00fd38, 0xff00fd38, 0xff00fd38, 0xff00fd38, 0xff00fd38, 0xff00fd38,
+    0x00fffd26, 0x00fffd26, 0x04fffd3c, 0xfbfffd3c, 0x03fffd3b, 0x03fffd3b, 0xfcfffd3b, 0xfcfffd3b,
+    0x02fffd3a, 0x02fffd3a, 0x02fffd3a, 0x02fffd3a, 0xfdfffd3a, 0xfdfffd3a, 0xfdfffd3a, 0xfdfffd3a,
+    0x01fffd39, 0x01fffd39, 0x01fffd39, 0x01fffd39, 0x01fffd39, 0x01fffd39, 0x01fffd39, 0x01fffd39,
+    0xfefffd39, 0xfefffd39, 0xfefffd39, 0xfefffd39, 0xfefffd39, 0xfefffd39, 0xfefffd39, 0xfefffd39,
+    0x00fffd38, 0x00fffd38, 0x00fffd38, 0x00fffd38, 0x00fffd38, 0x00fffd38, 0x00fffd38, 0x00fffd38,
+    0x00fffd38, 0x00fffd38, 0x00fffd38, 0x00fffd38, 0x00fffd38, 0x00fffd38, 0x00fffd38, 0x00fffd38,
+    0xfffffd38, 0xfffffd38, 0xfffffd38, 0xfffffd38, 0xfffffd38, 0xfffffd38, 0xfffffd38, 0xfffffd38,
+    0xfffffd38, 0xfffffd38, 0xfffffd38, 0xfffffd38, 0xfffffd38, 0xfffffd38, 0xfffffd38, 0xfffffd38,
+    0x00000113, 0x00000113, 0x0007012c, 0x00f8012c, 0x0006012b, 0x0006012b, 0x00f9012b, 0x00f9012b,
+    0x0005012a, 0x0005012a, 0x0005013c, 0xff05013c, 0x00fa012a, 0x00fa012a, 0x00fa013c, 0xfffa013c,
+    0x00040129, 0x00040129, 0x0104013c, 0xfe04013c, 0x0004013b, 0x0004013b, 0xff04013b, 0xff04013b,
+    0x00fb0129, 0x00fb0129, 0x01fb013c, 0xfefb013c, 0x00fb013b, 0x00fb013b, 0xfffb013b, 0xfffb013b,
+    0x00030128, 0x00030128, 0x0203013c, 0xfd03013c, 0x0103013b, 0x0103013b, 0xfe03013b, 0xfe03013b,
+    0x0003013a, 0x0003013a, 0x0003013a, 0x0003013a, 0xff03013a, 0xff03013a, 0xff03013a, 0xff03013a,
+    0x00fc0128, 0x00fc0128, 0x02fc013c, 0xfdfc013c, 0x01fc013b, 0x01fc013b, 0xfefc013b, 0xfefc013b,
+    0x00fc013a, 0x00fc013a, 0x00fc013a, 0x00fc013a, 0xfffc013a, 0xfffc013a, 0xfffc013a, 0xfffc013a,
+    0x00020127, 0x00020127, 0x0302013c, 0xfc02013c, 0x0202013b, 0x0202013b, 0xfd02013b, 0xfd02013b,
+    0x0102013a, 0x0102013a, 0x0102013a, 0x0102013a, 0xfe02013a, 0xfe02013a, 0xfe02013a, 0xfe02013a,
+    0x00020139, 0x00020139, 0x00020139, 0x00020139, 0x00020139, 0x00020139, 0x00020139, 0x00020139,
+    0xff020139, 0xff020139, 0xff020139, 0xff020139, 0xff020139, 0xff020139, 0xff020139, 0xff020139,
+    0x00fd0127, 0x00fd0127, 0x03fd013c, 0xfcfd013c, 0x02fd013b, 0x02fd013b, 0xfdfd013b, 0xfdfd013b,
+    0x01fd013a, 0x01fd013a, 0x01fd013a, 0x01fd013a, 0xfefd013a, 0xfefd013a, 0xfefd013a, 0xfefd013a,
+    0x00fd0139, 0x00fd0139, 0x00fd0139, 0x00fd0139, 0x00fd0139, 0x00fd0139, 0x00fd0139, 0x00fd0139,
+    0xfffd0139, 0xfffd0139, 0xfffd0139, 0xfffd0139, 0xfffd0139, 0xfffd0139, 0xfffd0139, 0xfffd0139,
+    0x00010126, 0x00010126, 0x0401013c, 0xfb01013c, 0x0301013b, 0x0301013b, 0xfc01013b, 0xfc01013b,
+    0x0201013a, 0x0201013a, 0x0201013a, 0x0201013a, 0xfd01013a, 0xfd01013a, 0xfd01013a, 0xfd01013a,
+    0x01010139, 0x01010139, 0x01010139, 0x01010139, 0x01010139, 0x01010139, 0x01010139, 0x01010139,
+    0xfe010139, 0xfe010139, 0xfe010139, 0xfe010139, 0xfe010139, 0xfe010139, 0xfe010139, 0xfe010139,
+    0x00010138, 0x00010138, 0x00010138, 0x00010138, 0x00010138, 0x00010138, 0x00010138, 0x00010138,
+    0x00010138, 0x00010138, 0x00010138, 0x00010138, 0x00010138, 0x00010138, 0x00010138, 0x00010138,
+    0xff010138, 0xff010138, 0xff010138, 0xff010138, 0xff010138, 0xff010138, 0xff010138, 0xff010138,
+    0xff010138, 0xff010138, 0xff010138, 0xff010138, 0xff010138, 0xff010138, 0xff010138, 0xff010138,
+    0x00fe0126, 0x00fe0126, 0x04fe013c, 0xfbfe013c, 0x03fe013b, 0x03fe013b, 0xfcfe013b, 0xfcfe013b,
+    0x02fe013a, 0x02fe013a, 0x02fe013a, 0x02fe013a, 0xfdfe013a, 0xfdfe013a, 0xfdfe013a, 0xfdfe013a,
+    0x01fe0139, 0x01fe0139, 0x01fe0139, 0x01fe0139, 0x01fe0139, 0x01fe0139, 0x01fe0139, 0x01fe0139,
+    0xfefe0139, 0xfefe0139, 0xfefe0139, 0xfefe0139, 0xfefe0139, 0xfefe0139, 0xfefe0139, 0xfefe0139,
+    0x00fe0138, 0x00fe0138, 0x00fe0138, 0x00fe0138, 0x00fe0138, 0x00fe0138, 0x00fe0138, 0x00fe0138,
+    0x00fe0138, 0x00fe0138, 0x00fe0138, 0x00fe0138, 0x00fe0138, 0x00fe0138, 0x00fe0138, 0x00fe0138,
+    0xfffe0138, 0xfffe0138, 0xfffe0138, 0xfffe0138, 0xfffe0138, 0xfffe0138, 0xfffe0138, 0xfffe0138,
+    0xfffe0138, 0xfffe0138, 0xfffe0138, 0xfffe0138, 0xfffe0138, 0xfffe0138, 0xfffe0138, 0xfffe0138,
+    0x00000125, 0x00000125, 0x0500013c, 0xfa00013c, 0x0400013b, 0x0400013b, 0xfb00013b, 0xfb00013b,
+    0x0300013a, 0x0300013a, 0x0300013a, 0x0300013a, 0xfc00013a, 0xfc00013a, 0xfc00013a, 0xfc00013a,
+    0x02000139, 0x02000139, 0x02000139, 0x02000139, 0x02000139, 0x02000139, 0x02000139, 0x02000139,
+    0xfd000139, 0xfd000139, 0xfd000139, 0xfd000139, 0xfd000139, 0xfd000139, 0xfd000139, 0xfd000139,
+    0x01000138, 0x01000138, 0x01000138, 0x01000138, 0x01000138, 0x01000138, 0x01000138, 0x01000138,
+    0x01000138, 0x01000138, 0x01000138, 0x01000138, 0x01000138, 0x01000138, 0x01000138, 0x01000138,
+    0xfe000138, 0xfe000138, 0xfe000138, 0xfe000138, 0xfe000138, 0xfe000138, 0xfe000138, 0xfe000138,
+    0xfe000138, 0xfe000138, 0xfe000138, 0xfe000138, 0xfe000138, 0xfe000138, 0xfe000138, 0xfe000138,
+    0x00000137, 0x00000137, 0x00000137, 0x00000137, 0x00000137, 0x00000137, 0x00000137, 0x00000137,
+    0x00000137, 0x00000137, 0x00000137, 0x00000137, 0x00000137, 0x00000137, 0x00000137, 0x00000137,
+    0x00000137, 0x00000137, 0x00000137, 0x00000137, 0x00000137, 0x00000137, 0x00000137, 0x00000137,
+    0x00000137, 0x00000137, 0x00000137, 0x00000137, 0x00000137, 0x00000137, 0x00000137, 0x00000137,
+    0xff000137, 0xff000137, 0xff000137, 0xff000137, 0xff000137, 0xff000137, 0xff000137, 0xff000137,
+    0xff000137, 0xff000137, 0xff000137, 0xff000137, 0xff000137, 0xff000137, 0xff000137, 0xff000137,
+    0xff000137, 0xff000137, 0xff000137, 0xff000137, 0xff000137, 0xff000137, 0xff000137, 0xff000137,
+    0xff000137, 0xff000137, 0xff000137, 0xff000137, 0xff000137, 0xff000137, 0xff000137, 0xff000137,
+    0x00ff0125, 0x00ff0125, 0x05ff013c, 0xfaff013c, 0x04ff013b, 0x04ff013b, 0xfbff013b, 0xfbff013b,
+    0x03ff013a, 0x03ff013a, 0x03ff013a, 0x03ff013a, 0xfcff013a, 0xfcff013a, 0xfcff013a, 0xfcff013a,
+    0x02ff0139, 0x02ff0139, 0x02ff0139, 0x02ff0139, 0x02ff0139, 0x02ff0139, 0x02ff0139, 0x02ff0139,
+    0xfdff0139, 0xfdff0139, 0xfdff0139, 0xfdff0139, 0xfdff0139, 0xfdff0139, 0xfdff0139, 0xfdff0139,
+    0x01ff0138, 0x01ff0138, 0x01ff0138, 0x01ff0138, 0x01ff0138, 0x01ff0138, 0x01ff0138, 0x01ff0138,
+    0x01ff0138, 0x01ff0138, 0x01ff0138, 0x01ff0138, 0x01ff0138, 0x01ff0138, 0x01ff0138, 0x01ff0138,
+    0xfeff0138, 0xfeff0138, 0xfeff0138, 0xfeff0138, 0xfeff0138, 0xfeff0138, 0xfeff0138, 0xfeff0138,
+    0xfeff0138, 0xfeff0138, 0xfeff0138, 0xfeff0138, 0xfeff0138, 0xfeff0138, 0xfeff0138, 0xfeff0138,
+    0x00ff0137, 0x00ff0137, 0x00ff0137, 0x00ff0137, 0x00ff0137, 0x00ff0137, 0x00ff0137, 0x00ff0137,
+    0x00ff0137, 0x00ff0137, 0x00ff0137, 0x00ff0137, 0x00ff0137, 0x00ff0137, 0x00ff0137, 0x00ff0137,
+    0x00ff0137, 0x00ff0137, 0x00ff0137, 0x00ff0137, 0x00ff0137, 0x00ff0137, 0x00ff0137, 0x00ff0137,
+    0x00ff0137, 0x00ff0137, 0x00ff0137, 0x00ff0137, 0x00ff0137, 0x00ff0137, 0x00ff0137, 0x00ff0137,
+    0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137,
+    0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137,
+    0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137,
+    0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137, 0xffff0137,
+    0x0000fe13, 0x0000fe13, 0x0007fe2c, 0x00f8fe2c, 0x0006fe2b, 0x0006fe2b, 0x00f9fe2b, 0x00f9fe2b,
+    0x0005fe2a, 0x0005fe2a, 0x0005fe3c, 0xff05fe3c, 0x00fafe2a, 0x00fafe2a, 0x00fafe3c, 0xfffafe3c,
+    0x0004fe29, 0x0004fe29, 0x0104fe3c, 0xfe04fe3c, 0x0004fe3b, 0x0004fe3b, 0xff04fe3b, 0xff04fe3b,
+    0x00fbfe29, 0x00fbfe29, 0x01fbfe3c, 0xfefbfe3c, 0x00fbfe3b, 0x00fbfe3b, 0xfffbfe3b, 0xfffbfe3b,
+    0x0003fe28, 0x0003fe28, 0x0203fe3c, 0xfd03fe3c, 0x0103fe3b, 0x0103fe3b, 0xfe03fe3b, 0xfe03fe3b,
+    0x0003fe3a, 0x0003fe3a, 0x0003fe3a, 0x0003fe3a, 0xff03fe3a, 0xff03fe3a, 0xff03fe3a, 0xff03fe3a,
+    0x00fcfe28, 0x00fcfe28, 0x02fcfe3c, 0xfdfcfe3c, 0x01fcfe3b, 0x01fcfe3b, 0xfefcfe3b, 0xfefcfe3b,
+    0x00fcfe3a, 0x00fcfe3a, 0x00fcfe3a, 0x00fcfe3a, 0xfffcfe3a, 0xfffcfe3a, 0xfffcfe3a, 0xfffcfe3a,
+    0x0002fe27, 0x0002fe27, 0x0302fe3c, 0xfc02fe3c, 0x0202fe3b, 0x0202fe3b, 0xfd02fe3b, 0xfd02fe3b,
+    0x0102fe3a, 0x0102fe3a, 0x0102fe3a, 0x0102fe3a, 0xfe02fe3a, 0xfe02fe3a, 0xfe02fe3a, 0xfe02fe3a,
+    0x0002fe39, 0x0002fe39, 0x0002fe39, 0x0002fe39, 0x0002fe39, 0x0002fe39, 0x0002fe39, 0x0002fe39,
+    0xff02fe39, 0xff02fe39, 0xff02fe39, 0xff02fe39, 0xff02fe39, 0xff02fe39, 0xff02fe39, 0xff02fe39,
+    0x00fdfe27, 0x00fdfe27, 0x03fdfe3c, 0xfcfdfe3c, 0x02fdfe3b, 0x02fdfe3b, 0xfdfdfe3b, 0xfdfdfe3b,
+    0x01fdfe3a, 0x01fdfe3a, 0x01fdfe3a, 0x01fdfe3a, 0xfefdfe3a, 0xfefdfe3a, 0xfefdfe3a, 0xfefdfe3a,
+    0x00fdfe39, 0x00fdfe39, 0x00fdfe39, 0x00fdfe39, 0x00fdfe39, 0x00fdfe39, 0x00fdfe39, 0x00fdfe39,
+    0xfffdfe39, 0xfffdfe39, 0xfffdfe39, 0xfffdfe39, 0xfffdfe39, 0xfffdfe39, 0xfffdfe39, 0xfffdfe39,
+    0x0001fe26, 0x0001fe26, 0x0401fe3c, 0xfb01fe3c, 0x0301fe3b, 0x0301fe3b, 0xfc01fe3b, 0xfc01fe3b,
+    0x0201fe3a, 0x0201fe3a, 0x0201fe3a, 0x0201fe3a, 0xfd01fe3a, 0xfd01fe3a, 0xfd01fe3a, 0xfd01fe3a,
+    0x0101fe39, 0x0101fe39, 0x0101fe39, 0x0101fe39, 0x0101fe39, 0x0101fe39, 0x0101fe39, 0x0101fe39,
+    0xfe01fe39, 0xfe01fe39, 0xfe01fe39, 0xfe01fe39, 0xfe01fe39, 0xfe01fe39, 0xfe01fe39, 0xfe01fe39,
+    0x0001fe38, 0x0001fe38, 0x0001fe38, 0x0001fe38, 0x0001fe38, 0x0001fe38, 0x0001fe38, 0x0001fe38,
+    0x0001fe38, 0x0001fe38, 0x0001fe38, 0x0001fe38, 0x0001fe38, 0x0001fe38, 0x0001fe38, 0x0001fe38,
+    0xff01fe38, 0xff01fe38, 0xff01fe38, 0xff01fe38, 0xff01fe38, 0xff01fe38, 0xff01fe38, 0xff01fe38,
+    0xff01fe38, 0xff01fe38, 0xff01fe38, 0xff01fe38, 0xff01fe38, 0xff01fe38, 0xff01fe38, 0xff01fe38,
+    0x00fefe26, 0x00fefe26, 0x04fefe3c, 0xfbfefe3c, 0x03fefe3b, 0x03fefe3b, 0xfcfefe3b, 0xfcfefe3b,
+    0x02fefe3a, 0x02fefe3a, 0x02fefe3a, 0x02fefe3a, 0xfdfefe3a, 0xfdfefe3a, 0xfdfefe3a, 0xfdfefe3a,
+    0x01fefe39, 0x01fefe39, 0x01fefe39, 0x01fefe39, 0x01fefe39, 0x01fefe39, 0x01fefe39, 0x01fefe39,
+    0xfefefe39, 0xfefefe39, 0xfefefe39, 0xfefefe39, 0xfefefe39, 0xfefefe39, 0xfefefe39, 0xfefefe39,
+    0x00fefe38, 0x00fefe38, 0x00fefe38, 0x00fefe38, 0x00fefe38, 0x00fefe38, 0x00fefe38, 0x00fefe38,
+    0x00fefe38, 0x00fefe38, 0x00fefe38, 0x00fefe38, 0x00fefe38, 0x00fefe38, 0x00fefe38, 0x00fefe38,
+    0xfffefe38, 0xfffefe38, 0xfffefe38, 0xfffefe38, 0xfffefe38, 0xfffefe38, 0xfffefe38, 0xfffefe38,
+    0xfffefe38, 0xfffefe38, 0xfffefe38, 0xfffefe38, 0xfffefe38, 0xfffefe38, 0xfffefe38, 0xfffefe38,
+    0x0000fe25, 0x0000fe25, 0x0500fe3c, 0xfa00fe3c, 0x0400fe3b, 0x0400fe3b, 0xfb00fe3b, 0xfb00fe3b,
+    0x0300fe3a, 0x0300fe3a, 0x0300fe3a, 0x0300fe3a, 0xfc00fe3a, 0xfc00fe3a, 0xfc00fe3a, 0xfc00fe3a,
+    0x0200fe39, 0x0200fe39, 0x0200fe39, 0x0200fe39, 0x0200fe39, 0x0200fe39, 0x0200fe39, 0x0200fe39,
+    0xfd00fe39, 0xfd00fe39, 0xfd00fe39, 0xfd00fe39, 0xfd00fe39, 0xfd00fe39, 0xfd00fe39, 0xfd00fe39,
+    0x0100fe38, 0x0100fe38, 0x0100fe38, 0x0100fe38, 0x0100fe38, 0x0100fe38, 0x0100fe38, 0x0100fe38,
+    0x0100fe38, 0x0100fe38, 0x0100fe38, 0x0100fe38, 0x0100fe38, 0x0100fe38, 0x0100fe38, 0x0100fe38,
+    0xfe00fe38, 0xfe00fe38, 0xfe00fe38, 0xfe00fe38, 0xfe00fe38, 0xfe00fe38, 0xfe00fe38, 0xfe00fe38,
+    0xfe00fe38, 0xfe00fe38, 0xfe00fe38, 0xfe00fe38, 0xfe00fe38, 0xfe00fe38, 0xfe00fe38, 0xfe00fe38,
+    0x0000fe37, 0x0000fe37, 0x0000fe37, 0x0000fe37, 0x0000fe37, 0x0000fe37, 0x0000fe37, 0x0000fe37,
+    0x0000fe37, 0x0000fe37, 0x0000fe37, 0x0000fe37, 0x0000fe37, 0x0000fe37, 0x0000fe37, 0x0000fe37,
+    0x0000fe37, 0x0000fe37, 0x0000fe37, 0x0000fe37, 0x0000fe37, 0x0000fe37, 0x0000fe37, 0x0000fe37,
+    0x0000fe37, 0x0000fe37, 0x0000fe37, 0x0000fe37, 0x0000fe37, 0x0000fe37, 0x0000fe37, 0x0000fe37,
+    0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37,
+    0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37,
+    0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37,
+    0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37, 0xff00fe37,
+    0x00fffe25, 0x00fffe25, 0x05fffe3c, 0xfafffe3c, 0x04fffe3b, 0x04fffe3b, 0xfbfffe3b, 0xfbfffe3b,
+    0x03fffe3a, 0x03fffe3a, 0x03fffe3a, 0x03fffe3a, 0xfcfffe3a, 0xfcfffe3a, 0xfcfffe3a, 0xfcfffe3a,
+    0x02fffe39, 0x02fffe39, 0x02fffe39, 0x02fffe39, 0x02fffe39, 0x02fffe39, 0x02fffe39, 0x02fffe39,
+    0xfdfffe39, 0xfdfffe39, 0xfdfffe39, 0xfdfffe39, 0xfdfffe39, 0xfdfffe39, 0xfdfffe39, 0xfdfffe39,
+    0x01fffe38, 0x01fffe38, 0x01fffe38, 0x01fffe38, 0x01fffe38, 0x01fffe38, 0x01fffe38, 0x01fffe38,
+    0x01fffe38, 0x01fffe38, 0x01fffe38, 0x01fffe38, 0x01fffe38, 0x01fffe38, 0x01fffe38, 0x01fffe38,
+    0xfefffe38, 0xfefffe38, 0xfefffe38, 0xfefffe38, 0xfefffe38, 0xfefffe38, 0xfefffe38, 0xfefffe38,
+    0xfefffe38, 0xfefffe38, 0xfefffe38, 0xfefffe38, 0xfefffe38, 0xfefffe38, 0xfefffe38, 0xfefffe38,
+    0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37,
+    0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37,
+    0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37,
+    0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37, 0x00fffe37,
+    0xfffffe37, 0xfffffe37, 0xfffffe37, 0xfffffe37, 0xfffffe37, 0xfffffe37, 0xfffffe37, 0xfffffe37,
+    0xfffffe37, 0xfffffe37, 0xfffffe37, 0xfffffe37, 0xfffffe37, 0xfffffe37, 0xfffffe37, 0xfffffe37,
+    0xfffffe37, 0xfffffe37, 0xfffffe37, 0xfffffe37, 0xfffffe37, 0xfffffe37, 0xfffffe37, 0xfffffe37,
+    0xfffffe37, 0xfffffe37, 0xfffffe37, 0xfffffe37, 0xfffffe37, 0xfffffe37, 0xfffffe37, 0xfffffe37,
+    0x00000012, 0x00000012, 0x0008002c, 0x00f7002c, 0x0007002b, 0x0007002b, 0x00f8002b, 0x00f8002b,
+    0x0006002a, 0x0006002a, 0x0006003c, 0xff06003c, 0x00f9002a, 0x00f9002a, 0x00f9003c, 0xfff9003c,
+    0x00050029, 0x00050029, 0x0105003c, 0xfe05003c, 0x0005003b, 0x0005003b, 0xff05003b, 0xff05003b,
+    0x00fa0029, 0x00fa0029, 0x01fa003c, 0xfefa003c, 0x00fa003b, 0x00fa003b, 0xfffa003b, 0xfffa003b,
+    0x00040028, 0x00040028, 0x0204003c, 0xfd04003c, 0x0104003b, 0x0104003b, 0xfe04003b, 0xfe04003b,
+    0x0004003a, 0x0004003a, 0x0004003a, 0x0004003a, 0xff04003a, 0xff04003a, 0xff04003a, 0xff04003a,
+    0x00fb0028, 0x00fb0028, 0x02fb003c, 0xfdfb003c, 0x01fb003b, 0x01fb003b, 0xfefb003b, 0xfefb003b,
+    0x00fb003a, 0x00fb003a, 0x00fb003a, 0x00fb003a, 0xfffb003a, 0xfffb003a, 0xfffb003a, 0xfffb003a,
+    0x00030027, 0x00030027, 0x0303003c, 0xfc03003c, 0x0203003b, 0x0203003b, 0xfd03003b, 0xfd03003b,
+    0x0103003a, 0x0103003a, 0x0103003a, 0x0103003a, 0xfe03003a, 0xfe03003a, 0xfe03003a, 0xfe03003a,
+    0x00030039, 0x00030039, 0x00030039, 0x00030039, 0x00030039, 0x00030039, 0x00030039, 0x00030039,
+    0xff030039, 0xff030039, 0xff030039, 0xff030039, 0xff030039, 0xff030039, 0xff030039, 0xff030039,
+    0x00fc0027, 0x00fc0027, 0x03fc003c, 0xfcfc003c, 0x02fc003b, 0x02fc003b, 0xfdfc003b, 0xfdfc003b,
+    0x01fc003a, 0x01fc003a, 0x01fc003a, 0x01fc003a, 0xfefc003a, 0xfefc003a, 0xfefc003a, 0xfefc003a,
+    0x00fc0039, 0x00fc0039, 0x00fc0039, 0x00fc0039, 0x00fc0039, 0x00fc0039, 0x00fc0039, 0x00fc0039,
+    0xfffc0039, 0xfffc0039, 0xfffc0039, 0xfffc0039, 0xfffc0039, 0xfffc0039, 0xfffc0039, 0xfffc0039,
+    0x00020026, 0x00020026, 0x0402003c, 0xfb02003c, 0x0302003b, 0x0302003b, 0xfc02003b, 0xfc02003b,
+    0x0202003a, 0x0202003a, 0x0202003a, 0x0202003a, 0xfd02003a, 0xfd02003a, 0xfd02003a, 0xfd02003a,
+    0x01020039, 0x01020039, 0x01020039, 0x01020039, 0x01020039, 0x01020039, 0x01020039, 0x01020039,
+    0xfe020039, 0xfe020039, 0xfe020039, 0xfe020039, 0xfe020039, 0xfe020039, 0xfe020039, 0xfe020039,
+    0x00020038, 0x00020038, 0x00020038, 0x00020038, 0x00020038, 0x00020038, 0x00020038, 0x00020038,
+    0x00020038, 0x00020038, 0x00020038, 0x00020038, 0x00020038, 0x00020038, 0x00020038, 0x00020038,
+    0xff020038, 0xff020038, 0xff020038, 0xff020038, 0xff020038, 0xff020038, 0xff020038, 0xff020038,
+    0xff020038, 0xff020038, 0xff020038, 0xff020038, 0xff020038, 0xff020038, 0xff020038, 0xff020038,
+    0x00fd0026, 0x00fd0026, 0x04fd003c, 0xfbfd003c, 0x03fd003b, 0x03fd003b, 0xfcfd003b, 0xfcfd003b,
+    0x02fd003a, 0x02fd003a, 0x02fd003a, 0x02fd003a, 0xfdfd003a, 0xfdfd003a, 0xfdfd003a, 0xfdfd003a,
+    0x01fd0039, 0x01fd0039, 0x01fd0039, 0x01fd0039, 0x01fd0039, 0x01fd0039, 0x01fd0039, 0x01fd0039,
+    0xfefd0039, 0xfefd0039, 0xfefd0039, 0xfefd0039, 0xfefd0039, 0xfefd0039, 0xfefd0039, 0xfefd0039,
+    0x00fd0038, 0x00fd0038, 0x00fd0038, 0x00fd0038, 0x00fd0038, 0x00fd0038, 0x00fd0038, 0x00fd0038,
+    0x00fd0038, 0x00fd0038, 0x00fd0038, 0x00fd0038, 0x00fd0038, 0x00fd0038, 0x00fd0038, 0x00fd0038,
+    0xfffd0038, 0xfffd0038, 0xfffd0038, 0xfffd0038, 0xfffd0038, 0xfffd0038, 0xfffd0038, 0xfffd0038,
+    0xfffd0038, 0xfffd0038, 0xfffd0038, 0xfffd0038, 0xfffd0038, 0xfffd0038, 0xfffd0038, 0xfffd0038,
+    0x00010025, 0x00010025, 0x0501003c, 0xfa01003c, 0x0401003b, 0x0401003b, 0xfb01003b, 0xfb01003b,
+    0x0301003a, 0x0301003a, 0x0301003a, 0x0301003a, 0xfc01003a, 0xfc01003a, 0xfc01003a, 0xfc01003a,
+    0x02010039, 0x02010039, 0x02010039, 0x02010039, 0x02010039, 0x02010039, 0x02010039, 0x02010039,
+    0xfd010039, 0xfd010039, 0xfd010039, 0xfd010039, 0xfd010039, 0xfd010039, 0xfd010039, 0xfd010039,
+    0x01010038, 0x01010038, 0x01010038, 0x01010038, 0x01010038, 0x01010038, 0x01010038, 0x01010038,
+    0x01010038, 0x01010038, 0x01010038, 0x01010038, 0x01010038, 0x01010038, 0x01010038, 0x01010038,
+    0xfe010038, 0xfe010038, 0xfe010038, 0xfe010038, 0xfe010038, 0xfe010038, 0xfe010038, 0xfe010038,
+    0xfe010038, 0xfe010038, 0xfe010038, 0xfe010038, 0xfe010038, 0xfe010038, 0xfe010038, 0xfe010038,
+    0x00010037, 0x00010037, 0x00010037, 0x00010037, 0x00010037, 0x00010037, 0x00010037, 0x00010037,
+    0x00010037, 0x00010037, 0x00010037, 0x00010037, 0x00010037, 0x00010037, 0x00010037, 0x00010037,
+    0x00010037, 0x00010037, 0x00010037, 0x00010037, 0x00010037, 0x00010037, 0x00010037, 0x00010037,
+    0x00010037, 0x00010037, 0x00010037, 0x00010037, 0x00010037, 0x00010037, 0x00010037, 0x00010037,
+    0xff010037, 0xff010037, 0xff010037, 0xff010037, 0xff010037, 0xff010037, 0xff010037, 0xff010037,
+    0xff010037, 0xff010037, 0xff010037, 0xff010037, 0xff010037, 0xff010037, 0xff010037, 0xff010037,
+    0xff010037, 0xff010037, 0xff010037, 0xff010037, 0xff010037, 0xff010037, 0xff010037, 0xff010037,
+    0xff010037, 0xff010037, 0xff010037, 0xff010037, 0xff010037, 0xff010037, 0xff010037, 0xff010037,
+    0x00fe0025, 0x00fe0025, 0x05fe003c, 0xfafe003c, 0x04fe003b, 0x04fe003b, 0xfbfe003b, 0xfbfe003b,
+    0x03fe003a, 0x03fe003a, 0x03fe003a, 0x03fe003a, 0xfcfe003a, 0xfcfe003a, 0xfcfe003a, 0xfcfe003a,
+    0x02fe0039, 0x02fe0039, 0x02fe0039, 0x02fe0039, 0x02fe0039, 0x02fe0039, 0x02fe0039, 0x02fe0039,
+    0xfdfe0039, 0xfdfe0039, 0xfdfe0039, 0xfdfe0039, 0xfdfe0039, 0xfdfe0039, 0xfdfe0039, 0xfdfe0039,
+    0x01fe0038, 0x01fe0038, 0x01fe0038, 0x01fe0038, 0x01fe0038, 0x01fe0038, 0x01fe0038, 0x01fe0038,
+    0x01fe0038, 0x01fe0038, 0x01fe0038, 0x01fe0038, 0x01fe0038, 0x01fe0038, 0x01fe0038, 0x01fe0038,
+    0xfefe0038, 0xfefe0038, 0xfefe0038, 0xfefe0038, 0xfefe0038, 0xfefe0038, 0xfefe0038, 0xfefe0038,
+    0xfefe0038, 0xfefe0038, 0xfefe0038, 0xfefe0038, 0xfefe0038, 0xfefe0038, 0xfefe0038, 0xfefe0038,
+    0x00fe0037, 0x00fe0037, 0x00fe0037, 0x00fe0037, 0x00fe0037, 0x00fe0037, 0x00fe0037, 0x00fe0037,
+    0x00fe0037, 0x00fe0037, 0x00fe0037, 0x00fe0037, 0x00fe0037, 0x00fe0037, 0x00fe0037, 0x00fe0037,
+    0x00fe0037, 0x00fe0037, 0x00fe0037, 0x00fe0037, 0x00fe0037, 0x00fe0037, 0x00fe0037, 0x00fe0037,
+    0x00fe0037, 0x00fe0037, 0x00fe0037, 0x00fe0037, 0x00fe0037, 0x00fe0037, 0x00fe0037, 0x00fe0037,
+    0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037,
+    0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037,
+    0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037,
+    0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037, 0xfffe0037,
+    0x00000024, 0x00000024, 0x0600003c, 0xf900003c, 0x0500003b, 0x0500003b, 0xfa00003b, 0xfa00003b,
+    0x0400003a, 0x0400003a, 0x0400003a, 0x0400003a, 0xfb00003a, 0xfb00003a, 0xfb00003a, 0xfb00003a,
+    0x03000039, 0x03000039, 0x03000039, 0x03000039, 0x03000039, 0x03000039, 0x03000039, 0x03000039,
+    0xfc000039, 0xfc000039, 0xfc000039, 0xfc000039, 0xfc000039, 0xfc000039, 0xfc000039, 0xfc000039,
+    0x02000038, 0x02000038, 0x02000038, 0x02000038, 0x02000038, 0x02000038, 0x02000038, 0x02000038,
+    0x02000038, 0x02000038, 0x02000038, 0x02000038, 0x02000038, 0x02000038, 0x02000038, 0x02000038,
+    0xfd000038, 0xfd000038, 0xfd000038, 0xfd000038, 0xfd000038, 0xfd000038, 0xfd000038, 0xfd000038,
+    0xfd000038, 0xfd000038, 0xfd000038, 0xfd000038, 0xfd000038, 0xfd000038, 0xfd000038, 0xfd000038,
+    0x01000037, 0x01000037, 0x01000037, 0x01000037, 0x01000037, 0x01000037, 0x01000037, 0x01000037,
+    0x01000037, 0x01000037, 0x01000037, 0x01000037, 0x01000037, 0x01000037, 0x01000037, 0x01000037,
+    0x01000037, 0x01000037, 0x01000037, 0x01000037, 0x01000037, 0x01000037, 0x01000037, 0x01000037,
+    0x01000037, 0x01000037, 0x01000037, 0x01000037, 0x01000037, 0x01000037, 0x01000037, 0x01000037,
+    0xfe000037, 0xfe000037, 0xfe000037, 0xfe000037, 0xfe000037, 0xfe000037, 0xfe000037, 0xfe000037,
+    0xfe000037, 0xfe000037, 0xfe000037, 0xfe000037, 0xfe000037, 0xfe000037, 0xfe000037, 0xfe000037,
+    0xfe000037, 0xfe000037, 0xfe000037, 0xfe000037, 0xfe000037, 0xfe000037, 0xfe000037, 0xfe000037,
+    0xfe000037, 0xfe000037, 0xfe000037, 0xfe000037, 0xfe000037, 0xfe000037, 0xfe000037, 0xfe000037,
+    0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036,
+    0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036,
+    0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036,
+    0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036,
+    0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036,
+    0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036,
+    0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036,
+    0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036, 0x00000036,
+    0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036,
+    0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036,
+    0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036,
+    0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036,
+    0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036,
+    0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036,
+    0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036,
+    0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036, 0xff000036,
+    0x00ff0024, 0x00ff0024, 0x06ff003c, 0xf9ff003c, 0x05ff003b, 0x05ff003b, 0xfaff003b, 0xfaff003b,
+    0x04ff003a, 0x04ff003a, 0x04ff003a, 0x04ff003a, 0xfbff003a, 0xfbff003a, 0xfbff003a, 0xfbff003a,
+    0x03ff0039, 0x03ff0039, 0x03ff0039, 0x03ff0039, 0x03ff0039, 0x03ff0039, 0x03ff0039, 0x03ff0039,
+    0xfcff0039, 0xfcff0039, 0xfcff0039, 0xfcff0039, 0xfcff0039, 0xfcff0039, 0xfcff0039, 0xfcff0039,
+    0x02ff0038, 0x02ff0038, 0x02ff0038, 0x02ff0038, 0x02ff0038, 0x02ff0038, 0x02ff0038, 0x02ff0038,
+    0x02ff0038, 0x02ff0038, 0x02ff0038, 0x02ff0038, 0x02ff0038, 0x02ff0038, 0x02ff0038, 0x02ff0038,
+    0xfdff0038, 0xfdff0038, 0xfdff0038, 0xfdff0038, 0xfdff0038, 0xfdff0038, 0xfdff0038, 0xfdff0038,
+    0xfdff0038, 0xfdff0038, 0xfdff0038, 0xfdff0038, 0xfdff0038, 0xfdff0038, 0xfdff0038, 0xfdff0038,
+    0x01ff0037, 0x01ff0037, 0x01ff0037, 0x01ff0037, 0x01ff0037, 0x01ff0037, 0x01ff0037, 0x01ff0037,
+    0x01ff0037, 0x01ff0037, 0x01ff0037, 0x01ff0037, 0x01ff0037, 0x01ff0037, 0x01ff0037, 0x01ff0037,
+    0x01ff0037, 0x01ff0037, 0x01ff0037, 0x01ff0037, 0x01ff0037, 0x01ff0037, 0x01ff0037, 0x01ff0037,
+    0x01ff0037, 0x01ff0037, 0x01ff0037, 0x01ff0037, 0x01ff0037, 0x01ff0037, 0x01ff0037, 0x01ff0037,
+    0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037,
+    0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037,
+    0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037,
+    0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037, 0xfeff0037,
+    0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036,
+    0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036,
+    0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036,
+    0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036,
+    0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036,
+    0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036,
+    0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036,
+    0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036, 0x00ff0036,
+    0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036,
+    0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036,
+    0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036,
+    0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036,
+    0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036,
+    0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036,
+    0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036,
+    0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036, 0xffff0036,
+    0x0000ff12, 0x0000ff12, 0x0008ff2c, 0x00f7ff2c, 0x0007ff2b, 0x0007ff2b, 0x00f8ff2b, 0x00f8ff2b,
+    0x0006ff2a, 0x0006ff2a, 0x0006ff3c, 0xff06ff3c, 0x00f9ff2a, 0x00f9ff2a, 0x00f9ff3c, 0xfff9ff3c,
+    0x0005ff29, 0x0005ff29, 0x0105ff3c, 0xfe05ff3c, 0x0005ff3b, 0x0005ff3b, 0xff05ff3b, 0xff05ff3b,
+    0x00faff29, 0x00faff29, 0x01faff3c, 0xfefaff3c, 0x00faff3b, 0x00faff3b, 0xfffaff3b, 0xfffaff3b,
+    0x0004ff28, 0x0004ff28, 0x0204ff3c, 0xfd04ff3c, 0x0104ff3b, 0x0104ff3b, 0xfe04ff3b, 0xfe04ff3b,
+    0x0004ff3a, 0x0004ff3a, 0x0004ff3a, 0x0004ff3a, 0xff04ff3a, 0xff04ff3a, 0xff04ff3a, 0xff04ff3a,
+    0x00fbff28, 0x00fbff28, 0x02fbff3c, 0xfdfbff3c, 0x01fbff3b, 0x01fbff3b, 0xfefbff3b, 0xfefbff3b,
+    0x00fbff3a, 0x00fbff3a, 0x00fbff3a, 0x00fbff3a, 0xfffbff3a, 0xfffbff3a, 0xfffbff3a, 0xfffbff3a,
+    0x0003ff27, 0x0003ff27, 0x0303ff3c, 0xfc03ff3c, 0x0203ff3b, 0x0203ff3b, 0xfd03ff3b, 0xfd03ff3b,
+    0x0103ff3a, 0x0103ff3a, 0x0103ff3a, 0x0103ff3a, 0xfe03ff3a, 0xfe03ff3a, 0xfe03ff3a, 0xfe03ff3a,
+    0x0003ff39, 0x0003ff39, 0x0003ff39, 0x0003ff39, 0x0003ff39, 0x0003ff39, 0x0003ff39, 0x0003ff39,
+    0xff03ff39, 0xff03ff39, 0xff03ff39, 0xff03ff39, 0xff03ff39, 0xff03ff39, 0xff03ff39, 0xff03ff39,
+    0x00fcff27, 0x00fcff27, 0x03fcff3c, 0xfcfcff3c, 0x02fcff3b, 0x02fcff3b, 0xfdfcff3b, 0xfdfcff3b,
+    0x01fcff3a, 0x01fcff3a, 0x01fcff3a, 0x01fcff3a, 0xfefcff3a, 0xfefcff3a, 0xfefcff3a, 0xfefcff3a,
+    0x00fcff39, 0x00fcff39, 0x00fcff39, 0x00fcff39, 0x00fcff39, 0x00fcff39, 0x00fcff39, 0x00fcff39,
+    0xfffcff39, 0xfffcff39, 0xfffcff39, 0xfffcff39, 0xfffcff39, 0xfffcff39, 0xfffcff39, 0xfffcff39,
+    0x0002ff26, 0x0002ff26, 0x0402ff3c, 0xfb02ff3c, 0x0302ff3b, 0x0302ff3b, 0xfc02ff3b, 0xfc02ff3b,
+    0x0202ff3a, 0x0202ff3a, 0x0202ff3a, 0x0202ff3a, 0xfd02ff3a, 0xfd02ff3a, 0xfd02ff3a, 0xfd02ff3a,
+    0x0102ff39, 0x0102ff39, 0x0102ff39, 0x0102ff39, 0x0102ff39, 0x0102ff39, 0x0102ff39, 0x0102ff39,
+    0xfe02ff39, 0xfe02ff39, 0xfe02ff39, 0xfe02ff39, 0xfe02ff39, 0xfe02ff39, 0xfe02ff39, 0xfe02ff39,
+    0x0002ff38, 0x0002ff38, 0x0002ff38, 0x0002ff38, 0x0002ff38, 0x0002ff38, 0x0002ff38, 0x0002ff38,
+    0x0002ff38, 0x0002ff38, 0x0002ff38, 0x0002ff38, 0x0002ff38, 0x0002ff38, 0x0002ff38, 0x0002ff38,
+    0xff02ff38, 0xff02ff38, 0xff02ff38, 0xff02ff38, 0xff02ff38, 0xff02ff38, 0xff02ff38, 0xff02ff38,
+    0xff02ff38, 0xff02ff38, 0xff02ff38, 0xff02ff38, 0xff02ff38, 0xff02ff38, 0xff02ff38, 0xff02ff38,
+    0x00fdff26, 0x00fdff26, 0x04fdff3c, 0xfbfdff3c, 0x03fdff3b, 0x03fdff3b, 0xfcfdff3b, 0xfcfdff3b,
+    0x02fdff3a, 0x02fdff3a, 0x02fdff3a, 0x02fdff3a, 0xfdfdff3a, 0xfdfdff3a, 0xfdfdff3a, 0xfdfdff3a,
+    0x01fdff39, 0x01fdff39, 0x01fdff39, 0x01fdff39, 0x01fdff39, 0x01fdff39, 0x01fdff39, 0x01fdff39,
+    0xfefdff39, 0xfefdff39, 0xfefdff39, 0xfefdff39, 0xfefdff39, 0xfefdff39, 0xfefdff39, 0xfefdff39,
+    0x00fdff38, 0x00fdff38, 0x00fdff38, 0x00fdff38, 0x00fdff38, 0x00fdff38, 0x00fdff38, 0x00fdff38,
+    0x00fdff38, 0x00fdff38, 0x00fdff38, 0x00fdff38, 0x00fdff38, 0x00fdff38, 0x00fdff38, 0x00fdff38,
+    0xfffdff38, 0xfffdff38, 0xfffdff38, 0xfffdff38, 0xfffdff38, 0xfffdff38, 0xfffdff38, 0xfffdff38,
+    0xfffdff38, 0xfffdff38, 0xfffdff38, 0xfffdff38, 0xfffdff38, 0xfffdff38, 0xfffdff38, 0xfffdff38,
+    0x0001ff25, 0x0001ff25, 0x0501ff3c, 0xfa01ff3c, 0x0401ff3b, 0x0401ff3b, 0xfb01ff3b, 0xfb01ff3b,
+    0x0301ff3a, 0x0301ff3a, 0x0301ff3a, 0x0301ff3a, 0xfc01ff3a, 0xfc01ff3a, 0xfc01ff3a, 0xfc01ff3a,
+    0x0201ff39, 0x0201ff39, 0x0201ff39, 0x0201ff39, 0x0201ff39, 0x0201ff39, 0x0201ff39, 0x0201ff39,
+    0xfd01ff39, 0xfd01ff39, 0xfd01ff39, 0xfd01ff39, 0xfd01ff39, 0xfd01ff39, 0xfd01ff39, 0xfd01ff39,
+    0x0101ff38, 0x0101ff38, 0x0101ff38, 0x0101ff38, 0x0101ff38, 0x0101ff38, 0x0101ff38, 0x0101ff38,
+    0x0101ff38, 0x0101ff38, 0x0101ff38, 0x0101ff38, 0x0101ff38, 0x0101ff38, 0x0101ff38, 0x0101ff38,
+    0xfe01ff38, 0xfe01ff38, 0xfe01ff38, 0xfe01ff38, 0xfe01ff38, 0xfe01ff38, 0xfe01ff38, 0xfe01ff38,
+    0xfe01ff38, 0xfe01ff38, 0xfe01ff38, 0xfe01ff38, 0xfe01ff38, 0xfe01ff38, 0xfe01ff38, 0xfe01ff38,
+    0x0001ff37, 0x0001ff37, 0x0001ff37, 0x0001ff37, 0x0001ff37, 0x0001ff37, 0x0001ff37, 0x0001ff37,
+    0x0001ff37, 0x0001ff37, 0x0001ff37, 0x0001ff37, 0x0001ff37, 0x0001ff37, 0x0001ff37, 0x0001ff37,
+    0x0001ff37, 0x0001ff37, 0x0001ff37, 0x0001ff37, 0x0001ff37, 0x0001ff37, 0x0001ff37, 0x0001ff37,
+    0x0001ff37, 0x0001ff37, 0x0001ff37, 0x0001ff37, 0x0001ff37, 0x0001ff37, 0x0001ff37, 0x0001ff37,
+    0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37,
+    0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37,
+    0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37,
+    0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37, 0xff01ff37,
+    0x00feff25, 0x00feff25, 0x05feff3c, 0xfafeff3c, 0x04feff3b, 0x04feff3b, 0xfbfeff3b, 0xfbfeff3b,
+    0x03feff3a, 0x03feff3a, 0x03feff3a, 0x03feff3a, 0xfcfeff3a, 0xfcfeff3a, 0xfcfeff3a, 0xfcfeff3a,
+    0x02feff39, 0x02feff39, 0x02feff39, 0x02feff39, 0x02feff39, 0x02feff39, 0x02feff39, 0x02feff39,
+    0xfdfeff39, 0xfdfeff39, 0xfdfeff39, 0xfdfeff39, 0xfdfeff39, 0xfdfeff39, 0xfdfeff39, 0xfdfeff39,
+    0x01feff38, 0x01feff38, 0x01feff38, 0x01feff38, 0x01feff38, 0x01feff38, 0x01feff38, 0x01feff38,
+    0x01feff38, 0x01feff38, 0x01feff38, 0x01feff38, 0x01feff38, 0x01feff38, 0x01feff38, 0x01feff38,
+    0xfefeff38, 0xfefeff38, 0xfefeff38, 0xfefeff38, 0xfefeff38, 0xfefeff38, 0xfefeff38, 0xfefeff38,
+    0xfefeff38, 0xfefeff38, 0xfefeff38, 0xfefeff38, 0xfefeff38, 0xfefeff38, 0xfefeff38, 0xfefeff38,
+    0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37,
+    0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37,
+    0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37,
+    0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37, 0x00feff37,
+    0xfffeff37, 0xfffeff37, 0xfffeff37, 0xfffeff37, 0xfffeff37, 0xfffeff37, 0xfffeff37, 0xfffeff37,
+    0xfffeff37, 0xfffeff37, 0xfffeff37, 0xfffeff37, 0xfffeff37, 0xfffeff37, 0xfffeff37, 0xfffeff37,
+    0xfffeff37, 0xfffeff37, 0xfffeff37, 0xfffeff37, 0xfffeff37, 0xfffeff37, 0xfffeff37, 0xfffeff37,
+    0xfffeff37, 0xfffeff37, 0xfffeff37, 0xfffeff37, 0xfffeff37, 0xfffeff37, 0xfffeff37, 0xfffeff37,
+    0x0000ff24, 0x0000ff24, 0x0600ff3c, 0xf900ff3c, 0x0500ff3b, 0x0500ff3b, 0xfa00ff3b, 0xfa00ff3b,
+    0x0400ff3a, 0x0400ff3a, 0x0400ff3a, 0x0400ff3a, 0xfb00ff3a, 0xfb00ff3a, 0xfb00ff3a, 0xfb00ff3a,
+    0x0300ff39, 0x0300ff39, 0x0300ff39, 0x0300ff39, 0x0300ff39, 0x0300ff39, 0x0300ff39, 0x0300ff39,
+    0xfc00ff39, 0xfc00ff39, 0xfc00ff39, 0xfc00ff39, 0xfc00ff39, 0xfc00ff39, 0xfc00ff39, 0xfc00ff39,
+    0x0200ff38, 0x0200ff38, 0x0200ff38, 0x0200ff38, 0x0200ff38, 0x0200ff38, 0x0200ff38, 0x0200ff38,
+    0x0200ff38, 0x0200ff38, 0x0200ff38, 0x0200ff38, 0x0200ff38, 0x0200ff38, 0x0200ff38, 0x0200ff38,
+    0xfd00ff38, 0xfd00ff38, 0xfd00ff38, 0xfd00ff38, 0xfd00ff38, 0xfd00ff38, 0xfd00ff38, 0xfd00ff38,
+    0xfd00ff38, 0xfd00ff38, 0xfd00ff38, 0xfd00ff38, 0xfd00ff38, 0xfd00ff38, 0xfd00ff38, 0xfd00ff38,
+    0x0100ff37, 0x0100ff37, 0x0100ff37, 0x0100ff37, 0x0100ff37, 0x0100ff37, 0x0100ff37, 0x0100ff37,
+    0x0100ff37, 0x0100ff37, 0x0100ff37, 0x0100ff37, 0x0100ff37, 0x0100ff37, 0x0100ff37, 0x0100ff37,
+    0x0100ff37, 0x0100ff37, 0x0100ff37, 0x0100ff37, 0x0100ff37, 0x0100ff37, 0x0100ff37, 0x0100ff37,
+    0x0100ff37, 0x0100ff37, 0x0100ff37, 0x0100ff37, 0x0100ff37, 0x0100ff37, 0x0100ff37, 0x0100ff37,
+    0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37,
+    0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37,
+    0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37,
+    0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37, 0xfe00ff37,
+    0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36,
+    0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36,
+    0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36,
+    0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36,
+    0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36,
+    0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36,
+    0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36,
+    0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36, 0x0000ff36,
+    0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36,
+    0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36,
+    0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36,
+    0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36,
+    0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36,
+    0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36,
+    0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36,
+    0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36, 0xff00ff36,
+    0x00ffff24, 0x00ffff24, 0x06ffff3c, 0xf9ffff3c, 0x05ffff3b, 0x05ffff3b, 0xfaffff3b, 0xfaffff3b,
+    0x04ffff3a, 0x04ffff3a, 0x04ffff3a, 0x04ffff3a, 0xfbffff3a, 0xfbffff3a, 0xfbffff3a, 0xfbffff3a,
+    0x03ffff39, 0x03ffff39, 0x03ffff39, 0x03ffff39, 0x03ffff39, 0x03ffff39, 0x03ffff39, 0x03ffff39,
+    0xfcffff39, 0xfcffff39, 0xfcffff39, 0xfcffff39, 0xfcffff39, 0xfcffff39, 0xfcffff39, 0xfcffff39,
+    0x02ffff38, 0x02ffff38, 0x02ffff38, 0x02ffff38, 0x02ffff38, 0x02ffff38, 0x02ffff38, 0x02ffff38,
+    0x02ffff38, 0x02ffff38, 0x02ffff38, 0x02ffff38, 0x02ffff38, 0x02ffff38, 0x02ffff38, 0x02ffff38,
+    0xfdffff38, 0xfdffff38, 0xfdffff38, 0xfdffff38, 0xfdffff38, 0xfdffff38, 0xfdffff38, 0xfdffff38,
+    0xfdffff38, 0xfdffff38, 0xfdffff38, 0xfdffff38, 0xfdffff38, 0xfdffff38, 0xfdffff38, 0xfdffff38,
+    0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37,
+    0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37,
+    0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37,
+    0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37, 0x01ffff37,
+    0xfeffff37, 0xfeffff37, 0xfeffff37, 0xfeffff37, 0xfeffff37, 0xfeffff37, 0xfeffff37, 0xfeffff37,
+    0xfeffff37, 0xfeffff37, 0xfeffff37, 0xfeffff37, 0xfeffff37, 0xfeffff37, 0xfeffff37, 0xfeffff37,
+    0xfeffff37, 0xfeffff37, 0xfeffff37, 0xfeffff37, 0xfeffff37, 0xfeffff37, 0xfeffff37, 0xfeffff37,
+    0xfeffff37, 0xfeffff37, 0xfeffff37, 0xfeffff37, 0xfeffff37, 0xfeffff37, 0xfeffff37, 0xfeffff37,
+    0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36,
+    0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36,
+    0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36,
+    0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36,
+    0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36,
+    0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36,
+    0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36,
+    0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36, 0x00ffff36,
+    0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36,
+    0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36,
+    0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36,
+    0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36,
+    0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36,
+    0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36,
+    0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36,
+    0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36, 0xffffff36,
+  },
+  {
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x0000121c, 0x0000ed1c, 0x0000131c, 0x0000ec1c,
+    0x0000101b, 0x0000101b, 0x0000ef1b, 0x0000ef1b, 0x0000111b, 0x0000111b, 0x0000ee1b, 0x0000ee1b,
+    0x00000e1a, 0x00000e1a, 0x00000e1a, 0x00000e1a, 0x0000f11a, 0x0000f11a, 0x0000f11a, 0x0000f11a,
+    0x00000f1a, 0x00000f1a, 0x00000f1a, 0x00000f1a, 0x0000f01a, 0x0000f01a, 0x0000f01a, 0x0000f01a,
+    0x00000c19, 0x00000c19, 0x00000c19, 0x00000c19, 0x00000c2c, 0x00ff0c2c, 0x00010c2c, 0x00fe0c2c,
+    0x0000f319, 0x0000f319, 0x0000f319, 0x0000f319, 0x0000f32c, 0x00fff32c, 0x0001f32c, 0x00fef32c,
+    0x00000d19, 0x00000d19, 0x00000d19, 0x00000d19, 0x00000d2c, 0x00ff0d2c, 0x00010d2c, 0x00fe0d2c,
+    0x0000f219, 0x0000f219, 0x0000f219, 0x0000f219, 0x0000f22c, 0x00fff22c, 0x0001f22c, 0x00fef22c,
+    0x00000a18, 0x00000a18, 0x00000a18, 0x00000a18, 0x00020a2c, 0x00fd0a2c, 0x00030a2c, 0x00fc0a2c,
+    0x00000a2b, 0x00000a2b, 0x00ff0a2b, 0x00ff0a2b, 0x00010a2b, 0x00010a2b, 0x00fe0a2b, 0x00fe0a2b,
+    0x0000f518, 0x0000f518, 0x0000f518, 0x0000f518, 0x0002f52c, 0x00fdf52c, 0x0003f52c, 0x00fcf52c,
+    0x0000f52b, 0x0000f52b, 0x00fff52b, 0x00fff52b, 0x0001f52b, 0x0001f52b, 0x00fef52b, 0x00fef52b,
+    0x00000b18, 0x00000b18, 0x00000b18, 0x00000b18, 0x00020b2c, 0x00fd0b2c, 0x00030b2c, 0x00fc0b2c,
+    0x00000b2b, 0x00000b2b, 0x00ff0b2b, 0x00ff0b2b, 0x00010b2b, 0x00010b2b, 0x00fe0b2b, 0x00fe0b2b,
+    0x0000f418, 0x0000f418, 0x0000f418, 0x0000f418, 0x0002f42c, 0x00fdf42c, 0x0003f42c, 0x00fcf42c,
+    0x0000f42b, 0x0000f42b, 0x00fff42b, 0x00fff42b, 0x0001f42b, 0x0001f42b, 0x00fef42b, 0x00fef42b,
+    0x00000817, 0x00000817, 0x00000817, 0x00000817, 0x0004082c, 0x00fb082c, 0x0005082c, 0x00fa082c,
+    0x0002082b, 0x0002082b, 0x00fd082b, 0x00fd082b, 0x0003082b, 0x0003082b, 0x00fc082b, 0x00fc082b,
+    0x0000082a, 0x0000082a, 0x0000082a, 0x0000082a, 0x00ff082a, 0x00ff082a, 0x00ff082a, 0x00ff082a,
+    0x0001082a, 0x0001082a, 0x0001082a, 0x0001082a, 0x00fe082a, 0x00fe082a, 0x00fe082a, 0x00fe082a,
+    0x0000f717, 0x0000f717, 0x0000f717, 0x0000f717, 0x0004f72c, 0x00fbf72c, 0x0005f72c, 0x00faf72c,
+    0x0002f72b, 0x0002f72b, 0x00fdf72b, 0x00fdf72b, 0x0003f72b, 0x0003f72b, 0x00fcf72b, 0x00fcf72b,
+    0x0000f72a, 0x0000f72a, 0x0000f72a, 0x0000f72a, 0x00fff72a, 0x00fff72a, 0x00fff72a, 0x00fff72a,
+    0x0001f72a, 0x0001f72a, 0x0001f72a, 0x0001f72a, 0x00fef72a, 0x00fef72a, 0x00fef72a, 0x00fef72a,
+    0x00000917, 0x00000917, 0x00000917, 0x00000917, 0x0004092c, 0x00fb092c, 0x0005092c, 0x00fa092c,
+    0x0002092b, 0x0002092b, 0x00fd092b, 0x00fd092b, 0x0003092b, 0x0003092b, 0x00fc092b, 0x00fc092b,
+    0x0000092a, 0x0000092a, 0x0000092a, 0x0000092a, 0x00ff092a, 0x00ff092a, 0x00ff092a, 0x00ff092a,
+    0x0001092a, 0x0001092a, 0x0001092a, 0x0001092a, 0x00fe092a, 0x00fe092a, 0x00fe092a, 0x00fe092a,
+    0x0000f617, 0x0000f617, 0x0000f617, 0x0000f617, 0x0004f62c, 0x00fbf62c, 0x0005f62c, 0x00faf62c,
+    0x0002f62b, 0x0002f62b, 0x00fdf62b, 0x00fdf62b, 0x0003f62b, 0x0003f62b, 0x00fcf62b, 0x00fcf62b,
+    0x0000f62a, 0x0000f62a, 0x0000f62a, 0x0000f62a, 0x00fff62a, 0x00fff62a, 0x00fff62a, 0x00fff62a,
+    0x0001f62a, 0x0001f62a, 0x0001f62a, 0x0001f62a, 0x00fef62a, 0x00fef62a, 0x00fef62a, 0x00fef62a,
+    0x00000616, 0x00000616, 0x00000616, 0x00000616, 0x0006062c, 0x00f9062c, 0x0007062c, 0x00f8062c,
+    0x0004062b, 0x0004062b, 0x00fb062b, 0x00fb062b, 0x0005062b, 0x0005062b, 0x00fa062b, 0x00fa062b,
+    0x0002062a, 0x0002062a, 0x0002062a, 0x0002062a, 0x00fd062a, 0x00fd062a, 0x00fd062a, 0x00fd062a,
+    0x0003062a, 0x0003062a, 0x0003062a, 0x0003062a, 0x00fc062a, 0x00fc062a, 0x00fc062a, 0x00fc062a,
+    0x00000629, 0x00000629, 0x00000629, 0x00000629, 0x0000063c, 0xff00063c, 0x0100063c, 0xfe00063c,
+    0x00ff0629, 0x00ff0629, 0x00ff0629, 0x00ff0629, 0x00ff063c, 0xffff063c, 0x01ff063c, 0xfeff063c,
+    0x00010629, 0x00010629, 0x00010629, 0x00010629, 0x0001063c, 0xff01063c, 0x0101063c, 0xfe01063c,
+    0x00fe0629, 0x00fe0629, 0x00fe0629, 0x00fe0629, 0x00fe063c, 0xfffe063c, 0x01fe063c, 0xfefe063c,
+    0x0000f916, 0x0000f916, 0x0000f916, 0x0000f916, 0x0006f92c, 0x00f9f92c, 0x0007f92c, 0x00f8f92c,
+    0x0004f92b, 0x0004f92b, 0x00fbf92b, 0x00fbf92b, 0x0005f92b, 0x0005f92b, 0x00faf92b, 0x00faf92b,
+    0x0002f92a, 0x0002f92a, 0x0002f92a, 0x0002f92a, 0x00fdf92a, 0x00fdf92a, 0x00fdf92a, 0x00fdf92a,
+    0x0003f92a, 0x0003f92a, 0x0003f92a, 0x0003f92a, 0x00fcf92a, 0x00fcf92a, 0x00fcf92a, 0x00fcf92a,
+    0x0000f929, 0x0000f929, 0x0000f929, 0x0000f929, 0x0000f93c, 0xff00f93c, 0x0100f93c, 0xfe00f93c,
+    0x00fff929, 0x00fff929, 0x00fff929, 0x00fff929, 0x00fff93c, 0xfffff93c, 0x01fff93c, 0xfefff93c,
+    0x0001f929, 0x0001f929, 0x0001f929, 0x0001f929, 0x0001f93c, 0xff01f93c, 0x0101f93c, 0xfe01f93c,
+    0x00fef929, 0x00fef929, 0x00fef929, 0x00fef929, 0x00fef93c, 0xfffef93c, 0x01fef93c, 0xfefef93c,
+    0x00000716, 0x00000716, 0x00000716, 0x00000716, 0x0006072c, 0x00f9072c, 0x0007072c, 0x00f8072c,
+    0x0004072b, 0x0004072b, 0x00fb072b, 0x00fb072b, 0x0005072b, 0x0005072b, 0x00fa072b, 0x00fa072b,
+    0x0002072a, 0x0002072a, 0x0002072a, 0x0002072a, 0x00fd072a, 0x00fd072a, 0x00fd072a, 0x00fd072a,
+    0x0003072a, 0x0003072a, 0x0003072a, 0x0003072a, 0x00fc072a, 0x00fc072a, 0x00fc072a, 0x00fc072a,
+    0x00000729, 0x00000729, 0x00000729, 0x00000729, 0x0000073c, 0xff00073c, 0x0100073c, 0xfe00073c,
+    0x00ff0729, 0x00ff0729, 0x00ff0729, 0x00ff0729, 0x00ff073c, 0xffff073c, 0x01ff073c, 0xfeff073c,
+    0x00010729, 0x00010729, 0x00010729, 0x00010729, 0x0001073c, 0xff01073c, 0x0101073c, 0xfe01073c,
+    0x00fe0729, 0x00fe0729, 0x00fe0729, 0x00fe0729, 0x00fe073c, 0xfffe073c, 0x01fe073c, 0xfefe073c,
+    0x0000f816, 0x0000f816, 0x0000f816, 0x0000f816, 0x0006f82c, 0x00f9f82c, 0x0007f82c, 0x00f8f82c,
+    0x0004f82b, 0x0004f82b, 0x00fbf82b, 0x00fbf82b, 0x0005f82b, 0x0005f82b, 0x00faf82b, 0x00faf82b,
+    0x0002f82a, 0x0002f82a, 0x0002f82a, 0x0002f82a, 0x00fdf82a, 0x00fdf82a, 0x00fdf82a, 0x00fdf82a,
+    0x0003f82a, 0x0003f82a, 0x0003f82a, 0x0003f82a, 0x00fcf82a, 0x00fcf82a, 0x00fcf82a, 0x00fcf82a,
+    0x0000f829, 0x0000f829, 0x0000f829, 0x0000f829, 0x0000f83c, 0xff00f83c, 0x0100f83c, 0xfe00f83c,
+    0x00fff829, 0x00fff829, 0x00fff829, 0x00fff829, 0x00fff83c, 0xfffff83c, 0x01fff83c, 0xfefff83c,
+    0x0001f829, 0x0001f829, 0x0001f829, 0x0001f829, 0x0001f83c, 0xff01f83c, 0x0101f83c, 0xfe01f83c,
+    0x00fef829, 0x00fef829, 0x00fef829, 0x00fef829, 0x00fef83c, 0xfffef83c, 0x01fef83c, 0xfefef83c,
+    0x00000415, 0x00000415, 0x00000415, 0x00000415, 0x0008042c, 0x00f7042c, 0x0009042c, 0x00f6042c,
+    0x0006042b, 0x0006042b, 0x00f9042b, 0x00f9042b, 0x0007042b, 0x0007042b, 0x00f8042b, 0x00f8042b,
+    0x0004042a, 0x0004042a, 0x0004042a, 0x0004042a, 0x00fb042a, 0x00fb042a, 0x00fb042a, 0x00fb042a,
+    0x0005042a, 0x0005042a, 0x0005042a, 0x0005042a, 0x00fa042a, 0x00fa042a, 0x00fa042a, 0x00fa042a,
+    0x00020429, 0x00020429, 0x00020429, 0x00020429, 0x0002043c, 0xff02043c, 0x0102043c, 0xfe02043c,
+    0x00fd0429, 0x00fd0429, 0x00fd0429, 0x00fd0429, 0x00fd043c, 0xfffd043c, 0x01fd043c, 0xfefd043c,
+    0x00030429, 0x00030429, 0x00030429, 0x00030429, 0x0003043c, 0xff03043c, 0x0103043c, 0xfe03043c,
+    0x00fc0429, 0x00fc0429, 0x00fc0429, 0x00fc0429, 0x00fc043c, 0xfffc043c, 0x01fc043c, 0xfefc043c,
+    0x00000428, 0x00000428, 0x00000428, 0x00000428, 0x0200043c, 0xfd00043c, 0x0300043c, 0xfc00043c,
+    0x0000043b, 0x0000043b, 0xff00043b, 0xff00043b, 0x0100043b, 0x0100043b, 0xfe00043b, 0xfe00043b,
+    0x00ff0428, 0x00ff0428, 0x00ff0428, 0x00ff0428, 0x02ff043c, 0xfdff043c, 0x03ff043c, 0xfcff043c,
+    0x00ff043b, 0x00ff043b, 0xffff043b, 0xffff043b, 0x01ff043b, 0x01ff043b, 0xfeff043b, 0xfeff043b,
+    0x00010428, 0x00010428, 0x00010428, 0x00010428, 0x0201043c, 0xfd01043c, 0x0301043c, 0xfc01043c,
+    0x0001043b, 0x0001043b, 0xff01043b, 0xff01043b, 0x0101043b, 0x0101043b, 0xfe01043b, 0xfe01043b,
+    0x00fe0428, 0x00fe0428, 0x00fe0428, 0x00fe0428, 0x02fe043c, 0xfdfe043c, 0x03fe043c, 0xfcfe043c,
+    0x00fe043b, 0x00fe043b, 0xfffe043b, 0xfffe043b, 0x01fe043b, 0x01fe043b, 0xfefe043b, 0xfefe043b,
+    0x0000fb15, 0x0000fb15, 0x0000fb15, 0x0000fb15, 0x0008fb2c, 0x00f7fb2c, 0x0009fb2c, 0x00f6fb2c,
+    0x0006fb2b, 0x0006fb2b, 0x00f9fb2b, 0x00f9fb2b, 0x0007fb2b, 0x0007fb2b, 0x00f8fb2b, 0x00f8fb2b,
+    0x0004fb2a, 0x0004fb2a, 0x0004fb2a, 0x0004fb2a, 0x00fbfb2a, 0x00fbfb2a, 0x00fbfb2a, 0x00fbfb2a,
+    0x0005fb2a, 0x0005fb2a, 0x0005fb2a, 0x0005fb2a, 0x00fafb2a, 0x00fafb2a, 0x00fafb2a, 0x00fafb2a,
+    0x0002fb29, 0x0002fb29, 0x0002fb29, 0x0002fb29, 0x0002fb3c, 0xff02fb3c, 0x0102fb3c, 0xfe02fb3c,
+    0x00fdfb29, 0x00fdfb29, 0x00fdfb29, 0x00fdfb29, 0x00fdfb3c, 0xfffdfb3c, 0x01fdfb3c, 0xfefdfb3c,
+    0x0003fb29, 0x0003fb29, 0x0003fb29, 0x0003fb29, 0x0003fb3c, 0xff03fb3c, 0x0103fb3c, 0xfe03fb3c,
+    0x00fcfb29, 0x00fcfb29, 0x00fcfb29, 0x00fcfb29, 0x00fcfb3c, 0xfffcfb3c, 0x01fcfb3c, 0xfefcfb3c,
+    0x0000fb28, 0x0000fb28, 0x0000fb28, 0x0000fb28, 0x0200fb3c, 0xfd00fb3c, 0x0300fb3c, 0xfc00fb3c,
+    0x0000fb3b, 0x0000fb3b, 0xff00fb3b, 0xff00fb3b, 0x0100fb3b, 0x0100fb3b, 0xfe00fb3b, 0xfe00fb3b,
+    0x00fffb28, 0x00fffb28, 0x00fffb28, 0x00fffb28, 0x02fffb3c, 0xfdfffb3c, 0x03fffb3c, 0xfcfffb3c,
+    0x00fffb3b, 0x00fffb3b, 0xfffffb3b, 0xfffffb3b, 0x01fffb3b, 0x01fffb3b, 0xfefffb3b, 0xfefffb3b,
+    0x0001fb28, 0x0001fb28, 0x0001fb28, 0x0001fb28, 0x0201fb3c, 0xfd01fb3c, 0x0301fb3c, 0xfc01fb3c,
+    0x0001fb3b, 0x0001fb3b, 0xff01fb3b, 0xff01fb3b, 0x0101fb3b, 0x0101fb3b, 0xfe01fb3b, 0xfe01fb3b,
+    0x00fefb28, 0x00fefb28, 0x00fefb28, 0x00fefb28, 0x02fefb3c, 0xfdfefb3c, 0x03fefb3c, 0xfcfefb3c,
+    0x00fefb3b, 0x00fefb3b, 0xfffefb3b, 0xfffefb3b, 0x01fefb3b, 0x01fefb3b, 0xfefefb3b, 0xfefefb3b,
+    0x00000515, 0x00000515, 0x00000515, 0x00000515, 0x0008052c, 0x00f7052c, 0x0009052c, 0x00f6052c,
+    0x0006052b, 0x0006052b, 0x00f9052b, 0x00f9052b, 0x0007052b, 0x0007052b, 0x00f8052b, 0x00f8052b,
+    0x0004052a, 0x0004052a, 0x0004052a, 0x0004052a, 0x00fb052a, 0x00fb052a, 0x00fb052a, 0x00fb052a,
+    0x0005052a, 0x0005052a, 0x0005052a, 0x0005052a, 0x00fa052a, 0x00fa052a, 0x00fa052a, 0x00fa052a,
+    0x00020529, 0x00020529, 0x00020529, 0x00020529, 0x0002053c, 0xff02053c, 0x0102053c, 0xfe02053c,
+    0x00fd0529, 0x00fd0529, 0x00fd0529, 0x00fd0529, 0x00fd053c, 0xfffd053c, 0x01fd053c, 0xfefd053c,
+    0x00030529, 0x00030529, 0x00030529, 0x00030529, 0x0003053c, 0xff03053c, 0x0103053c, 0xfe03053c,
+    0x00fc0529, 0x00fc0529, 0x00fc0529, 0x00fc0529, 0x00fc053c, 0xfffc053c, 0x01fc053c, 0xfefc053c,
+    0x00000528, 0x00000528, 0x00000528, 0x00000528, 0x0200053c, 0xfd00053c, 0x0300053c, 0xfc00053c,
+    0x0000053b, 0x0000053b, 0xff00053b, 0xff00053b, 0x0100053b, 0x0100053b, 0xfe00053b, 0xfe00053b,
+    0x00ff0528, 0x00ff0528, 0x00ff0528, 0x00ff0528, 0x02ff053c, 0xfdff053c, 0x03ff053c, 0xfcff053c,
+    0x00ff053b, 0x00ff053b, 0xffff053b, 0xffff053b, 0x01ff053b, 0x01ff053b, 0xfeff053b, 0xfeff053b,
+    0x00010528, 0x00010528, 0x00010528, 0x00010528, 0x0201053c, 0xfd01053c, 0x0301053c, 0xfc01053c,
+    0x0001053b, 0x0001053b, 0xff01053b, 0xff01053b, 0x0101053b, 0x0101053b, 0xfe01053b, 0xfe01053b,
+    0x00fe0528, 0x00fe0528, 0x00fe0528, 0x00fe0528, 0x02fe053c, 0xfdfe053c, 0x03fe053c, 0xfcfe053c,
+    0x00fe053b, 0x00fe053b, 0xfffe053b, 0xfffe053b, 0x01fe053b, 0x01fe053b, 0xfefe053b, 0xfefe053b,
+    0x0000fa15, 0x0000fa15, 0x0000fa15, 0x0000fa15, 0x0008fa2c, 0x00f7fa2c, 0x0009fa2c, 0x00f6fa2c,
+    0x0006fa2b, 0x0006fa2b, 0x00f9fa2b, 0x00f9fa2b, 0x0007fa2b, 0x0007fa2b, 0x00f8fa2b, 0x00f8fa2b,
+    0x0004fa2a, 0x0004fa2a, 0x0004fa2a, 0x0004fa2a, 0x00fbfa2a, 0x00fbfa2a, 0x00fbfa2a, 0x00fbfa2a,
+    0x0005fa2a, 0x0005fa2a, 0x0005fa2a, 0x0005fa2a, 0x00fafa2a, 0x00fafa2a, 0x00fafa2a, 0x00fafa2a,
+    0x0002fa29, 0x0002fa29, 0x0002fa29, 0x0002fa29, 0x0002fa3c, 0xff02fa3c, 0x0102fa3c, 0xfe02fa3c,
+    0x00fdfa29, 0x00fdfa29, 0x00fdfa29, 0x00fdfa29, 0x00fdfa3c, 0xfffdfa3c, 0x01fdfa3c, 0xfefdfa3c,
+    0x0003fa29, 0x0003fa29, 0x0003fa29, 0x0003fa29, 0x0003fa3c, 0xff03fa3c, 0x0103fa3c, 0xfe03fa3c,
+    0x00fcfa29, 0x00fcfa29, 0x00fcfa29, 0x00fcfa29, 0x00fcfa3c, 0xfffcfa3c, 0x01fcfa3c, 0xfefcfa3c,
+    0x0000fa28, 0x0000fa28, 0x0000fa28, 0x0000fa28, 0x0200fa3c, 0xfd00fa3c, 0x0300fa3c, 0xfc00fa3c,
+    0x0000fa3b, 0x0000fa3b, 0xff00fa3b, 0xff00fa3b, 0x0100fa3b, 0x0100fa3b, 0xfe00fa3b, 0xfe00fa3b,
+    0x00fffa28, 0x00fffa28, 0x00fffa28, 0x00fffa28, 0x02fffa3c, 0xfdfffa3c, 0x03fffa3c, 0xfcfffa3c,
+    0x00fffa3b, 0x00fffa3b, 0xfffffa3b, 0xfffffa3b, 0x01fffa3b, 0x01fffa3b, 0xfefffa3b, 0xfefffa3b,
+    0x0001fa28, 0x0001fa28, 0x0001fa28, 0x0001fa28, 0x0201fa3c, 0xfd01fa3c, 0x0301fa3c, 0xfc01fa3c,
+    0x0001fa3b, 0x0001fa3b, 0xff01fa3b, 0xff01fa3b, 0x0101fa3b, 0x0101fa3b, 0xfe01fa3b, 0xfe01fa3b,
+    0x00fefa28, 0x00fefa28, 0x00fefa28, 0x00fefa28, 0x02fefa3c, 0xfdfefa3c, 0x03fefa3c, 0xfcfefa3c,
+    0x00fefa3b, 0x00fefa3b, 0xfffefa3b, 0xfffefa3b, 0x01fefa3b, 0x01fefa3b, 0xfefefa3b, 0xfefefa3b,
+    0x00000214, 0x00000214, 0x00000214, 0x00000214, 0x000a022c, 0x00f5022c, 0x000b022c, 0x00f4022c,
+    0x0008022b, 0x0008022b, 0x00f7022b, 0x00f7022b, 0x0009022b, 0x0009022b, 0x00f6022b, 0x00f6022b,
+    0x0006022a, 0x0006022a, 0x0006022a, 0x0006022a, 0x00f9022a, 0x00f9022a, 0x00f9022a, 0x00f9022a,
+    0x0007022a, 0x0007022a, 0x0007022a, 0x0007022a, 0x00f8022a, 0x00f8022a, 0x00f8022a, 0x00f8022a,
+    0x00040229, 0x00040229, 0x00040229, 0x00040229, 0x0004023c, 0xff04023c, 0x0104023c, 0xfe04023c,
+    0x00fb0229, 0x00fb0229, 0x00fb0229, 0x00fb0229, 0x00fb023c, 0xfffb023c, 0x01fb023c, 0xfefb023c,
+    0x00050229, 0x00050229, 0x00050229, 0x00050229, 0x0005023c, 0xff05023c, 0x0105023c, 0xfe05023c,
+    0x00fa0229, 0x00fa0229, 0x00fa0229, 0x00fa0229, 0x00fa023c, 0xfffa023c, 0x01fa023c, 0xfefa023c,
+    0x00020228, 0x00020228, 0x00020228, 0x00020228, 0x0202023c, 0xfd02023c, 0x0302023c, 0xfc02023c,
+    0x0002023b, 0x0002023b, 0xff02023b, 0xff02023b, 0x0102023b, 0x0102023b, 0xfe02023b, 0xfe02023b,
+    0x00fd0228, 0x00fd0228, 0x00fd0228, 0x00fd0228, 0x02fd023c, 0xfdfd023c, 0x03fd023c, 0xfcfd023c,
+    0x00fd023b, 0x00fd023b, 0xfffd023b, 0xfffd023b, 0x01fd023b, 0x01fd023b, 0xfefd023b, 0xfefd023b,
+    0x00030228, 0x00030228, 0x00030228, 0x00030228, 0x0203023c, 0xfd03023c, 0x0303023c, 0xfc03023c,
+    0x0003023b, 0x0003023b, 0xff03023b, 0xff03023b, 0x0103023b, 0x0103023b, 0xfe03023b, 0xfe03023b,
+    0x00fc0228, 0x00fc0228, 0x00fc0228, 0x00fc0228, 0x02fc023c, 0xfdfc023c, 0x03fc023c, 0xfcfc023c,
+    0x00fc023b, 0x00fc023b, 0xfffc023b, 0xfffc023b, 0x01fc023b, 0x01fc023b, 0xfefc023b, 0xfefc023b,
+    0x00000227, 0x00000227, 0x00000227, 0x00000227, 0x0400023c, 0xfb00023c, 0x0500023c, 0xfa00023c,
+    0x0200023b, 0x0200023b, 0xfd00023b, 0xfd00023b, 0x0300023b, 0x0300023b, 0xfc00023b, 0xfc00023b,
+    0x0000023a, 0x0000023a, 0x0000023a, 0x0000023a, 0xff00023a, 0xff00023a, 0xff00023a, 0xff00023a,
+    0x0100023a, 0x0100023a, 0x0100023a, 0x0100023a, 0xfe00023a, 0xfe00023a, 0xfe00023a, 0xfe00023a,
+    0x00ff0227, 0x00ff0227, 0x00ff0227, 0x00ff0227, 0x04ff023c, 0xfbff023c, 0x05ff023c, 0xfaff023c,
+    0x02ff023b, 0x02ff023b, 0xfdff023b, 0xfdff023b, 0x03ff023b, 0x03ff023b, 0xfcff023b, 0xfcff023b,
+    0x00ff023a, 0x00ff023a, 0x00ff023a, 0x00ff023a, 0xffff023a, 0xffff023a, 0xffff023a, 0xffff023a,
+    0x01ff023a, 0x01ff023a, 0x01ff023a, 0x01ff023a, 0xfeff023a, 0xfeff023a, 0xfeff023a, 0xfeff023a,
+    0x00010227, 0x00010227, 0x00010227, 0x00010227, 0x0401023c, 0xfb01023c, 0x0501023c, 0xfa01023c,
+    0x0201023b, 0x0201023b, 0xfd01023b, 0xfd01023b, 0x0301023b, 0x0301023b, 0xfc01023b, 0xfc01023b,
+    0x0001023a, 0x0001023a, 0x0001023a, 0x0001023a, 0xff01023a, 0xff01023a, 0xff01023a, 0xff01023a,
+    0x0101023a, 0x0101023a, 0x0101023a, 0x0101023a, 0xfe01023a, 0xfe01023a, 0xfe01023a, 0xfe01023a,
+    0x00fe0227, 0x00fe0227, 0x00fe0227, 0x00fe0227, 0x04fe023c, 0xfbfe023c, 0x05fe023c, 0xfafe023c,
+    0x02fe023b, 0x02fe023b, 0xfdfe023b, 0xfdfe023b, 0x03fe023b, 0x03fe023b, 0xfcfe023b, 0xfcfe023b,
+    0x00fe023a, 0x00fe023a, 0x00fe023a, 0x00fe023a, 0xfffe023a, 0xfffe023a, 0xfffe023a, 0xfffe023a,
+    0x01fe023a, 0x01fe023a, 0x01fe023a, 0x01fe023a, 0xfefe023a, 0xfefe023a, 0xfefe023a, 0xfefe023a,
+    0x0000fd14, 0x0000fd14, 0x0000fd14, 0x0000fd14, 0x000afd2c, 0x00f5fd2c, 0x000bfd2c, 0x00f4fd2c,
+    0x0008fd2b, 0x0008fd2b, 0x00f7fd2b, 0x00f7fd2b, 0x0009fd2b, 0x0009fd2b, 0x00f6fd2b, 0x00f6fd2b,
+    0x0006fd2a, 0x0006fd2a, 0x0006fd2a, 0x0006fd2a, 0x00f9fd2a, 0x00f9fd2a, 0x00f9fd2a, 0x00f9fd2a,
+    0x0007fd2a, 0x0007fd2a, 0x0007fd2a, 0x0007fd2a, 0x00f8fd2a, 0x00f8fd2a, 0x00f8fd2a, 0x00f8fd2a,
+    0x0004fd29, 0x0004fd29, 0x0004fd29, 0x0004fd29, 0x0004fd3c, 0xff04fd3c, 0x0104fd3c, 0xfe04fd3c,
+    0x00fbfd29, 0x00fbfd29, 0x00fbfd29, 0x00fbfd29, 0x00fbfd3c, 0xfffbfd3c, 0x01fbfd3c, 0xfefbfd3c,
+    0x0005fd29, 0x0005fd29, 0x0005fd29, 0x0005fd29, 0x0005fd3c, 0xff05fd3c, 0x0105fd3c, 0xfe05fd3c,
+    0x00fafd29, 0x00fafd29, 0x00fafd29, 0x00fafd29, 0x00fafd3c, 0xfffafd3c, 0x01fafd3c, 0xfefafd3c,
+    0x0002fd28, 0x0002fd28, 0x0002fd28, 0x0002fd28, 0x0202fd3c, 0xfd02fd3c, 0x0302fd3c, 0xfc02fd3c,
+    0x0002fd3b, 0x0002fd3b, 0xff02fd3b, 0xff02fd3b, 0x0102fd3b, 0x0102fd3b, 0xfe02fd3b, 0xfe02fd3b,
+    0x00fdfd28, 0x00fdfd28, 0x00fdfd28, 0x00fdfd28, 0x02fdfd3c, 0xfdfdfd3c, 0x03fdfd3c, 0xfcfdfd3c,
+    0x00fdfd3b, 0x00fdfd3b, 0xfffdfd3b, 0xfffdfd3b, 0x01fdfd3b, 0x01fdfd3b, 0xfefdfd3b, 0xfefdfd3b,
+    0x0003fd28, 0x0003fd28, 0x0003fd28, 0x0003fd28, 0x0203fd3c, 0xfd03fd3c, 0x0303fd3c, 0xfc03fd3c,
+    0x0003fd3b, 0x0003fd3b, 0xff03fd3b, 0xff03fd3b, 0x0103fd3b, 0x0103fd3b, 0xfe03fd3b, 0xfe03fd3b,
+    0x00fcfd28, 0x00fcfd28, 0x00fcfd28, 0x00fcfd28, 0x02fcfd3c, 0xfdfcfd3c, 0x03fcfd3c, 0xfcfcfd3c,
+    0x00fcfd3b, 0x00fcfd3b, 0xfffcfd3b, 0xfffcfd3b, 0x01fcfd3b, 0x01fcfd3b, 0xfefcfd3b, 0xfefcfd3b,
+    0x0000fd27, 0x0000fd27, 0x0000fd27, 0x0000fd27, 0x0400fd3c, 0xfb00fd3c, 0x0500fd3c, 0xfa00fd3c,
+    0x0200fd3b, 0x0200fd3b, 0xfd00fd3b, 0xfd00fd3b, 0x0300fd3b, 0x0300fd3b, 0xfc00fd3b, 0xfc00fd3b,
+    0x0000fd3a, 0x0000fd3a, 0x0000fd3a, 0x0000fd3a, 0xff00fd3a, 0xff00fd3a, 0xff00fd3a, 0xff00fd3a,
+    0x0100fd3a, 0x0100fd3a, 0x0100fd3a, 0x0100fd3a, 0xfe00fd3a, 0xfe00fd3a, 0xfe00fd3a, 0xfe00fd3a,
+    0x00fffd27, 0x00fffd27, 0x00fffd27, 0x00fffd27, 0x04fffd3c, 0xfbfffd3c, 0x05fffd3c, 0xfafffd3c,
+    0x02fffd3b, 0x02fffd3b, 0xfdfffd3b, 0xfdfffd3b, 0x03fffd3b, 0x03fffd3b, 0xfcfffd3b, 0xfcfffd3b,
+    0x00fffd3a, 0x00fffd3a, 0x00fffd3a, 0x00fffd3a, 0xfffffd3a, 0xfffffd3a, 0xfffffd3a, 0xfffffd3a,
+    0x01fffd3a, 0x01fffd3a, 0x01fffd3a, 0x01fffd3a, 0xfefffd3a, 0xfefffd3a, 0xfefffd3a, 0xfefffd3a,
+    0x0001fd27, 0x0001fd27, 0x0001fd27, 0x0001fd27, 0x0401fd3c, 0xfb01fd3c, 0x0501fd3c, 0xfa01fd3c,
+    0x0201fd3b, 0x0201fd3b, 0xfd01fd3b, 0xfd01fd3b, 0x0301fd3b, 0x0301fd3b, 0xfc01fd3b, 0xfc01fd3b,
+    0x0001fd3a, 0x0001fd3a, 0x0001fd3a, 0x0001fd3a, 0xff01fd3a, 0xff01fd3a, 0xff01fd3a, 0xff01fd3a,
+    0x0101fd3a, 0x0101fd3a, 0x0101fd3a, 0x0101fd3a, 0xfe01fd3a, 0xfe01fd3a, 0xfe01fd3a, 0xfe01fd3a,
+    0x00fefd27, 0x00fefd27, 0x00fefd27, 0x00fefd27, 0x04fefd3c, 0xfbfefd3c, 0x05fefd3c, 0xfafefd3c,
+    0x02fefd3b, 0x02fefd3b, 0xfdfefd3b, 0xfdfefd3b, 0x03fefd3b, 0x03fefd3b, 0xfcfefd3b, 0xfcfefd3b,
+    0x00fefd3a, 0x00fefd3a, 0x00fefd3a, 0x00fefd3a, 0xfffefd3a, 0xfffefd3a, 0xfffefd3a, 0xfffefd3a,
+    0x01fefd3a, 0x01fefd3a, 0x01fefd3a, 0x01fefd3a, 0xfefefd3a, 0xfefefd3a, 0xfefefd3a, 0xfefefd3a,
+    0x00000314, 0x00000314, 0x00000314, 0x00000314, 0x000a032c, 0x00f5032c, 0x000b032c, 0x00f4032c,
+    0x0008032b, 0x0008032b, 0x00f7032b, 0x00f7032b, 0x0009032b, 0x0009032b, 0x00f6032b, 0x00f6032b,
+    0x0006032a, 0x0006032a, 0x0006032a, 0x0006032a, 0x00f9032a, 0x00f9032a, 0x00f9032a, 0x00f9032a,
+    0x0007032a, 0x0007032a, 0x0007032a, 0x0007032a, 0x00f8032a, 0x00f8032a, 0x00f8032a, 0x00f8032a,
+    0x00040329, 0x00040329, 0x00040329, 0x00040329, 0x0004033c, 0xff04033c, 0x0104033c, 0xfe04033c,
+    0x00fb0329, 0x00fb0329, 0x00fb0329, 0x00fb0329, 0x00fb033c, 0xfffb033c, 0x01fb033c, 0xfefb033c,
+    0x00050329, 0x00050329, 0x00050329, 0x00050329, 0x0005033c, 0xff05033c, 0x0105033c, 0xfe05033c,
+    0x00fa0329, 0x00fa0329, 0x00fa0329, 0x00fa0329, 0x00fa033c, 0xfffa033c, 0x01fa033c, 0xfefa033c,
+    0x00020328, 0x00020328, 0x00020328, 0x00020328, 0x0202033c, 0xfd02033c, 0x0302033c, 0xfc02033c,
+    0x0002033b, 0x0002033b, 0xff02033b, 0xff02033b, 0x0102033b, 0x0102033b, 0xfe02033b, 0xfe02033b,
+    0x00fd0328, 0x00fd0328, 0x00fd0328, 0x00fd0328, 0x02fd033c, 0xfdfd033c, 0x03fd033c, 0xfcfd033c,
+    0x00fd033b, 0x00fd033b, 0xfffd033b, 0xfffd033b, 0x01fd033b, 0x01fd033b, 0xfefd033b, 0xfefd033b,
+    0x00030328, 0x00030328, 0x00030328, 0x00030328, 0x0203033c, 0xfd03033c, 0x0303033c, 0xfc03033c,
+    0x0003033b, 0x0003033b, 0xff03033b, 0xff03033b, 0x0103033b, 0x0103033b, 0xfe03033b, 0xfe03033b,
+    0x00fc0328, 0x00fc0328, 0x00fc0328, 0x00fc0328, 0x02fc033c, 0xfdfc033c, 0x03fc033c, 0xfcfc033c,
+    0x00fc033b, 0x00fc033b, 0xfffc033b, 0xfffc033b, 0x01fc033b, 0x01fc033b, 0xfefc033b, 0xfefc033b,
+    0x00000327, 0x00000327, 0x00000327, 0x00000327, 0x0400033c, 0xfb00033c, 0x0500033c, 0xfa00033c,
+    0x0200033b, 0x0200033b, 0xfd00033b, 0xfd00033b, 0x0300033b, 0x0300033b, 0xfc00033b, 0xfc00033b,
+    0x0000033a, 0x0000033a, 0x0000033a, 0x0000033a, 0xff00033a, 0xff00033a, 0xff00033a, 0xff00033a,
+    0x0100033a, 0x0100033a, 0x0100033a, 0x0100033a, 0xfe00033a, 0xfe00033a, 0xfe00033a, 0xfe00033a,
+    0x00ff0327, 0x00ff0327, 0x00ff0327, 0x00ff0327, 0x04ff033c, 0xfbff033c, 0x05ff033c, 0xfaff033c,
+    0x02ff033b, 0x02ff033b, 0xfdff033b, 0xfdff033b, 0x03ff033b, 0x03ff033b, 0xfcff033b, 0xfcff033b,
+    0x00ff033a, 0x00ff033a, 0x00ff033a, 0x00ff033a, 0xffff033a, 0xffff033a, 0xffff033a, 0xffff033a,
+    0x01ff033a, 0x01ff033a, 0x01ff033a, 0x01ff033a, 0xfeff033a, 0xfeff033a, 0xfeff033a, 0xfeff033a,
+    0x00010327, 0x00010327, 0x00010327, 0x00010327, 0x0401033c, 0xfb01033c, 0x0501033c, 0xfa01033c,
+    0x0201033b, 0x0201033b, 0xfd01033b, 0xfd01033b, 0x0301033b, 0x0301033b, 0xfc01033b, 0xfc01033b,
+    0x0001033a, 0x0001033a, 0x0001033a, 0x0001033a, 0xff01033a, 0xff01033a, 0xff01033a, 0xff01033a,
+    0x0101033a, 0x0101033a, 0x0101033a, 0x0101033a, 0xfe01033a, 0xfe01033a, 0xfe01033a, 0xfe01033a,
+    0x00fe0327, 0x00fe0327, 0x00fe0327, 0x00fe0327, 0x04fe033c, 0xfbfe033c, 0x05fe033c, 0xfafe033c,
+    0x02fe033b, 0x02fe033b, 0xfdfe033b, 0xfdfe033b, 0x03fe033b, 0x03fe033b, 0xfcfe033b, 0xfcfe033b,
+    0x00fe033a, 0x00fe033a, 0x00fe033a, 0x00fe033a, 0xfffe033a, 0xfffe033a, 0xfffe033a, 0xfffe033a,
+    0x01fe033a, 0x01fe033a, 0x01fe033a, 0x01fe033a, 0xfefe033a, 0xfefe033a, 0xfefe033a, 0xfefe033a,
+    0x0000fc14, 0x0000fc14, 0x0000fc14, 0x0000fc14, 0x000afc2c, 0x00f5fc2c, 0x000bfc2c, 0x00f4fc2c,
+    0x0008fc2b, 0x0008fc2b, 0x00f7fc2b, 0x00f7fc2b, 0x0009fc2b, 0x0009fc2b, 0x00f6fc2b, 0x00f6fc2b,
+    0x0006fc2a, 0x0006fc2a, 0x0006fc2a, 0x0006fc2a, 0x00f9fc2a, 0x00f9fc2a, 0x00f9fc2a, 0x00f9fc2a,
+    0x0007fc2a, 0x0007fc2a, 0x0007fc2a, 0x0007fc2a, 0x00f8fc2a, 0x00f8fc2a, 0x00f8fc2a, 0x00f8fc2a,
+    0x0004fc29, 0x0004fc29, 0x0004fc29, 0x0004fc29, 0x0004fc3c, 0xff04fc3c, 0x0104fc3c, 0xfe04fc3c,
+    0x00fbfc29, 0x00fbfc29, 0x00fbfc29, 0x00fbfc29, 0x00fbfc3c, 0xfffbfc3c, 0x01fbfc3c, 0xfefbfc3c,
+    0x0005fc29, 0x0005fc29, 0x0005fc29, 0x0005fc29, 0x0005fc3c, 0xff05fc3c, 0x0105fc3c, 0xfe05fc3c,
+    0x00fafc29, 0x00fafc29, 0x00fafc29, 0x00fafc29, 0x00fafc3c, 0xfffafc3c, 0x01fafc3c, 0xfefafc3c,
+    0x0002fc28, 0x0002fc28, 0x0002fc28, 0x0002fc28, 0x0202fc3c, 0xfd02fc3c, 0x0302fc3c, 0xfc02fc3c,
+    0x0002fc3b, 0x0002fc3b, 0xff02fc3b, 0xff02fc3b, 0x0102fc3b, 0x0102fc3b, 0xfe02fc3b, 0xfe02fc3b,
+    0x00fdfc28, 0x00fdfc28, 0x00fdfc28, 0x00fdfc28, 0x02fdfc3c, 0xfdfdfc3c, 0x03fdfc3c, 0xfcfdfc3c,
+    0x00fdfc3b, 0x00fdfc3b, 0xfffdfc3b, 0xfffdfc3b, 0x01fdfc3b, 0x01fdfc3b, 0xfefdfc3b, 0xfefdfc3b,
+    0x0003fc28, 0x0003fc28, 0x0003fc28, 0x0003fc28, 0x0203fc3c, 0xfd03fc3c, 0x0303fc3c, 0xfc03fc3c,
+    0x0003fc3b, 0x0003fc3b, 0xff03fc3b, 0xff03fc3b, 0x0103fc3b, 0x0103fc3b, 0xfe03fc3b, 0xfe03fc3b,
+    0x00fcfc28, 0x00fcfc28, 0x00fcfc28, 0x00fcfc28, 0x02fcfc3c, 0xfdfcfc3c, 0x03fcfc3c, 0xfcfcfc3c,
+    0x00fcfc3b, 0x00fcfc3b, 0xfffcfc3b, 0xfffcfc3b, 0x01fcfc3b, 0x01fcfc3b, 0xfefcfc3b, 0xfefcfc3b,
+    0x0000fc27, 0x0000fc27, 0x0000fc27, 0x0000fc27, 0x0400fc3c, 0xfb00fc3c, 0x0500fc3c, 0xfa00fc3c,
+    0x0200fc3b, 0x0200fc3b, 0xfd00fc3b, 0xfd00fc3b, 0x0300fc3b, 0x0300fc3b, 0xfc00fc3b, 0xfc00fc3b,
+    0x0000fc3a, 0x0000fc3a, 0x0000fc3a, 0x0000fc3a, 0xff00fc3a, 0xff00fc3a, 0xff00fc3a, 0xff00fc3a,
+    0x0100fc3a, 0x0100fc3a, 0x0100fc3a, 0x0100fc3a, 0xfe00fc3a, 0xfe00fc3a, 0xfe00fc3a, 0xfe00fc3a,
+    0x00fffc27, 0x00fffc27, 0x00fffc27, 0x00fffc27, 0x04fffc3c, 0xfbfffc3c, 0x05fffc3c, 0xfafffc3c,
+    0x02fffc3b, 0x02fffc3b, 0xfdfffc3b, 0xfdfffc3b, 0x03fffc3b, 0x03fffc3b, 0xfcfffc3b, 0xfcfffc3b,
+    0x00fffc3a, 0x00fffc3a, 0x00fffc3a, 0x00fffc3a, 0xfffffc3a, 0xfffffc3a, 0xfffffc3a, 0xfffffc3a,
+    0x01fffc3a, 0x01fffc3a, 0x01fffc3a, 0x01fffc3a, 0xfefffc3a, 0xfefffc3a, 0xfefffc3a, 0xfefffc3a,
+    0x0001fc27, 0x0001fc27, 0x0001fc27, 0x0001fc27, 0x0401fc3c, 0xfb01fc3c, 0x0501fc3c, 0xfa01fc3c,
+    0x0201fc3b, 0x0201fc3b, 0xfd01fc3b, 0xfd01fc3b, 0x0301fc3b, 0x0301fc3b, 0xfc01fc3b, 0xfc01fc3b,
+    0x0001fc3a, 0x0001fc3a, 0x0001fc3a, 0x0001fc3a, 0xff01fc3a, 0xff01fc3a, 0xff01fc3a, 0xff01fc3a,
+    0x0101fc3a, 0x0101fc3a, 0x0101fc3a, 0x0101fc3a, 0xfe01fc3a, 0xfe01fc3a, 0xfe01fc3a, 0xfe01fc3a,
+    0x00fefc27, 0x00fefc27, 0x00fefc27, 0x00fefc27, 0x04fefc3c, 0xfbfefc3c, 0x05fefc3c, 0xfafefc3c,
+    0x02fefc3b, 0x02fefc3b, 0xfdfefc3b, 0xfdfefc3b, 0x03fefc3b, 0x03fefc3b, 0xfcfefc3b, 0xfcfefc3b,
+    0x00fefc3a, 0x00fefc3a, 0x00fefc3a, 0x00fefc3a, 0xfffefc3a, 0xfffefc3a, 0xfffefc3a, 0xfffefc3a,
+    0x01fefc3a, 0x01fefc3a, 0x01fefc3a, 0x01fefc3a, 0xfefefc3a, 0xfefefc3a, 0xfefefc3a, 0xfefefc3a,
+    0x00000013, 0x00000013, 0x00000013, 0x00000013, 0x000c002c, 0x00f3002c, 0x000d002c, 0x00f2002c,
+    0x000a002b, 0x000a002b, 0x00f5002b, 0x00f5002b, 0x000b002b, 0x000b002b, 0x00f4002b, 0x00f4002b,
+    0x0008002a, 0x0008002a, 0x0008002a, 0x0008002a, 0x00f7002a, 0x00f7002a, 0x00f7002a, 0x00f7002a,
+    0x0009002a, 0x0009002a, 0x0009002a, 0x0009002a, 0x00f6002a, 0x00f6002a, 0x00f6002a, 0x00f6002a,
+    0x00060029, 0x00060029, 0x00060029, 0x00060029, 0x0006003c, 0xff06003c, 0x0106003c, 0xfe06003c,
+    0x00f90029, 0x00f90029, 0x00f90029, 0x00f90029, 0x00f9003c, 0xfff9003c, 0x01f9003c, 0xfef9003c,
+    0x00070029, 0x00070029, 0x00070029, 0x00070029, 0x0007003c, 0xff07003c, 0x0107003c, 0xfe07003c,
+    0x00f80029, 0x00f80029, 0x00f80029, 0x00f80029, 0x00f8003c, 0xfff8003c, 0x01f8003c, 0xfef8003c,
+    0x00040028, 0x00040028, 0x00040028, 0x00040028, 0x0204003c, 0xfd04003c, 0x0304003c, 0xfc04003c,
+    0x0004003b, 0x0004003b, 0xff04003b, 0xff04003b, 0x0104003b, 0x0104003b, 0xfe04003b, 0xfe04003b,
+    0x00fb0028, 0x00fb0028, 0x00fb0028, 0x00fb0028, 0x02fb003c, 0xfdfb003c, 0x03fb003c, 0xfcfb003c,
+    0x00fb003b, 0x00fb003b, 0xfffb003b, 0xfffb003b, 0x01fb003b, 0x01fb003b, 0xfefb003b, 0xfefb003b,
+    0x00050028, 0x00050028, 0x00050028, 0x00050028, 0x0205003c, 0xfd05003c, 0x0305003c, 0xfc05003c,
+    0x0005003b, 0x0005003b, 0xff05003b, 0xff05003b, 0x0105003b, 0x0105003b, 0xfe05003b, 0xfe05003b,
+    0x00fa0028, 0x00fa0028, 0x00fa0028, 0x00fa0028, 0x02fa003c, 0xfdfa003c, 0x03fa003c, 0xfcfa003c,
+    0x00fa003b, 0x00fa003b, 0xfffa003b, 0xfffa003b, 0x01fa003b, 0x01fa003b, 0xfefa003b, 0xfefa003b,
+    0x00020027, 0x00020027, 0x00020027, 0x00020027, 0x0402003c, 0xfb02003c, 0x0502003c, 0xfa02003c,
+    0x0202003b, 0x0202003b, 0xfd02003b, 0xfd02003b, 0x0302003b, 0x0302003b, 0xfc02003b, 0xfc02003b,
+    0x0002003a, 0x0002003a, 0x0002003a, 0x0002003a, 0xff02003a, 0xff02003a, 0xff02003a, 0xff02003a,
+    0x0102003a, 0x0102003a, 0x0102003a, 0x0102003a, 0xfe02003a, 0xfe02003a, 0xfe02003a, 0xfe02003a,
+    0x00fd0027, 0x00fd0027, 0x00fd0027, 0x00fd0027, 0x04fd003c, 0xfbfd003c, 0x05fd003c, 0xfafd003c,
+    0x02fd003b, 0x02fd003b, 0xfdfd003b, 0xfdfd003b, 0x03fd003b, 0x03fd003b, 0xfcfd003b, 0xfcfd003b,
+    0x00fd003a, 0x00fd003a, 0x00fd003a, 0x00fd003a, 0xfffd003a, 0xfffd003a, 0xfffd003a, 0xfffd003a,
+    0x01fd003a, 0x01fd003a, 0x01fd003a, 0x01fd003a, 0xfefd003a, 0xfefd003a, 0xfefd003a, 0xfefd003a,
+    0x00030027, 0x00030027, 0x00030027, 0x00030027, 0x0403003c, 0xfb03003c, 0x0503003c, 0xfa03003c,
+    0x0203003b, 0x0203003b, 0xfd03003b, 0xfd03003b, 0x0303003b, 0x0303003b, 0xfc03003b, 0xfc03003b,
+    0x0003003a, 0x0003003a, 0x0003003a, 0x0003003a, 0xff03003a, 0xff03003a, 0xff03003a, 0xff03003a,
+    0x0103003a, 0x0103003a, 0x0103003a, 0x0103003a, 0xfe03003a, 0xfe03003a, 0xfe03003a, 0xfe03003a,
+    0x00fc0027, 0x00fc0027, 0x00fc0027, 0x00fc0027, 0x04fc003c, 0xfbfc003c, 0x05fc003c, 0xfafc003c,
+    0x02fc003b, 0x02fc003b, 0xfdfc003b, 0xfdfc003b, 0x03fc003b, 0x03fc003b, 0xfcfc003b, 0xfcfc003b,
+    0x00fc003a, 0x00fc003a, 0x00fc003a, 0x00fc003a, 0xfffc003a, 0xfffc003a, 0xfffc003a, 0xfffc003a,
+    0x01fc003a, 0x01fc003a, 0x01fc003a, 0x01fc003a, 0xfefc003a, 0xfefc003a, 0xfefc003a, 0xfefc003a,
+    0x00000026, 0x00000026, 0x00000026, 0x00000026, 0x0600003c, 0xf900003c, 0x0700003c, 0xf800003c,
+    0x0400003b, 0x0400003b, 0xfb00003b, 0xfb00003b, 0x0500003b, 0x0500003b, 0xfa00003b, 0xfa00003b,
+    0x0200003a, 0x0200003a, 0x0200003a, 0x0200003a, 0xfd00003a, 0xfd00003a, 0xfd00003a, 0xfd00003a,
+    0x0300003a, 0x0300003a, 0x0300003a, 0x0300003a, 0xfc00003a, 0xfc00003a, 0xfc00003a, 0xfc00003a,
+    0x00000039, 0x00000039, 0x00000039, 0x00000039, 0x00000039, 0x00000039, 0x00000039, 0x00000039,
+    0xff000039, 0xff000039, 0xff000039, 0xff000039, 0xff000039, 0xff000039, 0xff000039, 0xff000039,
+    0x01000039, 0x01000039, 0x01000039, 0x01000039, 0x01000039, 0x01000039, 0x01000039, 0x01000039,
+    0xfe000039, 0xfe000039, 0xfe000039, 0xfe000039, 0xfe000039, 0xfe000039, 0xfe000039, 0xfe000039,
+    0x00ff0026, 0x00ff0026, 0x00ff0026, 0x00ff0026, 0x06ff003c, 0xf9ff003c, 0x07ff003c, 0xf8ff003c,
+    0x04ff003b, 0x04ff003b, 0xfbff003b, 0xfbff003b, 0x05ff003b, 0x05ff003b, 0xfaff003b, 0xfaff003b,
+    0x02ff003a, 0x02ff003a, 0x02ff003a, 0x02ff003a, 0xfdff003a, 0xfdff003a, 0xfdff003a, 0xfdff003a,
+    0x03ff003a, 0x03ff003a, 0x03ff003a, 0x03ff003a, 0xfcff003a, 0xfcff003a, 0xfcff003a, 0xfcff003a,
+    0x00ff0039, 0x00ff0039, 0x00ff0039, 0x00ff0039, 0x00ff0039, 0x00ff0039, 0x00ff0039, 0x00ff0039,
+    0xffff0039, 0xffff0039, 0xffff0039, 0xffff0039, 0xffff0039, 0xffff0039, 0xffff0039, 0xffff0039,
+    0x01ff0039, 0x01ff0039, 0x01ff0039, 0x01ff0039, 0x01ff0039, 0x01ff0039, 0x01ff0039, 0x01ff0039,
+    0xfeff0039, 0xfeff0039, 0xfeff0039, 0xfeff0039, 0xfeff0039, 0xfeff0039, 0xfeff0039, 0xfeff0039,
+    0x00010026, 0x00010026, 0x00010026, 0x00010026, 0x0601003c, 0xf901003c, 0x0701003c, 0xf801003c,
+    0x0401003b, 0x0401003b, 0xfb01003b, 0xfb01003b, 0x0501003b, 0x0501003b, 0xfa01003b, 0xfa01003b,
+    0x0201003a, 0x0201003a, 0x0201003a, 0x0201003a, 0xfd01003a, 0xfd01003a, 0xfd01003a, 0xfd01003a,
+    0x0301003a, 0x0301003a, 0x0301003a, 0x0301003a, 0xfc01003a, 0xfc01003a, 0xfc01003a, 0xfc01003a,
+    0x00010039, 0x00010039, 0x00010039, 0x00010039, 0x00010039, 0x00010039, 0x00010039, 0x00010039,
+    0xff010039, 0xff010039, 0xff010039, 0xff010039, 0xff010039, 0xff010039, 0xff010039, 0xff010039,
+    0x01010039, 0x01010039, 0x01010039, 0x01010039, 0x01010039, 0x01010039, 0x01010039, 0x01010039,
+    0xfe010039, 0xfe010039, 0xfe010039, 0xfe010039, 0xfe010039, 0xfe010039, 0xfe010039, 0xfe010039,
+    0x00fe0026, 0x00fe0026, 0x00fe0026, 0x00fe0026, 0x06fe003c, 0xf9fe003c, 0x07fe003c, 0xf8fe003c,
+    0x04fe003b, 0x04fe003b, 0xfbfe003b, 0xfbfe003b, 0x05fe003b, 0x05fe003b, 0xfafe003b, 0xfafe003b,
+    0x02fe003a, 0x02fe003a, 0x02fe003a, 0x02fe003a, 0xfdfe003a, 0xfdfe003a, 0xfdfe003a, 0xfdfe003a,
+    0x03fe003a, 0x03fe003a, 0x03fe003a, 0x03fe003a, 0xfcfe003a, 0xfcfe003a, 0xfcfe003a, 0xfcfe003a,
+    0x00fe0039, 0x00fe0039, 0x00fe0039, 0x00fe0039, 0x00fe0039, 0x00fe0039, 0x00fe0039, 0x00fe0039,
+    0xfffe0039, 0xfffe0039, 0xfffe0039, 0xfffe0039, 0xfffe0039, 0xfffe0039, 0xfffe0039, 0xfffe0039,
+    0x01fe0039, 0x01fe0039, 0x01fe0039, 0x01fe0039, 0x01fe0039, 0x01fe0039, 0x01fe0039, 0x01fe0039,
+    0xfefe0039, 0xfefe0039, 0xfefe0039, 0xfefe0039, 0xfefe0039, 0xfefe0039, 0xfefe0039, 0xfefe0039,
+    0x0000ff13, 0x0000ff13, 0x0000ff13, 0x0000ff13, 0x000cff2c, 0x00f3ff2c, 0x000dff2c, 0x00f2ff2c,
+    0x000aff2b, 0x000aff2b, 0x00f5ff2b, 0x00f5ff2b, 0x000bff2b, 0x000bff2b, 0x00f4ff2b, 0x00f4ff2b,
+    0x0008ff2a, 0x0008ff2a, 0x0008ff2a, 0x0008ff2a, 0x00f7ff2a, 0x00f7ff2a, 0x00f7ff2a, 0x00f7ff2a,
+    0x0009ff2a, 0x0009ff2a, 0x0009ff2a, 0x0009ff2a, 0x00f6ff2a, 0x00f6ff2a, 0x00f6ff2a, 0x00f6ff2a,
+    0x0006ff29, 0x0006ff29, 0x0006ff29, 0x0006ff29, 0x0006ff3c, 0xff06ff3c, 0x0106ff3c, 0xfe06ff3c,
+    0x00f9ff29, 0x00f9ff29, 0x00f9ff29, 0x00f9ff29, 0x00f9ff3c, 0xfff9ff3c, 0x01f9ff3c, 0xfef9ff3c,
+    0x0007ff29, 0x0007ff29, 0x0007ff29, 0x0007ff29, 0x0007ff3c, 0xff07ff3c, 0x0107ff3c, 0xfe07ff3c,
+    0x00f8ff29, 0x00f8ff29, 0x00f8ff29, 0x00f8ff29, 0x00f8ff3c, 0xfff8ff3c, 0x01f8ff3c, 0xfef8ff3c,
+    0x0004ff28, 0x0004ff28, 0x0004ff28, 0x0004ff28, 0x0204ff3c, 0xfd04ff3c, 0x0304ff3c, 0xfc04ff3c,
+    0x0004ff3b, 0x0004ff3b, 0xff04ff3b, 0xff04ff3b, 0x0104ff3b, 0x0104ff3b, 0xfe04ff3b, 0xfe04ff3b,
+    0x00fbff28, 0x00fbff28, 0x00fbff28, 0x00fbff28, 0x02fbff3c, 0xfdfbff3c, 0x03fbff3c, 0xfcfbff3c,
+    0x00fbff3b, 0x00fbff3b, 0xfffbff3b, 0xfffbff3b, 0x01fbff3b, 0x01fbff3b, 0xfefbff3b, 0xfefbff3b,
+    0x0005ff28, 0x0005ff28, 0x0005ff28, 0x0005ff28, 0x0205ff3c, 0xfd05ff3c, 0x0305ff3c, 0xfc05ff3c,
+    0x0005ff3b, 0x0005ff3b, 0xff05ff3b, 0xff05ff3b, 0x0105ff3b, 0x0105ff3b, 0xfe05ff3b, 0xfe05ff3b,
+    0x00faff28, 0x00faff28, 0x00faff28, 0x00faff28, 0x02faff3c, 0xfdfaff3c, 0x03faff3c, 0xfcfaff3c,
+    0x00faff3b, 0x00faff3b, 0xfffaff3b, 0xfffaff3b, 0x01faff3b, 0x01faff3b, 0xfefaff3b, 0xfefaff3b,
+    0x0002ff27, 0x0002ff27, 0x0002ff27, 0x0002ff27, 0x0402ff3c, 0xfb02ff3c, 0x0502ff3c, 0xfa02ff3c,
+    0x0202ff3b, 0x0202ff3b, 0xfd02ff3b, 0xfd02ff3b, 0x0302ff3b, 0x0302ff3b, 0xfc02ff3b, 0xfc02ff3b,
+    0x0002ff3a, 0x0002ff3a, 0x0002ff3a, 0x0002ff3a, 0xff02ff3a, 0xff02ff3a, 0xff02ff3a, 0xff02ff3a,
+    0x0102ff3a, 0x0102ff3a, 0x0102ff3a, 0x0102ff3a, 0xfe02ff3a, 0xfe02ff3a, 0xfe02ff3a, 0xfe02ff3a,
+    0x00fdff27, 0x00fdff27, 0x00fdff27, 0x00fdff27, 0x04fdff3c, 0xfbfdff3c, 0x05fdff3c, 0xfafdff3c,
+    0x02fdff3b, 0x02fdff3b, 0xfdfdff3b, 0xfdfdff3b, 0x03fdff3b, 0x03fdff3b, 0xfcfdff3b, 0xfcfdff3b,
+    0x00fdff3a, 0x00fdff3a, 0x00fdff3a, 0x00fdff3a, 0xfffdff3a, 0xfffdff3a, 0xfffdff3a, 0xfffdff3a,
+    0x01fdff3a, 0x01fdff3a, 0x01fdff3a, 0x01fdff3a, 0xfefdff3a, 0xfefdff3a, 0xfefdff3a, 0xfefdff3a,
+    0x0003ff27, 0x0003ff27, 0x0003ff27, 0x0003ff27, 0x0403ff3c, 0xfb03ff3c, 0x0503ff3c, 0xfa03ff3c,
+    0x0203ff3b, 0x0203ff3b, 0xfd03ff3b, 0xfd03ff3b, 0x0303ff3b, 0x0303ff3b, 0xfc03ff3b, 0xfc03ff3b,
+    0x0003ff3a, 0x0003ff3a, 0x0003ff3a, 0x0003ff3a, 0xff03ff3a, 0xff03ff3a, 0xff03ff3a, 0xff03ff3a,
+    0x0103ff3a, 0x0103ff3a, 0x0103ff3a, 0x0103ff3a, 0xfe03ff3a, 0xfe03ff3a, 0xfe03ff3a, 0xfe03ff3a,
+    0x00fcff27, 0x00fcff27, 0x00fcff27, 0x00fcff27, 0x04fcff3c, 0xfbfcff3c, 0x05fcff3c, 0xfafcff3c,
+    0x02fcff3b, 0x02fcff3b, 0xfdfcff3b, 0xfdfcff3b, 0x03fcff3b, 0x03fcff3b, 0xfcfcff3b, 0xfcfcff3b,
+    0x00fcff3a, 0x00fcff3a, 0x00fcff3a, 0x00fcff3a, 0xfffcff3a, 0xfffcff3a, 0xfffcff3a, 0xfffcff3a,
+    0x01fcff3a, 0x01fcff3a, 0x01fcff3a, 0x01fcff3a, 0xfefcff3a, 0xfefcff3a, 0xfefcff3a, 0xfefcff3a,
+    0x0000ff26, 0x0000ff26, 0x0000ff26, 0x0000ff26, 0x0600ff3c, 0xf900ff3c, 0x0700ff3c, 0xf800ff3c,
+    0x0400ff3b, 0x0400ff3b, 0xfb00ff3b, 0xfb00ff3b, 0x0500ff3b, 0x0500ff3b, 0xfa00ff3b, 0xfa00ff3b,
+    0x0200ff3a, 0x0200ff3a, 0x0200ff3a, 0x0200ff3a, 0xfd00ff3a, 0xfd00ff3a, 0xfd00ff3a, 0xfd00ff3a,
+    0x0300ff3a, 0x0300ff3a, 0x0300ff3a, 0x0300ff3a, 0xfc00ff3a, 0xfc00ff3a, 0xfc00ff3a, 0xfc00ff3a,
+    0x0000ff39, 0x0000ff39, 0x0000ff39, 0x0000ff39, 0x0000ff39, 0x0000ff39, 0x0000ff39, 0x0000ff39,
+    0xff00ff39, 0xff00ff39, 0xff00ff39, 0xff00ff39, 0xff00ff39, 0xff00ff39, 0xff00ff39, 0xff00ff39,
+    0x0100ff39, 0x0100ff39, 0x0100ff39, 0x0100ff39, 0x0100ff39, 0x0100ff39, 0x0100ff39, 0x0100ff39,
+    0xfe00ff39, 0xfe00ff39, 0xfe00ff39, 0xfe00ff39, 0xfe00ff39, 0xfe00ff39, 0xfe00ff39, 0xfe00ff39,
+    0x00ffff26, 0x00ffff26, 0x00ffff26, 0x00ffff26, 0x06ffff3c, 0xf9ffff3c, 0x07ffff3c, 0xf8ffff3c,
+    0x04ffff3b, 0x04ffff3b, 0xfbffff3b, 0xfbffff3b, 0x05ffff3b, 0x05ffff3b, 0xfaffff3b, 0xfaffff3b,
+    0x02ffff3a, 0x02ffff3a, 0x02ffff3a, 0x02ffff3a, 0xfdffff3a, 0xfdffff3a, 0xfdffff3a, 0xfdffff3a,
+    0x03ffff3a, 0x03ffff3a, 0x03ffff3a, 0x03ffff3a, 0xfcffff3a, 0xfcffff3a, 0xfcffff3a, 0xfcffff3a,
+    0x00ffff39, 0x00ffff39, 0x00ffff39, 0x00ffff39, 0x00ffff39, 0x00ffff39, 0x00ffff39, 0x00ffff39,
+    0xffffff39, 0xffffff39, 0xffffff39, 0xffffff39, 0xffffff39, 0xffffff39, 0xffffff39, 0xffffff39,
+    0x01ffff39, 0x01ffff39, 0x01ffff39, 0x01ffff39, 0x01ffff39, 0x01ffff39, 0x01ffff39, 0x01ffff39,
+    0xfeffff39, 0xfeffff39, 0xfeffff39, 0xfeffff39, 0xfeffff39, 0xfeffff39, 0xfeffff39, 0xfeffff39,
+    0x0001ff26, 0x0001ff26, 0x0001ff26, 0x0001ff26, 0x0601ff3c, 0xf901ff3c, 0x0701ff3c, 0xf801ff3c,
+    0x0401ff3b, 0x0401ff3b, 0xfb01ff3b, 0xfb01ff3b, 0x0501ff3b, 0x0501ff3b, 0xfa01ff3b, 0xfa01ff3b,
+    0x0201ff3a, 0x0201ff3a, 0x0201ff3a, 0x0201ff3a, 0xfd01ff3a, 0xfd01ff3a, 0xfd01ff3a, 0xfd01ff3a,
+    0x0301ff3a, 0x0301ff3a, 0x0301ff3a, 0x0301ff3a, 0xfc01ff3a, 0xfc01ff3a, 0xfc01ff3a, 0xfc01ff3a,
+    0x0001ff39, 0x0001ff39, 0x0001ff39, 0x0001ff39, 0x0001ff39, 0x0001ff39, 0x0001ff39, 0x0001ff39,
+    0xff01ff39, 0xff01ff39, 0xff01ff39, 0xff01ff39, 0xff01ff39, 0xff01ff39, 0xff01ff39, 0xff01ff39,
+    0x0101ff39, 0x0101ff39, 0x0101ff39, 0x0101ff39, 0x0101ff39, 0x0101ff39, 0x0101ff39, 0x0101ff39,
+    0xfe01ff39, 0xfe01ff39, 0xfe01ff39, 0xfe01ff39, 0xfe01ff39, 0xfe01ff39, 0xfe01ff39, 0xfe01ff39,
+    0x00feff26, 0x00feff26, 0x00feff26, 0x00feff26, 0x06feff3c, 0xf9feff3c, 0x07feff3c, 0xf8feff3c,
+    0x04feff3b, 0x04feff3b, 0xfbfeff3b, 0xfbfeff3b, 0x05feff3b, 0x05feff3b, 0xfafeff3b, 0xfafeff3b,
+    0x02feff3a, 0x02feff3a, 0x02feff3a, 0x02feff3a, 0xfdfeff3a, 0xfdfeff3a, 0xfdfeff3a, 0xfdfeff3a,
+    0x03feff3a, 0x03feff3a, 0x03feff3a, 0x03feff3a, 0xfcfeff3a, 0xfcfeff3a, 0xfcfeff3a, 0xfcfeff3a,
+    0x00feff39, 0x00feff39, 0x00feff39, 0x00feff39, 0x00feff39, 0x00feff39, 0x00feff39, 0x00feff39,
+    0xfffeff39, 0xfffeff39, 0xfffeff39, 0xfffeff39, 0xfffeff39, 0xfffeff39, 0xfffeff39, 0xfffeff39,
+    0x01feff39, 0x01feff39, 0x01feff39, 0x01feff39, 0x01feff39, 0x01feff39, 0x01feff39, 0x01feff39,
+    0xfefeff39, 0xfefeff39, 0xfefeff39, 0xfefeff39, 0xfefeff39, 0xfefeff39, 0xfefeff39, 0xfefeff39,
+    0x00000113, 0x00000113, 0x00000113, 0x00000113, 0x000c012c, 0x00f3012c, 0x000d012c, 0x00f2012c,
+    0x000a012b, 0x000a012b, 0x00f5012b, 0x00f5012b, 0x000b012b, 0x000b012b, 0x00f4012b, 0x00f4012b,
+    0x0008012a, 0x0008012a, 0x0008012a, 0x0008012a, 0x00f7012a, 0x00f7012a, 0x00f7012a, 0x00f7012a,
+    0x0009012a, 0x0009012a, 0x0009012a, 0x0009012a, 0x00f6012a, 0x00f6012a, 0x00f6012a, 0x00f6012a,
+    0x00060129, 0x00060129, 0x00060129, 0x00060129, 0x0006013c, 0xff06013c, 0x0106013c, 0xfe06013c,
+    0x00f90129, 0x00f90129, 0x00f90129, 0x00f90129, 0x00f9013c, 0xfff9013c, 0x01f9013c, 0xfef9013c,
+    0x00070129, 0x00070129, 0x00070129, 0x00070129, 0x0007013c, 0xff07013c, 0x0107013c, 0xfe07013c,
+    0x00f80129, 0x00f80129, 0x00f80129, 0x00f80129, 0x00f8013c, 0xfff8013c, 0x01f8013c, 0xfef8013c,
+    0x00040128, 0x00040128, 0x00040128, 0x00040128, 0x0204013c, 0xfd04013c, 0x0304013c, 0xfc04013c,
+    0x0004013b, 0x0004013b, 0xff04013b, 0xff04013b, 0x0104013b, 0x0104013b, 0xfe04013b, 0xfe04013b,
+    0x00fb0128, 0x00fb0128, 0x00fb0128, 0x00fb0128, 0x02fb013c, 0xfdfb013c, 0x03fb013c, 0xfcfb013c,
+    0x00fb013b, 0x00fb013b, 0xfffb013b, 0xfffb013b, 0x01fb013b, 0x01fb013b, 0xfefb013b, 0xfefb013b,
+    0x00050128, 0x00050128, 0x00050128, 0x00050128, 0x0205013c, 0xfd05013c, 0x0305013c, 0xfc05013c,
+    0x0005013b, 0x0005013b, 0xff05013b, 0xff05013b, 0x0105013b, 0x0105013b, 0xfe05013b, 0xfe05013b,
+    0x00fa0128, 0x00fa0128, 0x00fa0128, 0x00fa0128, 0x02fa013c, 0xfdfa013c, 0x03fa013c, 0xfcfa013c,
+    0x00fa013b, 0x00fa013b, 0xfffa013b, 0xfffa013b, 0x01fa013b, 0x01fa013b, 0xfefa013b, 0xfefa013b,
+    0x00020127, 0x00020127, 0x00020127, 0x00020127, 0x0402013c, 0xfb02013c, 0x0502013c, 0xfa02013c,
+    0x0202013b, 0x0202013b, 0xfd02013b, 0xfd02013b, 0x0302013b, 0x0302013b, 0xfc02013b, 0xfc02013b,
+    0x0002013a, 0x0002013a, 0x0002013a, 0x0002013a, 0xff02013a, 0xff02013a, 0xff02013a, 0xff02013a,
+    0x0102013a, 0x0102013a, 0x0102013a, 0x0102013a, 0xfe02013a, 0xfe02013a, 0xfe02013a, 0xfe02013a,
+    0x00fd0127, 0x00fd0127, 0x00fd0127, 0x00fd0127, 0x04fd013c, 0xfbfd013c, 0x05fd013c, 0xfafd013c,
+    0x02fd013b, 0x02fd013b, 0xfdfd013b, 0xfdfd013b, 0x03fd013b, 0x03fd013b, 0xfcfd013b, 0xfcfd013b,
+    0x00fd013a, 0x00fd013a, 0x00fd013a, 0x00fd013a, 0xfffd013a, 0xfffd013a, 0xfffd013a, 0xfffd013a,
+    0x01fd013a, 0x01fd013a, 0x01fd013a, 0x01fd013a, 0xfefd013a, 0xfefd013a, 0xfefd013a, 0xfefd013a,
+    0x00030127, 0x00030127, 0x00030127, 0x00030127, 0x0403013c, 0xfb03013c, 0x0503013c, 0xfa03013c,
+    0x0203013b, 0x0203013b, 0xfd03013b, 0xfd03013b, 0x0303013b, 0x0303013b, 0xfc03013b, 0xfc03013b,
+    0x0003013a, 0x0003013a, 0x0003013a, 0x0003013a, 0xff03013a, 0xff03013a, 0xff03013a, 0xff03013a,
+    0x0103013a, 0x0103013a, 0x0103013a, 0x0103013a, 0xfe03013a, 0xfe03013a, 0xfe03013a, 0xfe03013a,
+    0x00fc0127, 0x00fc0127, 0x00fc0127, 0x00fc0127, 0x04fc013c, 0xfbfc013c, 0x05fc013c, 0xfafc013c,
+    0x02fc013b, 0x02fc013b, 0xfdfc013b, 0xfdfc013b, 0x03fc013b, 0x03fc013b, 0xfcfc013b, 0xfcfc013b,
+    0x00fc013a, 0x00fc013a, 0x00fc013a, 0x00fc013a, 0xfffc013a, 0xfffc013a, 0xfffc013a, 0xfffc013a,
+    0x01fc013a, 0x01fc013a, 0x01fc013a, 0x01fc013a, 0xfefc013a, 0xfefc013a, 0xfefc013a, 0xfefc013a,
+    0x00000126, 0x00000126, 0x00000126, 0x00000126, 0x0600013c, 0xf900013c, 0x0700013c, 0xf800013c,
+    0x0400013b, 0x0400013b, 0xfb00013b, 0xfb00013b, 0x0500013b, 0x0500013b, 0xfa00013b, 0xfa00013b,
+    0x0200013a, 0x0200013a, 0x0200013a, 0x0200013a, 0xfd00013a, 0xfd00013a, 0xfd00013a, 0xfd00013a,
+    0x0300013a, 0x0300013a, 0x0300013a, 0x0300013a, 0xfc00013a, 0xfc00013a, 0xfc00013a, 0xfc00013a,
+    0x00000139, 0x00000139, 0x00000139, 0x00000139, 0x00000139, 0x00000139, 0x00000139, 0x00000139,
+    0xff000139, 0xff000139, 0xff000139, 0xff000139, 0xff000139, 0xff000139, 0xff000139, 0xff000139,
+    0x01000139, 0x01000139, 0x01000139, 0x01000139, 0x01000139, 0x01000139, 0x01000139, 0x01000139,
+    0xfe000139, 0xfe000139, 0xfe000139, 0xfe000139, 0xfe000139, 0xfe000139, 0xfe000139, 0xfe000139,
+    0x00ff0126, 0x00ff0126, 0x00ff0126, 0x00ff0126, 0x06ff013c, 0xf9ff013c, 0x07ff013c, 0xf8ff013c,
+    0x04ff013b, 0x04ff013b, 0xfbff013b, 0xfbff013b, 0x05ff013b, 0x05ff013b, 0xfaff013b, 0xfaff013b,
+    0x02ff013a, 0x02ff013a, 0x02ff013a, 0x02ff013a, 0xfdff013a, 0xfdff013a, 0xfdff013a, 0xfdff013a,
+    0x03ff013a, 0x03ff013a, 0x03ff013a, 0x03ff013a, 0xfcff013a, 0xfcff013a, 0xfcff013a, 0xfcff013a,
+    0x00ff0139, 0x00ff0139, 0x00ff0139, 0x00ff0139, 0x00ff0139, 0x00ff0139, 0x00ff0139, 0x00ff0139,
+    0xffff0139, 0xffff0139, 0xffff0139, 0xffff0139, 0xffff0139, 0xffff0139, 0xffff0139, 0xffff0139,
+    0x01ff0139, 0x01ff0139, 0x01ff0139, 0x01ff0139, 0x01ff0139, 0x01ff0139, 0x01ff0139, 0x01ff0139,
+    0xfeff0139, 0xfeff0139, 0xfeff0139, 0xfeff0139, 0xfeff0139, 0xfeff0139, 0xfeff0139, 0xfeff0139,
+    0x00010126, 0x00010126, 0x00010126, 0x00010126, 0x0601013c, 0xf901013c, 0x0701013c, 0xf801013c,
+    0x0401013b, 0x0401013b, 0xfb01013b, 0xfb01013b, 0x0501013b, 0x0501013b, 0xfa01013b, 0xfa01013b,
+    0x0201013a, 0x0201013a, 0x0201013a, 0x0201013a, 0xfd01013a, 0xfd01013a, 0xfd01013a, 0xfd01013a,
+    0x0301013a, 0x0301013a, 0x0301013a, 0x0301013a, 0xfc01013a, 0xfc01013a, 0xfc01013a, 0xfc01013a,
+    0x00010139, 0x00010139, 0x00010139, 0x00010139, 0x00010139, 0x00010139, 0x00010139, 0x00010139,
+    0xff010139, 0xff010139, 0xff010139, 0xff010139, 0xff010139, 0xff010139, 0xff010139, 0xff010139,
+    0x01010139, 0x01010139, 0x01010139, 0x01010139, 0x01010139, 0x01010139, 0x01010139, 0x01010139,
+    0xfe010139, 0xfe010139, 0xfe010139, 0xfe010139, 0xfe010139, 0xfe010139, 0xfe010139, 0xfe010139,
+    0x00fe0126, 0x00fe0126, 0x00fe0126, 0x00fe0126, 0x06fe013c, 0xf9fe013c, 0x07fe013c, 0xf8fe013c,
+    0x04fe013b, 0x04fe013b, 0xfbfe013b, 0xfbfe013b, 0x05fe013b, 0x05fe013b, 0xfafe013b, 0xfafe013b,
+    0x02fe013a, 0x02fe013a, 0x02fe013a, 0x02fe013a, 0xfdfe013a, 0xfdfe013a, 0xfdfe013a, 0xfdfe013a,
+    0x03fe013a, 0x03fe013a, 0x03fe013a, 0x03fe013a, 0xfcfe013a, 0xfcfe013a, 0xfcfe013a, 0xfcfe013a,
+    0x00fe0139, 0x00fe0139, 0x00fe0139, 0x00fe0139, 0x00fe0139, 0x00fe0139, 0x00fe0139, 0x00fe0139,
+    0xfffe0139, 0xfffe0139, 0xfffe0139, 0xfffe0139, 0xfffe0139, 0xfffe0139, 0xfffe0139, 0xfffe0139,
+    0x01fe0139, 0x01fe0139, 0x01fe0139, 0x01fe0139, 0x01fe0139, 0x01fe0139, 0x01fe0139, 0x01fe0139,
+    0xfefe0139, 0xfefe0139, 0xfefe0139, 0xfefe0139, 0xfefe0139, 0xfefe0139, 0xfefe0139, 0xfefe0139,
+    0x0000fe13, 0x0000fe13, 0x0000fe13, 0x0000fe13, 0x000cfe2c, 0x00f3fe2c, 0x000dfe2c, 0x00f2fe2c,
+    0x000afe2b, 0x000afe2b, 0x00f5fe2b, 0x00f5fe2b, 0x000bfe2b, 0x000bfe2b, 0x00f4fe2b, 0x00f4fe2b,
+    0x0008fe2a, 0x0008fe2a, 0x0008fe2a, 0x0008fe2a, 0x00f7fe2a, 0x00f7fe2a, 0x00f7fe2a, 0x00f7fe2a,
+    0x0009fe2a, 0x0009fe2a, 0x0009fe2a, 0x0009fe2a, 0x00f6fe2a, 0x00f6fe2a, 0x00f6fe2a, 0x00f6fe2a,
+    0x0006fe29, 0x0006fe29, 0x0006fe29, 0x0006fe29, 0x0006fe3c, 0xff06fe3c, 0x0106fe3c, 0xfe06fe3c,
+    0x00f9fe29, 0x00f9fe29, 0x00f9fe29, 0x00f9fe29, 0x00f9fe3c, 0xfff9fe3c, 0x01f9fe3c, 0xfef9fe3c,
+    0x0007fe29, 0x0007fe29, 0x0007fe29, 0x0007fe29, 0x0007fe3c, 0xff07fe3c, 0x0107fe3c, 0xfe07fe3c,
+    0x00f8fe29, 0x00f8fe29, 0x00f8fe29, 0x00f8fe29, 0x00f8fe3c, 0xfff8fe3c, 0x01f8fe3c, 0xfef8fe3c,
+    0x0004fe28, 0x0004fe28, 0x0004fe28, 0x0004fe28, 0x0204fe3c, 0xfd04fe3c, 0x0304fe3c, 0xfc04fe3c,
+    0x0004fe3b, 0x0004fe3b, 0xff04fe3b, 0xff04fe3b, 0x0104fe3b, 0x0104fe3b, 0xfe04fe3b, 0xfe04fe3b,
+    0x00fbfe28, 0x00fbfe28, 0x00fbfe28, 0x00fbfe28, 0x02fbfe3c, 0xfdfbfe3c, 0x03fbfe3c, 0xfcfbfe3c,
+    0x00fbfe3b, 0x00fbfe3b, 0xfffbfe3b, 0xfffbfe3b, 0x01fbfe3b, 0x01fbfe3b, 0xfefbfe3b, 0xfefbfe3b,
+    0x0005fe28, 0x0005fe28, 0x0005fe28, 0x0005fe28, 0x0205fe3c, 0xfd05fe3c, 0x0305fe3c, 0xfc05fe3c,
+    0x0005fe3b, 0x0005fe3b, 0xff05fe3b, 0xff05fe3b, 0x0105fe3b, 0x0105fe3b, 0xfe05fe3b, 0xfe05fe3b,
+    0x00fafe28, 0x00fafe28, 0x00fafe28, 0x00fafe28, 0x02fafe3c, 0xfdfafe3c, 0x03fafe3c, 0xfcfafe3c,
+    0x00fafe3b, 0x00fafe3b, 0xfffafe3b, 0xfffafe3b, 0x01fafe3b, 0x01fafe3b, 0xfefafe3b, 0xfefafe3b,
+    0x0002fe27, 0x0002fe27, 0x0002fe27, 0x0002fe27, 0x0402fe3c, 0xfb02fe3c, 0x0502fe3c, 0xfa02fe3c,
+    0x0202fe3b, 0x0202fe3b, 0xfd02fe3b, 0xfd02fe3b, 0x0302fe3b, 0x0302fe3b, 0xfc02fe3b, 0xfc02fe3b,
+    0x0002fe3a, 0x0002fe3a, 0x0002fe3a, 0x0002fe3a, 0xff02fe3a, 0xff02fe3a, 0xff02fe3a, 0xff02fe3a,
+    0x0102fe3a, 0x0102fe3a, 0x0102fe3a, 0x0102fe3a, 0xfe02fe3a, 0xfe02fe3a, 0xfe02fe3a, 0xfe02fe3a,
+    0x00fdfe27, 0x00fdfe27, 0x00fdfe27, 0x00fdfe27, 0x04fdfe3c, 0xfbfdfe3c, 0x05fdfe3c, 0xfafdfe3c,
+    0x02fdfe3b, 0x02fdfe3b, 0xfdfdfe3b, 0xfdfdfe3b, 0x03fdfe3b, 0x03fdfe3b, 0xfcfdfe3b, 0xfcfdfe3b,
+    0x00fdfe3a, 0x00fdfe3a, 0x00fdfe3a, 0x00fdfe3a, 0xfffdfe3a, 0xfffdfe3a, 0xfffdfe3a, 0xfffdfe3a,
+    0x01fdfe3a, 0x01fdfe3a, 0x01fdfe3a, 0x01fdfe3a, 0xfefdfe3a, 0xfefdfe3a, 0xfefdfe3a, 0xfefdfe3a,
+    0x0003fe27, 0x0003fe27, 0x0003fe27, 0x0003fe27, 0x0403fe3c, 0xfb03fe3c, 0x0503fe3c, 0xfa03fe3c,
+    0x0203fe3b, 0x0203fe3b, 0xfd03fe3b, 0xfd03fe3b, 0x0303fe3b, 0x0303fe3b, 0xfc03fe3b, 0xfc03fe3b,
+    0x0003fe3a, 0x0003fe3a, 0x0003fe3a, 0x0003fe3a, 0xff03fe3a, 0xff03fe3a, 0xff03fe3a, 0xff03fe3a,
+    0x0103fe3a, 0x0103fe3a, 0x0103fe3a, 0x0103fe3a, 0xfe03fe3a, 0xfe03fe3a, 0xfe03fe3a, 0xfe03fe3a,
+    0x00fcfe27, 0x00fcfe27, 0x00fcfe27, 0x00fcfe27, 0x04fcfe3c, 0xfbfcfe3c, 0x05fcfe3c, 0xfafcfe3c,
+    0x02fcfe3b, 0x02fcfe3b, 0xfdfcfe3b, 0xfdfcfe3b, 0x03fcfe3b, 0x03fcfe3b, 0xfcfcfe3b, 0xfcfcfe3b,
+    0x00fcfe3a, 0x00fcfe3a, 0x00fcfe3a, 0x00fcfe3a, 0xfffcfe3a, 0xfffcfe3a, 0xfffcfe3a, 0xfffcfe3a,
+    0x01fcfe3a, 0x01fcfe3a, 0x01fcfe3a, 0x01fcfe3a, 0xfefcfe3a, 0xfefcfe3a, 0xfefcfe3a, 0xfefcfe3a,
+    0x0000fe26, 0x0000fe26, 0x0000fe26, 0x0000fe26, 0x0600fe3c, 0xf900fe3c, 0x0700fe3c, 0xf800fe3c,
+    0x0400fe3b, 0x0400fe3b, 0xfb00fe3b, 0xfb00fe3b, 0x0500fe3b, 0x0500fe3b, 0xfa00fe3b, 0xfa00fe3b,
+    0x0200fe3a, 0x0200fe3a, 0x0200fe3a, 0x0200fe3a, 0xfd00fe3a, 0xfd00fe3a, 0xfd00fe3a, 0xfd00fe3a,
+    0x0300fe3a, 0x0300fe3a, 0x0300fe3a, 0x0300fe3a, 0xfc00fe3a, 0xfc00fe3a, 0xfc00fe3a, 0xfc00fe3a,
+    0x0000fe39, 0x0000fe39, 0x0000fe39, 0x0000fe39, 0x0000fe39, 0x0000fe39, 0x0000fe39, 0x0000fe39,
+    0xff00fe39, 0xff00fe39, 0xff00fe39, 0xff00fe39, 0xff00fe39, 0xff00fe39, 0xff00fe39, 0xff00fe39,
+    0x0100fe39, 0x0100fe39, 0x0100fe39, 0x0100fe39, 0x0100fe39, 0x0100fe39, 0x0100fe39, 0x0100fe39,
+    0xfe00fe39, 0xfe00fe39, 0xfe00fe39, 0xfe00fe39, 0xfe00fe39, 0xfe00fe39, 0xfe00fe39, 0xfe00fe39,
+    0x00fffe26, 0x00fffe26, 0x00fffe26, 0x00fffe26, 0x06fffe3c, 0xf9fffe3c, 0x07fffe3c, 0xf8fffe3c,
+    0x04fffe3b, 0x04fffe3b, 0xfbfffe3b, 0xfbfffe3b, 0x05fffe3b, 0x05fffe3b, 0xfafffe3b, 0xfafffe3b,
+    0x02fffe3a, 0x02fffe3a, 0x02fffe3a, 0x02fffe3a, 0xfdfffe3a, 0xfdfffe3a, 0xfdfffe3a, 0xfdfffe3a,
+    0x03fffe3a, 0x03fffe3a, 0x03fffe3a, 0x03fffe3a, 0xfcfffe3a, 0xfcfffe3a, 0xfcfffe3a, 0xfcfffe3a,
+    0x00fffe39, 0x00fffe39, 0x00fffe39, 0x00fffe39, 0x00fffe39, 0x00fffe39, 0x00fffe39, 0x00fffe39,
+    0xfffffe39, 0xfffffe39, 0xfffffe39, 0xfffffe39, 0xfffffe39, 0xfffffe39, 0xfffffe39, 0xfffffe39,
+    0x01fffe39, 0x01fffe39, 0x01fffe39, 0x01fffe39, 0x01fffe39, 0x01fffe39, 0x01fffe39, 0x01fffe39,
+    0xfefffe39, 0xfefffe39, 0xfefffe39, 0xfefffe39, 0xfefffe39, 0xfefffe39, 0xfefffe39, 0xfefffe39,
+    0x0001fe26, 0x0001fe26, 0x0001fe26, 0x0001fe26, 0x0601fe3c, 0xf901fe3c, 0x0701fe3c, 0xf801fe3c,
+    0x0401fe3b, 0x0401fe3b, 0xfb01fe3b, 0xfb01fe3b, 0x0501fe3b, 0x0501fe3b, 0xfa01fe3b, 0xfa01fe3b,
+    0x0201fe3a, 0x0201fe3a, 0x0201fe3a, 0x0201fe3a, 0xfd01fe3a, 0xfd01fe3a, 0xfd01fe3a, 0xfd01fe3a,
+    0x0301fe3a, 0x0301fe3a, 0x0301fe3a, 0x0301fe3a, 0xfc01fe3a, 0xfc01fe3a, 0xfc01fe3a, 0xfc01fe3a,
+    0x0001fe39, 0x0001fe39, 0x0001fe39, 0x0001fe39, 0x0001fe39, 0x0001fe39, 0x0001fe39, 0x0001fe39,
+    0xff01fe39, 0xff01fe39, 0xff01fe39, 0xff01fe39, 0xff01fe39, 0xff01fe39, 0xff01fe39, 0xff01fe39,
+    0x0101fe39, 0x0101fe39, 0x0101fe39, 0x0101fe39, 0x0101fe39, 0x0101fe39, 0x0101fe39, 0x0101fe39,
+    0xfe01fe39, 0xfe01fe39, 0xfe01fe39, 0xfe01fe39, 0xfe01fe39, 0xfe01fe39, 0xfe01fe39, 0xfe01fe39,
+    0x00fefe26, 0x00fefe26, 0x00fefe26, 0x00fefe26, 0x06fefe3c, 0xf9fefe3c, 0x07fefe3c, 0xf8fefe3c,
+    0x04fefe3b, 0x04fefe3b, 0xfbfefe3b, 0xfbfefe3b, 0x05fefe3b, 0x05fefe3b, 0xfafefe3b, 0xfafefe3b,
+    0x02fefe3a, 0x02fefe3a, 0x02fefe3a, 0x02fefe3a, 0xfdfefe3a, 0xfdfefe3a, 0xfdfefe3a, 0xfdfefe3a,
+    0x03fefe3a, 0x03fefe3a, 0x03fefe3a, 0x03fefe3a, 0xfcfefe3a, 0xfcfefe3a, 0xfcfefe3a, 0xfcfefe3a,
+    0x00fefe39, 0x00fefe39, 0x00fefe39, 0x00fefe39, 0x00fefe39, 0x00fefe39, 0x00fefe39, 0x00fefe39,
+    0xfffefe39, 0xfffefe39, 0xfffefe39, 0xfffefe39, 0xfffefe39, 0xfffefe39, 0xfffefe39, 0xfffefe39,
+    0x01fefe39, 0x01fefe39, 0x01fefe39, 0x01fefe39, 0x01fefe39, 0x01fefe39, 0x01fefe39, 0x01fefe39,
+    0xfefefe39, 0xfefefe39, 0xfefefe39, 0xfefefe39, 0xfefefe39, 0xfefefe39, 0xfefefe39, 0xfefefe39,
+  },
+  {
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x0000201c, 0x0000df1c, 0x0000211c, 0x0000de1c, 0x0000221c, 0x0000dd1c, 0x0000231c, 0x0000dc1c,
+    0x00001c1b, 0x00001c1b, 0x0000e31b, 0x0000e31b, 0x00001d1b, 0x00001d1b, 0x0000e21b, 0x0000e21b,
+    0x00001e1b, 0x00001e1b, 0x0000e11b, 0x0000e11b, 0x00001f1b, 0x00001f1b, 0x0000e01b, 0x0000e01b,
+    0x0000181a, 0x0000181a, 0x0000181a, 0x0000181a, 0x0000e71a, 0x0000e71a, 0x0000e71a, 0x0000e71a,
+    0x0000191a, 0x0000191a, 0x0000191a, 0x0000191a, 0x0000e61a, 0x0000e61a, 0x0000e61a, 0x0000e61a,
+    0x00001a1a, 0x00001a1a, 0x00001a1a, 0x00001a1a, 0x0000e51a, 0x0000e51a, 0x0000e51a, 0x0000e51a,
+    0x00001b1a, 0x00001b1a, 0x00001b1a, 0x00001b1a, 0x0000e41a, 0x0000e41a, 0x0000e41a, 0x0000e41a,
+    0x00001419, 0x00001419, 0x00001419, 0x00001419, 0x00001419, 0x00001419, 0x00001419, 0x00001419,
+    0x0000eb19, 0x0000eb19, 0x0000eb19, 0x0000eb19, 0x0000eb19, 0x0000eb19, 0x0000eb19, 0x0000eb19,
+    0x00001519, 0x00001519, 0x00001519, 0x00001519, 0x00001519, 0x00001519, 0x00001519, 0x00001519,
+    0x0000ea19, 0x0000ea19, 0x0000ea19, 0x0000ea19, 0x0000ea19, 0x0000ea19, 0x0000ea19, 0x0000ea19,
+    0x00001619, 0x00001619, 0x00001619, 0x00001619, 0x00001619, 0x00001619, 0x00001619, 0x00001619,
+    0x0000e919, 0x0000e919, 0x0000e919, 0x0000e919, 0x0000e919, 0x0000e919, 0x0000e919, 0x0000e919,
+    0x00001719, 0x00001719, 0x00001719, 0x00001719, 0x00001719, 0x00001719, 0x00001719, 0x00001719,
+    0x0000e819, 0x0000e819, 0x0000e819, 0x0000e819, 0x0000e819, 0x0000e819, 0x0000e819, 0x0000e819,
+    0x00001018, 0x00001018, 0x00001018, 0x00001018, 0x00001018, 0x00001018, 0x00001018, 0x00001018,
+    0x0000102c, 0x00ff102c, 0x0001102c, 0x00fe102c, 0x0002102c, 0x00fd102c, 0x0003102c, 0x00fc102c,
+    0x0000ef18, 0x0000ef18, 0x0000ef18, 0x0000ef18, 0x0000ef18, 0x0000ef18, 0x0000ef18, 0x0000ef18,
+    0x0000ef2c, 0x00ffef2c, 0x0001ef2c, 0x00feef2c, 0x0002ef2c, 0x00fdef2c, 0x0003ef2c, 0x00fcef2c,
+    0x00001118, 0x00001118, 0x00001118, 0x00001118, 0x00001118, 0x00001118, 0x00001118, 0x00001118,
+    0x0000112c, 0x00ff112c, 0x0001112c, 0x00fe112c, 0x0002112c, 0x00fd112c, 0x0003112c, 0x00fc112c,
+    0x0000ee18, 0x0000ee18, 0x0000ee18, 0x0000ee18, 0x0000ee18, 0x0000ee18, 0x0000ee18, 0x0000ee18,
+    0x0000ee2c, 0x00ffee2c, 0x0001ee2c, 0x00feee2c, 0x0002ee2c, 0x00fdee2c, 0x0003ee2c, 0x00fcee2c,
+    0x00001218, 0x00001218, 0x00001218, 0x00001218, 0x00001218, 0x00001218, 0x00001218, 0x00001218,
+    0x0000122c, 0x00ff122c, 0x0001122c, 0x00fe122c, 0x0002122c, 0x00fd122c, 0x0003122c, 0x00fc122c,
+    0x0000ed18, 0x0000ed18, 0x0000ed18, 0x0000ed18, 0x0000ed18, 0x0000ed18, 0x0000ed18, 0x0000ed18,
+    0x0000ed2c, 0x00ffed2c, 0x0001ed2c, 0x00feed2c, 0x0002ed2c, 0x00fded2c, 0x0003ed2c, 0x00fced2c,
+    0x00001318, 0x00001318, 0x00001318, 0x00001318, 0x00001318, 0x00001318, 0x00001318, 0x00001318,
+    0x0000132c, 0x00ff132c, 0x0001132c, 0x00fe132c, 0x0002132c, 0x00fd132c, 0x0003132c, 0x00fc132c,
+    0x0000ec18, 0x0000ec18, 0x0000ec18, 0x0000ec18, 0x0000ec18, 0x0000ec18, 0x0000ec18, 0x0000ec18,
+    0x0000ec2c, 0x00ffec2c, 0x0001ec2c, 0x00feec2c, 0x0002ec2c, 0x00fdec2c, 0x0003ec2c, 0x00fcec2c,
+    0x00000c17, 0x00000c17, 0x00000c17, 0x00000c17, 0x00000c17, 0x00000c17, 0x00000c17, 0x00000c17,
+    0x00040c2c, 0x00fb0c2c, 0x00050c2c, 0x00fa0c2c, 0x00060c2c, 0x00f90c2c, 0x00070c2c, 0x00f80c2c,
+    0x00000c2b, 0x00000c2b, 0x00ff0c2b, 0x00ff0c2b, 0x00010c2b, 0x00010c2b, 0x00fe0c2b, 0x00fe0c2b,
+    0x00020c2b, 0x00020c2b, 0x00fd0c2b, 0x00fd0c2b, 0x00030c2b, 0x00030c2b, 0x00fc0c2b, 0x00fc0c2b,
+    0x0000f317, 0x0000f317, 0x0000f317, 0x0000f317, 0x0000f317, 0x0000f317, 0x0000f317, 0x0000f317,
+    0x0004f32c, 0x00fbf32c, 0x0005f32c, 0x00faf32c, 0x0006f32c, 0x00f9f32c, 0x0007f32c, 0x00f8f32c,
+    0x0000f32b, 0x0000f32b, 0x00fff32b, 0x00fff32b, 0x0001f32b, 0x0001f32b, 0x00fef32b, 0x00fef32b,
+    0x0002f32b, 0x0002f32b, 0x00fdf32b, 0x00fdf32b, 0x0003f32b, 0x0003f32b, 0x00fcf32b, 0x00fcf32b,
+    0x00000d17, 0x00000d17, 0x00000d17, 0x00000d17, 0x00000d17, 0x00000d17, 0x00000d17, 0x00000d17,
+    0x00040d2c, 0x00fb0d2c, 0x00050d2c, 0x00fa0d2c, 0x00060d2c, 0x00f90d2c, 0x00070d2c, 0x00f80d2c,
+    0x00000d2b, 0x00000d2b, 0x00ff0d2b, 0x00ff0d2b, 0x00010d2b, 0x00010d2b, 0x00fe0d2b, 0x00fe0d2b,
+    0x00020d2b, 0x00020d2b, 0x00fd0d2b, 0x00fd0d2b, 0x00030d2b, 0x00030d2b, 0x00fc0d2b, 0x00fc0d2b,
+    0x0000f217, 0x0000f217, 0x0000f217, 0x0000f217, 0x0000f217, 0x0000f217, 0x0000f217, 0x0000f217,
+    0x0004f22c, 0x00fbf22c, 0x0005f22c, 0x00faf22c, 0x0006f22c, 0x00f9f22c, 0x0007f22c, 0x00f8f22c,
+    0x0000f22b, 0x0000f22b, 0x00fff22b, 0x00fff22b, 0x0001f22b, 0x0001f22b, 0x00fef22b, 0x00fef22b,
+    0x0002f22b, 0x0002f22b, 0x00fdf22b, 0x00fdf22b, 0x0003f22b, 0x0003f22b, 0x00fcf22b, 0x00fcf22b,
+    0x00000e17, 0x00000e17, 0x00000e17, 0x00000e17, 0x00000e17, 0x00000e17, 0x00000e17, 0x00000e17,
+    0x00040e2c, 0x00fb0e2c, 0x00050e2c, 0x00fa0e2c, 0x00060e2c, 0x00f90e2c, 0x00070e2c, 0x00f80e2c,
+    0x00000e2b, 0x00000e2b, 0x00ff0e2b, 0x00ff0e2b, 0x00010e2b, 0x00010e2b, 0x00fe0e2b, 0x00fe0e2b,
+    0x00020e2b, 0x00020e2b, 0x00fd0e2b, 0x00fd0e2b, 0x00030e2b, 0x00030e2b, 0x00fc0e2b, 0x00fc0e2b,
+    0x0000f117, 0x0000f117, 0x0000f117, 0x0000f117, 0x0000f117, 0x0000f117, 0x0000f117, 0x0000f117,
+    0x0004f12c, 0x00fbf12c, 0x0005f12c, 0x00faf12c, 0x0006f12c, 0x00f9f12c, 0x0007f12c, 0x00f8f12c,
+    0x0000f12b, 0x0000f12b, 0x00fff12b, 0x00fff12b, 0x0001f12b, 0x0001f12b, 0x00fef12b, 0x00fef12b,
+    0x0002f12b, 0x0002f12b, 0x00fdf12b, 0x00fdf12b, 0x0003f12b, 0x0003f12b, 0x00fcf12b, 0x00fcf12b,
+    0x00000f17, 0x00000f17, 0x00000f17, 0x00000f17, 0x00000f17, 0x00000f17, 0x00000f17, 0x00000f17,
+    0x00040f2c, 0x00fb0f2c, 0x00050f2c, 0x00fa0f2c, 0x00060f2c, 0x00f90f2c, 0x00070f2c, 0x00f80f2c,
+    0x00000f2b, 0x00000f2b, 0x00ff0f2b, 0x00ff0f2b, 0x00010f2b, 0x00010f2b, 0x00fe0f2b, 0x00fe0f2b,
+    0x00020f2b, 0x00020f2b, 0x00fd0f2b, 0x00fd0f2b, 0x00030f2b, 0x00030f2b, 0x00fc0f2b, 0x00fc0f2b,
+    0x0000f017, 0x0000f017, 0x0000f017, 0x0000f017, 0x0000f017, 0x0000f017, 0x0000f017, 0x0000f017,
+    0x0004f02c, 0x00fbf02c, 0x0005f02c, 0x00faf02c, 0x0006f02c, 0x00f9f02c, 0x0007f02c, 0x00f8f02c,
+    0x0000f02b, 0x0000f02b, 0x00fff02b, 0x00fff02b, 0x0001f02b, 0x0001f02b, 0x00fef02b, 0x00fef02b,
+    0x0002f02b, 0x0002f02b, 0x00fdf02b, 0x00fdf02b, 0x0003f02b, 0x0003f02b, 0x00fcf02b, 0x00fcf02b,
+    0x00000816, 0x00000816, 0x00000816, 0x00000816, 0x00000816, 0x00000816, 0x00000816, 0x00000816,
+    0x0008082c, 0x00f7082c, 0x0009082c, 0x00f6082c, 0x000a082c, 0x00f5082c, 0x000b082c, 0x00f4082c,
+    0x0004082b, 0x0004082b, 0x00fb082b, 0x00fb082b, 0x0005082b, 0x0005082b, 0x00fa082b, 0x00fa082b,
+    0x0006082b, 0x0006082b, 0x00f9082b, 0x00f9082b, 0x0007082b, 0x0007082b, 0x00f8082b, 0x00f8082b,
+    0x0000082a, 0x0000082a, 0x0000082a, 0x0000082a, 0x00ff082a, 0x00ff082a, 0x00ff082a, 0x00ff082a,
+    0x0001082a, 0x0001082a, 0x0001082a, 0x0001082a, 0x00fe082a, 0x00fe082a, 0x00fe082a, 0x00fe082a,
+    0x0002082a, 0x0002082a, 0x0002082a, 0x0002082a, 0x00fd082a, 0x00fd082a, 0x00fd082a, 0x00fd082a,
+    0x0003082a, 0x0003082a, 0x0003082a, 0x0003082a, 0x00fc082a, 0x00fc082a, 0x00fc082a, 0x00fc082a,
+    0x0000f716, 0x0000f716, 0x0000f716, 0x0000f716, 0x0000f716, 0x0000f716, 0x0000f716, 0x0000f716,
+    0x0008f72c, 0x00f7f72c, 0x0009f72c, 0x00f6f72c, 0x000af72c, 0x00f5f72c, 0x000bf72c, 0x00f4f72c,
+    0x0004f72b, 0x0004f72b, 0x00fbf72b, 0x00fbf72b, 0x0005f72b, 0x0005f72b, 0x00faf72b, 0x00faf72b,
+    0x0006f72b, 0x0006f72b, 0x00f9f72b, 0x00f9f72b, 0x0007f72b, 0x0007f72b, 0x00f8f72b, 0x00f8f72b,
+    0x0000f72a, 0x0000f72a, 0x0000f72a, 0x0000f72a, 0x00fff72a, 0x00fff72a, 0x00fff72a, 0x00fff72a,
+    0x0001f72a, 0x0001f72a, 0x0001f72a, 0x0001f72a, 0x00fef72a, 0x00fef72a, 0x00fef72a, 0x00fef72a,
+    0x0002f72a, 0x0002f72a, 0x0002f72a, 0x0002f72a, 0x00fdf72a, 0x00fdf72a, 0x00fdf72a, 0x00fdf72a,
+    0x0003f72a, 0x0003f72a, 0x0003f72a, 0x0003f72a, 0x00fcf72a, 0x00fcf72a, 0x00fcf72a, 0x00fcf72a,
+    0x00000916, 0x00000916, 0x00000916, 0x00000916, 0x00000916, 0x00000916, 0x00000916, 0x00000916,
+    0x0008092c, 0x00f7092c, 0x0009092c, 0x00f6092c, 0x000a092c, 0x00f5092c, 0x000b092c, 0x00f4092c,
+    0x0004092b, 0x0004092b, 0x00fb092b, 0x00fb092b, 0x0005092b, 0x0005092b, 0x00fa092b, 0x00fa092b,
+    0x0006092b, 0x0006092b, 0x00f9092b, 0x00f9092b, 0x0007092b, 0x0007092b, 0x00f8092b, 0x00f8092b,
+    0x0000092a, 0x0000092a, 0x0000092a, 0x0000092a, 0x00ff092a, 0x00ff092a, 0x00ff092a, 0x00ff092a,
+    0x0001092a, 0x0001092a, 0x0001092a, 0x0001092a, 0x00fe092a, 0x00fe092a, 0x00fe092a, 0x00fe092a,
+    0x0002092a, 0x0002092a, 0x0002092a, 0x0002092a, 0x00fd092a, 0x00fd092a, 0x00fd092a, 0x00fd092a,
+    0x0003092a, 0x0003092a, 0x0003092a, 0x0003092a, 0x00fc092a, 0x00fc092a, 0x00fc092a, 0x00fc092a,
+    0x0000f616, 0x0000f616, 0x0000f616, 0x0000f616, 0x0000f616, 0x0000f616, 0x0000f616, 0x0000f616,
+    0x0008f62c, 0x00f7f62c, 0x0009f62c, 0x00f6f62c, 0x000af62c, 0x00f5f62c, 0x000bf62c, 0x00f4f62c,
+    0x0004f62b, 0x0004f62b, 0x00fbf62b, 0x00fbf62b, 0x0005f62b, 0x0005f62b, 0x00faf62b, 0x00faf62b,
+    0x0006f62b, 0x0006f62b, 0x00f9f62b, 0x00f9f62b, 0x0007f62b, 0x0007f62b, 0x00f8f62b, 0x00f8f62b,
+    0x0000f62a, 0x0000f62a, 0x0000f62a, 0x0000f62a, 0x00fff62a, 0x00fff62a, 0x00fff62a, 0x00fff62a,
+    0x0001f62a, 0x0001f62a, 0x0001f62a, 0x0001f62a, 0x00fef62a, 0x00fef62a, 0x00fef62a, 0x00fef62a,
+    0x0002f62a, 0x0002f62a, 0x0002f62a, 0x0002f62a, 0x00fdf62a, 0x00fdf62a, 0x00fdf62a, 0x00fdf62a,
+    0x0003f62a, 0x0003f62a, 0x0003f62a, 0x0003f62a, 0x00fcf62a, 0x00fcf62a, 0x00fcf62a, 0x00fcf62a,
+    0x00000a16, 0x00000a16, 0x00000a16, 0x00000a16, 0x00000a16, 0x00000a16, 0x00000a16, 0x00000a16,
+    0x00080a2c, 0x00f70a2c, 0x00090a2c, 0x00f60a2c, 0x000a0a2c, 0x00f50a2c, 0x000b0a2c, 0x00f40a2c,
+    0x00040a2b, 0x00040a2b, 0x00fb0a2b, 0x00fb0a2b, 0x00050a2b, 0x00050a2b, 0x00fa0a2b, 0x00fa0a2b,
+    0x00060a2b, 0x00060a2b, 0x00f90a2b, 0x00f90a2b, 0x00070a2b, 0x00070a2b, 0x00f80a2b, 0x00f80a2b,
+    0x00000a2a, 0x00000a2a, 0x00000a2a, 0x00000a2a, 0x00ff0a2a, 0x00ff0a2a, 0x00ff0a2a, 0x00ff0a2a,
+    0x00010a2a, 0x00010a2a, 0x00010a2a, 0x00010a2a, 0x00fe0a2a, 0x00fe0a2a, 0x00fe0a2a, 0x00fe0a2a,
+    0x00020a2a, 0x00020a2a, 0x00020a2a, 0x00020a2a, 0x00fd0a2a, 0x00fd0a2a, 0x00fd0a2a, 0x00fd0a2a,
+    0x00030a2a, 0x00030a2a, 0x00030a2a, 0x00030a2a, 0x00fc0a2a, 0x00fc0a2a, 0x00fc0a2a, 0x00fc0a2a,
+    0x0000f516, 0x0000f516, 0x0000f516, 0x0000f516, 0x0000f516, 0x0000f516, 0x0000f516, 0x0000f516,
+    0x0008f52c, 0x00f7f52c, 0x0009f52c, 0x00f6f52c, 0x000af52c, 0x00f5f52c, 0x000bf52c, 0x00f4f52c,
+    0x0004f52b, 0x0004f52b, 0x00fbf52b, 0x00fbf52b, 0x0005f52b, 0x0005f52b, 0x00faf52b, 0x00faf52b,
+    0x0006f52b, 0x0006f52b, 0x00f9f52b, 0x00f9f52b, 0x0007f52b, 0x0007f52b, 0x00f8f52b, 0x00f8f52b,
+    0x0000f52a, 0x0000f52a, 0x0000f52a, 0x0000f52a, 0x00fff52a, 0x00fff52a, 0x00fff52a, 0x00fff52a,
+    0x0001f52a, 0x0001f52a, 0x0001f52a, 0x0001f52a, 0x00fef52a, 0x00fef52a, 0x00fef52a, 0x00fef52a,
+    0x0002f52a, 0x0002f52a, 0x0002f52a, 0x0002f52a, 0x00fdf52a, 0x00fdf52a, 0x00fdf52a, 0x00fdf52a,
+    0x0003f52a, 0x0003f52a, 0x0003f52a, 0x0003f52a, 0x00fcf52a, 0x00fcf52a, 0x00fcf52a, 0x00fcf52a,
+    0x00000b16, 0x00000b16, 0x00000b16, 0x00000b16, 0x00000b16, 0x00000b16, 0x00000b16, 0x00000b16,
+    0x00080b2c, 0x00f70b2c, 0x00090b2c, 0x00f60b2c, 0x000a0b2c, 0x00f50b2c, 0x000b0b2c, 0x00f40b2c,
+    0x00040b2b, 0x00040b2b, 0x00fb0b2b, 0x00fb0b2b, 0x00050b2b, 0x00050b2b, 0x00fa0b2b, 0x00fa0b2b,
+    0x00060b2b, 0x00060b2b, 0x00f90b2b, 0x00f90b2b, 0x00070b2b, 0x00070b2b, 0x00f80b2b, 0x00f80b2b,
+    0x00000b2a, 0x00000b2a, 0x00000b2a, 0x00000b2a, 0x00ff0b2a, 0x00ff0b2a, 0x00ff0b2a, 0x00ff0b2a,
+    0x00010b2a, 0x00010b2a, 0x00010b2a, 0x00010b2a, 0x00fe0b2a, 0x00fe0b2a, 0x00fe0b2a, 0x00fe0b2a,
+    0x00020b2a, 0x00020b2a, 0x00020b2a, 0x00020b2a, 0x00fd0b2a, 0x00fd0b2a, 0x00fd0b2a, 0x00fd0b2a,
+    0x00030b2a, 0x00030b2a, 0x00030b2a, 0x00030b2a, 0x00fc0b2a, 0x00fc0b2a, 0x00fc0b2a, 0x00fc0b2a,
+    0x0000f416, 0x0000f416, 0x0000f416, 0x0000f416, 0x0000f416, 0x0000f416, 0x0000f416, 0x0000f416,
+    0x0008f42c, 0x00f7f42c, 0x0009f42c, 0x00f6f42c, 0x000af42c, 0x00f5f42c, 0x000bf42c, 0x00f4f42c,
+    0x0004f42b, 0x0004f42b, 0x00fbf42b, 0x00fbf42b, 0x0005f42b, 0x0005f42b, 0x00faf42b, 0x00faf42b,
+    0x0006f42b, 0x0006f42b, 0x00f9f42b, 0x00f9f42b, 0x0007f42b, 0x0007f42b, 0x00f8f42b, 0x00f8f42b,
+    0x0000f42a, 0x0000f42a, 0x0000f42a, 0x0000f42a, 0x00fff42a, 0x00fff42a, 0x00fff42a, 0x00fff42a,
+    0x0001f42a, 0x0001f42a, 0x0001f42a, 0x0001f42a, 0x00fef42a, 0x00fef42a, 0x00fef42a, 0x00fef42a,
+    0x0002f42a, 0x0002f42a, 0x0002f42a, 0x0002f42a, 0x00fdf42a, 0x00fdf42a, 0x00fdf42a, 0x00fdf42a,
+    0x0003f42a, 0x0003f42a, 0x0003f42a, 0x0003f42a, 0x00fcf42a, 0x00fcf42a, 0x00fcf42a, 0x00fcf42a,
+    0x00000415, 0x00000415, 0x00000415, 0x00000415, 0x00000415, 0x00000415, 0x00000415, 0x00000415,
+    0x000c042c, 0x00f3042c, 0x000d042c, 0x00f2042c, 0x000e042c, 0x00f1042c, 0x000f042c, 0x00f0042c,
+    0x0008042b, 0x0008042b, 0x00f7042b, 0x00f7042b, 0x0009042b, 0x0009042b, 0x00f6042b, 0x00f6042b,
+    0x000a042b, 0x000a042b, 0x00f5042b, 0x00f5042b, 0x000b042b, 0x000b042b, 0x00f4042b, 0x00f4042b,
+    0x0004042a, 0x0004042a, 0x0004042a, 0x0004042a, 0x00fb042a, 0x00fb042a, 0x00fb042a, 0x00fb042a,
+    0x0005042a, 0x0005042a, 0x0005042a, 0x0005042a, 0x00fa042a, 0x00fa042a, 0x00fa042a, 0x00fa042a,
+    0x0006042a, 0x0006042a, 0x0006042a, 0x0006042a, 0x00f9042a, 0x00f9042a, 0x00f9042a, 0x00f9042a,
+    0x0007042a, 0x0007042a, 0x0007042a, 0x0007042a, 0x00f8042a, 0x00f8042a, 0x00f8042a, 0x00f8042a,
+    0x00000429, 0x00000429, 0x00000429, 0x00000429, 0x00000429, 0x00000429, 0x00000429, 0x00000429,
+    0x00ff0429, 0x00ff0429, 0x00ff0429, 0x00ff0429, 0x00ff0429, 0x00ff0429, 0x00ff0429, 0x00ff0429,
+    0x00010429, 0x00010429, 0x00010429, 0x00010429, 0x00010429, 0x00010429, 0x00010429, 0x00010429,
+    0x00fe0429, 0x00fe0429, 0x00fe0429, 0x00fe0429, 0x00fe0429, 0x00fe0429, 0x00fe0429, 0x00fe0429,
+    0x00020429, 0x00020429, 0x00020429, 0x00020429, 0x00020429, 0x00020429, 0x00020429, 0x00020429,
+    0x00fd0429, 0x00fd0429, 0x00fd0429, 0x00fd0429, 0x00fd0429, 0x00fd0429, 0x00fd0429, 0x00fd0429,
+    0x00030429, 0x00030429, 0x00030429, 0x00030429, 0x00030429, 0x00030429, 0x00030429, 0x00030429,
+    0x00fc0429, 0x00fc0429, 0x00fc0429, 0x00fc0429, 0x00fc0429, 0x00fc0429, 0x00fc0429, 0x00fc0429,
+    0x0000fb15, 0x0000fb15, 0x0000fb15, 0x0000fb15, 0x0000fb15, 0x0000fb15, 0x0000fb15, 0x0000fb15,
+    0x000cfb2c, 0x00f3fb2c, 0x000dfb2c, 0x00f2fb2c, 0x000efb2c, 0x00f1fb2c, 0x000ffb2c, 0x00f0fb2c,
+    0x0008fb2b, 0x0008fb2b, 0x00f7fb2b, 0x00f7fb2b, 0x0009fb2b, 0x0009fb2b, 0x00f6fb2b, 0x00f6fb2b,
+    0x000afb2b, 0x000afb2b, 0x00f5fb2b, 0x00f5fb2b, 0x000bfb2b, 0x000bfb2b, 0x00f4fb2b, 0x00f4fb2b,
+    0x0004fb2a, 0x0004fb2a, 0x0004fb2a, 0x0004fb2a, 0x00fbfb2a, 0x00fbfb2a, 0x00fbfb2a, 0x00fbfb2a,
+    0x0005fb2a, 0x0005fb2a, 0x0005fb2a, 0x0005fb2a, 0x00fafb2a, 0x00fafb2a, 0x00fafb2a, 0x00fafb2a,
+    0x0006fb2a, 0x0006fb2a, 0x0006fb2a, 0x0006fb2a, 0x00f9fb2a, 0x00f9fb2a, 0x00f9fb2a, 0x00f9fb2a,
+    0x0007fb2a, 0x0007fb2a, 0x0007fb2a, 0x0007fb2a, 0x00f8fb2a, 0x00f8fb2a, 0x00f8fb2a, 0x00f8fb2a,
+    0x0000fb29, 0x0000fb29, 0x0000fb29, 0x0000fb29, 0x0000fb29, 0x0000fb29, 0x0000fb29, 0x0000fb29,
+    0x00fffb29, 0x00fffb29, 0x00fffb29, 0x00fffb29, 0x00fffb29, 0x00fffb29, 0x00fffb29, 0x00fffb29,
+    0x0001fb29, 0x0001fb29, 0x0001fb29, 0x0001fb29, 0x0001fb29, 0x0001fb29, 0x0001fb29, 0x0001fb29,
+    0x00fefb29, 0x00fefb29, 0x00fefb29, 0x00fefb29, 0x00fefb29, 0x00fefb29, 0x00fefb29, 0x00fefb29,
+    0x0002fb29, 0x0002fb29, 0x0002fb29, 0x0002fb29, 0x0002fb29, 0x0002fb29, 0x0002fb29, 0x0002fb29,
+    0x00fdfb29, 0x00fdfb29, 0x00fdfb29, 0x00fdfb29, 0x00fdfb29, 0x00fdfb29, 0x00fdfb29, 0x00fdfb29,
+    0x0003fb29, 0x0003fb29, 0x0003fb29, 0x0003fb29, 0x0003fb29, 0x0003fb29, 0x0003fb29, 0x0003fb29,
+    0x00fcfb29, 0x00fcfb29, 0x00fcfb29, 0x00fcfb29, 0x00fcfb29, 0x00fcfb29, 0x00fcfb29, 0x00fcfb29,
+    0x00000515, 0x00000515, 0x00000515, 0x00000515, 0x00000515, 0x00000515, 0x00000515, 0x00000515,
+    0x000c052c, 0x00f3052c, 0x000d052c, 0x00f2052c, 0x000e052c, 0x00f1052c, 0x000f052c, 0x00f0052c,
+    0x0008052b, 0x0008052b, 0x00f7052b, 0x00f7052b, 0x0009052b, 0x0009052b, 0x00f6052b, 0x00f6052b,
+    0x000a052b, 0x000a052b, 0x00f5052b, 0x00f5052b, 0x000b052b, 0x000b052b, 0x00f4052b, 0x00f4052b,
+    0x0004052a, 0x0004052a, 0x0004052a, 0x0004052a, 0x00fb052a, 0x00fb052a, 0x00fb052a, 0x00fb052a,
+    0x0005052a, 0x0005052a, 0x0005052a, 0x0005052a, 0x00fa052a, 0x00fa052a, 0x00fa052a, 0x00fa052a,
+    0x0006052a, 0x0006052a, 0x0006052a, 0x0006052a, 0x00f9052a, 0x00f9052a, 0x00f9052a, 0x00f9052a,
+    0x0007052a, 0x0007052a, 0x0007052a, 0x0007052a, 0x00f8052a, 0x00f8052a, 0x00f8052a, 0x00f8052a,
+    0x00000529, 0x00000529, 0x00000529, 0x00000529, 0x00000529, 0x00000529, 0x00000529, 0x00000529,
+    0x00ff0529, 0x00ff0529, 0x00ff0529, 0x00ff0529, 0x00ff0529, 0x00ff0529, 0x00ff0529, 0x00ff0529,
+    0x00010529, 0x00010529, 0x00010529, 0x00010529, 0x00010529, 0x00010529, 0x00010529, 0x00010529,
+    0x00fe0529, 0x00fe0529, 0x00fe0529, 0x00fe0529, 0x00fe0529, 0x00fe0529, 0x00fe0529, 0x00fe0529,
+    0x00020529, 0x00020529, 0x00020529, 0x00020529, 0x00020529, 0x00020529, 0x00020529, 0x00020529,
+    0x00fd0529, 0x00fd0529, 0x00fd0529, 0x00fd0529, 0x00fd0529, 0x00fd0529, 0x00fd0529, 0x00fd0529,
+    0x00030529, 0x00030529, 0x00030529, 0x00030529, 0x00030529, 0x00030529, 0x00030529, 0x00030529,
+    0x00fc0529, 0x00fc0529, 0x00fc0529, 0x00fc0529, 0x00fc0529, 0x00fc0529, 0x00fc0529, 0x00fc0529,
+    0x0000fa15, 0x0000fa15, 0x0000fa15, 0x0000fa15, 0x0000fa15, 0x0000fa15, 0x0000fa15, 0x0000fa15,
+    0x000cfa2c, 0x00f3fa2c, 0x000dfa2c, 0x00f2fa2c, 0x000efa2c, 0x00f1fa2c, 0x000ffa2c, 0x00f0fa2c,
+    0x0008fa2b, 0x0008fa2b, 0x00f7fa2b, 0x00f7fa2b, 0x0009fa2b, 0x0009fa2b, 0x00f6fa2b, 0x00f6fa2b,
+    0x000afa2b, 0x000afa2b, 0x00f5fa2b, 0x00f5fa2b, 0x000bfa2b, 0x000bfa2b, 0x00f4fa2b, 0x00f4fa2b,
+    0x0004fa2a, 0x0004fa2a, 0x0004fa2a, 0x0004fa2a, 0x00fbfa2a, 0x00fbfa2a, 0x00fbfa2a, 0x00fbfa2a,
+    0x0005fa2a, 0x0005fa2a, 0x0005fa2a, 0x0005fa2a, 0x00fafa2a, 0x00fafa2a, 0x00fafa2a, 0x00fafa2a,
+    0x0006fa2a, 0x0006fa2a, 0x0006fa2a, 0x0006fa2a, 0x00f9fa2a, 0x00f9fa2a, 0x00f9fa2a, 0x00f9fa2a,
+    0x0007fa2a, 0x0007fa2a, 0x0007fa2a, 0x0007fa2a, 0x00f8fa2a, 0x00f8fa2a, 0x00f8fa2a, 0x00f8fa2a,
+    0x0000fa29, 0x0000fa29, 0x0000fa29, 0x0000fa29, 0x0000fa29, 0x0000fa29, 0x0000fa29, 0x0000fa29,
+    0x00fffa29, 0x00fffa29, 0x00fffa29, 0x00fffa29, 0x00fffa29, 0x00fffa29, 0x00fffa29, 0x00fffa29,
+    0x0001fa29, 0x0001fa29, 0x0001fa29, 0x0001fa29, 0x0001fa29, 0x0001fa29, 0x0001fa29, 0x0001fa29,
+    0x00fefa29, 0x00fefa29, 0x00fefa29, 0x00fefa29, 0x00fefa29, 0x00fefa29, 0x00fefa29, 0x00fefa29,
+    0x0002fa29, 0x0002fa29, 0x0002fa29, 0x0002fa29, 0x0002fa29, 0x0002fa29, 0x0002fa29, 0x0002fa29,
+    0x00fdfa29, 0x00fdfa29, 0x00fdfa29, 0x00fdfa29, 0x00fdfa29, 0x00fdfa29, 0x00fdfa29, 0x00fdfa29,
+    0x0003fa29, 0x0003fa29, 0x0003fa29, 0x0003fa29, 0x0003fa29, 0x0003fa29, 0x0003fa29, 0x0003fa29,
+    0x00fcfa29, 0x00fcfa29, 0x00fcfa29, 0x00fcfa29, 0x00fcfa29, 0x00fcfa29, 0x00fcfa29, 0x00fcfa29,
+    0x00000615, 0x00000615, 0x00000615, 0x00000615, 0x00000615, 0x00000615, 0x00000615, 0x00000615,
+    0x000c062c, 0x00f3062c, 0x000d062c, 0x00f2062c, 0x000e062c, 0x00f1062c, 0x000f062c, 0x00f0062c,
+    0x0008062b, 0x0008062b, 0x00f7062b, 0x00f7062b, 0x0009062b, 0x0009062b, 0x00f6062b, 0x00f6062b,
+    0x000a062b, 0x000a062b, 0x00f5062b, 0x00f5062b, 0x000b062b, 0x000b062b, 0x00f4062b, 0x00f4062b,
+    0x0004062a, 0x0004062a, 0x0004062a, 0x0004062a, 0x00fb062a, 0x00fb062a, 0x00fb062a, 0x00fb062a,
+    0x0005062a, 0x0005062a, 0x0005062a, 0x0005062a, 0x00fa062a, 0x00fa062a, 0x00fa062a, 0x00fa062a,
+    0x0006062a, 0x0006062a, 0x0006062a, 0x0006062a, 0x00f9062a, 0x00f9062a, 0x00f9062a, 0x00f9062a,
+    0x0007062a, 0x0007062a, 0x0007062a, 0x0007062a, 0x00f8062a, 0x00f8062a, 0x00f8062a, 0x00f8062a,
+    0x00000629, 0x00000629, 0x00000629, 0x00000629, 0x00000629, 0x00000629, 0x00000629, 0x00000629,
+    0x00ff0629, 0x00ff0629, 0x00ff0629, 0x00ff0629, 0x00ff0629, 0x00ff0629, 0x00ff0629, 0x00ff0629,
+    0x00010629, 0x00010629, 0x00010629, 0x00010629, 0x00010629, 0x00010629, 0x00010629, 0x00010629,
+    0x00fe0629, 0x00fe0629, 0x00fe0629, 0x00fe0629, 0x00fe0629, 0x00fe0629, 0x00fe0629, 0x00fe0629,
+    0x00020629, 0x00020629, 0x00020629, 0x00020629, 0x00020629, 0x00020629, 0x00020629, 0x00020629,
+    0x00fd0629, 0x00fd0629, 0x00fd0629, 0x00fd0629, 0x00fd0629, 0x00fd0629, 0x00fd0629, 0x00fd0629,
+    0x00030629, 0x00030629, 0x00030629, 0x00030629, 0x00030629, 0x00030629, 0x00030629, 0x00030629,
+    0x00fc0629, 0x00fc0629, 0x00fc0629, 0x00fc0629, 0x00fc0629, 0x00fc0629, 0x00fc0629, 0x00fc0629,
+    0x0000f915, 0x0000f915, 0x0000f915, 0x0000f915, 0x0000f915, 0x0000f915, 0x0000f915, 0x0000f915,
+    0x000cf92c, 0x00f3f92c, 0x000df92c, 0x00f2f92c, 0x000ef92c, 0x00f1f92c, 0x000ff92c, 0x00f0f92c,
+    0x0008f92b, 0x0008f92b, 0x00f7f92b, 0x00f7f92b, 0x0009f92b, 0x0009f92b, 0x00f6f92b, 0x00f6f92b,
+    0x000af92b, 0x000af92b, 0x00f5f92b, 0x00f5f92b, 0x000bf92b, 0x000bf92b, 0x00f4f92b, 0x00f4f92b,
+    0x0004f92a, 0x0004f92a, 0x0004f92a, 0x0004f92a, 0x00fbf92a, 0x00fbf92a, 0x00fbf92a, 0x00fbf92a,
+    0x0005f92a, 0x0005f92a, 0x0005f92a, 0x0005f92a, 0x00faf92a, 0x00faf92a, 0x00faf92a, 0x00faf92a,
+    0x0006f92a, 0x0006f92a, 0x0006f92a, 0x0006f92a, 0x00f9f92a, 0x00f9f92a, 0x00f9f92a, 0x00f9f92a,
+    0x0007f92a, 0x0007f92a, 0x0007f92a, 0x0007f92a, 0x00f8f92a, 0x00f8f92a, 0x00f8f92a, 0x00f8f92a,
+    0x0000f929, 0x0000f929, 0x0000f929, 0x0000f929, 0x0000f929, 0x0000f929, 0x0000f929, 0x0000f929,
+    0x00fff929, 0x00fff929, 0x00fff929, 0x00fff929, 0x00fff929, 0x00fff929, 0x00fff929, 0x00fff929,
+    0x0001f929, 0x0001f929, 0x0001f929, 0x0001f929, 0x0001f929, 0x0001f929, 0x0001f929, 0x0001f929,
+    0x00fef929, 0x00fef929, 0x00fef929, 0x00fef929, 0x00fef929, 0x00fef929, 0x00fef929, 0x00fef929,
+    0x0002f929, 0x0002f929, 0x0002f929, 0x0002f929, 0x0002f929, 0x0002f929, 0x0002f929, 0x0002f929,
+    0x00fdf929, 0x00fdf929, 0x00fdf929, 0x00fdf929, 0x00fdf929, 0x00fdf929, 0x00fdf929, 0x00fdf929,
+    0x0003f929, 0x0003f929, 0x0003f929, 0x0003f929, 0x0003f929, 0x0003f929, 0x0003f929, 0x0003f929,
+    0x00fcf929, 0x00fcf929, 0x00fcf929, 0x00fcf929, 0x00fcf929, 0x00fcf929, 0x00fcf929, 0x00fcf929,
+    0x00000715, 0x00000715, 0x00000715, 0x00000715, 0x00000715, 0x00000715, 0x00000715, 0x00000715,
+    0x000c072c, 0x00f3072c, 0x000d072c, 0x00f2072c, 0x000e072c, 0x00f1072c, 0x000f072c, 0x00f0072c,
+    0x0008072b, 0x0008072b, 0x00f7072b, 0x00f7072b, 0x0009072b, 0x0009072b, 0x00f6072b, 0x00f6072b,
+    0x000a072b, 0x000a072b, 0x00f5072b, 0x00f5072b, 0x000b072b, 0x000b072b, 0x00f4072b, 0x00f4072b,
+    0x0004072a, 0x0004072a, 0x0004072a, 0x0004072a, 0x00fb072a, 0x00fb072a, 0x00fb072a, 0x00fb072a,
+    0x0005072a, 0x0005072a, 0x0005072a, 0x0005072a, 0x00fa072a, 0x00fa072a, 0x00fa072a, 0x00fa072a,
+    0x0006072a, 0x0006072a, 0x0006072a, 0x0006072a, 0x00f9072a, 0x00f9072a, 0x00f9072a, 0x00f9072a,
+    0x0007072a, 0x0007072a, 0x0007072a, 0x0007072a, 0x00f8072a, 0x00f8072a, 0x00f8072a, 0x00f8072a,
+    0x00000729, 0x00000729, 0x00000729, 0x00000729, 0x00000729, 0x00000729, 0x00000729, 0x00000729,
+    0x00ff0729, 0x00ff0729, 0x00ff0729, 0x00ff0729, 0x00ff0729, 0x00ff0729, 0x00ff0729, 0x00ff0729,
+    0x00010729, 0x00010729, 0x00010729, 0x00010729, 0x00010729, 0x00010729, 0x00010729, 0x00010729,
+    0x00fe0729, 0x00fe0729, 0x00fe0729, 0x00fe0729, 0x00fe0729, 0x00fe0729, 0x00fe0729, 0x00fe0729,
+    0x00020729, 0x00020729, 0x00020729, 0x00020729, 0x00020729, 0x00020729, 0x00020729, 0x00020729,
+    0x00fd0729, 0x00fd0729, 0x00fd0729, 0x00fd0729, 0x00fd0729, 0x00fd0729, 0x00fd0729, 0x00fd0729,
+    0x00030729, 0x00030729, 0x00030729, 0x00030729, 0x00030729, 0x00030729, 0x00030729, 0x00030729,
+    0x00fc0729, 0x00fc0729, 0x00fc0729, 0x00fc0729, 0x00fc0729, 0x00fc0729, 0x00fc0729, 0x00fc0729,
+    0x0000f815, 0x0000f815, 0x0000f815, 0x0000f815, 0x0000f815, 0x0000f815, 0x0000f815, 0x0000f815,
+    0x000cf82c, 0x00f3f82c, 0x000df82c, 0x00f2f82c, 0x000ef82c, 0x00f1f82c, 0x000ff82c, 0x00f0f82c,
+    0x0008f82b, 0x0008f82b, 0x00f7f82b, 0x00f7f82b, 0x0009f82b, 0x0009f82b, 0x00f6f82b, 0x00f6f82b,
+    0x000af82b, 0x000af82b, 0x00f5f82b, 0x00f5f82b, 0x000bf82b, 0x000bf82b, 0x00f4f82b, 0x00f4f82b,
+    0x0004f82a, 0x0004f82a, 0x0004f82a, 0x0004f82a, 0x00fbf82a, 0x00fbf82a, 0x00fbf82a, 0x00fbf82a,
+    0x0005f82a, 0x0005f82a, 0x0005f82a, 0x0005f82a, 0x00faf82a, 0x00faf82a, 0x00faf82a, 0x00faf82a,
+    0x0006f82a, 0x0006f82a, 0x0006f82a, 0x0006f82a, 0x00f9f82a, 0x00f9f82a, 0x00f9f82a, 0x00f9f82a,
+    0x0007f82a, 0x0007f82a, 0x0007f82a, 0x0007f82a, 0x00f8f82a, 0x00f8f82a, 0x00f8f82a, 0x00f8f82a,
+    0x0000f829, 0x0000f829, 0x0000f829, 0x0000f829, 0x0000f829, 0x0000f829, 0x0000f829, 0x0000f829,
+    0x00fff829, 0x00fff829, 0x00fff829, 0x00fff829, 0x00fff829, 0x00fff829, 0x00fff829, 0x00fff829,
+    0x0001f829, 0x0001f829, 0x0001f829, 0x0001f829, 0x0001f829, 0x0001f829, 0x0001f829, 0x0001f829,
+    0x00fef829, 0x00fef829, 0x00fef829, 0x00fef829, 0x00fef829, 0x00fef829, 0x00fef829, 0x00fef829,
+    0x0002f829, 0x0002f829, 0x0002f829, 0x0002f829, 0x0002f829, 0x0002f829, 0x0002f829, 0x0002f829,
+    0x00fdf829, 0x00fdf829, 0x00fdf829, 0x00fdf829, 0x00fdf829, 0x00fdf829, 0x00fdf829, 0x00fdf829,
+    0x0003f829, 0x0003f829, 0x0003f829, 0x0003f829, 0x0003f829, 0x0003f829, 0x0003f829, 0x0003f829,
+    0x00fcf829, 0x00fcf829, 0x00fcf829, 0x00fcf829, 0x00fcf829, 0x00fcf829, 0x00fcf829, 0x00fcf829,
+    0x00000014, 0x00000014, 0x00000014, 0x00000014, 0x00000014, 0x00000014, 0x00000014, 0x00000014,
+    0x0010002c, 0x00ef002c, 0x0011002c, 0x00ee002c, 0x0012002c, 0x00ed002c, 0x0013002c, 0x00ec002c,
+    0x000c002b, 0x000c002b, 0x00f3002b, 0x00f3002b, 0x000d002b, 0x000d002b, 0x00f2002b, 0x00f2002b,
+    0x000e002b, 0x000e002b, 0x00f1002b, 0x00f1002b, 0x000f002b, 0x000f002b, 0x00f0002b, 0x00f0002b,
+    0x0008002a, 0x0008002a, 0x0008002a, 0x0008002a, 0x00f7002a, 0x00f7002a, 0x00f7002a, 0x00f7002a,
+    0x0009002a, 0x0009002a, 0x0009002a, 0x0009002a, 0x00f6002a, 0x00f6002a, 0x00f6002a, 0x00f6002a,
+    0x000a002a, 0x000a002a, 0x000a002a, 0x000a002a, 0x00f5002a, 0x00f5002a, 0x00f5002a, 0x00f5002a,
+    0x000b002a, 0x000b002a, 0x000b002a, 0x000b002a, 0x00f4002a, 0x00f4002a, 0x00f4002a, 0x00f4002a,
+    0x00040029, 0x00040029, 0x00040029, 0x00040029, 0x00040029, 0x00040029, 0x00040029, 0x00040029,
+    0x00fb0029, 0x00fb0029, 0x00fb0029, 0x00fb0029, 0x00fb0029, 0x00fb0029, 0x00fb0029, 0x00fb0029,
+    0x00050029, 0x00050029, 0x00050029, 0x00050029, 0x00050029, 0x00050029, 0x00050029, 0x00050029,
+    0x00fa0029, 0x00fa0029, 0x00fa0029, 0x00fa0029, 0x00fa0029, 0x00fa0029, 0x00fa0029, 0x00fa0029,
+    0x00060029, 0x00060029, 0x00060029, 0x00060029, 0x00060029, 0x00060029, 0x00060029, 0x00060029,
+    0x00f90029, 0x00f90029, 0x00f90029, 0x00f90029, 0x00f90029, 0x00f90029, 0x00f90029, 0x00f90029,
+    0x00070029, 0x00070029, 0x00070029, 0x00070029, 0x00070029, 0x00070029, 0x00070029, 0x00070029,
+    0x00f80029, 0x00f80029, 0x00f80029, 0x00f80029, 0x00f80029, 0x00f80029, 0x00f80029, 0x00f80029,
+    0x00000028, 0x00000028, 0x00000028, 0x00000028, 0x00000028, 0x00000028, 0x00000028, 0x00000028,
+    0x0000003c, 0xff00003c, 0x0100003c, 0xfe00003c, 0x0200003c, 0xfd00003c, 0x0300003c, 0xfc00003c,
+    0x00ff0028, 0x00ff0028, 0x00ff0028, 0x00ff0028, 0x00ff0028, 0x00ff0028, 0x00ff0028, 0x00ff0028,
+    0x00ff003c, 0xffff003c, 0x01ff003c, 0xfeff003c, 0x02ff003c, 0xfdff003c, 0x03ff003c, 0xfcff003c,
+    0x00010028, 0x00010028, 0x00010028, 0x00010028, 0x00010028, 0x00010028, 0x00010028, 0x00010028,
+    0x0001003c, 0xff01003c, 0x0101003c, 0xfe01003c, 0x0201003c, 0xfd01003c, 0x0301003c, 0xfc01003c,
+    0x00fe0028, 0x00fe0028, 0x00fe0028, 0x00fe0028, 0x00fe0028, 0x00fe0028, 0x00fe0028, 0x00fe0028,
+    0x00fe003c, 0xfffe003c, 0x01fe003c, 0xfefe003c, 0x02fe003c, 0xfdfe003c, 0x03fe003c, 0xfcfe003c,
+    0x00020028, 0x00020028, 0x00020028, 0x00020028, 0x00020028, 0x00020028, 0x00020028, 0x00020028,
+    0x0002003c, 0xff02003c, 0x0102003c, 0xfe02003c, 0x0202003c, 0xfd02003c, 0x0302003c, 0xfc02003c,
+    0x00fd0028, 0x00fd0028, 0x00fd0028, 0x00fd0028, 0x00fd0028, 0x00fd0028, 0x00fd0028, 0x00fd0028,
+    0x00fd003c, 0xfffd003c, 0x01fd003c, 0xfefd003c, 0x02fd003c, 0xfdfd003c, 0x03fd003c, 0xfcfd003c,
+    0x00030028, 0x00030028, 0x00030028, 0x00030028, 0x00030028, 0x00030028, 0x00030028, 0x00030028,
+    0x0003003c, 0xff03003c, 0x0103003c, 0xfe03003c, 0x0203003c, 0xfd03003c, 0x0303003c, 0xfc03003c,
+    0x00fc0028, 0x00fc0028, 0x00fc0028, 0x00fc0028, 0x00fc0028, 0x00fc0028, 0x00fc0028, 0x00fc0028,
+    0x00fc003c, 0xfffc003c, 0x01fc003c, 0xfefc003c, 0x02fc003c, 0xfdfc003c, 0x03fc003c, 0xfcfc003c,
+    0x0000ff14, 0x0000ff14, 0x0000ff14, 0x0000ff14, 0x0000ff14, 0x0000ff14, 0x0000ff14, 0x0000ff14,
+    0x0010ff2c, 0x00efff2c, 0x0011ff2c, 0x00eeff2c, 0x0012ff2c, 0x00edff2c, 0x0013ff2c, 0x00ecff2c,
+    0x000cff2b, 0x000cff2b, 0x00f3ff2b, 0x00f3ff2b, 0x000dff2b, 0x000dff2b, 0x00f2ff2b, 0x00f2ff2b,
+    0x000eff2b, 0x000eff2b, 0x00f1ff2b, 0x00f1ff2b, 0x000fff2b, 0x000fff2b, 0x00f0ff2b, 0x00f0ff2b,
+    0x0008ff2a, 0x0008ff2a, 0x0008ff2a, 0x0008ff2a, 0x00f7ff2a, 0x00f7ff2a, 0x00f7ff2a, 0x00f7ff2a,
+    0x0009ff2a, 0x0009ff2a, 0x0009ff2a, 0x0009ff2a, 0x00f6ff2a, 0x00f6ff2a, 0x00f6ff2a, 0x00f6ff2a,
+    0x000aff2a, 0x000aff2a, 0x000aff2a, 0x000aff2a, 0x00f5ff2a, 0x00f5ff2a, 0x00f5ff2a, 0x00f5ff2a,
+    0x000bff2a, 0x000bff2a, 0x000bff2a, 0x000bff2a, 0x00f4ff2a, 0x00f4ff2a, 0x00f4ff2a, 0x00f4ff2a,
+    0x0004ff29, 0x0004ff29, 0x0004ff29, 0x0004ff29, 0x0004ff29, 0x0004ff29, 0x0004ff29, 0x0004ff29,
+    0x00fbff29, 0x00fbff29, 0x00fbff29, 0x00fbff29, 0x00fbff29, 0x00fbff29, 0x00fbff29, 0x00fbff29,
+    0x0005ff29, 0x0005ff29, 0x0005ff29, 0x0005ff29, 0x0005ff29, 0x0005ff29, 0x0005ff29, 0x0005ff29,
+    0x00faff29, 0x00faff29, 0x00faff29, 0x00faff29, 0x00faff29, 0x00faff29, 0x00faff29, 0x00faff29,
+    0x0006ff29, 0x0006ff29, 0x0006ff29, 0x0006ff29, 0x0006ff29, 0x0006ff29, 0x0006ff29, 0x0006ff29,
+    0x00f9ff29, 0x00f9ff29, 0x00f9ff29, 0x00f9ff29, 0x00f9ff29, 0x00f9ff29, 0x00f9ff29, 0x00f9ff29,
+    0x0007ff29, 0x0007ff29, 0x0007ff29, 0x0007ff29, 0x0007ff29, 0x0007ff29, 0x0007ff29, 0x0007ff29,
+    0x00f8ff29, 0x00f8ff29, 0x00f8ff29, 0x00f8ff29, 0x00f8ff29, 0x00f8ff29, 0x00f8ff29, 0x00f8ff29,
+    0x0000ff28, 0x0000ff28, 0x0000ff28, 0x0000ff28, 0x0000ff28, 0x0000ff28, 0x0000ff28, 0x0000ff28,
+    0x0000ff3c, 0xff00ff3c, 0x0100ff3c, 0xfe00ff3c, 0x0200ff3c, 0xfd00ff3c, 0x0300ff3c, 0xfc00ff3c,
+    0x00ffff28, 0x00ffff28, 0x00ffff28, 0x00ffff28, 0x00ffff28, 0x00ffff28, 0x00ffff28, 0x00ffff28,
+    0x00ffff3c, 0xffffff3c, 0x01ffff3c, 0xfeffff3c, 0x02ffff3c, 0xfdffff3c, 0x03ffff3c, 0xfcffff3c,
+    0x0001ff28, 0x0001ff28, 0x0001ff28, 0x0001ff28, 0x0001ff28, 0x0001ff28, 0x0001ff28, 0x0001ff28,
+    0x0001ff3c, 0xff01ff3c, 0x0101ff3c, 0xfe01ff3c, 0x0201ff3c, 0xfd01ff3c, 0x0301ff3c, 0xfc01ff3c,
+    0x00feff28, 0x00feff28, 0x00feff28, 0x00feff28, 0x00feff28, 0x00feff28, 0x00feff28, 0x00feff28,
+    0x00feff3c, 0xfffeff3c, 0x01feff3c, 0xfefeff3c, 0x02feff3c, 0xfdfeff3c, 0x03feff3c, 0xfcfeff3c,
+    0x0002ff28, 0x0002ff28, 0x0002ff28, 0x0002ff28, 0x0002ff28, 0x0002ff28, 0x0002ff28, 0x0002ff28,
+    0x0002ff3c, 0xff02ff3c, 0x0102ff3c, 0xfe02ff3c, 0x0202ff3c, 0xfd02ff3c, 0x0302ff3c, 0xfc02ff3c,
+    0x00fdff28, 0x00fdff28, 0x00fdff28, 0x00fdff28, 0x00fdff28, 0x00fdff28, 0x00fdff28, 0x00fdff28,
+    0x00fdff3c, 0xfffdff3c, 0x01fdff3c, 0xfefdff3c, 0x02fdff3c, 0xfdfdff3c, 0x03fdff3c, 0xfcfdff3c,
+    0x0003ff28, 0x0003ff28, 0x0003ff28, 0x0003ff28, 0x0003ff28, 0x0003ff28, 0x0003ff28, 0x0003ff28,
+    0x0003ff3c, 0xff03ff3c, 0x0103ff3c, 0xfe03ff3c, 0x0203ff3c, 0xfd03ff3c, 0x0303ff3c, 0xfc03ff3c,
+    0x00fcff28, 0x00fcff28, 0x00fcff28, 0x00fcff28, 0x00fcff28, 0x00fcff28, 0x00fcff28, 0x00fcff28,
+    0x00fcff3c, 0xfffcff3c, 0x01fcff3c, 0xfefcff3c, 0x02fcff3c, 0xfdfcff3c, 0x03fcff3c, 0xfcfcff3c,
+    0x00000114, 0x00000114, 0x00000114, 0x00000114, 0x00000114, 0x00000114, 0x00000114, 0x00000114,
+    0x0010012c, 0x00ef012c, 0x0011012c, 0x00ee012c, 0x0012012c, 0x00ed012c, 0x0013012c, 0x00ec012c,
+    0x000c012b, 0x000c012b, 0x00f3012b, 0x00f3012b, 0x000d012b, 0x000d012b, 0x00f2012b, 0x00f2012b,
+    0x000e012b, 0x000e012b, 0x00f1012b, 0x00f1012b, 0x000f012b, 0x000f012b, 0x00f0012b, 0x00f0012b,
+    0x0008012a, 0x0008012a, 0x0008012a, 0x0008012a, 0x00f7012a, 0x00f7012a, 0x00f7012a, 0x00f7012a,
+    0x0009012a, 0x0009012a, 0x0009012a, 0x0009012a, 0x00f6012a, 0x00f6012a, 0x00f6012a, 0x00f6012a,
+    0x000a012a, 0x000a012a, 0x000a012a, 0x000a012a, 0x00f5012a, 0x00f5012a, 0x00f5012a, 0x00f5012a,
+    0x000b012a, 0x000b012a, 0x000b012a, 0x000b012a, 0x00f4012a, 0x00f4012a, 0x00f4012a, 0x00f4012a,
+    0x00040129, 0x00040129, 0x00040129, 0x00040129, 0x00040129, 0x00040129, 0x00040129, 0x00040129,
+    0x00fb0129, 0x00fb0129, 0x00fb0129, 0x00fb0129, 0x00fb0129, 0x00fb0129, 0x00fb0129, 0x00fb0129,
+    0x00050129, 0x00050129, 0x00050129, 0x00050129, 0x00050129, 0x00050129, 0x00050129, 0x00050129,
+    0x00fa0129, 0x00fa0129, 0x00fa0129, 0x00fa0129, 0x00fa0129, 0x00fa0129, 0x00fa0129, 0x00fa0129,
+    0x00060129, 0x00060129, 0x00060129, 0x00060129, 0x00060129, 0x00060129, 0x00060129, 0x00060129,
+    0x00f90129, 0x00f90129, 0x00f90129, 0x00f90129, 0x00f90129, 0x00f90129, 0x00f90129, 0x00f90129,
+    0x00070129, 0x00070129, 0x00070129, 0x00070129, 0x00070129, 0x00070129, 0x00070129, 0x00070129,
+    0x00f80129, 0x00f80129, 0x00f80129, 0x00f80129, 0x00f80129, 0x00f80129, 0x00f80129, 0x00f80129,
+    0x00000128, 0x00000128, 0x00000128, 0x00000128, 0x00000128, 0x00000128, 0x00000128, 0x00000128,
+    0x0000013c, 0xff00013c, 0x0100013c, 0xfe00013c, 0x0200013c, 0xfd00013c, 0x0300013c, 0xfc00013c,
+    0x00ff0128, 0x00ff0128, 0x00ff0128, 0x00ff0128, 0x00ff0128, 0x00ff0128, 0x00ff0128, 0x00ff0128,
+    0x00ff013c, 0xffff013c, 0x01ff013c, 0xfeff013c, 0x02ff013c, 0xfdff013c, 0x03ff013c, 0xfcff013c,
+    0x00010128, 0x00010128, 0x00010128, 0x00010128, 0x00010128, 0x00010128, 0x00010128, 0x00010128,
+    0x0001013c, 0xff01013c, 0x0101013c, 0xfe01013c, 0x0201013c, 0xfd01013c, 0x0301013c, 0xfc01013c,
+    0x00fe0128, 0x00fe0128, 0x00fe0128, 0x00fe0128, 0x00fe0128, 0x00fe0128, 0x00fe0128, 0x00fe0128,
+    0x00fe013c, 0xfffe013c, 0x01fe013c, 0xfefe013c, 0x02fe013c, 0xfdfe013c, 0x03fe013c, 0xfcfe013c,
+    0x00020128, 0x00020128, 0x00020128, 0x00020128, 0x00020128, 0x00020128, 0x00020128, 0x00020128,
+    0x0002013c, 0xff02013c, 0x0102013c, 0xfe02013c, 0x0202013c, 0xfd02013c, 0x0302013c, 0xfc02013c,
+    0x00fd0128, 0x00fd0128, 0x00fd0128, 0x00fd0128, 0x00fd0128, 0x00fd0128, 0x00fd0128, 0x00fd0128,
+    0x00fd013c, 0xfffd013c, 0x01fd013c, 0xfefd013c, 0x02fd013c, 0xfdfd013c, 0x03fd013c, 0xfcfd013c,
+    0x00030128, 0x00030128, 0x00030128, 0x00030128, 0x00030128, 0x00030128, 0x00030128, 0x00030128,
+    0x0003013c, 0xff03013c, 0x0103013c, 0xfe03013c, 0x0203013c, 0xfd03013c, 0x0303013c, 0xfc03013c,
+    0x00fc0128, 0x00fc0128, 0x00fc0128, 0x00fc0128, 0x00fc0128, 0x00fc0128, 0x00fc0128, 0x00fc0128,
+    0x00fc013c, 0xfffc013c, 0x01fc013c, 0xfefc013c, 0x02fc013c, 0xfdfc013c, 0x03fc013c, 0xfcfc013c,
+    0x0000fe14, 0x0000fe14, 0x0000fe14, 0x0000fe14, 0x0000fe14, 0x0000fe14, 0x0000fe14, 0x0000fe14,
+    0x0010fe2c, 0x00effe2c, 0x0011fe2c, 0x00eefe2c, 0x0012fe2c, 0x00edfe2c, 0x0013fe2c, 0x00ecfe2c,
+    0x000cfe2b, 0x000cfe2b, 0x00f3fe2b, 0x00f3fe2b, 0x000dfe2b, 0x000dfe2b, 0x00f2fe2b, 0x00f2fe2b,
+    0x000efe2b, 0x000efe2b, 0x00f1fe2b, 0x00f1fe2b, 0x000ffe2b, 0x000ffe2b, 0x00f0fe2b, 0x00f0fe2b,
+    0x0008fe2a, 0x0008fe2a, 0x0008fe2a, 0x0008fe2a, 0x00f7fe2a, 0x00f7fe2a, 0x00f7fe2a, 0x00f7fe2a,
+    0x0009fe2a, 0x0009fe2a, 0x0009fe2a, 0x0009fe2a, 0x00f6fe2a, 0x00f6fe2a, 0x00f6fe2a, 0x00f6fe2a,
+    0x000afe2a, 0x000afe2a, 0x000afe2a, 0x000afe2a, 0x00f5fe2a, 0x00f5fe2a, 0x00f5fe2a, 0x00f5fe2a,
+    0x000bfe2a, 0x000bfe2a, 0x000bfe2a, 0x000bfe2a, 0x00f4fe2a, 0x00f4fe2a, 0x00f4fe2a, 0x00f4fe2a,
+    0x0004fe29, 0x0004fe29, 0x0004fe29, 0x0004fe29, 0x0004fe29, 0x0004fe29, 0x0004fe29, 0x0004fe29,
+    0x00fbfe29, 0x00fbfe29, 0x00fbfe29, 0x00fbfe29, 0x00fbfe29, 0x00fbfe29, 0x00fbfe29, 0x00fbfe29,
+    0x0005fe29, 0x0005fe29, 0x0005fe29, 0x0005fe29, 0x0005fe29, 0x0005fe29, 0x0005fe29, 0x0005fe29,
+    0x00fafe29, 0x00fafe29, 0x00fafe29, 0x00fafe29, 0x00fafe29, 0x00fafe29, 0x00fafe29, 0x00fafe29,
+    0x0006fe29, 0x0006fe29, 0x0006fe29, 0x0006fe29, 0x0006fe29, 0x0006fe29, 0x0006fe29, 0x0006fe29,
+    0x00f9fe29, 0x00f9fe29, 0x00f9fe29, 0x00f9fe29, 0x00f9fe29, 0x00f9fe29, 0x00f9fe29, 0x00f9fe29,
+    0x0007fe29, 0x0007fe29, 0x0007fe29, 0x0007fe29, 0x0007fe29, 0x0007fe29, 0x0007fe29, 0x0007fe29,
+    0x00f8fe29, 0x00f8fe29, 0x00f8fe29, 0x00f8fe29, 0x00f8fe29, 0x00f8fe29, 0x00f8fe29, 0x00f8fe29,
+    0x0000fe28, 0x0000fe28, 0x0000fe28, 0x0000fe28, 0x0000fe28, 0x0000fe28, 0x0000fe28, 0x0000fe28,
+    0x0000fe3c, 0xff00fe3c, 0x0100fe3c, 0xfe00fe3c, 0x0200fe3c, 0xfd00fe3c, 0x0300fe3c, 0xfc00fe3c,
+    0x00fffe28, 0x00fffe28, 0x00fffe28, 0x00fffe28, 0x00fffe28, 0x00fffe28, 0x00fffe28, 0x00fffe28,
+    0x00fffe3c, 0xfffffe3c, 0x01fffe3c, 0xfefffe3c, 0x02fffe3c, 0xfdfffe3c, 0x03fffe3c, 0xfcfffe3c,
+    0x0001fe28, 0x0001fe28, 0x0001fe28, 0x0001fe28, 0x0001fe28, 0x0001fe28, 0x0001fe28, 0x0001fe28,
+    0x0001fe3c, 0xff01fe3c, 0x0101fe3c, 0xfe01fe3c, 0x0201fe3c, 0xfd01fe3c, 0x0301fe3c, 0xfc01fe3c,
+    0x00fefe28, 0x00fefe28, 0x00fefe28, 0x00fefe28, 0x00fefe28, 0x00fefe28, 0x00fefe28, 0x00fefe28,
+    0x00fefe3c, 0xfffefe3c, 0x01fefe3c, 0xfefefe3c, 0x02fefe3c, 0xfdfefe3c, 0x03fefe3c, 0xfcfefe3c,
+    0x0002fe28, 0x0002fe28, 0x0002fe28, 0x0002fe28, 0x0002fe28, 0x0002fe28, 0x0002fe28, 0x0002fe28,
+    0x0002fe3c, 0xff02fe3c, 0x0102fe3c, 0xfe02fe3c, 0x0202fe3c, 0xfd02fe3c, 0x0302fe3c, 0xfc02fe3c,
+    0x00fdfe28, 0x00fdfe28, 0x00fdfe28, 0x00fdfe28, 0x00fdfe28, 0x00fdfe28, 0x00fdfe28, 0x00fdfe28,
+    0x00fdfe3c, 0xfffdfe3c, 0x01fdfe3c, 0xfefdfe3c, 0x02fdfe3c, 0xfdfdfe3c, 0x03fdfe3c, 0xfcfdfe3c,
+    0x0003fe28, 0x0003fe28, 0x0003fe28, 0x0003fe28, 0x0003fe28, 0x0003fe28, 0x0003fe28, 0x0003fe28,
+    0x0003fe3c, 0xff03fe3c, 0x0103fe3c, 0xfe03fe3c, 0x0203fe3c, 0xfd03fe3c, 0x0303fe3c, 0xfc03fe3c,
+    0x00fcfe28, 0x00fcfe28, 0x00fcfe28, 0x00fcfe28, 0x00fcfe28, 0x00fcfe28, 0x00fcfe28, 0x00fcfe28,
+    0x00fcfe3c, 0xfffcfe3c, 0x01fcfe3c, 0xfefcfe3c, 0x02fcfe3c, 0xfdfcfe3c, 0x03fcfe3c, 0xfcfcfe3c,
+    0x00000214, 0x00000214, 0x00000214, 0x00000214, 0x00000214, 0x00000214, 0x00000214, 0x00000214,
+    0x0010022c, 0x00ef022c, 0x0011022c, 0x00ee022c, 0x0012022c, 0x00ed022c, 0x0013022c, 0x00ec022c,
+    0x000c022b, 0x000c022b, 0x00f3022b, 0x00f3022b, 0x000d022b, 0x000d022b, 0x00f2022b, 0x00f2022b,
+    0x000e022b, 0x000e022b, 0x00f1022b, 0x00f1022b, 0x000f022b, 0x000f022b, 0x00f0022b, 0x00f0022b,
+    0x0008022a, 0x0008022a, 0x0008022a, 0x0008022a, 0x00f7022a, 0x00f7022a, 0x00f7022a, 0x00f7022a,
+    0x0009022a, 0x0009022a, 0x0009022a, 0x0009022a, 0x00f6022a, 0x00f6022a, 0x00f6022a, 0x00f6022a,
+    0x000a022a, 0x000a022a, 0x000a022a, 0x000a022a, 0x00f5022a, 0x00f5022a, 0x00f5022a, 0x00f5022a,
+    0x000b022a, 0x000b022a, 0x000b022a, 0x000b022a, 0x00f4022a, 0x00f4022a, 0x00f4022a, 0x00f4022a,
+    0x00040229, 0x00040229, 0x00040229, 0x00040229, 0x00040229, 0x00040229, 0x00040229, 0x00040229,
+    0x00fb0229, 0x00fb0229, 0x00fb0229, 0x00fb0229, 0x00fb0229, 0x00fb0229, 0x00fb0229, 0x00fb0229,
+    0x00050229, 0x00050229, 0x00050229, 0x00050229, 0x00050229, 0x00050229, 0x00050229, 0x00050229,
+    0x00fa0229, 0x00fa0229, 0x00fa0229, 0x00fa0229, 0x00fa0229, 0x00fa0229, 0x00fa0229, 0x00fa0229,
+    0x00060229, 0x00060229, 0x00060229, 0x00060229, 0x00060229, 0x00060229, 0x00060229, 0x00060229,
+    0x00f90229, 0x00f90229, 0x00f90229, 0x00f90229, 0x00f90229, 0x00f90229, 0x00f90229, 0x00f90229,
+    0x00070229, 0x00070229, 0x00070229, 0x00070229, 0x00070229, 0x00070229, 0x00070229, 0x00070229,
+    0x00f80229, 0x00f80229, 0x00f80229, 0x00f80229, 0x00f80229, 0x00f80229, 0x00f80229, 0x00f80229,
+    0x00000228, 0x00000228, 0x00000228, 0x00000228, 0x00000228, 0x00000228, 0x00000228, 0x00000228,
+    0x0000023c, 0xff00023c, 0x0100023c, 0xfe00023c, 0x0200023c, 0xfd00023c, 0x0300023c, 0xfc00023c,
+    0x00ff0228, 0x00ff0228, 0x00ff0228, 0x00ff0228, 0x00ff0228, 0x00ff0228, 0x00ff0228, 0x00ff0228,
+    0x00ff023c, 0xffff023c, 0x01ff023c, 0xfeff023c, 0x02ff023c, 0xfdff023c, 0x03ff023c, 0xfcff023c,
+    0x00010228, 0x00010228, 0x00010228, 0x00010228, 0x00010228, 0x00010228, 0x00010228, 0x00010228,
+    0x0001023c, 0xff01023c, 0x0101023c, 0xfe01023c, 0x0201023c, 0xfd01023c, 0x0301023c, 0xfc01023c,
+    0x00fe0228, 0x00fe0228, 0x00fe0228, 0x00fe0228, 0x00fe0228, 0x00fe0228, 0x00fe0228, 0x00fe0228,
+    0x00fe023c, 0xfffe023c, 0x01fe023c, 0xfefe023c, 0x02fe023c, 0xfdfe023c, 0x03fe023c, 0xfcfe023c,
+    0x00020228, 0x00020228, 0x00020228, 0x00020228, 0x00020228, 0x00020228, 0x00020228, 0x00020228,
+    0x0002023c, 0xff02023c, 0x0102023c, 0xfe02023c, 0x0202023c, 0xfd02023c, 0x0302023c, 0xfc02023c,
+    0x00fd0228, 0x00fd0228, 0x00fd0228, 0x00fd0228, 0x00fd0228, 0x00fd0228, 0x00fd0228, 0x00fd0228,
+    0x00fd023c, 0xfffd023c, 0x01fd023c, 0xfefd023c, 0x02fd023c, 0xfdfd023c, 0x03fd023c, 0xfcfd023c,
+    0x00030228, 0x00030228, 0x00030228, 0x00030228, 0x00030228, 0x00030228, 0x00030228, 0x00030228,
+    0x0003023c, 0xff03023c, 0x0103023c, 0xfe03023c, 0x0203023c, 0xfd03023c, 0x0303023c, 0xfc03023c,
+    0x00fc0228, 0x00fc0228, 0x00fc0228, 0x00fc0228, 0x00fc0228, 0x00fc0228, 0x00fc0228, 0x00fc0228,
+    0x00fc023c, 0xfffc023c, 0x01fc023c, 0xfefc023c, 0x02fc023c, 0xfdfc023c, 0x03fc023c, 0xfcfc023c,
+    0x0000fd14, 0x0000fd14, 0x0000fd14, 0x0000fd14, 0x0000fd14, 0x0000fd14, 0x0000fd14, 0x0000fd14,
+    0x0010fd2c, 0x00effd2c, 0x0011fd2c, 0x00eefd2c, 0x0012fd2c, 0x00edfd2c, 0x0013fd2c, 0x00ecfd2c,
+    0x000cfd2b, 0x000cfd2b, 0x00f3fd2b, 0x00f3fd2b, 0x000dfd2b, 0x000dfd2b, 0x00f2fd2b, 0x00f2fd2b,
+    0x000efd2b, 0x000efd2b, 0x00f1fd2b, 0x00f1fd2b, 0x000ffd2b, 0x000ffd2b, 0x00f0fd2b, 0x00f0fd2b,
+    0x0008fd2a, 0x0008fd2a, 0x0008fd2a, 0x0008fd2a, 0x00f7fd2a, 0x00f7fd2a, 0x00f7fd2a, 0x00f7fd2a,
+    0x0009fd2a, 0x0009fd2a, 0x0009fd2a, 0x0009fd2a, 0x00f6fd2a, 0x00f6fd2a, 0x00f6fd2a, 0x00f6fd2a,
+    0x000afd2a, 0x000afd2a, 0x000afd2a, 0x000afd2a, 0x00f5fd2a, 0x00f5fd2a, 0x00f5fd2a, 0x00f5fd2a,
+    0x000bfd2a, 0x000bfd2a, 0x000bfd2a, 0x000bfd2a, 0x00f4fd2a, 0x00f4fd2a, 0x00f4fd2a, 0x00f4fd2a,
+    0x0004fd29, 0x0004fd29, 0x0004fd29, 0x0004fd29, 0x0004fd29, 0x0004fd29, 0x0004fd29, 0x0004fd29,
+    0x00fbfd29, 0x00fbfd29, 0x00fbfd29, 0x00fbfd29, 0x00fbfd29, 0x00fbfd29, 0x00fbfd29, 0x00fbfd29,
+    0x0005fd29, 0x0005fd29, 0x0005fd29, 0x0005fd29, 0x0005fd29, 0x0005fd29, 0x0005fd29, 0x0005fd29,
+    0x00fafd29, 0x00fafd29, 0x00fafd29, 0x00fafd29, 0x00fafd29, 0x00fafd29, 0x00fafd29, 0x00fafd29,
+    0x0006fd29, 0x0006fd29, 0x0006fd29, 0x0006fd29, 0x0006fd29, 0x0006fd29, 0x0006fd29, 0x0006fd29,
+    0x00f9fd29, 0x00f9fd29, 0x00f9fd29, 0x00f9fd29, 0x00f9fd29, 0x00f9fd29, 0x00f9fd29, 0x00f9fd29,
+    0x0007fd29, 0x0007fd29, 0x0007fd29, 0x0007fd29, 0x0007fd29, 0x0007fd29, 0x0007fd29, 0x0007fd29,
+    0x00f8fd29, 0x00f8fd29, 0x00f8fd29, 0x00f8fd29, 0x00f8fd29, 0x00f8fd29, 0x00f8fd29, 0x00f8fd29,
+    0x0000fd28, 0x0000fd28, 0x0000fd28, 0x0000fd28, 0x0000fd28, 0x0000fd28, 0x0000fd28, 0x0000fd28,
+    0x0000fd3c, 0xff00fd3c, 0x0100fd3c, 0xfe00fd3c, 0x0200fd3c, 0xfd00fd3c, 0x0300fd3c, 0xfc00fd3c,
+    0x00fffd28, 0x00fffd28, 0x00fffd28, 0x00fffd28, 0x00fffd28, 0x00fffd28, 0x00fffd28, 0x00fffd28,
+    0x00fffd3c, 0xfffffd3c, 0x01fffd3c, 0xfefffd3c, 0x02fffd3c, 0xfdfffd3c, 0x03fffd3c, 0xfcfffd3c,
+    0x0001fd28, 0x0001fd28, 0x0001fd28, 0x0001fd28, 0x0001fd28, 0x0001fd28, 0x0001fd28, 0x0001fd28,
+    0x0001fd3c, 0xff01fd3c, 0x0101fd3c, 0xfe01fd3c, 0x0201fd3c, 0xfd01fd3c, 0x0301fd3c, 0xfc01fd3c,
+    0x00fefd28, 0x00fefd28, 0x00fefd28, 0x00fefd28, 0x00fefd28, 0x00fefd28, 0x00fefd28, 0x00fefd28,
+    0x00fefd3c, 0xfffefd3c, 0x01fefd3c, 0xfefefd3c, 0x02fefd3c, 0xfdfefd3c, 0x03fefd3c, 0xfcfefd3c,
+    0x0002fd28, 0x0002fd28, 0x0002fd28, 0x0002fd28, 0x0002fd28, 0x0002fd28, 0x0002fd28, 0x0002fd28,
+    0x0002fd3c, 0xff02fd3c, 0x0102fd3c, 0xfe02fd3c, 0x0202fd3c, 0xfd02fd3c, 0x0302fd3c, 0xfc02fd3c,
+    0x00fdfd28, 0x00fdfd28, 0x00fdfd28, 0x00fdfd28, 0x00fdfd28, 0x00fdfd28, 0x00fdfd28, 0x00fdfd28,
+    0x00fdfd3c, 0xfffdfd3c, 0x01fdfd3c, 0xfefdfd3c, 0x02fdfd3c, 0xfdfdfd3c, 0x03fdfd3c, 0xfcfdfd3c,
+    0x0003fd28, 0x0003fd28, 0x0003fd28, 0x0003fd28, 0x0003fd28, 0x0003fd28, 0x0003fd28, 0x0003fd28,
+    0x0003fd3c, 0xff03fd3c, 0x0103fd3c, 0xfe03fd3c, 0x0203fd3c, 0xfd03fd3c, 0x0303fd3c, 0xfc03fd3c,
+    0x00fcfd28, 0x00fcfd28, 0x00fcfd28, 0x00fcfd28, 0x00fcfd28, 0x00fcfd28, 0x00fcfd28, 0x00fcfd28,
+    0x00fcfd3c, 0xfffcfd3c, 0x01fcfd3c, 0xfefcfd3c, 0x02fcfd3c, 0xfdfcfd3c, 0x03fcfd3c, 0xfcfcfd3c,
+    0x00000314, 0x00000314, 0x00000314, 0x00000314, 0x00000314, 0x00000314, 0x00000314, 0x00000314,
+    0x0010032c, 0x00ef032c, 0x0011032c, 0x00ee032c, 0x0012032c, 0x00ed032c, 0x0013032c, 0x00ec032c,
+    0x000c032b, 0x000c032b, 0x00f3032b, 0x00f3032b, 0x000d032b, 0x000d032b, 0x00f2032b, 0x00f2032b,
+    0x000e032b, 0x000e032b, 0x00f1032b, 0x00f1032b, 0x000f032b, 0x000f032b, 0x00f0032b, 0x00f0032b,
+    0x0008032a, 0x0008032a, 0x0008032a, 0x0008032a, 0x00f7032a, 0x00f7032a, 0x00f7032a, 0x00f7032a,
+    0x0009032a, 0x0009032a, 0x0009032a, 0x0009032a, 0x00f6032a, 0x00f6032a, 0x00f6032a, 0x00f6032a,
+    0x000a032a, 0x000a032a, 0x000a032a, 0x000a032a, 0x00f5032a, 0x00f5032a, 0x00f5032a, 0x00f5032a,
+    0x000b032a, 0x000b032a, 0x000b032a, 0x000b032a, 0x00f4032a, 0x00f4032a, 0x00f4032a, 0x00f4032a,
+    0x00040329, 0x00040329, 0x00040329, 0x00040329, 0x00040329, 0x00040329, 0x00040329, 0x00040329,
+    0x00fb0329, 0x00fb0329, 0x00fb0329, 0x00fb0329, 0x00fb0329, 0x00fb0329, 0x00fb0329, 0x00fb0329,
+    0x00050329, 0x00050329, 0x00050329, 0x00050329, 0x00050329, 0x00050329, 0x00050329, 0x00050329,
+    0x00fa0329, 0x00fa0329, 0x00fa0329, 0x00fa0329, 0x00fa0329, 0x00fa0329, 0x00fa0329, 0x00fa0329,
+    0x00060329, 0x00060329, 0x00060329, 0x00060329, 0x00060329, 0x00060329, 0x00060329, 0x00060329,
+    0x00f90329, 0x00f90329, 0x00f90329, 0x00f90329, 0x00f90329, 0x00f90329, 0x00f90329, 0x00f90329,
+    0x00070329, 0x00070329, 0x00070329, 0x00070329, 0x00070329, 0x00070329, 0x00070329, 0x00070329,
+    0x00f80329, 0x00f80329, 0x00f80329, 0x00f80329, 0x00f80329, 0x00f80329, 0x00f80329, 0x00f80329,
+    0x00000328, 0x00000328, 0x00000328, 0x00000328, 0x00000328, 0x00000328, 0x00000328, 0x00000328,
+    0x0000033c, 0xff00033c, 0x0100033c, 0xfe00033c, 0x0200033c, 0xfd00033c, 0x0300033c, 0xfc00033c,
+    0x00ff0328, 0x00ff0328, 0x00ff0328, 0x00ff0328, 0x00ff0328, 0x00ff0328, 0x00ff0328, 0x00ff0328,
+    0x00ff033c, 0xffff033c, 0x01ff033c, 0xfeff033c, 0x02ff033c, 0xfdff033c, 0x03ff033c, 0xfcff033c,
+    0x00010328, 0x00010328, 0x00010328, 0x00010328, 0x00010328, 0x00010328, 0x00010328, 0x00010328,
+    0x0001033c, 0xff01033c, 0x0101033c, 0xfe01033c, 0x0201033c, 0xfd01033c, 0x0301033c, 0xfc01033c,
+    0x00fe0328, 0x00fe0328, 0x00fe0328, 0x00fe0328, 0x00fe0328, 0x00fe0328, 0x00fe0328, 0x00fe0328,
+    0x00fe033c, 0xfffe033c, 0x01fe033c, 0xfefe033c, 0x02fe033c, 0xfdfe033c, 0x03fe033c, 0xfcfe033c,
+    0x00020328, 0x00020328, 0x00020328, 0x00020328, 0x00020328, 0x00020328, 0x00020328, 0x00020328,
+    0x0002033c, 0xff02033c, 0x0102033c, 0xfe02033c, 0x0202033c, 0xfd02033c, 0x0302033c, 0xfc02033c,
+    0x00fd0328, 0x00fd0328, 0x00fd0328, 0x00fd0328, 0x00fd0328, 0x00fd0328, 0x00fd0328, 0x00fd0328,
+    0x00fd033c, 0xfffd033c, 0x01fd033c, 0xfefd033c, 0x02fd033c, 0xfdfd033c, 0x03fd033c, 0xfcfd033c,
+    0x00030328, 0x00030328, 0x00030328, 0x00030328, 0x00030328, 0x00030328, 0x00030328, 0x00030328,
+    0x0003033c, 0xff03033c, 0x0103033c, 0xfe03033c, 0x0203033c, 0xfd03033c, 0x0303033c, 0xfc03033c,
+    0x00fc0328, 0x00fc0328, 0x00fc0328, 0x00fc0328, 0x00fc0328, 0x00fc0328, 0x00fc0328, 0x00fc0328,
+    0x00fc033c, 0xfffc033c, 0x01fc033c, 0xfefc033c, 0x02fc033c, 0xfdfc033c, 0x03fc033c, 0xfcfc033c,
+    0x0000fc14, 0x0000fc14, 0x0000fc14, 0x0000fc14, 0x0000fc14, 0x0000fc14, 0x0000fc14, 0x0000fc14,
+    0x0010fc2c, 0x00effc2c, 0x0011fc2c, 0x00eefc2c, 0x0012fc2c, 0x00edfc2c, 0x0013fc2c, 0x00ecfc2c,
+    0x000cfc2b, 0x000cfc2b, 0x00f3fc2b, 0x00f3fc2b, 0x000dfc2b, 0x000dfc2b, 0x00f2fc2b, 0x00f2fc2b,
+    0x000efc2b, 0x000efc2b, 0x00f1fc2b, 0x00f1fc2b, 0x000ffc2b, 0x000ffc2b, 0x00f0fc2b, 0x00f0fc2b,
+    0x0008fc2a, 0x0008fc2a, 0x0008fc2a, 0x0008fc2a, 0x00f7fc2a, 0x00f7fc2a, 0x00f7fc2a, 0x00f7fc2a,
+    0x0009fc2a, 0x0009fc2a, 0x0009fc2a, 0x0009fc2a, 0x00f6fc2a, 0x00f6fc2a, 0x00f6fc2a, 0x00f6fc2a,
+    0x000afc2a, 0x000afc2a, 0x000afc2a, 0x000afc2a, 0x00f5fc2a, 0x00f5fc2a, 0x00f5fc2a, 0x00f5fc2a,
+    0x000bfc2a, 0x000bfc2a, 0x000bfc2a, 0x000bfc2a, 0x00f4fc2a, 0x00f4fc2a, 0x00f4fc2a, 0x00f4fc2a,
+    0x0004fc29, 0x0004fc29, 0x0004fc29, 0x0004fc29, 0x0004fc29, 0x0004fc29, 0x0004fc29, 0x0004fc29,
+    0x00fbfc29, 0x00fbfc29, 0x00fbfc29, 0x00fbfc29, 0x00fbfc29, 0x00fbfc29, 0x00fbfc29, 0x00fbfc29,
+    0x0005fc29, 0x0005fc29, 0x0005fc29, 0x0005fc29, 0x0005fc29, 0x0005fc29, 0x0005fc29, 0x0005fc29,
+    0x00fafc29, 0x00fafc29, 0x00fafc29, 0x00fafc29, 0x00fafc29, 0x00fafc29, 0x00fafc29, 0x00fafc29,
+    0x0006fc29, 0x0006fc29, 0x0006fc29, 0x0006fc29, 0x0006fc29, 0x0006fc29, 0x0006fc29, 0x0006fc29,
+    0x00f9fc29, 0x00f9fc29, 0x00f9fc29, 0x00f9fc29, 0x00f9fc29, 0x00f9fc29, 0x00f9fc29, 0x00f9fc29,
+    0x0007fc29, 0x0007fc29, 0x0007fc29, 0x0007fc29, 0x0007fc29, 0x0007fc29, 0x0007fc29, 0x0007fc29,
+    0x00f8fc29, 0x00f8fc29, 0x00f8fc29, 0x00f8fc29, 0x00f8fc29, 0x00f8fc29, 0x00f8fc29, 0x00f8fc29,
+    0x0000fc28, 0x0000fc28, 0x0000fc28, 0x0000fc28, 0x0000fc28, 0x0000fc28, 0x0000fc28, 0x0000fc28,
+    0x0000fc3c, 0xff00fc3c, 0x0100fc3c, 0xfe00fc3c, 0x0200fc3c, 0xfd00fc3c, 0x0300fc3c, 0xfc00fc3c,
+    0x00fffc28, 0x00fffc28, 0x00fffc28, 0x00fffc28, 0x00fffc28, 0x00fffc28, 0x00fffc28, 0x00fffc28,
+    0x00fffc3c, 0xfffffc3c, 0x01fffc3c, 0xfefffc3c, 0x02fffc3c, 0xfdfffc3c, 0x03fffc3c, 0xfcfffc3c,
+    0x0001fc28, 0x0001fc28, 0x0001fc28, 0x0001fc28, 0x0001fc28, 0x0001fc28, 0x0001fc28, 0x0001fc28,
+    0x0001fc3c, 0xff01fc3c, 0x0101fc3c, 0xfe01fc3c, 0x0201fc3c, 0xfd01fc3c, 0x0301fc3c, 0xfc01fc3c,
+    0x00fefc28, 0x00fefc28, 0x00fefc28, 0x00fefc28, 0x00fefc28, 0x00fefc28, 0x00fefc28, 0x00fefc28,
+    0x00fefc3c, 0xfffefc3c, 0x01fefc3c, 0xfefefc3c, 0x02fefc3c, 0xfdfefc3c, 0x03fefc3c, 0xfcfefc3c,
+    0x0002fc28, 0x0002fc28, 0x0002fc28, 0x0002fc28, 0x0002fc28, 0x0002fc28, 0x0002fc28, 0x0002fc28,
+    0x0002fc3c, 0xff02fc3c, 0x0102fc3c, 0xfe02fc3c, 0x0202fc3c, 0xfd02fc3c, 0x0302fc3c, 0xfc02fc3c,
+    0x00fdfc28, 0x00fdfc28, 0x00fdfc28, 0x00fdfc28, 0x00fdfc28, 0x00fdfc28, 0x00fdfc28, 0x00fdfc28,
+    0x00fdfc3c, 0xfffdfc3c, 0x01fdfc3c, 0xfefdfc3c, 0x02fdfc3c, 0xfdfdfc3c, 0x03fdfc3c, 0xfcfdfc3c,
+    0x0003fc28, 0x0003fc28, 0x0003fc28, 0x0003fc28, 0x0003fc28, 0x0003fc28, 0x0003fc28, 0x0003fc28,
+    0x0003fc3c, 0xff03fc3c, 0x0103fc3c, 0xfe03fc3c, 0x0203fc3c, 0xfd03fc3c, 0x0303fc3c, 0xfc03fc3c,
+    0x00fcfc28, 0x00fcfc28, 0x00fcfc28, 0x00fcfc28, 0x00fcfc28, 0x00fcfc28, 0x00fcfc28, 0x00fcfc28,
+    0x00fcfc3c, 0xfffcfc3c, 0x01fcfc3c, 0xfefcfc3c, 0x02fcfc3c, 0xfdfcfc3c, 0x03fcfc3c, 0xfcfcfc3c,
+  },
+  {
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x0000381c, 0x0000c71c, 0x0000391c, 0x0000c61c, 0x00003a1c, 0x0000c51c, 0x00003b1c, 0x0000c41c,
+    0x00003c1c, 0x0000c31c, 0x00003d1c, 0x0000c21c, 0x00003e1c, 0x0000c11c, 0x00003f1c, 0x0000c01c,
+    0x0000301b, 0x0000301b, 0x0000cf1b, 0x0000cf1b, 0x0000311b, 0x0000311b, 0x0000ce1b, 0x0000ce1b,
+    0x0000321b, 0x0000321b, 0x0000cd1b, 0x0000cd1b, 0x0000331b, 0x0000331b, 0x0000cc1b, 0x0000cc1b,
+    0x0000341b, 0x0000341b, 0x0000cb1b, 0x0000cb1b, 0x0000351b, 0x0000351b, 0x0000ca1b, 0x0000ca1b,
+    0x0000361b, 0x0000361b, 0x0000c91b, 0x0000c91b, 0x0000371b, 0x0000371b, 0x0000c81b, 0x0000c81b,
+    0x0000281a, 0x0000281a, 0x0000281a, 0x0000281a, 0x0000d71a, 0x0000d71a, 0x0000d71a, 0x0000d71a,
+    0x0000291a, 0x0000291a, 0x0000291a, 0x0000291a, 0x0000d61a, 0x0000d61a, 0x0000d61a, 0x0000d61a,
+    0x00002a1a, 0x00002a1a, 0x00002a1a, 0x00002a1a, 0x0000d51a, 0x0000d51a, 0x0000d51a, 0x0000d51a,
+    0x00002b1a, 0x00002b1a, 0x00002b1a, 0x00002b1a, 0x0000d41a, 0x0000d41a, 0x0000d41a, 0x0000d41a,
+    0x00002c1a, 0x00002c1a, 0x00002c1a, 0x00002c1a, 0x0000d31a, 0x0000d31a, 0x0000d31a, 0x0000d31a,
+    0x00002d1a, 0x00002d1a, 0x00002d1a, 0x00002d1a, 0x0000d21a, 0x0000d21a, 0x0000d21a, 0x0000d21a,
+    0x00002e1a, 0x00002e1a, 0x00002e1a, 0x00002e1a, 0x0000d11a, 0x0000d11a, 0x0000d11a, 0x0000d11a,
+    0x00002f1a, 0x00002f1a, 0x00002f1a, 0x00002f1a, 0x0000d01a, 0x0000d01a, 0x0000d01a, 0x0000d01a,
+    0x00002019, 0x00002019, 0x00002019, 0x00002019, 0x00002019, 0x00002019, 0x00002019, 0x00002019,
+    0x0000df19, 0x0000df19, 0x0000df19, 0x0000df19, 0x0000df19, 0x0000df19, 0x0000df19, 0x0000df19,
+    0x00002119, 0x00002119, 0x00002119, 0x00002119, 0x00002119, 0x00002119, 0x00002119, 0x00002119,
+    0x0000de19, 0x0000de19, 0x0000de19, 0x0000de19, 0x0000de19, 0x0000de19, 0x0000de19, 0x0000de19,
+    0x00002219, 0x00002219, 0x00002219, 0x00002219, 0x00002219, 0x00002219, 0x00002219, 0x00002219,
+    0x0000dd19, 0x0000dd19, 0x0000dd19, 0x0000dd19, 0x0000dd19, 0x0000dd19, 0x0000dd19, 0x0000dd19,
+    0x00002319, 0x00002319, 0x00002319, 0x00002319, 0x00002319, 0x00002319, 0x00002319, 0x00002319,
+    0x0000dc19, 0x0000dc19, 0x0000dc19, 0x0000dc19, 0x0000dc19, 0x0000dc19, 0x0000dc19, 0x0000dc19,
+    0x00002419, 0x00002419, 0x00002419, 0x00002419, 0x00002419, 0x00002419, 0x00002419, 0x00002419,
+    0x0000db19, 0x0000db19, 0x0000db19, 0x0000db19, 0x0000db19, 0x0000db19, 0x0000db19, 0x0000db19,
+    0x00002519, 0x00002519, 0x00002519, 0x00002519, 0x00002519, 0x00002519, 0x00002519, 0x00002519,
+    0x0000da19, 0x0000da19, 0x0000da19, 0x0000da19, 0x0000da19, 0x0000da19, 0x0000da19, 0x0000da19,
+    0x00002619, 0x00002619, 0x00002619, 0x00002619, 0x00002619, 0x00002619, 0x00002619, 0x00002619,
+    0x0000d919, 0x0000d919, 0x0000d919, 0x0000d919, 0x0000d919, 0x0000d919, 0x0000d919, 0x0000d919,
+    0x00002719, 0x00002719, 0x00002719, 0x00002719, 0x00002719, 0x00002719, 0x00002719, 0x00002719,
+    0x0000d819, 0x0000d819, 0x0000d819, 0x0000d819, 0x0000d819, 0x0000d819, 0x0000d819, 0x0000d819,
+    0x00001818, 0x00001818, 0x00001818, 0x00001818, 0x00001818, 0x00001818, 0x00001818, 0x00001818,
+    0x00001818, 0x00001818, 0x00001818, 0x00001818, 0x00001818, 0x00001818, 0x00001818, 0x00001818,
+    0x0000e718, 0x0000e718, 0x0000e718, 0x0000e718, 0x0000e718, 0x0000e718, 0x0000e718, 0x0000e718,
+    0x0000e718, 0x0000e718, 0x0000e718, 0x0000e718, 0x0000e718, 0x0000e718, 0x0000e718, 0x0000e718,
+    0x00001918, 0x00001918, 0x00001918, 0x00001918, 0x00001918, 0x00001918, 0x00001918, 0x00001918,
+    0x00001918, 0x00001918, 0x00001918, 0x00001918, 0x00001918, 0x00001918, 0x00001918, 0x00001918,
+    0x0000e618, 0x0000e618, 0x0000e618, 0x0000e618, 0x0000e618, 0x0000e618, 0x0000e618, 0x0000e618,
+    0x0000e618, 0x0000e618, 0x0000e618, 0x0000e618, 0x0000e618, 0x0000e618, 0x0000e618, 0x0000e618,
+    0x00001a18, 0x00001a18, 0x00001a18, 0x00001a18, 0x00001a18, 0x00001a18, 0x00001a18, 0x00001a18,
+    0x00001a18, 0x00001a18, 0x00001a18, 0x00001a18, 0x00001a18, 0x00001a18, 0x00001a18, 0x00001a18,
+    0x0000e518, 0x0000e518, 0x0000e518, 0x0000e518, 0x0000e518, 0x0000e518, 0x0000e518, 0x0000e518,
+    0x0000e518, 0x0000e518, 0x0000e518, 0x0000e518, 0x0000e518, 0x0000e518, 0x0000e518, 0x0000e518,
+    0x00001b18, 0x00001b18, 0x00001b18, 0x00001b18, 0x00001b18, 0x00001b18, 0x00001b18, 0x00001b18,
+    0x00001b18, 0x00001b18, 0x00001b18, 0x00001b18, 0x00001b18, 0x00001b18, 0x00001b18, 0x00001b18,
+    0x0000e418, 0x0000e418, 0x0000e418, 0x0000e418, 0x0000e418, 0x0000e418, 0x0000e418, 0x0000e418,
+    0x0000e418, 0x0000e418, 0x0000e418, 0x0000e418, 0x0000e418, 0x0000e418, 0x0000e418, 0x0000e418,
+    0x00001c18, 0x00001c18, 0x00001c18, 0x00001c18, 0x00001c18, 0x00001c18, 0x00001c18, 0x00001c18,
+    0x00001c18, 0x00001c18, 0x00001c18, 0x00001c18, 0x00001c18, 0x00001c18, 0x00001c18, 0x00001c18,
+    0x0000e318, 0x0000e318, 0x0000e318, 0x0000e318, 0x0000e318, 0x0000e318, 0x0000e318, 0x0000e318,
+    0x0000e318, 0x0000e318, 0x0000e318, 0x0000e318, 0x0000e318, 0x0000e318, 0x0000e318, 0x0000e318,
+    0x00001d18, 0x00001d18, 0x00001d18, 0x00001d18, 0x00001d18, 0x00001d18, 0x00001d18, 0x00001d18,
+    0x00001d18, 0x00001d18, 0x00001d18, 0x00001d18, 0x00001d18, 0x00001d18, 0x00001d18, 0x00001d18,
+    0x0000e218, 0x0000e218, 0x0000e218, 0x0000e218, 0x0000e218, 0x0000e218, 0x0000e218, 0x0000e218,
+    0x0000e218, 0x0000e218, 0x0000e218, 0x0000e218, 0x0000e218, 0x0000e218, 0x0000e218, 0x0000e218,
+    0x00001e18, 0x00001e18, 0x00001e18, 0x00001e18, 0x00001e18, 0x00001e18, 0x00001e18, 0x00001e18,
+    0x00001e18, 0x00001e18, 0x00001e18, 0x00001e18, 0x00001e18, 0x00001e18, 0x00001e18, 0x00001e18,
+    0x0000e118, 0x0000e118, 0x0000e118, 0x0000e118, 0x0000e118, 0x0000e118, 0x0000e118, 0x0000e118,
+    0x0000e118, 0x0000e118, 0x0000e118, 0x0000e118, 0x0000e118, 0x0000e118, 0x0000e118, 0x0000e118,
+    0x00001f18, 0x00001f18, 0x00001f18, 0x00001f18, 0x00001f18, 0x00001f18, 0x00001f18, 0x00001f18,
+    0x00001f18, 0x00001f18, 0x00001f18, 0x00001f18, 0x00001f18, 0x00001f18, 0x00001f18, 0x00001f18,
+    0x0000e018, 0x0000e018, 0x0000e018, 0x0000e018, 0x0000e018, 0x0000e018, 0x0000e018, 0x0000e018,
+    0x0000e018, 0x0000e018, 0x0000e018, 0x0000e018, 0x0000e018, 0x0000e018, 0x0000e018, 0x0000e018,
+    0x00001017, 0x00001017, 0x00001017, 0x00001017, 0x00001017, 0x00001017, 0x00001017, 0x00001017,
+    0x00001017, 0x00001017, 0x00001017, 0x00001017, 0x00001017, 0x00001017, 0x00001017, 0x00001017,
+    0x0000102c, 0x00ff102c, 0x0001102c, 0x00fe102c, 0x0002102c, 0x00fd102c, 0x0003102c, 0x00fc102c,
+    0x0004102c, 0x00fb102c, 0x0005102c, 0x00fa102c, 0x0006102c, 0x00f9102c, 0x0007102c, 0x00f8102c,
+    0x0000ef17, 0x0000ef17, 0x0000ef17, 0x0000ef17, 0x0000ef17, 0x0000ef17, 0x0000ef17, 0x0000ef17,
+    0x0000ef17, 0x0000ef17, 0x0000ef17, 0x0000ef17, 0x0000ef17, 0x0000ef17, 0x0000ef17, 0x0000ef17,
+    0x0000ef2c, 0x00ffef2c, 0x0001ef2c, 0x00feef2c, 0x0002ef2c, 0x00fdef2c, 0x0003ef2c, 0x00fcef2c,
+    0x0004ef2c, 0x00fbef2c, 0x0005ef2c, 0x00faef2c, 0x0006ef2c, 0x00f9ef2c, 0x0007ef2c, 0x00f8ef2c,
+    0x00001117, 0x00001117, 0x00001117, 0x00001117, 0x00001117, 0x00001117, 0x00001117, 0x00001117,
+    0x00001117, 0x00001117, 0x00001117, 0x00001117, 0x00001117, 0x00001117, 0x00001117, 0x00001117,
+    0x0000112c, 0x00ff112c, 0x0001112c, 0x00fe112c, 0x0002112c, 0x00fd112c, 0x0003112c, 0x00fc112c,
+    0x0004112c, 0x00fb112c, 0x0005112c, 0x00fa112c, 0x0006112c, 0x00f9112c, 0x0007112c, 0x00f8112c,
+    0x0000ee17, 0x0000ee17, 0x0000ee17, 0x0000ee17, 0x0000ee17, 0x0000ee17, 0x0000ee17, 0x0000ee17,
+    0x0000ee17, 0x0000ee17, 0x0000ee17, 0x0000ee17, 0x0000ee17, 0x0000ee17, 0x0000ee17, 0x0000ee17,
+    0x0000ee2c, 0x00ffee2c, 0x0001ee2c, 0x00feee2c, 0x0002ee2c, 0x00fdee2c, 0x0003ee2c, 0x00fcee2c,
+    0x0004ee2c, 0x00fbee2c, 0x0005ee2c, 0x00faee2c, 0x0006ee2c, 0x00f9ee2c, 0x0007ee2c, 0x00f8ee2c,
+    0x00001217, 0x00001217, 0x00001217, 0x00001217, 0x00001217, 0x00001217, 0x00001217, 0x00001217,
+    0x00001217, 0x00001217, 0x00001217, 0x00001217, 0x00001217, 0x00001217, 0x00001217, 0x00001217,
+    0x0000122c, 0x00ff122c, 0x0001122c, 0x00fe122c, 0x0002122c, 0x00fd122c, 0x0003122c, 0x00fc122c,
+    0x0004122c, 0x00fb122c, 0x0005122c, 0x00fa122c, 0x0006122c, 0x00f9122c, 0x0007122c, 0x00f8122c,
+    0x0000ed17, 0x0000ed17, 0x0000ed17, 0x0000ed17, 0x0000ed17, 0x0000ed17, 0x0000ed17, 0x0000ed17,
+    0x0000ed17, 0x0000ed17, 0x0000ed17, 0x0000ed17, 0x0000ed17, 0x0000ed17, 0x0000ed17, 0x0000ed17,
+    0x0000ed2c, 0x00ffed2c, 0x0001ed2c, 0x00feed2c, 0x0002ed2c, 0x00fded2c, 0x0003ed2c, 0x00fced2c,
+    0x0004ed2c, 0x00fbed2c, 0x0005ed2c, 0x00faed2c, 0x0006ed2c, 0x00f9ed2c, 0x0007ed2c, 0x00f8ed2c,
+    0x00001317, 0x00001317, 0x00001317, 0x00001317, 0x00001317, 0x00001317, 0x00001317, 0x00001317,
+    0x00001317, 0x00001317, 0x00001317, 0x00001317, 0x00001317, 0x00001317, 0x00001317, 0x00001317,
+    0x0000132c, 0x00ff132c, 0x0001132c, 0x00fe132c, 0x0002132c, 0x00fd132c, 0x0003132c, 0x00fc132c,
+    0x0004132c, 0x00fb132c, 0x0005132c, 0x00fa132c, 0x0006132c, 0x00f9132c, 0x0007132c, 0x00f8132c,
+    0x0000ec17, 0x0000ec17, 0x0000ec17, 0x0000ec17, 0x0000ec17, 0x0000ec17, 0x0000ec17, 0x0000ec17,
+    0x0000ec17, 0x0000ec17, 0x0000ec17, 0x0000ec17, 0x0000ec17, 0x0000ec17, 0x0000ec17, 0x0000ec17,
+    0x0000ec2c, 0x00ffec2c, 0x0001ec2c, 0x00feec2c, 0x0002ec2c, 0x00fdec2c, 0x0003ec2c, 0x00fcec2c,
+    0x0004ec2c, 0x00fbec2c, 0x0005ec2c, 0x00faec2c, 0x0006ec2c, 0x00f9ec2c, 0x0007ec2c, 0x00f8ec2c,
+    0x00001417, 0x00001417, 0x00001417, 0x00001417, 0x00001417, 0x00001417, 0x00001417, 0x00001417,
+    0x00001417, 0x00001417, 0x00001417, 0x00001417, 0x00001417, 0x00001417, 0x00001417, 0x00001417,
+    0x0000142c, 0x00ff142c, 0x0001142c, 0x00fe142c, 0x0002142c, 0x00fd142c, 0x0003142c, 0x00fc142c,
+    0x0004142c, 0x00fb142c, 0x0005142c, 0x00fa142c, 0x0006142c, 0x00f9142c, 0x0007142c, 0x00f8142c,
+    0x0000eb17, 0x0000eb17, 0x0000eb17, 0x0000eb17, 0x0000eb17, 0x0000eb17, 0x0000eb17, 0x0000eb17,
+    0x0000eb17, 0x0000eb17, 0x0000eb17, 0x0000eb17, 0x0000eb17, 0x0000eb17, 0x0000eb17, 0x0000eb17,
+    0x0000eb2c, 0x00ffeb2c, 0x0001eb2c, 0x00feeb2c, 0x0002eb2c, 0x00fdeb2c, 0x0003eb2c, 0x00fceb2c,
+    0x0004eb2c, 0x00fbeb2c, 0x0005eb2c, 0x00faeb2c, 0x0006eb2c, 0x00f9eb2c, 0x0007eb2c, 0x00f8eb2c,
+    0x00001517, 0x00001517, 0x00001517, 0x00001517, 0x00001517, 0x00001517, 0x00001517, 0x00001517,
+    0x00001517, 0x00001517, 0x00001517, 0x00001517, 0x00001517, 0x00001517, 0x00001517, 0x00001517,
+    0x0000152c, 0x00ff152c, 0x0001152c, 0x00fe152c, 0x0002152c, 0x00fd152c, 0x0003152c, 0x00fc152c,
+    0x0004152c, 0x00fb152c, 0x0005152c, 0x00fa152c, 0x0006152c, 0x00f9152c, 0x0007152c, 0x00f8152c,
+    0x0000ea17, 0x0000ea17, 0x0000ea17, 0x0000ea17, 0x0000ea17, 0x0000ea17, 0x0000ea17, 0x0000ea17,
+    0x0000ea17, 0x0000ea17, 0x0000ea17, 0x0000ea17, 0x0000ea17, 0x0000ea17, 0x0000ea17, 0x0000ea17,
+    0x0000ea2c, 0x00ffea2c, 0x0001ea2c, 0x00feea2c, 0x0002ea2c, 0x00fdea2c, 0x0003ea2c, 0x00fcea2c,
+    0x0004ea2c, 0x00fbea2c, 0x0005ea2c, 0x00faea2c, 0x0006ea2c, 0x00f9ea2c, 0x0007ea2c, 0x00f8ea2c,
+    0x00001617, 0x00001617, 0x00001617, 0x00001617, 0x00001617, 0x00001617, 0x00001617, 0x00001617,
+    0x00001617, 0x00001617, 0x00001617, 0x00001617, 0x00001617, 0x00001617, 0x00001617, 0x00001617,
+    0x0000162c, 0x00ff162c, 0x0001162c, 0x00fe162c, 0x0002162c, 0x00fd162c, 0x0003162c, 0x00fc162c,
+    0x0004162c, 0x00fb162c, 0x0005162c, 0x00fa162c, 0x0006162c, 0x00f9162c, 0x0007162c, 0x00f8162c,
+    0x0000e917, 0x0000e917, 0x0000e917, 0x0000e917, 0x0000e917, 0x0000e917, 0x0000e917, 0x0000e917,
+    0x0000e917, 0x0000e917, 0x0000e917, 0x0000e917, 0x0000e917, 0x0000e917, 0x0000e917, 0x0000e917,
+    0x0000e92c, 0x00ffe92c, 0x0001e92c, 0x00fee92c, 0x0002e92c, 0x00fde92c, 0x0003e92c, 0x00fce92c,
+    0x0004e92c, 0x00fbe92c, 0x0005e92c, 0x00fae92c, 0x0006e92c, 0x00f9e92c, 0x0007e92c, 0x00f8e92c,
+    0x00001717, 0x00001717, 0x00001717, 0x00001717, 0x00001717, 0x00001717, 0x00001717, 0x00001717,
+    0x00001717, 0x00001717, 0x00001717, 0x00001717, 0x00001717, 0x00001717, 0x00001717, 0x00001717,
+    0x0000172c, 0x00ff172c, 0x0001172c, 0x00fe172c, 0x0002172c, 0x00fd172c, 0x0003172c, 0x00fc172c,
+    0x0004172c, 0x00fb172c, 0x0005172c, 0x00fa172c, 0x0006172c, 0x00f9172c, 0x0007172c, 0x00f8172c,
+    0x0000e817, 0x0000e817, 0x0000e817, 0x0000e817, 0x0000e817, 0x0000e817, 0x0000e817, 0x0000e817,
+    0x0000e817, 0x0000e817, 0x0000e817, 0x0000e817, 0x0000e817, 0x0000e817, 0x0000e817, 0x0000e817,
+    0x0000e82c, 0x00ffe82c, 0x0001e82c, 0x00fee82c, 0x0002e82c, 0x00fde82c, 0x0003e82c, 0x00fce82c,
+    0x0004e82c, 0x00fbe82c, 0x0005e82c, 0x00fae82c, 0x0006e82c, 0x00f9e82c, 0x0007e82c, 0x00f8e82c,
+    0x00000816, 0x00000816, 0x00000816, 0x00000816, 0x00000816, 0x00000816, 0x00000816, 0x00000816,
+    0x00000816, 0x00000816, 0x00000816, 0x00000816, 0x00000816, 0x00000816, 0x00000816, 0x00000816,
+    0x0008082c, 0x00f7082c, 0x0009082c, 0x00f6082c, 0x000a082c, 0x00f5082c, 0x000b082c, 0x00f4082c,
+    0x000c082c, 0x00f3082c, 0x000d082c, 0x00f2082c, 0x000e082c, 0x00f1082c, 0x000f082c, 0x00f0082c,
+    0x0000082b, 0x0000082b, 0x00ff082b, 0x00ff082b, 0x0001082b, 0x0001082b, 0x00fe082b, 0x00fe082b,
+    0x0002082b, 0x0002082b, 0x00fd082b, 0x00fd082b, 0x0003082b, 0x0003082b, 0x00fc082b, 0x00fc082b,
+    0x0004082b, 0x0004082b, 0x00fb082b, 0x00fb082b, 0x0005082b, 0x0005082b, 0x00fa082b, 0x00fa082b,
+    0x0006082b, 0x0006082b, 0x00f9082b, 0x00f9082b, 0x0007082b, 0x0007082b, 0x00f8082b, 0x00f8082b,
+    0x0000f716, 0x0000f716, 0x0000f716, 0x0000f716, 0x0000f716, 0x0000f716, 0x0000f716, 0x0000f716,
+    0x0000f716, 0x0000f716, 0x0000f716, 0x0000f716, 0x0000f716, 0x0000f716, 0x0000f716, 0x0000f716,
+    0x0008f72c, 0x00f7f72c, 0x0009f72c, 0x00f6f72c, 0x000af72c, 0x00f5f72c, 0x000bf72c, 0x00f4f72c,
+    0x000cf72c, 0x00f3f72c, 0x000df72c, 0x00f2f72c, 0x000ef72c, 0x00f1f72c, 0x000ff72c, 0x00f0f72c,
+    0x0000f72b, 0x0000f72b, 0x00fff72b, 0x00fff72b, 0x0001f72b, 0x0001f72b, 0x00fef72b, 0x00fef72b,
+    0x0002f72b, 0x0002f72b, 0x00fdf72b, 0x00fdf72b, 0x0003f72b, 0x0003f72b, 0x00fcf72b, 0x00fcf72b,
+    0x0004f72b, 0x0004f72b, 0x00fbf72b, 0x00fbf72b, 0x0005f72b, 0x0005f72b, 0x00faf72b, 0x00faf72b,
+    0x0006f72b, 0x0006f72b, 0x00f9f72b, 0x00f9f72b, 0x0007f72b, 0x0007f72b, 0x00f8f72b, 0x00f8f72b,
+    0x00000916, 0x00000916, 0x00000916, 0x00000916, 0x00000916, 0x00000916, 0x00000916, 0x00000916,
+    0x00000916, 0x00000916, 0x00000916, 0x00000916, 0x00000916, 0x00000916, 0x00000916, 0x00000916,
+    0x0008092c, 0x00f7092c, 0x0009092c, 0x00f6092c, 0x000a092c, 0x00f5092c, 0x000b092c, 0x00f4092c,
+    0x000c092c, 0x00f3092c, 0x000d092c, 0x00f2092c, 0x000e092c, 0x00f1092c, 0x000f092c, 0x00f0092c,
+    0x0000092b, 0x0000092b, 0x00ff092b, 0x00ff092b, 0x0001092b, 0x0001092b, 0x00fe092b, 0x00fe092b,
+    0x0002092b, 0x0002092b, 0x00fd092b, 0x00fd092b, 0x0003092b, 0x0003092b, 0x00fc092b, 0x00fc092b,
+    0x0004092b, 0x0004092b, 0x00fb092b, 0x00fb092b, 0x0005092b, 0x0005092b, 0x00fa092b, 0x00fa092b,
+    0x0006092b, 0x0006092b, 0x00f9092b, 0x00f9092b, 0x0007092b, 0x0007092b, 0x00f8092b, 0x00f8092b,
+    0x0000f616, 0x0000f616, 0x0000f616, 0x0000f616, 0x0000f616, 0x0000f616, 0x0000f616, 0x0000f616,
+    0x0000f616, 0x0000f616, 0x0000f616, 0x0000f616, 0x0000f616, 0x0000f616, 0x0000f616, 0x0000f616,
+    0x0008f62c, 0x00f7f62c, 0x0009f62c, 0x00f6f62c, 0x000af62c, 0x00f5f62c, 0x000bf62c, 0x00f4f62c,
+    0x000cf62c, 0x00f3f62c, 0x000df62c, 0x00f2f62c, 0x000ef62c, 0x00f1f62c, 0x000ff62c, 0x00f0f62c,
+    0x0000f62b, 0x0000f62b, 0x00fff62b, 0x00fff62b, 0x0001f62b, 0x0001f62b, 0x00fef62b, 0x00fef62b,
+    0x0002f62b, 0x0002f62b, 0x00fdf62b, 0x00fdf62b, 0x0003f62b, 0x0003f62b, 0x00fcf62b, 0x00fcf62b,
+    0x0004f62b, 0x0004f62b, 0x00fbf62b, 0x00fbf62b, 0x0005f62b, 0x0005f62b, 0x00faf62b, 0x00faf62b,
+    0x0006f62b, 0x0006f62b, 0x00f9f62b, 0x00f9f62b, 0x0007f62b, 0x0007f62b, 0x00f8f62b, 0x00f8f62b,
+    0x00000a16, 0x00000a16, 0x00000a16, 0x00000a16, 0x00000a16, 0x00000a16, 0x00000a16, 0x00000a16,
+    0x00000a16, 0x00000a16, 0x00000a16, 0x00000a16, 0x00000a16, 0x00000a16, 0x00000a16, 0x00000a16,
+    0x00080a2c, 0x00f70a2c, 0x00090a2c, 0x00f60a2c, 0x000a0a2c, 0x00f50a2c, 0x000b0a2c, 0x00f40a2c,
+    0x000c0a2c, 0x00f30a2c, 0x000d0a2c, 0x00f20a2c, 0x000e0a2c, 0x00f10a2c, 0x000f0a2c, 0x00f00a2c,
+    0x00000a2b, 0x00000a2b, 0x00ff0a2b, 0x00ff0a2b, 0x00010a2b, 0x00010a2b, 0x00fe0a2b, 0x00fe0a2b,
+    0x00020a2b, 0x00020a2b, 0x00fd0a2b, 0x00fd0a2b, 0x00030a2b, 0x00030a2b, 0x00fc0a2b, 0x00fc0a2b,
+    0x00040a2b, 0x00040a2b, 0x00fb0a2b, 0x00fb0a2b, 0x00050a2b, 0x00050a2b, 0x00fa0a2b, 0x00fa0a2b,
+    0x00060a2b, 0x00060a2b, 0x00f90a2b, 0x00f90a2b, 0x00070a2b, 0x00070a2b, 0x00f80a2b, 0x00f80a2b,
+    0x0000f516, 0x0000f516, 0x0000f516, 0x0000f516, 0x0000f516, 0x0000f516, 0x0000f516, 0x0000f516,
+    0x0000f516, 0x0000f516, 0x0000f516, 0x0000f516, 0x0000f516, 0x0000f516, 0x0000f516, 0x0000f516,
+    0x0008f52c, 0x00f7f52c, 0x0009f52c, 0x00f6f52c, 0x000af52c, 0x00f5f52c, 0x000bf52c, 0x00f4f52c,
+    0x000cf52c, 0x00f3f52c, 0x000df52c, 0x00f2f52c, 0x000ef52c, 0x00f1f52c, 0x000ff52c, 0x00f0f52c,
+    0x0000f52b, 0x0000f52b, 0x00fff52b, 0x00fff52b, 0x0001f52b, 0x0001f52b, 0x00fef52b, 0x00fef52b,
+    0x0002f52b, 0x0002f52b, 0x00fdf52b, 0x00fdf52b, 0x0003f52b, 0x0003f52b, 0x00fcf52b, 0x00fcf52b,
+    0x0004f52b, 0x0004f52b, 0x00fbf52b, 0x00fbf52b, 0x0005f52b, 0x0005f52b, 0x00faf52b, 0x00faf52b,
+    0x0006f52b, 0x0006f52b, 0x00f9f52b, 0x00f9f52b, 0x0007f52b, 0x0007f52b, 0x00f8f52b, 0x00f8f52b,
+    0x00000b16, 0x00000b16, 0x00000b16, 0x00000b16, 0x00000b16, 0x00000b16, 0x00000b16, 0x00000b16,
+    0x00000b16, 0x00000b16, 0x00000b16, 0x00000b16, 0x00000b16, 0x00000b16, 0x00000b16, 0x00000b16,
+    0x00080b2c, 0x00f70b2c, 0x00090b2c, 0x00f60b2c, 0x000a0b2c, 0x00f50b2c, 0x000b0b2c, 0x00f40b2c,
+    0x000c0b2c, 0x00f30b2c, 0x000d0b2c, 0x00f20b2c, 0x000e0b2c, 0x00f10b2c, 0x000f0b2c, 0x00f00b2c,
+    0x00000b2b, 0x00000b2b, 0x00ff0b2b, 0x00ff0b2b, 0x00010b2b, 0x00010b2b, 0x00fe0b2b, 0x00fe0b2b,
+    0x00020b2b, 0x00020b2b, 0x00fd0b2b, 0x00fd0b2b, 0x00030b2b, 0x00030b2b, 0x00fc0b2b, 0x00fc0b2b,
+    0x00040b2b, 0x00040b2b, 0x00fb0b2b, 0x00fb0b2b, 0x00050b2b, 0x00050b2b, 0x00fa0b2b, 0x00fa0b2b,
+    0x00060b2b, 0x00060b2b, 0x00f90b2b, 0x00f90b2b, 0x00070b2b, 0x00070b2b, 0x00f80b2b, 0x00f80b2b,
+    0x0000f416, 0x0000f416, 0x0000f416, 0x0000f416, 0x0000f416, 0x0000f416, 0x0000f416, 0x0000f416,
+    0x0000f416, 0x0000f416, 0x0000f416, 0x0000f416, 0x0000f416, 0x0000f416, 0x0000f416, 0x0000f416,
+    0x0008f42c, 0x00f7f42c, 0x0009f42c, 0x00f6f42c, 0x000af42c, 0x00f5f42c, 0x000bf42c, 0x00f4f42c,
+    0x000cf42c, 0x00f3f42c, 0x000df42c, 0x00f2f42c, 0x000ef42c, 0x00f1f42c, 0x000ff42c, 0x00f0f42c,
+    0x0000f42b, 0x0000f42b, 0x00fff42b, 0x00fff42b, 0x0001f42b, 0x0001f42b, 0x00fef42b, 0x00fef42b,
+    0x0002f42b, 0x0002f42b, 0x00fdf42b, 0x00fdf42b, 0x0003f42b, 0x0003f42b, 0x00fcf42b, 0x00fcf42b,
+    0x0004f42b, 0x0004f42b, 0x00fbf42b, 0x00fbf42b, 0x0005f42b, 0x0005f42b, 0x00faf42b, 0x00faf42b,
+    0x0006f42b, 0x0006f42b, 0x00f9f42b, 0x00f9f42b, 0x0007f42b, 0x0007f42b, 0x00f8f42b, 0x00f8f42b,
+    0x00000c16, 0x00000c16, 0x00000c16, 0x00000c16, 0x00000c16, 0x00000c16, 0x00000c16, 0x00000c16,
+    0x00000c16, 0x00000c16, 0x00000c16, 0x00000c16, 0x00000c16, 0x00000c16, 0x00000c16, 0x00000c16,
+    0x00080c2c, 0x00f70c2c, 0x00090c2c, 0x00f60c2c, 0x000a0c2c, 0x00f50c2c, 0x000b0c2c, 0x00f40c2c,
+    0x000c0c2c, 0x00f30c2c, 0x000d0c2c, 0x00f20c2c, 0x000e0c2c, 0x00f10c2c, 0x000f0c2c, 0x00f00c2c,
+    0x00000c2b, 0x00000c2b, 0x00ff0c2b, 0x00ff0c2b, 0x00010c2b, 0x00010c2b, 0x00fe0c2b, 0x00fe0c2b,
+    0x00020c2b, 0x00020c2b, 0x00fd0c2b, 0x00fd0c2b, 0x00030c2b, 0x00030c2b, 0x00fc0c2b, 0x00fc0c2b,
+    0x00040c2b, 0x00040c2b, 0x00fb0c2b, 0x00fb0c2b, 0x00050c2b, 0x00050c2b, 0x00fa0c2b, 0x00fa0c2b,
+    0x00060c2b, 0x00060c2b, 0x00f90c2b, 0x00f90c2b, 0x00070c2b, 0x00070c2b, 0x00f80c2b, 0x00f80c2b,
+    0x0000f316, 0x0000f316, 0x0000f316, 0x0000f316, 0x0000f316, 0x0000f316, 0x0000f316, 0x0000f316,
+    0x0000f316, 0x0000f316, 0x0000f316, 0x0000f316, 0x0000f316, 0x0000f316, 0x0000f316, 0x0000f316,
+    0x0008f32c, 0x00f7f32c, 0x0009f32c, 0x00f6f32c, 0x000af32c, 0x00f5f32c, 0x000bf32c, 0x00f4f32c,
+    0x000cf32c, 0x00f3f32c, 0x000df32c, 0x00f2f32c, 0x000ef32c, 0x00f1f32c, 0x000ff32c, 0x00f0f32c,
+    0x0000f32b, 0x0000f32b, 0x00fff32b, 0x00fff32b, 0x0001f32b, 0x0001f32b, 0x00fef32b, 0x00fef32b,
+    0x0002f32b, 0x0002f32b, 0x00fdf32b, 0x00fdf32b, 0x0003f32b, 0x0003f32b, 0x00fcf32b, 0x00fcf32b,
+    0x0004f32b, 0x0004f32b, 0x00fbf32b, 0x00fbf32b, 0x0005f32b, 0x0005f32b, 0x00faf32b, 0x00faf32b,
+    0x0006f32b, 0x0006f32b, 0x00f9f32b, 0x00f9f32b, 0x0007f32b, 0x0007f32b, 0x00f8f32b, 0x00f8f32b,
+    0x00000d16, 0x00000d16, 0x00000d16, 0x00000d16, 0x00000d16, 0x00000d16, 0x00000d16, 0x00000d16,
+    0x00000d16, 0x00000d16, 0x00000d16, 0x00000d16, 0x00000d16, 0x00000d16, 0x00000d16, 0x00000d16,
+    0x00080d2c, 0x00f70d2c, 0x00090d2c, 0x00f60d2c, 0x000a0d2c, 0x00f50d2c, 0x000b0d2c, 0x00f40d2c,
+    0x000c0d2c, 0x00f30d2c, 0x000d0d2c, 0x00f20d2c, 0x000e0d2c, 0x00f10d2c, 0x000f0d2c, 0x00f00d2c,
+    0x00000d2b, 0x00000d2b, 0x00ff0d2b, 0x00ff0d2b, 0x00010d2b, 0x00010d2b, 0x00fe0d2b, 0x00fe0d2b,
+    0x00020d2b, 0x00020d2b, 0x00fd0d2b, 0x00fd0d2b, 0x00030d2b, 0x00030d2b, 0x00fc0d2b, 0x00fc0d2b,
+    0x00040d2b, 0x00040d2b, 0x00fb0d2b, 0x00fb0d2b, 0x00050d2b, 0x00050d2b, 0x00fa0d2b, 0x00fa0d2b,
+    0x00060d2b, 0x00060d2b, 0x00f90d2b, 0x00f90d2b, 0x00070d2b, 0x00070d2b, 0x00f80d2b, 0x00f80d2b,
+    0x0000f216, 0x0000f216, 0x0000f216, 0x0000f216, 0x0000f216, 0x0000f216, 0x0000f216, 0x0000f216,
+    0x0000f216, 0x0000f216, 0x0000f216, 0x0000f216, 0x0000f216, 0x0000f216, 0x0000f216, 0x0000f216,
+    0x0008f22c, 0x00f7f22c, 0x0009f22c, 0x00f6f22c, 0x000af22c, 0x00f5f22c, 0x000bf22c, 0x00f4f22c,
+    0x000cf22c, 0x00f3f22c, 0x000df22c, 0x00f2f22c, 0x000ef22c, 0x00f1f22c, 0x000ff22c, 0x00f0f22c,
+    0x0000f22b, 0x0000f22b, 0x00fff22b, 0x00fff22b, 0x0001f22b, 0x0001f22b, 0x00fef22b, 0x00fef22b,
+    0x0002f22b, 0x0002f22b, 0x00fdf22b, 0x00fdf22b, 0x0003f22b, 0x0003f22b, 0x00fcf22b, 0x00fcf22b,
+    0x0004f22b, 0x0004f22b, 0x00fbf22b, 0x00fbf22b, 0x0005f22b, 0x0005f22b, 0x00faf22b, 0x00faf22b,
+    0x0006f22b, 0x0006f22b, 0x00f9f22b, 0x00f9f22b, 0x0007f22b, 0x0007f22b, 0x00f8f22b, 0x00f8f22b,
+    0x00000e16, 0x00000e16, 0x00000e16, 0x00000e16, 0x00000e16, 0x00000e16, 0x00000e16, 0x00000e16,
+    0x00000e16, 0x00000e16, 0x00000e16, 0x00000e16, 0x00000e16, 0x00000e16, 0x00000e16, 0x00000e16,
+    0x00080e2c, 0x00f70e2c, 0x00090e2c, 0x00f60e2c, 0x000a0e2c, 0x00f50e2c, 0x000b0e2c, 0x00f40e2c,
+    0x000c0e2c, 0x00f30e2c, 0x000d0e2c, 0x00f20e2c, 0x000e0e2c, 0x00f10e2c, 0x000f0e2c, 0x00f00e2c,
+    0x00000e2b, 0x00000e2b, 0x00ff0e2b, 0x00ff0e2b, 0x00010e2b, 0x00010e2b, 0x00fe0e2b, 0x00fe0e2b,
+    0x00020e2b, 0x00020e2b, 0x00fd0e2b, 0x00fd0e2b, 0x00030e2b, 0x00030e2b, 0x00fc0e2b, 0x00fc0e2b,
+    0x00040e2b, 0x00040e2b, 0x00fb0e2b, 0x00fb0e2b, 0x00050e2b, 0x00050e2b, 0x00fa0e2b, 0x00fa0e2b,
+    0x00060e2b, 0x00060e2b, 0x00f90e2b, 0x00f90e2b, 0x00070e2b, 0x00070e2b, 0x00f80e2b, 0x00f80e2b,
+    0x0000f116, 0x0000f116, 0x0000f116, 0x0000f116, 0x0000f116, 0x0000f116, 0x0000f116, 0x0000f116,
+    0x0000f116, 0x0000f116, 0x0000f116, 0x0000f116, 0x0000f116, 0x0000f116, 0x0000f116, 0x0000f116,
+    0x0008f12c, 0x00f7f12c, 0x0009f12c, 0x00f6f12c, 0x000af12c, 0x00f5f12c, 0x000bf12c, 0x00f4f12c,
+    0x000cf12c, 0x00f3f12c, 0x000df12c, 0x00f2f12c, 0x000ef12c, 0x00f1f12c, 0x000ff12c, 0x00f0f12c,
+    0x0000f12b, 0x0000f12b, 0x00fff12b, 0x00fff12b, 0x0001f12b, 0x0001f12b, 0x00fef12b, 0x00fef12b,
+    0x0002f12b, 0x0002f12b, 0x00fdf12b, 0x00fdf12b, 0x0003f12b, 0x0003f12b, 0x00fcf12b, 0x00fcf12b,
+    0x0004f12b, 0x0004f12b, 0x00fbf12b, 0x00fbf12b, 0x0005f12b, 0x0005f12b, 0x00faf12b, 0x00faf12b,
+    0x0006f12b, 0x0006f12b, 0x00f9f12b, 0x00f9f12b, 0x0007f12b, 0x0007f12b, 0x00f8f12b, 0x00f8f12b,
+    0x00000f16, 0x00000f16, 0x00000f16, 0x00000f16, 0x00000f16, 0x00000f16, 0x00000f16, 0x00000f16,
+    0x00000f16, 0x00000f16, 0x00000f16, 0x00000f16, 0x00000f16, 0x00000f16, 0x00000f16, 0x00000f16,
+    0x00080f2c, 0x00f70f2c, 0x00090f2c, 0x00f60f2c, 0x000a0f2c, 0x00f50f2c, 0x000b0f2c, 0x00f40f2c,
+    0x000c0f2c, 0x00f30f2c, 0x000d0f2c, 0x00f20f2c, 0x000e0f2c, 0x00f10f2c, 0x000f0f2c, 0x00f00f2c,
+    0x00000f2b, 0x00000f2b, 0x00ff0f2b, 0x00ff0f2b, 0x00010f2b, 0x00010f2b, 0x00fe0f2b, 0x00fe0f2b,
+    0x00020f2b, 0x00020f2b, 0x00fd0f2b, 0x00fd0f2b, 0x00030f2b, 0x00030f2b, 0x00fc0f2b, 0x00fc0f2b,
+    0x00040f2b, 0x00040f2b, 0x00fb0f2b, 0x00fb0f2b, 0x00050f2b, 0x00050f2b, 0x00fa0f2b, 0x00fa0f2b,
+    0x00060f2b, 0x00060f2b, 0x00f90f2b, 0x00f90f2b, 0x00070f2b, 0x00070f2b, 0x00f80f2b, 0x00f80f2b,
+    0x0000f016, 0x0000f016, 0x0000f016, 0x0000f016, 0x0000f016, 0x0000f016, 0x0000f016, 0x0000f016,
+    0x0000f016, 0x0000f016, 0x0000f016, 0x0000f016, 0x0000f016, 0x0000f016, 0x0000f016, 0x0000f016,
+    0x0008f02c, 0x00f7f02c, 0x0009f02c, 0x00f6f02c, 0x000af02c, 0x00f5f02c, 0x000bf02c, 0x00f4f02c,
+    0x000cf02c, 0x00f3f02c, 0x000df02c, 0x00f2f02c, 0x000ef02c, 0x00f1f02c, 0x000ff02c, 0x00f0f02c,
+    0x0000f02b, 0x0000f02b, 0x00fff02b, 0x00fff02b, 0x0001f02b, 0x0001f02b, 0x00fef02b, 0x00fef02b,
+    0x0002f02b, 0x0002f02b, 0x00fdf02b, 0x00fdf02b, 0x0003f02b, 0x0003f02b, 0x00fcf02b, 0x00fcf02b,
+    0x0004f02b, 0x0004f02b, 0x00fbf02b, 0x00fbf02b, 0x0005f02b, 0x0005f02b, 0x00faf02b, 0x00faf02b,
+    0x0006f02b, 0x0006f02b, 0x00f9f02b, 0x00f9f02b, 0x0007f02b, 0x0007f02b, 0x00f8f02b, 0x00f8f02b,
+    0x00000015, 0x00000015, 0x00000015, 0x00000015, 0x00000015, 0x00000015, 0x00000015, 0x00000015,
+    0x00000015, 0x00000015, 0x00000015, 0x00000015, 0x00000015, 0x00000015, 0x00000015, 0x00000015,
+    0x0010002c, 0x00ef002c, 0x0011002c, 0x00ee002c, 0x0012002c, 0x00ed002c, 0x0013002c, 0x00ec002c,
+    0x0014002c, 0x00eb002c, 0x0015002c, 0x00ea002c, 0x0016002c, 0x00e9002c, 0x0017002c, 0x00e8002c,
+    0x0008002b, 0x0008002b, 0x00f7002b, 0x00f7002b, 0x0009002b, 0x0009002b, 0x00f6002b, 0x00f6002b,
+    0x000a002b, 0x000a002b, 0x00f5002b, 0x00f5002b, 0x000b002b, 0x000b002b, 0x00f4002b, 0x00f4002b,
+    0x000c002b, 0x000c002b, 0x00f3002b, 0x00f3002b, 0x000d002b, 0x000d002b, 0x00f2002b, 0x00f2002b,
+    0x000e002b, 0x000e002b, 0x00f1002b, 0x00f1002b, 0x000f002b, 0x000f002b, 0x00f0002b, 0x00f0002b,
+    0x0000002a, 0x0000002a, 0x0000002a, 0x0000002a, 0x00ff002a, 0x00ff002a, 0x00ff002a, 0x00ff002a,
+    0x0001002a, 0x0001002a, 0x0001002a, 0x0001002a, 0x00fe002a, 0x00fe002a, 0x00fe002a, 0x00fe002a,
+    0x0002002a, 0x0002002a, 0x0002002a, 0x0002002a, 0x00fd002a, 0x00fd002a, 0x00fd002a, 0x00fd002a,
+    0x0003002a, 0x0003002a, 0x0003002a, 0x0003002a, 0x00fc002a, 0x00fc002a, 0x00fc002a, 0x00fc002a,
+    0x0004002a, 0x0004002a, 0x0004002a, 0x0004002a, 0x00fb002a, 0x00fb002a, 0x00fb002a, 0x00fb002a,
+    0x0005002a, 0x0005002a, 0x0005002a, 0x0005002a, 0x00fa002a, 0x00fa002a, 0x00fa002a, 0x00fa002a,
+    0x0006002a, 0x0006002a, 0x0006002a, 0x0006002a, 0x00f9002a, 0x00f9002a, 0x00f9002a, 0x00f9002a,
+    0x0007002a, 0x0007002a, 0x0007002a, 0x0007002a, 0x00f8002a, 0x00f8002a, 0x00f8002a, 0x00f8002a,
+    0x0000ff15, 0x0000ff15, 0x0000ff15, 0x0000ff15, 0x0000ff15, 0x0000ff15, 0x0000ff15, 0x0000ff15,
+    0x0000ff15, 0x0000ff15, 0x0000ff15, 0x0000ff15, 0x0000ff15, 0x0000ff15, 0x0000ff15, 0x0000ff15,
+    0x0010ff2c, 0x00efff2c, 0x0011ff2c, 0x00eeff2c, 0x0012ff2c, 0x00edff2c, 0x0013ff2c, 0x00ecff2c,
+    0x0014ff2c, 0x00ebff2c, 0x0015ff2c, 0x00eaff2c, 0x0016ff2c, 0x00e9ff2c, 0x0017ff2c, 0x00e8ff2c,
+    0x0008ff2b, 0x0008ff2b, 0x00f7ff2b, 0x00f7ff2b, 0x0009ff2b, 0x0009ff2b, 0x00f6ff2b, 0x00f6ff2b,
+    0x000aff2b, 0x000aff2b, 0x00f5ff2b, 0x00f5ff2b, 0x000bff2b, 0x000bff2b, 0x00f4ff2b, 0x00f4ff2b,
+    0x000cff2b, 0x000cff2b, 0x00f3ff2b, 0x00f3ff2b, 0x000dff2b, 0x000dff2b, 0x00f2ff2b, 0x00f2ff2b,
+    0x000eff2b, 0x000eff2b, 0x00f1ff2b, 0x00f1ff2b, 0x000fff2b, 0x000fff2b, 0x00f0ff2b, 0x00f0ff2b,
+    0x0000ff2a, 0x0000ff2a, 0x0000ff2a, 0x0000ff2a, 0x00ffff2a, 0x00ffff2a, 0x00ffff2a, 0x00ffff2a,
+    0x0001ff2a, 0x0001ff2a, 0x0001ff2a, 0x0001ff2a, 0x00feff2a, 0x00feff2a, 0x00feff2a, 0x00feff2a,
+    0x0002ff2a, 0x0002ff2a, 0x0002ff2a, 0x0002ff2a, 0x00fdff2a, 0x00fdff2a, 0x00fdff2a, 0x00fdff2a,
+    0x0003ff2a, 0x0003ff2a, 0x0003ff2a, 0x0003ff2a, 0x00fcff2a, 0x00fcff2a, 0x00fcff2a, 0x00fcff2a,
+    0x0004ff2a, 0x0004ff2a, 0x0004ff2a, 0x0004ff2a, 0x00fbff2a, 0x00fbff2a, 0x00fbff2a, 0x00fbff2a,
+    0x0005ff2a, 0x0005ff2a, 0x0005ff2a, 0x0005ff2a, 0x00faff2a, 0x00faff2a, 0x00faff2a, 0x00faff2a,
+    0x0006ff2a, 0x0006ff2a, 0x0006ff2a, 0x0006ff2a, 0x00f9ff2a, 0x00f9ff2a, 0x00f9ff2a, 0x00f9ff2a,
+    0x0007ff2a, 0x0007ff2a, 0x0007ff2a, 0x0007ff2a, 0x00f8ff2a, 0x00f8ff2a, 0x00f8ff2a, 0x00f8ff2a,
+    0x00000115, 0x00000115, 0x00000115, 0x00000115, 0x00000115, 0x00000115, 0x00000115, 0x00000115,
+    0x00000115, 0x00000115, 0x00000115, 0x00000115, 0x00000115, 0x00000115, 0x00000115, 0x00000115,
+    0x0010012c, 0x00ef012c, 0x0011012c, 0x00ee012c, 0x0012012c, 0x00ed012c, 0x0013012c, 0x00ec012c,
+    0x0014012c, 0x00eb012c, 0x0015012c, 0x00ea012c, 0x0016012c, 0x00e9012c, 0x0017012c, 0x00e8012c,
+    0x0008012b, 0x0008012b, 0x00f7012b, 0x00f7012b, 0x0009012b, 0x0009012b, 0x00f6012b, 0x00f6012b,
+    0x000a012b, 0x000a012b, 0x00f5012b, 0x00f5012b, 0x000b012b, 0x000b012b, 0x00f4012b, 0x00f4012b,
+    0x000c012b, 0x000c012b, 0x00f3012b, 0x00f3012b, 0x000d012b, 0x000d012b, 0x00f2012b, 0x00f2012b,
+    0x000e012b, 0x000e012b, 0x00f1012b, 0x00f1012b, 0x000f012b, 0x000f012b, 0x00f0012b, 0x00f0012b,
+    0x0000012a, 0x0000012a, 0x0000012a, 0x0000012a, 0x00ff012a, 0x00ff012a, 0x00ff012a, 0x00ff012a,
+    0x0001012a, 0x0001012a, 0x0001012a, 0x0001012a, 0x00fe012a, 0x00fe012a, 0x00fe012a, 0x00fe012a,
+    0x0002012a, 0x0002012a, 0x0002012a, 0x0002012a, 0x00fd012a, 0x00fd012a, 0x00fd012a, 0x00fd012a,
+    0x0003012a, 0x0003012a, 0x0003012a, 0x0003012a, 0x00fc012a, 0x00fc012a, 0x00fc012a, 0x00fc012a,
+    0x0004012a, 0x0004012a, 0x0004012a, 0x0004012a, 0x00fb012a, 0x00fb012a, 0x00fb012a, 0x00fb012a,
+    0x0005012a, 0x0005012a, 0x0005012a, 0x0005012a, 0x00fa012a, 0x00fa012a, 0x00fa012a, 0x00fa012a,
+    0x0006012a, 0x0006012a, 0x0006012a, 0x0006012a, 0x00f9012a, 0x00f9012a, 0x00f9012a, 0x00f9012a,
+    0x0007012a, 0x0007012a, 0x0007012a, 0x0007012a, 0x00f8012a, 0x00f8012a, 0x00f8012a, 0x00f8012a,
+    0x0000fe15, 0x0000fe15, 0x0000fe15, 0x0000fe15, 0x0000fe15, 0x0000fe15, 0x0000fe15, 0x0000fe15,
+    0x0000fe15, 0x0000fe15, 0x0000fe15, 0x0000fe15, 0x0000fe15, 0x0000fe15, 0x0000fe15, 0x0000fe15,
+    0x0010fe2c, 0x00effe2c, 0x0011fe2c, 0x00eefe2c, 0x0012fe2c, 0x00edfe2c, 0x0013fe2c, 0x00ecfe2c,
+    0x0014fe2c, 0x00ebfe2c, 0x0015fe2c, 0x00eafe2c, 0x0016fe2c, 0x00e9fe2c, 0x0017fe2c, 0x00e8fe2c,
+    0x0008fe2b, 0x0008fe2b, 0x00f7fe2b, 0x00f7fe2b, 0x0009fe2b, 0x0009fe2b, 0x00f6fe2b, 0x00f6fe2b,
+    0x000afe2b, 0x000afe2b, 0x00f5fe2b, 0x00f5fe2b, 0x000bfe2b, 0x000bfe2b, 0x00f4fe2b, 0x00f4fe2b,
+    0x000cfe2b, 0x000cfe2b, 0x00f3fe2b, 0x00f3fe2b, 0x000dfe2b, 0x000dfe2b, 0x00f2fe2b, 0x00f2fe2b,
+    0x000efe2b, 0x000efe2b, 0x00f1fe2b, 0x00f1fe2b, 0x000ffe2b, 0x000ffe2b, 0x00f0fe2b, 0x00f0fe2b,
+    0x0000fe2a, 0x0000fe2a, 0x0000fe2a, 0x0000fe2a, 0x00fffe2a, 0x00fffe2a, 0x00fffe2a, 0x00fffe2a,
+    0x0001fe2a, 0x0001fe2a, 0x0001fe2a, 0x0001fe2a, 0x00fefe2a, 0x00fefe2a, 0x00fefe2a, 0x00fefe2a,
+    0x0002fe2a, 0x0002fe2a, 0x0002fe2a, 0x0002fe2a, 0x00fdfe2a, 0x00fdfe2a, 0x00fdfe2a, 0x00fdfe2a,
+    0x0003fe2a, 0x0003fe2a, 0x0003fe2a, 0x0003fe2a, 0x00fcfe2a, 0x00fcfe2a, 0x00fcfe2a, 0x00fcfe2a,
+    0x0004fe2a, 0x0004fe2a, 0x0004fe2a, 0x0004fe2a, 0x00fbfe2a, 0x00fbfe2a, 0x00fbfe2a, 0x00fbfe2a,
+    0x0005fe2a, 0x0005fe2a, 0x0005fe2a, 0x0005fe2a, 0x00fafe2a, 0x00fafe2a, 0x00fafe2a, 0x00fafe2a,
+    0x0006fe2a, 0x0006fe2a, 0x0006fe2a, 0x0006fe2a, 0x00f9fe2a, 0x00f9fe2a, 0x00f9fe2a, 0x00f9fe2a,
+    0x0007fe2a, 0x0007fe2a, 0x0007fe2a, 0x0007fe2a, 0x00f8fe2a, 0x00f8fe2a, 0x00f8fe2a, 0x00f8fe2a,
+    0x00000215, 0x00000215, 0x00000215, 0x00000215, 0x00000215, 0x00000215, 0x00000215, 0x00000215,
+    0x00000215, 0x00000215, 0x00000215, 0x00000215, 0x00000215, 0x00000215, 0x00000215, 0x00000215,
+    0x0010022c, 0x00ef022c, 0x0011022c, 0x00ee022c, 0x0012022c, 0x00ed022c, 0x0013022c, 0x00ec022c,
+    0x0014022c, 0x00eb022c, 0x0015022c, 0x00ea022c, 0x0016022c, 0x00e9022c, 0x0017022c, 0x00e8022c,
+    0x0008022b, 0x0008022b, 0x00f7022b, 0x00f7022b, 0x0009022b, 0x0009022b, 0x00f6022b, 0x00f6022b,
+    0x000a022b, 0x000a022b, 0x00f5022b, 0x00f5022b, 0x000b022b, 0x000b022b, 0x00f4022b, 0x00f4022b,
+    0x000c022b, 0x000c022b, 0x00f3022b, 0x00f3022b, 0x000d022b, 0x000d022b, 0x00f2022b, 0x00f2022b,
+    0x000e022b, 0x000e022b, 0x00f1022b, 0x00f1022b, 0x000f022b, 0x000f022b, 0x00f0022b, 0x00f0022b,
+    0x0000022a, 0x0000022a, 0x0000022a, 0x0000022a, 0x00ff022a, 0x00ff022a, 0x00ff022a, 0x00ff022a,
+    0x0001022a, 0x0001022a, 0x0001022a, 0x0001022a, 0x00fe022a, 0x00fe022a, 0x00fe022a, 0x00fe022a,
+    0x0002022a, 0x0002022a, 0x0002022a, 0x0002022a, 0x00fd022a, 0x00fd022a, 0x00fd022a, 0x00fd022a,
+    0x0003022a, 0x0003022a, 0x0003022a, 0x0003022a, 0x00fc022a, 0x00fc022a, 0x00fc022a, 0x00fc022a,
+    0x0004022a, 0x0004022a, 0x0004022a, 0x0004022a, 0x00fb022a, 0x00fb022a, 0x00fb022a, 0x00fb022a,
+    0x0005022a, 0x0005022a, 0x0005022a, 0x0005022a, 0x00fa022a, 0x00fa022a, 0x00fa022a, 0x00fa022a,
+    0x0006022a, 0x0006022a, 0x0006022a, 0x0006022a, 0x00f9022a, 0x00f9022a, 0x00f9022a, 0x00f9022a,
+    0x0007022a, 0x0007022a, 0x0007022a, 0x0007022a, 0x00f8022a, 0x00f8022a, 0x00f8022a, 0x00f8022a,
+    0x0000fd15, 0x0000fd15, 0x0000fd15, 0x0000fd15, 0x0000fd15, 0x0000fd15, 0x0000fd15, 0x0000fd15,
+    0x0000fd15, 0x0000fd15, 0x0000fd15, 0x0000fd15, 0x0000fd15, 0x0000fd15, 0x0000fd15, 0x0000fd15,
+    0x0010fd2c, 0x00effd2c, 0x0011fd2c, 0x00eefd2c, 0x0012fd2c, 0x00edfd2c, 0x0013fd2c, 0x00ecfd2c,
+    0x0014fd2c, 0x00ebfd2c, 0x0015fd2c, 0x00eafd2c, 0x0016fd2c, 0x00e9fd2c, 0x0017fd2c, 0x00e8fd2c,
+    0x0008fd2b, 0x0008fd2b, 0x00f7fd2b, 0x00f7fd2b, 0x0009fd2b, 0x0009fd2b, 0x00f6fd2b, 0x00f6fd2b,
+    0x000afd2b, 0x000afd2b, 0x00f5fd2b, 0x00f5fd2b, 0x000bfd2b, 0x000bfd2b, 0x00f4fd2b, 0x00f4fd2b,
+    0x000cfd2b, 0x000cfd2b, 0x00f3fd2b, 0x00f3fd2b, 0x000dfd2b, 0x000dfd2b, 0x00f2fd2b, 0x00f2fd2b,
+    0x000efd2b, 0x000efd2b, 0x00f1fd2b, 0x00f1fd2b, 0x000ffd2b, 0x000ffd2b, 0x00f0fd2b, 0x00f0fd2b,
+    0x0000fd2a, 0x0000fd2a, 0x0000fd2a, 0x0000fd2a, 0x00fffd2a, 0x00fffd2a, 0x00fffd2a, 0x00fffd2a,
+    0x0001fd2a, 0x0001fd2a, 0x0001fd2a, 0x0001fd2a, 0x00fefd2a, 0x00fefd2a, 0x00fefd2a, 0x00fefd2a,
+    0x0002fd2a, 0x0002fd2a, 0x0002fd2a, 0x0002fd2a, 0x00fdfd2a, 0x00fdfd2a, 0x00fdfd2a, 0x00fdfd2a,
+    0x0003fd2a, 0x0003fd2a, 0x0003fd2a, 0x0003fd2a, 0x00fcfd2a, 0x00fcfd2a, 0x00fcfd2a, 0x00fcfd2a,
+    0x0004fd2a, 0x0004fd2a, 0x0004fd2a, 0x0004fd2a, 0x00fbfd2a, 0x00fbfd2a, 0x00fbfd2a, 0x00fbfd2a,
+    0x0005fd2a, 0x0005fd2a, 0x0005fd2a, 0x0005fd2a, 0x00fafd2a, 0x00fafd2a, 0x00fafd2a, 0x00fafd2a,
+    0x0006fd2a, 0x0006fd2a, 0x0006fd2a, 0x0006fd2a, 0x00f9fd2a, 0x00f9fd2a, 0x00f9fd2a, 0x00f9fd2a,
+    0x0007fd2a, 0x0007fd2a, 0x0007fd2a, 0x0007fd2a, 0x00f8fd2a, 0x00f8fd2a, 0x00f8fd2a, 0x00f8fd2a,
+    0x00000315, 0x00000315, 0x00000315, 0x00000315, 0x00000315, 0x00000315, 0x00000315, 0x00000315,
+    0x00000315, 0x00000315, 0x00000315, 0x00000315, 0x00000315, 0x00000315, 0x00000315, 0x00000315,
+    0x0010032c, 0x00ef032c, 0x0011032c, 0x00ee032c, 0x0012032c, 0x00ed032c, 0x0013032c, 0x00ec032c,
+    0x0014032c, 0x00eb032c, 0x0015032c, 0x00ea032c, 0x0016032c, 0x00e9032c, 0x0017032c, 0x00e8032c,
+    0x0008032b, 0x0008032b, 0x00f7032b, 0x00f7032b, 0x0009032b, 0x0009032b, 0x00f6032b, 0x00f6032b,
+    0x000a032b, 0x000a032b, 0x00f5032b, 0x00f5032b, 0x000b032b, 0x000b032b, 0x00f4032b, 0x00f4032b,
+    0x000c032b, 0x000c032b, 0x00f3032b, 0x00f3032b, 0x000d032b, 0x000d032b, 0x00f2032b, 0x00f2032b,
+    0x000e032b, 0x000e032b, 0x00f1032b, 0x00f1032b, 0x000f032b, 0x000f032b, 0x00f0032b, 0x00f0032b,
+    0x0000032a, 0x0000032a, 0x0000032a, 0x0000032a, 0x00ff032a, 0x00ff032a, 0x00ff032a, 0x00ff032a,
+    0x0001032a, 0x0001032a, 0x0001032a, 0x0001032a, 0x00fe032a, 0x00fe032a, 0x00fe032a, 0x00fe032a,
+    0x0002032a, 0x0002032a, 0x0002032a, 0x0002032a, 0x00fd032a, 0x00fd032a, 0x00fd032a, 0x00fd032a,
+    0x0003032a, 0x0003032a, 0x0003032a, 0x0003032a, 0x00fc032a, 0x00fc032a, 0x00fc032a, 0x00fc032a,
+    0x0004032a, 0x0004032a, 0x0004032a, 0x0004032a, 0x00fb032a, 0x00fb032a, 0x00fb032a, 0x00fb032a,
+    0x0005032a, 0x0005032a, 0x0005032a, 0x0005032a, 0x00fa032a, 0x00fa032a, 0x00fa032a, 0x00fa032a,
+    0x0006032a, 0x0006032a, 0x0006032a, 0x0006032a, 0x00f9032a, 0x00f9032a, 0x00f9032a, 0x00f9032a,
+    0x0007032a, 0x0007032a, 0x0007032a, 0x0007032a, 0x00f8032a, 0x00f8032a, 0x00f8032a, 0x00f8032a,
+    0x0000fc15, 0x0000fc15, 0x0000fc15, 0x0000fc15, 0x0000fc15, 0x0000fc15, 0x0000fc15, 0x0000fc15,
+    0x0000fc15, 0x0000fc15, 0x0000fc15, 0x0000fc15, 0x0000fc15, 0x0000fc15, 0x0000fc15, 0x0000fc15,
+    0x0010fc2c, 0x00effc2c, 0x0011fc2c, 0x00eefc2c, 0x0012fc2c, 0x00edfc2c, 0x0013fc2c, 0x00ecfc2c,
+    0x0014fc2c, 0x00ebfc2c, 0x0015fc2c, 0x00eafc2c, 0x0016fc2c, 0x00e9fc2c, 0x0017fc2c, 0x00e8fc2c,
+    0x0008fc2b, 0x0008fc2b, 0x00f7fc2b, 0x00f7fc2b, 0x0009fc2b, 0x0009fc2b, 0x00f6fc2b, 0x00f6fc2b,
+    0x000afc2b, 0x000afc2b, 0x00f5fc2b, 0x00f5fc2b, 0x000bfc2b, 0x000bfc2b, 0x00f4fc2b, 0x00f4fc2b,
+    0x000cfc2b, 0x000cfc2b, 0x00f3fc2b, 0x00f3fc2b, 0x000dfc2b, 0x000dfc2b, 0x00f2fc2b, 0x00f2fc2b,
+    0x000efc2b, 0x000efc2b, 0x00f1fc2b, 0x00f1fc2b, 0x000ffc2b, 0x000ffc2b, 0x00f0fc2b, 0x00f0fc2b,
+    0x0000fc2a, 0x0000fc2a, 0x0000fc2a, 0x0000fc2a, 0x00fffc2a, 0x00fffc2a, 0x00fffc2a, 0x00fffc2a,
+    0x0001fc2a, 0x0001fc2a, 0x0001fc2a, 0x0001fc2a, 0x00fefc2a, 0x00fefc2a, 0x00fefc2a, 0x00fefc2a,
+    0x0002fc2a, 0x0002fc2a, 0x0002fc2a, 0x0002fc2a, 0x00fdfc2a, 0x00fdfc2a, 0x00fdfc2a, 0x00fdfc2a,
+    0x0003fc2a, 0x0003fc2a, 0x0003fc2a, 0x0003fc2a, 0x00fcfc2a, 0x00fcfc2a, 0x00fcfc2a, 0x00fcfc2a,
+    0x0004fc2a, 0x0004fc2a, 0x0004fc2a, 0x0004fc2a, 0x00fbfc2a, 0x00fbfc2a, 0x00fbfc2a, 0x00fbfc2a,
+    0x0005fc2a, 0x0005fc2a, 0x0005fc2a, 0x0005fc2a, 0x00fafc2a, 0x00fafc2a, 0x00fafc2a, 0x00fafc2a,
+    0x0006fc2a, 0x0006fc2a, 0x0006fc2a, 0x0006fc2a, 0x00f9fc2a, 0x00f9fc2a, 0x00f9fc2a, 0x00f9fc2a,
+    0x0007fc2a, 0x0007fc2a, 0x0007fc2a, 0x0007fc2a, 0x00f8fc2a, 0x00f8fc2a, 0x00f8fc2a, 0x00f8fc2a,
+    0x00000415, 0x00000415, 0x00000415, 0x00000415, 0x00000415, 0x00000415, 0x00000415, 0x00000415,
+    0x00000415, 0x00000415, 0x00000415, 0x00000415, 0x00000415, 0x00000415, 0x00000415, 0x00000415,
+    0x0010042c, 0x00ef042c, 0x0011042c, 0x00ee042c, 0x0012042c, 0x00ed042c, 0x0013042c, 0x00ec042c,
+    0x0014042c, 0x00eb042c, 0x0015042c, 0x00ea042c, 0x0016042c, 0x00e9042c, 0x0017042c, 0x00e8042c,
+    0x0008042b, 0x0008042b, 0x00f7042b, 0x00f7042b, 0x0009042b, 0x0009042b, 0x00f6042b, 0x00f6042b,
+    0x000a042b, 0x000a042b, 0x00f5042b, 0x00f5042b, 0x000b042b, 0x000b042b, 0x00f4042b, 0x00f4042b,
+    0x000c042b, 0x000c042b, 0x00f3042b, 0x00f3042b, 0x000d042b, 0x000d042b, 0x00f2042b, 0x00f2042b,
+    0x000e042b, 0x000e042b, 0x00f1042b, 0x00f1042b, 0x000f042b, 0x000f042b, 0x00f0042b, 0x00f0042b,
+    0x0000042a, 0x0000042a, 0x0000042a, 0x0000042a, 0x00ff042a, 0x00ff042a, 0x00ff042a, 0x00ff042a,
+    0x0001042a, 0x0001042a, 0x0001042a, 0x0001042a, 0x00fe042a, 0x00fe042a, 0x00fe042a, 0x00fe042a,
+    0x0002042a, 0x0002042a, 0x0002042a, 0x0002042a, 0x00fd042a, 0x00fd042a, 0x00fd042a, 0x00fd042a,
+    0x0003042a, 0x0003042a, 0x0003042a, 0x0003042a, 0x00fc042a, 0x00fc042a, 0x00fc042a, 0x00fc042a,
+    0x0004042a, 0x0004042a, 0x0004042a, 0x0004042a, 0x00fb042a, 0x00fb042a, 0x00fb042a, 0x00fb042a,
+    0x0005042a, 0x0005042a, 0x0005042a, 0x0005042a, 0x00fa042a, 0x00fa042a, 0x00fa042a, 0x00fa042a,
+    0x0006042a, 0x0006042a, 0x0006042a, 0x0006042a, 0x00f9042a, 0x00f9042a, 0x00f9042a, 0x00f9042a,
+    0x0007042a, 0x0007042a, 0x0007042a, 0x0007042a, 0x00f8042a, 0x00f8042a, 0x00f8042a, 0x00f8042a,
+    0x0000fb15, 0x0000fb15, 0x0000fb15, 0x0000fb15, 0x0000fb15, 0x0000fb15, 0x0000fb15, 0x0000fb15,
+    0x0000fb15, 0x0000fb15, 0x0000fb15, 0x0000fb15, 0x0000fb15, 0x0000fb15, 0x0000fb15, 0x0000fb15,
+    0x0010fb2c, 0x00effb2c, 0x0011fb2c, 0x00eefb2c, 0x0012fb2c, 0x00edfb2c, 0x0013fb2c, 0x00ecfb2c,
+    0x0014fb2c, 0x00ebfb2c, 0x0015fb2c, 0x00eafb2c, 0x0016fb2c, 0x00e9fb2c, 0x0017fb2c, 0x00e8fb2c,
+    0x0008fb2b, 0x0008fb2b, 0x00f7fb2b, 0x00f7fb2b, 0x0009fb2b, 0x0009fb2b, 0x00f6fb2b, 0x00f6fb2b,
+    0x000afb2b, 0x000afb2b, 0x00f5fb2b, 0x00f5fb2b, 0x000bfb2b, 0x000bfb2b, 0x00f4fb2b, 0x00f4fb2b,
+    0x000cfb2b, 0x000cfb2b, 0x00f3fb2b, 0x00f3fb2b, 0x000dfb2b, 0x000dfb2b, 0x00f2fb2b, 0x00f2fb2b,
+    0x000efb2b, 0x000efb2b, 0x00f1fb2b, 0x00f1fb2b, 0x000ffb2b, 0x000ffb2b, 0x00f0fb2b, 0x00f0fb2b,
+    0x0000fb2a, 0x0000fb2a, 0x0000fb2a, 0x0000fb2a, 0x00fffb2a, 0x00fffb2a, 0x00fffb2a, 0x00fffb2a,
+    0x0001fb2a, 0x0001fb2a, 0x0001fb2a, 0x0001fb2a, 0x00fefb2a, 0x00fefb2a, 0x00fefb2a, 0x00fefb2a,
+    0x0002fb2a, 0x0002fb2a, 0x0002fb2a, 0x0002fb2a, 0x00fdfb2a, 0x00fdfb2a, 0x00fdfb2a, 0x00fdfb2a,
+    0x0003fb2a, 0x0003fb2a, 0x0003fb2a, 0x0003fb2a, 0x00fcfb2a, 0x00fcfb2a, 0x00fcfb2a, 0x00fcfb2a,
+    0x0004fb2a, 0x0004fb2a, 0x0004fb2a, 0x0004fb2a, 0x00fbfb2a, 0x00fbfb2a, 0x00fbfb2a, 0x00fbfb2a,
+    0x0005fb2a, 0x0005fb2a, 0x0005fb2a, 0x0005fb2a, 0x00fafb2a, 0x00fafb2a, 0x00fafb2a, 0x00fafb2a,
+    0x0006fb2a, 0x0006fb2a, 0x0006fb2a, 0x0006fb2a, 0x00f9fb2a, 0x00f9fb2a, 0x00f9fb2a, 0x00f9fb2a,
+    0x0007fb2a, 0x0007fb2a, 0x0007fb2a, 0x0007fb2a, 0x00f8fb2a, 0x00f8fb2a, 0x00f8fb2a, 0x00f8fb2a,
+    0x00000515, 0x00000515, 0x00000515, 0x00000515, 0x00000515, 0x00000515, 0x00000515, 0x00000515,
+    0x00000515, 0x00000515, 0x00000515, 0x00000515, 0x00000515, 0x00000515, 0x00000515, 0x00000515,
+    0x0010052c, 0x00ef052c, 0x0011052c, 0x00ee052c, 0x0012052c, 0x00ed052c, 0x0013052c, 0x00ec052c,
+    0x0014052c, 0x00eb052c, 0x0015052c, 0x00ea052c, 0x0016052c, 0x00e9052c, 0x0017052c, 0x00e8052c,
+    0x0008052b, 0x0008052b, 0x00f7052b, 0x00f7052b, 0x0009052b, 0x0009052b, 0x00f6052b, 0x00f6052b,
+    0x000a052b, 0x000a052b, 0x00f5052b, 0x00f5052b, 0x000b052b, 0x000b052b, 0x00f4052b, 0x00f4052b,
+    0x000c052b, 0x000c052b, 0x00f3052b, 0x00f3052b, 0x000d052b, 0x000d052b, 0x00f2052b, 0x00f2052b,
+    0x000e052b, 0x000e052b, 0x00f1052b, 0x00f1052b, 0x000f052b, 0x000f052b, 0x00f0052b, 0x00f0052b,
+    0x0000052a, 0x0000052a, 0x0000052a, 0x0000052a, 0x00ff052a, 0x00ff052a, 0x00ff052a, 0x00ff052a,
+    0x0001052a, 0x0001052a, 0x0001052a, 0x0001052a, 0x00fe052a, 0x00fe052a, 0x00fe052a, 0x00fe052a,
+    0x0002052a, 0x0002052a, 0x0002052a, 0x0002052a, 0x00fd052a, 0x00fd052a, 0x00fd052a, 0x00fd052a,
+    0x0003052a, 0x0003052a, 0x0003052a, 0x0003052a, 0x00fc052a, 0x00fc052a, 0x00fc052a, 0x00fc052a,
+    0x0004052a, 0x0004052a, 0x0004052a, 0x0004052a, 0x00fb052a, 0x00fb052a, 0x00fb052a, 0x00fb052a,
+    0x0005052a, 0x0005052a, 0x0005052a, 0x0005052a, 0x00fa052a, 0x00fa052a, 0x00fa052a, 0x00fa052a,
+    0x0006052a, 0x0006052a, 0x0006052a, 0x0006052a, 0x00f9052a, 0x00f9052a, 0x00f9052a, 0x00f9052a,
+    0x0007052a, 0x0007052a, 0x0007052a, 0x0007052a, 0x00f8052a, 0x00f8052a, 0x00f8052a, 0x00f8052a,
+    0x0000fa15, 0x0000fa15, 0x0000fa15, 0x0000fa15, 0x0000fa15, 0x0000fa15, 0x0000fa15, 0x0000fa15,
+    0x0000fa15, 0x0000fa15, 0x0000fa15, 0x0000fa15, 0x0000fa15, 0x0000fa15, 0x0000fa15, 0x0000fa15,
+    0x0010fa2c, 0x00effa2c, 0x0011fa2c, 0x00eefa2c, 0x0012fa2c, 0x00edfa2c, 0x0013fa2c, 0x00ecfa2c,
+    0x0014fa2c, 0x00ebfa2c, 0x0015fa2c, 0x00eafa2c, 0x0016fa2c, 0x00e9fa2c, 0x0017fa2c, 0x00e8fa2c,
+    0x0008fa2b, 0x0008fa2b, 0x00f7fa2b, 0x00f7fa2b, 0x0009fa2b, 0x0009fa2b, 0x00f6fa2b, 0x00f6fa2b,
+    0x000afa2b, 0x000afa2b, 0x00f5fa2b, 0x00f5fa2b, 0x000bfa2b, 0x000bfa2b, 0x00f4fa2b, 0x00f4fa2b,
+    0x000cfa2b, 0x000cfa2b, 0x00f3fa2b, 0x00f3fa2b, 0x000dfa2b, 0x000dfa2b, 0x00f2fa2b, 0x00f2fa2b,
+    0x000efa2b, 0x000efa2b, 0x00f1fa2b, 0x00f1fa2b, 0x000ffa2b, 0x000ffa2b, 0x00f0fa2b, 0x00f0fa2b,
+    0x0000fa2a, 0x0000fa2a, 0x0000fa2a, 0x0000fa2a, 0x00fffa2a, 0x00fffa2a, 0x00fffa2a, 0x00fffa2a,
+    0x0001fa2a, 0x0001fa2a, 0x0001fa2a, 0x0001fa2a, 0x00fefa2a, 0x00fefa2a, 0x00fefa2a, 0x00fefa2a,
+    0x0002fa2a, 0x0002fa2a, 0x0002fa2a, 0x0002fa2a, 0x00fdfa2a, 0x00fdfa2a, 0x00fdfa2a, 0x00fdfa2a,
+    0x0003fa2a, 0x0003fa2a, 0x0003fa2a, 0x0003fa2a, 0x00fcfa2a, 0x00fcfa2a, 0x00fcfa2a, 0x00fcfa2a,
+    0x0004fa2a, 0x0004fa2a, 0x0004fa2a, 0x0004fa2a, 0x00fbfa2a, 0x00fbfa2a, 0x00fbfa2a, 0x00fbfa2a,
+    0x0005fa2a, 0x0005fa2a, 0x0005fa2a, 0x0005fa2a, 0x00fafa2a, 0x00fafa2a, 0x00fafa2a, 0x00fafa2a,
+    0x0006fa2a, 0x0006fa2a, 0x0006fa2a, 0x0006fa2a, 0x00f9fa2a, 0x00f9fa2a, 0x00f9fa2a, 0x00f9fa2a,
+    0x0007fa2a, 0x0007fa2a, 0x0007fa2a, 0x0007fa2a, 0x00f8fa2a, 0x00f8fa2a, 0x00f8fa2a, 0x00f8fa2a,
+    0x00000615, 0x00000615, 0x00000615, 0x00000615, 0x00000615, 0x00000615, 0x00000615, 0x00000615,
+    0x00000615, 0x00000615, 0x00000615, 0x00000615, 0x00000615, 0x00000615, 0x00000615, 0x00000615,
+    0x0010062c, 0x00ef062c, 0x0011062c, 0x00ee062c, 0x0012062c, 0x00ed062c, 0x0013062c, 0x00ec062c,
+    0x0014062c, 0x00eb062c, 0x0015062c, 0x00ea062c, 0x0016062c, 0x00e9062c, 0x0017062c, 0x00e8062c,
+    0x0008062b, 0x0008062b, 0x00f7062b, 0x00f7062b, 0x0009062b, 0x0009062b, 0x00f6062b, 0x00f6062b,
+    0x000a062b, 0x000a062b, 0x00f5062b, 0x00f5062b, 0x000b062b, 0x000b062b, 0x00f4062b, 0x00f4062b,
+    0x000c062b, 0x000c062b, 0x00f3062b, 0x00f3062b, 0x000d062b, 0x000d062b, 0x00f2062b, 0x00f2062b,
+    0x000e062b, 0x000e062b, 0x00f1062b, 0x00f1062b, 0x000f062b, 0x000f062b, 0x00f0062b, 0x00f0062b,
+    0x0000062a, 0x0000062a, 0x0000062a, 0x0000062a, 0x00ff062a, 0x00ff062a, 0x00ff062a, 0x00ff062a,
+    0x0001062a, 0x0001062a, 0x0001062a, 0x0001062a, 0x00fe062a, 0x00fe062a, 0x00fe062a, 0x00fe062a,
+    0x0002062a, 0x0002062a, 0x0002062a, 0x0002062a, 0x00fd062a, 0x00fd062a, 0x00fd062a, 0x00fd062a,
+    0x0003062a, 0x0003062a, 0x0003062a, 0x0003062a, 0x00fc062a, 0x00fc062a, 0x00fc062a, 0x00fc062a,
+    0x0004062a, 0x0004062a, 0x0004062a, 0x0004062a, 0x00fb062a, 0x00fb062a, 0x00fb062a, 0x00fb062a,
+    0x0005062a, 0x0005062a, 0x0005062a, 0x0005062a, 0x00fa062a, 0x00fa062a, 0x00fa062a, 0x00fa062a,
+    0x0006062a, 0x0006062a, 0x0006062a, 0x0006062a, 0x00f9062a, 0x00f9062a, 0x00f9062a, 0x00f9062a,
+    0x0007062a, 0x0007062a, 0x0007062a, 0x0007062a, 0x00f8062a, 0x00f8062a, 0x00f8062a, 0x00f8062a,
+    0x0000f915, 0x0000f915, 0x0000f915, 0x0000f915, 0x0000f915, 0x0000f915, 0x0000f915, 0x0000f915,
+    0x0000f915, 0x0000f915, 0x0000f915, 0x0000f915, 0x0000f915, 0x0000f915, 0x0000f915, 0x0000f915,
+    0x0010f92c, 0x00eff92c, 0x0011f92c, 0x00eef92c, 0x0012f92c, 0x00edf92c, 0x0013f92c, 0x00ecf92c,
+    0x0014f92c, 0x00ebf92c, 0x0015f92c, 0x00eaf92c, 0x0016f92c, 0x00e9f92c, 0x0017f92c, 0x00e8f92c,
+    0x0008f92b, 0x0008f92b, 0x00f7f92b, 0x00f7f92b, 0x0009f92b, 0x0009f92b, 0x00f6f92b, 0x00f6f92b,
+    0x000af92b, 0x000af92b, 0x00f5f92b, 0x00f5f92b, 0x000bf92b, 0x000bf92b, 0x00f4f92b, 0x00f4f92b,
+    0x000cf92b, 0x000cf92b, 0x00f3f92b, 0x00f3f92b, 0x000df92b, 0x000df92b, 0x00f2f92b, 0x00f2f92b,
+    0x000ef92b, 0x000ef92b, 0x00f1f92b, 0x00f1f92b, 0x000ff92b, 0x000ff92b, 0x00f0f92b, 0x00f0f92b,
+    0x0000f92a, 0x0000f92a, 0x0000f92a, 0x0000f92a, 0x00fff92a, 0x00fff92a, 0x00fff92a, 0x00fff92a,
+    0x0001f92a, 0x0001f92a, 0x0001f92a, 0x0001f92a, 0x00fef92a, 0x00fef92a, 0x00fef92a, 0x00fef92a,
+    0x0002f92a, 0x0002f92a, 0x0002f92a, 0x0002f92a, 0x00fdf92a, 0x00fdf92a, 0x00fdf92a, 0x00fdf92a,
+    0x0003f92a, 0x0003f92a, 0x0003f92a, 0x0003f92a, 0x00fcf92a, 0x00fcf92a, 0x00fcf92a, 0x00fcf92a,
+    0x0004f92a, 0x0004f92a, 0x0004f92a, 0x0004f92a, 0x00fbf92a, 0x00fbf92a, 0x00fbf92a, 0x00fbf92a,
+    0x0005f92a, 0x0005f92a, 0x0005f92a, 0x0005f92a, 0x00faf92a, 0x00faf92a, 0x00faf92a, 0x00faf92a,
+    0x0006f92a, 0x0006f92a, 0x0006f92a, 0x0006f92a, 0x00f9f92a, 0x00f9f92a, 0x00f9f92a, 0x00f9f92a,
+    0x0007f92a, 0x0007f92a, 0x0007f92a, 0x0007f92a, 0x00f8f92a, 0x00f8f92a, 0x00f8f92a, 0x00f8f92a,
+    0x00000715, 0x00000715, 0x00000715, 0x00000715, 0x00000715, 0x00000715, 0x00000715, 0x00000715,
+    0x00000715, 0x00000715, 0x00000715, 0x00000715, 0x00000715, 0x00000715, 0x00000715, 0x00000715,
+    0x0010072c, 0x00ef072c, 0x0011072c, 0x00ee072c, 0x0012072c, 0x00ed072c, 0x0013072c, 0x00ec072c,
+    0x0014072c, 0x00eb072c, 0x0015072c, 0x00ea072c, 0x0016072c, 0x00e9072c, 0x0017072c, 0x00e8072c,
+    0x0008072b, 0x0008072b, 0x00f7072b, 0x00f7072b, 0x0009072b, 0x0009072b, 0x00f6072b, 0x00f6072b,
+    0x000a072b, 0x000a072b, 0x00f5072b, 0x00f5072b, 0x000b072b, 0x000b072b, 0x00f4072b, 0x00f4072b,
+    0x000c072b, 0x000c072b, 0x00f3072b, 0x00f3072b, 0x000d072b, 0x000d072b, 0x00f2072b, 0x00f2072b,
+    0x000e072b, 0x000e072b, 0x00f1072b, 0x00f1072b, 0x000f072b, 0x000f072b, 0x00f0072b, 0x00f0072b,
+    0x0000072a, 0x0000072a, 0x0000072a, 0x0000072a, 0x00ff072a, 0x00ff072a, 0x00ff072a, 0x00ff072a,
+    0x0001072a, 0x0001072a, 0x0001072a, 0x0001072a, 0x00fe072a, 0x00fe072a, 0x00fe072a, 0x00fe072a,
+    0x0002072a, 0x0002072a, 0x0002072a, 0x0002072a, 0x00fd072a, 0x00fd072a, 0x00fd072a, 0x00fd072a,
+    0x0003072a, 0x0003072a, 0x0003072a, 0x0003072a, 0x00fc072a, 0x00fc072a, 0x00fc072a, 0x00fc072a,
+    0x0004072a, 0x0004072a, 0x0004072a, 0x0004072a, 0x00fb072a, 0x00fb072a, 0x00fb072a, 0x00fb072a,
+    0x0005072a, 0x0005072a, 0x0005072a, 0x0005072a, 0x00fa072a, 0x00fa072a, 0x00fa072a, 0x00fa072a,
+    0x0006072a, 0x0006072a, 0x0006072a, 0x0006072a, 0x00f9072a, 0x00f9072a, 0x00f9072a, 0x00f9072a,
+    0x0007072a, 0x0007072a, 0x0007072a, 0x0007072a, 0x00f8072a, 0x00f8072a, 0x00f8072a, 0x00f8072a,
+    0x0000f815, 0x0000f815, 0x0000f815, 0x0000f815, 0x0000f815, 0x0000f815, 0x0000f815, 0x0000f815,
+    0x0000f815, 0x0000f815, 0x0000f815, 0x0000f815, 0x0000f815, 0x0000f815, 0x0000f815, 0x0000f815,
+    0x0010f82c, 0x00eff82c, 0x0011f82c, 0x00eef82c, 0x0012f82c, 0x00edf82c, 0x0013f82c, 0x00ecf82c,
+    0x0014f82c, 0x00ebf82c, 0x0015f82c, 0x00eaf82c, 0x0016f82c, 0x00e9f82c, 0x0017f82c, 0x00e8f82c,
+    0x0008f82b, 0x0008f82b, 0x00f7f82b, 0x00f7f82b, 0x0009f82b, 0x0009f82b, 0x00f6f82b, 0x00f6f82b,
+    0x000af82b, 0x000af82b, 0x00f5f82b, 0x00f5f82b, 0x000bf82b, 0x000bf82b, 0x00f4f82b, 0x00f4f82b,
+    0x000cf82b, 0x000cf82b, 0x00f3f82b, 0x00f3f82b, 0x000df82b, 0x000df82b, 0x00f2f82b, 0x00f2f82b,
+    0x000ef82b, 0x000ef82b, 0x00f1f82b, 0x00f1f82b, 0x000ff82b, 0x000ff82b, 0x00f0f82b, 0x00f0f82b,
+    0x0000f82a, 0x0000f82a, 0x0000f82a, 0x0000f82a, 0x00fff82a, 0x00fff82a, 0x00fff82a, 0x00fff82a,
+    0x0001f82a, 0x0001f82a, 0x0001f82a, 0x0001f82a, 0x00fef82a, 0x00fef82a, 0x00fef82a, 0x00fef82a,
+    0x0002f82a, 0x0002f82a, 0x0002f82a, 0x0002f82a, 0x00fdf82a, 0x00fdf82a, 0x00fdf82a, 0x00fdf82a,
+    0x0003f82a, 0x0003f82a, 0x0003f82a, 0x0003f82a, 0x00fcf82a, 0x00fcf82a, 0x00fcf82a, 0x00fcf82a,
+    0x0004f82a, 0x0004f82a, 0x0004f82a, 0x0004f82a, 0x00fbf82a, 0x00fbf82a, 0x00fbf82a, 0x00fbf82a,
+    0x0005f82a, 0x0005f82a, 0x0005f82a, 0x0005f82a, 0x00faf82a, 0x00faf82a, 0x00faf82a, 0x00faf82a,
+    0x0006f82a, 0x0006f82a, 0x0006f82a, 0x0006f82a, 0x00f9f82a, 0x00f9f82a, 0x00f9f82a, 0x00f9f82a,
+    0x0007f82a, 0x0007f82a, 0x0007f82a, 0x0007f82a, 0x00f8f82a, 0x00f8f82a, 0x00f8f82a, 0x00f8f82a,
+  },
+};
+#endif
+
 MINIFLAC_PRIVATE
 void
 miniflac_residual_init(miniflac_residual_t* residual) {
@@ -108,31 +2699,24 @@ miniflac_residual_decode(miniflac_residual_t* residual, miniflac_bitreader_t* br
         /* fall-through */
         case MINIFLAC_RESIDUAL_MSB: {
             miniflac_residual_msb:
-            while(!miniflac_bitreader_fill(br,1)) {
-                if(miniflac_bitreader_read(br,1)) {
+            while(residual->residual < residual->residual_total) {
+                if(miniflac_bitreader_read_unary(br,&residual->msb)) return MINIFLAC_CONTINUE;
+                if(miniflac_bitreader_fill(br,residual->rice_parameter)) {
                     residual->state = MINIFLAC_RESIDUAL_LSB;
-                    goto miniflac_residual_lsb;
+                    return MINIFLAC_CONTINUE;
                 }
-                residual->msb++;
-            }
-            return MINIFLAC_CONTINUE;
-        }
-        case MINIFLAC_RESIDUAL_LSB: {
-            miniflac_residual_lsb:
-            if(miniflac_bitreader_fill(br,residual->rice_parameter)) return MINIFLAC_CONTINUE;
-            temp_32 = (residual->msb << residual->rice_parameter) | ((uint32_t)miniflac_bitreader_read(br,residual->rice_parameter));
-            residual->value = (temp_32 >> 1) ^ -(temp_32 & 1);
 
-            if(output != NULL) {
-                output[*pos] = residual->value;
-            }
-            *pos += 1;
+                miniflac_residual_lsb:
+                temp_32 = (residual->msb << residual->rice_parameter) | ((uint32_t)miniflac_bitreader_read(br,residual->rice_parameter));
+                residual->value = (temp_32 >> 1) ^ -(temp_32 & 1);
 
-            residual->msb = 0;
-            residual->residual++;
-            if(residual->residual < residual->residual_total) {
-                residual->state = MINIFLAC_RESIDUAL_MSB;
-                goto miniflac_residual_msb;
+                if(output != NULL) {
+                    output[*pos] = residual->value;
+                }
+                *pos += 1;
+
+                residual->msb = 0;
+                residual->residual++;
             }
 
             miniflac_residual_nextpart:
@@ -144,6 +2728,11 @@ miniflac_residual_decode(miniflac_residual_t* residual, miniflac_bitreader_t* br
             }
             break;
         }
+        case MINIFLAC_RESIDUAL_LSB: {
+            if(miniflac_bitreader_fill(br,residual->rice_parameter)) return MINIFLAC_CONTINUE;
+            residual->state = MINIFLAC_RESIDUAL_MSB;
+            goto miniflac_residual_lsb;
+        }
         default: break;
     }
 
@@ -151,4 +2740,105 @@ miniflac_residual_decode(miniflac_residual_t* residual, miniflac_bitreader_t* br
     return MINIFLAC_OK;
 }
 
+MINIFLAC_PRIVATE
+MINIFLAC_RESULT
+miniflac_residual_decode_fast(miniflac_bitreader_t* br, uint32_t block_size, uint8_t predictor_order, int32_t *output, miniflac_residual_restore restore, void* userdata) {
+    uint8_t coding_method;
+    uint8_t partition_order;
+    uint8_t rice_parameter_size;
+    uint8_t rice_parameter;
+    uint8_t rice_size;
+    uint32_t partition;
+    uint32_t partition_total;
+    uint32_t residual_total;
+    uint32_t msb;
+    uint32_t temp_32;
+#ifdef MINIFLAC_RICE_TABLE
+    uint32_t entry;
+    uint32_t count;
+    const uint32_t* table;
+#endif
+    int32_t* start;
+    int32_t* restored;
+    int32_t* end;
 
+    if(miniflac_bitreader_fill(br,6)) return MINIFLAC_CONTINUE;
+    coding_method = (uint8_t)miniflac_bitreader_read(br,2);
+    if(coding_method > 1) {
+        miniflac_abort();
+        return MINIFLAC_RESERVED_CODING_METHOD;
+    }
+    rice_parameter_size = coding_method == 0 ? 4 : 5;
+    partition_order = (uint8_t)miniflac_bitreader_read(br,4);
+    partition_total = 1 << partition_order;
+
+    start = output;
+    output += predictor_order;
+    restored = output;
+
+    for(partition = 0; partition < partition_total; partition++) {
+        if(restore != NULL && output - restored >= MINIFLAC_RESIDUAL_RESTORE_CHUNK) {
+            restore(userdata,start,(uint32_t)(restored - start),(uint32_t)(output - start));
+            restored = output;
+        }
+        if(miniflac_bitreader_fill(br,rice_parameter_size)) return MINIFLAC_CONTINUE;
+        rice_parameter = (uint8_t)miniflac_bitreader_read(br,rice_parameter_size);
+        residual_total = block_size >> partition_order;
+        if(partition == 0) {
+            if(residual_total < predictor_order) {
+                miniflac_abort();
+                return MINIFLAC_ERROR;
+            }
+            residual_total -= predictor_order;
+        }
+        end = output + residual_total;
+
+        if(rice_parameter == escape_codes[coding_method]) {
+            if(miniflac_bitreader_fill(br,5)) return MINIFLAC_CONTINUE;
+            rice_size = (uint8_t)miniflac_bitreader_read(br,5);
+            while(output < end) {
+                if(miniflac_bitreader_fill(br,rice_size)) return MINIFLAC_CONTINUE;
+                *output++ = (int32_t)miniflac_bitreader_read_signed(br,rice_size);
+            }
+            continue;
+        }
+
+#ifdef MINIFLAC_RICE_TABLE
+        table = rice_parameter <= MINIFLAC_RICE_TABLE_MAX_PARAMETER ? miniflac_rice_table[rice_parameter] : NULL;
+#endif
+
+        while(output < end) {
+#ifdef MINIFLAC_RICE_TABLE
+            if(table != NULL && !miniflac_bitreader_fill(br,MINIFLAC_RICE_TABLE_BITS)) {
+                entry = table[miniflac_bitreader_peek(br,MINIFLAC_RICE_TABLE_BITS)];
+                count = (entry >> 4) & 0x03;
+                /* codewords longer than the window, and the last few
+                 * residuals of a partition, are decoded one at a time */
+                if(count != 0 && count <= (uint32_t)(end - output)) {
+                    miniflac_bitreader_discard(br,entry & 0x0F);
+                    *output++ = (int8_t)(entry >> 8);
+                    if(count > 1) {
+                        *output++ = (int8_t)(entry >> 16);
+                        if(count > 2) {
+                            *output++ = (int8_t)(entry >> 24);
+                        }
+                    }
+                    continue;
+                }
+            }
+#endif
+
+            msb = 0;
+            if(miniflac_bitreader_read_unary(br,&msb)) return MINIFLAC_CONTINUE;
+            if(miniflac_bitreader_fill(br,rice_parameter)) return MINIFLAC_CONTINUE;
+            temp_32 = (msb << rice_parameter) | ((uint32_t)miniflac_bitreader_read(br,rice_parameter));
+            *output++ = (temp_32 >> 1) ^ -(temp_32 & 1);
+        }
+    }
+
+    if(restore != NULL && output != restored) {
+        restore(userdata,start,(uint32_t)(restored - start),(uint32_t)(output - start));
+    }
+
+    return MINIFLAC_OK;
+}
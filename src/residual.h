@@ -17,6 +17,8 @@ enum MINIFLAC_RESIDUAL_STATE {
     MINIFLAC_RESIDUAL_LSB, /* used when reading MSB bits */
 };
 
+typedef void (*miniflac_residual_restore)(void* userdata, int32_t* output, uint32_t start, uint32_t end);
+
 struct miniflac_residual_s {
     enum MINIFLAC_RESIDUAL_STATE state;
     uint8_t coding_method;
@@ -50,6 +52,17 @@ MINIFLAC_PRIVATE
 MINIFLAC_RESULT
 miniflac_residual_decode(miniflac_residual_t* residual, miniflac_bitreader_t* br, uint32_t* pos, uint32_t block_size, uint8_t predictor_order, int32_t *out);
 
+/* decodes all partitions in one go without saving any state, returns
+ * MINIFLAC_CONTINUE if it runs out of data and the caller will need to
+ * start over with miniflac_residual_decode.
+ *
+ * If restore is non-NULL it's called every few partitions with the range
+ * of samples that were just decoded, so the predictor can run over them
+ * while they're still in cache, rather than in a second pass at the end. */
+MINIFLAC_PRIVATE
+MINIFLAC_RESULT
+miniflac_residual_decode_fast(miniflac_bitreader_t* br, uint32_t block_size, uint8_t predictor_order, int32_t *out, miniflac_residual_restore restore, void* userdata);
+
 #ifdef __cplusplus
 }
 #endif
@@ -103,3 +103,40 @@ miniflac_seektable_read_samples(miniflac_seektable_t* seektable, miniflac_bitrea
     miniflac_abort();
     return MINIFLAC_ERROR;
 }
+
+MINIFLAC_PRIVATE
+MINIFLAC_RESULT
+miniflac_seektable_read_points(miniflac_seektable_t* seektable, miniflac_bitreader_t* br, miniflac_seekpoint_t* points, uint32_t length, uint32_t* outlen) {
+    MINIFLAC_RESULT r = MINIFLAC_ERROR;
+    miniflac_seekpoint_t* point;
+
+    while(seektable->pos < seektable->len) {
+        point = (points != NULL && seektable->pos < length) ? &points[seektable->pos] : NULL;
+        switch(seektable->state) {
+            case MINIFLAC_SEEKTABLE_SAMPLE_NUMBER: {
+                r = miniflac_seektable_read_sample_number(seektable,br,point == NULL ? NULL : &point->sample_number);
+                if(r != MINIFLAC_OK) return r;
+            }
+            /* fall-through */
+            case MINIFLAC_SEEKTABLE_SAMPLE_OFFSET: {
+                r = miniflac_seektable_read_sample_offset(seektable,br,point == NULL ? NULL : &point->sample_offset);
+                if(r != MINIFLAC_OK) return r;
+            }
+            /* fall-through */
+            case MINIFLAC_SEEKTABLE_SAMPLES: {
+                r = miniflac_seektable_read_samples(seektable,br,point == NULL ? NULL : &point->samples);
+                if(r != MINIFLAC_OK) return r;
+                break;
+            }
+            default: {
+                miniflac_abort();
+                return MINIFLAC_ERROR;
+            }
+        }
+    }
+
+    if(outlen != NULL) {
+        *outlen = seektable->len < length ? seektable->len : length;
+    }
+    return MINIFLAC_OK;
+}
@@ -13,12 +13,22 @@ enum MINIFLAC_SEEKTABLE_STATE {
     MINIFLAC_SEEKTABLE_SAMPLES,
 };
 
+/* a single seekpoint, sample_offset is in bytes from the first
+ * frame header. Placeholder points have a sample_number of
+ * 0xFFFFFFFFFFFFFFFF */
+struct miniflac_seekpoint_s {
+    uint64_t sample_number;
+    uint64_t sample_offset;
+    uint16_t samples;
+};
+
 struct miniflac_seektable_s {
     enum MINIFLAC_SEEKTABLE_STATE    state;
     uint32_t len; /* number of seekpoints */
     uint32_t pos; /* current seekpoint */
 };
 
+typedef struct miniflac_seekpoint_s miniflac_seekpoint_t;
 typedef struct miniflac_seektable_s miniflac_seektable_t;
 typedef enum MINIFLAC_SEEKTABLE_STATE MINIFLAC_SEEKTABLE_STATE;
 
@@ -49,6 +59,12 @@ MINIFLAC_PRIVATE
 MINIFLAC_RESULT
 miniflac_seektable_read_samples(miniflac_seektable_t* seektable, miniflac_bitreader_t* br, uint16_t* samples);
 
+/* reads the seekpoints into points, up to length of them.
+ * outlen is set to the number of points stored */
+MINIFLAC_PRIVATE
+MINIFLAC_RESULT
+miniflac_seektable_read_points(miniflac_seektable_t* seektable, miniflac_bitreader_t* br, miniflac_seekpoint_t* points, uint32_t length, uint32_t* outlen);
+
 #ifdef __cplusplus
 }
 #endif
@@ -5,10 +5,17 @@
 MINIFLAC_PRIVATE
 void
 miniflac_streaminfo_init(miniflac_streaminfo_t* streaminfo) {
+    uint8_t i;
     streaminfo->state = MINIFLAC_STREAMINFO_MINBLOCKSIZE;
     streaminfo->pos = 0;
+    streaminfo->max_block_size = 0;
+    streaminfo->max_frame_size = 0;
     streaminfo->sample_rate = 0;
+    streaminfo->channels = 0;
     streaminfo->bps = 0;
+    for(i = 0; i < 16; i++) {
+        streaminfo->md5[i] = 0;
+    }
 }
 
 MINIFLAC_PRIVATE
@@ -35,7 +42,6 @@ miniflac_streaminfo_read_min_block_size(miniflac_streaminfo_t* streaminfo, minif
 MINIFLAC_PRIVATE
 MINIFLAC_RESULT
 miniflac_streaminfo_read_max_block_size(miniflac_streaminfo_t* streaminfo, miniflac_bitreader_t* br, uint16_t* max_block_size) {
-    uint16_t t;
     MINIFLAC_RESULT r = MINIFLAC_ERROR;
     switch(streaminfo->state) {
         case MINIFLAC_STREAMINFO_MINBLOCKSIZE: {
@@ -45,9 +51,9 @@ miniflac_streaminfo_read_max_block_size(miniflac_streaminfo_t* streaminfo, minif
         /* fall-through */
         case MINIFLAC_STREAMINFO_MAXBLOCKSIZE: {
             if(miniflac_bitreader_fill_nocrc(br,16)) return MINIFLAC_CONTINUE;
-            t = (uint16_t) miniflac_bitreader_read(br,16);
+            streaminfo->max_block_size = (uint16_t) miniflac_bitreader_read(br,16);
             if(max_block_size != NULL) {
-                *max_block_size = t;
+                *max_block_size = streaminfo->max_block_size;
             }
             streaminfo->state = MINIFLAC_STREAMINFO_MINFRAMESIZE;
             return MINIFLAC_OK;
@@ -91,7 +97,6 @@ miniflac_streaminfo_read_min_frame_size(miniflac_streaminfo_t* streaminfo, minif
 MINIFLAC_PRIVATE
 MINIFLAC_RESULT
 miniflac_streaminfo_read_max_frame_size(miniflac_streaminfo_t* streaminfo, miniflac_bitreader_t* br, uint32_t* max_frame_size) {
-    uint32_t t;
     MINIFLAC_RESULT r = MINIFLAC_ERROR;
     switch(streaminfo->state) {
         case MINIFLAC_STREAMINFO_MINBLOCKSIZE: /* fall-through */
@@ -103,9 +108,9 @@ miniflac_streaminfo_read_max_frame_size(miniflac_streaminfo_t* streaminfo, minif
         /* fall-through */
         case MINIFLAC_STREAMINFO_MAXFRAMESIZE: {
             if(miniflac_bitreader_fill_nocrc(br,24)) return MINIFLAC_CONTINUE;
-            t = (uint32_t) miniflac_bitreader_read(br,24);
+            streaminfo->max_frame_size = (uint32_t) miniflac_bitreader_read(br,24);
             if(max_frame_size != NULL) {
-                *max_frame_size = t;
+                *max_frame_size = streaminfo->max_frame_size;
             }
             streaminfo->state = MINIFLAC_STREAMINFO_SAMPLERATE;
             return MINIFLAC_OK;
@@ -164,6 +169,7 @@ miniflac_streaminfo_read_channels(miniflac_streaminfo_t* streaminfo, miniflac_bi
         case MINIFLAC_STREAMINFO_CHANNELS: {
             if(miniflac_bitreader_fill_nocrc(br,3)) return MINIFLAC_CONTINUE;
             t = (uint8_t) miniflac_bitreader_read(br,3) + 1;
+            streaminfo->channels = t;
             if(channels != NULL) {
                 *channels = t;
             }
@@ -289,6 +295,7 @@ miniflac_streaminfo_read_md5_data(miniflac_streaminfo_t* streaminfo, miniflac_bi
             while(streaminfo->pos < 16) {
                 if(miniflac_bitreader_fill_nocrc(br,8)) return MINIFLAC_CONTINUE;
                 t = (uint8_t)miniflac_bitreader_read(br,8);
+                streaminfo->md5[streaminfo->pos] = t;
                 if(output != NULL && streaminfo->pos < length) {
                     output[streaminfo->pos] = t;
                 }
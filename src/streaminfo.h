@@ -22,8 +22,12 @@ enum MINIFLAC_STREAMINFO_STATE {
 struct miniflac_streaminfo_s {
     enum MINIFLAC_STREAMINFO_STATE state;
     uint8_t                     pos;
+    uint16_t         max_block_size;
+    uint32_t         max_frame_size;
     uint32_t            sample_rate;
+    uint8_t                channels;
     uint8_t                     bps;
+    uint8_t                  md5[16]; /* kept for miniflac_verify_check */
 };
 
 typedef struct miniflac_streaminfo_s miniflac_streaminfo_t;
@@ -1,6 +1,5 @@
 /* SPDX-License-Identifier: 0BSD */
 #include "streammarker.h"
-#include <assert.h>
 
 MINIFLAC_PRIVATE
 void
@@ -60,9 +59,7 @@ miniflac_streammarker_decode(miniflac_streammarker_t* streammarker, miniflac_bit
 
     miniflac_streammarker_init(streammarker);
 
-    assert(br->bits == 0);
-    br->crc8  = 0;
-    br->crc16 = 0;
+    miniflac_bitreader_reset_crc(br);
 
     return MINIFLAC_OK;
 }
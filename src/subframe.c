@@ -15,11 +15,21 @@ miniflac_subframe_init(miniflac_subframe_t* subframe) {
     miniflac_residual_init(&subframe->residual);
 }
 
+static
+void
+miniflac_subframe_shift_wasted(miniflac_subframe_t* subframe, int32_t* output, uint32_t block_size) {
+    uint32_t i;
+    if(subframe->header.wasted_bits > 0) {
+        for(i=0;i<block_size;i++) {
+            output[i] <<= subframe->header.wasted_bits;
+        }
+    }
+}
+
 MINIFLAC_PRIVATE
 MINIFLAC_RESULT
 miniflac_subframe_decode(miniflac_subframe_t* subframe, miniflac_bitreader_t* br, int32_t* output, uint32_t block_size, uint8_t bps) {
     MINIFLAC_RESULT r;
-    uint32_t i;
 
     switch(subframe->state) {
         case MINIFLAC_SUBFRAME_HEADER: {
@@ -90,12 +100,54 @@ miniflac_subframe_decode(miniflac_subframe_t* subframe, miniflac_bitreader_t* br
         default: break;
     }
 
-    if(output != NULL && subframe->header.wasted_bits > 0) {
-        for(i=0;i<block_size;i++) {
-            output[i] <<= subframe->header.wasted_bits;
+    if(output != NULL) {
+        miniflac_subframe_shift_wasted(subframe,output,block_size);
+    }
+
+    miniflac_subframe_init(subframe);
+    return MINIFLAC_OK;
+}
+
+MINIFLAC_PRIVATE
+MINIFLAC_RESULT
+miniflac_subframe_decode_fast(miniflac_subframe_t* subframe, miniflac_bitreader_t* br, int32_t* output, uint32_t block_size, uint8_t bps) {
+    MINIFLAC_RESULT r;
+
+    r = miniflac_subframe_header_decode(&subframe->header,br);
+    if(r != MINIFLAC_OK) return r;
+
+    if(subframe->header.wasted_bits >= bps) {
+        miniflac_abort();
+        return MINIFLAC_ERROR;
+    }
+
+    subframe->bps = bps - subframe->header.wasted_bits;
+
+    switch(subframe->header.type) {
+        case MINIFLAC_SUBFRAME_TYPE_CONSTANT: {
+            r = miniflac_subframe_constant_decode(&subframe->constant,br,output,block_size,subframe->bps);
+            break;
+        }
+        case MINIFLAC_SUBFRAME_TYPE_VERBATIM: {
+            r = miniflac_subframe_verbatim_decode_fast(br,output,block_size,subframe->bps);
+            break;
+        }
+        case MINIFLAC_SUBFRAME_TYPE_FIXED: {
+            r = miniflac_subframe_fixed_decode_fast(br,output,block_size,subframe->bps,subframe->header.order);
+            break;
+        }
+        case MINIFLAC_SUBFRAME_TYPE_LPC: {
+            r = miniflac_subframe_lpc_decode_fast(&subframe->lpc,br,output,block_size,subframe->bps,subframe->header.order);
+            break;
+        }
+        default: {
+            miniflac_abort();
+            return MINIFLAC_ERROR;
         }
     }
+    if(r != MINIFLAC_OK) return r;
 
+    miniflac_subframe_shift_wasted(subframe,output,block_size);
     miniflac_subframe_init(subframe);
     return MINIFLAC_OK;
 }
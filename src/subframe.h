@@ -47,6 +47,13 @@ MINIFLAC_PRIVATE
 MINIFLAC_RESULT
 miniflac_subframe_decode(miniflac_subframe_t* subframe, miniflac_bitreader_t* br, int32_t* output, uint32_t block_size, uint8_t bps);
 
+/* decodes a whole subframe without stopping, for when the buffer is
+ * known to hold the rest of the frame. On MINIFLAC_CONTINUE the
+ * bitreader and subframe are left in an undefined state. */
+MINIFLAC_PRIVATE
+MINIFLAC_RESULT
+miniflac_subframe_decode_fast(miniflac_subframe_t* subframe, miniflac_bitreader_t* br, int32_t* output, uint32_t block_size, uint8_t bps);
+
 
 #ifdef __cplusplus
 }
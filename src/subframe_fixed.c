@@ -9,18 +9,109 @@ miniflac_subframe_fixed_init(miniflac_subframe_fixed_t* f) {
     f->state = MINIFLAC_SUBFRAME_FIXED_DECODE;
 }
 
+/* Order-specialised restoration loops. The previous samples are carried
+ * along in locals instead of being read back from output on every sample. */
+
+static
+void
+miniflac_subframe_fixed_predict_0(int32_t* output, uint32_t start, uint32_t end) {
+    /* the residual is the signal */
+    (void)output;
+    (void)start;
+    (void)end;
+}
+
+static
+void
+miniflac_subframe_fixed_predict_1(int32_t* output, uint32_t start, uint32_t end) {
+    uint32_t i;
+    int64_t sample1 = output[start - 1];
+
+    for(i = start; i < end; i++) {
+        output[i] = (int32_t)(sample1 + output[i]);
+        sample1 = output[i];
+    }
+}
+
+static
+void
+miniflac_subframe_fixed_predict_2(int32_t* output, uint32_t start, uint32_t end) {
+    uint32_t i;
+    int64_t sample1 = output[start - 1];
+    int64_t sample2 = output[start - 2];
+
+    for(i = start; i < end; i++) {
+        output[i] = (int32_t)(2 * sample1 - sample2 + output[i]);
+        sample2 = sample1;
+        sample1 = output[i];
+    }
+}
+
+static
+void
+miniflac_subframe_fixed_predict_3(int32_t* output, uint32_t start, uint32_t end) {
+    uint32_t i;
+    int64_t sample1 = output[start - 1];
+    int64_t sample2 = output[start - 2];
+    int64_t sample3 = output[start - 3];
+
+    for(i = start; i < end; i++) {
+        output[i] = (int32_t)(3 * sample1 - 3 * sample2 + sample3 + output[i]);
+        sample3 = sample2;
+        sample2 = sample1;
+        sample1 = output[i];
+    }
+}
+
+static
+void
+miniflac_subframe_fixed_predict_4(int32_t* output, uint32_t start, uint32_t end) {
+    uint32_t i;
+    int64_t sample1 = output[start - 1];
+    int64_t sample2 = output[start - 2];
+    int64_t sample3 = output[start - 3];
+    int64_t sample4 = output[start - 4];
+
+    for(i = start; i < end; i++) {
+        output[i] = (int32_t)(4 * sample1 - 6 * sample2 + 4 * sample3 - sample4 + output[i]);
+        sample4 = sample3;
+        sample3 = sample2;
+        sample2 = sample1;
+        sample1 = output[i];
+    }
+}
+
+typedef void (*miniflac_subframe_fixed_predictor)(int32_t* output, uint32_t start, uint32_t end);
+
+static const miniflac_subframe_fixed_predictor miniflac_subframe_fixed_predictors[5] = {
+    miniflac_subframe_fixed_predict_0,
+    miniflac_subframe_fixed_predict_1,
+    miniflac_subframe_fixed_predict_2,
+    miniflac_subframe_fixed_predict_3,
+    miniflac_subframe_fixed_predict_4,
+};
+
+MINIFLAC_PRIVATE
+void
+miniflac_subframe_fixed_predict(int32_t* output, uint32_t start, uint32_t end, uint8_t predictor_order) {
+    if(predictor_order > 4 || start < predictor_order || end <= start) return;
+    miniflac_subframe_fixed_predictors[predictor_order](output,start,end);
+}
+
+#ifdef MINIFLAC_FUSED_PREDICTION
+static
+void
+miniflac_subframe_fixed_restore(void* userdata, int32_t* output, uint32_t start, uint32_t end) {
+    miniflac_subframe_fixed_predict(output,start,end,*(const uint8_t*)userdata);
+}
+#endif
+
 MINIFLAC_PRIVATE
 MINIFLAC_RESULT
 miniflac_subframe_fixed_decode(miniflac_subframe_fixed_t* f, miniflac_bitreader_t* br, int32_t* output, uint32_t block_size, uint8_t bps, miniflac_residual_t* residual, uint8_t predictor_order) {
     int32_t sample;
-
-    int64_t sample1;
-    int64_t sample2;
-    int64_t sample3;
-    int64_t sample4;
-    int64_t current_residual;
-
     MINIFLAC_RESULT r;
+
     while(f->pos < predictor_order) {
         if(miniflac_bitreader_fill(br,bps)) return MINIFLAC_CONTINUE;
         sample = (int32_t) miniflac_bitreader_read_signed(br,bps);
@@ -29,76 +120,37 @@ miniflac_subframe_fixed_decode(miniflac_subframe_fixed_t* f, miniflac_bitreader_
         }
         f->pos++;
     }
+
     r = miniflac_residual_decode(residual,br,&f->pos,block_size,predictor_order,output);
     if(r != MINIFLAC_OK) return r;
 
     if(output != NULL) {
-        switch(predictor_order) {
-            case 0:
-#if 0
-                /* this is here for reference but not actually needed */
-                for(f->pos = predictor_order; f->pos < block_size; f->pos++) {
-                    current_residual = output[f->pos];
-                    output[f->pos] = (int32_t)current_residual;
-                }
-#endif
-                break;
-            case 1: {
-                for(f->pos = predictor_order; f->pos < block_size; f->pos++) {
-                    current_residual = output[f->pos];
-                    sample1  = output[f->pos-1];
-                    output[f->pos] = (int32_t)(sample1 + current_residual);
-                }
-                break;
-            }
-            case 2: {
-                for(f->pos = predictor_order; f->pos < block_size; f->pos++) {
-                    current_residual = output[f->pos];
-                    sample1  = output[f->pos-1];
-                    sample2  = output[f->pos-2];
-
-                    sample1 *= 2;
-
-                    output[f->pos] = (int32_t)(sample1 - sample2 + current_residual);
-                }
-                break;
-            }
-            case 3: {
-                for(f->pos = predictor_order; f->pos < block_size; f->pos++) {
-                    current_residual = output[f->pos];
-                    sample1  = output[f->pos-1];
-                    sample2  = output[f->pos-2];
-                    sample3  = output[f->pos-3];
-
-                    sample1 *= 3;
-                    sample2 *= 3;
-
-                    output[f->pos] = (int32_t)(sample1 - sample2 + sample3 + current_residual);
-                }
-                break;
-            }
-            case 4: {
-                for(f->pos = predictor_order; f->pos < block_size; f->pos++) {
-                    current_residual = output[f->pos];
-                    sample1  = output[f->pos-1];
-                    sample2  = output[f->pos-2];
-                    sample3  = output[f->pos-3];
-                    sample4  = output[f->pos-4];
-
-                    sample1 *= 4;
-                    sample2 *= 6;
-                    sample3 *= 4;
-
-                    output[f->pos] = (int32_t)(sample1  - sample2 + sample3 - sample4 + current_residual);
-                }
-                break;
-            }
-            default: break;
-        }
+        miniflac_subframe_fixed_predict(output,predictor_order,block_size,predictor_order);
     }
 
     return MINIFLAC_OK;
-
 }
 
+MINIFLAC_PRIVATE
+MINIFLAC_RESULT
+miniflac_subframe_fixed_decode_fast(miniflac_bitreader_t* br, int32_t* output, uint32_t block_size, uint8_t bps, uint8_t predictor_order) {
+    uint32_t i;
+#ifndef MINIFLAC_FUSED_PREDICTION
+    MINIFLAC_RESULT r;
+#endif
 
+    for(i = 0; i < predictor_order; i++) {
+        if(miniflac_bitreader_fill(br,bps)) return MINIFLAC_CONTINUE;
+        output[i] = (int32_t) miniflac_bitreader_read_signed(br,bps);
+    }
+
+#ifdef MINIFLAC_FUSED_PREDICTION
+    return miniflac_residual_decode_fast(br,block_size,predictor_order,output,miniflac_subframe_fixed_restore,&predictor_order);
+#else
+    r = miniflac_residual_decode_fast(br,block_size,predictor_order,output,NULL,NULL);
+    if(r != MINIFLAC_OK) return r;
+
+    miniflac_subframe_fixed_predict(output,predictor_order,block_size,predictor_order);
+    return MINIFLAC_OK;
+#endif
+}
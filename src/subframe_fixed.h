@@ -33,6 +33,15 @@ MINIFLAC_PRIVATE
 MINIFLAC_RESULT
 miniflac_subframe_fixed_decode(miniflac_subframe_fixed_t* c, miniflac_bitreader_t* br, int32_t* output, uint32_t block_size, uint8_t bps, miniflac_residual_t* residual, uint8_t predictor_order);
 
+MINIFLAC_PRIVATE
+MINIFLAC_RESULT
+miniflac_subframe_fixed_decode_fast(miniflac_bitreader_t* br, int32_t* output, uint32_t block_size, uint8_t bps, uint8_t predictor_order);
+
+/* restores samples start..end-1, which hold residuals, in-place */
+MINIFLAC_PRIVATE
+void
+miniflac_subframe_fixed_predict(int32_t* output, uint32_t start, uint32_t end, uint8_t predictor_order);
+
 #ifdef __cplusplus
 }
 #endif
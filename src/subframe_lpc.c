@@ -1,5 +1,6 @@
 /* SPDX-License-Identifier: 0BSD */
 #include "subframe_lpc.h"
+#include "cpu.h"
 #include <stddef.h>
 
 MINIFLAC_PRIVATE
@@ -10,19 +11,408 @@ miniflac_subframe_lpc_init(miniflac_subframe_lpc_t* l) {
     l->precision = 0;
     l->shift = 0;
     l->coeff = 0;
+    l->predictor = NULL;
     for(i = 0; i < 32; i++) {
         l->coefficients[i] = 0;
     }
     l->state = MINIFLAC_SUBFRAME_LPC_PRECISION;
 }
 
+/* Order-specialised restoration loops. Each one holds its coefficients
+ * in locals and has the multiply-accumulate fully unrolled, so nothing
+ * is reloaded from l->coefficients per sample.
+ *
+ * The 32-bit versions are only used when bps + precision + log2(order)
+ * fits in 32 bits, so the sum can't overflow on a valid stream. They sum
+ * in unsigned math so a corrupt stream wraps instead, same as the
+ * truncation at the end of the 64-bit loop. */
+
+#define MINIFLAC_LPC_REPEAT_1(m) m(0)
+#define MINIFLAC_LPC_REPEAT_2(m) MINIFLAC_LPC_REPEAT_1(m) m(1)
+#define MINIFLAC_LPC_REPEAT_3(m) MINIFLAC_LPC_REPEAT_2(m) m(2)
+#define MINIFLAC_LPC_REPEAT_4(m) MINIFLAC_LPC_REPEAT_3(m) m(3)
+#define MINIFLAC_LPC_REPEAT_5(m) MINIFLAC_LPC_REPEAT_4(m) m(4)
+#define MINIFLAC_LPC_REPEAT_6(m) MINIFLAC_LPC_REPEAT_5(m) m(5)
+#define MINIFLAC_LPC_REPEAT_7(m) MINIFLAC_LPC_REPEAT_6(m) m(6)
+#define MINIFLAC_LPC_REPEAT_8(m) MINIFLAC_LPC_REPEAT_7(m) m(7)
+#define MINIFLAC_LPC_REPEAT_9(m) MINIFLAC_LPC_REPEAT_8(m) m(8)
+#define MINIFLAC_LPC_REPEAT_10(m) MINIFLAC_LPC_REPEAT_9(m) m(9)
+#define MINIFLAC_LPC_REPEAT_11(m) MINIFLAC_LPC_REPEAT_10(m) m(10)
+#define MINIFLAC_LPC_REPEAT_12(m) MINIFLAC_LPC_REPEAT_11(m) m(11)
+#define MINIFLAC_LPC_REPEAT_13(m) MINIFLAC_LPC_REPEAT_12(m) m(12)
+#define MINIFLAC_LPC_REPEAT_14(m) MINIFLAC_LPC_REPEAT_13(m) m(13)
+#define MINIFLAC_LPC_REPEAT_15(m) MINIFLAC_LPC_REPEAT_14(m) m(14)
+#define MINIFLAC_LPC_REPEAT_16(m) MINIFLAC_LPC_REPEAT_15(m) m(15)
+#define MINIFLAC_LPC_REPEAT_17(m) MINIFLAC_LPC_REPEAT_16(m) m(16)
+#define MINIFLAC_LPC_REPEAT_18(m) MINIFLAC_LPC_REPEAT_17(m) m(17)
+#define MINIFLAC_LPC_REPEAT_19(m) MINIFLAC_LPC_REPEAT_18(m) m(18)
+#define MINIFLAC_LPC_REPEAT_20(m) MINIFLAC_LPC_REPEAT_19(m) m(19)
+#define MINIFLAC_LPC_REPEAT_21(m) MINIFLAC_LPC_REPEAT_20(m) m(20)
+#define MINIFLAC_LPC_REPEAT_22(m) MINIFLAC_LPC_REPEAT_21(m) m(21)
+#define MINIFLAC_LPC_REPEAT_23(m) MINIFLAC_LPC_REPEAT_22(m) m(22)
+#define MINIFLAC_LPC_REPEAT_24(m) MINIFLAC_LPC_REPEAT_23(m) m(23)
+#define MINIFLAC_LPC_REPEAT_25(m) MINIFLAC_LPC_REPEAT_24(m) m(24)
+#define MINIFLAC_LPC_REPEAT_26(m) MINIFLAC_LPC_REPEAT_25(m) m(25)
+#define MINIFLAC_LPC_REPEAT_27(m) MINIFLAC_LPC_REPEAT_26(m) m(26)
+#define MINIFLAC_LPC_REPEAT_28(m) MINIFLAC_LPC_REPEAT_27(m) m(27)
+#define MINIFLAC_LPC_REPEAT_29(m) MINIFLAC_LPC_REPEAT_28(m) m(28)
+#define MINIFLAC_LPC_REPEAT_30(m) MINIFLAC_LPC_REPEAT_29(m) m(29)
+#define MINIFLAC_LPC_REPEAT_31(m) MINIFLAC_LPC_REPEAT_30(m) m(30)
+#define MINIFLAC_LPC_REPEAT_32(m) MINIFLAC_LPC_REPEAT_31(m) m(31)
+
+#define MINIFLAC_LPC_COEFF64(j) const int64_t c##j = coefficients[j];
+#define MINIFLAC_LPC_TERM64(j) + c##j * output[i - j - 1]
+#define MINIFLAC_LPC_COEFF32(j) const uint32_t c##j = (uint32_t)coefficients[j];
+#define MINIFLAC_LPC_TERM32(j) + c##j * (uint32_t)output[i - j - 1]
+
+#define MINIFLAC_LPC_PREDICT(N) \
+static \
+void \
+miniflac_subframe_lpc_predict64_##N(const int32_t* coefficients, uint8_t shift, uint8_t predictor_order, int32_t* output, uint32_t start, uint32_t end) { \
+    MINIFLAC_LPC_REPEAT_##N(MINIFLAC_LPC_COEFF64) \
+    int64_t prediction; \
+    uint32_t i; \
+    (void)predictor_order; \
+    for(i = start; i < end; i++) { \
+        prediction = 0 MINIFLAC_LPC_REPEAT_##N(MINIFLAC_LPC_TERM64); \
+        prediction >>= shift; \
+        prediction += output[i]; \
+        output[i] = (int32_t)prediction; \
+    } \
+} \
+\
+static \
+void \
+miniflac_subframe_lpc_predict32_##N(const int32_t* coefficients, uint8_t shift, uint8_t predictor_order, int32_t* output, uint32_t start, uint32_t end) { \
+    MINIFLAC_LPC_REPEAT_##N(MINIFLAC_LPC_COEFF32) \
+    uint32_t prediction; \
+    uint32_t i; \
+    (void)predictor_order; \
+    for(i = start; i < end; i++) { \
+        prediction = 0 MINIFLAC_LPC_REPEAT_##N(MINIFLAC_LPC_TERM32); \
+        output[i] = (int32_t)((uint32_t)output[i] + (uint32_t)(((int32_t)prediction) >> shift)); \
+    } \
+}
+
+MINIFLAC_LPC_PREDICT(1)
+MINIFLAC_LPC_PREDICT(2)
+MINIFLAC_LPC_PREDICT(3)
+MINIFLAC_LPC_PREDICT(4)
+MINIFLAC_LPC_PREDICT(5)
+MINIFLAC_LPC_PREDICT(6)
+MINIFLAC_LPC_PREDICT(7)
+MINIFLAC_LPC_PREDICT(8)
+MINIFLAC_LPC_PREDICT(9)
+MINIFLAC_LPC_PREDICT(10)
+MINIFLAC_LPC_PREDICT(11)
+MINIFLAC_LPC_PREDICT(12)
+MINIFLAC_LPC_PREDICT(13)
+MINIFLAC_LPC_PREDICT(14)
+MINIFLAC_LPC_PREDICT(15)
+MINIFLAC_LPC_PREDICT(16)
+MINIFLAC_LPC_PREDICT(17)
+MINIFLAC_LPC_PREDICT(18)
+MINIFLAC_LPC_PREDICT(19)
+MINIFLAC_LPC_PREDICT(20)
+MINIFLAC_LPC_PREDICT(21)
+MINIFLAC_LPC_PREDICT(22)
+MINIFLAC_LPC_PREDICT(23)
+MINIFLAC_LPC_PREDICT(24)
+MINIFLAC_LPC_PREDICT(25)
+MINIFLAC_LPC_PREDICT(26)
+MINIFLAC_LPC_PREDICT(27)
+MINIFLAC_LPC_PREDICT(28)
+MINIFLAC_LPC_PREDICT(29)
+MINIFLAC_LPC_PREDICT(30)
+MINIFLAC_LPC_PREDICT(31)
+MINIFLAC_LPC_PREDICT(32)
+
+/* indexed by predictor order, LPC subframes are always order 1 or higher */
+static const miniflac_subframe_lpc_predictor miniflac_subframe_lpc_predictors64[33] = {
+    NULL,
+    miniflac_subframe_lpc_predict64_1,
+    miniflac_subframe_lpc_predict64_2,
+    miniflac_subframe_lpc_predict64_3,
+    miniflac_subframe_lpc_predict64_4,
+    miniflac_subframe_lpc_predict64_5,
+    miniflac_subframe_lpc_predict64_6,
+    miniflac_subframe_lpc_predict64_7,
+    miniflac_subframe_lpc_predict64_8,
+    miniflac_subframe_lpc_predict64_9,
+    miniflac_subframe_lpc_predict64_10,
+    miniflac_subframe_lpc_predict64_11,
+    miniflac_subframe_lpc_predict64_12,
+    miniflac_subframe_lpc_predict64_13,
+    miniflac_subframe_lpc_predict64_14,
+    miniflac_subframe_lpc_predict64_15,
+    miniflac_subframe_lpc_predict64_16,
+    miniflac_subframe_lpc_predict64_17,
+    miniflac_subframe_lpc_predict64_18,
+    miniflac_subframe_lpc_predict64_19,
+    miniflac_subframe_lpc_predict64_20,
+    miniflac_subframe_lpc_predict64_21,
+    miniflac_subframe_lpc_predict64_22,
+    miniflac_subframe_lpc_predict64_23,
+    miniflac_subframe_lpc_predict64_24,
+    miniflac_subframe_lpc_predict64_25,
+    miniflac_subframe_lpc_predict64_26,
+    miniflac_subframe_lpc_predict64_27,
+    miniflac_subframe_lpc_predict64_28,
+    miniflac_subframe_lpc_predict64_29,
+    miniflac_subframe_lpc_predict64_30,
+    miniflac_subframe_lpc_predict64_31,
+    miniflac_subframe_lpc_predict64_32
+};
+
+static const miniflac_subframe_lpc_predictor miniflac_subframe_lpc_predictors32[33] = {
+    NULL,
+    miniflac_subframe_lpc_predict32_1,
+    miniflac_subframe_lpc_predict32_2,
+    miniflac_subframe_lpc_predict32_3,
+    miniflac_subframe_lpc_predict32_4,
+    miniflac_subframe_lpc_predict32_5,
+    miniflac_subframe_lpc_predict32_6,
+    miniflac_subframe_lpc_predict32_7,
+    miniflac_subframe_lpc_predict32_8,
+    miniflac_subframe_lpc_predict32_9,
+    miniflac_subframe_lpc_predict32_10,
+    miniflac_subframe_lpc_predict32_11,
+    miniflac_subframe_lpc_predict32_12,
+    miniflac_subframe_lpc_predict32_13,
+    miniflac_subframe_lpc_predict32_14,
+    miniflac_subframe_lpc_predict32_15,
+    miniflac_subframe_lpc_predict32_16,
+    miniflac_subframe_lpc_predict32_17,
+    miniflac_subframe_lpc_predict32_18,
+    miniflac_subframe_lpc_predict32_19,
+    miniflac_subframe_lpc_predict32_20,
+    miniflac_subframe_lpc_predict32_21,
+    miniflac_subframe_lpc_predict32_22,
+    miniflac_subframe_lpc_predict32_23,
+    miniflac_subframe_lpc_predict32_24,
+    miniflac_subframe_lpc_predict32_25,
+    miniflac_subframe_lpc_predict32_26,
+    miniflac_subframe_lpc_predict32_27,
+    miniflac_subframe_lpc_predict32_28,
+    miniflac_subframe_lpc_predict32_29,
+    miniflac_subframe_lpc_predict32_30,
+    miniflac_subframe_lpc_predict32_31,
+    miniflac_subframe_lpc_predict32_32
+};
+
+/* a sum of order products of a bps-bit sample and a precision-bit
+ * coefficient needs at most bps + precision + log2(order) - 1 bits */
+static
+uint8_t
+miniflac_subframe_lpc_fits32(uint8_t precision, uint8_t bps, uint8_t predictor_order) {
+    uint8_t log2_order = 0;
+    while(predictor_order >>= 1) log2_order++;
+    return bps + precision + log2_order <= 32;
+}
+
+/* The SIMD kernels below also accumulate in 32 bits. Each vector computes
+ * a group of consecutive samples; lane k of the vector for coefficient j
+ * reads output[i+k-j-1], which for k > j is a sample in the same group that
+ * hasn't been restored yet. Those lanes get a zero coefficient and the
+ * missing terms are added one sample at a time afterwards. */
+
+#if defined(MINIFLAC_SIMD_X86) || defined(MINIFLAC_SIMD_NEON)
+#define MINIFLAC_LPC_SIMD_MIN_ORDER 8
+
+static
+void
+miniflac_subframe_lpc_finish_group(const int32_t* coefficients, uint8_t shift, int32_t* output, const uint32_t* partial, uint32_t group) {
+    uint32_t sum;
+    uint32_t j,k;
+
+    for(k = 0; k < group; k++) {
+        sum = partial[k];
+        for(j = 0; j < k; j++) {
+            sum += (uint32_t)coefficients[j] * (uint32_t)output[k - j - 1];
+        }
+        output[k] = (int32_t)((uint32_t)output[k] + (uint32_t)(((int32_t)sum) >> shift));
+    }
+}
+
+static
+void
+miniflac_subframe_lpc_predict_tail32(const int32_t* coefficients, uint8_t shift, uint8_t predictor_order, int32_t* output, uint32_t start, uint32_t end) {
+    uint32_t sum;
+    uint32_t i,j;
+
+    for(i = start; i < end; i++) {
+        sum = 0;
+        for(j = 0; j < predictor_order; j++) {
+            sum += (uint32_t)coefficients[j] * (uint32_t)output[i - j - 1];
+        }
+        output[i] = (int32_t)((uint32_t)output[i] + (uint32_t)(((int32_t)sum) >> shift));
+    }
+}
+#endif
+
+#if defined(MINIFLAC_SIMD_X86)
+static MINIFLAC_TARGET("sse4.1")
+void
+miniflac_subframe_lpc_predict_sse41(const int32_t* coefficients, uint8_t shift, uint8_t predictor_order, int32_t* output, uint32_t start, uint32_t end) {
+    __m128i c[32];
+    __m128i sum0, sum1;
+    uint32_t partial[4];
+    uint32_t i,j;
+
+    for(j = 0; j < predictor_order; j++) {
+        c[j] = _mm_set_epi32(
+          j >= 3 ? coefficients[j] : 0,
+          j >= 2 ? coefficients[j] : 0,
+          j >= 1 ? coefficients[j] : 0,
+          coefficients[j]);
+    }
+
+    for(i = start; i + 4 <= end; i += 4) {
+        sum0 = _mm_setzero_si128();
+        sum1 = _mm_setzero_si128();
+        for(j = 0; j + 1 < predictor_order; j += 2) {
+            sum0 = _mm_add_epi32(sum0, _mm_mullo_epi32(c[j], _mm_loadu_si128((const __m128i*)&output[i - j - 1])));
+            sum1 = _mm_add_epi32(sum1, _mm_mullo_epi32(c[j+1], _mm_loadu_si128((const __m128i*)&output[i - j - 2])));
+        }
+        if(j < predictor_order) {
+            sum0 = _mm_add_epi32(sum0, _mm_mullo_epi32(c[j], _mm_loadu_si128((const __m128i*)&output[i - j - 1])));
+        }
+        _mm_storeu_si128((__m128i*)partial, _mm_add_epi32(sum0, sum1));
+        miniflac_subframe_lpc_finish_group(coefficients, shift, &output[i], partial, 4);
+    }
+
+    miniflac_subframe_lpc_predict_tail32(coefficients, shift, predictor_order, output, i, end);
+}
+
+static MINIFLAC_TARGET("avx2")
+void
+miniflac_subframe_lpc_predict_avx2(const int32_t* coefficients, uint8_t shift, uint8_t predictor_order, int32_t* output, uint32_t start, uint32_t end) {
+    __m256i c[32];
+    __m256i sum0, sum1;
+    uint32_t partial[8];
+    uint32_t i,j;
+
+    for(j = 0; j < predictor_order; j++) {
+        c[j] = _mm256_set_epi32(
+          j >= 7 ? coefficients[j] : 0,
+          j >= 6 ? coefficients[j] : 0,
+          j >= 5 ? coefficients[j] : 0,
+          j >= 4 ? coefficients[j] : 0,
+          j >= 3 ? coefficients[j] : 0,
+          j >= 2 ? coefficients[j] : 0,
+          j >= 1 ? coefficients[j] : 0,
+          coefficients[j]);
+    }
+
+    for(i = start; i + 8 <= end; i += 8) {
+        sum0 = _mm256_setzero_si256();
+        sum1 = _mm256_setzero_si256();
+        for(j = 0; j + 1 < predictor_order; j += 2) {
+            sum0 = _mm256_add_epi32(sum0, _mm256_mullo_epi32(c[j], _mm256_loadu_si256((const __m256i*)&output[i - j - 1])));
+            sum1 = _mm256_add_epi32(sum1, _mm256_mullo_epi32(c[j+1], _mm256_loadu_si256((const __m256i*)&output[i - j - 2])));
+        }
+        if(j < predictor_order) {
+            sum0 = _mm256_add_epi32(sum0, _mm256_mullo_epi32(c[j], _mm256_loadu_si256((const __m256i*)&output[i - j - 1])));
+        }
+        _mm256_storeu_si256((__m256i*)partial, _mm256_add_epi32(sum0, sum1));
+        miniflac_subframe_lpc_finish_group(coefficients, shift, &output[i], partial, 8);
+    }
+
+    miniflac_subframe_lpc_predict_tail32(coefficients, shift, predictor_order, output, i, end);
+}
+#endif
+
+#if defined(MINIFLAC_SIMD_NEON)
+static
+void
+miniflac_subframe_lpc_predict_neon(const int32_t* coefficients, uint8_t shift, uint8_t predictor_order, int32_t* output, uint32_t start, uint32_t end) {
+    int32x4_t c[32];
+    int32x4_t sum0, sum1;
+    uint32_t partial[4];
+    int32_t lanes[4];
+    uint32_t i,j;
+
+    for(j = 0; j < predictor_order; j++) {
+        lanes[0] = coefficients[j];
+        lanes[1] = j >= 1 ? coefficients[j] : 0;
+        lanes[2] = j >= 2 ? coefficients[j] : 0;
+        lanes[3] = j >= 3 ? coefficients[j] : 0;
+        c[j] = vld1q_s32(lanes);
+    }
+
+    for(i = start; i + 4 <= end; i += 4) {
+        sum0 = vdupq_n_s32(0);
+        sum1 = vdupq_n_s32(0);
+        for(j = 0; j + 1 < predictor_order; j += 2) {
+            sum0 = vmlaq_s32(sum0, c[j], vld1q_s32(&output[i - j - 1]));
+            sum1 = vmlaq_s32(sum1, c[j+1], vld1q_s32(&output[i - j - 2]));
+        }
+        if(j < predictor_order) {
+            sum0 = vmlaq_s32(sum0, c[j], vld1q_s32(&output[i - j - 1]));
+        }
+        vst1q_u32(partial, vreinterpretq_u32_s32(vaddq_s32(sum0, sum1)));
+        miniflac_subframe_lpc_finish_group(coefficients, shift, &output[i], partial, 4);
+    }
+
+    miniflac_subframe_lpc_predict_tail32(coefficients, shift, predictor_order, output, i, end);
+}
+#endif
+
+MINIFLAC_PRIVATE
+void
+miniflac_subframe_lpc_select(miniflac_subframe_lpc_t* l, uint8_t bps, uint8_t predictor_order) {
+#if defined(MINIFLAC_SIMD_X86) || defined(MINIFLAC_SIMD_NEON)
+    uint32_t features;
+#endif
+
+    if(!miniflac_subframe_lpc_fits32(l->precision,bps,predictor_order)) {
+        l->predictor = miniflac_subframe_lpc_predictors64[predictor_order];
+        return;
+    }
+
+#if defined(MINIFLAC_SIMD_X86) || defined(MINIFLAC_SIMD_NEON)
+    if(predictor_order >= MINIFLAC_LPC_SIMD_MIN_ORDER) {
+        features = miniflac_cpu_features();
+#if defined(MINIFLAC_SIMD_X86)
+        if(features & MINIFLAC_CPU_AVX2) {
+            l->predictor = miniflac_subframe_lpc_predict_avx2;
+            return;
+        }
+        if(features & MINIFLAC_CPU_SSE41) {
+            l->predictor = miniflac_subframe_lpc_predict_sse41;
+            return;
+        }
+#else
+        if(features & MINIFLAC_CPU_NEON) {
+            l->predictor = miniflac_subframe_lpc_predict_neon;
+            return;
+        }
+#endif
+    }
+#endif
+
+    l->predictor = miniflac_subframe_lpc_predictors32[predictor_order];
+}
+
+MINIFLAC_PRIVATE
+void
+miniflac_subframe_lpc_predict(miniflac_subframe_lpc_t* l, int32_t* output, uint32_t start, uint32_t end) {
+    l->predictor(l->coefficients,l->shift,l->coeff,output,start,end);
+}
+
+#ifdef MINIFLAC_FUSED_PREDICTION
+static
+void
+miniflac_subframe_lpc_restore(void* userdata, int32_t* output, uint32_t start, uint32_t end) {
+    miniflac_subframe_lpc_predict((miniflac_subframe_lpc_t*)userdata,output,start,end);
+}
+#endif
+
 MINIFLAC_PRIVATE
 MINIFLAC_RESULT
 miniflac_subframe_lpc_decode(miniflac_subframe_lpc_t* l, miniflac_bitreader_t* br, int32_t* output, uint32_t block_size, uint8_t bps, miniflac_residual_t* residual, uint8_t predictor_order) {
     int32_t sample;
     int64_t temp;
-    int64_t prediction;
-    uint32_t i,j;
     MINIFLAC_RESULT r;
 
     while(l->pos < predictor_order) {
@@ -61,21 +451,50 @@ miniflac_subframe_lpc_decode(miniflac_subframe_lpc_t* l, miniflac_bitreader_t* b
     if(r != MINIFLAC_OK) return r;
 
     if(output != NULL) {
-        for(i=predictor_order;i<block_size;i++) {
-            prediction = 0;
-            for(j=0;j<predictor_order;j++) {
-                temp = output[i - j - 1];
-                temp *= l->coefficients[j];
-                prediction += temp;
-            }
-            prediction >>= l->shift;
-            prediction += output[i];
-            output[i] = prediction;
-        }
+        miniflac_subframe_lpc_select(l,bps,predictor_order);
+        miniflac_subframe_lpc_predict(l,output,predictor_order,block_size);
     }
 
     return MINIFLAC_OK;
 }
 
+MINIFLAC_PRIVATE
+MINIFLAC_RESULT
+miniflac_subframe_lpc_decode_fast(miniflac_subframe_lpc_t* l, miniflac_bitreader_t* br, int32_t* output, uint32_t block_size, uint8_t bps, uint8_t predictor_order) {
+    int64_t temp;
+    uint32_t i;
+#ifndef MINIFLAC_FUSED_PREDICTION
+    MINIFLAC_RESULT r;
+#endif
+
+    for(i = 0; i < predictor_order; i++) {
+        if(miniflac_bitreader_fill(br,bps)) return MINIFLAC_CONTINUE;
+        output[i] = (int32_t) miniflac_bitreader_read_signed(br,bps);
+    }
+
+    if(miniflac_bitreader_fill(br,9)) return MINIFLAC_CONTINUE;
+    l->precision = miniflac_bitreader_read(br,4) + 1;
+    temp = miniflac_bitreader_read_signed(br,5);
+    if(temp < 0) temp = 0;
+    l->shift = temp;
+
+    for(i = 0; i < predictor_order; i++) {
+        if(miniflac_bitreader_fill(br,l->precision)) return MINIFLAC_CONTINUE;
+        l->coefficients[i] = (int32_t) miniflac_bitreader_read_signed(br,l->precision);
+    }
+    l->coeff = predictor_order;
+
+    miniflac_subframe_lpc_select(l,bps,predictor_order);
+#ifdef MINIFLAC_FUSED_PREDICTION
+    return miniflac_residual_decode_fast(br,block_size,predictor_order,output,miniflac_subframe_lpc_restore,l);
+#else
+    r = miniflac_residual_decode_fast(br,block_size,predictor_order,output,NULL,NULL);
+    if(r != MINIFLAC_OK) return r;
+
+    miniflac_subframe_lpc_predict(l,output,predictor_order,block_size);
+    return MINIFLAC_OK;
+#endif
+}
+
 
 
@@ -14,6 +14,8 @@ enum MINIFLAC_SUBFRAME_LPC_STATE {
     MINIFLAC_SUBFRAME_LPC_COEFF,
 };
 
+typedef void (*miniflac_subframe_lpc_predictor)(const int32_t* coefficients, uint8_t shift, uint8_t predictor_order, int32_t* output, uint32_t start, uint32_t end);
+
 struct miniflac_subframe_lpc_s {
     enum MINIFLAC_SUBFRAME_LPC_STATE state;
     uint32_t pos;
@@ -21,6 +23,7 @@ struct miniflac_subframe_lpc_s {
     uint8_t shift;
     uint8_t coeff;
     int32_t coefficients[32];
+    miniflac_subframe_lpc_predictor predictor; /* restoration loop picked by miniflac_subframe_lpc_select */
 };
 
 typedef struct miniflac_subframe_lpc_s miniflac_subframe_lpc_t;
@@ -38,6 +41,21 @@ MINIFLAC_PRIVATE
 MINIFLAC_RESULT
 miniflac_subframe_lpc_decode(miniflac_subframe_lpc_t* l, miniflac_bitreader_t* br, int32_t* output, uint32_t block_size, uint8_t bps, miniflac_residual_t* residual, uint8_t predictor_order);
 
+MINIFLAC_PRIVATE
+MINIFLAC_RESULT
+miniflac_subframe_lpc_decode_fast(miniflac_subframe_lpc_t* l, miniflac_bitreader_t* br, int32_t* output, uint32_t block_size, uint8_t bps, uint8_t predictor_order);
+
+/* picks the restoration loop for this subframe, needs the precision
+ * and coefficients to be read already */
+MINIFLAC_PRIVATE
+void
+miniflac_subframe_lpc_select(miniflac_subframe_lpc_t* l, uint8_t bps, uint8_t predictor_order);
+
+/* restores samples start..end-1, which hold residuals, in-place */
+MINIFLAC_PRIVATE
+void
+miniflac_subframe_lpc_predict(miniflac_subframe_lpc_t* l, int32_t* output, uint32_t start, uint32_t end);
+
 #ifdef __cplusplus
 }
 #endif
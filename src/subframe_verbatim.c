@@ -28,3 +28,14 @@ miniflac_subframe_verbatim_decode(miniflac_subframe_verbatim_t* c, miniflac_bitr
 
 }
 
+MINIFLAC_PRIVATE
+MINIFLAC_RESULT
+miniflac_subframe_verbatim_decode_fast(miniflac_bitreader_t* br, int32_t* output, uint32_t block_size, uint8_t bps) {
+    uint32_t i;
+
+    for(i = 0; i < block_size; i++) {
+        if(miniflac_bitreader_fill(br,bps)) return MINIFLAC_CONTINUE;
+        output[i] = (int32_t) miniflac_bitreader_read_signed(br,bps);
+    }
+    return MINIFLAC_OK;
+}
@@ -31,6 +31,10 @@ MINIFLAC_PRIVATE
 MINIFLAC_RESULT
 miniflac_subframe_verbatim_decode(miniflac_subframe_verbatim_t* c, miniflac_bitreader_t* br, int32_t* output, uint32_t block_size, uint8_t bps);
 
+MINIFLAC_PRIVATE
+MINIFLAC_RESULT
+miniflac_subframe_verbatim_decode_fast(miniflac_bitreader_t* br, int32_t* output, uint32_t block_size, uint8_t bps);
+
 #ifdef __cplusplus
 }
 #endif
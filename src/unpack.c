@@ -1,7 +1,7 @@
 #include "unpack.h"
 MINIFLAC_PRIVATE
 uint32_t
-miniflac_unpack_uint32le(uint8_t buffer[4]) {
+miniflac_unpack_uint32le(const uint8_t buffer[4]) {
     return (
       (((uint32_t)buffer[0]) << 0 ) |
       (((uint32_t)buffer[1]) << 8 ) |
@@ -11,13 +11,13 @@ miniflac_unpack_uint32le(uint8_t buffer[4]) {
 
 MINIFLAC_PRIVATE
 int32_t
-miniflac_unpack_int32le(uint8_t buffer[4]) {
+miniflac_unpack_int32le(const uint8_t buffer[4]) {
     return (int32_t)miniflac_unpack_uint32le(buffer);
 }
 
 MINIFLAC_PRIVATE
 uint64_t
-miniflac_unpack_uint64le(uint8_t buffer[8]) {
+miniflac_unpack_uint64le(const uint8_t buffer[8]) {
     return (
       (((uint64_t)buffer[0]) << 0 ) |
       (((uint64_t)buffer[1]) << 8 ) |
@@ -31,7 +31,20 @@ miniflac_unpack_uint64le(uint8_t buffer[8]) {
 
 MINIFLAC_PRIVATE
 int64_t
-miniflac_unpack_int64le(uint8_t buffer[8]) {
+miniflac_unpack_int64le(const uint8_t buffer[8]) {
     return (int64_t)miniflac_unpack_uint64le(buffer);
 }
 
+MINIFLAC_PRIVATE
+uint64_t
+miniflac_unpack_uint64be(const uint8_t buffer[8]) {
+    return (
+      (((uint64_t)buffer[0]) << 56) |
+      (((uint64_t)buffer[1]) << 48) |
+      (((uint64_t)buffer[2]) << 40) |
+      (((uint64_t)buffer[3]) << 32) |
+      (((uint64_t)buffer[4]) << 24) |
+      (((uint64_t)buffer[5]) << 16) |
+      (((uint64_t)buffer[6]) << 8 ) |
+      (((uint64_t)buffer[7]) << 0 ));
+}
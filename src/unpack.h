@@ -11,19 +11,23 @@ extern "C" {
 
 MINIFLAC_PRIVATE
 uint32_t
-miniflac_unpack_uint32le(uint8_t buffer[4]);
+miniflac_unpack_uint32le(const uint8_t buffer[4]);
 
 MINIFLAC_PRIVATE
 int32_t
-miniflac_unpack_int32le(uint8_t buffer[4]);
+miniflac_unpack_int32le(const uint8_t buffer[4]);
 
 MINIFLAC_PRIVATE
 uint64_t
-miniflac_unpack_uint64le(uint8_t buffer[8]);
+miniflac_unpack_uint64le(const uint8_t buffer[8]);
 
 MINIFLAC_PRIVATE
 int64_t
-miniflac_unpack_int64le(uint8_t buffer[8]);
+miniflac_unpack_int64le(const uint8_t buffer[8]);
+
+MINIFLAC_PRIVATE
+uint64_t
+miniflac_unpack_uint64be(const uint8_t buffer[8]);
 
 #ifdef __cplusplus
 }
@@ -21,10 +21,13 @@ my @sources = qw[
 src/mflac.c
 src/flac.c
 src/unpack.c
+src/cpu.c
+src/md5.c
 src/bitreader.c
 src/oggheader.c
 src/ogg.c
 src/frame.c
+src/output.c
 src/frameheader.c
 src/vorbiscomment.c
 src/picture.c
@@ -47,6 +50,8 @@ src/subframe_verbatim.c
 
 my @headers = qw[
 src/common.h
+src/cpu.h
+src/md5.h
 src/unpack.h
 src/bitreader.h
 src/oggheader.h
@@ -69,6 +74,7 @@ src/subframe_verbatim.h
 src/subframeheader.h
 src/subframe.h
 src/frameheader.h
+src/output.h
 src/frame.h
 src/flac.h
 src/mflac.h
@@ -0,0 +1,58 @@
+#!/usr/bin/env perl
+
+# tool to generate the Rice lookup table in src/residual.c
+#
+# Each entry decodes as many Rice codewords (up to 3) as fit completely
+# in a 12-bit window, for a given rice parameter:
+#   bits 0-3:   number of bits used
+#   bits 4-5:   number of residuals decoded
+#   bits 8-15:  first residual (int8)
+#   bits 16-23: second residual (int8)
+#   bits 24-31: third residual (int8)
+
+use strict;
+use warnings;
+
+my $window = 12;
+my $max_param = 4;
+my $max_symbols = 3;
+
+print "static const uint32_t miniflac_rice_table[" . ($max_param + 1) . "][" . (1 << $window) . "] = {\n";
+
+for(my $k = 0; $k <= $max_param; $k++) {
+    print "  {\n";
+    my @entries;
+    for(my $w = 0; $w < (1 << $window); $w++) {
+        my @bits = map { ($w >> ($window - 1 - $_)) & 1 } (0 .. $window - 1);
+        my $pos = 0;
+        my @symbols;
+
+        while(@symbols < $max_symbols) {
+            my $q = 0;
+            $q++ while($pos + $q < $window && $bits[$pos + $q] == 0);
+            last if $pos + $q == $window;
+
+            my $end = $pos + $q + 1 + $k;
+            last if $end > $window;
+
+            my $u = $q;
+            for(my $i = $pos + $q + 1; $i < $end; $i++) {
+                $u = ($u << 1) | $bits[$i];
+            }
+            push(@symbols, ($u & 1) ? -(($u >> 1) + 1) : ($u >> 1));
+            $pos = $end;
+        }
+
+        my $entry = $pos | (scalar(@symbols) << 4);
+        for(my $i = 0; $i < @symbols; $i++) {
+            $entry |= ($symbols[$i] & 0xFF) << (8 + 8 * $i);
+        }
+        push(@entries, sprintf("0x%08x", $entry));
+    }
+    while(my @line = splice(@entries, 0, 8)) {
+        print "    " . join(", ", @line) . ",\n";
+    }
+    print "  },\n";
+}
+
+print "};\n";